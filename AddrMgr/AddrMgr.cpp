@@ -12,26 +12,36 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <sstream>
 #include "Portable.h"
 #include <limits.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 #include "AddrMgr.h"
 #include "AddrClient.h"
 #include "DHCPConst.h"
 #include "Logger.h"
+#ifndef WIN32
+#include <pthread.h>
+#endif
 
 using namespace std;
 
-TAddrMgr::TAddrMgr(const std::string& xmlFile, bool loadfile) {
+TAddrMgr::TAddrMgr(const std::string& xmlFile, bool loadfile, const std::string& binFile)
+    :DumpFile(xmlFile), BinFile(binFile), BinDumpFile(binFile), LoadHook(0), ParseQuiet(false),
+     LoadBuf(0), LoadLen(0) {
     this->IsDone = false;
     this->XmlFile = xmlFile;
 
     if (loadfile) {
-        dbLoad(xmlFile.c_str());
-    } else {
-        Log(Debug) << "Skipping database loading." << LogEnd;
+        // binary database is much faster to load, XML is used if it is missing,
+        // broken or was written later
+        if (!binIsCurrent(xmlFile) || !binLoad(BinFile.c_str()))
+            dbLoad(xmlFile.c_str());
     }
     DeleteEmptyClient = true;
 }
@@ -71,17 +81,65 @@ void TAddrMgr::dbLoad(const char * xmlFile)
  * stores content of the AddrMgr database to XML file
  *
  */
+/**
+ * @brief stores database on disk
+ *
+ * File is written only if its content (other than the dump timestamp)
+ * has changed since last dump. Binary copy is written as well (if enabled).
+ */
 void TAddrMgr::dump()
 {
-    std::ofstream xmlDump;
-    xmlDump.open(this->XmlFile.c_str(), std::ios::ate);
+    std::ostringstream xmlDump;
     xmlDump << *this;
-    xmlDump.close();
+    string xml = xmlDump.str();
+
+    // dump time alone is not a change
+    size_t ts = xml.find("<timestamp>");
+    size_t tsEnd = xml.find("</timestamp>", ts);
+    if (ts == string::npos || tsEnd == string::npos)
+        DumpFile.write(xml);
+    else
+        DumpFile.write(xml, ts, tsEnd - ts);
+
+    if (!BinFile.empty())
+        BinDumpFile.write(binDump(), ADDRDB_BIN_TIMESTAMP_OFFSET, 4);
+}
+
+/**
+ * @brief stores database in specified file
+ *
+ * Used to convert between formats: files ending with .xml are
+ * written as XML, all other in binary format.
+ *
+ * @param file name of the file to be written
+ *
+ * @return true if file was written
+ */
+bool TAddrMgr::dbSave(const char * file)
+{
+    string name(file);
+    TStateFile out(name);
+    if (name.length() > 4 && name.substr(name.length() - 4) == ".xml") {
+        std::ostringstream xmlDump;
+        xmlDump << *this;
+        return out.write(xmlDump.str());
+    }
+    return out.write(binDump());
 }
 
 void TAddrMgr::addClient(SPtr<TAddrClient> x)
 {
     ClntsLst.append(x);
+    indexClient(x);
+}
+
+/// adds client loaded from disk
+void TAddrMgr::restoreClient(SPtr<TAddrClient> client)
+{
+    ClntsLst.append(client);
+    indexClient(client);
+    if (LoadHook)
+        LoadHook(client);
 }
 
 void TAddrMgr::firstClient()
@@ -105,14 +163,21 @@ SPtr<TAddrClient> TAddrMgr::getClient()
  */
 SPtr<TAddrClient> TAddrMgr::getClient(SPtr<TDUID> duid)
 {
-    SPtr<TAddrClient> ptr;
-    ClntsLst.first();
-    while (ptr = ClntsLst.get() )
-    {
-        if ( *(ptr->getDUID()) == (*duid) )
-            return ptr;
-    }
-    return 0;
+    SPtr<TAddrClient> * client = ClntsIdx.find(string(duid->get(), duid->getLen()));
+    if (!client)
+        return 0;
+    return *client;
+}
+
+/// makes client findable by its DUID (the first one added, if there are more of them)
+void TAddrMgr::indexClient(SPtr<TAddrClient> client)
+{
+    SPtr<TDUID> duid = client->getDUID();
+    if (!duid)
+        return;
+    SPtr<TAddrClient> & idx = ClntsIdx[string(duid->get(), duid->getLen())];
+    if (!idx)
+        idx = client;
 }
 
 /**
@@ -177,6 +242,14 @@ bool TAddrMgr::delClient(SPtr<TDUID> duid)
         if  ((*ptr->getDUID())==(*duid))
         {
             ClntsLst.del();
+            string key(duid->get(), duid->getLen());
+            ClntsIdx.erase(key);
+            while (ptr = ClntsLst.get()) {
+                if (*ptr->getDUID() == *duid) {
+                    ClntsIdx[key] = ptr;
+                    break;
+                }
+            }
             return true;
         }
     }
@@ -259,12 +332,7 @@ bool TAddrMgr::addPrefix(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
                          SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
                          int length, bool quiet) {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -340,12 +408,7 @@ bool TAddrMgr::updatePrefix(SPtr<TDUID> duid , SPtr<TIPv6Addr> addr,
                             int length, bool quiet)
 {
     // find client...
-    SPtr <TAddrClient> client;
-    this->firstClient();
-    while ( client = this->getClient() ) {
-        if ( (*client->getDUID()) == (*duid) )
-            break;
-    }
+    SPtr<TAddrClient> client = this->getClient(duid);
     if (!client) {
         Log(Error) << "Unable to update prefix " << prefix->getPlain() << "/" << (int)length << ": DUID=" << duid->getPlain() << " not found." << LogEnd;
         return false;
@@ -413,12 +476,7 @@ bool TAddrMgr::delPrefix(SPtr<TDUID> clntDuid,
 
     Log(Debug) << "PD: Deleting prefix " << prefix->getPlain() << ", DUID=" << clntDuid->getPlain() << ", iaid=" << IAID << LogEnd;
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -507,6 +565,321 @@ bool TAddrMgr::prefixIsFree(SPtr<TIPv6Addr> x)
     return true;
 }
 
+// --------------------------------------------------------------------
+// --- binary database ------------------------------------------------
+// --------------------------------------------------------------------
+
+static void binPut8(string & out, uint8_t x) {
+    out.push_back((char)x);
+}
+
+static void binPut16(string & out, uint16_t x) {
+    char buf[2];
+    writeUint16(buf, x);
+    out.append(buf, 2);
+}
+
+static void binPut32(string & out, uint32_t x) {
+    char buf[4];
+    writeUint32(buf, x);
+    out.append(buf, 4);
+}
+
+static void binPutDUID(string & out, SPtr<TDUID> duid) {
+    if (!duid) {
+        binPut16(out, 0);
+        return;
+    }
+    binPut16(out, duid->getLen());
+    out.append(duid->get(), duid->getLen());
+}
+
+/// Adler-32 checksum of the database content
+static uint32_t binChecksum(const char * buf, size_t len) {
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a = (a + (uint8_t)buf[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+/// bounds-checked reader of the binary database
+class TBinReader {
+public:
+    TBinReader(const char * buf, size_t len)
+        :Buf(buf), Len(len), Pos(0), Ok(true) {}
+    const char * get(size_t len) {
+        if (!Ok || Len - Pos < len) {
+            Ok = false;
+            return 0;
+        }
+        Pos += len;
+        return Buf + Pos - len;
+    }
+    uint8_t get8() {
+        const char * x = get(1);
+        return x ? (uint8_t)*x : 0;
+    }
+    uint16_t get16() {
+        const char * x = get(2);
+        return x ? readUint16(x) : 0;
+    }
+    uint32_t get32() {
+        const char * x = get(4);
+        return x ? readUint32(x) : 0;
+    }
+    SPtr<TDUID> getDUID() {
+        uint16_t len = get16();
+        const char * x = get(len);
+        if (!x || !len)
+            return 0;
+        return new TDUID(x, len);
+    }
+    bool ok() { return Ok; }
+    bool end() { return Pos == Len; }
+private:
+    const char * Buf;
+    size_t Len;
+    size_t Pos;
+    bool Ok;
+};
+
+/**
+ * @brief returns database content in a binary format
+ *
+ * All values are stored in network byte order. File starts with
+ * ADDRDB_BIN_HDR_LEN bytes long header:
+ * - magic (8 bytes, ADDRDB_BIN_MAGIC)
+ * - version (16 bits), header length (16 bits)
+ * - timestamp, number of clients, content length, content Adler-32
+ *   checksum, reserved (32 bits each)
+ *
+ * Header is followed by clients. Each client is stored as:
+ * DUID (16 bit length + DUID), SPI (32 bits), number of IAs and PDs
+ * (16 bits each), followed by IAs and then PDs. Each IA/PD is stored as:
+ * IAID, T1, T2, iface (32 bits each), flags (8 bits, 1 = unicast),
+ * unicast address (16 bytes, only if unicast flag is set), DUID (as
+ * above), number of leases (16 bits), followed by leases. Each lease is:
+ * address (16 bytes), pref, valid, timestamp (32 bits each) and prefix
+ * length (8 bits).
+ *
+ * Temporary addresses are not stored (XML loader ignores them, too).
+ *
+ * @return database content
+ */
+string TAddrMgr::binDump()
+{
+    string out;
+    uint32_t clients = 0;
+    SPtr<TAddrClient> client;
+    SPtr<TAddrIA> ia;
+
+    out.reserve(ADDRDB_BIN_HDR_LEN + ClntsLst.count() * 128);
+    out.append(ADDRDB_BIN_HDR_LEN, '\0');
+
+    ClntsLst.first();
+    while (client = ClntsLst.get()) {
+        clients++;
+        binPutDUID(out, client->getDUID());
+        binPut32(out, client->getSPI());
+        binPut16(out, client->countIA());
+        binPut16(out, client->countPD());
+
+        for (int pd = 0; pd < 2; pd++) {
+            if (pd)
+                client->firstPD();
+            else
+                client->firstIA();
+            while (ia = pd ? client->getPD() : client->getIA()) {
+                binPut32(out, ia->getIAID());
+                binPut32(out, ia->getT1());
+                binPut32(out, ia->getT2());
+                binPut32(out, ia->getIface());
+                SPtr<TIPv6Addr> unicast = ia->getSrvAddr();
+                binPut8(out, unicast ? 1 : 0);
+                if (unicast)
+                    out.append(unicast->getAddr(), 16);
+                binPutDUID(out, ia->getDUID());
+
+                if (pd) {
+                    SPtr<TAddrPrefix> prefix;
+                    binPut16(out, ia->getPrefixCount());
+                    ia->firstPrefix();
+                    while (prefix = ia->getPrefix()) {
+                        out.append(prefix->get()->getAddr(), 16);
+                        binPut32(out, prefix->getPref());
+                        binPut32(out, prefix->getValid());
+                        binPut32(out, prefix->getTimestamp());
+                        binPut8(out, prefix->getLength());
+                    }
+                } else {
+                    SPtr<TAddrAddr> addr;
+                    binPut16(out, ia->countAddr());
+                    ia->firstAddr();
+                    while (addr = ia->getAddr()) {
+                        out.append(addr->get()->getAddr(), 16);
+                        binPut32(out, addr->getPref());
+                        binPut32(out, addr->getValid());
+                        binPut32(out, addr->getTimestamp());
+                        binPut8(out, addr->getPrefix());
+                    }
+                }
+            }
+        }
+    }
+
+    char * hdr = &out[0];
+    memcpy(hdr, ADDRDB_BIN_MAGIC, 8);
+    writeUint16(hdr + 8, ADDRDB_BIN_VERSION);
+    writeUint16(hdr + 10, ADDRDB_BIN_HDR_LEN);
+    writeUint32(hdr + ADDRDB_BIN_TIMESTAMP_OFFSET, now());
+    writeUint32(hdr + 16, clients);
+    writeUint32(hdr + 20, out.length() - ADDRDB_BIN_HDR_LEN);
+    writeUint32(hdr + 24, binChecksum(hdr + ADDRDB_BIN_HDR_LEN, out.length() - ADDRDB_BIN_HDR_LEN));
+    return out;
+}
+
+/**
+ * @brief checks if binary database should be loaded instead of XML one
+ *
+ * Both are written by dump(), binary one after XML one. XML database
+ * modified later (e.g. by older version or by hand) takes precedence.
+ *
+ * @param xmlFile XML database
+ *
+ * @return true if binary database exists and is not older than XML one
+ */
+bool TAddrMgr::binIsCurrent(const std::string& xmlFile)
+{
+    struct stat bin, xml;
+    if (BinFile.empty() || stat(BinFile.c_str(), &bin))
+        return false;
+    if (stat(xmlFile.c_str(), &xml) || bin.st_mtime >= xml.st_mtime)
+        return true;
+    Log(Info) << "Database " << xmlFile << " is newer than " << BinFile << ", loading XML." << LogEnd;
+    return false;
+}
+
+/**
+ * @brief loads database stored by binDump()
+ *
+ * File is mapped into memory and parsed in a single pass. Clients
+ * are added only if the whole file is correct.
+ *
+ * @param binFile name of the binary database file
+ *
+ * @return true if database was loaded
+ */
+bool TAddrMgr::binLoad(const char * binFile)
+{
+    unsigned int len = 0;
+    char * buf = file_map(binFile, &len);
+    if (!buf) {
+        Log(Debug) << "Binary database " << binFile << " not found." << LogEnd;
+        return false;
+    }
+
+    if (len < ADDRDB_BIN_HDR_LEN || memcmp(buf, ADDRDB_BIN_MAGIC, 8)) {
+        Log(Warning) << "File " << binFile << " is not a binary database." << LogEnd;
+        file_unmap(buf, len);
+        return false;
+    }
+    uint16_t version = readUint16(buf + 8);
+    uint16_t hdrLen = readUint16(buf + 10);
+    uint32_t ts = readUint32(buf + ADDRDB_BIN_TIMESTAMP_OFFSET);
+    uint32_t clients = readUint32(buf + 16);
+    uint32_t contentLen = readUint32(buf + 20);
+    if (version != ADDRDB_BIN_VERSION || hdrLen < ADDRDB_BIN_HDR_LEN || hdrLen > len
+        || contentLen != len - hdrLen) {
+        Log(Warning) << "Binary database " << binFile << " has unsupported version (" << version
+                     << ") or is truncated." << LogEnd;
+        file_unmap(buf, len);
+        return false;
+    }
+    if (binChecksum(buf + hdrLen, contentLen) != readUint32(buf + 24)) {
+        Log(Warning) << "Binary database " << binFile << " is corrupted (checksum mismatch)." << LogEnd;
+        file_unmap(buf, len);
+        return false;
+    }
+
+    Log(Info) << "Loading old address database (" << binFile << ", " << clients
+              << " clients), db is " << (now() - ts) << " second(s) old." << LogEnd;
+
+    TBinReader db(buf + hdrLen, contentLen);
+    List(TAddrClient) loaded;
+    for (uint32_t i = 0; i < clients && db.ok(); i++) {
+        SPtr<TDUID> duid = db.getDUID();
+        if (!duid)
+            duid = new TDUID();
+        SPtr<TAddrClient> client = new TAddrClient(duid);
+        client->setSPI(db.get32());
+        int iaCnt = db.get16();
+        int pdCnt = db.get16();
+
+        for (int j = 0; j < iaCnt + pdCnt && db.ok(); j++) {
+            bool pd = j >= iaCnt;
+            unsigned long iaid = db.get32();
+            unsigned long t1 = db.get32();
+            unsigned long t2 = db.get32();
+            int iface = db.get32();
+            SPtr<TIPv6Addr> unicast;
+            if (db.get8() & 1) {
+                const char * x = db.get(16);
+                if (x)
+                    unicast = new TIPv6Addr(x);
+            }
+            SPtr<TDUID> iaDuid = db.getDUID();
+            SPtr<TAddrIA> ia = new TAddrIA(iface, pd ? TAddrIA::TYPE_PD : TAddrIA::TYPE_IA,
+                                           0, iaDuid, t1, t2, iaid);
+            if (unicast)
+                ia->setUnicast(unicast);
+
+            int leases = db.get16();
+            for (int k = 0; k < leases && db.ok(); k++) {
+                const char * x = db.get(16);
+                unsigned long pref = db.get32();
+                unsigned long valid = db.get32();
+                unsigned long timestamp = db.get32();
+                int length = db.get8();
+                if (!db.ok())
+                    break;
+                if (pd) {
+                    SPtr<TAddrPrefix> prefix = new TAddrPrefix(new TIPv6Addr(x), pref, valid, length);
+                    prefix->setTimestamp(timestamp);
+                    prefix->setTentative(TENTATIVE_NO);
+                    ia->addPrefix(prefix);
+                } else {
+                    SPtr<TAddrAddr> addr = new TAddrAddr(new TIPv6Addr(x), pref, valid, length);
+                    addr->setTimestamp(timestamp);
+                    addr->setTentative(TENTATIVE_NO);
+                    ia->addAddr(addr);
+                }
+            }
+            ia->setTentative();
+            if (pd)
+                client->addPD(ia);
+            else
+                client->addIA(ia);
+        }
+        loaded.append(client);
+    }
+    bool ok = db.ok() && db.end();
+    file_unmap(buf, len);
+
+    if (!ok) {
+        Log(Warning) << "Binary database " << binFile << " is malformed." << LogEnd;
+        return false;
+    }
+
+    SPtr<TAddrClient> client;
+    loaded.first();
+    while (client = loaded.get())
+        restoreClient(client);
+    Log(Info) << "Loaded " << loaded.count() << " client(s) from " << binFile << "." << LogEnd;
+    return true;
+}
+
 // --------------------------------------------------------------------
 // --- XML-related methods (libxml2) ----------------------------------
 // --------------------------------------------------------------------
@@ -559,7 +932,7 @@ bool TAddrMgr::xmlLoadBuiltIn(const char * xmlFile)
         }
         if (AddrMgrTag && strstr(buf,"<AddrClient")) {
             clnt = parseAddrClient(xmlFile, f);
-            ClntsLst.append(clnt);
+            restoreClient(clnt);
             Log(Debug) << "Client " << clnt->getDUID()->getPlain()
                        << " loaded from disk successfuly (" << clnt->countIA()
                        << "/" << clnt->countPD() << "/" << clnt->countTA()
@@ -580,6 +953,164 @@ bool TAddrMgr::xmlLoadBuiltIn(const char * xmlFile)
     return false;
 }
 
+/// part of the XML database parsed by one loader thread
+struct TAddrMgr::TLoadChunk {
+    TAddrMgr * Mgr;
+    const char * File;
+    const char * Buf;
+    unsigned int Len;
+    std::vector< SPtr<TAddrClient> > Clients;
+    int Errors;
+#ifndef WIN32
+    pthread_t Thread;
+#endif
+    bool Started;
+};
+
+static const char * findTag(const char * from, const char * end, const char * tag) {
+    const char * x = std::search(from, end, tag, tag + strlen(tag));
+    return (x == end) ? 0 : x;
+}
+
+/// parses all clients in a chunk (runs in a loader thread, must not log)
+void * TAddrMgr::xmlLoadThread(void * arg)
+{
+    TLoadChunk * chunk = (TLoadChunk*)arg;
+    char buf[256];
+
+    FILE * f = fmemopen((void*)chunk->Buf, chunk->Len, "r");
+    if (!f) {
+        chunk->Errors++;
+        return 0;
+    }
+    while (fgets(buf, 255, f)) {
+        if (!strstr(buf, "<AddrClient"))
+            continue;
+        SPtr<TAddrClient> clnt = chunk->Mgr->parseAddrClient(chunk->File, f);
+        if (clnt)
+            chunk->Clients.push_back(clnt);
+        else
+            chunk->Errors++;
+    }
+    fclose(f);
+    return 0;
+}
+
+/**
+ * @brief starts loading of the XML database in several threads
+ *
+ * File is mapped into memory and split into chunks at <AddrClient>
+ * boundaries. Each chunk is parsed by its own thread into a separate
+ * list, so caller may do something else in the meantime. Loaded clients
+ * are added by xmlLoadFinish(). Parse methods don't log while the
+ * threads are running.
+ *
+ * @param xmlFile filename that contains database
+ * @param threads max. number of threads
+ *
+ * @return true if threads were started, false if caller should use
+ *         xmlLoadBuiltIn() instead (small or missing file, no thread support)
+ */
+bool TAddrMgr::xmlLoadStart(const char * xmlFile, int threads)
+{
+#ifdef WIN32
+    return false;
+#else
+    unsigned int len = 0;
+    char * buf = file_map(xmlFile, &len);
+    if (!buf)
+        return false;
+    if (threads > (int)(len / ADDRDB_LOAD_CHUNK_MIN))
+        threads = len / ADDRDB_LOAD_CHUNK_MIN;
+
+    const char * end = buf + len;
+    const char * from = findTag(buf, end, "<AddrMgr>");
+    const char * last = from ? findTag(from, end, "</AddrMgr>") : 0;
+    if (!last)
+        last = end; // truncated file, parse as much as possible
+    if (from)
+        from = findTag(from, last, "<AddrClient");
+    if (threads < 2 || !from) {
+        file_unmap(buf, len);
+        return false;
+    }
+
+    Log(Info) << "Loading old address database (" << xmlFile << ", " << len << " bytes), using "
+              << threads << " threads." << LogEnd;
+
+    // split remaining part evenly among remaining threads
+    for (int i = 0; i < threads && from < last; i++) {
+        const char * to = last;
+        if (i < threads - 1) {
+            to = findTag(from + (last - from) / (threads - i), last, "<AddrClient");
+            if (!to)
+                to = last;
+        }
+        TLoadChunk * chunk = new TLoadChunk();
+        chunk->Mgr = this;
+        chunk->File = xmlFile;
+        chunk->Buf = from;
+        chunk->Len = to - from;
+        chunk->Errors = 0;
+        chunk->Started = false;
+        LoadChunks.push_back(chunk);
+        from = to;
+    }
+
+    LoadBuf = buf;
+    LoadLen = len;
+    ParseQuiet = true;
+    for (unsigned int i = 0; i < LoadChunks.size(); i++) {
+        LoadChunks[i]->Started = !pthread_create(&LoadChunks[i]->Thread, NULL,
+                                                 xmlLoadThread, LoadChunks[i]);
+    }
+    return true;
+#endif
+}
+
+/**
+ * @brief waits for threads started by xmlLoadStart() and adds loaded clients
+ *
+ * Clients are added in the same order as they are stored in the file.
+ *
+ * @return true if at least one client was loaded
+ */
+bool TAddrMgr::xmlLoadFinish()
+{
+    unsigned int clients = 0;
+    int errors = 0;
+
+    for (unsigned int i = 0; i < LoadChunks.size(); i++) {
+        TLoadChunk * chunk = LoadChunks[i];
+#ifndef WIN32
+        if (chunk->Started)
+            pthread_join(chunk->Thread, NULL);
+        else
+#endif
+            xmlLoadThread(chunk); // thread could not be started
+    }
+    ParseQuiet = false;
+
+    for (unsigned int i = 0; i < LoadChunks.size(); i++) {
+        TLoadChunk * chunk = LoadChunks[i];
+        for (unsigned int j = 0; j < chunk->Clients.size(); j++)
+            restoreClient(chunk->Clients[j]);
+        clients += chunk->Clients.size();
+        errors += chunk->Errors;
+        delete chunk;
+    }
+    LoadChunks.clear();
+    if (LoadBuf)
+        file_unmap(LoadBuf, LoadLen);
+    LoadBuf = 0;
+    LoadLen = 0;
+
+    if (errors)
+        Log(Warning) << errors << " client(s) in " << XmlFile << " could not be parsed." << LogEnd;
+    Log(Info) << clients << " client(s) loaded from disk." << LogEnd;
+    return clients > 0;
+}
+
 /**
  * @brief parses XML section that defines single client
  *
@@ -606,7 +1137,7 @@ SPtr<TAddrClient> TAddrMgr::parseAddrClient(const char * xmlFile, FILE *f)
 
     while (!feof(f)) {
         if (!fgets(buf,255,f)) {
-            Log(Error) << "Truncated " << xmlFile << " file: failed to read AddrClient content." << LogEnd;
+            if (!ParseQuiet) Log(Error) << "Truncated " << xmlFile << " file: failed to read AddrClient content." << LogEnd;
             return 0;
         }
 
@@ -641,19 +1172,22 @@ SPtr<TAddrClient> TAddrMgr::parseAddrClient(const char * xmlFile, FILE *f)
             if ((x=strstr(buf,"unicast"))) {
                 char *end = strstr(x+9, "\"");
                 string uni(x+9, end);
-                unicast = new TIPv6Addr(uni.c_str(), true);
+                if (!uni.empty()) // unicast="" means multicast
+                    unicast = new TIPv6Addr(uni.c_str(), true);
             }
             if (ia = parseAddrIA(xmlFile, f, t1, t2, iaid, iface)) {
                 if (!ia)
                     continue;
+                if (ParseQuiet && clnt->getIA(iaid))
+                    continue; // duplicate IA, addIA() would log
                 clnt->addIA(ia);
-                Log(Debug) << "Parsed IA, iaid=" << iaid;
+                if (!ParseQuiet) Log(Debug) << "Parsed IA, iaid=" << iaid;
                 if (unicast) {
                     ia->setUnicast(unicast);
-                    Log(Cont) << ", unicast=" << unicast->getPlain();
+                    if (!ParseQuiet) Log(Cont) << ", unicast=" << unicast->getPlain();
                     unicast = 0;
                 }
-                Log(Cont) << LogEnd;
+                if (!ParseQuiet) Log(Cont) << LogEnd;
                 continue;
             }
         }
@@ -682,8 +1216,8 @@ SPtr<TAddrClient> TAddrMgr::parseAddrClient(const char * xmlFile, FILE *f)
                 if (!ptrpd)
                     continue;
                 clnt->addPD(ptrpd);
-                Log(Debug) << "Parsed PD, pdid=" << pdid << ", t1=" << t1
-                           << ", t2=" << t2 << LogEnd;
+                if (!ParseQuiet) Log(Debug) << "Parsed PD, pdid=" << pdid << ", t1=" << t1
+                                            << ", t2=" << t2 << LogEnd;
             }
         }
         if (strstr(buf,"</AddrClient>"))
@@ -708,7 +1242,7 @@ SPtr<TAddrIA> TAddrMgr::parseAddrTA(const char * xmlFile, FILE *f) {
     char buf[256];
     while(!feof(f)) {
         if (!fgets(buf,255,f)) {
-            Log(Error) << "Failed to parse AddrTA. File " << xmlFile << " truncated." << LogEnd;
+            if (!ParseQuiet) Log(Error) << "Failed to parse AddrTA. File " << xmlFile << " truncated." << LogEnd;
             return 0;
         }
         if (strstr(buf,"</AddrTA>")){
@@ -742,7 +1276,7 @@ SPtr<TAddrIA> TAddrMgr::parseAddrPD(const char * xmlFile, FILE * f, int t1,int t
     SPtr<TDUID> duid = 0;
     while (!feof(f)) {
         if (!fgets(buf,255,f)) {
-            Log(Error) << "Failed to parse AddrPD entry. File " << xmlFile << " truncated." << LogEnd;
+            if (!ParseQuiet) Log(Error) << "Failed to parse AddrPD entry. File " << xmlFile << " truncated." << LogEnd;
             return 0;
         }
         if (strstr(buf,"duid")) {
@@ -753,8 +1287,8 @@ SPtr<TAddrIA> TAddrMgr::parseAddrPD(const char * xmlFile, FILE * f, int t1,int t
                 *x = 0; // remove trailing xml tag
             duid = new TDUID(strstr(buf,">")+1);
             // Log(Debug) << "Parsed IA: duid=" << duid->getPlain() << LogEnd;
-            Log(Debug) << "Loaded PD from a file: t1=" << t1 << ", t2="<< t2
-                       << ", iaid=" << iaid << ", iface=" << iface << LogEnd;
+            if (!ParseQuiet) Log(Debug) << "Loaded PD from a file: t1=" << t1 << ", t2="<< t2
+                                        << ", iaid=" << iaid << ", iface=" << iface << LogEnd;
 
             ptrpd = new TAddrIA(iface, TAddrIA::TYPE_PD, 0, duid, t1, t2, iaid);
             continue;
@@ -801,7 +1335,7 @@ SPtr<TAddrIA> TAddrMgr::parseAddrIA(const char * xmlFile, FILE * f, int t1,int t
     SPtr<TDUID> duid = 0;
     while (!feof(f)) {
         if (!fgets(buf,255,f)) {
-            Log(Error) << "Failed to parse AddrIA entry. File " << xmlFile << " truncated." << LogEnd;
+            if (!ParseQuiet) Log(Error) << "Failed to parse AddrIA entry. File " << xmlFile << " truncated." << LogEnd;
             return 0;
         }
         if (strstr(buf,"duid")) {
@@ -813,8 +1347,8 @@ SPtr<TAddrIA> TAddrMgr::parseAddrIA(const char * xmlFile, FILE * f, int t1,int t
                   duid = new TDUID(strstr(buf,">")+1);
                   // Log(Debug) << "Parsed IA: duid=" << duid->getPlain() << LogEnd;
 
-                  Log(Debug) << "Loaded IA from a file: t1=" << t1 << ", t2="<< t2
-                             << ",iaid=" << iaid << ", iface=" << iface << LogEnd;
+                  if (!ParseQuiet) Log(Debug) << "Loaded IA from a file: t1=" << t1 << ", t2="<< t2
+                                              << ",iaid=" << iaid << ", iface=" << iface << LogEnd;
 
                   ia = new TAddrIA(iface, TAddrIA::TYPE_IA, 0, duid, t1,t2, iaid);
                   continue;
@@ -884,11 +1418,14 @@ SPtr<TAddrAddr> TAddrMgr::parseAddrAddr(const char * xmlFile, char * buf, bool p
                   if (x)
                       *x = 0;
                   addr = new TIPv6Addr(strstr(buf,">")+1, true);
-                  Log(Debug) << "Parsed addr=" << addr->getPlain() << ", pref=" << pref << ", valid=" << valid << ",ts=" << timestamp << LogEnd;
+                  if (!ParseQuiet) Log(Debug) << "Parsed addr=" << addr->getPlain() << ", pref=" << pref << ", valid=" << valid << ",ts=" << timestamp << LogEnd;
 
               }
               if (addr && timestamp && pref && valid && pd==false) {
-                  addraddr = new TAddrAddr(addr, pref, valid, prefix);
+                  // constructor logs if pref > valid and loader threads must not log, so
+                  // they pass valid there; pref is set below in both modes
+                  addraddr = new TAddrAddr(addr, ParseQuiet ? valid : pref, valid, prefix);
+                  addraddr->setPref(pref);
                   addraddr->setTimestamp(timestamp);
               }
     }
@@ -933,12 +1470,14 @@ SPtr<TAddrPrefix> TAddrMgr::parseAddrPrefix(const char * xmlFile, char * buf, bo
                   if (x)
                       *x = 0;
                   addr = new TIPv6Addr(strstr(buf,">")+1, true);
-                  Log(Debug) << "Parsed prefix " << addr->getPlain() << "/"
-                             << length << ", pref=" << pref << ", valid=" << valid
-                             << ",ts=" << timestamp << LogEnd;
+                  if (!ParseQuiet) Log(Debug) << "Parsed prefix " << addr->getPlain() << "/"
+                                              << length << ", pref=" << pref << ", valid=" << valid
+                                              << ",ts=" << timestamp << LogEnd;
               }
               if (addr && timestamp && pref && valid && pd==true) {
-                  addraddr = new TAddrPrefix(addr, pref, valid, length);
+                  // see parseAddrAddr()
+                  addraddr = new TAddrPrefix(addr, ParseQuiet ? valid : pref, valid, length);
+                  addraddr->setPref(pref);
                   addraddr->setTimestamp(timestamp);
               }
     }
@@ -13,10 +13,13 @@ class TAddrMgr;
 #define ADDRMGR_H
 
 #include <string>
+#include <vector>
 #include "SmartPtr.h"
 #include "Container.h"
 #include "AddrClient.h"
 #include "AddrIA.h"
+#include "StateFile.h"
+#include "HashMap.h"
 
 #ifdef MOD_LIBXML2
 #include <libxml/xmlmemory.h>
@@ -25,6 +28,14 @@ class TAddrMgr;
 #define ADDRDB_DTD (xmlChar*)"AddrMgr.dtd"
 #endif
 
+#define ADDRDB_BIN_MAGIC   "DIBLEASE"
+#define ADDRDB_BIN_VERSION 1
+#define ADDRDB_BIN_HDR_LEN 32
+#define ADDRDB_BIN_TIMESTAMP_OFFSET 12 /* 32 bits, not a change of content */
+
+/* XML database smaller than this is loaded without extra threads */
+#define ADDRDB_LOAD_CHUNK_MIN 65536
+
 ///
 /// @brief Address Manager that holds address and prefix information.
 ///
@@ -44,8 +55,11 @@ class TAddrMgr;
 class TAddrMgr
 {
   public:
+    /// called for every client loaded from disk (e.g. to update pool usage counters)
+    typedef void (*TLoadHook)(SPtr<TAddrClient> client);
+
     friend std::ostream & operator<<(std::ostream & strum,TAddrMgr &x);
-    TAddrMgr(const std::string& addrdb, bool loadfile = false);
+    TAddrMgr(const std::string& addrdb, bool loadfile = false, const std::string& bindb = "");
     virtual ~TAddrMgr();
 
     //--- Client container ---
@@ -80,9 +94,15 @@ class TAddrMgr
     // --- backup/restore ---
     void dbLoad(const char * xmlFile);
     virtual void dump();
+    bool dbSave(const char * file);
     bool isDone();
     bool restore;
 
+    // binary database (see binDump() for format description)
+    bool binLoad(const char * binFile);
+    std::string binDump();
+    bool binIsCurrent(const std::string& xmlFile);
+
 #ifdef MOD_LIBXML2
     // database loading methods that use libxml2
     xmlDocPtr xmlLoad(const char * filename);
@@ -93,6 +113,8 @@ class TAddrMgr
 #else
     // database loading methods that use internal loading routines
     bool xmlLoadBuiltIn(const char * xmlFile);
+    bool xmlLoadStart(const char * xmlFile, int threads);
+    bool xmlLoadFinish();
     SPtr<TAddrClient> parseAddrClient(const char * xmlFile, FILE *f);
     SPtr<TAddrIA> parseAddrIA(const char * xmlFile, FILE * f, int t1,int t2,int iaid,int iface);
     SPtr<TAddrIA> parseAddrPD(const char * xmlFile, FILE * f, int t1,int t2,int iaid,int iface);
@@ -103,6 +125,8 @@ class TAddrMgr
 
 protected:
     virtual void print(std::ostream & out) = 0;
+    void restoreClient(SPtr<TAddrClient> client);
+    void indexClient(SPtr<TAddrClient> client);
     bool addPrefix(SPtr<TAddrClient> client, SPtr<TDUID> duid , SPtr<TIPv6Addr> clntAddr,
                    int iface, unsigned long IAID, unsigned long T1, unsigned long T2,
                    SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
@@ -114,9 +138,24 @@ protected:
 
     bool IsDone;
     List(TAddrClient) ClntsLst;
+    THashMap< SPtr<TAddrClient> > ClntsIdx; // DUID -> client, see getClient(duid)
     std::string XmlFile;
+    TStateFile DumpFile; // skips rewriting XmlFile if nothing has changed
+    std::string BinFile; // binary copy of the database, loaded at startup (empty = none)
+    TStateFile BinDumpFile;
 
     bool DeleteEmptyClient; // should the client without any IA, TA or PDs be deleted? (srv = yes, client = no)
+
+    TLoadHook LoadHook; // called for every loaded client (0 = none)
+    bool ParseQuiet;    // parse methods don't log (they are run by loader threads)
+
+  private:
+    // parallel XML database loading (see xmlLoadStart())
+    struct TLoadChunk;
+    static void * xmlLoadThread(void * chunk);
+    std::vector<TLoadChunk*> LoadChunks;
+    char * LoadBuf;
+    unsigned int LoadLen;
 };
 
 #endif
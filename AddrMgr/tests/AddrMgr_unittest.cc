@@ -0,0 +1,245 @@
+#include <stdio.h>
+#include <utime.h>
+#include <IPv6Addr.h>
+#include <DUID.h>
+#include <AddrMgr.h>
+#include <StateFile.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+    class NakedAddrMgr : public TAddrMgr {
+    public:
+        NakedAddrMgr(const std::string& xmlFile, bool loadDB, const std::string& binFile = "")
+            :TAddrMgr(xmlFile, loadDB, binFile) { }
+        void print(std::ostream & out) { }
+    };
+
+    class AddrMgrTest : public ::testing::Test {
+    public:
+        AddrMgrTest() { }
+    };
+
+TEST_F(AddrMgrTest, binaryRoundTrip) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+
+    SPtr<TDUID> duid = new TDUID("00:01:00:0a:0b:0c:0d:0e:0f");
+    SPtr<TAddrClient> client = new TAddrClient(duid);
+    SPtr<TAddrIA> ia = new TAddrIA(3, TAddrIA::TYPE_IA, 0, duid, 100, 200, 7);
+    ia->addAddr(new TIPv6Addr("2001:db8::1", true), 300, 400, 64);
+    client->addIA(ia);
+    SPtr<TAddrIA> pd = new TAddrIA(3, TAddrIA::TYPE_PD, 0, duid, 100, 200, 8);
+    pd->addPrefix(new TIPv6Addr("2001:db8:1::", true), 500, 600, 48);
+    client->addPD(pd);
+    mgr.addClient(client);
+
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest.db"));
+
+    NakedAddrMgr loaded("AddrMgrTest.xml", false);
+    ASSERT_TRUE(loaded.binLoad("AddrMgrTest.db"));
+    remove("AddrMgrTest.db");
+    ASSERT_EQ(1, loaded.countClient());
+
+    SPtr<TAddrClient> x = loaded.getClient(duid);
+    ASSERT_TRUE(x != 0);
+    ASSERT_EQ(1, x->countIA());
+    ASSERT_EQ(1, x->countPD());
+
+    SPtr<TAddrIA> xia = x->getIA(7);
+    ASSERT_TRUE(xia != 0);
+    EXPECT_EQ(100u, xia->getT1());
+    EXPECT_EQ(200u, xia->getT2());
+    EXPECT_EQ(3, xia->getIface());
+    SPtr<TAddrAddr> addr = xia->getAddr(new TIPv6Addr("2001:db8::1", true));
+    ASSERT_TRUE(addr != 0);
+    EXPECT_EQ(300u, addr->getPref());
+    EXPECT_EQ(400u, addr->getValid());
+
+    SPtr<TAddrIA> xpd = x->getPD(8);
+    ASSERT_TRUE(xpd != 0);
+    xpd->firstPrefix();
+    SPtr<TAddrPrefix> prefix = xpd->getPrefix();
+    ASSERT_TRUE(prefix != 0);
+    EXPECT_EQ(48, prefix->getLength());
+    EXPECT_EQ(600u, prefix->getValid());
+}
+
+TEST_F(AddrMgrTest, binaryCorrupted) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    mgr.addClient(new TAddrClient(new TDUID("00:01:00:0a:0b:0c")));
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest.db"));
+
+    // flip one byte of the content, checksum must catch it
+    FILE * f = fopen("AddrMgrTest.db", "r+b");
+    ASSERT_TRUE(f);
+    fseek(f, ADDRDB_BIN_HDR_LEN + 3, SEEK_SET);
+    fputc(0xff, f);
+    fclose(f);
+
+    NakedAddrMgr loaded("AddrMgrTest.xml", false);
+    EXPECT_FALSE(loaded.binLoad("AddrMgrTest.db"));
+    remove("AddrMgrTest.db");
+    EXPECT_EQ(0, loaded.countClient());
+}
+
+TEST_F(AddrMgrTest, binaryTimestampIsNotChange) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    mgr.addClient(new TAddrClient(new TDUID("00:01:00:0a:0b:0c")));
+    std::string db = mgr.binDump();
+
+    TStateFile file("AddrMgrTest.db");
+    EXPECT_TRUE(file.write(db, ADDRDB_BIN_TIMESTAMP_OFFSET, 4));
+
+    // the same leases dumped later must not rewrite the file
+    db[ADDRDB_BIN_TIMESTAMP_OFFSET + 3]++;
+    EXPECT_FALSE(file.write(db, ADDRDB_BIN_TIMESTAMP_OFFSET, 4));
+
+    // but any other change must
+    mgr.addClient(new TAddrClient(new TDUID("00:01:00:0a:0b:0d")));
+    EXPECT_TRUE(file.write(mgr.binDump(), ADDRDB_BIN_TIMESTAMP_OFFSET, 4));
+    remove("AddrMgrTest.db");
+}
+
+TEST_F(AddrMgrTest, binaryOrXmlNewer) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    mgr.addClient(new TAddrClient(new TDUID("00:01:00:0a:0b:0c")));
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest.xml"));
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest.db"));
+
+    NakedAddrMgr check("AddrMgrTest.xml", false, "AddrMgrTest.db");
+    struct utimbuf older, newer;
+    older.actime = older.modtime = 1000000;
+    newer.actime = newer.modtime = 2000000;
+
+    utime("AddrMgrTest.xml", &older);
+    utime("AddrMgrTest.db", &newer);
+    EXPECT_TRUE(check.binIsCurrent("AddrMgrTest.xml"));
+
+    utime("AddrMgrTest.db", &older);
+    EXPECT_TRUE(check.binIsCurrent("AddrMgrTest.xml")); // written in the same second
+
+    utime("AddrMgrTest.xml", &newer);
+    EXPECT_FALSE(check.binIsCurrent("AddrMgrTest.xml"));
+
+    remove("AddrMgrTest.xml");
+    EXPECT_TRUE(check.binIsCurrent("AddrMgrTest.xml"));
+
+    remove("AddrMgrTest.db");
+    EXPECT_FALSE(check.binIsCurrent("AddrMgrTest.xml"));
+}
+
+TEST_F(AddrMgrTest, parallelLoad) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    for (int i = 0; i < 4000; i++) {
+        char buf[64];
+        sprintf(buf, "00:01:00:0a:%02x:%02x", i >> 8, i & 0xff);
+        SPtr<TDUID> duid = new TDUID(buf);
+        SPtr<TAddrClient> client = new TAddrClient(duid);
+        SPtr<TAddrIA> ia = new TAddrIA(1, TAddrIA::TYPE_IA, 0, duid, 100, 200, i);
+        sprintf(buf, "2001:db8::%x", i + 1);
+        ia->addAddr(new TIPv6Addr(buf, true), 300, 400, 64);
+        client->addIA(ia);
+        mgr.addClient(client);
+    }
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest-big.xml"));
+
+    NakedAddrMgr loaded("AddrMgrTest.xml", false);
+    ASSERT_TRUE(loaded.xmlLoadStart("AddrMgrTest-big.xml", 4));
+    ASSERT_TRUE(loaded.xmlLoadFinish());
+    remove("AddrMgrTest-big.xml");
+    ASSERT_EQ(4000, loaded.countClient());
+
+    // clients must be restored in the same order
+    SPtr<TAddrClient> a, b;
+    mgr.firstClient();
+    loaded.firstClient();
+    while ( (a = mgr.getClient()) && (b = loaded.getClient()) ) {
+        ASSERT_TRUE(*a->getDUID() == *b->getDUID());
+        a->firstIA();
+        SPtr<TAddrIA> ia = b->getIA(a->getIA()->getIAID());
+        ASSERT_TRUE(ia != 0);
+        EXPECT_EQ(1, ia->countAddr());
+    }
+}
+
+// pref > valid is kept as stored, whether the file is loaded by threads or not
+TEST_F(AddrMgrTest, prefLargerThanValid) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    SPtr<TDUID> duid = new TDUID("00:01:00:0a:0b:0c:0d:0e:0f");
+    SPtr<TAddrClient> client = new TAddrClient(duid);
+    SPtr<TAddrIA> ia = new TAddrIA(1, TAddrIA::TYPE_IA, 0, duid, 100, 200, 7);
+    ia->addAddr(new TIPv6Addr("2001:db8::1", true), 500, 400, 64);
+    client->addIA(ia);
+    SPtr<TAddrIA> pd = new TAddrIA(1, TAddrIA::TYPE_PD, 0, duid, 100, 200, 8);
+    pd->addPrefix(new TIPv6Addr("2001:db8:1::", true), 700, 600, 48);
+    client->addPD(pd);
+    mgr.addClient(client);
+    // enough other clients for the file to be split among threads
+    for (int i = 0; i < 400; i++) {
+        char buf[64];
+        sprintf(buf, "00:01:00:0b:%02x:%02x", i >> 8, i & 0xff);
+        SPtr<TDUID> other = new TDUID(buf);
+        SPtr<TAddrClient> c = new TAddrClient(other);
+        SPtr<TAddrIA> oia = new TAddrIA(1, TAddrIA::TYPE_IA, 0, other, 100, 200, i);
+        sprintf(buf, "2001:db8::1:%x", i + 1);
+        oia->addAddr(new TIPv6Addr(buf, true), 300, 400, 64);
+        c->addIA(oia);
+        mgr.addClient(c);
+    }
+    ASSERT_TRUE(mgr.dbSave("AddrMgrTest-pref.xml"));
+
+    NakedAddrMgr seq("AddrMgrTest.xml", false);
+    ASSERT_TRUE(seq.xmlLoadBuiltIn("AddrMgrTest-pref.xml"));
+    NakedAddrMgr par("AddrMgrTest.xml", false);
+    ASSERT_TRUE(par.xmlLoadStart("AddrMgrTest-pref.xml", 2));
+    ASSERT_TRUE(par.xmlLoadFinish());
+    remove("AddrMgrTest-pref.xml");
+
+    NakedAddrMgr * loaded[] = { &seq, &par };
+    for (int i = 0; i < 2; i++) {
+        SPtr<TAddrClient> c = loaded[i]->getClient(duid);
+        ASSERT_TRUE(c != 0);
+        SPtr<TAddrIA> lia = c->getIA(7);
+        ASSERT_TRUE(lia != 0);
+        lia->firstAddr();
+        SPtr<TAddrAddr> addr = lia->getAddr();
+        ASSERT_TRUE(addr != 0);
+        EXPECT_EQ(500u, addr->getPref());
+        EXPECT_EQ(400u, addr->getValid());
+
+        SPtr<TAddrIA> lpd = c->getPD(8);
+        ASSERT_TRUE(lpd != 0);
+        lpd->firstPrefix();
+        SPtr<TAddrPrefix> prefix = lpd->getPrefix();
+        ASSERT_TRUE(prefix != 0);
+        EXPECT_EQ(700u, prefix->getPref());
+        EXPECT_EQ(600u, prefix->getValid());
+    }
+}
+
+// clients are found by DUID, also after another client with the same DUID is deleted
+TEST_F(AddrMgrTest, clientByDuid) {
+    NakedAddrMgr mgr("AddrMgrTest.xml", false);
+    SPtr<TAddrClient> a = new TAddrClient(new TDUID("00:01:00:0a:0b:0c"));
+    SPtr<TAddrClient> b = new TAddrClient(new TDUID("00:01:00:0a:0b:0c"));
+    SPtr<TAddrClient> c = new TAddrClient(new TDUID("00:01:00:0a:0b:0d"));
+    mgr.addClient(a);
+    mgr.addClient(b);
+    mgr.addClient(c);
+
+    SPtr<TDUID> duid = new TDUID("00:01:00:0a:0b:0c");
+    EXPECT_TRUE(mgr.getClient(duid) == a);
+    EXPECT_TRUE(mgr.getClient(new TDUID("00:01:00:0a:0b:0d")) == c);
+    EXPECT_TRUE(mgr.getClient(new TDUID("00:01:00:0a:0b:0e")) == 0);
+
+    EXPECT_TRUE(mgr.delClient(duid));
+    EXPECT_TRUE(mgr.getClient(duid) == b);
+    EXPECT_TRUE(mgr.delClient(duid));
+    EXPECT_TRUE(mgr.getClient(duid) == 0);
+    EXPECT_FALSE(mgr.delClient(duid));
+    EXPECT_TRUE(mgr.getClient(new TDUID("00:01:00:0a:0b:0d")) == c);
+    EXPECT_EQ(1, mgr.countClient());
+}
+
+}
@@ -17,6 +17,7 @@
 #include "Logger.h"
 #include "Portable.h"
 #include "Logger.h"
+#include "ScriptExecutor.h"
 
 using namespace std;
 
@@ -24,7 +25,11 @@ TCfgMgr::TCfgMgr()
  :IsDone(false),
   DUIDType(DUID_TYPE_LLT), /* default DUID type: LLT */
   DdnsProto(DNSUPDATE_TCP),
-  _DDNSTimeout(DNSUPDATE_DEFAULT_TIMEOUT) // default is 1000 ms
+  _DDNSTimeout(DNSUPDATE_DEFAULT_TIMEOUT), // default is 1000 ms
+  ScriptConcurrency(SCRIPT_DEFAULT_CONCURRENCY),
+  ScriptQueueSize(SCRIPT_DEFAULT_QUEUE_SIZE),
+  ScriptTimeout(SCRIPT_DEFAULT_TIMEOUT),
+  ScriptBatch(SCRIPT_DEFAULT_BATCH)
 {
 
 }
@@ -32,6 +37,14 @@ TCfgMgr::TCfgMgr()
 TCfgMgr::~TCfgMgr() {
 }
 
+/// passes configured notify script limits to script executor
+void TCfgMgr::setupScriptExecutor() {
+    ScriptExecutor().setConcurrency(ScriptConcurrency);
+    ScriptExecutor().setQueueSize(ScriptQueueSize);
+    ScriptExecutor().setTimeout(ScriptTimeout);
+    ScriptExecutor().setBatch(ScriptBatch);
+}
+
 void TCfgMgr::setDDNSProtocol(DNSUpdateProtocol proto) {
     DdnsProto = proto;
 }
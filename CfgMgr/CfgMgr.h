@@ -51,6 +51,13 @@ class TCfgMgr
     void setDDNSTimeout(unsigned int timeout) { _DDNSTimeout = timeout; }
     unsigned int getDDNSTimeout() { return _DDNSTimeout; }
 
+    // notify scripts (see TScriptExecutor)
+    void setScriptConcurrency(int concurrency) { ScriptConcurrency = concurrency; }
+    void setScriptQueueSize(unsigned int size) { ScriptQueueSize = size; }
+    void setScriptTimeout(unsigned int timeout) { ScriptTimeout = timeout; }
+    void setScriptBatch(int batch) { ScriptBatch = batch; }
+    void setupScriptExecutor();
+
  protected:
     SPtr<TDUID> DUID;
     bool setDUID(const std::string duidFile, TIfaceMgr &ifaceMgr);
@@ -65,6 +72,11 @@ class TCfgMgr
     SPtr<TDUID> DUIDEnterpriseID;
     DNSUpdateProtocol DdnsProto;
     unsigned int _DDNSTimeout;
+
+    int ScriptConcurrency;
+    unsigned int ScriptQueueSize;
+    unsigned int ScriptTimeout;
+    int ScriptBatch;
  private:
     
 };
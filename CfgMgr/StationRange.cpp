@@ -168,6 +168,139 @@ void TStationRange::truncate(int minPrefix, int maxPrefix)
     AddrR->truncate(minPrefix, maxPrefix);
 }
 
+// 128-bit unsigned arithmetic for getSlice() (w[0] is the most significant word)
+static void u128Get(SPtr<TIPv6Addr> addr, unsigned int * w)
+{
+    const unsigned char * a = (const unsigned char *)addr->getAddr();
+    for (int i=0; i<4; i++)
+        w[i] = (a[4*i]<<24) | (a[4*i+1]<<16) | (a[4*i+2]<<8) | a[4*i+3];
+}
+
+static SPtr<TIPv6Addr> u128Addr(const unsigned int * w)
+{
+    char a[16];
+    for (int i=0; i<4; i++) {
+        a[4*i]   = (char)(w[i]>>24);
+        a[4*i+1] = (char)(w[i]>>16);
+        a[4*i+2] = (char)(w[i]>>8);
+        a[4*i+3] = (char)w[i];
+    }
+    return new TIPv6Addr(a);
+}
+
+static void u128Sub(const unsigned int * a, const unsigned int * b, unsigned int * res)
+{
+    unsigned long long borrow = 0;
+    for (int i=3; i>=0; i--) {
+        unsigned long long d = (unsigned long long)a[i] - b[i] - borrow;
+        res[i] = (unsigned int)d;
+        borrow = (d >> 32) ? 1 : 0;
+    }
+}
+
+static void u128Add(const unsigned int * a, const unsigned int * b, unsigned int * res)
+{
+    unsigned long long carry = 0;
+    for (int i=3; i>=0; i--) {
+        unsigned long long s = (unsigned long long)a[i] + b[i] + carry;
+        res[i] = (unsigned int)s;
+        carry = s >> 32;
+    }
+}
+
+static void u128Shift(unsigned int * w, int bits) // bits>0: left, bits<0: right
+{
+    unsigned int tmp[4];
+    int n = bits < 0 ? -bits : bits;
+    for (int i=0; i<4; i++) {
+        unsigned int v = 0;
+        for (int b=0; b<32; b++) {
+            int src = (i*32 + b) + (bits > 0 ? n : -n); // bit index from the top
+            if (src < 0 || src >= 128)
+                continue;
+            if (w[src/32] & (0x80000000U >> (src%32)))
+                v |= 0x80000000U >> b;
+        }
+        tmp[i] = v;
+    }
+    for (int i=0; i<4; i++)
+        w[i] = tmp[i];
+}
+
+static void u128MulSmall(const unsigned int * a, unsigned int m, unsigned int * res)
+{
+    unsigned long long carry = 0;
+    for (int i=3; i>=0; i--) {
+        unsigned long long p = (unsigned long long)a[i] * m + carry;
+        res[i] = (unsigned int)p;
+        carry = p >> 32;
+    }
+}
+
+static unsigned int u128DivSmall(unsigned int * w, unsigned int d)
+{
+    unsigned long long rem = 0;
+    for (int i=0; i<4; i++) {
+        unsigned long long cur = (rem << 32) | w[i];
+        w[i] = (unsigned int)(cur / d);
+        rem = cur % d;
+    }
+    return (unsigned int)rem;
+}
+
+/**
+ * returns part of the range, when the range is split into count parts of
+ * (almost) equal size
+ *
+ * @param index part number (0..count-1)
+ * @param count number of parts
+ * @param unitBits range is split on 2^unitBits boundaries (0 for addresses,
+ *                 128-prefix length for prefixes)
+ *
+ * @return slice or NULL if range is too small to have this part
+ */
+SPtr<TStationRange> TStationRange::getSlice(int index, int count, int unitBits)
+{
+    if (!isAddrRange || count < 1 || index < 0 || index >= count)
+        return 0;
+
+    unsigned int l[4], r[4], units[4], one[4] = {0, 0, 0, 1};
+    u128Get(AddrL, l);
+    u128Get(AddrR, r);
+    u128Sub(r, l, units);
+    u128Shift(units, -unitBits);
+    u128Add(units, one, units);
+
+    // part i starts at unit q*i + r*i/count
+    unsigned int q[4], start[4], end[4];
+    for (int i=0; i<4; i++)
+        q[i] = units[i];
+    unsigned int rem = u128DivSmall(q, count);
+
+    u128MulSmall(q, index, start);
+    unsigned int extra[4] = {0, 0, 0, (unsigned int)(((unsigned long long)rem*index)/count)};
+    u128Add(start, extra, start);
+
+    u128MulSmall(q, index+1, end);
+    extra[3] = (unsigned int)(((unsigned long long)rem*(index+1))/count);
+    u128Add(end, extra, end);
+
+    unsigned int size[4];
+    u128Sub(end, start, size);
+    if (!size[0] && !size[1] && !size[2] && !size[3])
+        return 0;
+
+    u128Sub(end, one, end);
+    u128Shift(start, unitBits);
+    u128Shift(end, unitBits);
+    u128Add(start, l, start);
+    u128Add(end, l, end);
+
+    SPtr<TStationRange> slice = new TStationRange(u128Addr(start), u128Addr(end));
+    slice->setPrefixLength(PrefixLength);
+    return slice;
+}
+
 std::ostream& operator<<(std::ostream& out, TStationRange& range)
 {
     if (range.isAddrRange) {
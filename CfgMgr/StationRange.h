@@ -40,6 +40,7 @@ class TStationRange
     int getPrefixLength();
     void setPrefixLength(int len);
     void truncate(int minPrefix, int maxPrefix);
+    SPtr<TStationRange> getSlice(int index, int count, int unitBits);
  private:
     bool isAddrRange;
     SPtr<TDUID> DUIDL;
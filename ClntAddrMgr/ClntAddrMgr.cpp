@@ -18,13 +18,14 @@ using namespace std;
 
 TClntAddrMgr * TClntAddrMgr::Instance = 0;
 
-void TClntAddrMgr::instanceCreate(SPtr<TDUID> clientDUID, bool useConfirm, const std::string& xmlFile, bool loadDB)
+void TClntAddrMgr::instanceCreate(SPtr<TDUID> clientDUID, bool useConfirm, const std::string& xmlFile, bool loadDB,
+                                  const std::string& binFile)
 {
   if (Instance) {
       Log(Crit) << "Attempt to create another instance of TClntAddrMgr!" << LogEnd;
       return;
   }
-  Instance = new TClntAddrMgr(clientDUID, useConfirm, xmlFile, loadDB);
+  Instance = new TClntAddrMgr(clientDUID, useConfirm, xmlFile, loadDB, binFile);
 }
 
 TClntAddrMgr& TClntAddrMgr::instance()
@@ -41,11 +42,16 @@ TClntAddrMgr& TClntAddrMgr::instance()
  * @param useConfirm should confirm be used or not?
  * @param xmlFile XML filename (AddrMgr dumps will be stored there)
  * @param loadDB should existing dump be loaded?
+ * @param binFile binary copy of the database (empty if not used)
  *
  */
-TClntAddrMgr::TClntAddrMgr(SPtr<TDUID> clientDUID, bool useConfirm, const std::string& xmlFile, bool loadDB)
-    :TAddrMgr(xmlFile, useConfirm)
+TClntAddrMgr::TClntAddrMgr(SPtr<TDUID> clientDUID, bool useConfirm, const std::string& xmlFile, bool loadDB,
+                           const std::string& binFile)
+    :TAddrMgr(xmlFile, useConfirm, binFile)
 {
+    if (!useConfirm)
+        Log(Debug) << "Skipping database loading." << LogEnd;
+
     // client may have been already loaded from client-AddrMgr.xml file
     firstClient();
     if (!getClient()) {
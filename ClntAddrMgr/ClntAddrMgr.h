@@ -25,12 +25,14 @@
 class TClntAddrMgr : public TAddrMgr
 {
  private:
-    TClntAddrMgr(SPtr<TDUID> clientDuid, bool useConfirm, const std::string& xmlFile, bool loadDB);
+    TClntAddrMgr(SPtr<TDUID> clientDuid, bool useConfirm, const std::string& xmlFile, bool loadDB,
+                 const std::string& binFile);
 
   public:
     static TClntAddrMgr& instance();
     static void instanceCreate(SPtr<TDUID> clientDUID, bool useConfirm, 
-                               const std::string& xmlFile, bool loadDB);
+                               const std::string& xmlFile, bool loadDB,
+                               const std::string& binFile = "");
 
     unsigned long getT1Timeout();
     unsigned long getT2Timeout();
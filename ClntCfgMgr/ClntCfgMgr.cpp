@@ -12,6 +12,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include "SmartPtr.h"
 #include "Portable.h"
@@ -49,7 +50,8 @@ void TClntCfgMgr::instanceCreate(const std::string cfgFile) {
 
 
 TClntCfgMgr::TClntCfgMgr(const std::string cfgFile)
-  :TCfgMgr()
+  :TCfgMgr(), DumpFile(CLNTCFGMGR_FILE), DumpInterval(CLIENT_DEFAULT_DUMP_INTERVAL),
+   BinaryLeaseDb(false)
 {
     ScriptName = DEFAULT_SCRIPT;
 
@@ -79,11 +81,10 @@ TClntCfgMgr::TClntCfgMgr(const std::string cfgFile)
 }
 
 void TClntCfgMgr::dump() {
-    // store ClntCfgMgr in file
-    std::ofstream xmlDump;
-    xmlDump.open(CLNTCFGMGR_FILE);
+    // store ClntCfgMgr in file (only if it has changed)
+    std::ostringstream xmlDump;
     xmlDump << *this;
-    xmlDump.close();
+    DumpFile.write(xmlDump.str());
 }
 
 bool TClntCfgMgr::parseConfigFile(const std::string& cfgFile)
@@ -662,7 +663,8 @@ SPtr<TClntCfgIface> TClntCfgMgr::checkInactiveIfaces()
     if (!InactiveLst.count())
             return 0;
 
-    ClntIfaceMgr().redetectIfaces();
+    if (!ClntIfaceMgr().ifaceEventsActive())
+        ClntIfaceMgr().redetectIfaces(); // no notifications, we need to poll
     SPtr<TClntCfgIface> x;
     SPtr<TIfaceIface> iface;
     InactiveLst.first();
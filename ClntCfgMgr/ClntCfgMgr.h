@@ -31,6 +31,8 @@ class ClntParser;
 #include "KeyList.h"
 #endif
 
+#include "StateFile.h"
+
 #define ClntCfgMgr() (TClntCfgMgr::instance())
 
 class TClntCfgMgr : public TCfgMgr
@@ -54,6 +56,10 @@ class TClntCfgMgr : public TCfgMgr
     void makeInactiveIface(int ifindex, bool inactive);
     int countIfaces();
     void dump();
+    void setDumpInterval(unsigned int interval) { DumpInterval = interval; }
+    unsigned int getDumpInterval() { return DumpInterval; }
+    void setBinaryLeaseDb(bool binary) { BinaryLeaseDb = binary; }
+    bool getBinaryLeaseDb() { return BinaryLeaseDb; }
 
     void setDownlinkPrefixIfaces(List(std::string)& ifaces);
     const std::vector<std::string>& getDownlinkPrefixIfaces() { return DownlinkPrefixIfaces_; }
@@ -113,6 +119,9 @@ private:
     List(TClntCfgIface) ClntCfgIfaceLst;
     List(TClntCfgIface) InactiveLst;
     std::string ScriptName;
+    TStateFile DumpFile;
+    unsigned int DumpInterval; // min. time between periodic state dumps (in secs)
+    bool BinaryLeaseDb; // keep binary copy of client-AddrMgr.xml and load it at startup
 
     bool AnonInfRequest;
     bool InsistMode;
@@ -346,8 +346,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 96
-#define YY_END_OF_BUFFER 97
+#define YY_NUM_RULES 102
+#define YY_END_OF_BUFFER 103
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -355,99 +355,107 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[831] =
+static yyconst flex_int16_t yy_accept[893] =
     {   0,
-        1,    1,    0,    0,    0,    0,   97,   95,    2,    1,
-        1,   95,   77,   95,   95,   94,   94,   95,   95,   95,
-       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
-       95,   95,   95,   95,   95,   81,   81,   96,    1,    1,
-        1,    0,   89,   77,    0,   89,   79,   78,   94,    0,
-        0,   93,    0,   86,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   10,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   51,   90,
-       90,   90,   90,   90,   90,   90,   90,   24,   25,   11,
-       90,   90,   90,   90,   90,   80,   78,   94,    0,    0,
-
-        0,   85,   91,   84,   84,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   94,    0,    0,    0,
-        0,   83,   83,    0,   84,    0,   84,   90,   90,   72,
-       90,   90,   90,   90,   90,   90,   90,    7,   90,   33,
-       12,   90,   90,   90,   90,   90,    9,    0,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   94,
-
-        0,   92,    0,    0,    0,   83,    0,   83,    0,   84,
-       84,   84,   84,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,    3,   90,   90,   90,
-       90,   90,   90,   90,    0,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-        0,    0,    0,    0,    0,   83,   83,   83,   83,    0,
-       84,   84,   84,    0,   84,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   28,   90,   90,   90,   90,   90,
-       34,   90,   90,   90,   90,   90,   90,   90,    0,    0,
-
-       90,   90,   90,   90,   26,   90,   52,   90,   90,   90,
-       90,   90,   90,   19,   90,   90,   90,   90,   90,    6,
-       90,   90,   90,   90,   90,    0,    0,    0,    0,   83,
-       83,   83,    0,   83,    0,    0,   84,   84,   84,   84,
-       90,    5,   90,   90,   90,   90,   90,   90,   90,   90,
-       56,   54,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,    0,    0,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   76,   42,   90,   90,   90,   90,
-       90,   90,   48,   90,   90,   90,   92,    0,    0,    0,
-        0,    0,   83,   83,   83,   83,    0,   84,   84,   84,
-
-        0,   84,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   55,   90,   90,   90,   90,   41,
-       90,   90,   15,   16,    0,    0,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   18,    0,    0,    0,    0,
-       83,   83,   83,    0,   83,   88,   84,   84,   84,   84,
-       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   53,   90,   90,   90,   90,   14,    0,    0,
-       90,   90,    4,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   13,   90,   30,   90,   90,    0,
-
-        0,    0,    0,   87,   83,   83,   83,   83,   84,   84,
-       84,    0,   84,   90,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   27,   90,   90,   90,   90,   17,    0,
-        0,   38,   37,   29,   90,   90,   90,   90,   90,   90,
-       90,   90,   32,   31,   90,   90,   90,   90,   92,    0,
-        0,   83,   83,   83,    0,   83,   84,   84,   84,   84,
-       75,   90,   90,   90,   90,   90,   90,   90,   63,   90,
-       90,   90,   90,   59,   40,   39,   90,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   57,    0,
-        0,    0,    0,   83,   83,   83,   83,   84,   84,   84,
-
-        0,   84,    8,   90,   90,   61,   90,   36,   90,   64,
-       90,   74,   90,   90,   90,   90,   90,   90,   46,   90,
-       90,   90,   71,   90,   90,    0,    0,    0,   83,   83,
-       83,    0,   83,   84,   84,   84,   84,   90,   90,   35,
-       90,   90,   90,   60,   90,   90,   90,   90,   90,   90,
-       90,   90,   90,   90,   92,    0,    0,    0,   83,   83,
-       83,   83,   84,   84,   84,    0,   84,   90,   90,   90,
-       90,   90,   90,   90,   90,   90,   90,   90,   43,   90,
-       90,   22,    0,    0,   82,   85,   83,   83,   83,    0,
-       83,   84,   84,   84,   84,   90,   90,   65,   90,   90,
-
-       90,   90,   90,   90,   90,   90,   23,   90,    0,    0,
-       82,    0,   83,   83,   83,   83,   83,   84,   84,   84,
-        0,   84,   90,   90,   66,   90,   90,   90,   90,   90,
-       45,   90,   90,   90,   90,   90,   92,   82,   85,   83,
-        0,   83,   83,   83,   83,   84,   84,   84,   90,   90,
-       90,   90,   90,   90,   90,   20,   90,   44,   50,   90,
-       90,    0,   82,   83,   83,   83,   83,   84,   84,   84,
-       90,   90,   67,   68,   69,   70,   90,   21,   47,   90,
-        0,   83,   83,    0,   83,   83,   84,   90,   62,   90,
-       90,   92,   83,   83,   84,   90,   90,   90,    0,   83,
-
-       83,    0,   58,   90,   49,   82,   83,   83,   73,   82,
-       83,   83,    0,    0,   83,   83,    0,   83,   83,    0,
-       92,   83,   83,    0,   83,   83,    0,   83,   83,    0
+        1,    1,    0,    0,    0,    0,  103,  101,    2,    1,
+        1,  101,   83,  101,  101,  100,  100,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,   87,   87,   87,  102,
+        1,    1,    1,    0,   95,   83,    0,   95,   85,   84,
+      100,    0,    0,   99,    0,   92,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   10,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   57,   96,   96,   96,   96,   96,   96,   96,   96,
+       28,   29,   11,   96,   96,   96,   96,   96,   86,    0,
+
+       84,  100,    0,    0,    0,   91,   97,   90,   90,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,  100,    0,    0,    0,    0,   89,   89,    0,
+       90,    0,   90,   96,   96,   78,   96,   96,   96,   96,
+       96,   96,   96,   96,    7,   96,   96,   37,   12,   96,
+       96,   96,   96,   96,    9,    0,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+
+       96,   96,   96,   96,   96,   96,   96,  100,    0,   98,
+        0,    0,    0,   89,    0,   89,    0,   90,   90,   90,
+       90,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,    3,   96,   96,   96,
+       96,   96,   96,   96,    0,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+        0,    0,    0,    0,    0,   89,   89,   89,   89,    0,
+       90,   90,   90,    0,   90,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   32,   96,   96,   96,   96,
+
+       96,   96,   38,   96,   96,   96,   96,   96,   96,   96,
+        0,    0,   96,   96,   96,   96,   30,   96,   58,   96,
+       96,   96,   96,   96,   96,   19,   96,   96,   96,   96,
+       96,    6,   96,   96,   96,   96,   96,    0,    0,    0,
+        0,   89,   89,   89,    0,   89,    0,    0,   90,   90,
+       90,   90,   96,    5,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   62,   60,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,    0,    0,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   82,   46,
+       96,   96,   96,   96,   96,   96,   96,   54,   96,   96,
+
+       96,   98,    0,    0,    0,    0,    0,   89,   89,   89,
+       89,    0,   90,   90,   90,    0,   90,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       61,   96,   96,   96,   96,   96,   45,   96,   96,   15,
+       16,    0,    0,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   18,    0,    0,    0,
+        0,   89,   89,   89,    0,   89,   94,   90,   90,   90,
+       90,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   59,   96,   96,   96,   96,   96,
+
+       14,    0,    0,   96,   96,    4,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   13,   96,   34,   96,   96,    0,    0,    0,    0,
+       93,   89,   89,   89,   89,   90,   90,   90,    0,   90,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   31,   96,   96,   96,   96,   96,   17,    0,    0,
+       42,   41,   33,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   36,   35,   96,   96,   96,
+       96,   98,    0,    0,   89,   89,   89,    0,   89,   90,
+       90,   90,   90,   81,   96,   96,   96,   96,   96,   96,
+
+       96,   96,   69,   96,   96,   96,   96,   96,   65,   44,
+       43,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   63,    0,    0,
+        0,    0,   89,   89,   89,   89,   90,   90,   90,    0,
+       90,    8,   96,   96,   67,   96,   96,   40,   96,   70,
+       96,   96,   80,   96,   96,   96,   96,   96,   96,   50,
+       96,   96,   96,   23,   96,   96,   96,   77,   96,   96,
+        0,    0,    0,   89,   89,   89,    0,   89,   90,   90,
+       90,   90,   96,   96,   96,   39,   96,   96,   96,   52,
+       66,   96,   96,   96,   96,   96,   96,   96,   96,   96,
+
+       96,   96,   96,   96,   98,    0,    0,    0,   89,   89,
+       89,   89,   90,   90,   90,    0,   90,   96,   96,   96,
+       96,   96,   96,   96,   96,   96,   96,   96,   96,   47,
+       96,   96,   96,   22,   96,   26,    0,    0,   88,   91,
+       89,   89,   89,    0,   89,   90,   90,   90,   90,   96,
+       96,   53,   71,   96,   96,   96,   96,   96,   96,   96,
+       96,   27,   96,   96,   96,    0,    0,   88,    0,   89,
+       89,   89,   89,   89,   90,   90,   90,    0,   90,   96,
+       96,   72,   96,   96,   96,   96,   96,   49,   96,   96,
+       96,   96,   96,   96,   96,   98,   88,   91,   89,    0,
+
+       89,   89,   89,   89,   90,   90,   90,   96,   96,   96,
+       96,   96,   96,   96,   24,   96,   48,   56,   96,   96,
+       21,   96,    0,   88,   89,   89,   89,   89,   90,   90,
+       90,   96,   96,   73,   74,   75,   76,   96,   25,   51,
+       20,   96,    0,   89,   89,    0,   89,   89,   90,   96,
+       68,   96,   96,   98,   89,   89,   90,   96,   96,   96,
+        0,   89,   89,    0,   64,   96,   55,   88,   89,   89,
+       79,   88,   89,   89,    0,    0,   89,   89,    0,   89,
+       89,    0,   98,   89,   89,    0,   89,   89,    0,   89,
+       89,    0
+
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -484,673 +492,891 @@ static yyconst flex_int32_t yy_ec[256] =
 
 static yyconst flex_int32_t yy_meta[75] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    4,    3,    3,    3,    3,    3,    3,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    3,    3,
-        3,    3,    3,    3,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[916] =
+static yyconst flex_int16_t yy_base[893] =
     {   0,
-        0,    0, 1542, 1541,    0,    0, 1548, 3942, 3942,   72,
-       74, 1542,    0, 1539,   71,   71,   34, 1514,  134,  183,
-      227,  187,  239,  296,   77,   71,  194,   43,  188,  197,
-      300,  313,   67,   87,   67, 3942, 1506, 3942,  108,  112,
-      115, 1501, 3942,    0, 1492, 1491, 3942,    0,  358, 1475,
-      376, 3942,    0,  402,    0,  444,   83,  170,    0,  179,
-      176,  185,  193,  220,  231,  237,  231,  245,  241,  250,
-      320,  246,  248,  245,  288, 1486,  292,  292,    0,  310,
-      300,  448,  297,  301,  360,  374,  452,    0,    0,    0,
-      371,  382,  416,  441,  438, 3942,    0,  506, 1466,  427,
-
-     1369,  550,    0,  594,  524,  636,  439,  441,  446,  454,
-      444,  459, 1380,  465,  453,  464,  464,  510,  527,  529,
-      536,  566,  571, 1379,  579,  123,  614, 1378,  609,  613,
-      611,  632,  643,  634,  629,  631,  643, 1377,  637,  634,
-      646,  651,  654,  649,  655,  649,  696,  575, 1355, 1325,
-     1317,  742,  714,  723,  786,  828,  760,  870,  762,    0,
-      743, 1328, 1327,  757,  790,  801,  799, 1326,  794, 1325,
-        0,  823,  824,  832,  832,  876,    0, 1324,  876,  866,
-      863,  868,  882,  880,  871,  883,  872,  888,  885,  880,
-      919, 1322,  898,  921, 1321,  903,  921,  911, 1284,  948,
-
-     1271, 1270, 1269, 1268,  974,  985, 1027, 1003, 1045, 1071,
-     1089, 1115, 1133, 1267,  911,  909,  918,  931,  917,  914,
-     1004, 1013, 1070, 1128, 1088, 1115,    0, 1126, 1116, 1128,
-     1123, 1134, 1126, 1148, 1149, 1135, 1146, 1138, 1149, 1141,
-     1138, 1133, 1278, 1152, 1149, 1165, 1152, 1158, 1153, 1170,
-     1181, 1184, 1176, 1169, 1183, 1165, 1173, 1277, 1175, 1196,
-     1237, 1224, 1223, 1222, 1236, 1247, 1265, 1291, 1309, 1210,
-     1335, 1221, 1347, 1389, 1365, 1254, 1254, 1296, 1367, 1357,
-     1354, 1364, 1232, 1371,    0, 1386, 1387, 1390, 1378, 1391,
-        0, 1383, 1222, 1393, 1395, 1386, 1405, 1397, 1396, 1407,
-
-     1400, 1396, 1416, 1405,    0, 1436, 1108, 1421, 1416, 1107,
-     1106, 1422, 1436,    0, 1431, 1427, 1431, 1442, 1105,    0,
-     1437, 1433, 1443, 1104, 1447, 1091, 1090, 1089, 1466, 1494,
-     1061, 1506, 1548, 1524, 1566, 1592, 1603, 1621, 1647, 1665,
-     1512, 1064, 1527, 1564, 1610, 1614, 1652, 1672, 1644, 1656,
-        0, 1648, 1653, 1665, 1666, 1659, 1668, 1666, 1677, 1678,
-     1679, 1672, 1669, 1688, 1668, 1691, 1679, 1698, 1698, 1700,
-     1690, 1710, 1699, 1718,    0,    0, 1719, 1699, 1708, 1704,
-     1706, 1711,    0, 1723, 1714, 1716, 1051, 1050, 1049, 1048,
-     1772, 1783, 1794, 1812, 1838, 1856, 1821, 1882, 1047, 1894,
-
-     1936, 1912, 1735, 1790, 1827, 1853, 1915, 1898, 1914, 1907,
-     1921, 1935, 1943, 1058,    0, 1944, 1936, 1057, 1936,    0,
-     1934, 1941,    0,    0, 1953, 1933, 1947, 1952, 1951, 1954,
-     1023, 1956, 1956, 1956, 1949, 1966, 1951, 1979, 1984, 1984,
-     1972, 1986, 1988, 1988, 1983,    0, 1010, 1008, 1007, 2009,
-     2035, 1006, 2047, 2089, 2065, 2074, 2133, 2107, 2177, 2151,
-     1998, 2080, 1017, 2081, 2129, 2143, 2144, 2185, 2173, 2187,
-     2171, 2174,    0, 2171, 2179, 2189, 2175,    0, 2186, 2191,
-     2183, 2180,    0, 2181, 2191, 1016, 2188, 2188, 2184, 2193,
-     2210, 2217, 2214, 2224,    0, 2231,    0, 2230, 2233, 1003,
-
-      993,  975,  956, 2248, 2276, 2294, 2320, 2338, 2364,  955,
-     2376, 2418, 2394, 2265, 2283, 2331, 2379, 2395, 2398, 2381,
-     2415, 2424, 2421,    0, 2413, 2431, 2418, 2429,    0, 2421,
-     2418,    0,    0,    0, 2428, 2433, 2453, 2435, 2432, 2437,
-     2421, 2436,    0,    0, 2434,  865, 2433, 2451,  850,  849,
-      848, 2508,  847, 2520, 2562, 2538, 2606, 2580, 2650, 2624,
-        0, 2450, 2470,  858, 2540, 2547, 2594,  857,    0, 2617,
-     2627, 2647, 2656,    0, 3942, 3942, 2655, 2644, 2654, 2659,
-     2658, 2646,  855, 2662, 2665, 2656, 2656, 2662,    0,  842,
-      841,  840,  839, 2709, 2727, 2753, 2771, 2797,  808, 2809,
-
-     2851, 2827,    0, 2667, 2704,    0, 2723,    0, 2845,    0,
-     2767,    0, 2828, 2829, 2813, 2845, 2844, 2862,    0, 2864,
-     2848, 2852,    0, 2853, 2856,  807,  806,  805, 2907,  804,
-     2919, 2961, 2937, 3005, 2979, 3049, 3023,  815, 2866,    0,
-     2939, 2953, 3004,    0, 3010, 3026, 3053, 3037, 3040, 3058,
-     3043, 3049,  813, 3059,  800,  799,  798,  797, 3102, 3076,
-     3146, 3120, 3164,  796, 3190, 3232, 3208, 3048, 3090,  799,
-     3127, 3148, 3204, 3196, 3195, 3211, 3223, 3240,    0, 3238,
-     3227,    0,  766,  765,  764,    0, 3257,  763, 3283, 3325,
-     3301, 3369, 3343, 3413, 3387, 3242, 3257,    0,  385,  774,
-
-     3294, 3306, 3368, 3376, 3380, 3417,    0, 3408,  761,  760,
-      732,  729,  672, 3461, 3435, 3505, 3479, 3523,  671, 3549,
-        0, 3567, 3408, 3454,    0,  123,  671,  677, 3470, 3482,
-        0, 3518, 3548, 3554, 3553, 3549,  662,  661, 3942,  616,
-        0, 3608,  615, 3620, 3593, 3664, 3638,    0, 3551, 3616,
-      619,  616,  617,  618, 3622,    0, 3640,    0,    0, 3652,
-     3653,  609,  608,  607,  606, 3711, 3685, 3729,  605,    0,
-     3670, 3666,    0,    0,    0,    0, 3718,    0,    0, 3721,
-      604,  603,  564,    0, 3755, 3942,    0, 3712,    0, 3729,
-     3719,  563,  562,  561, 3942, 3714, 3730, 3729,  560,  559,
-
-      530,    0,    0, 3718,    0,  529,  528,  527,    0,  526,
-      525,  480,    0,  427,  416,  415,    0,  414,  413,    0,
-      412,  411,  382,  380,  332,  331,    0,  313,  285, 3942,
-     3785, 3789, 3793, 3797, 3801, 3805, 3807,  302, 3809, 3811,
-     3813, 3815, 3817, 3819, 3821, 3823, 3825, 3827, 3829, 3831,
-     3833, 3835, 3837, 3839, 3841, 3843, 3845, 3847, 3849, 3851,
-     3853, 3855, 3857, 3859, 3861, 3863, 3865, 3867, 3869, 3871,
-     3873, 3875, 3877, 3879,  285, 3881, 3883, 3885,  283, 3887,
-     3889, 3891,  282,  280, 3893, 3895, 3897,  229, 3899, 3901,
-      226,  224, 3903, 3905, 3907, 3909, 3911,  207, 3913, 3915,
-
-     3917, 3919, 3921,  143, 3923, 3925, 3927,  139, 3929,  134,
-     3931, 3933, 3935,   79, 3937
+        0,    0,   74,    0,  148,    0,  223, 5957, 5957,  221,
+      223,  226,  300,  374,  441,  441,  404,  281,  491,  540,
+      420,  541,  406,  431,  598,  546,  542,  604,  434,  603,
+      607,  632,  661,  437,  609,  437, 5957, 5957,  463, 5957,
+        0,    0,    0,    0, 5957,    0,    0,  472, 5957,  715,
+      777,  793,  688, 5957,  835,  851,    0,  893,  544,  533,
+        0,  543,  539,  597,  602,  611,  601,  887,  892,  607,
+      647,  654,  663,  910,  659,  659,  822,  832,  470,  860,
+      884,    0,  901,  891,  925,  887,  895,  898,  906,  942,
+        0,    0,    0,  905,  910,  934,  933,  930, 5957,    0,
+
+        0,  986, 1002,  819, 1044, 1060,    0, 1104, 1122, 1146,
+      931,  932,  988, 1052, 1067, 1108, 1123,  471, 1128, 1116,
+     1142, 1141, 1153, 1145, 1156, 1158, 1159, 1154, 1159,  472,
+     1160,  474, 1163,  475, 1158, 1162, 1160, 1155, 1166, 1164,
+     1159, 1161, 1173,  476, 1182, 1179, 1191, 1196, 1199, 1194,
+     1200, 1198, 1245, 1028, 1261, 1303, 1319, 1363, 1221, 1086,
+     1379, 1421, 1439, 1463, 1298,    0, 1220,  478, 1243,  479,
+     1300, 1308, 1370, 1391,  493,  575, 1403,  576,    0, 1439,
+     1425, 1427, 1443, 1470,    0,  577, 1477, 1459, 1456, 1461,
+     1506, 1473, 1464, 1476, 1460, 1481, 1478, 1472, 1512,  578,
+
+     1492, 1514,  579, 1497, 1514, 1504,  580,  569,  609,  615,
+     1567, 1583, 1345, 1625, 1641, 1685,  628, 1694, 1712, 1736,
+     1754,  655, 1504, 1502, 1512, 1525, 1502, 1738, 1509, 1562,
+     1611, 1632, 1750, 1640, 1685, 1699,    0, 1747, 1737, 1750,
+     1745, 1756, 1754, 1770, 1770, 1757, 1768, 1761, 1771, 1763,
+     1760, 1755,  668, 1784, 1771, 1787, 1774, 1780, 1786, 1792,
+     1803, 1806, 1798, 1791, 1805, 1787, 1795,  669, 1803, 1818,
+     1858,  658, 1874, 1916,  670, 1932, 1976, 1985, 2003, 1609,
+     2029,  660, 2039, 2055, 2099, 1857, 1855, 1901, 1929, 1926,
+      680, 1975, 2030,  683, 2037,    0, 2049, 2059, 2062, 2050,
+
+     2062, 2064,    0, 2056,  684, 2066, 2068, 2085, 2104, 2096,
+     2095, 2106, 2099, 2095, 2108, 2097,    0, 2111,  685, 2114,
+     2109,  686,  687, 2099, 2113,  688, 2108, 2104, 2108, 2119,
+      705,    0, 2110, 2106, 2115,  812, 2119, 2165, 2181, 2223,
+     1667, 2241,  801, 2265, 2281, 2325,  813,  803, 2334, 2352,
+     2376, 2394, 2147,  831, 2160, 2202, 2264, 2269, 2274, 2321,
+     2386, 2336, 2384,    0, 2376, 2381, 2378, 2394, 2396, 2396,
+     2405, 2396, 2407, 2408, 2409, 2402, 2398, 2416, 2396, 2410,
+     2407, 2426, 2426, 2428, 2418, 2427, 2427, 2446,    0,    0,
+     2446, 2449, 2429, 2438, 2434, 2436, 2447,    0, 2453, 2445,
+
+     2447,  858,  859, 2502, 2518,  871,  868, 2560, 2578, 2602,
+     2620, 1832,  869,  870, 2644, 2660, 2704, 2501, 2506, 2523,
+     2555, 2582, 2639, 2640, 2663, 2665, 2664, 2668, 2676,  883,
+        0, 2677, 2678, 2670,  884, 2670,    0, 2694, 2701,    0,
+        0, 2713, 2693, 2707, 2712, 2711, 2714,  885, 2716, 2716,
+     2709, 2702, 2719, 2704, 2725, 2712, 2707, 2720, 2721, 2726,
+     2726, 2714, 2728, 2730, 2730, 2721,    0, 2773, 2789, 2831,
+     1900,  874,  875, 2847, 2889, 2907,    0, 2931, 2949, 2973,
+     2991, 2760, 2780,  915, 2831, 2859, 2888, 2898, 2916, 2954,
+     2977, 2991, 2975, 2978,    0, 2977, 2976, 2984, 2994, 2980,
+
+        0, 2997, 3002, 2994, 2991,    0, 2992, 3018,  921, 3000,
+     3000, 2996, 2997, 2996, 3006, 3013, 3023, 3016, 3017, 3025,
+     3035,    0, 3042,    0, 3041, 3042, 3083,  912, 3099, 3141,
+        0, 3157, 3201, 3210, 3228,  916,  917, 3252, 3268, 3312,
+     3064, 3080, 3132, 3137, 3160, 3233, 3265, 3255, 3283, 3282,
+     3279,    0, 3271, 3268, 3290, 3277, 3288,    0, 3306, 3303,
+        0,    0,    0, 3313, 3318, 3312, 3320, 3317, 3322, 3306,
+     3314, 3327, 3329, 3312, 3329,    0,    0, 3317,  963, 3316,
+     3334,  952, 3373, 3389,  953,  956, 3431, 3447, 3491, 3500,
+     3518, 3542, 3560,    0, 3353, 3417,  969, 3443, 3450, 3485,
+
+     3504,  970,    0, 3546, 3556, 3561, 3551, 3560,    0, 5957,
+     5957, 3559, 3548, 3558, 3563, 3568, 3556,  971, 3572, 3575,
+     3571, 3559, 3576, 3567, 3570, 3570, 3576,    0, 3621,  962,
+     3637, 3679, 3695, 3739, 3748, 3766,  963,  965, 3790, 3806,
+     3850,    0, 3589, 3624,    0,  978, 3667,    0, 3811,    0,
+     3689, 3691,    0, 3785, 3801, 3792, 3819, 3808, 3826,    0,
+     3827, 3811, 3816,    0, 3840,  979, 3838,    0, 3845, 3848,
+     3871, 3913, 3929,  970,  971, 3971, 3987, 4031, 4040, 4058,
+     4082, 4100, 1021, 3866, 3909,    0, 3967, 3979, 3986,    0,
+        0, 4020, 4059, 4095, 4079, 4082, 4100, 4085, 4091, 4088,
+
+     4088, 4088, 1022, 4110, 1011, 1012, 4151, 4167, 4209, 4227,
+     4251, 4269, 1067, 1069, 4293, 4309, 4353, 4107, 4171, 4207,
+     1074, 4232, 4269, 4300, 4299, 4307, 4323, 4320, 4327,    0,
+     4325, 4327, 4324,    0, 4316,    0, 4370, 4386, 4428, 4444,
+     1112, 1122, 4486, 4502, 4546, 4555, 4573, 4597, 4615, 4365,
+     4378,    0,    0, 1286, 1135, 4431, 4467, 4493, 4492, 4540,
+     4574,    0, 4601, 4590, 4602, 4653, 1124, 4669, 1125, 4711,
+     4727, 4641, 4769, 4787, 1126, 1211, 4811, 4827, 4871, 4636,
+     4654,    0, 1238, 1222, 1230, 4718, 4746,    0, 4756, 4792,
+     4813, 4819, 4842, 4841, 4826, 1223, 4883, 5957, 4899, 4941,
+
+     1232, 1233, 4957, 5001, 5010, 5028, 5052, 4862, 4895, 1273,
+     1272, 1275, 1288, 4935,    0, 4952,    0,    0, 4945, 4985,
+        0, 5013, 5069, 1283, 5111, 5127, 5169, 5096, 1284, 1285,
+     5185, 5047, 5092,    0,    0,    0,    0, 5168,    0,    0,
+        0, 5176, 5227, 1326, 5243, 5285, 1328, 5957, 5301, 5208,
+        0, 5240, 5271, 1386, 5343, 5359, 5957, 5281, 5338, 5359,
+     5402, 1387, 5418, 5460,    0, 5357,    0, 5476, 5518, 5534,
+        0, 1388, 1389, 5576, 5592, 5634, 5650, 5692, 5708, 1396,
+     5750, 5766, 1397, 5808, 5824, 1398, 1399, 5866, 1958, 5882,
+     1400, 5957
+
     } ;
 
-static yyconst flex_int16_t yy_def[916] =
+static yyconst flex_int16_t yy_def[893] =
     {   0,
-      830,    1,  831,  831,  832,  832,  830,  830,  830,  830,
-      830,  833,  834,  835,  830,  830,   16,  830,  830,   19,
-       19,   19,   19,   19,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,  830,  830,  830,  830,  830,
-      830,  833,  830,  834,  835,  830,  830,  836,  830,  837,
-       49,  830,  838,  830,   24,   24,   56,   56,   24,   24,
-       24,   56,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,  830,  836,  830,  839,   98,
-
-      840,  830,  838,  830,  104,   56,  106,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,  830,  147,  841,  842,
-      843,  830,  152,  830,  830,  830,  155,  106,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,  830,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,  148,
-
-      148,  842,  844,  845,  830,  830,  830,  206,  830,  830,
-      210,  830,  212,  158,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,  830,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-      846,  830,  847,  848,  830,  830,  266,  830,  268,  830,
-      830,  830,  830,  830,  273,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,  830,  830,
-
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,  849,  850,  851,  830,  830,
-      830,  830,  830,  332,  830,  830,  830,  337,  830,  339,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,  830,  830,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,  847,  830,  852,  853,
-      830,  830,  830,  393,  830,  395,  830,  830,  830,  830,
-
-      830,  400,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,  830,  830,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,  854,  855,  856,  830,
-      830,  830,  830,  830,  453,  830,  830,  457,  830,  459,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,  830,  830,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,  857,
-
-      830,  858,  859,  830,  830,  505,  830,  507,  830,  830,
-      830,  830,  511,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,  830,
-      830,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,  860,  861,
-      862,  830,  830,  830,  830,  554,  830,  557,  830,  559,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,  830,  830,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,  863,
-      830,  864,  865,  830,  594,  830,  596,  830,  830,  830,
-
-      830,  600,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,  866,  867,  868,  830,  830,
-      830,  830,  631,  830,  634,  830,  636,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,  869,  830,  870,  871,  830,  659,
-      830,  661,  830,  830,  830,  830,  665,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,  872,  873,  874,  875,  830,  830,  830,  830,
-      689,  830,  692,  830,  694,   24,   24,   24,   24,   24,
-
-       24,   24,   24,   24,   24,   24,   24,   24,  876,  830,
-      877,  830,  878,  830,  714,  830,  716,  830,  830,  830,
-      879,  720,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   24,   24,  880,  881,  830,  882,
-      883,  830,  830,  830,  744,  830,  746,  884,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,  885,  830,  886,  887,  830,  766,  830,  830,  888,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-      889,  830,  890,  891,  830,  830,  892,   24,   24,   24,
-       24,  893,  894,  895,  830,   24,   24,   24,  896,  830,
-
-      897,  898,   24,   24,   24,  899,  900,  901,   24,  902,
-      830,  903,  904,  905,  906,  907,  908,  830,  909,  910,
-      830,  911,  912,  905,  830,  913,  914,  915,  830,    0,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830
+      892,    1,  892,    3,  892,    5,  892,  892,  892,  892,
+       10,  892,  892,  892,  892,  892,   16,  892,   16,   19,
+       20,   20,   21,   21,   21,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,  892,  892,  892,  892,
+       10,   11,   10,   12,  892,   13,   14,  892,  892,  892,
+       17,  892,   51,  892,  892,  892,   25,   21,   58,   58,
+       25,   25,   25,   25,   58,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,  892,   14,
+
+       50,   17,   52,  102,  892,  892,   55,  892,  108,   21,
+      110,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   17,  153,  105,  105,   52,  892,  158,  892,
+      108,  892,  161,   21,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,  892,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,  153,  154,  156,
+      105,  892,  892,  158,  892,  214,  160,  108,  218,  108,
+      220,  164,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,  892,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       52,  892,  212,   52,  213,  158,  276,  158,  278,  892,
+      892,  892,  220,  892,  283,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+      892,  892,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,  212,  212,  892,
+      892,  892,  892,  278,  892,  344,  280,  281,  220,  349,
+      108,  351,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,  892,  892,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+
+       25,  273,  892,  340,   52,  341,  342,  278,  408,  158,
+      410,  892,  281,  892,  351,  892,  415,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   57,   34,   57,   36,   57,   57,   57,   57,
+       57,  892,  892,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   61,   61,
+       61,   61,   75,   82,   75,   70,   82,  103,  340,  892,
+      892,  342,  892,  410,  892,  474,  412,  351,  478,  108,
+      480,   82,   82,   91,   84,   91,   91,   91,   91,   91,
+       91,   91,   92,   93,  166,   98,  142,  166,  121,  116,
+
+      166,  892,  892,  113,  112,  166,  112,  116,  118,  166,
+      166,  112,  166,  142,  142,  120,  117,  166,  120,  166,
+      128,  166,  126,  166,  129,  129,  340,  892,  470,  157,
+      471,  410,  532,  158,  534,  281,  892,  480,  892,  538,
+      166,  166,  143,  146,  148,  166,  149,  166,  149,  166,
+      166,  166,  166,  166,  166,  166,  166,  166,  892,  892,
+      166,  166,  166,  166,  166,  166,  179,  173,  179,  179,
+      179,  179,  179,  179,  179,  179,  179,  179,  179,  181,
+      185,  404,  470,  892,  342,  892,  534,  892,  587,  480,
+      590,  218,  592,  237,  195,  231,  200,  205,  201,  206,
+
+      229,  203,  237,  231,  230,  237,  237,  237,  237,  892,
+      892,  237,  237,  232,  230,  237,  229,  237,  230,  237,
+      237,  237,  230,  237,  225,  231,  232,  237,  271,  892,
+      584,  271,  534,  633,  276,  635,  281,  892,  592,  892,
+      639,  296,  254,  296,  296,  253,  263,  296,  257,  296,
+      254,  263,  296,  256,  256,  296,  296,  269,  286,  296,
+      286,  269,  288,  296,  269,  268,  296,  296,  288,  296,
+      470,  584,  892,  342,  892,  635,  892,  676,  592,  679,
+      281,  681,  291,  296,  296,  296,  296,  296,  293,  296,
+      296,  296,  296,  296,  296,  296,  296,  296,  297,  303,
+
+      303,  303,  303,  303,  529,  892,  673,  892,  635,  709,
+      342,  711,  348,  892,  681,  892,  715,  316,  317,  332,
+      332,  332,  332,  332,  328,  324,  330,  332,  332,  332,
+      332,  330,  332,  332,  353,  364,  405,  673,  892,  892,
+      342,  892,  711,  892,  743,  681,  746,  348,  748,  364,
+      364,  364,  364,  364,  354,  360,  364,  364,  364,  359,
+      364,  364,  364,  364,  364,  584,  892,  739,  892,  892,
+      711,  771,  407,  773,  413,  892,  748,  892,  777,  389,
+      385,  389,  389,  389,  389,  389,  389,  389,  389,  389,
+      389,  390,  398,  398,  398,  631,  739,  892,  770,  892,
+
+      407,  892,  407,  803,  748,  805,  892,  431,  431,  431,
+      431,  431,  431,  431,  431,  421,  431,  431,  424,  431,
+      431,  424,  468,  892,  770,  892,  773,  827,  536,  892,
+      892,  429,  431,  431,  437,  437,  437,  437,  437,  437,
+      440,  440,  673,  892,  826,  892,  472,  892,  892,  462,
+      467,  467,  467,  707,  826,  892,  892,  467,  460,  467,
+      708,  892,  856,  892,  467,  462,  467,  739,  856,  892,
+      467,  768,  892,  870,  892,  769,  870,  892,  892,  892,
+      878,  892,  892,  878,  892,  876,  892,  885,  744,  885,
+      892,    0
+
     } ;
 
-static yyconst flex_int16_t yy_nxt[4017] =
+static yyconst flex_int16_t yy_nxt[6032] =
     {   0,
         8,    9,   10,   11,   12,   13,   14,    8,    8,    8,
         8,   15,   16,   17,   17,   17,   17,   17,   17,   17,
-       17,   18,   19,   20,   20,   21,   22,   23,   24,   24,
-       25,   24,   24,   26,   24,   27,   28,   29,   24,   30,
-       31,   32,   33,   34,   35,   24,   24,   24,   19,   20,
-       20,   21,   22,   23,   24,   24,   25,   24,   24,   26,
-       24,   27,   28,   29,   24,   30,   31,   32,   33,   34,
-       35,   24,   24,   24,   39,   40,   41,   40,   47,  830,
-       78,  717,   48,   49,   49,   49,   49,   49,   49,   49,
-       49,   49,   50,   51,   51,   51,   51,   51,   51,   69,
-
-       52,   72,   92,   95,   70,  830,   78,   73,  107,   93,
-       39,   40,   71,   94,   41,   40,   53,   39,   40,   51,
-       51,   51,   51,   51,   51,   69,   52,   72,   92,   95,
-       70,  178,  179,   73,  107,   93,  823,  751,   71,   94,
-      752,  821,   53,   55,   55,  816,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   50,   56,   56,   56,   57,
-       56,   58,   55,   59,   55,   55,   55,   55,   55,   60,
-       55,   55,   55,   55,   55,   55,   61,   55,   55,   55,
-       55,   55,   56,   56,   56,   57,   56,   58,   55,   59,
-       55,   55,   55,   55,   55,   60,   55,   55,   55,   55,
-
-       55,   55,   61,   55,   55,   55,   55,   55,   56,  808,
-       56,  108,   56,   79,   56,  109,   74,  110,   55,   81,
-      111,  112,   55,   82,   75,   55,  795,   80,  794,   55,
-       76,  787,   67,   83,   56,   77,   56,  108,   56,   79,
-       56,  109,   74,  110,   55,   81,  111,  112,   55,   82,
-       75,   55,   62,   80,   56,   55,   76,   63,   67,   83,
-      113,   77,   64,   65,   56,  114,   56,  116,  117,   66,
-      118,  119,  120,  123,   55,  115,  124,   68,   62,  125,
-       56,   55,  770,   63,  765,  748,  113,  713,   64,   65,
-       56,  114,   56,  116,  117,   66,  118,  119,  120,  123,
-
-       55,  115,  124,   68,  103,  125,  827,   55,   55,   55,
-       55,   55,   55,   55,   55,   55,   55,  830,   55,   55,
-       55,   55,   55,   55,   84,   55,   88,   89,  126,  128,
-       85,   55,   86,  129,  827,   90,  130,  131,   55,  136,
-      137,   87,  121,   91,   55,   55,   55,   55,   55,   55,
-       84,   55,  827,  820,  126,  128,   85,   55,   86,  129,
-      122,   90,  130,  131,   55,  136,  137,   87,  121,   91,
-       98,   98,   98,   98,   98,   98,   98,   98,   98,   99,
-      100,  100,  100,  100,  100,  100,  122,   52,  100,  100,
-      100,  100,  100,  100,  100,  100,  100,  138,  725,  726,
-
-      727,  830,  728,  827,  139,  142,  100,  100,  100,  100,
-      100,  100,  143,   52,  104,  104,  104,  104,  104,  104,
-      104,  104,  104,  138,  105,  105,  105,  105,  105,  105,
-      139,  142,  820,  824,  820,  813,  820,  813,  143,  148,
-      148,  148,  148,  148,  148,  148,  148,  148,  739,  144,
-      105,  105,  105,  105,  105,  105,  106,  106,  106,  106,
-      106,  106,  106,  106,  106,   99,  106,  106,  106,  106,
-      106,  106,  132,   59,  140,  144,  145,  146,  159,  133,
-      160,  161,  134,  162,  163,  164,  135,  166,  167,  168,
-      169,  141,  106,  106,  106,  106,  106,  106,  132,   59,
-
-      140,  813,  145,  146,  159,  133,  160,  161,  134,  162,
-      163,  164,  135,  166,  167,  168,  169,  141,  147,  147,
-      147,  147,  147,  147,  147,  147,  147,   50,  148,  148,
-      148,  148,  148,  148,  830,   52,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  170,  802,  814,  813,  802,
-      712,  802,  171,  172,  148,  148,  148,  148,  148,  148,
-      173,   52,  152,  152,  152,  152,  152,  152,  152,  152,
-      152,  170,  153,  153,  153,  153,  153,  153,  171,  172,
-      784,  686,  802,  784,  799,  784,  173,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  174,  175,  153,  153,
-
-      153,  153,  153,  153,  154,  177,  155,  155,  155,  155,
-      155,  155,  155,  155,  155,  156,  157,  157,  157,  157,
-      157,  157,  174,  175,  741,  658,  721,  784,  741,  712,
-      102,  177,  776,  775,  774,  773,  690,  741,  180,  182,
-      183,  184,  157,  157,  157,  157,  157,  157,  158,  158,
-      158,  158,  158,  158,  158,  158,  158,   50,  158,  158,
-      158,  158,  158,  158,  180,  182,  183,  184,  185,  186,
-      187,  188,  189,  190,  192,  193,  194,  195,  196,  197,
-      198,  199,  712,  762,  158,  158,  158,  158,  158,  158,
-      754,  753,  666,  741,  185,  186,  187,  188,  189,  190,
-
-      192,  193,  194,  195,  196,  197,  198,  199,  200,  200,
-      200,  200,  200,  200,  200,  200,  200,   50,  201,  201,
-      201,  201,  201,  201,  830,   52,  208,  208,  208,  208,
-      208,  208,  208,  208,  208,  209,  209,  209,  209,  209,
-      209,  209,  209,  209,  201,  201,  201,  201,  201,  201,
-      739,   52,  205,  712,  206,  206,  206,  206,  206,  206,
-      206,  206,  206,  207,  208,  208,  208,  208,  208,  208,
-      830,  215,  211,  211,  211,  211,  211,  211,  211,  211,
-      211,  658,  593,  729,  632,  712,  658,  102,  216,  217,
-      208,  208,  208,  208,  208,  208,  154,  220,  210,  210,
-
-      210,  210,  210,  210,  210,  210,  210,  156,  211,  211,
-      211,  211,  211,  211,  216,  217,  698,  601,  686,  658,
-      593,  683,  681,  220,  668,  555,  658,  593,  503,  512,
-      221,  222,  223,  225,  211,  211,  211,  211,  211,  211,
-      212,  212,  212,  212,  212,  212,  212,  212,  212,  227,
-      213,  213,  213,  213,  213,  213,  221,  222,  223,  225,
-      102,  593,  503,  102,  620,  228,  609,  605,  454,  593,
-      503,  590,  229,  230,  587,  227,  213,  213,  213,  213,
-      213,  213,  214,  214,  214,  214,  214,  214,  214,  214,
-      214,  228,  214,  214,  214,  214,  214,  214,  229,  230,
-
-      231,  236,  238,  239,  240,  243,  244,  245,  241,  232,
-      233,  234,  242,  246,  247,  248,  237,  249,  214,  214,
-      214,  214,  214,  214,  253,  257,  231,  236,  238,  239,
-      240,  243,  244,  245,  241,  232,  233,  234,  242,  246,
-      247,  248,  237,  249,  250,  254,  258,  259,  276,  277,
-      253,  257,  278,  279,  281,  283,  255,  280,  282,  251,
-      200,  200,  200,  200,  200,  200,  200,  200,  200,  830,
-      250,  254,  258,  259,  276,  277,  401,  102,  278,  279,
-      281,  283,  255,  280,  282,  251,  265,  265,  265,  265,
-      265,  265,  265,  265,  265,  205,  503,  266,  266,  266,
-
-      266,  266,  266,  266,  266,  266,  207,  267,  267,  267,
-      267,  267,  267,  830,  390,  267,  267,  267,  267,  267,
-      267,  267,  267,  267,  390,  537,  516,  333,  503,  390,
-      284,  102,  485,  267,  267,  267,  267,  267,  267,  268,
-      268,  268,  268,  268,  268,  268,  268,  268,  285,  269,
-      269,  269,  269,  269,  269,  270,  284,  209,  209,  209,
-      209,  209,  209,  209,  209,  209,  475,  472,  274,  102,
-      390,  264,  447,  404,  285,  269,  269,  269,  269,  269,
-      269,  154,  207,  271,  271,  271,  271,  271,  271,  271,
-      271,  271,  156,  272,  272,  272,  272,  272,  272,  830,
-
-      286,  272,  272,  272,  272,  272,  272,  272,  272,  272,
-      390,  264,  264,  385,  381,  374,  373,  370,  290,  272,
-      272,  272,  272,  272,  272,  154,  286,  273,  273,  273,
-      273,  273,  273,  273,  273,  273,  274,  275,  275,  275,
-      275,  275,  275,  830,  290,  275,  275,  275,  275,  275,
-      275,  275,  275,  275,  287,  291,  292,  293,  294,  295,
-      296,  288,  297,  275,  275,  275,  275,  275,  275,  289,
-      298,  301,  302,  303,  299,  304,  305,  306,  307,  309,
-      287,  291,  292,  293,  294,  295,  296,  288,  297,  300,
-      310,  311,  312,  313,  314,  289,  298,  301,  302,  303,
-
-      299,  304,  305,  306,  307,  309,  315,  316,  317,  318,
-      319,  320,  321,  322,  324,  300,  310,  311,  312,  313,
-      314,  325,  335,  335,  335,  335,  335,  335,  335,  335,
-      335,  356,  315,  316,  317,  318,  319,  320,  321,  322,
-      324,  348,  156,  102,  264,  151,  329,  325,  265,  265,
-      265,  265,  265,  265,  265,  265,  265,  205,  102,  330,
-      330,  330,  330,  330,  330,  330,  330,  330,  207,  331,
-      331,  331,  331,  331,  331,  830,  341,  331,  331,  331,
-      331,  331,  331,  331,  331,  331,  323,  308,  830,  264,
-      151,  261,  830,  260,  342,  331,  331,  331,  331,  331,
-
-      331,  205,  341,  332,  332,  332,  332,  332,  332,  332,
-      332,  332,  333,  334,  334,  334,  334,  334,  334,  830,
-      342,  334,  334,  334,  334,  334,  334,  334,  334,  334,
-      256,  252,  343,  235,  226,  224,  219,  218,  102,  334,
-      334,  334,  334,  334,  334,  154,  151,  336,  336,  336,
-      336,  336,  336,  336,  336,  336,  156,  154,  343,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  274,  338,
-      338,  338,  338,  338,  338,  830,  151,  338,  338,  338,
-      338,  338,  338,  338,  338,  338,  191,  181,  176,  165,
-      151,  344,  345,  346,  347,  338,  338,  338,  338,  338,
-
-      338,  339,  339,  339,  339,  339,  339,  339,  339,  339,
-      349,  340,  340,  340,  340,  340,  340,  344,  345,  346,
-      347,  350,  351,  352,  353,  354,  355,  357,  358,  359,
-      360,  361,  362,  363,  364,  365,  349,  340,  340,  340,
-      340,  340,  340,  366,  367,  371,  372,  350,  351,  352,
-      353,  354,  355,  357,  358,  359,  360,  361,  362,  363,
-      364,  365,  368,  375,  376,  377,  378,  379,  380,  366,
-      367,  371,  372,  382,  383,  369,  384,  386,  391,  391,
-      391,  391,  391,  391,  391,  391,  391,  102,  368,  375,
-      376,  377,  378,  379,  380,  127,  102,   45,   46,  382,
-
-      383,  369,  384,  386,  205,   43,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  207,  205,   96,  393,  393,
-      393,  393,  393,  393,  393,  393,  393,  333,  394,  394,
-      394,  394,  394,  394,  830,   54,  394,  394,  394,  394,
-      394,  394,  394,  394,  394,   46,   43,  830,   37,   37,
-      830,  403,  830,  830,  394,  394,  394,  394,  394,  394,
-      395,  395,  395,  395,  395,  395,  395,  395,  395,  405,
-      396,  396,  396,  396,  396,  396,  397,  403,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,  830,  406,  830,
-      830,  830,  830,  830,  830,  405,  396,  396,  396,  396,
-
-      396,  396,  154,  830,  336,  336,  336,  336,  336,  336,
-      336,  336,  336,  154,  406,  398,  398,  398,  398,  398,
-      398,  398,  398,  398,  274,  399,  399,  399,  399,  399,
-      399,  830,  407,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  830,  830,  830,  830,  830,  830,  830,  830,
-      408,  399,  399,  399,  399,  399,  399,  154,  407,  400,
-      400,  400,  400,  400,  400,  400,  400,  400,  401,  402,
-      402,  402,  402,  402,  402,  830,  408,  402,  402,  402,
-      402,  402,  402,  402,  402,  402,  409,  413,  414,  415,
-      416,  417,  418,  419,  420,  402,  402,  402,  402,  402,
-
-      402,  410,  421,  422,  423,  424,  425,  411,  426,  412,
-      427,  428,  409,  413,  414,  415,  416,  417,  418,  419,
-      420,  429,  430,  431,  432,  433,  434,  410,  421,  422,
-      423,  424,  425,  411,  426,  412,  427,  428,  435,  436,
-      437,  438,  439,  440,  441,  442,  443,  429,  430,  431,
-      432,  433,  434,  444,  445,  446,  830,  461,  830,  830,
-      830,  830,  830,  830,  435,  436,  437,  438,  439,  440,
-      441,  442,  443,  830,  830,  830,  830,  830,  830,  444,
-      445,  446,  450,  461,  391,  391,  391,  391,  391,  391,
-      391,  391,  391,  205,  830,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  205,  830,  451,  451,  451,  451,
-      451,  451,  451,  451,  451,  333,  452,  452,  452,  452,
-      452,  452,  830,  462,  452,  452,  452,  452,  452,  452,
-      452,  452,  452,  456,  456,  456,  456,  456,  456,  456,
-      456,  456,  452,  452,  452,  452,  452,  452,  205,  462,
-      453,  453,  453,  453,  453,  453,  453,  453,  453,  454,
-      455,  455,  455,  455,  455,  455,  830,  463,  455,  455,
-      455,  455,  455,  455,  455,  455,  455,  830,  830,  464,
-      830,  830,  830,  830,  830,  830,  455,  455,  455,  455,
-      455,  455,  154,  463,  336,  336,  336,  336,  336,  336,
-
-      336,  336,  336,  274,  154,  464,  457,  457,  457,  457,
-      457,  457,  457,  457,  457,  401,  458,  458,  458,  458,
-      458,  458,  830,  830,  458,  458,  458,  458,  458,  458,
-      458,  458,  458,  830,  830,  830,  830,  830,  465,  466,
-      467,  468,  458,  458,  458,  458,  458,  458,  459,  459,
-      459,  459,  459,  459,  459,  459,  459,  469,  460,  460,
-      460,  460,  460,  460,  465,  466,  467,  468,  470,  471,
-      473,  474,  476,  477,  478,  479,  480,  481,  482,  483,
-      484,  486,  487,  469,  460,  460,  460,  460,  460,  460,
-      488,  489,  490,  491,  470,  471,  473,  474,  476,  477,
-
-      478,  479,  480,  481,  482,  483,  484,  486,  487,  492,
-      493,  494,  495,  496,  497,  498,  488,  489,  490,  491,
-      499,  504,  504,  504,  504,  504,  504,  504,  504,  504,
-      830,  830,  514,  830,  830,  492,  493,  494,  495,  496,
-      497,  498,  830,  830,  830,  205,  499,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  333,  205,  514,  505,
-      505,  505,  505,  505,  505,  505,  505,  505,  454,  506,
-      506,  506,  506,  506,  506,  830,  830,  506,  506,  506,
-      506,  506,  506,  506,  506,  506,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  506,  506,  506,  506,  506,
-
-      506,  507,  507,  507,  507,  507,  507,  507,  507,  507,
-      515,  508,  508,  508,  508,  508,  508,  830,  517,  510,
-      510,  510,  510,  510,  510,  510,  510,  510,  830,  830,
-      830,  830,  830,  830,  830,  830,  515,  508,  508,  508,
-      508,  508,  508,  154,  517,  509,  509,  509,  509,  509,
-      509,  509,  509,  509,  401,  510,  510,  510,  510,  510,
-      510,  830,  518,  513,  513,  513,  513,  513,  513,  513,
-      513,  513,  830,  830,  830,  830,  830,  830,  830,  519,
-      520,  510,  510,  510,  510,  510,  510,  154,  518,  511,
-      511,  511,  511,  511,  511,  511,  511,  511,  512,  513,
-
-      513,  513,  513,  513,  513,  519,  520,  521,  522,  523,
-      524,  525,  526,  527,  528,  529,  530,  531,  532,  533,
-      534,  538,  539,  540,  535,  513,  513,  513,  513,  513,
-      513,  536,  541,  521,  522,  523,  524,  525,  526,  527,
-      528,  529,  530,  531,  532,  533,  534,  538,  539,  540,
-      535,  542,  543,  544,  545,  546,  547,  536,  541,  548,
-      504,  504,  504,  504,  504,  504,  504,  504,  504,  830,
-      830,  830,  830,  830,  830,  830,  830,  542,  543,  544,
-      545,  546,  547,  830,  830,  548,  205,  830,  552,  552,
-      552,  552,  552,  552,  552,  552,  552,  454,  553,  553,
-
-      553,  553,  553,  553,  830,  561,  553,  553,  553,  553,
-      553,  553,  553,  553,  553,  830,  830,  830,  830,  830,
-      830,  830,  830,  562,  553,  553,  553,  553,  553,  553,
-      205,  561,  554,  554,  554,  554,  554,  554,  554,  554,
-      554,  555,  556,  556,  556,  556,  556,  556,  830,  562,
-      556,  556,  556,  556,  556,  556,  556,  556,  556,  830,
-      830,  563,  830,  830,  830,  830,  830,  830,  556,  556,
-      556,  556,  556,  556,  154,  830,  336,  336,  336,  336,
-      336,  336,  336,  336,  336,  401,  154,  563,  557,  557,
-      557,  557,  557,  557,  557,  557,  557,  512,  558,  558,
-
-      558,  558,  558,  558,  830,  830,  558,  558,  558,  558,
-      558,  558,  558,  558,  558,  830,  830,  830,  830,  830,
-      564,  565,  566,  567,  558,  558,  558,  558,  558,  558,
-      559,  559,  559,  559,  559,  559,  559,  559,  559,  568,
-      560,  560,  560,  560,  560,  560,  564,  565,  566,  567,
-      569,  570,  571,  572,  573,  574,  575,  576,  577,  578,
-      830,  581,  582,  583,  584,  568,  560,  560,  560,  560,
-      560,  560,  585,  586,  588,  589,  569,  570,  571,  572,
-      573,  574,  575,  576,  577,  578,  579,  581,  582,  583,
-      584,  603,  830,  580,  830,  830,  830,  830,  585,  586,
-
-      588,  589,  830,  830,  830,  604,  830,  830,  830,  830,
-      830,  830,  579,  830,  830,  830,  830,  603,  205,  580,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  454,
-      205,  604,  594,  594,  594,  594,  594,  594,  594,  594,
-      594,  555,  595,  595,  595,  595,  595,  595,  830,  830,
-      595,  595,  595,  595,  595,  595,  595,  595,  595,  830,
-      830,  830,  830,  830,  830,  606,  830,  830,  595,  595,
-      595,  595,  595,  595,  596,  596,  596,  596,  596,  596,
-      596,  596,  596,  607,  597,  597,  597,  597,  597,  597,
-      830,  606,  599,  599,  599,  599,  599,  599,  599,  599,
-
-      599,  830,  830,  830,  830,  830,  830,  830,  830,  607,
-      597,  597,  597,  597,  597,  597,  154,  830,  598,  598,
-      598,  598,  598,  598,  598,  598,  598,  512,  599,  599,
-      599,  599,  599,  599,  830,  608,  602,  602,  602,  602,
-      602,  602,  602,  602,  602,  830,  830,  830,  830,  830,
-      830,  830,  610,  611,  599,  599,  599,  599,  599,  599,
-      154,  608,  600,  600,  600,  600,  600,  600,  600,  600,
-      600,  601,  602,  602,  602,  602,  602,  602,  610,  611,
-      612,  613,  614,  615,  616,  617,  618,  619,  621,  622,
-      623,  624,  625,  830,  638,  830,  830,  830,  602,  602,
-
-      602,  602,  602,  602,  830,  830,  612,  613,  614,  615,
-      616,  617,  618,  619,  621,  622,  623,  624,  625,  205,
-      638,  629,  629,  629,  629,  629,  629,  629,  629,  629,
-      555,  630,  630,  630,  630,  630,  630,  830,  639,  630,
-      630,  630,  630,  630,  630,  630,  630,  630,  830,  830,
-      830,  830,  830,  830,  830,  830,  640,  630,  630,  630,
-      630,  630,  630,  205,  639,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  632,  633,  633,  633,  633,  633,
-      633,  830,  640,  633,  633,  633,  633,  633,  633,  633,
-      633,  633,  830,  830,  643,  830,  830,  830,  830,  830,
-
-      830,  633,  633,  633,  633,  633,  633,  154,  830,  336,
-      336,  336,  336,  336,  336,  336,  336,  336,  512,  154,
-      643,  634,  634,  634,  634,  634,  634,  634,  634,  634,
-      601,  635,  635,  635,  635,  635,  635,  830,  830,  635,
-      635,  635,  635,  635,  635,  635,  635,  635,  830,  830,
-      830,  830,  830,  830,  644,  645,  646,  635,  635,  635,
-      635,  635,  635,  636,  636,  636,  636,  636,  636,  636,
-      636,  636,  647,  637,  637,  637,  637,  637,  637,  641,
-      644,  645,  646,  648,  649,  642,  650,  651,  652,  653,
-      654,  830,  669,  830,  830,  830,  830,  830,  647,  637,
-
-      637,  637,  637,  637,  637,  641,  830,  830,  830,  648,
-      649,  642,  650,  651,  652,  653,  654,  205,  669,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  555,  205,
-      830,  659,  659,  659,  659,  659,  659,  659,  659,  659,
-      632,  660,  660,  660,  660,  660,  660,  830,  830,  660,
-      660,  660,  660,  660,  660,  660,  660,  660,  830,  830,
-      830,  830,  830,  830,  670,  830,  830,  660,  660,  660,
-      660,  660,  660,  661,  661,  661,  661,  661,  661,  661,
-      661,  661,  671,  662,  662,  662,  662,  662,  662,  830,
-      670,  664,  664,  664,  664,  664,  664,  664,  664,  664,
-
-      830,  830,  830,  830,  830,  830,  830,  830,  671,  662,
-      662,  662,  662,  662,  662,  154,  830,  663,  663,  663,
-      663,  663,  663,  663,  663,  663,  601,  664,  664,  664,
-      664,  664,  664,  830,  672,  667,  667,  667,  667,  667,
-      667,  667,  667,  667,  830,  830,  830,  830,  830,  830,
-      830,  673,  674,  664,  664,  664,  664,  664,  664,  154,
-      672,  665,  665,  665,  665,  665,  665,  665,  665,  665,
-      666,  667,  667,  667,  667,  667,  667,  673,  674,  675,
-      676,  677,  678,  679,  680,  682,  830,  696,  688,  688,
-      688,  688,  688,  688,  688,  688,  688,  667,  667,  667,
-
-      667,  667,  667,  830,  830,  675,  676,  677,  678,  679,
-      680,  682,  205,  696,  687,  687,  687,  687,  687,  687,
-      687,  687,  687,  632,  688,  688,  688,  688,  688,  688,
-      830,  697,  691,  691,  691,  691,  691,  691,  691,  691,
-      691,  830,  830,  830,  830,  830,  830,  830,  830,  699,
-      688,  688,  688,  688,  688,  688,  205,  697,  689,  689,
-      689,  689,  689,  689,  689,  689,  689,  690,  691,  691,
-      691,  691,  691,  691,  154,  699,  336,  336,  336,  336,
-      336,  336,  336,  336,  336,  601,  830,  830,  830,  830,
-      830,  830,  830,  700,  691,  691,  691,  691,  691,  691,
-
-      154,  830,  692,  692,  692,  692,  692,  692,  692,  692,
-      692,  666,  693,  693,  693,  693,  693,  693,  830,  700,
-      693,  693,  693,  693,  693,  693,  693,  693,  693,  830,
-      830,  830,  830,  830,  701,  702,  703,  704,  693,  693,
-      693,  693,  693,  693,  694,  694,  694,  694,  694,  694,
-      694,  694,  694,  705,  695,  695,  695,  695,  695,  695,
-      701,  702,  703,  704,  706,  707,  708,  205,  723,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  632,  705,
-      695,  695,  695,  695,  695,  695,  724,  830,  830,  830,
-      706,  707,  708,  205,  723,  714,  714,  714,  714,  714,
-
-      714,  714,  714,  714,  690,  715,  715,  715,  715,  715,
-      715,  830,  724,  715,  715,  715,  715,  715,  715,  715,
-      715,  715,  830,  830,  830,  830,  830,  830,  730,  830,
-      830,  715,  715,  715,  715,  715,  715,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  731,  717,  717,  717,
-      717,  717,  717,  830,  730,  719,  719,  719,  719,  719,
-      719,  719,  719,  719,  830,  830,  830,  830,  830,  830,
-      830,  830,  731,  717,  717,  717,  717,  717,  717,  154,
-      830,  718,  718,  718,  718,  718,  718,  718,  718,  718,
-      666,  719,  719,  719,  719,  719,  719,  830,  732,  722,
-
-      722,  722,  722,  722,  722,  722,  722,  722,  830,  830,
-      830,  830,  830,  830,  830,  733,  734,  719,  719,  719,
-      719,  719,  719,  154,  732,  720,  720,  720,  720,  720,
-      720,  720,  720,  720,  721,  722,  722,  722,  722,  722,
-      722,  733,  734,  735,  736,  830,  749,  743,  743,  743,
-      743,  743,  743,  743,  743,  743,  830,  830,  830,  830,
-      830,  722,  722,  722,  722,  722,  722,  830,  830,  735,
-      736,  205,  749,  742,  742,  742,  742,  742,  742,  742,
-      742,  742,  690,  743,  743,  743,  743,  743,  743,  830,
-      750,  745,  745,  745,  745,  745,  745,  745,  745,  745,
-
-      755,  830,  830,  830,  830,  830,  830,  830,  756,  743,
-      743,  743,  743,  743,  743,  205,  750,  744,  744,  744,
-      744,  744,  744,  744,  744,  744,  755,  745,  745,  745,
-      745,  745,  745,  154,  756,  336,  336,  336,  336,  336,
-      336,  336,  336,  336,  666,  830,  830,  830,  830,  830,
-      830,  830,  757,  745,  745,  745,  745,  745,  745,  154,
-      830,  746,  746,  746,  746,  746,  746,  746,  746,  746,
-      721,  747,  747,  747,  747,  747,  747,  830,  757,  747,
-      747,  747,  747,  747,  747,  747,  747,  747,  758,  759,
-      760,  761,  830,  771,  830,  830,  830,  747,  747,  747,
-
-      747,  747,  747,  830,  830,  767,  767,  767,  767,  767,
-      767,  767,  767,  767,  758,  759,  760,  761,  205,  771,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  690,
-      205,  830,  766,  766,  766,  766,  766,  766,  766,  766,
-      766,  772,  767,  767,  767,  767,  767,  767,  830,  777,
-      769,  769,  769,  769,  769,  769,  769,  769,  769,  830,
-      830,  830,  830,  830,  830,  830,  778,  772,  767,  767,
-      767,  767,  767,  767,  154,  777,  768,  768,  768,  768,
-      768,  768,  768,  768,  768,  721,  769,  769,  769,  769,
-      769,  769,  778,  779,  780,  830,  788,  786,  786,  786,
-
-      786,  786,  786,  786,  786,  786,  789,  830,  830,  830,
-      830,  830,  769,  769,  769,  769,  769,  769,  830,  779,
-      780,  205,  788,  785,  785,  785,  785,  785,  785,  785,
-      785,  785,  789,  786,  786,  786,  786,  786,  786,  154,
-      790,  336,  336,  336,  336,  336,  336,  336,  336,  336,
-      721,  791,  796,  797,  798,  803,  804,  805,  809,  786,
-      786,  786,  786,  786,  786,  205,  790,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  830,  791,  796,  797,
-      798,  803,  804,  805,  809,   36,   36,   36,   36,   38,
-       38,   38,   38,   42,   42,   42,   42,   44,  830,   44,
-
-       44,   45,   45,   45,   45,   97,  830,   97,   97,  101,
-      101,  149,  149,  150,  150,  202,  202,  203,  203,  204,
-      204,  262,  262,  263,  263,  326,  326,  327,  327,  328,
-      328,  387,  387,  388,  388,  389,  389,  448,  448,  449,
-      449,  500,  500,  501,  501,  502,  502,  549,  549,  550,
-      550,  551,  551,  448,  448,  591,  591,  592,  592,  626,
-      626,  627,  627,  628,  628,  655,  655,  656,  656,  657,
-      657,  550,  550,  684,  684,  685,  685,  709,  709,  710,
-      710,  711,  711,  737,  737,  738,  738,  740,  740,  627,
-      627,  763,  763,  764,  764,  781,  781,  782,  782,  783,
-
-      783,  792,  792,  793,  793,  684,  684,  800,  800,  801,
-      801,  806,  806,  807,  807,  810,  810,  811,  811,  812,
-      812,  738,  738,  815,  815,  817,  817,  818,  818,  819,
-      819,  822,  822,  825,  825,  826,  826,  828,  828,  829,
-      829,    7,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830
+       17,   18,   19,   20,   21,   22,   23,   24,   25,   25,
+       26,   25,   25,   27,   25,   28,   29,   30,   25,   31,
+       32,   33,   34,   35,   36,   25,   25,   25,   19,   20,
+       21,   22,   23,   24,   25,   25,   26,   25,   25,   27,
+       25,   28,   29,   30,   25,   31,   32,   33,   34,   35,
+       36,   25,   25,   25,   37,   37,   38,   37,   37,   37,
+       37,   39,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,  892,   41,   42,   43,   44,   44,   44,   44,
+       45,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       46,   46,   56,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   47,   47,   47,   47,   47,   47,
+       48,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   49,  892,
+       57,   70,   50,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   52,   53,   53,   53,   53,   53,   53,   71,
+       54,   81,   95,   98,   99,  892,   57,   70,  100,  133,
+      172,  184,  186,  187,  189,  199,   55,  226,  228,   53,
+       53,   53,   53,   53,   53,   71,   54,   81,   95,   98,
+
+       57,   57,  233,   58,   58,   58,   58,   58,   58,   58,
+       58,   58,   55,   58,   58,   58,   59,   58,   60,   57,
+       61,   57,   57,   57,   57,   57,   62,   57,   57,   57,
+       57,   57,   57,   63,   57,   57,   57,   57,   57,   58,
+       58,   58,   59,   58,   60,   57,   61,   57,   57,   57,
+       57,   57,   62,   57,   57,   57,   57,   57,   57,   63,
+       57,   57,   57,   57,   57,   58,   65,   58,   72,  111,
+       64,   66,   75,   73,  112,   57,   67,   68,   76,  113,
+      114,   74,   57,   69,  234,  236,  245,  262,  266,  270,
+      892,   58,   65,   58,   72,  111,   64,   66,   75,   73,
+
+      112,   57,   67,   68,   76,  113,  114,   74,   57,   69,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,  892,
+       57,   57,   57,   57,   57,   57,   77,   57,   82,   84,
+      892,   96,  115,   85,   78,   97,  271,  116,  280,  117,
+       79,  118,   83,   86,  123,   80,   57,   57,   57,   57,
+       57,   57,   77,   57,   82,   84,   87,   96,  115,   85,
+       78,   97,   88,  116,   89,  117,   79,  118,   83,   86,
+      123,   80,  124,   90,   91,   92,  892,  320,  335,  157,
+      341,  162,   87,   93,  125,  126,  129,  130,   88,  358,
+       89,   94,  361,  370,  384,  387,  388,  391,  124,   90,
+
+      104,  104,  104,  104,  104,  104,  104,  104,  104,   93,
+      125,  126,  129,  130,  396,  101,  101,   94,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  101,
+      101,  101,  101,  101,  101,  101,  101,  101,  101,  102,
+      102,  102,  102,  102,  102,  102,  102,  102,  103,  104,
+
+      104,  104,  104,  104,  104,  105,  105,  105,  105,  105,
+      105,  105,  105,  105,  106,  105,  105,  105,  105,  105,
+      105,  400,  215,  412,  892,  104,  104,  104,  104,  104,
+      104,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      419,  105,  105,  105,  105,  105,  105,  107,  107,  107,
+      107,  107,  107,  107,  107,  107,  131,  107,  107,  107,
+      107,  107,  107,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  132,  109,  109,  109,  109,  109,  109,  468,
+      274,  471,  131,  107,  107,  107,  107,  107,  107,  892,
+      284,  284,  494,  498,  508,  345,  345,  134,  132,  109,
+
+      109,  109,  109,  109,  109,  110,  110,  110,  110,  110,
+      110,  110,  110,  110,  103,  110,  110,  110,  110,  110,
+      110,  119,  121,  134,  543,  135,  122,  136,  137,  142,
+      566,  120,  127,  405,  143,  144,  145,  416,  416,  148,
+      149,  110,  110,  110,  110,  110,  110,  119,  121,  138,
+      128,  135,  122,  136,  137,  142,  139,  120,  127,  140,
+      143,  144,  145,  141,  146,  148,  149,  150,  151,  152,
+      165,  166,  626,  629,  475,  138,  128,  475,  644,  649,
+      661,  147,  139,  530,  539,  140,  539,  685,  701,  141,
+      146,  588,  588,  150,  151,  152,  165,  166,  153,  153,
+
+      153,  153,  153,  153,  153,  153,  153,  147,  154,  154,
+      154,  154,  154,  154,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  167,  155,  155,  155,  155,  155,  155,
+      718,  735,  737,  632,  154,  154,  154,  154,  154,  154,
+      209,  209,  209,  209,  209,  209,  209,  209,  209,  167,
+      155,  155,  155,  155,  155,  155,  156,  156,  156,  156,
+      156,  156,  156,  156,  156,  157,  156,  156,  156,  156,
+      156,  156,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  168,  159,  159,  159,  159,  159,  159,  640,  169,
+      640,  753,  156,  156,  156,  156,  156,  156,  217,  217,
+
+      217,  217,  217,  217,  217,  217,  217,  168,  159,  159,
+      159,  159,  159,  159,  160,  169,  161,  161,  161,  161,
+      161,  161,  161,  161,  161,  162,  163,  163,  163,  163,
+      163,  163,  892,  677,  163,  163,  163,  163,  163,  163,
+      163,  163,  163,  677,  786,  708,  798,  716,  170,  171,
+      173,  174,  163,  163,  163,  163,  163,  163,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  175,  164,  164,
+      164,  164,  164,  164,  170,  171,  173,  174,  176,  177,
+      178,  179,  180,  181,  182,  183,  185,  188,  190,  191,
+      192,  193,  194,  175,  164,  164,  164,  164,  164,  164,
+
+      195,  196,  197,  198,  176,  177,  178,  179,  180,  181,
+      182,  183,  185,  188,  190,  191,  192,  193,  194,  200,
+      201,  202,  203,  204,  205,  206,  195,  196,  197,  198,
+      207,  892,  716,  216,  216,  216,  216,  216,  216,  216,
+      216,  216,  812,  813,  823,  200,  201,  202,  203,  204,
+      205,  206,  810,  744,  744,  811,  207,  208,  208,  208,
+      208,  208,  208,  208,  208,  208,  225,  209,  209,  209,
+      209,  209,  209,  210,  210,  210,  210,  210,  210,  210,
+      210,  210,  227,  210,  210,  210,  210,  210,  210,  834,
+      835,  836,  225,  209,  209,  209,  209,  209,  209,  782,
+
+      783,  784,  837,  785,  769,  778,  778,  223,  227,  210,
+      210,  210,  210,  210,  210,  211,  211,  211,  211,  211,
+      211,  211,  211,  211,  224,  211,  211,  211,  211,  211,
+      211,  212,  212,  212,  212,  212,  212,  212,  212,  212,
+      229,  212,  212,  212,  212,  212,  212,  800,  230,  892,
+      224,  211,  211,  211,  211,  211,  211,  275,  275,  275,
+      275,  275,  275,  275,  275,  275,  229,  212,  212,  212,
+      212,  212,  212,  213,  230,  214,  214,  214,  214,  214,
+      214,  214,  214,  214,  215,  216,  216,  216,  216,  216,
+      216,  218,  218,  218,  218,  218,  218,  218,  218,  218,
+
+      231,  219,  219,  219,  219,  219,  219,  861,  846,  876,
+      864,  216,  216,  216,  216,  216,  216,  875,  886,  892,
+      882,  889,    0,    0,  232,    0,  231,  219,  219,  219,
+      219,  219,  219,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  235,  221,  221,  221,  221,  221,  221,  892,
+      232,  219,  219,  219,  219,  219,  219,  219,  219,  219,
+        0,    0,    0,    0,    0,  237,  238,  239,  235,  221,
+      221,  221,  221,  221,  221,  222,  222,  222,  222,  222,
+      222,  222,  222,  222,  240,  222,  222,  222,  222,  222,
+      222,  237,  238,  239,  241,  248,  249,  250,  253,  254,
+
+      255,  256,  246,  242,  243,  244,    0,  257,  258,  259,
+      240,  222,  222,  222,  222,  222,  222,  247,  263,  267,
+      241,  248,  249,  250,  253,  254,  255,  256,  246,  242,
+      243,  244,  251,  257,  258,  259,  252,  260,  264,  268,
+      269,  286,  287,  247,  263,  267,  288,  289,  291,  265,
+      294,  290,  261,    0,    0,    0,    0,    0,  251,    0,
+        0,    0,  252,  260,  264,  268,  269,  286,  287,    0,
+        0,    0,  288,  289,  291,  265,  294,  290,  261,  272,
+      272,  272,  272,  272,  272,  272,  272,  272,  295,  272,
+      272,  272,  272,  272,  272,  273,  273,  273,  273,  273,
+
+      273,  273,  273,  273,  274,  273,  273,  273,  273,  273,
+      273,    0,    0,    0,  295,  272,  272,  272,  272,  272,
+      272,  347,  347,  347,  347,  347,  347,  347,  347,  347,
+        0,  273,  273,  273,  273,  273,  273,  276,  276,  276,
+      276,  276,  276,  276,  276,  276,  296,  277,  277,  277,
+      277,  277,  277,  278,  278,  278,  278,  278,  278,  278,
+      278,  278,  297,  279,  279,  279,  279,  279,  279,    0,
+      301,    0,  296,  277,  277,  277,  277,  277,  277,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  297,  279,
+      279,  279,  279,  279,  279,  892,  301,  277,  277,  277,
+
+      277,  277,  277,  277,  277,  277,  281,  281,  281,  281,
+      281,  281,  281,  281,  281,  302,  282,  282,  282,  282,
+      282,  282,  892,    0,  282,  282,  282,  282,  282,  282,
+      282,  282,  282,    0,    0,    0,    0,    0,    0,  303,
+        0,  302,  282,  282,  282,  282,  282,  282,  283,  283,
+      283,  283,  283,  283,  283,  283,  283,  284,  285,  285,
+      285,  285,  285,  285,  892,  303,  285,  285,  285,  285,
+      285,  285,  285,  285,  285,  292,  298,  304,  305,  293,
+      306,  307,  308,  299,  285,  285,  285,  285,  285,  285,
+      309,  300,  310,  313,  314,  311,  315,  316,  317,  318,
+
+      319,  292,  298,  304,  305,  293,  306,  307,  308,  299,
+      312,  321,  322,  323,  324,  325,  309,  300,  310,  313,
+      314,  311,  315,  316,  317,  318,  319,  326,  327,  328,
+      329,  330,  331,  332,  333,  334,  312,  321,  322,  323,
+      324,  325,  336,  337,  477,  477,  477,  477,  477,  477,
+      477,  477,  477,  326,  327,  328,  329,  330,  331,  332,
+      333,  334,    0,    0,    0,    0,    0,    0,  336,  337,
+      338,  338,  338,  338,  338,  338,  338,  338,  338,  353,
+      338,  338,  338,  338,  338,  338,  339,  339,  339,  339,
+      339,  339,  339,  339,  339,  354,  339,  339,  339,  339,
+
+      339,  339,    0,    0,    0,  353,  338,  338,  338,  338,
+      338,  338,  531,  531,  531,  531,  531,  531,  531,  531,
+      531,  354,  339,  339,  339,  339,  339,  339,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  355,  340,  340,
+      340,  340,  340,  340,  342,  342,  342,  342,  342,  342,
+      342,  342,  342,  356,  343,  343,  343,  343,  343,  343,
+        0,  357,    0,  355,  340,  340,  340,  340,  340,  340,
+      774,  774,  774,  774,  774,  774,  774,  774,  774,  356,
+      343,  343,  343,  343,  343,  343,  892,  357,  343,  343,
+      343,  343,  343,  343,  343,  343,  343,  344,  344,  344,
+
+      344,  344,  344,  344,  344,  344,  345,  346,  346,  346,
+      346,  346,  346,  892,  359,  346,  346,  346,  346,  346,
+      346,  346,  346,  346,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  346,  346,  346,  346,  346,  346,  160,
+      359,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+      162,  349,  349,  349,  349,  349,  349,  349,  349,  349,
+      360,  350,  350,  350,  350,  350,  350,  351,  351,  351,
+      351,  351,  351,  351,  351,  351,  362,  352,  352,  352,
+      352,  352,  352,    0,  363,    0,  360,  350,  350,  350,
+      350,  350,  350,    0,  364,  365,  366,  367,  368,  369,
+
+      371,  372,  362,  352,  352,  352,  352,  352,  352,  892,
+      363,  350,  350,  350,  350,  350,  350,  350,  350,  350,
+      364,  365,  366,  367,  368,  369,  371,  372,  373,  374,
+      375,  376,  377,  378,  379,  380,  381,  382,  385,  386,
+      389,  390,  392,  393,  394,  395,  397,  398,  399,  401,
+      383,    0,    0,    0,  373,  374,  375,  376,  377,  378,
+      379,  380,  381,  382,  385,  386,  389,  390,  392,  393,
+      394,  395,  397,  398,  399,  401,  383,  402,  402,  402,
+      402,  402,  402,  402,  402,  402,  418,  402,  402,  402,
+      402,  402,  402,  403,  403,  403,  403,  403,  403,  403,
+
+      403,  403,  420,  403,  403,  403,  403,  403,  403,    0,
+        0,    0,  418,  402,  402,  402,  402,  402,  402,    0,
+        0,    0,    0,    0,    0,    0,  421,    0,  420,  403,
+      403,  403,  403,  403,  403,  404,  404,  404,  404,  404,
+      404,  404,  404,  404,  405,  404,  404,  404,  404,  404,
+      404,  213,  421,  407,  407,  407,  407,  407,  407,  407,
+      407,  407,  215,    0,    0,    0,    0,    0,    0,    0,
+        0,  404,  404,  404,  404,  404,  404,  408,  408,  408,
+      408,  408,  408,  408,  408,  408,  422,  409,  409,  409,
+      409,  409,  409,  410,  410,  410,  410,  410,  410,  410,
+
+      410,  410,  423,  411,  411,  411,  411,  411,  411,    0,
+      424,    0,  422,  409,  409,  409,  409,  409,  409,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  423,  411,
+      411,  411,  411,  411,  411,  892,  424,  409,  409,  409,
+      409,  409,  409,  409,  409,  409,  413,  413,  413,  413,
+      413,  413,  413,  413,  413,  425,  414,  414,  414,  414,
+      414,  414,  892,    0,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,    0,    0,    0,    0,    0,    0,  429,
+        0,  425,  414,  414,  414,  414,  414,  414,  415,  415,
+      415,  415,  415,  415,  415,  415,  415,  416,  417,  417,
+
+      417,  417,  417,  417,  892,  429,  417,  417,  417,  417,
+      417,  417,  417,  417,  417,  426,  430,  431,  432,  433,
+      434,  427,  435,  428,  417,  417,  417,  417,  417,  417,
+      436,  437,  438,  439,  440,  441,  442,  443,  444,  445,
+      446,  426,  430,  431,  432,  433,  434,  427,  435,  428,
+      447,  448,  449,  450,  451,  452,  436,  437,  438,  439,
+      440,  441,  442,  443,  444,  445,  446,  453,  454,  455,
+      456,  459,  460,  461,  462,  463,  447,  448,  449,  450,
+      451,  452,  464,  465,  457,  466,  467,  458,    0,    0,
+        0,    0,    0,  453,  454,  455,  456,  459,  460,  461,
+
+      462,  463,    0,    0,    0,    0,    0,    0,  464,  465,
+      457,  466,  467,  458,  469,  469,  469,  469,  469,  469,
+      469,  469,  469,  482,  469,  469,  469,  469,  469,  469,
+      470,  470,  470,  470,  470,  470,  470,  470,  470,  483,
+      470,  470,  470,  470,  470,  470,    0,    0,    0,  482,
+      469,  469,  469,  469,  469,  469,    0,    0,    0,    0,
+        0,    0,    0,  484,    0,  483,  470,  470,  470,  470,
+      470,  470,  472,  472,  472,  472,  472,  472,  472,  472,
+      472,  485,  473,  473,  473,  473,  473,  473,  892,  484,
+      473,  473,  473,  473,  473,  473,  473,  473,  473,    0,
+
+        0,    0,    0,    0,    0,  486,    0,  485,  473,  473,
+      473,  473,  473,  473,  474,  474,  474,  474,  474,  474,
+      474,  474,  474,  475,  476,  476,  476,  476,  476,  476,
+      892,  486,  476,  476,  476,  476,  476,  476,  476,  476,
+      476,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      476,  476,  476,  476,  476,  476,  478,  478,  478,  478,
+      478,  478,  478,  478,  478,  487,  479,  479,  479,  479,
+      479,  479,  480,  480,  480,  480,  480,  480,  480,  480,
+      480,  488,  481,  481,  481,  481,  481,  481,    0,  489,
+        0,  487,  479,  479,  479,  479,  479,  479,    0,  490,
+
+      491,  492,  493,  495,  496,  497,  499,  488,  481,  481,
+      481,  481,  481,  481,  892,  489,  479,  479,  479,  479,
+      479,  479,  479,  479,  479,  490,  491,  492,  493,  495,
+      496,  497,  499,  500,  501,  502,  503,  504,  505,  506,
+      507,  509,  510,  511,  512,  513,  514,  515,  516,  517,
+      518,  519,  520,  521,  522,  523,  524,  525,  526,  500,
+      501,  502,  503,  504,  505,  506,  507,  509,  510,  511,
+      512,  513,  514,  515,  516,  517,  518,  519,  520,  521,
+      522,  523,  524,  525,  526,  527,  527,  527,  527,  527,
+      527,  527,  527,  527,  541,  527,  527,  527,  527,  527,
+
+      527,  528,  528,  528,  528,  528,  528,  528,  528,  528,
+      542,  528,  528,  528,  528,  528,  528,    0,    0,    0,
+      541,  527,  527,  527,  527,  527,  527,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  542,  528,  528,  528,
+      528,  528,  528,  529,  529,  529,  529,  529,  529,  529,
+      529,  529,  530,  529,  529,  529,  529,  529,  529,  532,
+      532,  532,  532,  532,  532,  532,  532,  532,  544,  533,
+      533,  533,  533,  533,  533,    0,    0,    0,    0,  529,
+      529,  529,  529,  529,  529,    0,    0,    0,    0,    0,
+        0,    0,  545,    0,  544,  533,  533,  533,  533,  533,
+
+      533,  534,  534,  534,  534,  534,  534,  534,  534,  534,
+      546,  535,  535,  535,  535,  535,  535,  892,  545,  533,
+      533,  533,  533,  533,  533,  533,  533,  533,    0,    0,
+        0,    0,    0,    0,  547,    0,  546,  535,  535,  535,
+      535,  535,  535,  536,  536,  536,  536,  536,  536,  536,
+      536,  536,  548,  537,  537,  537,  537,  537,  537,  892,
+      547,  537,  537,  537,  537,  537,  537,  537,  537,  537,
+        0,    0,    0,    0,    0,    0,  549,    0,  548,  537,
+      537,  537,  537,  537,  537,  538,  538,  538,  538,  538,
+      538,  538,  538,  538,  539,  540,  540,  540,  540,  540,
+
+      540,  892,  549,  540,  540,  540,  540,  540,  540,  540,
+      540,  540,  550,  551,  552,  553,  554,  555,  556,  557,
+      558,  540,  540,  540,  540,  540,  540,  559,  560,  561,
+      562,  563,    0,  567,  568,  569,  570,  571,  550,  551,
+      552,  553,  554,  555,  556,  557,  558,  572,  573,  574,
+      575,  564,  576,  559,  560,  561,  562,  563,  565,  567,
+      568,  569,  570,  571,  577,  578,  579,  580,  581,    0,
+        0,    0,    0,  572,  573,  574,  575,  564,  576,    0,
+        0,    0,    0,    0,  565,    0,    0,    0,    0,    0,
+      577,  578,  579,  580,  581,  582,  582,  582,  582,  582,
+
+      582,  582,  582,  582,  594,  582,  582,  582,  582,  582,
+      582,  583,  583,  583,  583,  583,  583,  583,  583,  583,
+      595,  583,  583,  583,  583,  583,  583,    0,    0,    0,
+      594,  582,  582,  582,  582,  582,  582,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  595,  583,  583,  583,
+      583,  583,  583,  584,  584,  584,  584,  584,  584,  584,
+      584,  584,  596,  584,  584,  584,  584,  584,  584,  585,
+      585,  585,  585,  585,  585,  585,  585,  585,  597,  586,
+      586,  586,  586,  586,  586,    0,  598,    0,  596,  584,
+      584,  584,  584,  584,  584,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,  597,  586,  586,  586,  586,  586,
+      586,  892,  598,  586,  586,  586,  586,  586,  586,  586,
+      586,  586,  587,  587,  587,  587,  587,  587,  587,  587,
+      587,  588,  589,  589,  589,  589,  589,  589,  892,    0,
+      589,  589,  589,  589,  589,  589,  589,  589,  589,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  589,  589,
+      589,  589,  589,  589,  590,  590,  590,  590,  590,  590,
+      590,  590,  590,  599,  591,  591,  591,  591,  591,  591,
+      592,  592,  592,  592,  592,  592,  592,  592,  592,  600,
+      593,  593,  593,  593,  593,  593,    0,  601,    0,  599,
+
+      591,  591,  591,  591,  591,  591,    0,  602,  603,  604,
+      605,  606,  607,  608,  609,  600,  593,  593,  593,  593,
+      593,  593,  892,  601,  591,  591,  591,  591,  591,  591,
+      591,  591,  591,  602,  603,  604,  605,  606,  607,  608,
+      609,  610,  611,  612,  613,  614,  616,  617,  618,  619,
+      620,  621,  615,  622,  623,  624,  625,  627,  628,    0,
+        0,    0,    0,    0,    0,    0,    0,  610,  611,  612,
+      613,  614,  616,  617,  618,  619,  620,  621,  615,  622,
+      623,  624,  625,  627,  628,  630,  630,  630,  630,  630,
+      630,  630,  630,  630,  642,  630,  630,  630,  630,  630,
+
+      630,  631,  631,  631,  631,  631,  631,  631,  631,  631,
+      632,  631,  631,  631,  631,  631,  631,    0,    0,    0,
+      642,  630,  630,  630,  630,  630,  630,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  631,  631,  631,
+      631,  631,  631,  633,  633,  633,  633,  633,  633,  633,
+      633,  633,  643,  634,  634,  634,  634,  634,  634,  635,
+      635,  635,  635,  635,  635,  635,  635,  635,  645,  636,
+      636,  636,  636,  636,  636,    0,  646,    0,  643,  634,
+      634,  634,  634,  634,  634,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  645,  636,  636,  636,  636,  636,
+
+      636,  892,  646,  634,  634,  634,  634,  634,  634,  634,
+      634,  634,  637,  637,  637,  637,  637,  637,  637,  637,
+      637,  647,  638,  638,  638,  638,  638,  638,  892,    0,
+      638,  638,  638,  638,  638,  638,  638,  638,  638,    0,
+        0,    0,    0,    0,    0,  648,    0,  647,  638,  638,
+      638,  638,  638,  638,  639,  639,  639,  639,  639,  639,
+      639,  639,  639,  640,  641,  641,  641,  641,  641,  641,
+      892,  648,  641,  641,  641,  641,  641,  641,  641,  641,
+      641,  650,  651,  652,  653,  654,  655,  656,  657,  658,
+      641,  641,  641,  641,  641,  641,  659,  660,  662,  663,
+
+      664,  665,  666,  667,  668,  669,  670,  650,  651,  652,
+      653,  654,  655,  656,  657,  658,  683,    0,    0,    0,
+        0,    0,  659,  660,  662,  663,  664,  665,  666,  667,
+      668,  669,  670,  671,  671,  671,  671,  671,  671,  671,
+      671,  671,  683,  671,  671,  671,  671,  671,  671,  672,
+      672,  672,  672,  672,  672,  672,  672,  672,  684,  672,
+      672,  672,  672,  672,  672,    0,    0,    0,    0,  671,
+      671,  671,  671,  671,  671,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  684,  672,  672,  672,  672,  672,
+      672,  673,  673,  673,  673,  673,  673,  673,  673,  673,
+
+      686,  673,  673,  673,  673,  673,  673,  674,  674,  674,
+      674,  674,  674,  674,  674,  674,  689,  675,  675,  675,
+      675,  675,  675,    0,  690,    0,  686,  673,  673,  673,
+      673,  673,  673,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  689,  675,  675,  675,  675,  675,  675,  892,
+      690,  675,  675,  675,  675,  675,  675,  675,  675,  675,
+      676,  676,  676,  676,  676,  676,  676,  676,  676,  677,
+      678,  678,  678,  678,  678,  678,  892,    0,  678,  678,
+      678,  678,  678,  678,  678,  678,  678,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  678,  678,  678,  678,
+
+      678,  678,  679,  679,  679,  679,  679,  679,  679,  679,
+      679,  691,  680,  680,  680,  680,  680,  680,  681,  681,
+      681,  681,  681,  681,  681,  681,  681,  692,  682,  682,
+      682,  682,  682,  682,    0,  693,    0,  691,  680,  680,
+      680,  680,  680,  680,    0,  687,  694,  695,  696,  697,
+      698,  688,  699,  692,  682,  682,  682,  682,  682,  682,
+      892,  693,  680,  680,  680,  680,  680,  680,  680,  680,
+      680,  687,  694,  695,  696,  697,  698,  688,  699,  700,
+      702,  703,  704,  705,  705,  705,  705,  705,  705,  705,
+      705,  705,  719,  705,  705,  705,  705,  705,  705,    0,
+
+        0,    0,    0,    0,    0,  700,  702,  703,  704,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  719,  705,
+      705,  705,  705,  705,  705,  706,  706,  706,  706,  706,
+      706,  706,  706,  706,  720,  706,  706,  706,  706,  706,
+      706,  707,  707,  707,  707,  707,  707,  707,  707,  707,
+      708,  707,  707,  707,  707,  707,  707,    0,    0,    0,
+      720,  706,  706,  706,  706,  706,  706,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  707,  707,  707,
+      707,  707,  707,  709,  709,  709,  709,  709,  709,  709,
+      709,  709,  721,  710,  710,  710,  710,  710,  710,  711,
+
+      711,  711,  711,  711,  711,  711,  711,  711,  722,  712,
+      712,  712,  712,  712,  712,    0,  723,    0,  721,  710,
+      710,  710,  710,  710,  710,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  722,  712,  712,  712,  712,  712,
+      712,  892,  723,  710,  710,  710,  710,  710,  710,  710,
+      710,  710,  713,  713,  713,  713,  713,  713,  713,  713,
+      713,  724,  714,  714,  714,  714,  714,  714,  892,    0,
+      714,  714,  714,  714,  714,  714,  714,  714,  714,    0,
+        0,    0,    0,    0,    0,  725,    0,  724,  714,  714,
+      714,  714,  714,  714,  715,  715,  715,  715,  715,  715,
+
+      715,  715,  715,  716,  717,  717,  717,  717,  717,  717,
+      892,  725,  717,  717,  717,  717,  717,  717,  717,  717,
+      717,  726,  727,  728,  729,  730,  731,  732,  733,  734,
+      717,  717,  717,  717,  717,  717,  736,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  750,  726,  727,  728,
+      729,  730,  731,  732,  733,  734,    0,    0,    0,    0,
+        0,    0,  736,  738,  738,  738,  738,  738,  738,  738,
+      738,  738,  750,  738,  738,  738,  738,  738,  738,  739,
+      739,  739,  739,  739,  739,  739,  739,  739,  740,  739,
+      739,  739,  739,  739,  739,    0,    0,    0,    0,  738,
+
+      738,  738,  738,  738,  738,    0,    0,    0,    0,    0,
+        0,    0,  751,    0,    0,  739,  739,  739,  739,  739,
+      739,  741,  741,  741,  741,  741,  741,  741,  741,  741,
+      752,  742,  742,  742,  742,  742,  742,  892,  751,  742,
+      742,  742,  742,  742,  742,  742,  742,  742,    0,    0,
+        0,    0,    0,    0,  754,    0,  752,  742,  742,  742,
+      742,  742,  742,  743,  743,  743,  743,  743,  743,  743,
+      743,  743,  744,  745,  745,  745,  745,  745,  745,  892,
+      754,  745,  745,  745,  745,  745,  745,  745,  745,  745,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  745,
+
+      745,  745,  745,  745,  745,  746,  746,  746,  746,  746,
+      746,  746,  746,  746,  755,  747,  747,  747,  747,  747,
+      747,  748,  748,  748,  748,  748,  748,  748,  748,  748,
+      756,  749,  749,  749,  749,  749,  749,    0,  757,    0,
+      755,  747,  747,  747,  747,  747,  747,    0,  758,  759,
+      760,  761,  762,  763,  764,  765,  756,  749,  749,  749,
+      749,  749,  749,  892,  757,  747,  747,  747,  747,  747,
+      747,  747,  747,  747,  758,  759,  760,  761,  762,  763,
+      764,  765,  766,  766,  766,  766,  766,  766,  766,  766,
+      766,  780,  766,  766,  766,  766,  766,  766,  767,  767,
+
+      767,  767,  767,  767,  767,  767,  767,  781,  767,  767,
+      767,  767,  767,  767,    0,    0,    0,  780,  766,  766,
+      766,  766,  766,  766,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  781,  767,  767,  767,  767,  767,  767,
+      768,  768,  768,  768,  768,  768,  768,  768,  768,  769,
+      768,  768,  768,  768,  768,  768,  770,  770,  770,  770,
+      770,  770,  770,  770,  770,  787,  770,  770,  770,  770,
+      770,  770,    0,    0,    0,    0,  768,  768,  768,  768,
+      768,  768,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  787,  770,  770,  770,  770,  770,  770,  771,  771,
+
+      771,  771,  771,  771,  771,  771,  771,  788,  772,  772,
+      772,  772,  772,  772,  773,  773,  773,  773,  773,  773,
+      773,  773,  773,  789,  774,  774,  774,  774,  774,  774,
+        0,  790,    0,  788,  772,  772,  772,  772,  772,  772,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  789,
+      774,  774,  774,  774,  774,  774,  892,  790,  772,  772,
+      772,  772,  772,  772,  772,  772,  772,  775,  775,  775,
+      775,  775,  775,  775,  775,  775,  791,  776,  776,  776,
+      776,  776,  776,  892,    0,  776,  776,  776,  776,  776,
+      776,  776,  776,  776,    0,    0,    0,    0,    0,    0,
+
+      792,    0,  791,  776,  776,  776,  776,  776,  776,  777,
+      777,  777,  777,  777,  777,  777,  777,  777,  778,  779,
+      779,  779,  779,  779,  779,  892,  792,  779,  779,  779,
+      779,  779,  779,  779,  779,  779,  793,  794,  795,    0,
+        0,    0,    0,    0,    0,  779,  779,  779,  779,  779,
+      779,  892,    0,  802,  802,  802,  802,  802,  802,  802,
+      802,  802,  793,  794,  795,  796,  796,  796,  796,  796,
+      796,  796,  796,  796,  808,  796,  796,  796,  796,  796,
+      796,  797,  797,  797,  797,  797,  797,  797,  797,  797,
+      809,  797,  797,  797,  797,  797,  797,    0,    0,    0,
+
+      808,  796,  796,  796,  796,  796,  796,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  809,  797,  797,  797,
+      797,  797,  797,  799,  799,  799,  799,  799,  799,  799,
+      799,  799,  800,  799,  799,  799,  799,  799,  799,  801,
+      801,  801,  801,  801,  801,  801,  801,  801,  814,  802,
+      802,  802,  802,  802,  802,    0,    0,    0,    0,  799,
+      799,  799,  799,  799,  799,    0,    0,    0,    0,    0,
+        0,    0,  815,    0,  814,  802,  802,  802,  802,  802,
+      802,  803,  803,  803,  803,  803,  803,  803,  803,  803,
+      816,  804,  804,  804,  804,  804,  804,  892,  815,  804,
+
+      804,  804,  804,  804,  804,  804,  804,  804,    0,    0,
+        0,    0,    0,    0,    0,    0,  816,  804,  804,  804,
+      804,  804,  804,  805,  805,  805,  805,  805,  805,  805,
+      805,  805,  817,  806,  806,  806,  806,  806,  806,  807,
+      807,  807,  807,  807,  807,  807,  807,  807,  818,  807,
+      807,  807,  807,  807,  807,    0,  819,    0,  817,  806,
+      806,  806,  806,  806,  806,    0,  820,  821,  822,    0,
+        0,    0,    0,    0,  818,  807,  807,  807,  807,  807,
+      807,  892,  819,  806,  806,  806,  806,  806,  806,  806,
+      806,  806,  820,  821,  822,  824,  824,  824,  824,  824,
+
+      824,  824,  824,  824,  832,  824,  824,  824,  824,  824,
+      824,  825,  825,  825,  825,  825,  825,  825,  825,  825,
+      833,  825,  825,  825,  825,  825,  825,    0,    0,    0,
+      832,  824,  824,  824,  824,  824,  824,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  833,  825,  825,  825,
+      825,  825,  825,  826,  826,  826,  826,  826,  826,  826,
+      826,  826,  838,  826,  826,  826,  826,  826,  826,  827,
+      827,  827,  827,  827,  827,  827,  827,  827,  839,  828,
+      828,  828,  828,  828,  828,    0,  840,    0,  838,  826,
+      826,  826,  826,  826,  826,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,  839,  828,  828,  828,  828,  828,
+      828,  892,  840,  828,  828,  828,  828,  828,  828,  828,
+      828,  828,  829,  829,  829,  829,  829,  829,  829,  829,
+      829,  841,  830,  830,  830,  830,  830,  830,  892,    0,
+      830,  830,  830,  830,  830,  830,  830,  830,  830,    0,
+        0,    0,    0,    0,  842,    0,    0,  841,  830,  830,
+      830,  830,  830,  830,  831,  831,  831,  831,  831,  831,
+      831,  831,  831,  850,  831,  831,  831,  831,  831,  831,
+      842,  843,  843,  843,  843,  843,  843,  843,  843,  843,
+        0,  843,  843,  843,  843,  843,  843,    0,    0,  850,
+
+      831,  831,  831,  831,  831,  831,  892,    0,  848,  848,
+      848,  848,  848,  848,  848,  848,  848,  843,  843,  843,
+      843,  843,  843,  844,  844,  844,  844,  844,  844,  844,
+      844,  844,  851,  844,  844,  844,  844,  844,  844,  845,
+      845,  845,  845,  845,  845,  845,  845,  845,  846,  845,
+      845,  845,  845,  845,  845,    0,    0,    0,  851,  844,
+      844,  844,  844,  844,  844,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  845,  845,  845,  845,  845,
+      845,  847,  847,  847,  847,  847,  847,  847,  847,  847,
+      852,  848,  848,  848,  848,  848,  848,  849,  849,  849,
+
+      849,  849,  849,  849,  849,  849,  853,  849,  849,  849,
+      849,  849,  849,    0,    0,    0,  852,  848,  848,  848,
+      848,  848,  848,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  853,  849,  849,  849,  849,  849,  849,  854,
+      854,  854,  854,  854,  854,  854,  854,  854,  858,  854,
+      854,  854,  854,  854,  854,  855,  855,  855,  855,  855,
+      855,  855,  855,  855,  859,  855,  855,  855,  855,  855,
+      855,    0,    0,    0,  858,  854,  854,  854,  854,  854,
+      854,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      859,  855,  855,  855,  855,  855,  855,  856,  856,  856,
+
+      856,  856,  856,  856,  856,  856,  860,  856,  856,  856,
+      856,  856,  856,  857,  857,  857,  857,  857,  857,  857,
+      857,  857,  865,  857,  857,  857,  857,  857,  857,    0,
+        0,    0,  860,  856,  856,  856,  856,  856,  856,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  865,  857,
+      857,  857,  857,  857,  857,  862,  862,  862,  862,  862,
+      862,  862,  862,  862,  866,  862,  862,  862,  862,  862,
+      862,  863,  863,  863,  863,  863,  863,  863,  863,  863,
+      864,  863,  863,  863,  863,  863,  863,  867,    0,    0,
+      866,  862,  862,  862,  862,  862,  862,  871,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,  863,  863,  863,
+      863,  863,  863,  867,  868,  868,  868,  868,  868,  868,
+      868,  868,  868,  871,  868,  868,  868,  868,  868,  868,
+      869,  869,  869,  869,  869,  869,  869,  869,  869,    0,
+      869,  869,  869,  869,  869,  869,    0,    0,    0,    0,
+      868,  868,  868,  868,  868,  868,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  869,  869,  869,  869,
+      869,  869,  870,  870,  870,  870,  870,  870,  870,  870,
+      870,    0,  870,  870,  870,  870,  870,  870,  872,  872,
+      872,  872,  872,  872,  872,  872,  872,    0,  872,  872,
+
+      872,  872,  872,  872,    0,    0,    0,    0,  870,  870,
+      870,  870,  870,  870,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  872,  872,  872,  872,  872,  872,
+      873,  873,  873,  873,  873,  873,  873,  873,  873,    0,
+      873,  873,  873,  873,  873,  873,  874,  874,  874,  874,
+      874,  874,  874,  874,  874,  875,  874,  874,  874,  874,
+      874,  874,    0,    0,    0,    0,  873,  873,  873,  873,
+      873,  873,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  874,  874,  874,  874,  874,  874,  877,  877,
+      877,  877,  877,  877,  877,  877,  877,    0,  877,  877,
+
+      877,  877,  877,  877,  878,  878,  878,  878,  878,  878,
+      878,  878,  878,    0,  878,  878,  878,  878,  878,  878,
+        0,    0,    0,    0,  877,  877,  877,  877,  877,  877,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      878,  878,  878,  878,  878,  878,  879,  879,  879,  879,
+      879,  879,  879,  879,  879,    0,  879,  879,  879,  879,
+      879,  879,  880,  880,  880,  880,  880,  880,  880,  880,
+      880,    0,  880,  880,  880,  880,  880,  880,    0,    0,
+        0,    0,  879,  879,  879,  879,  879,  879,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  880,  880,
+
+      880,  880,  880,  880,  881,  881,  881,  881,  881,  881,
+      881,  881,  881,  882,  881,  881,  881,  881,  881,  881,
+      883,  883,  883,  883,  883,  883,  883,  883,  883,    0,
+      883,  883,  883,  883,  883,  883,    0,    0,    0,    0,
+      881,  881,  881,  881,  881,  881,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  883,  883,  883,  883,
+      883,  883,  884,  884,  884,  884,  884,  884,  884,  884,
+      884,    0,  884,  884,  884,  884,  884,  884,  885,  885,
+      885,  885,  885,  885,  885,  885,  885,    0,  885,  885,
+      885,  885,  885,  885,    0,    0,    0,    0,  884,  884,
+
+      884,  884,  884,  884,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  885,  885,  885,  885,  885,  885,
+      887,  887,  887,  887,  887,  887,  887,  887,  887,    0,
+      887,  887,  887,  887,  887,  887,  888,  888,  888,  888,
+      888,  888,  888,  888,  888,  889,  888,  888,  888,  888,
+      888,  888,    0,    0,    0,    0,  887,  887,  887,  887,
+      887,  887,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  888,  888,  888,  888,  888,  888,  890,  890,
+      890,  890,  890,  890,  890,  890,  890,    0,  890,  890,
+      890,  890,  890,  890,  891,  891,  891,  891,  891,  891,
+
+      891,  891,  891,    0,  891,  891,  891,  891,  891,  891,
+        0,    0,    0,    0,  890,  890,  890,  890,  890,  890,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      891,  891,  891,  891,  891,  891,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    7,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892
     } ;
 
-static yyconst flex_int16_t yy_chk[4017] =
+static yyconst flex_int16_t yy_chk[6032] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1159,451 +1385,674 @@ static yyconst flex_int16_t yy_chk[4017] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,   10,   10,   11,   11,   15,   17,
-       28,  914,   15,   16,   16,   16,   16,   16,   16,   16,
-       16,   16,   16,   16,   16,   16,   16,   16,   16,   25,
-
-       16,   26,   33,   35,   25,   17,   28,   26,   57,   34,
-       39,   39,   25,   34,   40,   40,   16,   41,   41,   16,
-       16,   16,   16,   16,   16,   25,   16,   26,   33,   35,
-       25,  126,  126,   26,   57,   34,  910,  726,   25,   34,
-      726,  908,   16,   19,   19,  904,   19,   19,   19,   19,
-       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+        1,    1,    1,    1,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    7,   10,   10,   11,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       13,   13,   18,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   15,   17,
+       21,   23,   15,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   24,
+       16,   29,   34,   36,   39,   17,   21,   23,   48,   79,
+      118,  130,  132,  132,  134,  144,   16,  168,  170,   16,
+       16,   16,   16,   16,   16,   24,   16,   29,   34,   36,
+
+       19,   19,  175,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   16,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
        19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   20,   22,   20,   26,   59,
+       20,   22,   27,   26,   60,   20,   22,   22,   27,   62,
+       63,   26,   20,   22,  176,  178,  186,  200,  203,  207,
+      208,   20,   22,   20,   26,   59,   20,   22,   27,   26,
+
+       60,   20,   22,   22,   27,   62,   63,   26,   20,   22,
+       25,   25,   25,   25,   25,   25,   25,   25,   25,   25,
+       25,   25,   25,   25,   25,   25,   28,   25,   30,   31,
+      209,   35,   64,   31,   28,   35,  210,   65,  217,   66,
+       28,   67,   30,   31,   70,   28,   25,   25,   25,   25,
+       25,   25,   28,   25,   30,   31,   32,   35,   64,   31,
+       28,   35,   32,   65,   32,   66,   28,   67,   30,   31,
+       70,   28,   71,   32,   33,   33,  222,  253,  268,  272,
+      275,  282,   32,   33,   72,   73,   75,   76,   32,  291,
+       32,   33,  294,  305,  319,  322,  323,  326,   71,   32,
+
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   33,
+       72,   73,   75,   76,  331,   50,   50,   33,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   52,   52,   52,   52,   52,
+       52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+       52,  336,  343,  347,  348,   51,   51,   51,   51,   51,
+       51,  104,  104,  104,  104,  104,  104,  104,  104,  104,
+      354,   52,   52,   52,   52,   52,   52,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   77,   55,   55,   55,
+       55,   55,   55,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   78,   56,   56,   56,   56,   56,   56,  402,
+      403,  406,   77,   55,   55,   55,   55,   55,   55,  407,
+      413,  414,  430,  435,  448,  472,  473,   80,   78,   56,
+
+       56,   56,   56,   56,   56,   58,   58,   58,   58,   58,
+       58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+       58,   68,   69,   80,  484,   81,   69,   83,   84,   86,
+      509,   68,   74,  528,   87,   88,   89,  536,  537,   94,
+       95,   58,   58,   58,   58,   58,   58,   68,   69,   85,
+       74,   81,   69,   83,   84,   86,   85,   68,   74,   85,
+       87,   88,   89,   85,   90,   94,   95,   96,   97,   98,
+      111,  112,  579,  582,  585,   85,   74,  586,  597,  602,
+      618,   90,   85,  630,  637,   85,  638,  646,  666,   85,
+       90,  674,  675,   96,   97,   98,  111,  112,  102,  102,
+
+      102,  102,  102,  102,  102,  102,  102,   90,  102,  102,
+      102,  102,  102,  102,  103,  103,  103,  103,  103,  103,
+      103,  103,  103,  113,  103,  103,  103,  103,  103,  103,
+      683,  703,  705,  706,  102,  102,  102,  102,  102,  102,
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  113,
+      103,  103,  103,  103,  103,  103,  105,  105,  105,  105,
+      105,  105,  105,  105,  105,  105,  105,  105,  105,  105,
+      105,  105,  106,  106,  106,  106,  106,  106,  106,  106,
+      106,  114,  106,  106,  106,  106,  106,  106,  713,  115,
+      714,  721,  105,  105,  105,  105,  105,  105,  160,  160,
+
+      160,  160,  160,  160,  160,  160,  160,  114,  106,  106,
+      106,  106,  106,  106,  108,  115,  108,  108,  108,  108,
+      108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
+      108,  108,  109,  741,  109,  109,  109,  109,  109,  109,
+      109,  109,  109,  742,  755,  767,  769,  775,  116,  117,
+      119,  120,  108,  108,  108,  108,  108,  108,  110,  110,
+      110,  110,  110,  110,  110,  110,  110,  121,  110,  110,
+      110,  110,  110,  110,  116,  117,  119,  120,  122,  123,
+      124,  125,  126,  127,  128,  129,  131,  133,  135,  136,
+      137,  138,  139,  121,  110,  110,  110,  110,  110,  110,
+
+      140,  141,  142,  143,  122,  123,  124,  125,  126,  127,
+      128,  129,  131,  133,  135,  136,  137,  138,  139,  145,
+      146,  147,  148,  149,  150,  151,  140,  141,  142,  143,
+      152,  159,  776,  159,  159,  159,  159,  159,  159,  159,
+      159,  159,  784,  785,  796,  145,  146,  147,  148,  149,
+      150,  151,  783,  801,  802,  783,  152,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  167,  153,  153,  153,
+      153,  153,  153,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  169,  155,  155,  155,  155,  155,  155,  810,
+      811,  812,  167,  153,  153,  153,  153,  153,  153,  754,
+
+      754,  754,  813,  754,  824,  829,  830,  165,  169,  155,
+      155,  155,  155,  155,  155,  156,  156,  156,  156,  156,
+      156,  156,  156,  156,  165,  156,  156,  156,  156,  156,
+      156,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+      171,  157,  157,  157,  157,  157,  157,  844,  172,  847,
+      165,  156,  156,  156,  156,  156,  156,  213,  213,  213,
+      213,  213,  213,  213,  213,  213,  171,  157,  157,  157,
+      157,  157,  157,  158,  172,  158,  158,  158,  158,  158,
+      158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+      158,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+
+      173,  161,  161,  161,  161,  161,  161,  854,  862,  872,
+      873,  158,  158,  158,  158,  158,  158,  880,  883,  886,
+      887,  891,    0,    0,  174,    0,  173,  161,  161,  161,
+      161,  161,  161,  162,  162,  162,  162,  162,  162,  162,
+      162,  162,  177,  162,  162,  162,  162,  162,  162,  163,
+      174,  163,  163,  163,  163,  163,  163,  163,  163,  163,
+        0,    0,    0,    0,    0,  180,  181,  182,  177,  162,
+      162,  162,  162,  162,  162,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  183,  164,  164,  164,  164,  164,
+      164,  180,  181,  182,  184,  188,  189,  190,  192,  193,
+
+      194,  195,  187,  184,  184,  184,    0,  196,  197,  198,
+      183,  164,  164,  164,  164,  164,  164,  187,  201,  204,
+      184,  188,  189,  190,  192,  193,  194,  195,  187,  184,
+      184,  184,  191,  196,  197,  198,  191,  199,  202,  205,
+      206,  223,  224,  187,  201,  204,  225,  226,  227,  202,
+      229,  226,  199,    0,    0,    0,    0,    0,  191,    0,
+        0,    0,  191,  199,  202,  205,  206,  223,  224,    0,
+        0,    0,  225,  226,  227,  202,  229,  226,  199,  211,
+      211,  211,  211,  211,  211,  211,  211,  211,  230,  211,
+      211,  211,  211,  211,  211,  212,  212,  212,  212,  212,
 
-       19,   19,   19,   19,   19,   19,   19,   19,   20,  898,
-       20,   58,   22,   29,   22,   60,   27,   61,   20,   30,
-       62,   63,   22,   30,   27,   20,  892,   29,  891,   22,
-       27,  888,   22,   30,   20,   27,   20,   58,   22,   29,
-       22,   60,   27,   61,   20,   30,   62,   63,   22,   30,
-       27,   20,   21,   29,   21,   22,   27,   21,   22,   30,
-       64,   27,   21,   21,   23,   65,   23,   66,   67,   21,
-       68,   69,   70,   72,   23,   65,   73,   23,   21,   74,
-       21,   23,  884,   21,  883,  879,   64,  875,   21,   21,
-       23,   65,   23,   66,   67,   21,   68,   69,   70,   72,
-
-       23,   65,   73,   23,  838,   74,  829,   23,   24,   24,
-       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
-       24,   24,   24,   24,   31,   24,   32,   32,   75,   77,
-       31,   24,   31,   78,  828,   32,   80,   81,   24,   83,
-       84,   31,   71,   32,   24,   24,   24,   24,   24,   24,
-       31,   24,  826,  825,   75,   77,   31,   24,   31,   78,
-       71,   32,   80,   81,   24,   83,   84,   31,   71,   32,
-       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
-       49,   49,   49,   49,   49,   49,   71,   49,   51,   51,
-       51,   51,   51,   51,   51,   51,   51,   85,  699,  699,
-
-      699,  824,  699,  823,   86,   91,   49,   49,   49,   49,
-       49,   49,   92,   49,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   85,   54,   54,   54,   54,   54,   54,
-       86,   91,  822,  821,  819,  818,  816,  815,   92,  100,
-      100,  100,  100,  100,  100,  100,  100,  100,  814,   93,
-       54,   54,   54,   54,   54,   54,   56,   56,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
-       56,   56,   82,   56,   87,   93,   94,   95,  107,   82,
-      108,  109,   82,  110,  111,  112,   82,  114,  115,  116,
-      117,   87,   56,   56,   56,   56,   56,   56,   82,   56,
-
-       87,  812,   94,   95,  107,   82,  108,  109,   82,  110,
-      111,  112,   82,  114,  115,  116,  117,   87,   98,   98,
-       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
-       98,   98,   98,   98,  105,   98,  105,  105,  105,  105,
-      105,  105,  105,  105,  105,  118,  811,  810,  808,  807,
-      806,  801,  119,  120,   98,   98,   98,   98,   98,   98,
-      121,   98,  102,  102,  102,  102,  102,  102,  102,  102,
-      102,  118,  102,  102,  102,  102,  102,  102,  119,  120,
-      800,  799,  794,  793,  792,  783,  121,  148,  148,  148,
-      148,  148,  148,  148,  148,  148,  122,  123,  102,  102,
-
-      102,  102,  102,  102,  104,  125,  104,  104,  104,  104,
-      104,  104,  104,  104,  104,  104,  104,  104,  104,  104,
-      104,  104,  122,  123,  782,  781,  769,  765,  764,  763,
-      762,  125,  754,  753,  752,  751,  743,  740,  127,  129,
-      130,  131,  104,  104,  104,  104,  104,  104,  106,  106,
-      106,  106,  106,  106,  106,  106,  106,  106,  106,  106,
-      106,  106,  106,  106,  127,  129,  130,  131,  132,  133,
-      134,  135,  136,  137,  139,  140,  141,  142,  143,  144,
-      145,  146,  738,  737,  106,  106,  106,  106,  106,  106,
-      728,  727,  719,  713,  132,  133,  134,  135,  136,  137,
-
-      139,  140,  141,  142,  143,  144,  145,  146,  147,  147,
-      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
-      147,  147,  147,  147,  153,  147,  153,  153,  153,  153,
-      153,  153,  153,  153,  153,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  147,  147,  147,  147,  147,  147,
-      712,  147,  152,  711,  152,  152,  152,  152,  152,  152,
-      152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
-      157,  159,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  710,  709,  700,  688,  685,  684,  683,  159,  161,
-      152,  152,  152,  152,  152,  152,  155,  164,  155,  155,
-
-      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
-      155,  155,  155,  155,  159,  161,  670,  664,  658,  657,
-      656,  655,  653,  164,  638,  630,  628,  627,  626,  599,
-      165,  166,  167,  169,  155,  155,  155,  155,  155,  155,
-      156,  156,  156,  156,  156,  156,  156,  156,  156,  172,
-      156,  156,  156,  156,  156,  156,  165,  166,  167,  169,
-      593,  592,  591,  590,  583,  173,  568,  564,  553,  551,
-      550,  549,  174,  175,  546,  172,  156,  156,  156,  156,
-      156,  156,  158,  158,  158,  158,  158,  158,  158,  158,
-      158,  173,  158,  158,  158,  158,  158,  158,  174,  175,
-
-      176,  179,  180,  181,  182,  184,  185,  186,  183,  176,
-      176,  176,  183,  187,  188,  189,  179,  190,  158,  158,
-      158,  158,  158,  158,  193,  196,  176,  179,  180,  181,
-      182,  184,  185,  186,  183,  176,  176,  176,  183,  187,
-      188,  189,  179,  190,  191,  194,  197,  198,  215,  216,
-      193,  196,  217,  218,  219,  220,  194,  218,  219,  191,
-      200,  200,  200,  200,  200,  200,  200,  200,  200,  200,
-      191,  194,  197,  198,  215,  216,  510,  503,  217,  218,
-      219,  220,  194,  218,  219,  191,  205,  205,  205,  205,
-      205,  205,  205,  205,  205,  206,  502,  206,  206,  206,
-
-      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
-      206,  206,  206,  208,  501,  208,  208,  208,  208,  208,
-      208,  208,  208,  208,  500,  486,  463,  452,  449,  448,
-      221,  447,  431,  206,  206,  206,  206,  206,  206,  207,
-      207,  207,  207,  207,  207,  207,  207,  207,  222,  207,
-      207,  207,  207,  207,  207,  209,  221,  209,  209,  209,
-      209,  209,  209,  209,  209,  209,  418,  414,  399,  390,
-      389,  388,  387,  342,  222,  207,  207,  207,  207,  207,
-      207,  210,  331,  210,  210,  210,  210,  210,  210,  210,
-      210,  210,  210,  210,  210,  210,  210,  210,  210,  211,
-
-      223,  211,  211,  211,  211,  211,  211,  211,  211,  211,
-      328,  327,  326,  324,  319,  311,  310,  307,  225,  210,
-      210,  210,  210,  210,  210,  212,  223,  212,  212,  212,
       212,  212,  212,  212,  212,  212,  212,  212,  212,  212,
-      212,  212,  212,  213,  225,  213,  213,  213,  213,  213,
-      213,  213,  213,  213,  224,  226,  228,  229,  230,  231,
-      232,  224,  233,  212,  212,  212,  212,  212,  212,  224,
-      234,  236,  237,  238,  235,  239,  240,  241,  242,  244,
-      224,  226,  228,  229,  230,  231,  232,  224,  233,  235,
-      245,  246,  247,  248,  249,  224,  234,  236,  237,  238,
-
-      235,  239,  240,  241,  242,  244,  250,  251,  252,  253,
-      254,  255,  256,  257,  259,  235,  245,  246,  247,  248,
-      249,  260,  270,  270,  270,  270,  270,  270,  270,  270,
-      270,  293,  250,  251,  252,  253,  254,  255,  256,  257,
-      259,  283,  272,  264,  263,  262,  265,  260,  265,  265,
-      265,  265,  265,  265,  265,  265,  265,  266,  261,  266,
-      266,  266,  266,  266,  266,  266,  266,  266,  266,  266,
-      266,  266,  266,  266,  266,  267,  276,  267,  267,  267,
-      267,  267,  267,  267,  267,  267,  258,  243,  214,  204,
-      203,  202,  201,  199,  277,  266,  266,  266,  266,  266,
-
-      266,  268,  276,  268,  268,  268,  268,  268,  268,  268,
-      268,  268,  268,  268,  268,  268,  268,  268,  268,  269,
-      277,  269,  269,  269,  269,  269,  269,  269,  269,  269,
-      195,  192,  278,  178,  170,  168,  163,  162,  151,  268,
-      268,  268,  268,  268,  268,  271,  150,  271,  271,  271,
-      271,  271,  271,  271,  271,  271,  271,  273,  278,  273,
-      273,  273,  273,  273,  273,  273,  273,  273,  273,  273,
-      273,  273,  273,  273,  273,  275,  149,  275,  275,  275,
-      275,  275,  275,  275,  275,  275,  138,  128,  124,  113,
-      101,  279,  280,  281,  282,  273,  273,  273,  273,  273,
-
-      273,  274,  274,  274,  274,  274,  274,  274,  274,  274,
-      284,  274,  274,  274,  274,  274,  274,  279,  280,  281,
-      282,  286,  287,  288,  289,  290,  292,  294,  295,  296,
-      297,  298,  299,  300,  301,  302,  284,  274,  274,  274,
-      274,  274,  274,  303,  304,  308,  309,  286,  287,  288,
-      289,  290,  292,  294,  295,  296,  297,  298,  299,  300,
-      301,  302,  306,  312,  313,  315,  316,  317,  318,  303,
-      304,  308,  309,  321,  322,  306,  323,  325,  329,  329,
-      329,  329,  329,  329,  329,  329,  329,   99,  306,  312,
-      313,  315,  316,  317,  318,   76,   50,   46,   45,  321,
-
-      322,  306,  323,  325,  330,   42,  330,  330,  330,  330,
-      330,  330,  330,  330,  330,  330,  332,   37,  332,  332,
-      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
-      332,  332,  332,  332,  334,   18,  334,  334,  334,  334,
-      334,  334,  334,  334,  334,   14,   12,    7,    4,    3,
-        0,  341,    0,    0,  332,  332,  332,  332,  332,  332,
-      333,  333,  333,  333,  333,  333,  333,  333,  333,  343,
-      333,  333,  333,  333,  333,  333,  335,  341,  335,  335,
-      335,  335,  335,  335,  335,  335,  335,    0,  344,    0,
-        0,    0,    0,    0,    0,  343,  333,  333,  333,  333,
-
-      333,  333,  336,    0,  336,  336,  336,  336,  336,  336,
-      336,  336,  336,  337,  344,  337,  337,  337,  337,  337,
-      337,  337,  337,  337,  337,  337,  337,  337,  337,  337,
-      337,  338,  345,  338,  338,  338,  338,  338,  338,  338,
-      338,  338,    0,    0,    0,    0,    0,    0,    0,    0,
-      346,  337,  337,  337,  337,  337,  337,  339,  345,  339,
-      339,  339,  339,  339,  339,  339,  339,  339,  339,  339,
-      339,  339,  339,  339,  339,  340,  346,  340,  340,  340,
-      340,  340,  340,  340,  340,  340,  347,  349,  350,  352,
-      353,  354,  355,  356,  357,  339,  339,  339,  339,  339,
-
-      339,  348,  358,  359,  360,  361,  362,  348,  363,  348,
-      364,  365,  347,  349,  350,  352,  353,  354,  355,  356,
-      357,  366,  367,  368,  369,  370,  371,  348,  358,  359,
-      360,  361,  362,  348,  363,  348,  364,  365,  372,  373,
-      374,  377,  378,  379,  380,  381,  382,  366,  367,  368,
-      369,  370,  371,  384,  385,  386,    0,  403,    0,    0,
-        0,    0,    0,    0,  372,  373,  374,  377,  378,  379,
-      380,  381,  382,    0,    0,    0,    0,    0,    0,  384,
-      385,  386,  391,  403,  391,  391,  391,  391,  391,  391,
-      391,  391,  391,  392,    0,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  393,    0,  393,  393,  393,  393,
-      393,  393,  393,  393,  393,  393,  393,  393,  393,  393,
-      393,  393,  394,  404,  394,  394,  394,  394,  394,  394,
-      394,  394,  394,  397,  397,  397,  397,  397,  397,  397,
-      397,  397,  393,  393,  393,  393,  393,  393,  395,  404,
-      395,  395,  395,  395,  395,  395,  395,  395,  395,  395,
-      395,  395,  395,  395,  395,  395,  396,  405,  396,  396,
-      396,  396,  396,  396,  396,  396,  396,    0,    0,  406,
-        0,    0,    0,    0,    0,    0,  395,  395,  395,  395,
-      395,  395,  398,  405,  398,  398,  398,  398,  398,  398,
-
-      398,  398,  398,  398,  400,  406,  400,  400,  400,  400,
-      400,  400,  400,  400,  400,  400,  400,  400,  400,  400,
-      400,  400,  402,    0,  402,  402,  402,  402,  402,  402,
-      402,  402,  402,    0,    0,    0,    0,    0,  407,  408,
-      409,  410,  400,  400,  400,  400,  400,  400,  401,  401,
-      401,  401,  401,  401,  401,  401,  401,  411,  401,  401,
-      401,  401,  401,  401,  407,  408,  409,  410,  412,  413,
-      416,  417,  419,  421,  422,  425,  426,  427,  428,  429,
-      430,  432,  433,  411,  401,  401,  401,  401,  401,  401,
-      434,  435,  436,  437,  412,  413,  416,  417,  419,  421,
-
-      422,  425,  426,  427,  428,  429,  430,  432,  433,  438,
-      439,  440,  441,  442,  443,  444,  434,  435,  436,  437,
-      445,  450,  450,  450,  450,  450,  450,  450,  450,  450,
-        0,    0,  461,    0,    0,  438,  439,  440,  441,  442,
-      443,  444,    0,    0,    0,  451,  445,  451,  451,  451,
-      451,  451,  451,  451,  451,  451,  451,  453,  461,  453,
-      453,  453,  453,  453,  453,  453,  453,  453,  453,  453,
-      453,  453,  453,  453,  453,  455,    0,  455,  455,  455,
-      455,  455,  455,  455,  455,  455,  456,  456,  456,  456,
-      456,  456,  456,  456,  456,  453,  453,  453,  453,  453,
-
-      453,  454,  454,  454,  454,  454,  454,  454,  454,  454,
-      462,  454,  454,  454,  454,  454,  454,  458,  464,  458,
-      458,  458,  458,  458,  458,  458,  458,  458,    0,    0,
-        0,    0,    0,    0,    0,    0,  462,  454,  454,  454,
-      454,  454,  454,  457,  464,  457,  457,  457,  457,  457,
-      457,  457,  457,  457,  457,  457,  457,  457,  457,  457,
-      457,  460,  465,  460,  460,  460,  460,  460,  460,  460,
-      460,  460,    0,    0,    0,    0,    0,    0,    0,  466,
-      467,  457,  457,  457,  457,  457,  457,  459,  465,  459,
-      459,  459,  459,  459,  459,  459,  459,  459,  459,  459,
-
-      459,  459,  459,  459,  459,  466,  467,  468,  469,  470,
-      471,  472,  474,  475,  476,  477,  479,  480,  481,  482,
-      484,  487,  488,  489,  485,  459,  459,  459,  459,  459,
-      459,  485,  490,  468,  469,  470,  471,  472,  474,  475,
-      476,  477,  479,  480,  481,  482,  484,  487,  488,  489,
-      485,  491,  492,  493,  494,  496,  498,  485,  490,  499,
-      504,  504,  504,  504,  504,  504,  504,  504,  504,    0,
-        0,    0,    0,    0,    0,    0,    0,  491,  492,  493,
-      494,  496,  498,    0,    0,  499,  505,    0,  505,  505,
-      505,  505,  505,  505,  505,  505,  505,  505,  505,  505,
-
-      505,  505,  505,  505,  506,  514,  506,  506,  506,  506,
-      506,  506,  506,  506,  506,    0,    0,    0,    0,    0,
-        0,    0,    0,  515,  505,  505,  505,  505,  505,  505,
-      507,  514,  507,  507,  507,  507,  507,  507,  507,  507,
-      507,  507,  507,  507,  507,  507,  507,  507,  508,  515,
-      508,  508,  508,  508,  508,  508,  508,  508,  508,    0,
-        0,  516,    0,    0,    0,    0,    0,    0,  507,  507,
-      507,  507,  507,  507,  509,    0,  509,  509,  509,  509,
-      509,  509,  509,  509,  509,  509,  511,  516,  511,  511,
-      511,  511,  511,  511,  511,  511,  511,  511,  511,  511,
-
-      511,  511,  511,  511,  513,    0,  513,  513,  513,  513,
-      513,  513,  513,  513,  513,    0,    0,    0,    0,    0,
-      517,  518,  519,  520,  511,  511,  511,  511,  511,  511,
-      512,  512,  512,  512,  512,  512,  512,  512,  512,  521,
-      512,  512,  512,  512,  512,  512,  517,  518,  519,  520,
-      522,  523,  525,  526,  527,  528,  530,  531,  535,  536,
-        0,  538,  539,  540,  541,  521,  512,  512,  512,  512,
-      512,  512,  542,  545,  547,  548,  522,  523,  525,  526,
-      527,  528,  530,  531,  535,  536,  537,  538,  539,  540,
-      541,  562,    0,  537,    0,    0,    0,    0,  542,  545,
-
-      547,  548,    0,    0,    0,  563,    0,    0,    0,    0,
-        0,    0,  537,    0,    0,    0,    0,  562,  552,  537,
-      552,  552,  552,  552,  552,  552,  552,  552,  552,  552,
-      554,  563,  554,  554,  554,  554,  554,  554,  554,  554,
-      554,  554,  554,  554,  554,  554,  554,  554,  556,    0,
-      556,  556,  556,  556,  556,  556,  556,  556,  556,    0,
-        0,    0,    0,    0,    0,  565,    0,    0,  554,  554,
-      554,  554,  554,  554,  555,  555,  555,  555,  555,  555,
-      555,  555,  555,  566,  555,  555,  555,  555,  555,  555,
-      558,  565,  558,  558,  558,  558,  558,  558,  558,  558,
-
-      558,    0,    0,    0,    0,    0,    0,    0,    0,  566,
-      555,  555,  555,  555,  555,  555,  557,    0,  557,  557,
-      557,  557,  557,  557,  557,  557,  557,  557,  557,  557,
-      557,  557,  557,  557,  560,  567,  560,  560,  560,  560,
-      560,  560,  560,  560,  560,    0,    0,    0,    0,    0,
-        0,    0,  570,  571,  557,  557,  557,  557,  557,  557,
-      559,  567,  559,  559,  559,  559,  559,  559,  559,  559,
-      559,  559,  559,  559,  559,  559,  559,  559,  570,  571,
-      572,  573,  577,  578,  579,  580,  581,  582,  584,  585,
-      586,  587,  588,    0,  604,    0,    0,    0,  559,  559,
-
-      559,  559,  559,  559,    0,    0,  572,  573,  577,  578,
-      579,  580,  581,  582,  584,  585,  586,  587,  588,  594,
-      604,  594,  594,  594,  594,  594,  594,  594,  594,  594,
-      594,  594,  594,  594,  594,  594,  594,  595,  605,  595,
-      595,  595,  595,  595,  595,  595,  595,  595,    0,    0,
-        0,    0,    0,    0,    0,    0,  607,  594,  594,  594,
-      594,  594,  594,  596,  605,  596,  596,  596,  596,  596,
-      596,  596,  596,  596,  596,  596,  596,  596,  596,  596,
-      596,  597,  607,  597,  597,  597,  597,  597,  597,  597,
-      597,  597,    0,    0,  611,    0,    0,    0,    0,    0,
-
-        0,  596,  596,  596,  596,  596,  596,  598,    0,  598,
-      598,  598,  598,  598,  598,  598,  598,  598,  598,  600,
-      611,  600,  600,  600,  600,  600,  600,  600,  600,  600,
-      600,  600,  600,  600,  600,  600,  600,  602,    0,  602,
-      602,  602,  602,  602,  602,  602,  602,  602,    0,    0,
-        0,    0,    0,    0,  613,  614,  615,  600,  600,  600,
-      600,  600,  600,  601,  601,  601,  601,  601,  601,  601,
-      601,  601,  616,  601,  601,  601,  601,  601,  601,  609,
-      613,  614,  615,  617,  618,  609,  620,  621,  622,  624,
-      625,    0,  639,    0,    0,    0,    0,    0,  616,  601,
-
-      601,  601,  601,  601,  601,  609,    0,    0,    0,  617,
-      618,  609,  620,  621,  622,  624,  625,  629,  639,  629,
-      629,  629,  629,  629,  629,  629,  629,  629,  629,  631,
-        0,  631,  631,  631,  631,  631,  631,  631,  631,  631,
-      631,  631,  631,  631,  631,  631,  631,  633,    0,  633,
-      633,  633,  633,  633,  633,  633,  633,  633,    0,    0,
-        0,    0,    0,    0,  641,    0,    0,  631,  631,  631,
-      631,  631,  631,  632,  632,  632,  632,  632,  632,  632,
-      632,  632,  642,  632,  632,  632,  632,  632,  632,  635,
-      641,  635,  635,  635,  635,  635,  635,  635,  635,  635,
-
-        0,    0,    0,    0,    0,    0,    0,    0,  642,  632,
-      632,  632,  632,  632,  632,  634,    0,  634,  634,  634,
-      634,  634,  634,  634,  634,  634,  634,  634,  634,  634,
-      634,  634,  634,  637,  643,  637,  637,  637,  637,  637,
-      637,  637,  637,  637,    0,    0,    0,    0,    0,    0,
-        0,  645,  646,  634,  634,  634,  634,  634,  634,  636,
-      643,  636,  636,  636,  636,  636,  636,  636,  636,  636,
-      636,  636,  636,  636,  636,  636,  636,  645,  646,  647,
-      648,  649,  650,  651,  652,  654,  660,  668,  660,  660,
-      660,  660,  660,  660,  660,  660,  660,  636,  636,  636,
-
-      636,  636,  636,    0,    0,  647,  648,  649,  650,  651,
-      652,  654,  659,  668,  659,  659,  659,  659,  659,  659,
-      659,  659,  659,  659,  659,  659,  659,  659,  659,  659,
-      662,  669,  662,  662,  662,  662,  662,  662,  662,  662,
-      662,    0,    0,    0,    0,    0,    0,    0,    0,  671,
-      659,  659,  659,  659,  659,  659,  661,  669,  661,  661,
-      661,  661,  661,  661,  661,  661,  661,  661,  661,  661,
-      661,  661,  661,  661,  663,  671,  663,  663,  663,  663,
-      663,  663,  663,  663,  663,  663,    0,    0,    0,    0,
-        0,    0,    0,  672,  661,  661,  661,  661,  661,  661,
-
-      665,    0,  665,  665,  665,  665,  665,  665,  665,  665,
-      665,  665,  665,  665,  665,  665,  665,  665,  667,  672,
-      667,  667,  667,  667,  667,  667,  667,  667,  667,    0,
-        0,    0,    0,    0,  673,  674,  675,  676,  665,  665,
-      665,  665,  665,  665,  666,  666,  666,  666,  666,  666,
-      666,  666,  666,  677,  666,  666,  666,  666,  666,  666,
-      673,  674,  675,  676,  678,  680,  681,  687,  696,  687,
-      687,  687,  687,  687,  687,  687,  687,  687,  687,  677,
-      666,  666,  666,  666,  666,  666,  697,    0,    0,    0,
-      678,  680,  681,  689,  696,  689,  689,  689,  689,  689,
-
-      689,  689,  689,  689,  689,  689,  689,  689,  689,  689,
-      689,  691,  697,  691,  691,  691,  691,  691,  691,  691,
-      691,  691,    0,    0,    0,    0,    0,    0,  701,    0,
-        0,  689,  689,  689,  689,  689,  689,  690,  690,  690,
-      690,  690,  690,  690,  690,  690,  702,  690,  690,  690,
-      690,  690,  690,  693,  701,  693,  693,  693,  693,  693,
-      693,  693,  693,  693,    0,    0,    0,    0,    0,    0,
-        0,    0,  702,  690,  690,  690,  690,  690,  690,  692,
-        0,  692,  692,  692,  692,  692,  692,  692,  692,  692,
-      692,  692,  692,  692,  692,  692,  692,  695,  703,  695,
-
-      695,  695,  695,  695,  695,  695,  695,  695,    0,    0,
-        0,    0,    0,    0,    0,  704,  705,  692,  692,  692,
-      692,  692,  692,  694,  703,  694,  694,  694,  694,  694,
-      694,  694,  694,  694,  694,  694,  694,  694,  694,  694,
-      694,  704,  705,  706,  708,  715,  723,  715,  715,  715,
-      715,  715,  715,  715,  715,  715,    0,    0,    0,    0,
-        0,  694,  694,  694,  694,  694,  694,    0,    0,  706,
-      708,  714,  723,  714,  714,  714,  714,  714,  714,  714,
-      714,  714,  714,  714,  714,  714,  714,  714,  714,  717,
-      724,  717,  717,  717,  717,  717,  717,  717,  717,  717,
-
-      729,    0,    0,    0,    0,    0,    0,    0,  730,  714,
-      714,  714,  714,  714,  714,  716,  724,  716,  716,  716,
-      716,  716,  716,  716,  716,  716,  729,  716,  716,  716,
-      716,  716,  716,  718,  730,  718,  718,  718,  718,  718,
-      718,  718,  718,  718,  718,    0,    0,    0,    0,    0,
-        0,    0,  732,  716,  716,  716,  716,  716,  716,  720,
-        0,  720,  720,  720,  720,  720,  720,  720,  720,  720,
-      720,  720,  720,  720,  720,  720,  720,  722,  732,  722,
-      722,  722,  722,  722,  722,  722,  722,  722,  733,  734,
-      735,  736,    0,  749,    0,    0,    0,  720,  720,  720,
-
-      720,  720,  720,  745,    0,  745,  745,  745,  745,  745,
-      745,  745,  745,  745,  733,  734,  735,  736,  742,  749,
-      742,  742,  742,  742,  742,  742,  742,  742,  742,  742,
-      744,    0,  744,  744,  744,  744,  744,  744,  744,  744,
-      744,  750,  744,  744,  744,  744,  744,  744,  747,  755,
-      747,  747,  747,  747,  747,  747,  747,  747,  747,    0,
-        0,    0,    0,    0,    0,    0,  757,  750,  744,  744,
-      744,  744,  744,  744,  746,  755,  746,  746,  746,  746,
-      746,  746,  746,  746,  746,  746,  746,  746,  746,  746,
-      746,  746,  757,  760,  761,  767,  771,  767,  767,  767,
-
-      767,  767,  767,  767,  767,  767,  772,    0,    0,    0,
-        0,    0,  746,  746,  746,  746,  746,  746,    0,  760,
-      761,  766,  771,  766,  766,  766,  766,  766,  766,  766,
-      766,  766,  772,  766,  766,  766,  766,  766,  766,  768,
-      777,  768,  768,  768,  768,  768,  768,  768,  768,  768,
-      768,  780,  788,  790,  791,  796,  797,  798,  804,  766,
-      766,  766,  766,  766,  766,  785,  777,  785,  785,  785,
-      785,  785,  785,  785,  785,  785,    0,  780,  788,  790,
-      791,  796,  797,  798,  804,  831,  831,  831,  831,  832,
-      832,  832,  832,  833,  833,  833,  833,  834,    0,  834,
-
-      834,  835,  835,  835,  835,  836,    0,  836,  836,  837,
-      837,  839,  839,  840,  840,  841,  841,  842,  842,  843,
-      843,  844,  844,  845,  845,  846,  846,  847,  847,  848,
-      848,  849,  849,  850,  850,  851,  851,  852,  852,  853,
-      853,  854,  854,  855,  855,  856,  856,  857,  857,  858,
-      858,  859,  859,  860,  860,  861,  861,  862,  862,  863,
-      863,  864,  864,  865,  865,  866,  866,  867,  867,  868,
-      868,  869,  869,  870,  870,  871,  871,  872,  872,  873,
-      873,  874,  874,  876,  876,  877,  877,  878,  878,  880,
-      880,  881,  881,  882,  882,  885,  885,  886,  886,  887,
-
-      887,  889,  889,  890,  890,  893,  893,  894,  894,  895,
-      895,  896,  896,  897,  897,  899,  899,  900,  900,  901,
-      901,  902,  902,  903,  903,  905,  905,  906,  906,  907,
-      907,  909,  909,  911,  911,  912,  912,  913,  913,  915,
-      915,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-
-      830,  830,  830,  830,  830,  830,  830,  830,  830,  830,
-      830,  830,  830,  830,  830,  830
+      212,    0,    0,    0,  230,  211,  211,  211,  211,  211,
+      211,  280,  280,  280,  280,  280,  280,  280,  280,  280,
+        0,  212,  212,  212,  212,  212,  212,  214,  214,  214,
+      214,  214,  214,  214,  214,  214,  231,  214,  214,  214,
+      214,  214,  214,  215,  215,  215,  215,  215,  215,  215,
+      215,  215,  232,  215,  215,  215,  215,  215,  215,    0,
+      234,    0,  231,  214,  214,  214,  214,  214,  214,  341,
+      341,  341,  341,  341,  341,  341,  341,  341,  232,  215,
+      215,  215,  215,  215,  215,  216,  234,  216,  216,  216,
+
+      216,  216,  216,  216,  216,  216,  218,  218,  218,  218,
+      218,  218,  218,  218,  218,  235,  218,  218,  218,  218,
+      218,  218,  219,    0,  219,  219,  219,  219,  219,  219,
+      219,  219,  219,    0,    0,    0,    0,    0,    0,  236,
+        0,  235,  218,  218,  218,  218,  218,  218,  220,  220,
+      220,  220,  220,  220,  220,  220,  220,  220,  220,  220,
+      220,  220,  220,  220,  221,  236,  221,  221,  221,  221,
+      221,  221,  221,  221,  221,  228,  233,  238,  239,  228,
+      240,  241,  242,  233,  220,  220,  220,  220,  220,  220,
+      243,  233,  244,  246,  247,  245,  248,  249,  250,  251,
+
+      252,  228,  233,  238,  239,  228,  240,  241,  242,  233,
+      245,  254,  255,  256,  257,  258,  243,  233,  244,  246,
+      247,  245,  248,  249,  250,  251,  252,  259,  260,  261,
+      262,  263,  264,  265,  266,  267,  245,  254,  255,  256,
+      257,  258,  269,  270,  412,  412,  412,  412,  412,  412,
+      412,  412,  412,  259,  260,  261,  262,  263,  264,  265,
+      266,  267,    0,    0,    0,    0,    0,    0,  269,  270,
+      271,  271,  271,  271,  271,  271,  271,  271,  271,  286,
+      271,  271,  271,  271,  271,  271,  273,  273,  273,  273,
+      273,  273,  273,  273,  273,  287,  273,  273,  273,  273,
+
+      273,  273,    0,    0,    0,  286,  271,  271,  271,  271,
+      271,  271,  471,  471,  471,  471,  471,  471,  471,  471,
+      471,  287,  273,  273,  273,  273,  273,  273,  274,  274,
+      274,  274,  274,  274,  274,  274,  274,  288,  274,  274,
+      274,  274,  274,  274,  276,  276,  276,  276,  276,  276,
+      276,  276,  276,  289,  276,  276,  276,  276,  276,  276,
+        0,  290,    0,  288,  274,  274,  274,  274,  274,  274,
+      889,  889,  889,  889,  889,  889,  889,  889,  889,  289,
+      276,  276,  276,  276,  276,  276,  277,  290,  277,  277,
+      277,  277,  277,  277,  277,  277,  277,  278,  278,  278,
+
+      278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+      278,  278,  278,  279,  292,  279,  279,  279,  279,  279,
+      279,  279,  279,  279,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  278,  278,  278,  278,  278,  278,  281,
+      292,  281,  281,  281,  281,  281,  281,  281,  281,  281,
+      281,  283,  283,  283,  283,  283,  283,  283,  283,  283,
+      293,  283,  283,  283,  283,  283,  283,  284,  284,  284,
+      284,  284,  284,  284,  284,  284,  295,  284,  284,  284,
+      284,  284,  284,    0,  297,    0,  293,  283,  283,  283,
+      283,  283,  283,    0,  298,  299,  300,  301,  302,  304,
+
+      306,  307,  295,  284,  284,  284,  284,  284,  284,  285,
+      297,  285,  285,  285,  285,  285,  285,  285,  285,  285,
+      298,  299,  300,  301,  302,  304,  306,  307,  308,  309,
+      310,  311,  312,  313,  314,  315,  316,  318,  320,  321,
+      324,  325,  327,  328,  329,  330,  333,  334,  335,  337,
+      318,    0,    0,    0,  308,  309,  310,  311,  312,  313,
+      314,  315,  316,  318,  320,  321,  324,  325,  327,  328,
+      329,  330,  333,  334,  335,  337,  318,  338,  338,  338,
+      338,  338,  338,  338,  338,  338,  353,  338,  338,  338,
+      338,  338,  338,  339,  339,  339,  339,  339,  339,  339,
+
+      339,  339,  355,  339,  339,  339,  339,  339,  339,    0,
+        0,    0,  353,  338,  338,  338,  338,  338,  338,    0,
+        0,    0,    0,    0,    0,    0,  356,    0,  355,  339,
+      339,  339,  339,  339,  339,  340,  340,  340,  340,  340,
+      340,  340,  340,  340,  340,  340,  340,  340,  340,  340,
+      340,  342,  356,  342,  342,  342,  342,  342,  342,  342,
+      342,  342,  342,    0,    0,    0,    0,    0,    0,    0,
+        0,  340,  340,  340,  340,  340,  340,  344,  344,  344,
+      344,  344,  344,  344,  344,  344,  357,  344,  344,  344,
+      344,  344,  344,  345,  345,  345,  345,  345,  345,  345,
+
+      345,  345,  358,  345,  345,  345,  345,  345,  345,    0,
+      359,    0,  357,  344,  344,  344,  344,  344,  344,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  358,  345,
+      345,  345,  345,  345,  345,  346,  359,  346,  346,  346,
+      346,  346,  346,  346,  346,  346,  349,  349,  349,  349,
+      349,  349,  349,  349,  349,  360,  349,  349,  349,  349,
+      349,  349,  350,    0,  350,  350,  350,  350,  350,  350,
+      350,  350,  350,    0,    0,    0,    0,    0,    0,  362,
+        0,  360,  349,  349,  349,  349,  349,  349,  351,  351,
+      351,  351,  351,  351,  351,  351,  351,  351,  351,  351,
+
+      351,  351,  351,  351,  352,  362,  352,  352,  352,  352,
+      352,  352,  352,  352,  352,  361,  363,  365,  366,  367,
+      368,  361,  369,  361,  351,  351,  351,  351,  351,  351,
+      370,  371,  372,  373,  374,  375,  376,  377,  378,  379,
+      380,  361,  363,  365,  366,  367,  368,  361,  369,  361,
+      381,  382,  383,  384,  385,  386,  370,  371,  372,  373,
+      374,  375,  376,  377,  378,  379,  380,  387,  388,  391,
+      391,  392,  393,  394,  395,  396,  381,  382,  383,  384,
+      385,  386,  397,  399,  391,  400,  401,  391,    0,    0,
+        0,    0,    0,  387,  388,  391,  391,  392,  393,  394,
+
+      395,  396,    0,    0,    0,    0,    0,    0,  397,  399,
+      391,  400,  401,  391,  404,  404,  404,  404,  404,  404,
+      404,  404,  404,  418,  404,  404,  404,  404,  404,  404,
+      405,  405,  405,  405,  405,  405,  405,  405,  405,  419,
+      405,  405,  405,  405,  405,  405,    0,    0,    0,  418,
+      404,  404,  404,  404,  404,  404,    0,    0,    0,    0,
+        0,    0,    0,  420,    0,  419,  405,  405,  405,  405,
+      405,  405,  408,  408,  408,  408,  408,  408,  408,  408,
+      408,  421,  408,  408,  408,  408,  408,  408,  409,  420,
+      409,  409,  409,  409,  409,  409,  409,  409,  409,    0,
+
+        0,    0,    0,    0,    0,  422,    0,  421,  408,  408,
+      408,  408,  408,  408,  410,  410,  410,  410,  410,  410,
+      410,  410,  410,  410,  410,  410,  410,  410,  410,  410,
+      411,  422,  411,  411,  411,  411,  411,  411,  411,  411,
+      411,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      410,  410,  410,  410,  410,  410,  415,  415,  415,  415,
+      415,  415,  415,  415,  415,  423,  415,  415,  415,  415,
+      415,  415,  416,  416,  416,  416,  416,  416,  416,  416,
+      416,  424,  416,  416,  416,  416,  416,  416,    0,  425,
+        0,  423,  415,  415,  415,  415,  415,  415,    0,  426,
+
+      427,  428,  429,  432,  433,  434,  436,  424,  416,  416,
+      416,  416,  416,  416,  417,  425,  417,  417,  417,  417,
+      417,  417,  417,  417,  417,  426,  427,  428,  429,  432,
+      433,  434,  436,  438,  439,  442,  443,  444,  445,  446,
+      447,  449,  450,  451,  452,  453,  454,  455,  456,  457,
+      458,  459,  460,  461,  462,  463,  464,  465,  466,  438,
+      439,  442,  443,  444,  445,  446,  447,  449,  450,  451,
+      452,  453,  454,  455,  456,  457,  458,  459,  460,  461,
+      462,  463,  464,  465,  466,  468,  468,  468,  468,  468,
+      468,  468,  468,  468,  482,  468,  468,  468,  468,  468,
+
+      468,  469,  469,  469,  469,  469,  469,  469,  469,  469,
+      483,  469,  469,  469,  469,  469,  469,    0,    0,    0,
+      482,  468,  468,  468,  468,  468,  468,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  483,  469,  469,  469,
+      469,  469,  469,  470,  470,  470,  470,  470,  470,  470,
+      470,  470,  470,  470,  470,  470,  470,  470,  470,  474,
+      474,  474,  474,  474,  474,  474,  474,  474,  485,  474,
+      474,  474,  474,  474,  474,    0,    0,    0,    0,  470,
+      470,  470,  470,  470,  470,    0,    0,    0,    0,    0,
+        0,    0,  486,    0,  485,  474,  474,  474,  474,  474,
+
+      474,  475,  475,  475,  475,  475,  475,  475,  475,  475,
+      487,  475,  475,  475,  475,  475,  475,  476,  486,  476,
+      476,  476,  476,  476,  476,  476,  476,  476,    0,    0,
+        0,    0,    0,    0,  488,    0,  487,  475,  475,  475,
+      475,  475,  475,  478,  478,  478,  478,  478,  478,  478,
+      478,  478,  489,  478,  478,  478,  478,  478,  478,  479,
+      488,  479,  479,  479,  479,  479,  479,  479,  479,  479,
+        0,    0,    0,    0,    0,    0,  490,    0,  489,  478,
+      478,  478,  478,  478,  478,  480,  480,  480,  480,  480,
+      480,  480,  480,  480,  480,  480,  480,  480,  480,  480,
+
+      480,  481,  490,  481,  481,  481,  481,  481,  481,  481,
+      481,  481,  491,  492,  493,  494,  496,  497,  498,  499,
+      500,  480,  480,  480,  480,  480,  480,  502,  503,  504,
+      505,  507,    0,  510,  511,  512,  513,  514,  491,  492,
+      493,  494,  496,  497,  498,  499,  500,  515,  516,  517,
+      518,  508,  519,  502,  503,  504,  505,  507,  508,  510,
+      511,  512,  513,  514,  520,  521,  523,  525,  526,    0,
+        0,    0,    0,  515,  516,  517,  518,  508,  519,    0,
+        0,    0,    0,    0,  508,    0,    0,    0,    0,    0,
+      520,  521,  523,  525,  526,  527,  527,  527,  527,  527,
+
+      527,  527,  527,  527,  541,  527,  527,  527,  527,  527,
+      527,  529,  529,  529,  529,  529,  529,  529,  529,  529,
+      542,  529,  529,  529,  529,  529,  529,    0,    0,    0,
+      541,  527,  527,  527,  527,  527,  527,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  542,  529,  529,  529,
+      529,  529,  529,  530,  530,  530,  530,  530,  530,  530,
+      530,  530,  543,  530,  530,  530,  530,  530,  530,  532,
+      532,  532,  532,  532,  532,  532,  532,  532,  544,  532,
+      532,  532,  532,  532,  532,    0,  545,    0,  543,  530,
+      530,  530,  530,  530,  530,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,  544,  532,  532,  532,  532,  532,
+      532,  533,  545,  533,  533,  533,  533,  533,  533,  533,
+      533,  533,  534,  534,  534,  534,  534,  534,  534,  534,
+      534,  534,  534,  534,  534,  534,  534,  534,  535,    0,
+      535,  535,  535,  535,  535,  535,  535,  535,  535,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  534,  534,
+      534,  534,  534,  534,  538,  538,  538,  538,  538,  538,
+      538,  538,  538,  546,  538,  538,  538,  538,  538,  538,
+      539,  539,  539,  539,  539,  539,  539,  539,  539,  547,
+      539,  539,  539,  539,  539,  539,    0,  548,    0,  546,
+
+      538,  538,  538,  538,  538,  538,    0,  549,  550,  551,
+      553,  554,  555,  556,  557,  547,  539,  539,  539,  539,
+      539,  539,  540,  548,  540,  540,  540,  540,  540,  540,
+      540,  540,  540,  549,  550,  551,  553,  554,  555,  556,
+      557,  559,  560,  564,  565,  566,  567,  568,  569,  570,
+      571,  572,  566,  573,  574,  575,  578,  580,  581,    0,
+        0,    0,    0,    0,    0,    0,    0,  559,  560,  564,
+      565,  566,  567,  568,  569,  570,  571,  572,  566,  573,
+      574,  575,  578,  580,  581,  583,  583,  583,  583,  583,
+      583,  583,  583,  583,  595,  583,  583,  583,  583,  583,
+
+      583,  584,  584,  584,  584,  584,  584,  584,  584,  584,
+      584,  584,  584,  584,  584,  584,  584,    0,    0,    0,
+      595,  583,  583,  583,  583,  583,  583,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  584,  584,  584,
+      584,  584,  584,  587,  587,  587,  587,  587,  587,  587,
+      587,  587,  596,  587,  587,  587,  587,  587,  587,  588,
+      588,  588,  588,  588,  588,  588,  588,  588,  598,  588,
+      588,  588,  588,  588,  588,    0,  599,    0,  596,  587,
+      587,  587,  587,  587,  587,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  598,  588,  588,  588,  588,  588,
+
+      588,  589,  599,  589,  589,  589,  589,  589,  589,  589,
+      589,  589,  590,  590,  590,  590,  590,  590,  590,  590,
+      590,  600,  590,  590,  590,  590,  590,  590,  591,    0,
+      591,  591,  591,  591,  591,  591,  591,  591,  591,    0,
+        0,    0,    0,    0,    0,  601,    0,  600,  590,  590,
+      590,  590,  590,  590,  592,  592,  592,  592,  592,  592,
+      592,  592,  592,  592,  592,  592,  592,  592,  592,  592,
+      593,  601,  593,  593,  593,  593,  593,  593,  593,  593,
+      593,  604,  605,  606,  607,  608,  612,  613,  614,  615,
+      592,  592,  592,  592,  592,  592,  616,  617,  619,  620,
+
+      621,  622,  623,  624,  625,  626,  627,  604,  605,  606,
+      607,  608,  612,  613,  614,  615,  643,    0,    0,    0,
+        0,    0,  616,  617,  619,  620,  621,  622,  623,  624,
+      625,  626,  627,  629,  629,  629,  629,  629,  629,  629,
+      629,  629,  643,  629,  629,  629,  629,  629,  629,  631,
+      631,  631,  631,  631,  631,  631,  631,  631,  644,  631,
+      631,  631,  631,  631,  631,    0,    0,    0,    0,  629,
+      629,  629,  629,  629,  629,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  644,  631,  631,  631,  631,  631,
+      631,  632,  632,  632,  632,  632,  632,  632,  632,  632,
+
+      647,  632,  632,  632,  632,  632,  632,  633,  633,  633,
+      633,  633,  633,  633,  633,  633,  651,  633,  633,  633,
+      633,  633,  633,    0,  652,    0,  647,  632,  632,  632,
+      632,  632,  632,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  651,  633,  633,  633,  633,  633,  633,  634,
+      652,  634,  634,  634,  634,  634,  634,  634,  634,  634,
+      635,  635,  635,  635,  635,  635,  635,  635,  635,  635,
+      635,  635,  635,  635,  635,  635,  636,    0,  636,  636,
+      636,  636,  636,  636,  636,  636,  636,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  635,  635,  635,  635,
+
+      635,  635,  639,  639,  639,  639,  639,  639,  639,  639,
+      639,  654,  639,  639,  639,  639,  639,  639,  640,  640,
+      640,  640,  640,  640,  640,  640,  640,  655,  640,  640,
+      640,  640,  640,  640,    0,  656,    0,  654,  639,  639,
+      639,  639,  639,  639,    0,  649,  657,  658,  659,  661,
+      662,  649,  663,  655,  640,  640,  640,  640,  640,  640,
+      641,  656,  641,  641,  641,  641,  641,  641,  641,  641,
+      641,  649,  657,  658,  659,  661,  662,  649,  663,  665,
+      667,  669,  670,  671,  671,  671,  671,  671,  671,  671,
+      671,  671,  684,  671,  671,  671,  671,  671,  671,    0,
+
+        0,    0,    0,    0,    0,  665,  667,  669,  670,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  684,  671,
+      671,  671,  671,  671,  671,  672,  672,  672,  672,  672,
+      672,  672,  672,  672,  685,  672,  672,  672,  672,  672,
+      672,  673,  673,  673,  673,  673,  673,  673,  673,  673,
+      673,  673,  673,  673,  673,  673,  673,    0,    0,    0,
+      685,  672,  672,  672,  672,  672,  672,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  673,  673,  673,
+      673,  673,  673,  676,  676,  676,  676,  676,  676,  676,
+      676,  676,  687,  676,  676,  676,  676,  676,  676,  677,
+
+      677,  677,  677,  677,  677,  677,  677,  677,  688,  677,
+      677,  677,  677,  677,  677,    0,  689,    0,  687,  676,
+      676,  676,  676,  676,  676,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  688,  677,  677,  677,  677,  677,
+      677,  678,  689,  678,  678,  678,  678,  678,  678,  678,
+      678,  678,  679,  679,  679,  679,  679,  679,  679,  679,
+      679,  692,  679,  679,  679,  679,  679,  679,  680,    0,
+      680,  680,  680,  680,  680,  680,  680,  680,  680,    0,
+        0,    0,    0,    0,    0,  693,    0,  692,  679,  679,
+      679,  679,  679,  679,  681,  681,  681,  681,  681,  681,
+
+      681,  681,  681,  681,  681,  681,  681,  681,  681,  681,
+      682,  693,  682,  682,  682,  682,  682,  682,  682,  682,
+      682,  694,  695,  696,  697,  698,  699,  700,  701,  702,
+      681,  681,  681,  681,  681,  681,  704,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  718,  694,  695,  696,
+      697,  698,  699,  700,  701,  702,    0,    0,    0,    0,
+        0,    0,  704,  707,  707,  707,  707,  707,  707,  707,
+      707,  707,  718,  707,  707,  707,  707,  707,  707,  708,
+      708,  708,  708,  708,  708,  708,  708,  708,  708,  708,
+      708,  708,  708,  708,  708,    0,    0,    0,    0,  707,
+
+      707,  707,  707,  707,  707,    0,    0,    0,    0,    0,
+        0,    0,  719,    0,    0,  708,  708,  708,  708,  708,
+      708,  709,  709,  709,  709,  709,  709,  709,  709,  709,
+      720,  709,  709,  709,  709,  709,  709,  710,  719,  710,
+      710,  710,  710,  710,  710,  710,  710,  710,    0,    0,
+        0,    0,    0,    0,  722,    0,  720,  709,  709,  709,
+      709,  709,  709,  711,  711,  711,  711,  711,  711,  711,
+      711,  711,  711,  711,  711,  711,  711,  711,  711,  712,
+      722,  712,  712,  712,  712,  712,  712,  712,  712,  712,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  711,
+
+      711,  711,  711,  711,  711,  715,  715,  715,  715,  715,
+      715,  715,  715,  715,  723,  715,  715,  715,  715,  715,
+      715,  716,  716,  716,  716,  716,  716,  716,  716,  716,
+      724,  716,  716,  716,  716,  716,  716,    0,  725,    0,
+      723,  715,  715,  715,  715,  715,  715,    0,  726,  727,
+      728,  729,  731,  732,  733,  735,  724,  716,  716,  716,
+      716,  716,  716,  717,  725,  717,  717,  717,  717,  717,
+      717,  717,  717,  717,  726,  727,  728,  729,  731,  732,
+      733,  735,  737,  737,  737,  737,  737,  737,  737,  737,
+      737,  750,  737,  737,  737,  737,  737,  737,  738,  738,
+
+      738,  738,  738,  738,  738,  738,  738,  751,  738,  738,
+      738,  738,  738,  738,    0,    0,    0,  750,  737,  737,
+      737,  737,  737,  737,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  751,  738,  738,  738,  738,  738,  738,
+      739,  739,  739,  739,  739,  739,  739,  739,  739,  739,
+      739,  739,  739,  739,  739,  739,  740,  740,  740,  740,
+      740,  740,  740,  740,  740,  756,  740,  740,  740,  740,
+      740,  740,    0,    0,    0,    0,  739,  739,  739,  739,
+      739,  739,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  756,  740,  740,  740,  740,  740,  740,  743,  743,
+
+      743,  743,  743,  743,  743,  743,  743,  757,  743,  743,
+      743,  743,  743,  743,  744,  744,  744,  744,  744,  744,
+      744,  744,  744,  758,  744,  744,  744,  744,  744,  744,
+        0,  759,    0,  757,  743,  743,  743,  743,  743,  743,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  758,
+      744,  744,  744,  744,  744,  744,  745,  759,  745,  745,
+      745,  745,  745,  745,  745,  745,  745,  746,  746,  746,
+      746,  746,  746,  746,  746,  746,  760,  746,  746,  746,
+      746,  746,  746,  747,    0,  747,  747,  747,  747,  747,
+      747,  747,  747,  747,    0,    0,    0,    0,    0,    0,
+
+      761,    0,  760,  746,  746,  746,  746,  746,  746,  748,
+      748,  748,  748,  748,  748,  748,  748,  748,  748,  748,
+      748,  748,  748,  748,  748,  749,  761,  749,  749,  749,
+      749,  749,  749,  749,  749,  749,  763,  764,  765,    0,
+        0,    0,    0,    0,    0,  748,  748,  748,  748,  748,
+      748,  772,    0,  772,  772,  772,  772,  772,  772,  772,
+      772,  772,  763,  764,  765,  766,  766,  766,  766,  766,
+      766,  766,  766,  766,  780,  766,  766,  766,  766,  766,
+      766,  768,  768,  768,  768,  768,  768,  768,  768,  768,
+      781,  768,  768,  768,  768,  768,  768,    0,    0,    0,
+
+      780,  766,  766,  766,  766,  766,  766,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  781,  768,  768,  768,
+      768,  768,  768,  770,  770,  770,  770,  770,  770,  770,
+      770,  770,  770,  770,  770,  770,  770,  770,  770,  771,
+      771,  771,  771,  771,  771,  771,  771,  771,  786,  771,
+      771,  771,  771,  771,  771,    0,    0,    0,    0,  770,
+      770,  770,  770,  770,  770,    0,    0,    0,    0,    0,
+        0,    0,  787,    0,  786,  771,  771,  771,  771,  771,
+      771,  773,  773,  773,  773,  773,  773,  773,  773,  773,
+      789,  773,  773,  773,  773,  773,  773,  774,  787,  774,
+
+      774,  774,  774,  774,  774,  774,  774,  774,    0,    0,
+        0,    0,    0,    0,    0,    0,  789,  773,  773,  773,
+      773,  773,  773,  777,  777,  777,  777,  777,  777,  777,
+      777,  777,  790,  777,  777,  777,  777,  777,  777,  778,
+      778,  778,  778,  778,  778,  778,  778,  778,  791,  778,
+      778,  778,  778,  778,  778,    0,  792,    0,  790,  777,
+      777,  777,  777,  777,  777,    0,  793,  794,  795,    0,
+        0,    0,    0,    0,  791,  778,  778,  778,  778,  778,
+      778,  779,  792,  779,  779,  779,  779,  779,  779,  779,
+      779,  779,  793,  794,  795,  797,  797,  797,  797,  797,
+
+      797,  797,  797,  797,  808,  797,  797,  797,  797,  797,
+      797,  799,  799,  799,  799,  799,  799,  799,  799,  799,
+      809,  799,  799,  799,  799,  799,  799,    0,    0,    0,
+      808,  797,  797,  797,  797,  797,  797,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  809,  799,  799,  799,
+      799,  799,  799,  800,  800,  800,  800,  800,  800,  800,
+      800,  800,  814,  800,  800,  800,  800,  800,  800,  803,
+      803,  803,  803,  803,  803,  803,  803,  803,  816,  803,
+      803,  803,  803,  803,  803,    0,  819,    0,  814,  800,
+      800,  800,  800,  800,  800,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,  816,  803,  803,  803,  803,  803,
+      803,  804,  819,  804,  804,  804,  804,  804,  804,  804,
+      804,  804,  805,  805,  805,  805,  805,  805,  805,  805,
+      805,  820,  805,  805,  805,  805,  805,  805,  806,    0,
+      806,  806,  806,  806,  806,  806,  806,  806,  806,    0,
+        0,    0,    0,    0,  822,    0,    0,  820,  805,  805,
+      805,  805,  805,  805,  807,  807,  807,  807,  807,  807,
+      807,  807,  807,  832,  807,  807,  807,  807,  807,  807,
+      822,  823,  823,  823,  823,  823,  823,  823,  823,  823,
+        0,  823,  823,  823,  823,  823,  823,    0,    0,  832,
+
+      807,  807,  807,  807,  807,  807,  828,    0,  828,  828,
+      828,  828,  828,  828,  828,  828,  828,  823,  823,  823,
+      823,  823,  823,  825,  825,  825,  825,  825,  825,  825,
+      825,  825,  833,  825,  825,  825,  825,  825,  825,  826,
+      826,  826,  826,  826,  826,  826,  826,  826,  826,  826,
+      826,  826,  826,  826,  826,    0,    0,    0,  833,  825,
+      825,  825,  825,  825,  825,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  826,  826,  826,  826,  826,
+      826,  827,  827,  827,  827,  827,  827,  827,  827,  827,
+      838,  827,  827,  827,  827,  827,  827,  831,  831,  831,
+
+      831,  831,  831,  831,  831,  831,  842,  831,  831,  831,
+      831,  831,  831,    0,    0,    0,  838,  827,  827,  827,
+      827,  827,  827,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  842,  831,  831,  831,  831,  831,  831,  843,
+      843,  843,  843,  843,  843,  843,  843,  843,  850,  843,
+      843,  843,  843,  843,  843,  845,  845,  845,  845,  845,
+      845,  845,  845,  845,  852,  845,  845,  845,  845,  845,
+      845,    0,    0,    0,  850,  843,  843,  843,  843,  843,
+      843,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      852,  845,  845,  845,  845,  845,  845,  846,  846,  846,
+
+      846,  846,  846,  846,  846,  846,  853,  846,  846,  846,
+      846,  846,  846,  849,  849,  849,  849,  849,  849,  849,
+      849,  849,  858,  849,  849,  849,  849,  849,  849,    0,
+        0,    0,  853,  846,  846,  846,  846,  846,  846,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  858,  849,
+      849,  849,  849,  849,  849,  855,  855,  855,  855,  855,
+      855,  855,  855,  855,  859,  855,  855,  855,  855,  855,
+      855,  856,  856,  856,  856,  856,  856,  856,  856,  856,
+      856,  856,  856,  856,  856,  856,  856,  860,    0,    0,
+      859,  855,  855,  855,  855,  855,  855,  866,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,  856,  856,  856,
+      856,  856,  856,  860,  861,  861,  861,  861,  861,  861,
+      861,  861,  861,  866,  861,  861,  861,  861,  861,  861,
+      863,  863,  863,  863,  863,  863,  863,  863,  863,    0,
+      863,  863,  863,  863,  863,  863,    0,    0,    0,    0,
+      861,  861,  861,  861,  861,  861,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  863,  863,  863,  863,
+      863,  863,  864,  864,  864,  864,  864,  864,  864,  864,
+      864,    0,  864,  864,  864,  864,  864,  864,  868,  868,
+      868,  868,  868,  868,  868,  868,  868,    0,  868,  868,
+
+      868,  868,  868,  868,    0,    0,    0,    0,  864,  864,
+      864,  864,  864,  864,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  868,  868,  868,  868,  868,  868,
+      869,  869,  869,  869,  869,  869,  869,  869,  869,    0,
+      869,  869,  869,  869,  869,  869,  870,  870,  870,  870,
+      870,  870,  870,  870,  870,  870,  870,  870,  870,  870,
+      870,  870,    0,    0,    0,    0,  869,  869,  869,  869,
+      869,  869,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  870,  870,  870,  870,  870,  870,  874,  874,
+      874,  874,  874,  874,  874,  874,  874,    0,  874,  874,
+
+      874,  874,  874,  874,  875,  875,  875,  875,  875,  875,
+      875,  875,  875,    0,  875,  875,  875,  875,  875,  875,
+        0,    0,    0,    0,  874,  874,  874,  874,  874,  874,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      875,  875,  875,  875,  875,  875,  876,  876,  876,  876,
+      876,  876,  876,  876,  876,    0,  876,  876,  876,  876,
+      876,  876,  877,  877,  877,  877,  877,  877,  877,  877,
+      877,    0,  877,  877,  877,  877,  877,  877,    0,    0,
+        0,    0,  876,  876,  876,  876,  876,  876,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  877,  877,
+
+      877,  877,  877,  877,  878,  878,  878,  878,  878,  878,
+      878,  878,  878,  878,  878,  878,  878,  878,  878,  878,
+      879,  879,  879,  879,  879,  879,  879,  879,  879,    0,
+      879,  879,  879,  879,  879,  879,    0,    0,    0,    0,
+      878,  878,  878,  878,  878,  878,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  879,  879,  879,  879,
+      879,  879,  881,  881,  881,  881,  881,  881,  881,  881,
+      881,    0,  881,  881,  881,  881,  881,  881,  882,  882,
+      882,  882,  882,  882,  882,  882,  882,    0,  882,  882,
+      882,  882,  882,  882,    0,    0,    0,    0,  881,  881,
+
+      881,  881,  881,  881,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  882,  882,  882,  882,  882,  882,
+      884,  884,  884,  884,  884,  884,  884,  884,  884,    0,
+      884,  884,  884,  884,  884,  884,  885,  885,  885,  885,
+      885,  885,  885,  885,  885,  885,  885,  885,  885,  885,
+      885,  885,    0,    0,    0,    0,  884,  884,  884,  884,
+      884,  884,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  885,  885,  885,  885,  885,  885,  888,  888,
+      888,  888,  888,  888,  888,  888,  888,    0,  888,  888,
+      888,  888,  888,  888,  890,  890,  890,  890,  890,  890,
+
+      890,  890,  890,    0,  890,  890,  890,  890,  890,  890,
+        0,    0,    0,    0,  888,  888,  888,  888,  888,  888,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      890,  890,  890,  890,  890,  890,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892,  892,  892,  892,  892,  892,  892,  892,  892,  892,
+      892
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[97] =
+static yyconst flex_int32_t yy_rule_can_match_eol[103] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,     };
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 
+    0, 0, 0,     };
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -1790,13 +2239,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 831 )
+				if ( yy_current_state >= 893 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 3942 );
+		while ( yy_base[yy_current_state] != 5957 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1833,333 +2282,445 @@ do_action:	/* This label is used only to access EOF actions. */
 case 1:
 /* rule 1 can match eol */
 YY_RULE_SETUP
+#line 48 "ClntLexer.l"
 ; // ignore end of line
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
+#line 49 "ClntLexer.l"
 ; // ignore TABs and spaces
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
+#line 50 "ClntLexer.l"
 { return ClntParser::IFACE_;}
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
+#line 51 "ClntLexer.l"
 { return ClntParser::NO_CONFIG_;}
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
+#line 52 "ClntLexer.l"
 { return ClntParser::ADDRESS_;}
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
+#line 53 "ClntLexer.l"
 { return ClntParser::STRING_KEYWORD_; }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
+#line 54 "ClntLexer.l"
 { return ClntParser::DUID_KEYWORD_; }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
+#line 55 "ClntLexer.l"
 { return ClntParser::ADDRESS_LIST_; }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
+#line 56 "ClntLexer.l"
 { return ClntParser::NAME_; }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
+#line 57 "ClntLexer.l"
 { return ClntParser::IA_;}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
+#line 58 "ClntLexer.l"
 { return ClntParser::TA_; }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
+#line 59 "ClntLexer.l"
 { return ClntParser::IAID_; }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
+#line 60 "ClntLexer.l"
 { return ClntParser::STATELESS_;}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
+#line 61 "ClntLexer.l"
 { return ClntParser::LOGLEVEL_; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
+#line 62 "ClntLexer.l"
 { return ClntParser::LOGMODE_; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
+#line 63 "ClntLexer.l"
 { return ClntParser::LOGNAME_; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
+#line 64 "ClntLexer.l"
 { return ClntParser::LOGCOLORS_; }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
+#line 66 "ClntLexer.l"
 { return ClntParser::WORKDIR_;}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
+#line 67 "ClntLexer.l"
 { return ClntParser::SCRIPT_; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-{ return ClntParser::PREF_TIME_; }
+#line 68 "ClntLexer.l"
+{ return ClntParser::SCRIPT_CONCURRENCY_; }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-{ return ClntParser::PREF_TIME_; }
+#line 69 "ClntLexer.l"
+{ return ClntParser::SCRIPT_QUEUE_SIZE_; }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-{ return ClntParser::VALID_TIME_; }
+#line 70 "ClntLexer.l"
+{ return ClntParser::SCRIPT_TIMEOUT_; }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-{ return ClntParser::REMOTE_AUTOCONF_; }
+#line 71 "ClntLexer.l"
+{ return ClntParser::SCRIPT_BATCH_; }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-{ return ClntParser::T1_;}
+#line 72 "ClntLexer.l"
+{ return ClntParser::PREF_TIME_; }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-{ return ClntParser::T2_;}
+#line 73 "ClntLexer.l"
+{ return ClntParser::PREF_TIME_; }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-{ return ClntParser::OPTION_; }
+#line 74 "ClntLexer.l"
+{ return ClntParser::VALID_TIME_; }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-{ return ClntParser::DNS_SERVER_;}
+#line 75 "ClntLexer.l"
+{ return ClntParser::REMOTE_AUTOCONF_; }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-{ return ClntParser::DOMAIN_;}
+#line 76 "ClntLexer.l"
+{ return ClntParser::T1_;}
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-{ return ClntParser::NTP_SERVER_;}
+#line 77 "ClntLexer.l"
+{ return ClntParser::T2_;}
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-{ return ClntParser::TIME_ZONE_;}
+#line 78 "ClntLexer.l"
+{ return ClntParser::OPTION_; }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-{ return ClntParser::SIP_SERVER_; }
+#line 79 "ClntLexer.l"
+{ return ClntParser::DNS_SERVER_;}
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-{ return ClntParser::SIP_DOMAIN_; }
+#line 80 "ClntLexer.l"
+{ return ClntParser::DOMAIN_;}
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-{ return ClntParser::FQDN_; }
+#line 81 "ClntLexer.l"
+{ return ClntParser::NTP_SERVER_;}
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-{ return ClntParser::FQDN_S_; }
+#line 82 "ClntLexer.l"
+{ return ClntParser::TIME_ZONE_;}
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-{ return ClntParser::DDNS_PROTOCOL_; }
+#line 83 "ClntLexer.l"
+{ return ClntParser::SIP_SERVER_; }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-{ return ClntParser::DDNS_TIMEOUT_; }
+#line 84 "ClntLexer.l"
+{ return ClntParser::SIP_DOMAIN_; }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-{ return ClntParser::NIS_SERVER_; }
+#line 85 "ClntLexer.l"
+{ return ClntParser::FQDN_; }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-{ return ClntParser::NIS_DOMAIN_; }
+#line 86 "ClntLexer.l"
+{ return ClntParser::FQDN_S_; }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-{ return ClntParser::NISP_SERVER_; }
+#line 87 "ClntLexer.l"
+{ return ClntParser::DDNS_PROTOCOL_; }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-{ return ClntParser::NISP_DOMAIN_; }
+#line 88 "ClntLexer.l"
+{ return ClntParser::DDNS_TIMEOUT_; }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-{ return ClntParser::LIFETIME_; }
+#line 89 "ClntLexer.l"
+{ return ClntParser::NIS_SERVER_; }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-{ return ClntParser::ROUTING_; }
+#line 90 "ClntLexer.l"
+{ return ClntParser::NIS_DOMAIN_; }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-{ return ClntParser::REJECT_SERVERS_;}
+#line 91 "ClntLexer.l"
+{ return ClntParser::NISP_SERVER_; }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-{ return ClntParser::PREFERRED_SERVERS_;}
+#line 92 "ClntLexer.l"
+{ return ClntParser::NISP_DOMAIN_; }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-{ return ClntParser::PREFERRED_SERVERS_;}
+#line 93 "ClntLexer.l"
+{ return ClntParser::LIFETIME_; }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-{ return ClntParser::RAPID_COMMIT_;}
+#line 94 "ClntLexer.l"
+{ return ClntParser::ROUTING_; }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-{ return ClntParser::RECONFIGURE_; }
+#line 95 "ClntLexer.l"
+{ return ClntParser::REJECT_SERVERS_;}
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-{ return ClntParser::UNICAST_; }
+#line 96 "ClntLexer.l"
+{ return ClntParser::PREFERRED_SERVERS_;}
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-{ return ClntParser::STRICT_RFC_NO_ROUTING_; }
+#line 97 "ClntLexer.l"
+{ return ClntParser::PREFERRED_SERVERS_;}
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-{ return ClntParser::PD_; }
+#line 98 "ClntLexer.l"
+{ return ClntParser::RAPID_COMMIT_;}
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-{ return ClntParser::PD_; }
+#line 99 "ClntLexer.l"
+{ return ClntParser::RECONFIGURE_; }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-{ return ClntParser::PREFIX_; }
+#line 100 "ClntLexer.l"
+{ return ClntParser::DUMP_INTERVAL_; }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-{ return ClntParser::DUID_TYPE_; }
+#line 101 "ClntLexer.l"
+{ return ClntParser::BINARY_LEASE_DB_; }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-{ return ClntParser::DUID_TYPE_LL_; }
+#line 102 "ClntLexer.l"
+{ return ClntParser::UNICAST_; }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-{ return ClntParser::DUID_TYPE_LLT_; }
+#line 103 "ClntLexer.l"
+{ return ClntParser::STRICT_RFC_NO_ROUTING_; }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-{ return ClntParser::DUID_TYPE_EN_; }
+#line 104 "ClntLexer.l"
+{ return ClntParser::PD_; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-{ return ClntParser::VENDOR_SPEC_; }
+#line 105 "ClntLexer.l"
+{ return ClntParser::PD_; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-{ return ClntParser::ANON_INF_REQUEST_; }
+#line 106 "ClntLexer.l"
+{ return ClntParser::PREFIX_; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-{ return ClntParser::INSIST_MODE_; }
+#line 107 "ClntLexer.l"
+{ return ClntParser::DUID_TYPE_; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-{ return ClntParser::INACTIVE_MODE_; }
+#line 108 "ClntLexer.l"
+{ return ClntParser::DUID_TYPE_LL_; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_ENABLED_; }
+#line 109 "ClntLexer.l"
+{ return ClntParser::DUID_TYPE_LLT_; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-{ return ClntParser::AUTH_ACCEPT_METHODS_; }
+#line 110 "ClntLexer.l"
+{ return ClntParser::DUID_TYPE_EN_; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_NONE_; }
+#line 111 "ClntLexer.l"
+{ return ClntParser::VENDOR_SPEC_; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_PLAIN_; }
+#line 112 "ClntLexer.l"
+{ return ClntParser::ANON_INF_REQUEST_; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_MD5_; }
+#line 113 "ClntLexer.l"
+{ return ClntParser::INSIST_MODE_; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA1_; }
+#line 114 "ClntLexer.l"
+{ return ClntParser::INACTIVE_MODE_; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA224_; }
+#line 115 "ClntLexer.l"
+{ return ClntParser::AUTH_ENABLED_; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA256_; }
+#line 116 "ClntLexer.l"
+{ return ClntParser::AUTH_ACCEPT_METHODS_; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA384_; }
+#line 117 "ClntLexer.l"
+{ return ClntParser::DIGEST_NONE_; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-{ return ClntParser::DIGEST_HMAC_SHA512_; }
+#line 118 "ClntLexer.l"
+{ return ClntParser::DIGEST_PLAIN_; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-{ return ClntParser::SKIP_CONFIRM_; }
+#line 119 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_MD5_; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-{ return ClntParser::AFTR_; }
+#line 120 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_SHA1_; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-{ return ClntParser::DOWNLINK_PREFIX_IFACES_; }
+#line 121 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_SHA224_; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-{ return ClntParser::EXPERIMENTAL_; }
+#line 122 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_SHA256_; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-{ return ClntParser::ADDR_PARAMS_; }
+#line 123 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_SHA384_; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-{ return ClntParser::REQUEST_; }
+#line 124 "ClntLexer.l"
+{ return ClntParser::DIGEST_HMAC_SHA512_; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-;
+#line 125 "ClntLexer.l"
+{ return ClntParser::SKIP_CONFIRM_; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-;
+#line 126 "ClntLexer.l"
+{ return ClntParser::AFTR_; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
+#line 127 "ClntLexer.l"
+{ return ClntParser::DOWNLINK_PREFIX_IFACES_; }
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+#line 129 "ClntLexer.l"
+{ return ClntParser::EXPERIMENTAL_; }
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+#line 130 "ClntLexer.l"
+{ return ClntParser::ADDR_PARAMS_; }
+	YY_BREAK
+case 82:
+YY_RULE_SETUP
+#line 131 "ClntLexer.l"
+{ return ClntParser::REQUEST_; }
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+#line 133 "ClntLexer.l"
+;
+	YY_BREAK
+case 84:
+YY_RULE_SETUP
+#line 135 "ClntLexer.l"
+;
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+#line 137 "ClntLexer.l"
 {
   BEGIN(COMMENT);
   ComBeg=yylineno;
 }
 	YY_BREAK
-case 80:
+case 86:
 YY_RULE_SETUP
+#line 143 "ClntLexer.l"
 BEGIN(INITIAL);
 	YY_BREAK
-case 81:
-/* rule 81 can match eol */
+case 87:
+/* rule 87 can match eol */
 YY_RULE_SETUP
+#line 144 "ClntLexer.l"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
+#line 145 "ClntLexer.l"
 {
     Log(Crit) << "Comment not closed. (/* in line " << ComBeg << LogEnd;
     { YYABORT; }
@@ -2167,8 +2728,9 @@ case YY_STATE_EOF(COMMENT):
 	YY_BREAK
     //IPv6 address - various forms
 
-case 82:
+case 88:
 YY_RULE_SETUP
+#line 152 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2178,8 +2740,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 89:
 YY_RULE_SETUP
+#line 161 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2189,8 +2752,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 90:
 YY_RULE_SETUP
+#line 170 "ClntLexer.l"
 { 
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2201,8 +2765,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 91:
 YY_RULE_SETUP
+#line 180 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2212,8 +2777,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 92:
 YY_RULE_SETUP
+#line 189 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2223,8 +2789,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 93:
 YY_RULE_SETUP
+#line 198 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2234,8 +2801,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 94:
 YY_RULE_SETUP
+#line 207 "ClntLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2245,9 +2813,10 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
-/* rule 89 can match eol */
+case 95:
+/* rule 95 can match eol */
 YY_RULE_SETUP
+#line 216 "ClntLexer.l"
 {
     yylval.strval=new char[strlen(yytext)-1];
     strncpy(yylval.strval, yytext+1, strlen(yytext)-2);
@@ -2255,8 +2824,9 @@ YY_RULE_SETUP
     return ClntParser::STRING_;
 }
 	YY_BREAK
-case 90:
+case 96:
 YY_RULE_SETUP
+#line 223 "ClntLexer.l"
 {
     int len = strlen(yytext);
     if ( ( (len>2) && !strncasecmp("yes",yytext,3) ) ||
@@ -2278,8 +2848,9 @@ YY_RULE_SETUP
     return ClntParser::STRING_;
 }
 	YY_BREAK
-case 91:
+case 97:
 YY_RULE_SETUP
+#line 244 "ClntLexer.l"
 {
     // DUID in 0x00010203 format
     int len;
@@ -2312,8 +2883,9 @@ YY_RULE_SETUP
    return ClntParser::DUID_;
 }
 	YY_BREAK
-case 92:
+case 98:
 YY_RULE_SETUP
+#line 276 "ClntLexer.l"
 {
    // DUID in 00:01:02:03 format
    int len = (strlen(yytext)+1)/3;
@@ -2342,8 +2914,9 @@ YY_RULE_SETUP
    return ClntParser::DUID_;
 }
 	YY_BREAK
-case 93:
+case 99:
 YY_RULE_SETUP
+#line 304 "ClntLexer.l"
 { 
     yytext[strlen(yytext)-1]='\n';
     if(!sscanf(yytext,"%x",(unsigned int*)&(yylval.ival))) {
@@ -2353,8 +2926,9 @@ YY_RULE_SETUP
     return ClntParser::HEXNUMBER_;
 }
 	YY_BREAK
-case 94:
+case 100:
 YY_RULE_SETUP
+#line 313 "ClntLexer.l"
 { 
     if(!sscanf(yytext,"%u",(unsigned int*)&(yylval.ival))) { 
         Log(Crit) << "Integer parsing [" << yytext << "] failed." << LogEnd;
@@ -2363,14 +2937,17 @@ YY_RULE_SETUP
     return ClntParser::INTNUMBER_;
 }
 	YY_BREAK
-case 95:
+case 101:
 YY_RULE_SETUP
+#line 321 "ClntLexer.l"
 {return yytext[0];} 
 	YY_BREAK
-case 96:
+case 102:
 YY_RULE_SETUP
+#line 323 "ClntLexer.l"
 ECHO;
 	YY_BREAK
+#line 2951 "ClntLexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(ADDR):
 	yyterminate();
@@ -2752,7 +3329,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 831 )
+			if ( yy_current_state >= 893 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -2780,11 +3357,11 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 831 )
+		if ( yy_current_state >= 893 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 830);
+	yy_is_jam = (yy_current_state == 892);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
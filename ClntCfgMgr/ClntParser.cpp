@@ -464,6 +464,12 @@ typedef
 #define	DUID_KEYWORD_	331
 #define	REQUEST_	332
 #define	RECONFIGURE_	333
+#define	DUMP_INTERVAL_	334
+#define	BINARY_LEASE_DB_	335
+#define	SCRIPT_CONCURRENCY_	336
+#define	SCRIPT_QUEUE_SIZE_	337
+#define	SCRIPT_TIMEOUT_	338
+#define	SCRIPT_BATCH_	339
 
 
 #line 263 "../bison++/bison.cc"
@@ -589,6 +595,12 @@ static const int STRING_KEYWORD_;
 static const int DUID_KEYWORD_;
 static const int REQUEST_;
 static const int RECONFIGURE_;
+static const int DUMP_INTERVAL_;
+static const int BINARY_LEASE_DB_;
+static const int SCRIPT_CONCURRENCY_;
+static const int SCRIPT_QUEUE_SIZE_;
+static const int SCRIPT_TIMEOUT_;
+static const int SCRIPT_BATCH_;
 
 
 #line 307 "../bison++/bison.cc"
@@ -673,6 +685,12 @@ enum YY_ClntParser_ENUM_TOKEN { YY_ClntParser_NULL_TOKEN=0
 	,DUID_KEYWORD_=331
 	,REQUEST_=332
 	,RECONFIGURE_=333
+	,DUMP_INTERVAL_=334
+	,BINARY_LEASE_DB_=335
+	,SCRIPT_CONCURRENCY_=336
+	,SCRIPT_QUEUE_SIZE_=337
+	,SCRIPT_TIMEOUT_=338
+	,SCRIPT_BATCH_=339
 
 
 #line 310 "../bison++/bison.cc"
@@ -785,6 +803,12 @@ const int YY_ClntParser_CLASS::STRING_KEYWORD_=330;
 const int YY_ClntParser_CLASS::DUID_KEYWORD_=331;
 const int YY_ClntParser_CLASS::REQUEST_=332;
 const int YY_ClntParser_CLASS::RECONFIGURE_=333;
+const int YY_ClntParser_CLASS::DUMP_INTERVAL_=334;
+const int YY_ClntParser_CLASS::BINARY_LEASE_DB_=335;
+const int YY_ClntParser_CLASS::SCRIPT_CONCURRENCY_=336;
+const int YY_ClntParser_CLASS::SCRIPT_QUEUE_SIZE_=337;
+const int YY_ClntParser_CLASS::SCRIPT_TIMEOUT_=338;
+const int YY_ClntParser_CLASS::SCRIPT_BATCH_=339;
 
 
 #line 341 "../bison++/bison.cc"
@@ -803,18 +827,18 @@ YY_ClntParser_CONSTRUCTOR_CODE;
  #line 352 "../bison++/bison.cc"
 
 
-#define	YYFINAL		283
+#define	YYFINAL		297
 #define	YYFLAG		-32768
-#define	YYNTBASE	84
+#define	YYNTBASE	90
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 333 ? yytranslate[x] : 179)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 339 ? yytranslate[x] : 188)
 
 static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,    81,    83,     2,    82,     2,     2,     2,
+     2,     2,     2,    87,    89,     2,    88,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -822,7 +846,7 @@ static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    79,     2,    80,     2,     2,     2,     2,     2,
+     2,     2,    85,     2,    86,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -843,7 +867,7 @@ static const char yytranslate[] = {     0,
     46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
     56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
     66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-    76,    77,    78
+    76,    77,    78,    79,    80,    81,    82,    83,    84
 };
 
 #if YY_ClntParser_DEBUG != 0
@@ -853,115 +877,120 @@ static const short yyprhs[] = {     0,
     41,    43,    45,    47,    49,    51,    53,    55,    57,    59,
     61,    63,    65,    67,    69,    71,    73,    75,    77,    79,
     81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
-   101,   103,   105,   107,   109,   110,   114,   115,   122,   123,
-   130,   135,   140,   144,   148,   150,   153,   155,   158,   160,
-   163,   165,   168,   170,   171,   172,   179,   183,   186,   188,
-   191,   192,   198,   199,   206,   210,   212,   215,   217,   220,
-   222,   225,   226,   232,   233,   240,   245,   249,   252,   254,
-   256,   259,   261,   264,   266,   268,   271,   274,   277,   280,
-   283,   286,   291,   293,   296,   298,   301,   304,   305,   309,
-   311,   315,   317,   319,   321,   323,   325,   327,   329,   331,
-   333,   335,   336,   340,   341,   345,   348,   351,   353,   355,
-   357,   360,   363,   366,   369,   372,   375,   377,   381,   382,
-   388,   391,   392,   399,   401,   404,   406,   408,   410,   415,
-   417,   420,   423,   425,   427,   431,   435,   437,   441,   443,
-   447,   449,   451,   454,   455,   460,   463,   464,   469,   472,
-   473,   478,   481,   485,   488,   489,   494,   497,   498,   503,
-   506,   510,   514,   517,   518,   523,   526,   527,   532,   535,
-   539,   542,   546,   549,   552,   556,   558,   562,   566,   572,
-   575,   580,   585,   586,   592,   597,   602,   607
+   101,   103,   105,   107,   109,   111,   113,   115,   116,   120,
+   121,   128,   129,   136,   141,   146,   150,   154,   156,   159,
+   161,   164,   166,   169,   171,   174,   176,   177,   178,   185,
+   189,   192,   194,   197,   198,   204,   205,   212,   216,   218,
+   221,   223,   226,   228,   231,   232,   238,   239,   246,   251,
+   255,   258,   260,   262,   265,   267,   270,   272,   274,   277,
+   280,   283,   286,   289,   292,   297,   299,   302,   304,   307,
+   310,   313,   316,   319,   322,   323,   327,   329,   333,   335,
+   337,   339,   341,   343,   345,   347,   349,   351,   353,   354,
+   358,   359,   363,   366,   369,   371,   373,   375,   378,   381,
+   384,   387,   389,   392,   395,   398,   400,   404,   405,   411,
+   414,   415,   422,   424,   427,   429,   431,   433,   438,   440,
+   443,   446,   448,   450,   454,   458,   460,   464,   466,   470,
+   472,   474,   477,   478,   483,   486,   487,   492,   495,   496,
+   501,   504,   508,   511,   512,   517,   520,   521,   526,   529,
+   533,   537,   540,   541,   546,   549,   550,   555,   558,   562,
+   565,   569,   572,   575,   579,   581,   585,   589,   595,   598,
+   603,   608,   609,   615,   620,   625,   630
 };
 
-static const short yyrhs[] = {    85,
-     0,     0,    86,     0,    91,     0,    85,    86,     0,    85,
-    91,     0,    87,     0,   110,     0,   111,     0,   109,     0,
-   112,     0,   115,     0,   113,     0,   116,     0,   117,     0,
-   137,     0,   138,     0,   118,     0,   119,     0,   123,     0,
-   124,     0,   125,     0,   166,     0,   126,     0,   135,     0,
-   136,     0,    89,     0,    88,     0,   149,     0,   114,     0,
-   148,     0,   154,     0,   156,     0,   158,     0,   160,     0,
-   161,     0,   163,     0,   165,     0,   167,     0,   169,     0,
-   171,     0,   172,     0,   173,     0,   174,     0,   176,     0,
-   127,     0,   129,     0,   177,     0,   134,     0,   140,     0,
-   141,     0,   132,     0,   108,     0,   133,     0,     0,    50,
-    90,   152,     0,     0,    24,    42,    79,    92,    94,    80,
-     0,     0,    24,   153,    79,    93,    94,    80,     0,    24,
-    42,    79,    80,     0,    24,   153,    79,    80,     0,    24,
-    42,    25,     0,    24,   153,    25,     0,    87,     0,    94,
-    87,     0,   100,     0,    94,   100,     0,    95,     0,    94,
-    95,     0,   142,     0,    94,   142,     0,    29,     0,     0,
-     0,    29,    79,    96,    98,    97,    80,     0,    29,    79,
-    80,     0,    98,    99,     0,    99,     0,    30,   153,     0,
-     0,    28,    79,   101,   103,    80,     0,     0,    28,   153,
-    79,   102,   103,    80,     0,    28,    79,    80,     0,    28,
-     0,    28,   153,     0,    88,     0,   103,    88,     0,   104,
-     0,   103,   104,     0,     0,    31,    79,   105,   107,    80,
-     0,     0,    31,   153,    79,   106,   107,    80,     0,    31,
-   153,    79,    80,     0,    31,    79,    80,     0,    31,   153,
-     0,    31,     0,   108,     0,   107,   108,     0,    33,     0,
-   107,    33,     0,   131,     0,   139,     0,    39,   153,     0,
-    40,    42,     0,    38,    42,     0,    41,   153,     0,    51,
-    52,     0,    51,    53,     0,    51,    54,   153,    45,     0,
-    65,     0,    34,    42,     0,    46,     0,    37,    42,     0,
-    55,   153,     0,     0,    56,   120,   121,     0,   122,     0,
-   121,    81,   122,     0,    59,     0,    60,     0,    61,     0,
-    62,     0,    63,     0,    64,     0,    66,     0,    68,     0,
-    67,     0,    69,     0,     0,    26,   128,   150,     0,     0,
-    27,   130,   150,     0,     5,   153,     0,    35,   153,     0,
-    70,     0,    71,     0,    47,     0,    78,   153,     0,    20,
-    42,     0,    21,   153,     0,     7,   153,     0,     3,   153,
-     0,     4,   153,     0,    48,     0,    48,    79,    80,     0,
-     0,    48,    79,   143,   145,    80,     0,    48,   153,     0,
-     0,    48,   153,    79,   144,   145,    80,     0,   146,     0,
-   145,   146,     0,   147,     0,   140,     0,   141,     0,    49,
-    33,    82,   153,     0,    49,     0,     8,   153,     0,    73,
-   153,     0,    33,     0,    45,     0,   150,    81,    33,     0,
-   150,    81,    45,     0,    33,     0,   151,    81,    33,     0,
-    42,     0,   152,    81,    42,     0,    43,     0,    44,     0,
-    36,     6,     0,     0,    36,     6,   155,   151,     0,    36,
-    10,     0,     0,    36,    10,   157,   152,     0,    36,     9,
-     0,     0,    36,     9,   159,   151,     0,    36,    11,     0,
-    36,    11,    42,     0,    36,    12,     0,     0,    36,    12,
-   162,   151,     0,    36,    13,     0,     0,    36,    13,   164,
-   152,     0,    36,    18,     0,    36,    18,    42,     0,    36,
-    19,   153,     0,    36,    14,     0,     0,    36,    14,   168,
-   151,     0,    36,    15,     0,     0,    36,    15,   170,   151,
-     0,    36,    16,     0,    36,    16,    42,     0,    36,    17,
-     0,    36,    17,    42,     0,    36,    22,     0,    36,    23,
-     0,    36,    23,   175,     0,   153,     0,   153,    83,   153,
-     0,   175,    81,   153,     0,   175,    81,   153,    83,   153,
-     0,    36,    72,     0,    36,   153,    76,    45,     0,    36,
-   153,    31,    33,     0,     0,    36,   153,    74,   178,   151,
-     0,    36,   153,    75,    42,     0,    36,   153,    31,    77,
-     0,    36,   153,    42,    77,     0,    36,   153,    74,     0
+static const short yyrhs[] = {    91,
+     0,     0,    92,     0,    97,     0,    91,    92,     0,    91,
+    97,     0,    93,     0,   116,     0,   117,     0,   115,     0,
+   118,     0,   121,     0,   119,     0,   122,     0,   123,     0,
+   124,     0,   144,     0,   145,     0,   125,     0,   126,     0,
+   130,     0,   131,     0,   132,     0,   175,     0,   133,     0,
+   142,     0,   143,     0,   146,     0,   147,     0,    95,     0,
+    94,     0,   158,     0,   120,     0,   157,     0,   163,     0,
+   165,     0,   167,     0,   169,     0,   170,     0,   172,     0,
+   174,     0,   176,     0,   178,     0,   180,     0,   181,     0,
+   182,     0,   183,     0,   185,     0,   134,     0,   136,     0,
+   186,     0,   141,     0,   149,     0,   150,     0,   139,     0,
+   114,     0,   140,     0,     0,    50,    96,   161,     0,     0,
+    24,    42,    85,    98,   100,    86,     0,     0,    24,   162,
+    85,    99,   100,    86,     0,    24,    42,    85,    86,     0,
+    24,   162,    85,    86,     0,    24,    42,    25,     0,    24,
+   162,    25,     0,    93,     0,   100,    93,     0,   106,     0,
+   100,   106,     0,   101,     0,   100,   101,     0,   151,     0,
+   100,   151,     0,    29,     0,     0,     0,    29,    85,   102,
+   104,   103,    86,     0,    29,    85,    86,     0,   104,   105,
+     0,   105,     0,    30,   162,     0,     0,    28,    85,   107,
+   109,    86,     0,     0,    28,   162,    85,   108,   109,    86,
+     0,    28,    85,    86,     0,    28,     0,    28,   162,     0,
+    94,     0,   109,    94,     0,   110,     0,   109,   110,     0,
+     0,    31,    85,   111,   113,    86,     0,     0,    31,   162,
+    85,   112,   113,    86,     0,    31,   162,    85,    86,     0,
+    31,    85,    86,     0,    31,   162,     0,    31,     0,   114,
+     0,   113,   114,     0,    33,     0,   113,    33,     0,   138,
+     0,   148,     0,    39,   162,     0,    40,    42,     0,    38,
+    42,     0,    41,   162,     0,    51,    52,     0,    51,    53,
+     0,    51,    54,   162,    45,     0,    65,     0,    34,    42,
+     0,    46,     0,    37,    42,     0,    81,   162,     0,    82,
+   162,     0,    83,   162,     0,    84,   162,     0,    55,   162,
+     0,     0,    56,   127,   128,     0,   129,     0,   128,    87,
+   129,     0,    59,     0,    60,     0,    61,     0,    62,     0,
+    63,     0,    64,     0,    66,     0,    68,     0,    67,     0,
+    69,     0,     0,    26,   135,   159,     0,     0,    27,   137,
+   159,     0,     5,   162,     0,    35,   162,     0,    70,     0,
+    71,     0,    47,     0,    78,   162,     0,    20,    42,     0,
+    21,   162,     0,    79,   162,     0,    80,     0,     7,   162,
+     0,     3,   162,     0,     4,   162,     0,    48,     0,    48,
+    85,    86,     0,     0,    48,    85,   152,   154,    86,     0,
+    48,   162,     0,     0,    48,   162,    85,   153,   154,    86,
+     0,   155,     0,   154,   155,     0,   156,     0,   149,     0,
+   150,     0,    49,    33,    88,   162,     0,    49,     0,     8,
+   162,     0,    73,   162,     0,    33,     0,    45,     0,   159,
+    87,    33,     0,   159,    87,    45,     0,    33,     0,   160,
+    87,    33,     0,    42,     0,   161,    87,    42,     0,    43,
+     0,    44,     0,    36,     6,     0,     0,    36,     6,   164,
+   160,     0,    36,    10,     0,     0,    36,    10,   166,   161,
+     0,    36,     9,     0,     0,    36,     9,   168,   160,     0,
+    36,    11,     0,    36,    11,    42,     0,    36,    12,     0,
+     0,    36,    12,   171,   160,     0,    36,    13,     0,     0,
+    36,    13,   173,   161,     0,    36,    18,     0,    36,    18,
+    42,     0,    36,    19,   162,     0,    36,    14,     0,     0,
+    36,    14,   177,   160,     0,    36,    15,     0,     0,    36,
+    15,   179,   160,     0,    36,    16,     0,    36,    16,    42,
+     0,    36,    17,     0,    36,    17,    42,     0,    36,    22,
+     0,    36,    23,     0,    36,    23,   184,     0,   162,     0,
+   162,    89,   162,     0,   184,    87,   162,     0,   184,    87,
+   162,    89,   162,     0,    36,    72,     0,    36,   162,    76,
+    45,     0,    36,   162,    31,    33,     0,     0,    36,   162,
+    74,   187,   160,     0,    36,   162,    75,    42,     0,    36,
+   162,    31,    77,     0,    36,   162,    42,    77,     0,    36,
+   162,    74,     0
 };
 
 #endif
 
 #if (YY_ClntParser_DEBUG != 0) || defined(YY_ClntParser_ERROR_VERBOSE) 
 static const short yyrline[] = { 0,
-   136,   137,   141,   142,   143,   144,   148,   149,   150,   151,
-   152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-   162,   163,   164,   165,   166,   167,   168,   172,   173,   174,
-   175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-   185,   186,   187,   188,   189,   190,   191,   192,   193,   197,
-   198,   199,   200,   201,   205,   207,   215,   220,   230,   237,
-   246,   258,   269,   282,   296,   297,   298,   299,   300,   301,
-   302,   303,   310,   315,   322,   328,   328,   336,   337,   341,
-   353,   357,   362,   367,   377,   386,   392,   403,   404,   405,
-   406,   410,   416,   425,   430,   436,   441,   446,   451,   458,
-   459,   460,   470,   483,   484,   488,   498,   503,   508,   514,
-   515,   516,   524,   531,   538,   547,   553,   556,   559,   564,
-   565,   569,   570,   571,   572,   573,   574,   578,   584,   590,
-   596,   603,   608,   614,   617,   624,   631,   638,   649,   666,
-   673,   680,   697,   705,   712,   719,   726,   732,   738,   742,
-   746,   753,   758,   766,   767,   771,   772,   773,   777,   784,
-   792,   810,   827,   831,   835,   839,   846,   847,   851,   852,
-   855,   856,   863,   869,   873,   882,   887,   890,   899,   905,
-   908,   917,   921,   931,   937,   940,   949,   954,   957,   966,
-   970,   977,   992,   998,  1001,  1010,  1016,  1019,  1028,  1032,
-  1043,  1047,  1057,  1064,  1069,  1077,  1078,  1079,  1080,  1084,
-  1091,  1097,  1105,  1109,  1115,  1121,  1127,  1133
+   137,   138,   142,   143,   144,   145,   149,   150,   151,   152,
+   153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+   163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
+   176,   177,   178,   179,   180,   181,   182,   183,   184,   185,
+   186,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+   196,   197,   201,   202,   203,   204,   205,   209,   211,   219,
+   224,   234,   241,   250,   262,   273,   286,   300,   301,   302,
+   303,   304,   305,   306,   307,   314,   319,   326,   332,   332,
+   340,   341,   345,   357,   361,   366,   371,   381,   390,   396,
+   407,   408,   409,   410,   414,   420,   429,   434,   440,   445,
+   450,   455,   462,   463,   464,   474,   487,   488,   492,   502,
+   507,   512,   518,   519,   520,   528,   535,   542,   551,   557,
+   565,   573,   581,   591,   594,   597,   602,   603,   607,   608,
+   609,   610,   611,   612,   616,   622,   628,   634,   641,   646,
+   652,   655,   662,   669,   676,   687,   704,   711,   718,   735,
+   742,   749,   757,   764,   771,   778,   784,   790,   794,   798,
+   805,   810,   818,   819,   823,   824,   825,   829,   836,   844,
+   862,   879,   883,   887,   891,   898,   899,   903,   904,   907,
+   908,   915,   921,   925,   934,   939,   942,   951,   957,   960,
+   969,   973,   983,   989,   992,  1001,  1006,  1009,  1018,  1022,
+  1029,  1044,  1050,  1053,  1062,  1068,  1071,  1080,  1084,  1095,
+  1099,  1109,  1116,  1121,  1129,  1130,  1131,  1132,  1136,  1143,
+  1149,  1157,  1161,  1167,  1173,  1179,  1185
 };
 
 static const char * const yytname[] = {   "$","error","$illegal.","T1_","T2_",
@@ -978,50 +1007,52 @@ static const char * const yytname[] = {   "$","error","$illegal.","T1_","T2_",
 "DIGEST_HMAC_SHA384_","DIGEST_HMAC_SHA512_","STATELESS_","ANON_INF_REQUEST_",
 "INSIST_MODE_","INACTIVE_MODE_","EXPERIMENTAL_","ADDR_PARAMS_","REMOTE_AUTOCONF_",
 "AFTR_","ROUTING_","ADDRESS_LIST_","STRING_KEYWORD_","DUID_KEYWORD_","REQUEST_",
-"RECONFIGURE_","'{'","'}'","','","'/'","'-'","Grammar","GlobalDeclarationList",
+"RECONFIGURE_","DUMP_INTERVAL_","BINARY_LEASE_DB_","SCRIPT_CONCURRENCY_","SCRIPT_QUEUE_SIZE_",
+"SCRIPT_TIMEOUT_","SCRIPT_BATCH_","'{'","'}'","','","'/'","'-'","Grammar","GlobalDeclarationList",
 "GlobalOptionDeclaration","InterfaceOptionDeclaration","IAOptionDeclaration",
 "DownlinkPrefixInterfaces","@1","InterfaceDeclaration","@2","@3","InterfaceDeclarationsList",
 "TADeclaration","@4","@5","TADeclarationList","IAID","IADeclaration","@6","@7",
 "IADeclarationList","ADDRESDeclaration","@8","@9","ADDRESDeclarationList","ADDRESOptionDeclaration",
 "LogLevelOption","LogModeOption","LogNameOption","LogColors","DuidTypeOption",
-"StatelessMode","WorkDirOption","StrictRfcNoRoutingOption","ScriptName","AuthEnabledOption",
-"AuthAcceptOption","@10","DigestList","Digest","AnonInfRequest","InactiveMode",
-"InsistMode","Experimental","RejectServersOption","@11","PreferServersOption",
+"StatelessMode","WorkDirOption","StrictRfcNoRoutingOption","ScriptName","ScriptOption",
+"AuthEnabledOption","AuthAcceptOption","@10","DigestList","Digest","AnonInfRequest",
+"InactiveMode","InsistMode","Experimental","RejectServersOption","@11","PreferServersOption",
 "@12","PreferredTimeOption","RapidCommitOption","ExperimentalAddrParams","ExperimentalRemoteAutoconf",
-"SkipConfirm","ReconfigureAccept","DdnsProtocol","DdnsTimeout","ValidTimeOption",
-"T1Option","T2Option","PDDeclaration","@13","@14","PDOptionsList","PDOption",
-"Prefix","UnicastOption","Routing","ADDRESDUIDList","ADDRESSList","StringList",
-"Number","DNSServerOption","@15","DomainOption","@16","NTPServerOption","@17",
-"TimeZoneOption","SIPServerOption","@18","SIPDomainOption","@19","FQDNOption",
-"FQDNBits","NISServerOption","@20","NISPServerOption","@21","NISDomainOption",
-"NISPDomainOption","LifetimeOption","VendorSpecOption","VendorSpecList","DsLiteTunnelOption",
-"ExtraOption","@22",""
+"SkipConfirm","ReconfigureAccept","DdnsProtocol","DdnsTimeout","DumpInterval",
+"BinaryLeaseDb","ValidTimeOption","T1Option","T2Option","PDDeclaration","@13",
+"@14","PDOptionsList","PDOption","Prefix","UnicastOption","Routing","ADDRESDUIDList",
+"ADDRESSList","StringList","Number","DNSServerOption","@15","DomainOption","@16",
+"NTPServerOption","@17","TimeZoneOption","SIPServerOption","@18","SIPDomainOption",
+"@19","FQDNOption","FQDNBits","NISServerOption","@20","NISPServerOption","@21",
+"NISDomainOption","NISPDomainOption","LifetimeOption","VendorSpecOption","VendorSpecList",
+"DsLiteTunnelOption","ExtraOption","@22",""
 };
 #endif
 
 static const short yyr1[] = {     0,
-    84,    84,    85,    85,    85,    85,    86,    86,    86,    86,
-    86,    86,    86,    86,    86,    86,    86,    86,    86,    86,
-    86,    86,    86,    86,    86,    86,    86,    87,    87,    87,
-    87,    87,    87,    87,    87,    87,    87,    87,    87,    87,
-    87,    87,    87,    87,    87,    87,    87,    87,    87,    88,
-    88,    88,    88,    88,    90,    89,    92,    91,    93,    91,
-    91,    91,    91,    91,    94,    94,    94,    94,    94,    94,
-    94,    94,    95,    96,    97,    95,    95,    98,    98,    99,
-   101,   100,   102,   100,   100,   100,   100,   103,   103,   103,
-   103,   105,   104,   106,   104,   104,   104,   104,   104,   107,
-   107,   107,   107,   108,   108,   109,   110,   111,   112,   113,
-   113,   113,   114,   115,   116,   117,   118,   120,   119,   121,
-   121,   122,   122,   122,   122,   122,   122,   123,   124,   125,
-   126,   128,   127,   130,   129,   131,   132,   133,   134,   135,
-   136,   137,   138,   139,   140,   141,   142,   142,   143,   142,
-   142,   144,   142,   145,   145,   146,   146,   146,   147,   147,
-   148,   149,   150,   150,   150,   150,   151,   151,   152,   152,
-   153,   153,   154,   155,   154,   156,   157,   156,   158,   159,
-   158,   160,   160,   161,   162,   161,   163,   164,   163,   165,
-   165,   166,   167,   168,   167,   169,   170,   169,   171,   171,
-   172,   172,   173,   174,   174,   175,   175,   175,   175,   176,
-   177,   177,   178,   177,   177,   177,   177,   177
+    90,    90,    91,    91,    91,    91,    92,    92,    92,    92,
+    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+    92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
+    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+    93,    93,    93,    93,    93,    93,    93,    93,    93,    93,
+    93,    93,    94,    94,    94,    94,    94,    96,    95,    98,
+    97,    99,    97,    97,    97,    97,    97,   100,   100,   100,
+   100,   100,   100,   100,   100,   101,   102,   103,   101,   101,
+   104,   104,   105,   107,   106,   108,   106,   106,   106,   106,
+   109,   109,   109,   109,   111,   110,   112,   110,   110,   110,
+   110,   110,   113,   113,   113,   113,   114,   114,   115,   116,
+   117,   118,   119,   119,   119,   120,   121,   122,   123,   124,
+   124,   124,   124,   125,   127,   126,   128,   128,   129,   129,
+   129,   129,   129,   129,   130,   131,   132,   133,   135,   134,
+   137,   136,   138,   139,   140,   141,   142,   143,   144,   145,
+   146,   147,   148,   149,   150,   151,   151,   152,   151,   151,
+   153,   151,   154,   154,   155,   155,   155,   156,   156,   157,
+   158,   159,   159,   159,   159,   160,   160,   161,   161,   162,
+   162,   163,   164,   163,   165,   166,   165,   167,   168,   167,
+   169,   169,   170,   171,   170,   172,   173,   172,   174,   174,
+   175,   176,   177,   176,   178,   179,   178,   180,   180,   181,
+   181,   182,   183,   183,   184,   184,   184,   184,   185,   186,
+   186,   187,   186,   186,   186,   186,   186
 };
 
 static const short yyr2[] = {     0,
@@ -1030,195 +1061,204 @@ static const short yyr2[] = {     0,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     0,     3,     0,     6,     0,     6,
-     4,     4,     3,     3,     1,     2,     1,     2,     1,     2,
-     1,     2,     1,     0,     0,     6,     3,     2,     1,     2,
-     0,     5,     0,     6,     3,     1,     2,     1,     2,     1,
-     2,     0,     5,     0,     6,     4,     3,     2,     1,     1,
-     2,     1,     2,     1,     1,     2,     2,     2,     2,     2,
-     2,     4,     1,     2,     1,     2,     2,     0,     3,     1,
-     3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     0,     3,     0,     3,     2,     2,     1,     1,     1,
-     2,     2,     2,     2,     2,     2,     1,     3,     0,     5,
-     2,     0,     6,     1,     2,     1,     1,     1,     4,     1,
-     2,     2,     1,     1,     3,     3,     1,     3,     1,     3,
-     1,     1,     2,     0,     4,     2,     0,     4,     2,     0,
-     4,     2,     3,     2,     0,     4,     2,     0,     4,     2,
-     3,     3,     2,     0,     4,     2,     0,     4,     2,     3,
-     2,     3,     2,     2,     3,     1,     3,     3,     5,     2,
-     4,     4,     0,     5,     4,     4,     4,     3
+     1,     1,     1,     1,     1,     1,     1,     0,     3,     0,
+     6,     0,     6,     4,     4,     3,     3,     1,     2,     1,
+     2,     1,     2,     1,     2,     1,     0,     0,     6,     3,
+     2,     1,     2,     0,     5,     0,     6,     3,     1,     2,
+     1,     2,     1,     2,     0,     5,     0,     6,     4,     3,
+     2,     1,     1,     2,     1,     2,     1,     1,     2,     2,
+     2,     2,     2,     2,     4,     1,     2,     1,     2,     2,
+     2,     2,     2,     2,     0,     3,     1,     3,     1,     1,
+     1,     1,     1,     1,     1,     1,     1,     1,     0,     3,
+     0,     3,     2,     2,     1,     1,     1,     2,     2,     2,
+     2,     1,     2,     2,     2,     1,     3,     0,     5,     2,
+     0,     6,     1,     2,     1,     1,     1,     4,     1,     2,
+     2,     1,     1,     3,     3,     1,     3,     1,     3,     1,
+     1,     2,     0,     4,     2,     0,     4,     2,     0,     4,
+     2,     3,     2,     0,     4,     2,     0,     4,     2,     3,
+     3,     2,     0,     4,     2,     0,     4,     2,     3,     2,
+     3,     2,     2,     3,     1,     3,     3,     5,     2,     4,
+     4,     0,     5,     4,     4,     4,     3
 };
 
 static const short yydefact[] = {     2,
-     0,     0,     0,     0,     0,     0,     0,     0,   132,   134,
-     0,     0,     0,     0,     0,     0,     0,     0,   115,   140,
-    55,     0,     0,   118,   113,   128,   130,   129,   131,   138,
-   139,     0,     0,     1,     3,     7,    28,    27,     4,    53,
-    10,     8,     9,    11,    13,    30,    12,    14,    15,    18,
-    19,    20,    21,    22,    24,    46,    47,   104,    52,    54,
-    49,    25,    26,    16,    17,   105,    50,    51,    31,    29,
-    32,    33,    34,    35,    36,    37,    38,    23,    39,    40,
-    41,    42,    43,    44,    45,    48,   171,   172,   145,   146,
-   136,   144,   161,   142,   143,     0,     0,     0,     0,   114,
-   137,   173,   179,   176,   182,   184,   187,   193,   196,   199,
-   201,   190,     0,   203,   204,   210,     0,   116,   108,   106,
-   107,   109,     0,   110,   111,     0,   117,     0,   162,   141,
-     5,     6,    63,    57,    64,    59,   163,   164,   133,   135,
-     0,     0,     0,   183,     0,     0,     0,     0,   200,   202,
-   191,   192,   206,   205,     0,     0,   218,     0,     0,   169,
-    56,     0,   122,   123,   124,   125,   126,   127,   119,   120,
-    61,     0,    62,     0,     0,   167,   175,   181,   178,   186,
-   189,   195,   198,     0,     0,   212,   216,   217,     0,   215,
-   211,     0,   112,     0,    86,    73,     0,   147,    65,     0,
-    69,    67,    71,     0,   165,   166,     0,   207,   208,   214,
-   170,   121,    81,    87,    74,   149,   151,    58,    66,    70,
-    68,    72,    60,   168,     0,    85,     0,    83,    77,     0,
-   148,     0,   152,   209,    99,    88,     0,    90,     0,     0,
-    75,    79,   160,   157,   158,     0,   154,   156,     0,    92,
-    98,    82,    89,    91,     0,    80,     0,    78,     0,   150,
-   155,     0,    97,     0,    94,    84,    76,     0,   153,   102,
-     0,   100,    96,     0,   159,   103,    93,   101,     0,    95,
-     0,     0,     0
+     0,     0,     0,     0,     0,     0,     0,     0,   139,   141,
+     0,     0,     0,     0,     0,     0,     0,     0,   118,   147,
+    58,     0,     0,   125,   116,   135,   137,   136,   138,   145,
+   146,     0,     0,     0,   152,     0,     0,     0,     0,     1,
+     3,     7,    31,    30,     4,    56,    10,     8,     9,    11,
+    13,    33,    12,    14,    15,    16,    19,    20,    21,    22,
+    23,    25,    49,    50,   107,    55,    57,    52,    26,    27,
+    17,    18,    28,    29,   108,    53,    54,    34,    32,    35,
+    36,    37,    38,    39,    40,    41,    24,    42,    43,    44,
+    45,    46,    47,    48,    51,   180,   181,   154,   155,   143,
+   153,   170,   149,   150,     0,     0,     0,     0,   117,   144,
+   182,   188,   185,   191,   193,   196,   202,   205,   208,   210,
+   199,     0,   212,   213,   219,     0,   119,   111,   109,   110,
+   112,     0,   113,   114,     0,   124,     0,   171,   148,   151,
+   120,   121,   122,   123,     5,     6,    66,    60,    67,    62,
+   172,   173,   140,   142,     0,     0,     0,   192,     0,     0,
+     0,     0,   209,   211,   200,   201,   215,   214,     0,     0,
+   227,     0,     0,   178,    59,     0,   129,   130,   131,   132,
+   133,   134,   126,   127,    64,     0,    65,     0,     0,   176,
+   184,   190,   187,   195,   198,   204,   207,     0,     0,   221,
+   225,   226,     0,   224,   220,     0,   115,     0,    89,    76,
+     0,   156,    68,     0,    72,    70,    74,     0,   174,   175,
+     0,   216,   217,   223,   179,   128,    84,    90,    77,   158,
+   160,    61,    69,    73,    71,    75,    63,   177,     0,    88,
+     0,    86,    80,     0,   157,     0,   161,   218,   102,    91,
+     0,    93,     0,     0,    78,    82,   169,   166,   167,     0,
+   163,   165,     0,    95,   101,    85,    92,    94,     0,    83,
+     0,    81,     0,   159,   164,     0,   100,     0,    97,    87,
+    79,     0,   162,   105,     0,   103,    99,     0,   168,   106,
+    96,   104,     0,    98,     0,     0,     0
 };
 
-static const short yydefgoto[] = {   281,
-    34,    35,    36,    37,    38,   123,    39,   172,   174,   200,
-   201,   230,   257,   241,   242,   202,   227,   239,   237,   238,
-   264,   274,   271,    40,    41,    42,    43,    44,    45,    46,
-    47,    48,    49,    50,    51,   128,   169,   170,    52,    53,
-    54,    55,    56,    98,    57,    99,    58,    59,    60,    61,
-    62,    63,    64,    65,    66,    67,    68,   203,   232,   249,
-   246,   247,   248,    69,    70,   139,   177,   161,   117,    71,
-   141,    72,   143,    73,   142,    74,    75,   145,    76,   146,
-    77,    78,    79,   147,    80,   148,    81,    82,    83,    84,
-   154,    85,    86,   189
+static const short yydefgoto[] = {   295,
+    40,    41,    42,    43,    44,   132,    45,   186,   188,   214,
+   215,   244,   271,   255,   256,   216,   241,   253,   251,   252,
+   278,   288,   285,    46,    47,    48,    49,    50,    51,    52,
+    53,    54,    55,    56,    57,    58,   137,   183,   184,    59,
+    60,    61,    62,    63,   107,    64,   108,    65,    66,    67,
+    68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
+   217,   246,   263,   260,   261,   262,    78,    79,   153,   191,
+   175,   126,    80,   155,    81,   157,    82,   156,    83,    84,
+   159,    85,   160,    86,    87,    88,   161,    89,   162,    90,
+    91,    92,    93,   168,    94,    95,   203
 };
 
-static const short yypact[] = {   135,
-   122,   122,   122,   122,   122,   -37,   122,   167,-32768,-32768,
-   -26,   122,   259,   -16,    19,   122,    21,   122,-32768,-32768,
--32768,   179,   122,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,   122,   122,   135,-32768,-32768,-32768,-32768,-32768,-32768,
+static const short yypact[] = {   220,
+    -3,    -3,    -3,    -3,    -3,     7,    -3,   123,-32768,-32768,
+    19,    -3,   299,    24,    25,    -3,    48,    -3,-32768,-32768,
+-32768,   128,    -3,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,    -3,    -3,    -3,-32768,    -3,    -3,    -3,    -3,   220,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   -12,   -11,   -15,   -15,-32768,
--32768,    20,    64,    57,    75,    73,    89,   108,   116,   111,
-   121,   126,   122,-32768,   122,-32768,     8,-32768,-32768,-32768,
--32768,-32768,   136,-32768,-32768,   122,-32768,   197,-32768,-32768,
--32768,-32768,-32768,   100,-32768,   112,-32768,-32768,   107,   107,
-   163,   163,   136,-32768,   163,   136,   163,   163,-32768,-32768,
--32768,-32768,   115,   118,    -8,   130,   181,   170,   171,-32768,
-   145,   183,-32768,-32768,-32768,-32768,-32768,-32768,   148,-32768,
--32768,   214,-32768,   214,    -4,-32768,   155,   155,   145,   155,
-   145,   155,   155,   122,   122,-32768,-32768,-32768,   163,-32768,
--32768,   195,-32768,   197,    11,   159,   282,    65,-32768,    16,
--32768,-32768,-32768,    30,-32768,-32768,   211,-32768,   162,   155,
--32768,-32768,   166,   168,   172,   173,   169,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,   122,-32768,   123,-32768,-32768,   224,
--32768,    45,-32768,-32768,    78,-32768,     5,-32768,   123,   122,
-   224,-32768,   230,-32768,-32768,    24,-32768,-32768,    45,   184,
-   187,-32768,-32768,-32768,    67,-32768,   200,-32768,   201,-32768,
--32768,    43,-32768,   182,   206,-32768,-32768,   122,-32768,-32768,
-    55,-32768,-32768,   182,-32768,-32768,-32768,-32768,    72,-32768,
-   289,   290,-32768
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,   -20,    -7,    77,    77,-32768,-32768,
+    14,    73,    63,   112,    81,   132,    82,    86,   133,   143,
+   146,    -3,-32768,    -3,-32768,     8,-32768,-32768,-32768,-32768,
+-32768,   151,-32768,-32768,    -3,-32768,   285,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,    98,-32768,   108,
+-32768,-32768,    76,    76,   162,   162,   151,-32768,   162,   151,
+   162,   162,-32768,-32768,-32768,-32768,   107,   114,    20,   126,
+   167,   163,   159,-32768,   119,   164,-32768,-32768,-32768,-32768,
+-32768,-32768,   127,-32768,-32768,   142,-32768,   142,   110,-32768,
+   129,   129,   119,   129,   119,   129,   129,    -3,    -3,-32768,
+-32768,-32768,   162,-32768,-32768,   168,-32768,   285,    55,   135,
+   314,    68,-32768,    16,-32768,-32768,-32768,    65,-32768,-32768,
+   184,-32768,   141,   129,-32768,-32768,   136,   147,   145,   149,
+   148,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    -3,-32768,
+   121,-32768,-32768,   188,-32768,     5,-32768,-32768,    88,-32768,
+    72,-32768,   121,    -3,   188,-32768,   203,-32768,-32768,     9,
+-32768,-32768,     5,   153,   152,-32768,-32768,-32768,   113,-32768,
+   156,-32768,   155,-32768,-32768,    22,-32768,   154,   165,-32768,
+-32768,    -3,-32768,-32768,    23,-32768,-32768,   154,-32768,-32768,
+-32768,-32768,    41,-32768,   221,   245,-32768
 };
 
 static const short yypgoto[] = {-32768,
--32768,   267,    51,   -60,-32768,-32768,   272,-32768,-32768,   133,
-  -124,-32768,-32768,-32768,    68,   -80,-32768,-32768,    69,  -144,
--32768,-32768,    36,   -44,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,   117,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,  -117,   -98,   -54,-32768,-32768,
-    63,  -155,-32768,-32768,-32768,   215,   -29,   -10,    -1,-32768,
+-32768,   209,  -159,  -112,-32768,-32768,   210,-32768,-32768,    64,
+  -204,-32768,-32768,-32768,    10,   -81,-32768,-32768,    11,  -235,
+-32768,-32768,   -26,   -59,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    60,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   -84,   -74,
+   -54,-32768,-32768,     0,  -180,-32768,-32768,-32768,   161,   -99,
+   -72,    -1,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768
+-32768,-32768,-32768,-32768,-32768,-32768,-32768
 };
 
 
-#define	YYLAST		354
-
-
-static const short yytable[] = {    89,
-    90,    91,    92,    93,    94,    95,    97,     1,     2,     3,
-   101,     4,   133,   135,   120,   100,   122,   137,     1,     2,
-     3,   127,     4,     5,   186,   118,     1,     2,   205,   138,
-   129,   130,     1,     2,     3,   235,     4,     5,   155,    12,
-   206,     9,    10,   195,   196,     1,     2,     1,     2,   156,
-    12,   197,  -174,    87,    88,     9,    10,   195,   196,     3,
-   119,     4,   121,   198,    12,   197,   134,   136,   187,     1,
-     2,     3,   243,     4,    30,   220,     3,   198,     4,   220,
-    25,   157,   158,   159,   252,    30,    31,   276,    32,   213,
-   261,   243,   254,   243,    25,   218,  -180,   235,  -177,    30,
-    31,    12,    32,   260,   276,  -185,   261,    87,    88,   223,
-   254,   152,   178,   153,   244,   180,   144,   182,   183,   221,
-    87,    88,   269,   221,   162,     1,     2,     3,   244,     4,
-  -188,   244,   179,   245,   277,   181,    30,     1,     2,     3,
-  -194,     4,     5,   216,   244,   222,   266,   245,  -197,   222,
-   245,   280,   149,   235,     6,     7,   250,    12,     8,   210,
-     9,    10,   150,   245,    87,    88,   236,   151,    11,    12,
-    13,    14,    15,    16,    17,    18,   253,   160,   236,   171,
-    19,    20,   208,   209,    21,    22,     3,   175,     4,    23,
-    24,   173,    30,   214,   253,   176,   217,   184,   185,    25,
-    26,    27,    28,    29,    30,    31,   188,    32,    96,    87,
-    88,   190,    33,  -213,   270,   191,     1,     2,     3,   272,
-     4,     5,   199,   234,   199,   192,   278,   193,   194,   272,
-   124,   125,   126,   251,   278,   207,   211,   215,   256,     9,
-    10,   195,   196,   224,   225,   226,   228,   233,    12,   197,
-   219,   229,   231,   240,   219,   163,   164,   165,   166,   167,
-   168,   198,   259,   263,   102,   265,   275,   103,   104,   105,
-   106,   107,   108,   109,   110,   111,   112,   113,    25,   267,
-   114,   115,   268,    30,    31,   273,    32,   102,   282,   283,
-   103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
-   131,    87,    88,   114,   115,   132,   204,   255,   258,   279,
-   212,   262,     0,   140,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,    87,    88,     0,     0,     0,     0,
-   116,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+#define	YYLAST		386
+
+
+static const short yytable[] = {    98,
+    99,   100,   101,   102,   147,   104,   106,     1,     2,   234,
+   110,     1,     2,   234,   129,   268,   131,   149,     1,     2,
+     3,   136,     4,     5,     1,     2,   213,     3,   213,     4,
+   138,   139,   140,   268,   141,   142,   143,   144,   169,    96,
+    97,     9,    10,   209,   210,     3,  -183,     4,   103,   170,
+    12,   211,   200,   257,   233,   290,   192,   257,   233,   194,
+   109,   196,   197,   212,   148,   127,   128,     1,     2,     3,
+   257,     4,     5,   290,     1,     2,     3,   150,     4,   275,
+    25,   171,   172,   173,   193,    30,    31,   195,    32,   130,
+     9,    10,   209,   210,   274,   275,   201,    96,    97,    12,
+   211,   232,   249,   224,  -186,  -189,    12,   283,   291,   151,
+    96,    97,   212,  -194,  -203,     1,     2,     3,  -206,     4,
+   166,   152,   167,     1,     2,     3,   294,     4,   250,    25,
+    96,    97,   235,   176,    30,    31,   235,    32,   267,   227,
+   250,    30,   219,   249,     1,     2,     3,    12,     4,     5,
+   237,   249,   230,   158,   220,    12,   267,   266,     3,   236,
+     4,   258,   189,   236,   105,    96,    97,     9,    10,   209,
+   210,   259,   264,  -197,   163,   258,    12,   211,   258,   133,
+   134,   135,    30,   185,   164,   259,   284,   165,   259,   212,
+    30,   258,   174,   187,   190,   198,   222,   223,   280,  -222,
+   199,   259,   202,   205,   204,   206,    25,   228,   207,   225,
+   231,    30,    31,   208,    32,   221,   238,   254,   286,   229,
+   296,   240,     1,     2,     3,   292,     4,     5,   286,   239,
+   243,   242,   247,   292,   245,   273,   279,   248,   277,     6,
+     7,   281,   282,     8,   297,     9,    10,   265,   145,   146,
+   287,   218,   270,    11,    12,    13,    14,    15,    16,    17,
+    18,   293,   276,   269,   272,    19,    20,   226,   154,    21,
+    22,     0,     0,     0,    23,    24,     0,     0,     0,     0,
+   289,     0,     0,     0,    25,    26,    27,    28,    29,    30,
+    31,     0,    32,     0,     0,     0,     0,    33,    34,    35,
+    36,    37,    38,    39,   111,     0,     0,   112,   113,   114,
+   115,   116,   117,   118,   119,   120,   121,   122,     0,   111,
+   123,   124,   112,   113,   114,   115,   116,   117,   118,   119,
+   120,   121,     0,     0,     0,   123,   124,     0,     0,     0,
+     0,    96,    97,   177,   178,   179,   180,   181,   182,     0,
+     0,     0,     0,     0,     0,     0,    96,    97,     0,     0,
      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,   116
+   125,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,     0,     0,   125
 };
 
 static const short yycheck[] = {     1,
-     2,     3,     4,     5,    42,     7,     8,     3,     4,     5,
-    12,     7,    25,    25,    16,    42,    18,    33,     3,     4,
-     5,    23,     7,     8,    33,    42,     3,     4,    33,    45,
-    32,    33,     3,     4,     5,    31,     7,     8,    31,    35,
-    45,    26,    27,    28,    29,     3,     4,     3,     4,    42,
-    35,    36,    33,    43,    44,    26,    27,    28,    29,     5,
-    42,     7,    42,    48,    35,    36,    79,    79,    77,     3,
-     4,     5,    49,     7,    70,   200,     5,    48,     7,   204,
-    65,    74,    75,    76,    80,    70,    71,    33,    73,    79,
-   246,    49,   237,    49,    65,    80,    33,    31,    42,    70,
-    71,    35,    73,    80,    33,    33,   262,    43,    44,    80,
-   255,   113,   142,   115,   232,   145,    42,   147,   148,   200,
-    43,    44,    80,   204,   126,     3,     4,     5,   246,     7,
-    42,   249,   143,   232,    80,   146,    70,     3,     4,     5,
-    33,     7,     8,    79,   262,   200,    80,   246,    33,   204,
-   249,    80,    42,    31,    20,    21,    79,    35,    24,   189,
-    26,    27,    42,   262,    43,    44,   227,    42,    34,    35,
-    36,    37,    38,    39,    40,    41,   237,    42,   239,    80,
-    46,    47,   184,   185,    50,    51,     5,    81,     7,    55,
-    56,    80,    70,   195,   255,    33,   198,    83,    81,    65,
-    66,    67,    68,    69,    70,    71,    77,    73,    42,    43,
-    44,    42,    78,    33,    33,    45,     3,     4,     5,   264,
-     7,     8,   172,   225,   174,    81,   271,    45,    81,   274,
-    52,    53,    54,   235,   279,    81,    42,    79,   240,    26,
-    27,    28,    29,    33,    83,    80,    79,    79,    35,    36,
-   200,    80,    80,    30,   204,    59,    60,    61,    62,    63,
-    64,    48,    33,    80,     6,    79,   268,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    65,    80,
-    22,    23,    82,    70,    71,    80,    73,     6,     0,     0,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    34,    43,    44,    22,    23,    34,   174,   239,   241,   274,
-   194,   249,    -1,    99,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    43,    44,    -1,    -1,    -1,    -1,
-    72,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     2,     3,     4,     5,    25,     7,     8,     3,     4,   214,
+    12,     3,     4,   218,    16,   251,    18,    25,     3,     4,
+     5,    23,     7,     8,     3,     4,   186,     5,   188,     7,
+    32,    33,    34,   269,    36,    37,    38,    39,    31,    43,
+    44,    26,    27,    28,    29,     5,    33,     7,    42,    42,
+    35,    36,    33,    49,   214,    33,   156,    49,   218,   159,
+    42,   161,   162,    48,    85,    42,    42,     3,     4,     5,
+    49,     7,     8,    33,     3,     4,     5,    85,     7,   260,
+    65,    74,    75,    76,   157,    70,    71,   160,    73,    42,
+    26,    27,    28,    29,    86,   276,    77,    43,    44,    35,
+    36,    86,    31,   203,    42,    33,    35,    86,    86,    33,
+    43,    44,    48,    33,    33,     3,     4,     5,    33,     7,
+   122,    45,   124,     3,     4,     5,    86,     7,   241,    65,
+    43,    44,   214,   135,    70,    71,   218,    73,   251,    85,
+   253,    70,    33,    31,     3,     4,     5,    35,     7,     8,
+    86,    31,    85,    42,    45,    35,   269,    86,     5,   214,
+     7,   246,    87,   218,    42,    43,    44,    26,    27,    28,
+    29,   246,    85,    42,    42,   260,    35,    36,   263,    52,
+    53,    54,    70,    86,    42,   260,    33,    42,   263,    48,
+    70,   276,    42,    86,    33,    89,   198,   199,    86,    33,
+    87,   276,    77,    45,    42,    87,    65,   209,    45,    42,
+   212,    70,    71,    87,    73,    87,    33,    30,   278,    85,
+     0,    86,     3,     4,     5,   285,     7,     8,   288,    89,
+    86,    85,    85,   293,    86,    33,    85,   239,    86,    20,
+    21,    86,    88,    24,     0,    26,    27,   249,    40,    40,
+    86,   188,   254,    34,    35,    36,    37,    38,    39,    40,
+    41,   288,   263,   253,   255,    46,    47,   208,   108,    50,
+    51,    -1,    -1,    -1,    55,    56,    -1,    -1,    -1,    -1,
+   282,    -1,    -1,    -1,    65,    66,    67,    68,    69,    70,
+    71,    -1,    73,    -1,    -1,    -1,    -1,    78,    79,    80,
+    81,    82,    83,    84,     6,    -1,    -1,     9,    10,    11,
+    12,    13,    14,    15,    16,    17,    18,    19,    -1,     6,
+    22,    23,     9,    10,    11,    12,    13,    14,    15,    16,
+    17,    18,    -1,    -1,    -1,    22,    23,    -1,    -1,    -1,
+    -1,    43,    44,    59,    60,    61,    62,    63,    64,    -1,
+    -1,    -1,    -1,    -1,    -1,    -1,    43,    44,    -1,    -1,
     -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    72
+    72,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    -1,    -1,    72
 };
 
 #line 352 "../bison++/bison.cc"
@@ -1714,35 +1754,35 @@ YYLABEL(yyreduce)
 
   switch (yyn) {
 
-case 55:
-#line 205 "ClntParser.y"
+case 58:
+#line 209 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 56:
-#line 207 "ClntParser.y"
+case 59:
+#line 211 "ClntParser.y"
 {
     CfgMgr->setDownlinkPrefixIfaces(PresentStringLst);
 ;
     break;}
-case 57:
-#line 216 "ClntParser.y"
+case 60:
+#line 220 "ClntParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].strval))
 	YYABORT;
 ;
     break;}
-case 58:
-#line 221 "ClntParser.y"
+case 61:
+#line 225 "ClntParser.y"
 {
     delete [] yyvsp[-4].strval;
     if (!EndIfaceDeclaration())
 	YYABORT;
 ;
     break;}
-case 59:
-#line 231 "ClntParser.y"
+case 62:
+#line 235 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-1].ival))
 	YYABORT;
@@ -1750,15 +1790,15 @@ case 59:
 	YYABORT;
 ;
     break;}
-case 60:
-#line 238 "ClntParser.y"
+case 63:
+#line 242 "ClntParser.y"
 {
     if (!EndIfaceDeclaration())
 	YYABORT;
 ;
     break;}
-case 61:
-#line 247 "ClntParser.y"
+case 64:
+#line 251 "ClntParser.y"
 {
     if (!IfaceDefined(string(yyvsp[-2].strval)))
 	YYABORT;
@@ -1767,8 +1807,8 @@ case 61:
     EmptyIface();
 ;
     break;}
-case 62:
-#line 259 "ClntParser.y"
+case 65:
+#line 263 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-2].ival))
 	YYABORT;
@@ -1776,8 +1816,8 @@ case 62:
     EmptyIface();
 ;
     break;}
-case 63:
-#line 270 "ClntParser.y"
+case 66:
+#line 274 "ClntParser.y"
 {
     if (!IfaceDefined(string(yyvsp[-1].strval)))
 	YYABORT;
@@ -1787,8 +1827,8 @@ case 63:
     delete yyvsp[-1].strval;
 ;
     break;}
-case 64:
-#line 283 "ClntParser.y"
+case 67:
+#line 287 "ClntParser.y"
 {
     if (!IfaceDefined(yyvsp[-1].ival))
 	YYABORT;
@@ -1797,87 +1837,87 @@ case 64:
     ClntCfgIfaceLst.getLast()->setNoConfig();
 ;
     break;}
-case 73:
-#line 311 "ClntParser.y"
+case 76:
+#line 315 "ClntParser.y"
 {
     //Log(Crit) << "TA without params." << LogEnd;
     this->ClntCfgTALst.append( new TClntCfgTA() ); // append new TA
 ;
     break;}
-case 74:
-#line 316 "ClntParser.y"
+case 77:
+#line 320 "ClntParser.y"
 {
     //Log(Crit) << "TA with params started." << LogEnd;
     this->ClntCfgTALst.append( new TClntCfgTA() ); // append new TA
     this->iaidSet = false;
 ;
     break;}
-case 75:
-#line 322 "ClntParser.y"
+case 78:
+#line 326 "ClntParser.y"
 {
     if (this->iaidSet)
 	this->ClntCfgTALst.getLast()->setIAID(this->iaid);
     //Log(Crit) << "TA with params ended." << LogEnd;
 ;
     break;}
-case 77:
-#line 329 "ClntParser.y"
+case 80:
+#line 333 "ClntParser.y"
 {
     //Log(Crit) << "TA without params." << LogEnd;
     this->ClntCfgTALst.append( new TClntCfgTA() ); // append new TA
 ;
     break;}
-case 80:
-#line 342 "ClntParser.y"
+case 83:
+#line 346 "ClntParser.y"
 {
     this->iaidSet = true;
     this->iaid = yyvsp[0].ival;
     Log(Crit) << "IAID=" << this->iaid << " parsed." << LogEnd;
 ;
     break;}
-case 81:
-#line 354 "ClntParser.y"
+case 84:
+#line 358 "ClntParser.y"
 {
     StartIADeclaration(false);
 ;
     break;}
-case 82:
-#line 358 "ClntParser.y"
+case 85:
+#line 362 "ClntParser.y"
 {
     EndIADeclaration();
 ;
     break;}
-case 83:
-#line 363 "ClntParser.y"
+case 86:
+#line 367 "ClntParser.y"
 {
     StartIADeclaration(false);
     this->iaid = yyvsp[-1].ival;
 ;
     break;}
-case 84:
-#line 368 "ClntParser.y"
+case 87:
+#line 372 "ClntParser.y"
 {
     EndIADeclaration();
     Log(Info) << "Setting IAID to " << this->iaid << LogEnd;
     ClntCfgIALst.getLast()->setIAID(this->iaid);
 ;
     break;}
-case 85:
-#line 378 "ClntParser.y"
+case 88:
+#line 382 "ClntParser.y"
 {
     StartIADeclaration(true);
     EndIADeclaration();
 ;
     break;}
-case 86:
-#line 387 "ClntParser.y"
+case 89:
+#line 391 "ClntParser.y"
 {
     StartIADeclaration(true);
     EndIADeclaration();
 ;
     break;}
-case 87:
-#line 393 "ClntParser.y"
+case 90:
+#line 397 "ClntParser.y"
 {
     StartIADeclaration(true);
     EndIADeclaration();
@@ -1885,16 +1925,16 @@ case 87:
     ClntCfgIALst.getLast()->setIAID(yyvsp[0].ival);
 ;
     break;}
-case 92:
-#line 411 "ClntParser.y"
+case 95:
+#line 415 "ClntParser.y"
 {
     SPtr<TClntParsGlobalOpt> globalOpt = ParserOptStack.getLast();
     SPtr<TClntParsGlobalOpt> newOpt = new TClntParsGlobalOpt(*globalOpt);
     ParserOptStack.append(newOpt);
 ;
     break;}
-case 93:
-#line 417 "ClntParser.y"
+case 96:
+#line 421 "ClntParser.y"
 {
     //ClntCfgAddrLst.append(SPtr<TClntCfgAddr> (new TClntCfgAddr()));
     //set proper options specific for this Address
@@ -1903,46 +1943,46 @@ case 93:
 	ParserOptStack.delLast();
 ;
     break;}
-case 94:
-#line 426 "ClntParser.y"
+case 97:
+#line 430 "ClntParser.y"
 {
     ParserOptStack.append(new TClntParsGlobalOpt(*ParserOptStack.getLast()));
     ParserOptStack.getLast()->setAddrHint(false);
 ;
     break;}
-case 95:
-#line 431 "ClntParser.y"
+case 98:
+#line 435 "ClntParser.y"
 {
     for (int i=0;i<yyvsp[-4].ival; i++) EmptyAddr();
     ParserOptStack.delLast();
 ;
     break;}
-case 96:
-#line 437 "ClntParser.y"
+case 99:
+#line 441 "ClntParser.y"
 {
     for (int i=0;i<yyvsp[-2].ival; i++) EmptyAddr();
 ;
     break;}
-case 97:
-#line 442 "ClntParser.y"
+case 100:
+#line 446 "ClntParser.y"
 {
     EmptyAddr();
 ;
     break;}
-case 98:
-#line 447 "ClntParser.y"
+case 101:
+#line 451 "ClntParser.y"
 {
     for (int i=0;i<yyvsp[0].ival; i++) EmptyAddr();
 ;
     break;}
-case 99:
-#line 452 "ClntParser.y"
+case 102:
+#line 456 "ClntParser.y"
 {
     EmptyAddr();
 ;
     break;}
-case 102:
-#line 461 "ClntParser.y"
+case 105:
+#line 465 "ClntParser.y"
 {
     if (ParserOptStack.getLast()->getAddrHint())
     {
@@ -1953,8 +1993,8 @@ case 102:
 	YYABORT;  //this is aggregated version of IA
 ;
     break;}
-case 103:
-#line 471 "ClntParser.y"
+case 106:
+#line 475 "ClntParser.y"
 {
     if (ParserOptStack.getLast()->getAddrHint())
     {
@@ -1965,8 +2005,8 @@ case 103:
 	YYABORT; //here is agregated version of IA
 ;
     break;}
-case 106:
-#line 489 "ClntParser.y"
+case 109:
+#line 493 "ClntParser.y"
 {
     if ( (yyvsp[0].ival<1) || (yyvsp[0].ival>8) ) {
 	Log(Crit) << "Invalid loglevel specified: " << yyvsp[0].ival << ". Allowed range: 1-8." << LogEnd;
@@ -1974,170 +2014,210 @@ case 106:
     logger::setLogLevel(yyvsp[0].ival);
 ;
     break;}
-case 107:
-#line 498 "ClntParser.y"
+case 110:
+#line 502 "ClntParser.y"
 {
     logger::setLogMode(yyvsp[0].strval);
 ;
     break;}
-case 108:
-#line 503 "ClntParser.y"
+case 111:
+#line 507 "ClntParser.y"
 {
     logger::setLogName(yyvsp[0].strval);
 ;
     break;}
-case 109:
-#line 509 "ClntParser.y"
+case 112:
+#line 513 "ClntParser.y"
 {
     logger::setColors(yyvsp[0].ival==1);
 ;
     break;}
-case 110:
-#line 514 "ClntParser.y"
+case 113:
+#line 518 "ClntParser.y"
 { this->DUIDType  = DUID_TYPE_LLT;;
     break;}
-case 111:
-#line 515 "ClntParser.y"
+case 114:
+#line 519 "ClntParser.y"
 { this->DUIDType  = DUID_TYPE_LL; ;
     break;}
-case 112:
-#line 516 "ClntParser.y"
+case 115:
+#line 520 "ClntParser.y"
 {
   this->DUIDType       = DUID_TYPE_EN;
   this->DUIDEnterpriseNumber = yyvsp[-1].ival;
   this->DUIDEnterpriseID     = new TDUID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length);
 ;
     break;}
-case 113:
-#line 525 "ClntParser.y"
+case 116:
+#line 529 "ClntParser.y"
 {
     ParserOptStack.getLast()->setIsIAs(false);
 ;
     break;}
-case 114:
-#line 532 "ClntParser.y"
+case 117:
+#line 536 "ClntParser.y"
 {
     ParserOptStack.getLast()->setWorkDir(yyvsp[0].strval);
 ;
     break;}
-case 115:
-#line 539 "ClntParser.y"
+case 118:
+#line 543 "ClntParser.y"
 {
     Log(Notice) << "Strict-rfc-no-routing directive set: addresses will be added with 128 prefix." << LogEnd;
     ParserOptStack.getLast()->setPrefixLength(128);
     // by default prefix is set to 128
 ;
     break;}
-case 116:
-#line 548 "ClntParser.y"
+case 119:
+#line 552 "ClntParser.y"
 {
     CfgMgr->setScript(yyvsp[0].strval);
 ;
     break;}
-case 117:
-#line 553 "ClntParser.y"
+case 120:
+#line 558 "ClntParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-concurrency must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptConcurrency(yyvsp[0].ival);
+;
+    break;}
+case 121:
+#line 566 "ClntParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-queue-size must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptQueueSize(yyvsp[0].ival);
+;
+    break;}
+case 122:
+#line 574 "ClntParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-timeout must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptTimeout(yyvsp[0].ival);
+;
+    break;}
+case 123:
+#line 582 "ClntParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-batch must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptBatch(yyvsp[0].ival);
+;
+    break;}
+case 124:
+#line 591 "ClntParser.y"
 { ParserOptStack.getLast()->setAuthEnabled(yyvsp[0].ival); ;
     break;}
-case 118:
-#line 557 "ClntParser.y"
+case 125:
+#line 595 "ClntParser.y"
 {
     DigestLst.clear();
 ;
     break;}
-case 119:
-#line 559 "ClntParser.y"
+case 126:
+#line 597 "ClntParser.y"
 {
     ParserOptStack.getLast()->setAuthAcceptMethods(DigestLst);
 ;
     break;}
-case 122:
-#line 569 "ClntParser.y"
+case 129:
+#line 607 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_MD5; DigestLst.append(dt); ;
     break;}
-case 123:
-#line 570 "ClntParser.y"
+case 130:
+#line 608 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_SHA1; DigestLst.append(dt); ;
     break;}
-case 124:
-#line 571 "ClntParser.y"
+case 131:
+#line 609 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_SHA224; DigestLst.append(dt); ;
     break;}
-case 125:
-#line 572 "ClntParser.y"
+case 132:
+#line 610 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_SHA256; DigestLst.append(dt); ;
     break;}
-case 126:
-#line 573 "ClntParser.y"
+case 133:
+#line 611 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_SHA384; DigestLst.append(dt); ;
     break;}
-case 127:
-#line 574 "ClntParser.y"
+case 134:
+#line 612 "ClntParser.y"
 { SPtr<DigestTypes> dt = new DigestTypes; *dt = DIGEST_HMAC_SHA512; DigestLst.append(dt); ;
     break;}
-case 128:
-#line 579 "ClntParser.y"
+case 135:
+#line 617 "ClntParser.y"
 {
     ParserOptStack.getLast()->setAnonInfRequest(true);
 ;
     break;}
-case 129:
-#line 585 "ClntParser.y"
+case 136:
+#line 623 "ClntParser.y"
 {
     ParserOptStack.getLast()->setInactiveMode(true);
 ;
     break;}
-case 130:
-#line 591 "ClntParser.y"
+case 137:
+#line 629 "ClntParser.y"
 {
     ParserOptStack.getLast()->setInsistMode(true);
 ;
     break;}
-case 131:
-#line 597 "ClntParser.y"
+case 138:
+#line 635 "ClntParser.y"
 {
     Log(Crit) << "Experimental features are allowed." << LogEnd;
     ParserOptStack.getLast()->setExperimental();
 ;
     break;}
-case 132:
-#line 604 "ClntParser.y"
+case 139:
+#line 642 "ClntParser.y"
 {
     //ParserOptStack.getLast()->clearRejedSrv();
     PresentStationLst.clear();
 ;
     break;}
-case 133:
-#line 608 "ClntParser.y"
+case 140:
+#line 646 "ClntParser.y"
 {
     ParserOptStack.getLast()->setRejedSrvLst(&PresentStationLst);
 ;
     break;}
-case 134:
-#line 615 "ClntParser.y"
+case 141:
+#line 653 "ClntParser.y"
 {
     PresentStationLst.clear();
 ;
     break;}
-case 135:
-#line 617 "ClntParser.y"
+case 142:
+#line 655 "ClntParser.y"
 {
     ParserOptStack.getLast()->setPrefSrvLst(&PresentStationLst);
 ;
     break;}
-case 136:
-#line 625 "ClntParser.y"
+case 143:
+#line 663 "ClntParser.y"
 {
     ParserOptStack.getLast()->setPref(yyvsp[0].ival);
 ;
     break;}
-case 137:
-#line 632 "ClntParser.y"
+case 144:
+#line 670 "ClntParser.y"
 {
     ParserOptStack.getLast()->setRapidCommit(yyvsp[0].ival);
 ;
     break;}
-case 138:
-#line 639 "ClntParser.y"
+case 145:
+#line 677 "ClntParser.y"
 {
 	if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'addr-params' defined, but experimental features are disabled."
@@ -2147,8 +2227,8 @@ case 138:
     ParserOptStack.getLast()->setAddrParams(true);
 ;
     break;}
-case 139:
-#line 650 "ClntParser.y"
+case 146:
+#line 688 "ClntParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental remote autoconfiguration feature defined, but experimental"
@@ -2163,22 +2243,22 @@ case 139:
 #endif
 ;
     break;}
-case 140:
-#line 667 "ClntParser.y"
+case 147:
+#line 705 "ClntParser.y"
 {
     Log(Debug) << "CONFIRM support disabled (skip-confirm in client.conf)." << LogEnd;
     ParserOptStack.getLast()->setConfirm(false);
 ;
     break;}
-case 141:
-#line 674 "ClntParser.y"
+case 148:
+#line 712 "ClntParser.y"
 {
     Log(Debug) << "Reconfigure accept " << ((yyvsp[0].ival>0)?"enabled":"disabled") << "." << LogEnd;
     CfgMgr->setReconfigure(yyvsp[0].ival);
 ;
     break;}
-case 142:
-#line 681 "ClntParser.y"
+case 149:
+#line 719 "ClntParser.y"
 {
     if (!strcasecmp(yyvsp[0].strval,"tcp"))
 	CfgMgr->setDDNSProtocol(TCfgMgr::DNSUPDATE_TCP);
@@ -2194,61 +2274,75 @@ case 142:
     Log(Debug) << "DDNS: Setting protocol to " << (yyvsp[0].strval) << LogEnd;
 ;
     break;}
-case 143:
-#line 698 "ClntParser.y"
+case 150:
+#line 736 "ClntParser.y"
 {
     Log(Debug) << "DDNS: Setting timeout to " << yyvsp[0].ival << "ms." << LogEnd;
     CfgMgr->setDDNSTimeout(yyvsp[0].ival);
 ;
     break;}
-case 144:
-#line 706 "ClntParser.y"
+case 151:
+#line 743 "ClntParser.y"
+{
+    Log(Debug) << "State dumps will be written at most every " << yyvsp[0].ival << " second(s)." << LogEnd;
+    CfgMgr->setDumpInterval(yyvsp[0].ival);
+;
+    break;}
+case 152:
+#line 750 "ClntParser.y"
+{
+    Log(Debug) << "Binary copy of lease database (" << CLNTADDRDB_FILE << ") enabled." << LogEnd;
+    CfgMgr->setBinaryLeaseDb(true);
+;
+    break;}
+case 153:
+#line 758 "ClntParser.y"
 {
     ParserOptStack.getLast()->setValid(yyvsp[0].ival);
 ;
     break;}
-case 145:
-#line 713 "ClntParser.y"
+case 154:
+#line 765 "ClntParser.y"
 {
     ParserOptStack.getLast()->setT1(yyvsp[0].ival);
 ;
     break;}
-case 146:
-#line 720 "ClntParser.y"
+case 155:
+#line 772 "ClntParser.y"
 {
     ParserOptStack.getLast()->setT2(yyvsp[0].ival);
 ;
     break;}
-case 147:
-#line 727 "ClntParser.y"
+case 156:
+#line 779 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option found." << LogEnd;
     StartPDDeclaration();
     EndPDDeclaration();
 ;
     break;}
-case 148:
-#line 733 "ClntParser.y"
+case 157:
+#line 785 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option found." << LogEnd;
     StartPDDeclaration();
     EndPDDeclaration();
 ;
     break;}
-case 149:
-#line 739 "ClntParser.y"
+case 158:
+#line 791 "ClntParser.y"
 {
     StartPDDeclaration();
 ;
     break;}
-case 150:
-#line 743 "ClntParser.y"
+case 159:
+#line 795 "ClntParser.y"
 {
     EndPDDeclaration();
 ;
     break;}
-case 151:
-#line 747 "ClntParser.y"
+case 160:
+#line 799 "ClntParser.y"
 {
     Log(Debug) << "Prefix delegation option found, setting IAID to" << yyvsp[0].ival << LogEnd;
     StartPDDeclaration();
@@ -2256,22 +2350,22 @@ case 151:
     ClntCfgPDLst.getLast()->setIAID(yyvsp[0].ival);
 ;
     break;}
-case 152:
-#line 754 "ClntParser.y"
+case 161:
+#line 806 "ClntParser.y"
 {
     StartPDDeclaration();
     this->iaid = yyvsp[-1].ival;
 ;
     break;}
-case 153:
-#line 759 "ClntParser.y"
+case 162:
+#line 811 "ClntParser.y"
 {
     EndPDDeclaration();
     ClntCfgPDLst.getLast()->setIAID(yyvsp[-4].ival);
 ;
     break;}
-case 159:
-#line 778 "ClntParser.y"
+case 168:
+#line 830 "ClntParser.y"
 {
     SPtr<TIPv6Addr> addr = new TIPv6Addr(yyvsp[-2].addrval);
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(addr, (yyvsp[0].ival));
@@ -2279,16 +2373,16 @@ case 159:
     Log(Debug) << "PD: Adding single prefix " << addr->getPlain() << "/" << (yyvsp[0].ival) << "." << LogEnd;
 ;
     break;}
-case 160:
-#line 785 "ClntParser.y"
+case 169:
+#line 837 "ClntParser.y"
 {
     Log(Debug) << "PD: Adding single prefix." << LogEnd;
     SPtr<TClntCfgPrefix> prefix = new TClntCfgPrefix(new TIPv6Addr("::",true), 0);
     PrefixLst.append(prefix);
 ;
     break;}
-case 161:
-#line 793 "ClntParser.y"
+case 170:
+#line 845 "ClntParser.y"
 {
     switch(yyvsp[0].ival) {
     case 0:
@@ -2304,8 +2398,8 @@ case 161:
     }
 ;
     break;}
-case 162:
-#line 811 "ClntParser.y"
+case 171:
+#line 863 "ClntParser.y"
 {
     switch(yyvsp[0].ival) {
     case 0:
@@ -2321,178 +2415,178 @@ case 162:
     }
 ;
     break;}
-case 163:
-#line 828 "ClntParser.y"
+case 172:
+#line 880 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<TStationID> (new TStationID(new TIPv6Addr(yyvsp[0].addrval))));
 ;
     break;}
-case 164:
-#line 832 "ClntParser.y"
+case 173:
+#line 884 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<TStationID> (new TStationID(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length))));
 ;
     break;}
-case 165:
-#line 836 "ClntParser.y"
+case 174:
+#line 888 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<TStationID> (new TStationID(new TIPv6Addr(yyvsp[0].addrval))));
 ;
     break;}
-case 166:
-#line 840 "ClntParser.y"
+case 175:
+#line 892 "ClntParser.y"
 {
     PresentStationLst.append(SPtr<TStationID> (new TStationID( new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length))));
 ;
     break;}
-case 167:
-#line 846 "ClntParser.y"
+case 176:
+#line 898 "ClntParser.y"
 {PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr(yyvsp[0].addrval)));;
     break;}
-case 168:
-#line 847 "ClntParser.y"
+case 177:
+#line 899 "ClntParser.y"
 {PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr(yyvsp[0].addrval)));;
     break;}
-case 169:
-#line 851 "ClntParser.y"
+case 178:
+#line 903 "ClntParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 170:
-#line 852 "ClntParser.y"
+case 179:
+#line 904 "ClntParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 171:
-#line 855 "ClntParser.y"
+case 180:
+#line 907 "ClntParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 172:
-#line 856 "ClntParser.y"
+case 181:
+#line 908 "ClntParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 173:
-#line 864 "ClntParser.y"
+case 182:
+#line 916 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setDNSServerLst(&PresentAddrLst);
 ;
     break;}
-case 174:
-#line 870 "ClntParser.y"
+case 183:
+#line 922 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 175:
-#line 873 "ClntParser.y"
+case 184:
+#line 925 "ClntParser.y"
 {
     ParserOptStack.getLast()->setDNSServerLst(&PresentAddrLst);
 ;
     break;}
-case 176:
-#line 883 "ClntParser.y"
+case 185:
+#line 935 "ClntParser.y"
 {
     PresentStringLst.clear();
     ParserOptStack.getLast()->setDomainLst(&PresentStringLst);
 ;
     break;}
-case 177:
-#line 887 "ClntParser.y"
+case 186:
+#line 939 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 178:
-#line 890 "ClntParser.y"
+case 187:
+#line 942 "ClntParser.y"
 {
     ParserOptStack.getLast()->setDomainLst(&PresentStringLst);
 ;
     break;}
-case 179:
-#line 900 "ClntParser.y"
+case 188:
+#line 952 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 180:
-#line 905 "ClntParser.y"
+case 189:
+#line 957 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 181:
-#line 908 "ClntParser.y"
+case 190:
+#line 960 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 182:
-#line 918 "ClntParser.y"
+case 191:
+#line 970 "ClntParser.y"
 {
     ParserOptStack.getLast()->setTimezone(string(""));
   ;
     break;}
-case 183:
-#line 922 "ClntParser.y"
+case 192:
+#line 974 "ClntParser.y"
 {
     ParserOptStack.getLast()->setTimezone(yyvsp[0].strval);
 ;
     break;}
-case 184:
-#line 932 "ClntParser.y"
+case 193:
+#line 984 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 185:
-#line 937 "ClntParser.y"
+case 194:
+#line 989 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 186:
-#line 940 "ClntParser.y"
+case 195:
+#line 992 "ClntParser.y"
 {
     ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 187:
-#line 950 "ClntParser.y"
+case 196:
+#line 1002 "ClntParser.y"
 {
     PresentStringLst.clear();
     ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 188:
-#line 954 "ClntParser.y"
+case 197:
+#line 1006 "ClntParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 189:
-#line 957 "ClntParser.y"
+case 198:
+#line 1009 "ClntParser.y"
 {
     ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 190:
-#line 967 "ClntParser.y"
+case 199:
+#line 1019 "ClntParser.y"
 {
     ParserOptStack.getLast()->setFQDN(string(""));
 ;
     break;}
-case 191:
-#line 971 "ClntParser.y"
+case 200:
+#line 1023 "ClntParser.y"
 {
     ParserOptStack.getLast()->setFQDN(yyvsp[0].strval);
 ;
     break;}
-case 192:
-#line 978 "ClntParser.y"
+case 201:
+#line 1030 "ClntParser.y"
 {
     if (yyvsp[0].ival!=0 && yyvsp[0].ival!=1) {
 	Log(Crit) << "Invalid FQDN S bit value: " << yyvsp[0].ival << ", expected 0 or 1." << LogEnd;
@@ -2503,122 +2597,122 @@ case 192:
     ParserOptStack.getLast()->setFQDNFlagS(yyvsp[0].ival);
 ;
     break;}
-case 193:
-#line 993 "ClntParser.y"
+case 202:
+#line 1045 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 194:
-#line 998 "ClntParser.y"
+case 203:
+#line 1050 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 195:
-#line 1001 "ClntParser.y"
+case 204:
+#line 1053 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 196:
-#line 1011 "ClntParser.y"
+case 205:
+#line 1063 "ClntParser.y"
 {
     PresentAddrLst.clear();
 //    PresentAddrLst.append(SPtr<TIPv6Addr> (new TIPv6Addr()));
     ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 197:
-#line 1016 "ClntParser.y"
+case 206:
+#line 1068 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 198:
-#line 1019 "ClntParser.y"
+case 207:
+#line 1071 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 199:
-#line 1029 "ClntParser.y"
+case 208:
+#line 1081 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISDomain("");
 ;
     break;}
-case 200:
-#line 1033 "ClntParser.y"
+case 209:
+#line 1085 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISDomain(yyvsp[0].strval);
 ;
     break;}
-case 201:
-#line 1044 "ClntParser.y"
+case 210:
+#line 1096 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPDomain("");
 ;
     break;}
-case 202:
-#line 1048 "ClntParser.y"
+case 211:
+#line 1100 "ClntParser.y"
 {
     ParserOptStack.getLast()->setNISPDomain(yyvsp[0].strval);
 ;
     break;}
-case 203:
-#line 1058 "ClntParser.y"
+case 212:
+#line 1110 "ClntParser.y"
 {
     ParserOptStack.getLast()->setLifetime();
 ;
     break;}
-case 204:
-#line 1065 "ClntParser.y"
+case 213:
+#line 1117 "ClntParser.y"
 {
     Log(Debug) << "VendorSpec defined (no details)." << LogEnd;
     ParserOptStack.getLast()->setVendorSpec();
 ;
     break;}
-case 205:
-#line 1070 "ClntParser.y"
+case 214:
+#line 1122 "ClntParser.y"
 {
     ParserOptStack.getLast()->setVendorSpec();
     Log(Debug) << "VendorSpec defined (multiple times)." << LogEnd;
 ;
     break;}
-case 206:
-#line 1077 "ClntParser.y"
+case 215:
+#line 1129 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(yyvsp[0].ival,0,0,0,0) ); ;
     break;}
-case 207:
-#line 1078 "ClntParser.y"
+case 216:
+#line 1130 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(yyvsp[-2].ival,yyvsp[0].ival,0,0,0) ); ;
     break;}
-case 208:
-#line 1079 "ClntParser.y"
+case 217:
+#line 1131 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(yyvsp[0].ival,0,0,0,0) ); ;
     break;}
-case 209:
-#line 1080 "ClntParser.y"
+case 218:
+#line 1132 "ClntParser.y"
 { VendorSpec.append( new TOptVendorSpecInfo(yyvsp[-2].ival,yyvsp[0].ival,0,0,0) ); ;
     break;}
-case 210:
-#line 1085 "ClntParser.y"
+case 219:
+#line 1137 "ClntParser.y"
 {
     ClntCfgIfaceLst.getLast()->addExtraOption(OPTION_AFTR_NAME, TOpt::Layout_String, false);
 ;
     break;}
-case 211:
-#line 1092 "ClntParser.y"
+case 220:
+#line 1144 "ClntParser.y"
 {
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", valuelen=" << yyvsp[0].duidval.length << LogEnd;
     SPtr<TOpt> opt = new TOptGeneric(yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
     ClntCfgIfaceLst.getLast()->addExtraOption(opt, TOpt::Layout_Duid, false);
 ;
     break;}
-case 212:
-#line 1098 "ClntParser.y"
+case 221:
+#line 1150 "ClntParser.y"
 {
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
 
@@ -2627,14 +2721,14 @@ case 212:
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", address=" << addr->getPlain() << LogEnd;
 ;
     break;}
-case 213:
-#line 1106 "ClntParser.y"
+case 222:
+#line 1158 "ClntParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 214:
-#line 1109 "ClntParser.y"
+case 223:
+#line 1161 "ClntParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(yyvsp[-3].ival, PresentAddrLst, 0);
     ClntCfgIfaceLst.getLast()->addExtraOption(opt, TOpt::Layout_AddrLst, false);
@@ -2642,32 +2736,32 @@ case 214:
 	       << PresentAddrLst.count() << " addresses." << LogEnd;
 ;
     break;}
-case 215:
-#line 1116 "ClntParser.y"
+case 224:
+#line 1168 "ClntParser.y"
 {
     SPtr<TOpt> opt = new TOptString(yyvsp[-2].ival, string(yyvsp[0].strval), 0);
     ClntCfgIfaceLst.getLast()->addExtraOption(opt, TOpt::Layout_String, false);
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", string=" << yyvsp[0].strval << LogEnd;
 ;
     break;}
-case 216:
-#line 1122 "ClntParser.y"
+case 225:
+#line 1174 "ClntParser.y"
 {
     // just request this option and expect OptAddr layout
     Log(Debug) << "Extra option requested: code=" << yyvsp[-2].ival << LogEnd;
     ClntCfgIfaceLst.getLast()->addExtraOption(yyvsp[-2].ival, TOpt::Layout_Addr, false);
 ;
     break;}
-case 217:
-#line 1128 "ClntParser.y"
+case 226:
+#line 1180 "ClntParser.y"
 {
     // just request this option and expect OptString layout
     Log(Debug) << "Extra option requested: code=" << yyvsp[-2].ival << LogEnd;
     ClntCfgIfaceLst.getLast()->addExtraOption(yyvsp[-2].ival, TOpt::Layout_String, false);
 ;
     break;}
-case 218:
-#line 1134 "ClntParser.y"
+case 227:
+#line 1186 "ClntParser.y"
 {
     // just request this option and expect OptAddrLst layout
     Log(Debug) << "Extra option requested: code=" << yyvsp[-1].ival << LogEnd;
@@ -2878,7 +2972,7 @@ YYLABEL(yyerrhandle)
 /* END */
 
  #line 1038 "../bison++/bison.cc"
-#line 1140 "ClntParser.y"
+#line 1192 "ClntParser.y"
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -341,6 +341,12 @@ typedef
 #define	DUID_KEYWORD_	331
 #define	REQUEST_	332
 #define	RECONFIGURE_	333
+#define	DUMP_INTERVAL_	334
+#define	BINARY_LEASE_DB_	335
+#define	SCRIPT_CONCURRENCY_	336
+#define	SCRIPT_QUEUE_SIZE_	337
+#define	SCRIPT_TIMEOUT_	338
+#define	SCRIPT_BATCH_	339
 
 
 #line 169 "../bison++/bison.h"
@@ -465,6 +471,12 @@ static const int STRING_KEYWORD_;
 static const int DUID_KEYWORD_;
 static const int REQUEST_;
 static const int RECONFIGURE_;
+static const int DUMP_INTERVAL_;
+static const int BINARY_LEASE_DB_;
+static const int SCRIPT_CONCURRENCY_;
+static const int SCRIPT_QUEUE_SIZE_;
+static const int SCRIPT_TIMEOUT_;
+static const int SCRIPT_BATCH_;
 
 
 #line 212 "../bison++/bison.h"
@@ -549,6 +561,12 @@ static const int RECONFIGURE_;
 	,DUID_KEYWORD_=331
 	,REQUEST_=332
 	,RECONFIGURE_=333
+	,DUMP_INTERVAL_=334
+	,BINARY_LEASE_DB_=335
+	,SCRIPT_CONCURRENCY_=336
+	,SCRIPT_QUEUE_SIZE_=337
+	,SCRIPT_TIMEOUT_=338
+	,SCRIPT_BATCH_=339
 
 
 #line 215 "../bison++/bison.h"
@@ -123,7 +123,8 @@ namespace std
 %token AFTR_
 %token ROUTING_
 %token ADDRESS_LIST_, STRING_KEYWORD_, DUID_KEYWORD_, REQUEST_
-%token RECONFIGURE_
+%token RECONFIGURE_, DUMP_INTERVAL_, BINARY_LEASE_DB_
+%token SCRIPT_CONCURRENCY_, SCRIPT_QUEUE_SIZE_, SCRIPT_TIMEOUT_, SCRIPT_BATCH_
 %type  <ival> Number
 
 %%
@@ -154,6 +155,7 @@ GlobalOptionDeclaration
 | DuidTypeOption
 | StrictRfcNoRoutingOption
 | ScriptName
+| ScriptOption
 | DdnsProtocol
 | DdnsTimeout
 | AuthEnabledOption
@@ -165,6 +167,8 @@ GlobalOptionDeclaration
 | Experimental
 | SkipConfirm
 | ReconfigureAccept
+| DumpInterval
+| BinaryLeaseDb
 | DownlinkPrefixInterfaces
 ;
 
@@ -549,6 +553,40 @@ ScriptName
     CfgMgr->setScript($2);
 }
 
+ScriptOption
+: SCRIPT_CONCURRENCY_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-concurrency must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptConcurrency($2);
+}
+| SCRIPT_QUEUE_SIZE_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-queue-size must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptQueueSize($2);
+}
+| SCRIPT_TIMEOUT_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-timeout must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptTimeout($2);
+}
+| SCRIPT_BATCH_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-batch must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptBatch($2);
+};
+
 AuthEnabledOption
 : AUTH_ENABLED_ Number    { ParserOptStack.getLast()->setAuthEnabled($2); }
 
@@ -700,6 +738,20 @@ DdnsTimeout
     CfgMgr->setDDNSTimeout($2);
 }
 
+DumpInterval
+: DUMP_INTERVAL_ Number
+{
+    Log(Debug) << "State dumps will be written at most every " << $2 << " second(s)." << LogEnd;
+    CfgMgr->setDumpInterval($2);
+};
+
+BinaryLeaseDb
+: BINARY_LEASE_DB_
+{
+    Log(Debug) << "Binary copy of lease database (" << CLNTADDRDB_FILE << ") enabled." << LogEnd;
+    CfgMgr->setBinaryLeaseDb(true);
+};
+
 
 ValidTimeOption
 :VALID_TIME_ Number
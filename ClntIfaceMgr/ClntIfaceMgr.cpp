@@ -17,6 +17,7 @@
 #include "ClntMsgReply.h"
 #include "ClntMsgAdvertise.h"
 #include "Logger.h"
+#include "StatsMgr.h"
 
 #ifndef MOD_CLNT_DISABLE_DNSUPDATE
 #include "DNSUpdate.h"
@@ -74,6 +75,7 @@ bool TClntIfaceMgr::sendUnicast(int iface, char *msg, int size, SPtr<TIPv6Addr>
                    << "(socket " << sock->getFD() << ")." << LogEnd;
         return false;
     }
+    Iface->countTx(msg[0]);
 
     return true;
 }
@@ -105,6 +107,7 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
             if (buf[0]!=CONTROL_MSG) {
                 Log(Warning) << "Received message is too short (" << bufsize
                              << ") bytes." << LogEnd;
+                StatsMgr().DecodeErrors++;
             } else {
                 Log(Warning) << "Control message received." << LogEnd;
             }
@@ -125,6 +128,7 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
 #ifndef MOD_DISABLE_AUTH
             if (!ptr->validateAuthInfo(buf, bufsize, ClntCfgMgr().getAuthAcceptMethods())) {
                     Log(Error) << "Message dropped, authentication validation failed." << LogEnd;
+                    StatsMgr().AuthFailures++;
                     return 0;
             }
 #endif
@@ -144,6 +148,7 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
 #ifndef MOD_DISABLE_AUTH
             if (!ptr->validateAuthInfo(buf, bufsize, ClntCfgMgr().getAuthAcceptMethods())) {
                     Log(Error) << "Message dropped, authentication validation failed." << LogEnd;
+                    StatsMgr().AuthFailures++;
                     return 0;
             }
 #endif
@@ -165,7 +170,7 @@ SPtr<TClntMsg> TClntIfaceMgr::select(unsigned int timeout)
 }
 
 TClntIfaceMgr::TClntIfaceMgr(const std::string& xmlFile)
-    : TIfaceMgr(xmlFile, false)
+    : TIfaceMgr(xmlFile, false), DumpFile(xmlFile)
 {
     struct iface * ptr;
     struct iface * ifaceList;
@@ -204,6 +209,7 @@ TClntIfaceMgr::TClntIfaceMgr(const std::string& xmlFile)
     }
     if_list_release(ifaceList); // allocated in pure C, and so release it there
 
+    trackIfaceEvents();
 }
 
 TClntIfaceMgr::~TClntIfaceMgr() {
@@ -234,6 +240,10 @@ unsigned int TClntIfaceMgr::getTimeout() {
         if (min > tmp)
             min = tmp;
     }
+    // DNS updates in progress
+    tmp = DNSUpdate::getTimeout();
+    if (min > tmp)
+        min = tmp;
     return min;
 }
 
@@ -241,6 +251,8 @@ bool TClntIfaceMgr::doDuties() {
     SPtr<TClntIfaceIface> iface;
     SPtr<TClntCfgIface> cfgIface;
 
+    DNSUpdate::doDuties();
+
     this->firstIface();
     while (iface = (Ptr*)this->getIface()) {
               cfgIface = ClntCfgMgr().getIface(iface->getID());
@@ -270,6 +282,19 @@ bool TClntIfaceMgr::doDuties() {
     return true;
 }
 
+/// waits for DNS updates in progress to finish (used on shutdown)
+void TClntIfaceMgr::flushDNSUpdates() {
+    DNSUpdate::flush();
+}
+
+int TClntIfaceMgr::selectAddFDs(fd_set * rd, fd_set * wr) {
+    return DNSUpdate::addFDs(rd, wr);
+}
+
+int TClntIfaceMgr::selectProcessFDs(fd_set * rd, fd_set * wr) {
+    return DNSUpdate::processFDs(rd, wr);
+}
+
 bool TClntIfaceMgr::fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& fqdn)
 {
     SPtr<TIPv6Addr> DNSAddr;
@@ -316,11 +341,8 @@ bool TClntIfaceMgr::fqdnAdd(SPtr<TClntIfaceIface> iface, const std::string& fqdn
         unsigned int timeout = ClntCfgMgr().getDDNSTimeout();
 
         /* add AAAA record */
-        DNSUpdate *act = new DNSUpdate(DNSAddr->getPlain(), "", fqdn, addr->getPlain(),
-                                       DNSUPDATE_AAAA, proto2);
-        int result = act->run(timeout);
-        act->showResult(result);
-        delete act;
+        DNSUpdate::start(new DNSUpdate(DNSAddr->getPlain(), "", fqdn, addr->getPlain(),
+                                       DNSUPDATE_AAAA, proto2), timeout);
 #else
         Log(Error) << "This version is compiled without DNS Update support." << LogEnd;
         return false;
@@ -358,11 +380,8 @@ bool TClntIfaceMgr::fqdnDel(SPtr<TClntIfaceIface> iface, SPtr<TAddrIA> ia, const
     Log(Debug) << "FQDN: Cleaning up DNS AAAA record in server " << *dns << ", for IP=" << *myAddr
                << " and FQDN=" << fqdn << LogEnd;
 
-    DNSUpdate *act = new DNSUpdate(dns->getPlain(), "", fqdn, myAddr->getPlain(),
-                                   DNSUPDATE_AAAA_CLEANUP, proto2);
-    int result = act->run(timeout);
-    act->showResult(result);
-    delete act;
+    DNSUpdate::start(new DNSUpdate(dns->getPlain(), "", fqdn, myAddr->getPlain(),
+                                   DNSUPDATE_AAAA_CLEANUP, proto2), timeout);
 
 #else
     Log(Error) << "This Dibbler version is compiled without DNS Update support." << LogEnd;
@@ -373,10 +392,9 @@ bool TClntIfaceMgr::fqdnDel(SPtr<TClntIfaceIface> iface, SPtr<TAddrIA> ia, const
 
 void TClntIfaceMgr::dump()
 {
-    std::ofstream xmlDump;
-    xmlDump.open( this->XmlFile.c_str() );
+    std::ostringstream xmlDump;
     xmlDump << *this;
-    xmlDump.close();
+    DumpFile.write(xmlDump.str());
 }
 
 /**
@@ -586,30 +604,6 @@ bool TClntIfaceMgr::modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLe
         return false;
 }
 
-void TClntIfaceMgr::redetectIfaces() {
-    struct iface  * ptr;
-    struct iface  * ifaceList;
-    SPtr<TIfaceIface> iface;
-    ifaceList = if_list_get(); // external (C coded) function
-    ptr = ifaceList;
-
-    if  (!ifaceList) {
-        Log(Error) << "Unable to read interface info. Inactive mode failed." << LogEnd;
-        return;
-    }
-    while (ptr!=NULL) {
-        iface = getIfaceByID(ptr->id);
-        if (iface && (ptr->flags!=iface->getFlags())) {
-            Log(Notice) << "Flags on interface " << iface->getFullName() << " has changed (old=" << hex <<iface->getFlags()
-                        << ", new=" << ptr->flags << ")." << dec << LogEnd;
-            iface->updateState(ptr);
-        }
-        ptr = ptr->next;
-    }
-
-    if_list_release(ifaceList); // allocated in pure C, and so release it there
-}
-
 #ifdef MOD_REMOTE_AUTOCONF
 bool TClntIfaceMgr::notifyRemoteScripts(SPtr<TIPv6Addr> rcvdAddr, SPtr<TIPv6Addr> srvAddr, int ifindex) {
 
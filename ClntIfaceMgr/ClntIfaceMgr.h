@@ -26,6 +26,7 @@ class TClntIfaceIface;
 #include "ClntIfaceIface.h"
 #include "IPv6Addr.h"
 #include "ClntMsg.h"
+#include "StateFile.h"
 
 #define ClntIfaceMgr() (TClntIfaceMgr::instance())
 
@@ -72,14 +73,18 @@ public:
     unsigned int getTimeout();
     
     bool doDuties();
+    void flushDNSUpdates();
 
-    void redetectIfaces();
+  protected:
+    int selectAddFDs(fd_set * rd, fd_set * wr);
+    int selectProcessFDs(fd_set * rd, fd_set * wr);
 
   private:
     bool modifyPrefix(int iface, SPtr<TIPv6Addr> prefix, int prefixLen, unsigned int pref, 
 		      unsigned int valid, PrefixModifyMode mode);
 
     std::string XmlFile;
+    TStateFile DumpFile;
 
     static TClntIfaceMgr * Instance;
 };
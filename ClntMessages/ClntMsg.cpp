@@ -373,7 +373,7 @@ void TClntMsg::send()
 
     RC++;
 
-    this->storeSelf(this->pkt);
+    int pktLen = this->storeSelf(this->pkt);
 
     SPtr<TIfaceIface> ptrIface = ClntIfaceMgr().getIfaceByID(Iface);
     if (PeerAddr) {
@@ -385,7 +385,7 @@ void TClntMsg::send()
 	}
 	Log(Cont) << ") on " << ptrIface->getName()
 		   << "/" << Iface << " to unicast addr " << *PeerAddr << "." << LogEnd;
-	ClntIfaceMgr().sendUnicast(Iface,pkt,getSize(),PeerAddr);
+	ClntIfaceMgr().sendUnicast(Iface,pkt,pktLen,PeerAddr);
     } else {
 	Log(Debug) << "Sending " << this->getName() << "(opts:";
 	SPtr<TOpt> opt;
@@ -395,7 +395,7 @@ void TClntMsg::send()
 	}
 	Log(Cont) << ") on " << ptrIface->getName()
 		   << "/" << Iface << " to multicast." << LogEnd;
-	ClntIfaceMgr().sendMulticast(Iface, pkt, getSize());
+	ClntIfaceMgr().sendMulticast(Iface, pkt, pktLen);
     }
     LastTimeStamp = now();
 }
@@ -12,6 +12,7 @@
 
 #include <iostream>
 #include <string>
+#include <time.h>
 
 #include "ClntTransMgr.h"
 #include "ClntAddrMgr.h"
@@ -54,7 +55,7 @@ TClntTransMgr &TClntTransMgr::instance()
 }
 
 TClntTransMgr::TClntTransMgr(const std::string config)
-  :IsDone(true), Shutdown(true)
+  :IsDone(true), Shutdown(true), LastDump(0), CheckPending(true), NextCheck(0)
 {
     // should we set REUSE option during binding sockets?
 #ifdef MOD_CLNT_BIND_REUSE
@@ -293,6 +294,10 @@ bool TClntTransMgr::openLoopbackSocket() {
 /*
  * this method is called, when no message has been received, but some
  * action should be taken, e.g. RENEW transmission
+ *
+ * Scanning all IAs, PDs and interfaces is done only if something has changed
+ * (message processed, transaction finished, link state changed) or when
+ * the earliest timer (T1, T2, lifetimes, info refresh) is due.
  */
 void TClntTransMgr::doDuties()
 {
@@ -311,14 +316,17 @@ void TClntTransMgr::doDuties()
             }
             Log(Cont) << ")" << LogEnd;
             msg->doDuties();
+            CheckPending = true;
         }
     }
 
     // now delete messages which are marked as done
     Transactions.first();
     while (msg = Transactions.get() ) {
-        if (msg->isDone())
+        if (msg->isDone()) {
             Transactions.del();
+            CheckPending = true;
+        }
     }
 
     if (ClntCfgMgr().inactiveMode())
@@ -330,16 +338,24 @@ void TClntTransMgr::doDuties()
                 Log(Crit) << "Attempt to bind activates interfaces failed."
                           << " Following operation may be unstable!" << LogEnd;
             }
+            CheckPending = true;
         }
     }
 
+    dumpState(false);
+
+    if (!CheckPending && now() < NextCheck) {
+        if (this->Shutdown && !Transactions.count()) {
+            this->IsDone = true;
+            dumpState(true);
+        }
+        return;
+    }
+    CheckPending = false;
+
     removeExpired();
     ClntAddrMgr().doDuties();
 
-    ClntAddrMgr().dump();
-    ClntIfaceMgr().dump();
-    ClntCfgMgr().dump();
-
     if (!this->Shutdown && !this->IsDone) {
 
         // did we switched links lately?
@@ -371,8 +387,67 @@ void TClntTransMgr::doDuties()
     // This method launch the DNS update, so the checkDecline has to be done before to ensure the ip address is valid
     ClntIfaceMgr().doDuties();
 
-    if (this->Shutdown && !Transactions.count())
+    updateNextCheck();
+
+    if (this->Shutdown && !Transactions.count()) {
         this->IsDone = true;
+        dumpState(true);
+    }
+}
+
+/**
+ * @brief forces full state check in the next doDuties() call
+ *
+ * Must be called when client state was changed outside of TClntTransMgr
+ * (e.g. IAs were marked for CONFIRM after link state change).
+ */
+void TClntTransMgr::scheduleCheck()
+{
+    CheckPending = true;
+}
+
+/**
+ * @brief calculates when the earliest lifetime related event is due
+ *
+ * Covers T1/T2, preferred and valid lifetimes, tentative (DAD) timeouts
+ * and information refresh. Called once after all IAs have been checked,
+ * so getTimeout() does not have to scan them again on every loop.
+ */
+void TClntTransMgr::updateNextCheck()
+{
+    unsigned long timeout = ClntAddrMgr().getTimeout();
+    unsigned long tmp = ClntAddrMgr().getTentativeTimeout();
+    if (timeout > tmp)
+        timeout = tmp;
+    tmp = ClntIfaceMgr().getTimeout();
+    if (timeout > tmp)
+        timeout = tmp;
+
+    if (timeout >= DHCPV6_INFINITY - now())
+        NextCheck = DHCPV6_INFINITY;
+    else
+        NextCheck = now() + timeout;
+}
+
+/**
+ * @brief stores AddrMgr, IfaceMgr and CfgMgr state on disk
+ *
+ * doDuties() is called after every received packet and timeout, so
+ * periodic dumps are rate limited to one per DumpInterval seconds.
+ * Each dump rewrites a file only if its content has actually changed.
+ *
+ * @param force dump now, regardless of the time of the last dump
+ */
+void TClntTransMgr::dumpState(bool force)
+{
+    unsigned long now = (unsigned long)time(NULL);
+    if (!force && LastDump && (now - LastDump < ClntCfgMgr().getDumpInterval()))
+        return;
+
+    ClntAddrMgr().dump();
+    ClntIfaceMgr().dump();
+    ClntCfgMgr().dump();
+    LastDump = now;
 }
 
 void TClntTransMgr::shutdown()
@@ -387,6 +462,7 @@ void TClntTransMgr::shutdown()
 
     Transactions.clear(); // delete all transactions
     this->Shutdown = true;
+    CheckPending = true;
     Log(Notice) << "Shutting down entire client." << LogEnd;
         
     // delete all weird-state/innormal-state and address-free IAs 
@@ -507,6 +583,9 @@ void TClntTransMgr::relayMsg(SPtr<TClntMsg> msgAnswer)
     if (!msgAnswer->check())
         return ;
 
+    // response may change state of IAs, so they need to be checked
+    CheckPending = true;
+
 #ifdef MOD_REMOTE_AUTOCONF
     if (neighborInfoGet(msgAnswer->getTransID())) {
         processRemoteReply(msgAnswer);
@@ -586,16 +665,14 @@ unsigned long TClntTransMgr::getTimeout()
     if (this->IsDone) 
         return 0;
 
-    // AddrMgr timeout
-    timeout = ClntAddrMgr().getTimeout();
-    tmp     = ClntAddrMgr().getTentativeTimeout();
-    if (timeout > tmp)
-        timeout = tmp;
+    // state check needed right away
+    if (CheckPending)
+        return 0;
 
-    // IfaceMgr (Lifetime option) timeout
-    tmp = ClntIfaceMgr().getTimeout();
-    if (timeout > tmp)
-        timeout = tmp;
+    // AddrMgr (T1, T2, lifetimes, tentative) and IfaceMgr (Lifetime option)
+    // timeouts, calculated in updateNextCheck()
+    unsigned long current = now();
+    timeout = (NextCheck > current) ? (NextCheck - current) : 0;
 
     // Messages timeout
     SPtr<TClntMsg> ptrMsg;
@@ -609,7 +686,17 @@ unsigned long TClntTransMgr::getTimeout()
     if (timeout > tmp)
         timeout = tmp;
 
-    if (ClntCfgMgr().inactiveIfacesCnt()) {
+    // pending periodic dump (state could have changed since the last one)
+    if (LastDump) {
+        unsigned long now = (unsigned long)time(NULL);
+        unsigned long interval = ClntCfgMgr().getDumpInterval();
+        tmp = (now - LastDump < interval) ? (interval - (now - LastDump)) : 0;
+        if (timeout > tmp && tmp)
+            timeout = tmp;
+    }
+
+    // with notifications enabled, select() will wake up on interface change
+    if (ClntCfgMgr().inactiveIfacesCnt() && !ClntIfaceMgr().ifaceEventsActive()) {
         if (timeout>INACTIVE_MODE_INTERVAL)
             timeout=INACTIVE_MODE_INTERVAL;
     }
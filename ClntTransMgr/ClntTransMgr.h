@@ -41,6 +41,7 @@ class TClntTransMgr
 
     void shutdown();
     bool isDone();
+    void scheduleCheck();
 
     char * getCtrlAddr();
     int    getCtrlIface();
@@ -103,12 +104,18 @@ class TClntTransMgr
     bool openSockets(SPtr<TClntCfgIface> iface);
     bool populateAddrMgr(SPtr<TClntCfgIface> iface);
 
+    void dumpState(bool force);
+    void updateNextCheck();
+
     void sortAdvertiseLst();
     void printLst(List(TMsg) lst);
 
     List(TClntMsg) Transactions;
     bool IsDone;         // isDone = true - client operation is finished
     bool Shutdown;       // is shutdown in progress?
+    unsigned long LastDump; // timestamp of the last periodic state dump
+    bool CheckPending;       // something has changed, check*() methods must be called
+    unsigned long NextCheck; // when next lifetime related event (T1, T2, expiry, ...) is due
 
     bool BindReuse; // Bug #56. Shall we allow running client and server on the same machine?
 
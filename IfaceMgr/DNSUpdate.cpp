@@ -14,6 +14,8 @@
 #include "DNSUpdate.h"
 #include "Portable.h"
 #include "Logger.h"
+#include "StatsMgr.h"
+#include "DHCPConst.h"
 #include <stdio.h>
 #include "sha256.h"
 
@@ -55,6 +57,8 @@ DNSUpdate::DNSUpdate(string dns_address, string zonename, string hostname,
     ttl[len-1]=0;
     this->updateMode = updateMode;
     _proto = proto;
+    _timeout = 0;
+    _start = 0;
 }
  
 DNSUpdate::~DNSUpdate() {
@@ -97,55 +101,85 @@ void DNSUpdate::splitHostDomain(string fqdnName) {
     }
 }
 
-DnsUpdateResult DNSUpdate::run(int timeout){
+/** 
+ * fills the update message
+ * 
+ * @param oldDnsRR - record found in the zone (deleted by the update), may be NULL
+ */
+void DNSUpdate::buildMsg(DnsRR* oldDnsRR) {
 
     switch (this->updateMode) {
     case DNSUPDATE_PTR:
 	Log(Debug) << "DDNS: Performing DNS Update: Only PTR record." << LogEnd;   
 	this->createSOAMsg();
-	this->addinMsg_delOldRR();   
+	this->addinMsg_delOldRR(oldDnsRR);   
 	this->addinMsg_newPTR();
 	break;
     case DNSUPDATE_PTR_CLEANUP:
 	Log(Debug) << "DDNS: Performing DNS Cleanup: Only PTR record." << LogEnd;   
 	this->createSOAMsg();
-	this->addinMsg_delOldRR();   
+	this->addinMsg_delOldRR(oldDnsRR);   
 	this->deletePTRRecordFromRRSet();
 	break;
     case DNSUPDATE_AAAA:
 	Log(Debug) << "DDNS: Performing DNS Update: Only AAAA record." << LogEnd;   
 	this->createSOAMsg();
-	this->addinMsg_delOldRR();   
+	this->addinMsg_delOldRR(oldDnsRR);   
 	this->addinMsg_newAAAA();
 	break;
     case DNSUPDATE_AAAA_CLEANUP:
 	Log(Debug) << "DDNS: Performing DNS Cleanup: Only AAAA record." << LogEnd;   
 	this->createSOAMsg();
-	this->addinMsg_delOldRR();   
+	this->addinMsg_delOldRR(oldDnsRR);   
 	this->deleteAAAARecordFromRRSet();
 	break;
     }
+}
+
+DnsUpdateResult DNSUpdate::run(int timeout){
+
+    buildMsg(this->get_oldDnsRR());
     
+    TStatsMgr & stats = StatsMgr();
+    unsigned long long start = now_ms();
+    stats.DnsUpdates++;
+    stats.DnsUpdatesInProgress++;
     try {
 	sendMsg(timeout);
     } 
     catch (PException p) {
-	DnsUpdateResult result = DNSUPDATE_ERROR;
-	if (strstr(p.message,"Could not connect TCP socket") ){
-	    result = DNSUPDATE_CONNFAIL;
-	} 
-	if (!strcmp(p.message,"NOTAUTH")){
-	    Log(Error) << "DDNS: Nameserver returned NOTAUTH error." << LogEnd;	
-	    result = DNSUPDATE_SRVNOTAUTH;
-	}
-
-	Log(Error) << "DDNS error: " << p.message << "." << LogEnd;
-	return result;
+	stats.DnsUpdatesInProgress--;
+	stats.DnsUpdateLatency.add(now_ms() - start);
+	return failed(p.message);
      }// exeption catch
 
+    stats.DnsUpdatesInProgress--;
+    stats.DnsUpdateLatency.add(now_ms() - start);
     return DNSUPDATE_SUCCESS;
 }
 
+/** 
+ * counts and logs a failed update
+ * 
+ * @param error - reason of the failure
+ * 
+ * @return result to be reported by showResult()
+ */
+DnsUpdateResult DNSUpdate::failed(const char* error) {
+    StatsMgr().DnsUpdateFailures++;
+    DnsUpdateResult result = DNSUPDATE_ERROR;
+    if (strstr(error,"Could not connect TCP socket") ){
+	result = DNSUPDATE_CONNFAIL;
+    } 
+    if (!strcmp(error,"NOTAUTH")){
+	Log(Error) << "DDNS: Nameserver returned NOTAUTH error." << LogEnd;	
+	result = DNSUPDATE_SRVNOTAUTH;
+    }
+
+    Log(Error) << "DDNS error: " << error << "." << LogEnd;
+    return result;
+}
+
 /** 
  * create new message for Dns Update
  * 
@@ -273,9 +307,7 @@ void DNSUpdate::addinMsg_newPTR(){
  * insert a delete-RR entry in message for deleting old entry
  * 
  */
-void DNSUpdate::addinMsg_delOldRR(){
-    //get old, available DnsRR from Dns Server
-    DnsRR* oldDnsRR=this->get_oldDnsRR();
+void DNSUpdate::addinMsg_delOldRR(DnsRR* oldDnsRR){
     if (oldDnsRR){
 	//delete message
 	oldDnsRR->CLASS = QCLASS_NONE; oldDnsRR->TTL = 0;  
@@ -410,17 +442,17 @@ void DNSUpdate::sendMsg(unsigned int timeout) {
     return;
 }
 
-/** send Update Message to server*/
+pos_tcppool DNSUpdate::TCPPool;
+std::map<u_int16, DNSUpdate*> DNSUpdate::Lookups;
+std::map<u_int16, DNSUpdate*> DNSUpdate::Updates;
+
+/** send Update Message to server (connection to the server is kept open) */
 void DNSUpdate::sendMsgTCP(unsigned int timeout){
     DnsMessage *a = NULL;
-    int sockid = -1;
     
     try {
-	pos_cliresolver res;
-	res.tcp_timeout = timeout;
-	sockid = res.tcpconnect(&server);
-	res.tcpsendmessage(message, sockid);
-	res.tcpwaitanswer(a, sockid);
+	TCPPool.tcp_timeout = timeout;
+	TCPPool.pooledquery(message, a, &server);
 	if (a->RCODE != RCODE_NOERROR) {
 	    throw PException((char*)str_rcode(a->RCODE).c_str());
 	}
@@ -428,16 +460,12 @@ void DNSUpdate::sendMsgTCP(unsigned int timeout){
 	
 	if (a) 
 	    delete a;
-	if (sockid != -1) 
-	    tcpclose(sockid);
 	
 	throw PException(p.message);
     }
 	
     if (a) 
 	delete a;
-    if (sockid != -1) 
-	tcpclose(sockid);
 }
 
 void DNSUpdate::sendMsgUDP(unsigned int timeout) {
@@ -462,6 +490,190 @@ void DNSUpdate::sendMsgUDP(unsigned int timeout) {
 	delete a;
 }
 
+/** 
+ * starts an update. TCP updates share the connections of TCPPool and are
+ * not waited for: the old record is looked up, then the update is sent, each
+ * step when the answer to the previous one arrives (see processFDs() and
+ * doDuties()). The update is deleted once it is finished.
+ * 
+ * @param update - update to perform
+ * @param timeout - how long to wait for each answer (in ms)
+ */
+void DNSUpdate::start(DNSUpdate* update, int timeout) {
+    if (update->_proto != DNSUPDATE_TCP) {
+	DnsUpdateResult result = update->run(timeout);
+	update->showResult(result);
+	delete update;
+	return;
+    }
+
+    update->_timeout = timeout;
+    update->_start = now_ms();
+    StatsMgr().DnsUpdates++;
+    StatsMgr().DnsUpdatesInProgress++;
+    update->sendLookup();
+}
+
+/** sends AXFR query for the old record */
+void DNSUpdate::sendLookup() {
+    DnsMessage *q = create_query(*zoneroot, QTYPE_AXFR);
+    try {
+	TCPPool.tcp_timeout = _timeout;
+	Lookups[TCPPool.pooledsend(q, &server)] = this;
+	delete q;
+    } catch (PException p) {
+	delete q;
+	Log(Error) << "DDNS: Attempt to get old DNS record failed." << LogEnd;
+	buildMsg(NULL);
+	sendUpdate();
+    }
+}
+
+void DNSUpdate::gotLookup(DnsMessage* a, const stl_string& error) {
+    DnsRR* oldDnsRR = NULL;
+    if (!a || a->RCODE != RCODE_NOERROR) {
+	if (a)
+	    delete a;
+	Log(Error) << "DDNS: Attempt to get old DNS record failed." << LogEnd;
+    } else if (a->answers.empty()) {
+	delete a;
+    } else {
+	oldDnsRR = new DnsRR();
+	if (!DnsRR_avail(a, *oldDnsRR)) { // deletes a
+	    delete oldDnsRR;
+	    oldDnsRR = NULL;
+	}
+    }
+
+    buildMsg(oldDnsRR);
+    sendUpdate();
+}
+
+void DNSUpdate::sendUpdate() {
+    Log(Debug) << "DDNS: Updating over TCP." << LogEnd;
+    try {
+	TCPPool.tcp_timeout = _timeout;
+	Updates[TCPPool.pooledsend(message, &server)] = this;
+    } catch (PException p) {
+	finish(p.message);
+    }
+}
+
+void DNSUpdate::gotUpdate(DnsMessage* a, const stl_string& error) {
+    if (!a) {
+	finish(error.c_str());
+	return;
+    }
+    if (a->RCODE != RCODE_NOERROR) {
+	stl_string rcode = str_rcode(a->RCODE);
+	delete a;
+	finish(rcode.c_str());
+	return;
+    }
+    delete a;
+    finish(NULL);
+}
+
+/** 
+ * reports the result of an asynchronous update and deletes it
+ * 
+ * @param error - reason of the failure (NULL if the update succeeded)
+ */
+void DNSUpdate::finish(const char* error) {
+    StatsMgr().DnsUpdatesInProgress--;
+    StatsMgr().DnsUpdateLatency.add(now_ms() - _start);
+    showResult(error ? failed(error) : DNSUPDATE_SUCCESS);
+    delete this;
+}
+
+/** passes answers (and failures) that arrived to the updates waiting for them */
+void DNSUpdate::collect() {
+    u_int16 id;
+    DnsMessage* a;
+    stl_string error;
+    while (TCPPool.pooledanswer(id, a, error)) {
+	std::map<u_int16, DNSUpdate*>::iterator it = Lookups.find(id);
+	if (it != Lookups.end()) {
+	    DNSUpdate* update = it->second;
+	    Lookups.erase(it);
+	    update->gotLookup(a, error);
+	    continue;
+	}
+	it = Updates.find(id);
+	if (it != Updates.end()) {
+	    DNSUpdate* update = it->second;
+	    Updates.erase(it);
+	    update->gotUpdate(a, error);
+	    continue;
+	}
+	if (a)
+	    delete a;
+    }
+}
+
+/** 
+ * adds descriptors of the connections to DNS servers
+ * 
+ * @return highest descriptor added (or -1 if none)
+ */
+int DNSUpdate::addFDs(fd_set* rd, fd_set* wr) {
+    return TCPPool.pooledfds(rd, wr);
+}
+
+/** 
+ * handles connections to DNS servers that are ready
+ * 
+ * @return number of ready descriptors handled
+ */
+int DNSUpdate::processFDs(fd_set* rd, fd_set* wr) {
+    int handled = TCPPool.pooledprocess(rd, wr);
+    collect();
+    return handled;
+}
+
+/** expires updates the DNS server did not answer in time */
+void DNSUpdate::doDuties() {
+    if (Lookups.empty() && Updates.empty())
+	return;
+    fd_set rd, wr;
+    FD_ZERO(&rd);
+    FD_ZERO(&wr);
+    processFDs(&rd, &wr);
+}
+
+/** 
+ * returns time until the next update times out
+ * 
+ * @return timeout (in seconds)
+ */
+unsigned int DNSUpdate::getTimeout() {
+    int ms = TCPPool.pooledtimeout();
+    if (ms < 0)
+	return DHCPV6_INFINITY;
+    return (ms + 999) / 1000;
+}
+
+/** waits for all updates in progress to finish (used on shutdown) */
+void DNSUpdate::flush() {
+    while (!Lookups.empty() || !Updates.empty()) {
+	fd_set rd, wr;
+	FD_ZERO(&rd);
+	FD_ZERO(&wr);
+	int maxFD = addFDs(&rd, &wr);
+	int ms = TCPPool.pooledtimeout();
+	if (ms < 0)
+	    ms = 0;
+	struct timeval tv;
+	tv.tv_sec = ms / 1000;
+	tv.tv_usec = (ms % 1000) * 1000;
+	if (select(maxFD + 1, &rd, &wr, NULL, &tv) < 0) {
+	    FD_ZERO(&rd);
+	    FD_ZERO(&wr);
+	}
+	processFDs(&rd, &wr);
+    }
+}
+
 /** 
  * prints status reported by result
  * 
@@ -60,13 +60,16 @@ private:
     char* ttl;
     DnsUpdateMode updateMode;
     DnsUpdateProtocol _proto;
+    int _timeout;
+    unsigned long long _start;
    
     void splitHostDomain(std::string fqdnName);
 
+    void buildMsg(DnsRR* oldDnsRR);
     void createSOAMsg();
     void addinMsg_newPTR();
     void addinMsg_newAAAA();
-    void addinMsg_delOldRR();
+    void addinMsg_delOldRR(DnsRR* oldDnsRR);
     void deleteAAAARecordFromRRSet();
     void deletePTRRecordFromRRSet();
     bool DnsRR_avail(DnsMessage *msg, DnsRR& RemoteDnsRR);
@@ -74,6 +77,19 @@ private:
     void sendMsg(unsigned int timeout);
     void sendMsgTCP(unsigned int timeout);
     void sendMsgUDP(unsigned int timeout);
+    DnsUpdateResult failed(const char* error);
+
+    // asynchronous TCP updates: lookup of the old record, then the update
+    void sendLookup();
+    void sendUpdate();
+    void gotLookup(DnsMessage* a, const stl_string& error);
+    void gotUpdate(DnsMessage* a, const stl_string& error);
+    void finish(const char* error);
+    static void collect();
+
+    static pos_tcppool TCPPool; // TCP connections kept open between updates
+    static std::map<u_int16, DNSUpdate*> Lookups; // query ID -> update waiting for it
+    static std::map<u_int16, DNSUpdate*> Updates;
      
  public:
     DNSUpdate(std::string dns_address, std::string zonename, std::string hostname, 
@@ -84,4 +100,14 @@ private:
     ~DNSUpdate();
     DnsUpdateResult run(int timeout);
     void showResult(int result);
+
+    // Starts the update and takes ownership of it. TCP updates are sent
+    // without waiting for the answer; the daemon's select loop drives them
+    // through the functions below. Other protocols are run() right away.
+    static void start(DNSUpdate* update, int timeout);
+    static int addFDs(fd_set* rd, fd_set* wr);
+    static int processFDs(fd_set* rd, fd_set* wr);
+    static void doDuties();
+    static unsigned int getTimeout();
+    static void flush();
 };
@@ -117,6 +117,14 @@ void TIfaceIface::updateState(struct iface *x)
 }
 
 
+/**
+ * updates interface flags (used when link change notification is received)
+ */
+void TIfaceIface::updateFlags(unsigned int flags)
+{
+    this->Flags = flags;
+}
+
 /**
  * returns true if interface is UP
  */
@@ -273,6 +281,45 @@ int TIfaceIface::countLLAddress() {
     return this->LLAddrCnt;
 }
 
+/**
+ * adds link-local address (unless it is already known)
+ *
+ * @param addr packed link-local address (16 bytes)
+ */
+void TIfaceIface::addLLAddress(char * addr) {
+    for (int i=0; i<LLAddrCnt; i++) {
+        if (!memcmp(LLAddr+16*i, addr, 16))
+            return;
+    }
+    char * tmp = new char[16*(LLAddrCnt+1)];
+    if (LLAddrCnt)
+        memcpy(tmp, LLAddr, 16*LLAddrCnt);
+    memcpy(tmp+16*LLAddrCnt, addr, 16);
+    delete [] LLAddr;
+    LLAddr = tmp;
+    LLAddrCnt++;
+    PresLLAddr = LLAddr;
+}
+
+/**
+ * removes link-local address
+ *
+ * @param addr packed link-local address (16 bytes)
+ */
+void TIfaceIface::delLLAddress(char * addr) {
+    for (int i=0; i<LLAddrCnt; i++) {
+        if (memcmp(LLAddr+16*i, addr, 16))
+            continue;
+        memmove(LLAddr+16*i, LLAddr+16*(i+1), 16*(LLAddrCnt-i-1));
+        if (!--LLAddrCnt) {
+            delete [] LLAddr;
+            LLAddr = 0;
+        }
+        PresLLAddr = LLAddr;
+        return;
+    }
+}
+
 // --------------------------------------------------------------------
 // --- socket related -------------------------------------------------
 // --------------------------------------------------------------------
@@ -280,7 +327,7 @@ int TIfaceIface::countLLAddress() {
 /*
  * binds socket to one address only
  */
-bool TIfaceIface::addSocket(SPtr<TIPv6Addr> addr,int port, bool ifaceonly, bool reuse) {
+bool TIfaceIface::addSocket(SPtr<TIPv6Addr> addr,int port, bool ifaceonly, int reuse) {
     // Log(Debug) << "Creating socket on " << *addr << " address." << LogEnd;
     SPtr<TIfaceSocket> ptr = new TIfaceSocket(this->Name, this->ID, port, addr, ifaceonly, reuse);
     if (ptr->getStatus()!=STATE_CONFIGURED) {
@@ -355,6 +402,18 @@ int TIfaceIface::countSocket() {
     return SocketsLst.count();
 }
 
+void TIfaceIface::countRx(int msgType) {
+    Stats.rx(msgType);
+}
+
+void TIfaceIface::countTx(int msgType) {
+    Stats.tx(msgType);
+}
+
+const TStatsMsgCounters & TIfaceIface::getStats() {
+    return Stats;
+}
+
 /*
  *  releases data allocated for ll addresses
  */
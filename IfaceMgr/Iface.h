@@ -19,6 +19,7 @@
 #include "Container.h"
 #include "SocketIPv6.h"
 #include "IPv6Addr.h"
+#include "StatsMgr.h"
 
 /*
  * represents network interface 
@@ -40,6 +41,7 @@ class TIfaceIface{
     bool flagMulticast();
     bool flagLoopback();
     void updateState(struct iface * x);
+    void updateFlags(unsigned int flags);
 
     // ---layer-2 related---
     int   getMacLen();
@@ -48,6 +50,8 @@ class TIfaceIface{
     char* firstLLAddress();
     char* getLLAddress();
     int   countLLAddress();
+    void  addLLAddress(char * addr);
+    void  delLLAddress(char * addr);
 
     void firstGlobalAddr();
     SPtr<TIPv6Addr> getGlobalAddr();
@@ -63,7 +67,7 @@ class TIfaceIface{
     int getPrefixLength();
     
     // ---socket related---
-    bool addSocket(SPtr<TIPv6Addr> addr,int port, bool ifaceonly, bool reuse);
+    bool addSocket(SPtr<TIPv6Addr> addr,int port, bool ifaceonly, int reuse);
     // bool addSocket(int port, bool ifaceonly, bool reuse); 
     bool delSocket(int id);
     void firstSocket();
@@ -72,6 +76,11 @@ class TIfaceIface{
     SPtr<TIfaceSocket> getSocketByAddr(SPtr<TIPv6Addr> addr);
     int countSocket();
 
+    // ---statistics---
+    void countRx(int msgType);
+    void countTx(int msgType);
+    const TStatsMsgCounters & getStats();
+
     virtual ~TIfaceIface();
 
  protected:
@@ -96,6 +105,8 @@ class TIfaceIface{
     char*   PresLLAddr;
 
     int PrefixLen; // used during address adding
+
+    TStatsMsgCounters Stats;
 };
 
 typedef std::list < SPtr<TIfaceIface> > TIfaceIfaceLst;
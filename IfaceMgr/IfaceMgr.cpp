@@ -25,6 +25,8 @@
 #include "OptIAAddress.h"
 #include "OptIAPrefix.h"
 #include "ScriptParams.h"
+#include "ScriptExecutor.h"
+#include "StatsMgr.h"
 
 using namespace std;
 
@@ -36,6 +38,8 @@ TIfaceMgr::TIfaceMgr(const std::string& xmlFile, bool getIfaces)
 {
     this->XmlFile = xmlFile;
     this->IsDone  = false;
+    this->EventsFD = -1;
+    this->AddrChanges = 0;
     struct iface  * ptr;
     struct iface  * ifaceList;
 
@@ -150,7 +154,6 @@ SPtr<TIfaceIface> TIfaceMgr::getIfaceBySocket(int fd) {
 int TIfaceMgr::select(unsigned long time, char *buf,
                       int &bufsize, SPtr<TIPv6Addr> peer) {
     struct timeval czas;
-    int result;
     if (time > DHCPV6_INFINITY/2)
         time /=2;
 
@@ -162,6 +165,21 @@ int TIfaceMgr::select(unsigned long time, char *buf,
 
     czas.tv_sec=time;
     czas.tv_usec=0;
+    return select(czas, buf, bufsize, peer);
+}
+
+/*
+ * same as above, but with sub-second timeout
+ * @param czas listens for that long (may be modified)
+ * @param buf buffer
+ * @param bufsize buffer size
+ * @param peer informations about sender
+ *
+ * @return socket descriptor (or 0)
+ */
+int TIfaceMgr::select(struct timeval &czas, char *buf,
+                      int &bufsize, SPtr<TIPv6Addr> peer) {
+    int result;
 
     // tricks with FDS macros
     fd_set fds;
@@ -170,8 +188,24 @@ int TIfaceMgr::select(unsigned long time, char *buf,
     int maxFD;
     //maxFD = FD_SETSIZE;
     maxFD = TIfaceSocket::getMaxFD() + 1;
+    if (EventsFD >= 0) {
+        FD_SET(EventsFD, &fds);
+        if (EventsFD >= maxFD)
+            maxFD = EventsFD + 1;
+    }
+    int statsFD = StatsMgr().getFD();
+    if (statsFD >= 0) {
+        FD_SET(statsFD, &fds);
+        if (statsFD >= maxFD)
+            maxFD = statsFD + 1;
+    }
+    fd_set wfds;
+    FD_ZERO(&wfds);
+    int extraFD = selectAddFDs(&fds, &wfds);
+    if (extraFD >= maxFD)
+        maxFD = extraFD + 1;
 
-    result = ::select(maxFD,&fds,NULL, NULL, &czas);
+    result = ::select(maxFD,&fds,&wfds, NULL, &czas);
 
     // something received
 
@@ -186,6 +220,31 @@ int TIfaceMgr::select(unsigned long time, char *buf,
         return 0;
     }
 
+    if ( (EventsFD >= 0) && FD_ISSET(EventsFD, &fds) ) {
+        processIfaceEvents();
+        if (!--result) {
+            // only interface changes, no packets
+            bufsize = 0;
+            return 0;
+        }
+    }
+
+    if ( (statsFD >= 0) && FD_ISSET(statsFD, &fds) ) {
+        StatsMgr().serve();
+        if (!--result) {
+            bufsize = 0;
+            return 0;
+        }
+    }
+
+    if (extraFD >= 0) {
+        result -= selectProcessFDs(&fds, &wfds);
+        if (result <= 0) {
+            bufsize = 0;
+            return 0;
+        }
+    }
+
     SPtr<TIfaceIface> iface;
     SPtr<TIfaceSocket> sock;
     bool found = 0;
@@ -237,10 +296,34 @@ int TIfaceMgr::select(unsigned long time, char *buf,
     }
 #endif
 
+    if (result > 0)
+        iface->countRx(buf[0]);
     bufsize = result;
     return sock->getFD();
 }
 
+/**
+ * adds descriptors (other than DHCPv6 sockets) that select() should watch.
+ * Derived classes that need it should override this and selectProcessFDs().
+ *
+ * @param rd descriptors to be checked for reading
+ * @param wr descriptors to be checked for writing
+ *
+ * @return highest descriptor added (or -1 if none)
+ */
+int TIfaceMgr::selectAddFDs(fd_set * rd, fd_set * wr) {
+    return -1;
+}
+
+/**
+ * handles descriptors added by selectAddFDs() that are ready
+ *
+ * @return number of ready descriptors handled (each set counted separately, as select() does)
+ */
+int TIfaceMgr::selectProcessFDs(fd_set * rd, fd_set * wr) {
+    return 0;
+}
+
 /*
  * returns interface count
  */
@@ -248,6 +331,151 @@ int TIfaceMgr::countIface() {
         return IfaceLst.count();
 }
 
+/**
+ * Compares current flags of interfaces with old flags. If change is detected,
+ * stored flags of the interface are updated. This re-reads whole interface list,
+ * so it is used only if asynchronous notifications are not available (or
+ * some of them were lost).
+ */
+void TIfaceMgr::redetectIfaces() {
+    struct iface  * ptr;
+    struct iface  * ifaceList;
+    SPtr<TIfaceIface> iface;
+    ifaceList = if_list_get(); // external (C coded) function
+    ptr = ifaceList;
+
+    if  (!ifaceList) {
+        Log(Error) << "Unable to read interface info. Inactive mode failed." << LogEnd;
+        return;
+    }
+    while (ptr!=NULL) {
+        iface = getIfaceByID(ptr->id);
+        if (iface && (ptr->flags!=iface->getFlags())) {
+            Log(Notice) << "Flags on interface " << iface->getFullName() << " has changed (old=" << hex <<iface->getFlags()
+                        << ", new=" << ptr->flags << ")." << dec << LogEnd;
+            iface->updateState(ptr);
+            AddrChanges++;
+        }
+        ptr = ptr->next;
+    }
+
+    if_list_release(ifaceList); // allocated in pure C, and so release it there
+}
+
+/**
+ * subscribes to link and address change notifications. Once subscribed,
+ * interface state is updated incrementally and select() wakes up on every change,
+ * so there is no need to periodically call redetectIfaces().
+ *
+ * @return true if notifications are available on this system
+ */
+bool TIfaceMgr::trackIfaceEvents() {
+    if (EventsFD >= 0)
+        return true;
+
+    int fd = iface_events_open();
+    if (fd < 0) {
+        Log(Debug) << "Interface change notifications not available, interfaces will be polled." << LogEnd;
+        return false;
+    }
+    EventsFD = fd;
+    Log(Debug) << "Interface change notifications enabled (fd=" << EventsFD << ")." << LogEnd;
+    return true;
+}
+
+/**
+ * returns true if interface state is kept up to date by notifications
+ */
+bool TIfaceMgr::ifaceEventsActive() {
+    return EventsFD >= 0;
+}
+
+/**
+ * returns counter that changes every time global addresses on any interface
+ * might have changed, so users caching them know when to look again
+ */
+unsigned long TIfaceMgr::addrChanges() {
+    return AddrChanges;
+}
+
+/**
+ * reads all pending link/address notifications and applies them
+ */
+void TIfaceMgr::processIfaceEvents() {
+    struct iface_event events[MAX_IFACE_EVENTS_AT_ONCE];
+    int cnt;
+
+    do {
+        cnt = iface_events_get(EventsFD, events, MAX_IFACE_EVENTS_AT_ONCE);
+        if (cnt == LOWLEVEL_ERROR_UNSPEC) {
+            Log(Warning) << "Some interface change notifications were lost, "
+                         << "re-reading all interfaces." << LogEnd;
+            redetectIfaces();
+            return;
+        }
+        if (cnt < 0) {
+            Log(Error) << "Failed to read interface change notifications: " << error_message()
+                       << " Switching back to interface polling." << LogEnd;
+            iface_events_close(EventsFD);
+            EventsFD = -1;
+            return;
+        }
+        for (int i = 0; i < cnt; i++)
+            applyIfaceEvent(events[i]);
+    } while (cnt == MAX_IFACE_EVENTS_AT_ONCE);
+}
+
+/**
+ * updates state of a single interface
+ *
+ * @param ev received notification
+ */
+void TIfaceMgr::applyIfaceEvent(const struct iface_event& ev) {
+    SPtr<TIfaceIface> iface = getIfaceByID(ev.id);
+    if (!iface)
+        return; // we don't care about interfaces we don't know
+
+    switch (ev.type) {
+    case IFACE_EVENT_LINK:
+        if (ev.flags != iface->getFlags()) {
+            Log(Notice) << "Flags on interface " << iface->getFullName() << " has changed (old=" << hex
+                        << iface->getFlags() << ", new=" << ev.flags << ")." << dec << LogEnd;
+            iface->updateFlags(ev.flags);
+        }
+        break;
+    case IFACE_EVENT_LINK_DEL:
+        Log(Notice) << "Interface " << iface->getFullName() << " has been removed." << LogEnd;
+        iface->updateFlags(0);
+        break;
+    case IFACE_EVENT_ADDR_ADD:
+    case IFACE_EVENT_ADDR_DEL:
+    {
+        char * addr = const_cast<char*>(ev.addr);
+        SPtr<TIPv6Addr> ip = new TIPv6Addr(addr);
+        bool add = (ev.type == IFACE_EVENT_ADDR_ADD);
+        if ((unsigned char)addr[0] == 0xff)
+            break; // multicast, ignore it
+        Log(Debug) << "Address " << ip->getPlain() << (add?" added to ":" removed from ")
+                   << iface->getFullName() << "." << LogEnd;
+        if ((unsigned char)addr[0] == 0xfe && ((unsigned char)addr[1] & 0xc0) == 0x80) {
+            if (add)
+                iface->addLLAddress(addr);
+            else
+                iface->delLLAddress(addr);
+            break;
+        }
+        iface->firstGlobalAddr();
+        iface->delGlobalAddr(ip);
+        if (add)
+            iface->addGlobalAddr(ip);
+        AddrChanges++;
+        break;
+    }
+    default:
+        break;
+    }
+}
+
 /*
  * dump yourself to file
  */
@@ -260,10 +488,12 @@ void TIfaceMgr::dump()
 }
 
 /*
- * destructor. Does really nothing. (SPtr is a sweet thing, isn't it?)
+ * destructor. Does almost nothing. (SPtr is a sweet thing, isn't it?)
  */
 TIfaceMgr::~TIfaceMgr()
 {
+    if (EventsFD >= 0)
+        iface_events_close(EventsFD);
 }
 
 string TIfaceMgr::printMac(char * mac, int macLen) {
@@ -357,30 +587,15 @@ void TIfaceMgr::notifyScripts(std::string scriptName, SPtr<TMsg> question, SPtr<
     }
 }
 
+/// queues script notification, script is run in the background (see TScriptExecutor)
 void TIfaceMgr::notifyScript(std::string scriptName, std::string action, TNotifyScriptParams& params) {
-    const char * argv[3];
-
     // get PATH
     char * path = getenv("PATH");
     if (path) {
         params.addParam("PATH", string(path));
     }
 
-    // parameters: [0] - script name, [1] - action (add, modify, delete)
-    argv[0] = scriptName.c_str();
-    argv[1] = action.c_str();
-    argv[2] = NULL;
-    
-    Log(Debug) << "About to execute " << scriptName << " script, "
-               << params.envCnt << " variables." << LogEnd;
-    int returnCode = execute(scriptName.c_str(), argv, params.env);
-
-    if (returnCode>=0) {
-        Log(Debug) << "Script execution complete, return code=" << returnCode << LogEnd;
-    } else {
-        // negative return code, something went wrong
-        Log(Warning) << "Script execution failed, return code=" << returnCode << LogEnd;
-    }
+    ScriptExecutor().run(scriptName, action, params);
 }
 
 void TIfaceMgr::notifyScripts(std::string scriptName, SPtr<TMsg> question, SPtr<TMsg> reply,
@@ -453,6 +668,19 @@ void TIfaceMgr::notifyScripts(std::string scriptName, SPtr<TMsg> question, SPtr<
 
 
 
+/// prints received/sent message counters of all interfaces
+void TIfaceMgr::printStats(std::ostream & out) {
+    SPtr<TIfaceIface> iface;
+    TStatsMgr::printType(out, "dibbler_rx_messages_total", "counter", "Received messages by interface and type.");
+    IfaceLst.first();
+    while (iface = IfaceLst.get())
+        TStatsMgr::printMsgCounters(out, iface->getName(), iface->getStats(), false);
+    TStatsMgr::printType(out, "dibbler_tx_messages_total", "counter", "Sent messages by interface and type.");
+    IfaceLst.first();
+    while (iface = IfaceLst.get())
+        TStatsMgr::printMsgCounters(out, iface->getName(), iface->getStats(), true);
+}
+
 // --------------------------------------------------------------------
 // --- operators ------------------------------------------------------
 // --------------------------------------------------------------------
@@ -34,11 +34,19 @@ class TIfaceMgr {
     SPtr<TIfaceIface> getIfaceByID(int id);
     SPtr<TIfaceIface> getIfaceBySocket(int fd);
     int countIface();
+    virtual void redetectIfaces();
+
+    // ---link/address change notifications---
+    bool trackIfaceEvents();
+    bool ifaceEventsActive();
+    unsigned long addrChanges();
 
     // ---other---
     int select(unsigned long time, char *buf, int &bufsize, SPtr<TIPv6Addr> peer);
+    int select(struct timeval &timeout, char *buf, int &bufsize, SPtr<TIPv6Addr> peer);
     std::string printMac(char * mac, int macLen);
     void dump();
+    void printStats(std::ostream & out);
     bool isDone();
 
     void notifyScripts(std::string scriptName, SPtr<TMsg> question, SPtr<TMsg> answer);
@@ -50,10 +58,18 @@ class TIfaceMgr {
 
  protected:
     virtual void optionToEnv(TNotifyScriptParams& params, SPtr<TOpt> opt, std::string txtPrefix );
+    void processIfaceEvents();
+    void applyIfaceEvent(const struct iface_event& ev);
+
+    // extra descriptors watched by select() (e.g. TCP connections)
+    virtual int selectAddFDs(fd_set * rd, fd_set * wr);
+    virtual int selectProcessFDs(fd_set * rd, fd_set * wr);
 
     std::string XmlFile;
     List(TIfaceIface) IfaceLst; //Interface list
     bool IsDone; 
+    int EventsFD; // rtnetlink (or similar) socket, -1 if not available
+    unsigned long AddrChanges; // bumped whenever global addresses may have changed
 };
 
 #endif
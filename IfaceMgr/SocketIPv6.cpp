@@ -34,10 +34,10 @@ int TIfaceSocket::MaxFD=0;
  * @param port    UDP port, to which socket will be bound
  * @param addr    IPv6 address 
  * @param ifaceonly force interface-only flag in setsockopt()?
- * @param reuse   should socket be bound with reuse flag in setsockopt()?
+ * @param reuse   reuse mode (0, LOWLEVEL_REUSE_ADDR or LOWLEVEL_REUSE_PORT)
  */
 TIfaceSocket::TIfaceSocket(char * iface, int ifindex, int port,
-				   SPtr<TIPv6Addr> addr, bool ifaceonly, bool reuse) { 
+				   SPtr<TIPv6Addr> addr, bool ifaceonly, int reuse) { 
     if (this->Count==0) {
 	FD_ZERO(getFDS());
     }
@@ -56,9 +56,9 @@ enum EState TIfaceSocket::getStatus() {
  * @param ifaceid    interface index
  * @param port       UDP port, to which socket will be bound
  * @param ifaceonly  force interface-only flag in setsockopt()?
- * @param reuse      should socket be bound with reuse flag in setsockopt()?
+ * @param reuse      reuse mode (0, LOWLEVEL_REUSE_ADDR or LOWLEVEL_REUSE_PORT)
  */
-TIfaceSocket::TIfaceSocket(char * iface,int ifaceid, int port,bool ifaceonly, bool reuse) {
+TIfaceSocket::TIfaceSocket(char * iface,int ifaceid, int port,bool ifaceonly, int reuse) {
     if (this->Count==0) {
 	FD_ZERO(getFDS());
     }
@@ -77,12 +77,12 @@ TIfaceSocket::TIfaceSocket(char * iface,int ifaceid, int port,bool ifaceonly, bo
  * @param port - port, to which socket will be bound
  * @param addr - address 
  * @param ifaceonly - force interface-only flag in setsockopt()
- * @param reuse should socket be bound with reuse flag in setsockopt()?
+ * @param reuse reuse mode (0, LOWLEVEL_REUSE_ADDR or LOWLEVEL_REUSE_PORT)
  *
  * @return negative error code (or 0 if everything is ok)
  */
 int TIfaceSocket::createSocket(char * iface, int ifaceid, SPtr<TIPv6Addr> addr, 
-				   int port, bool ifaceonly, bool reuse) {
+				   int port, bool ifaceonly, int reuse) {
     int sock;
 
     // store info about this socket 
@@ -101,7 +101,7 @@ int TIfaceSocket::createSocket(char * iface, int ifaceid, SPtr<TIPv6Addr> addr,
 
     // create socket
     sock = sock_add(this->Iface, this->IfaceID, addr->getPlain(), 
-		    this->Port, ifaceonly?1:0, reuse?1:0);
+		    this->Port, ifaceonly?1:0, reuse);
 
     if (sock<0) {
 	printError(sock, iface, ifaceid, addr, port);
@@ -145,6 +145,43 @@ int TIfaceSocket::send(char * buf,int len, SPtr<TIPv6Addr> addr,int port) {
     return result;
 }
 
+/**
+ * sends one datagram, stored in several fragments, to several destinations
+ * at once. Fragments are passed to the kernel as they are (no copying).
+ * @param bufs - fragments of the datagram
+ * @param lens - fragment lengths
+ * @param bufCnt - number of fragments
+ * @param addrs - destination addresses
+ * @param port - to which port
+ * returns number of destinations the data was sent to or -1 if nothing was sent
+ */
+int TIfaceSocket::send(char ** bufs, int * lens, int bufCnt, List(TIPv6Addr) & addrs, int port) {
+    char * packed[LOWLEVEL_MAX_DESTS];
+    SPtr<TIPv6Addr> addr;
+    int cnt = 0;
+    int sent = 0;
+
+    addrs.first();
+    while (addr = addrs.get()) {
+	packed[cnt++] = addr->getAddr();
+	if (cnt < LOWLEVEL_MAX_DESTS && sent + cnt < addrs.count())
+	    continue;
+
+	int result = sock_send_multi(this->FD, packed, cnt, bufs, lens, bufCnt, port, this->IfaceID);
+	if (result < cnt) {
+	    if (result > 0)
+		sent += result;
+	    Log(Error) << "Failed to send data to " << (addrs.count() - sent) << " of "
+		       << addrs.count() << " address(es) on " << this->Iface << "/" << this->IfaceID
+		       << ": " << error_message() << LogEnd;
+	    return sent ? sent : -1;
+	}
+	sent += result;
+	cnt = 0;
+    }
+    return sent;
+}
+
 /**
  * receives data from socket
  * @param buf - received data are stored here
@@ -23,6 +23,7 @@ class TIfaceSocket;
 #include "DHCPConst.h"
 #include "IPv6Addr.h"
 #include "SmartPtr.h"
+#include "Container.h"
 
 /*
  * repesents network socket
@@ -31,12 +32,13 @@ class TIfaceSocket {
     friend std::ostream& operator<<(std::ostream& strum, TIfaceSocket &x);
  public:
     TIfaceSocket(char * iface,int ifaceid, int port, 
-		     SPtr<TIPv6Addr> addr, bool ifaceonly, bool reuse);
+		     SPtr<TIPv6Addr> addr, bool ifaceonly, int reuse);
     TIfaceSocket(char * iface,int ifaceid, int port,
-		     bool ifaceonly, bool reuse);
+		     bool ifaceonly, int reuse);
    
     // ---transmission---
     int send(char * buf,int len, SPtr<TIPv6Addr> addr,int port);
+    int send(char ** bufs, int * lens, int bufCnt, List(TIPv6Addr) & addrs, int port);
     int recv(char * buf,SPtr<TIPv6Addr> addr);
     
     // ---get info---
@@ -58,7 +60,7 @@ class TIfaceSocket {
  private:
     // adds socket to this interface
     int createSocket(char * iface, int ifaceid, SPtr<TIPv6Addr> addr, 
-		     int port, bool ifaceonly, bool reuse);
+		     int port, bool ifaceonly, int reuse);
     void printError(int error, char * iface, int ifaceid, SPtr<TIPv6Addr> addr, int port);
 
     // FileDescriptor
@@ -115,8 +115,7 @@ int TMsg::storeSelf(char * buffer)
 
     TOptList::iterator option;
     for (option=Options.begin(); option!=Options.end(); ++option) {
-        (*option)->storeSelf(buffer);
-	buffer += (*option)->getSize();
+        buffer = (*option)->storeSelf(buffer);
     }
 
 #ifndef MOD_DISABLE_AUTH
@@ -128,31 +127,7 @@ int TMsg::storeSelf(char * buffer)
 
     if (AuthInfoKey && AuthInfoPtr && (getOption(OPTION_AUTH) || getOption(OPTION_AAAAUTH)) && UsedDigestType != DIGEST_NONE) {
             Log(Debug) << "Auth: Used digest type is " << getDigestName(UsedDigestType) << LogEnd;
-            switch (UsedDigestType) {
-                    case DIGEST_PLAIN:
-                        memcpy(AuthInfoPtr, "This is 32-byte plain testkey...", getDigestSize(UsedDigestType));
-                        break;
-                    case DIGEST_HMAC_MD5:
-                        hmac_md5(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr);
-                        break;
-                    case DIGEST_HMAC_SHA1:
-                        hmac_sha(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr, 1);
-                        break;
-                    case DIGEST_HMAC_SHA224:
-                        hmac_sha(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr, 224);
-                        break;
-                    case DIGEST_HMAC_SHA256:
-                        hmac_sha(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr, 256);
-                        break;
-                    case DIGEST_HMAC_SHA384:
-                        hmac_sha(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr, 384);
-                        break;
-                    case DIGEST_HMAC_SHA512:
-                        hmac_sha(start, buffer-start, AuthInfoKey, AUTHKEYLEN, (char *)AuthInfoPtr, 512);
-                        break;
-                    default:
-                        break;
-            }
+            calculateAuthInfo(start, buffer-start, UsedDigestType, AuthInfoPtr);
             PrintHex("Auth: Sending digest: ", AuthInfoPtr, getDigestSize(UsedDigestType));
     }
 #endif
@@ -272,6 +247,112 @@ int TMsg::setAuthInfoKey() {
     return 0;
 }
 
+/**
+ * calculates Authentication Information (digest) of a message using AuthInfoKey
+ *
+ * Prepared HMAC key is taken from the key list if possible, so padded key
+ * blocks are not hashed again for every message.
+ *
+ * @param buf message (with Authentication Information field zeroed)
+ * @param bufSize message length
+ * @param type digest type
+ * @param result digest is stored here (getDigestSize(type) bytes)
+ */
+void TMsg::calculateAuthInfo(char *buf, int bufSize, enum DigestTypes type, char *result) {
+#ifndef MOD_DISABLE_AUTH
+    if (type == DIGEST_PLAIN) {
+        // [s] change the key to something that make sense
+        memcpy(result, "This is 32-byte plain testkey...", 32);
+        return;
+    }
+
+    struct hmac_key hk;
+    if (getHmacKey(type, &hk))
+        hmac_key_digest(&hk, buf, bufSize, result);
+#endif
+}
+
+/**
+ * prepares HMAC key for AuthInfoKey, taken from the key list if possible
+ *
+ * @param type digest type
+ * @param hk prepared key is stored here
+ *
+ * @return false if type is not a HMAC digest (or key can't be prepared)
+ */
+bool TMsg::getHmacKey(enum DigestTypes type, struct hmac_key *hk) {
+#ifndef MOD_DISABLE_AUTH
+    int hmacType;
+    switch (type) {
+    case DIGEST_HMAC_MD5:    hmacType = 5;   break;
+    case DIGEST_HMAC_SHA1:   hmacType = 1;   break;
+    case DIGEST_HMAC_SHA224: hmacType = 224; break;
+    case DIGEST_HMAC_SHA256: hmacType = 256; break;
+    case DIGEST_HMAC_SHA384: hmacType = 384; break;
+    case DIGEST_HMAC_SHA512: hmacType = 512; break;
+    default:
+        return false;
+    }
+
+    if (AuthKeys && AuthKeys->getHmac(SPI, AuthInfoKey, hmacType, hk))
+        return true;
+    return !hmac_key_init(hk, AuthInfoKey, AUTHKEYLEN, hmacType);
+#else
+    return false;
+#endif
+}
+
+/**
+ * calculates Authentication Information of several received messages at once
+ *
+ * HMAC-SHA digests of the whole batch are computed together by multi-buffer
+ * code. Results are kept in the messages, validateAuthInfo() then only
+ * compares them with received ones. Buffers are left unchanged.
+ *
+ * @param msgs decoded messages
+ * @param bufs received data of these messages (as passed to validateAuthInfo())
+ * @param bufSizes lengths of received data
+ * @param count number of messages
+ */
+void TMsg::calculateAuthInfo(TMsg * msgs[], char * bufs[], int bufSizes[], int count) {
+#ifndef MOD_DISABLE_AUTH
+    std::vector<struct hmac_key> keys(count);
+    std::vector<const struct hmac_key*> hk;
+    std::vector<const char*> buffer;
+    std::vector<size_t> len;
+    std::vector<char*> result;
+    std::vector<TMsg*> batch;
+    std::vector<std::string> rcvd;
+
+    for (int i = 0; i < count; i++) {
+        TMsg * msg = msgs[i];
+        msg->PrecalculatedAuthInfo.clear();
+        if (!msg->AuthInfoPtr || !msg->AuthInfoKey || msg->DigestType == DIGEST_NONE ||
+            msg->DigestType == DIGEST_PLAIN || !msg->getHmacKey(msg->DigestType, &keys[i]))
+            continue;
+
+        // digest is calculated with Authentication Information field zeroed
+        unsigned authInfoLen = getDigestSize(msg->DigestType);
+        rcvd.push_back(std::string(msg->AuthInfoPtr, authInfoLen));
+        memset(msg->AuthInfoPtr, 0, authInfoLen);
+
+        msg->PrecalculatedAuthInfo.resize(authInfoLen);
+        hk.push_back(&keys[i]);
+        buffer.push_back(bufs[i]);
+        len.push_back(bufSizes[i]);
+        result.push_back(&msg->PrecalculatedAuthInfo[0]);
+        batch.push_back(msg);
+    }
+    if (batch.empty())
+        return;
+
+    hmac_key_digest_mb(&hk[0], &buffer[0], &len[0], &result[0], batch.size());
+
+    for (unsigned i = 0; i < batch.size(); i++)
+        memcpy(batch[i]->AuthInfoPtr, rcvd[i].data(), rcvd[i].size());
+#endif
+}
+
 char * TMsg::getAuthInfoKey() {
     return AuthInfoKey;
 }
@@ -368,25 +449,11 @@ bool TMsg::validateAuthInfo(char *buf, int bufSize, List(DigestTypes) authLst) {
         memmove(rcvdAuthInfo, AuthInfoPtr, AuthInfoLen);
         memset(AuthInfoPtr, 0, AuthInfoLen);
 
-        switch (DigestType) {
-                // [s] change the key to something that make sense
-                case DIGEST_PLAIN:
-                    memcpy(goodAuthInfo, "This is 32-byte plain testkey...", 32); break;
-                case DIGEST_HMAC_MD5:
-                    hmac_md5(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo); break;
-                case DIGEST_HMAC_SHA1:
-                    hmac_sha(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo, 1); break;
-                case DIGEST_HMAC_SHA224:
-                    hmac_sha(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo, 224); break;
-                case DIGEST_HMAC_SHA256:
-                    hmac_sha(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo, 256); break;
-                case DIGEST_HMAC_SHA384:
-                    hmac_sha(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo, 384); break;
-                case DIGEST_HMAC_SHA512:
-                    hmac_sha(buf, bufSize, AuthInfoKey, AUTHKEYLEN, goodAuthInfo, 512); break;
-                default:
-                    break;
-        }
+        if (PrecalculatedAuthInfo.size() == AuthInfoLen)
+            memcpy(goodAuthInfo, &PrecalculatedAuthInfo[0], AuthInfoLen);
+        else
+            calculateAuthInfo(buf, bufSize, DigestType, goodAuthInfo);
+        PrecalculatedAuthInfo.clear();
         if (0 == memcmp(goodAuthInfo, rcvdAuthInfo, AuthInfoLen))
             is_ok = true;
 
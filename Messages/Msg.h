@@ -15,6 +15,7 @@ class TMsg;
 #include <iostream>
 #include <string>
 #include <list>
+#include <vector>
 #include "SmartPtr.h"
 #include "Container.h"
 #include "DHCPConst.h"
@@ -67,6 +68,7 @@ class TMsg
     char * getAuthInfoKey();
     bool validateAuthInfo(char *buf, int bufSize, List(DigestTypes) authLst);
     bool validateAuthInfo(char *buf, int bufSize);
+    static void calculateAuthInfo(TMsg * msgs[], char * bufs[], int bufSizes[], int count);
     uint32_t getAAASPI();
     void setAAASPI(uint32_t val);
     uint32_t getSPI();
@@ -93,6 +95,8 @@ class TMsg
     void setAttribs(int iface, SPtr<TIPv6Addr> addr, 
 		    int msgType, long transID);
     virtual bool check(bool clntIDmandatory, bool srvIDmandatory);
+    void calculateAuthInfo(char *buf, int bufSize, enum DigestTypes type, char *result);
+    bool getHmacKey(enum DigestTypes type, struct hmac_key *hk);
     
     bool IsDone; // Is this transaction done?
     char * pkt;  // buffer where this packet will be build
@@ -107,6 +111,7 @@ class TMsg
     uint32_t AAASPI; // AAA-SPI sent by client in OPTION_AAAAUTH
     char *KeyGenNonce;
     unsigned KeyGenNonceLen;
+    std::vector<char> PrecalculatedAuthInfo; // set by batch calculateAuthInfo()
 
     // a pointer to NotifyScriptParams structure (if defined)
     TNotifyScriptParams * NotifyScripts;
@@ -0,0 +1,155 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef ADDRTRIE_H
+#define ADDRTRIE_H
+
+#include <vector>
+#include <string.h>
+
+/**
+ * binary radix tree over IPv6 address space
+ *
+ * Arbitrary address ranges (pools) are split into aligned prefixes and
+ * stored in the tree. find() walks at most 128 bits, so lookup cost does
+ * not depend on the number of ranges. When ranges overlap, the value that
+ * was inserted first wins, which is exactly what a linear scan over the
+ * original list would return.
+ */
+template <class T>
+class TAddrTrie
+{
+public:
+    TAddrTrie() : Count(0) {
+        Nodes.push_back(TNode());
+    }
+
+    /// adds range [lo,hi] (both are 16-byte addresses in network order)
+    void insert(const char* lo, const char* hi, const T& value) {
+        unsigned char l[16], h[16];
+        memcpy(l, lo, 16);
+        memcpy(h, hi, 16);
+        if (memcmp(l, h, 16) > 0) {
+            memcpy(l, hi, 16);
+            memcpy(h, lo, 16);
+        }
+        int order = Count++;
+
+        while (true) {
+            // find the largest aligned block that starts at l and fits within h
+            int hostBits = trailingZeros(l);
+            while (hostBits > 0 && !blockFits(l, h, hostBits))
+                hostBits--;
+            insertPrefix(l, 128 - hostBits, value, order);
+
+            if (!blockNext(l, hostBits) || memcmp(l, h, 16) > 0)
+                break;
+        }
+    }
+
+    /// returns value of the first inserted range that contains addr (or T())
+    T find(const char* addr) const {
+        const unsigned char* a = (const unsigned char*)addr;
+        int best = -1;
+        int node = 0;
+        for (int bit = 0; ; bit++) {
+            const TNode& n = Nodes[node];
+            if (n.Order >= 0 && (best < 0 || n.Order < Nodes[best].Order))
+                best = node;
+            if (bit == 128)
+                break;
+            node = n.Child[(a[bit/8] >> (7 - bit%8)) & 1];
+            if (node < 0)
+                break;
+        }
+        if (best < 0)
+            return T();
+        return Nodes[best].Value;
+    }
+
+    void clear() {
+        Nodes.clear();
+        Nodes.push_back(TNode());
+        Count = 0;
+    }
+
+    bool empty() const {
+        return Count == 0;
+    }
+
+private:
+    struct TNode {
+        TNode() : Order(-1) { Child[0] = Child[1] = -1; }
+        int Child[2];
+        int Order;  // insertion order of Value (-1 if node holds no value)
+        T   Value;
+    };
+
+    void insertPrefix(const unsigned char* prefix, int len, const T& value, int order) {
+        int node = 0;
+        for (int bit = 0; bit < len; bit++) {
+            int dir = (prefix[bit/8] >> (7 - bit%8)) & 1;
+            int next = Nodes[node].Child[dir];
+            if (next < 0) {
+                next = (int)Nodes.size();
+                Nodes.push_back(TNode());
+                Nodes[node].Child[dir] = next;
+            }
+            node = next;
+        }
+        TNode& n = Nodes[node];
+        if (n.Order < 0 || order < n.Order) {
+            n.Order = order;
+            n.Value = value;
+        }
+    }
+
+    /// number of trailing zero bits in a 128-bit address
+    static int trailingZeros(const unsigned char* a) {
+        int bits = 0;
+        for (int i = 15; i >= 0; i--) {
+            if (!a[i]) {
+                bits += 8;
+                continue;
+            }
+            for (unsigned char b = a[i]; !(b & 1); b >>= 1)
+                bits++;
+            break;
+        }
+        return bits;
+    }
+
+    /// does block starting at l with hostBits host bits end at or before h?
+    static bool blockFits(const unsigned char* l, const unsigned char* h, int hostBits) {
+        unsigned char end[16];
+        memcpy(end, l, 16);
+        for (int i = 15; hostBits > 0; i--, hostBits -= 8)
+            end[i] |= (hostBits >= 8) ? 0xff : ((1 << hostBits) - 1);
+        return memcmp(end, h, 16) <= 0;
+    }
+
+    /// l += 2^hostBits; returns false on wrap-around
+    static bool blockNext(unsigned char* l, int hostBits) {
+        if (hostBits == 128)
+            return false;
+        int i = 15 - hostBits/8;
+        unsigned int carry = 1 << (hostBits%8);
+        for (; i >= 0 && carry; i--) {
+            carry += l[i];
+            l[i] = carry & 0xff;
+            carry >>= 8;
+        }
+        return !carry;
+    }
+
+    std::vector<TNode> Nodes;
+    int Count;
+};
+
+#endif
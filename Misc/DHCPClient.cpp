@@ -20,12 +20,19 @@
 #include "ClntIfaceMgr.h"
 #include "Logger.h"
 #include "Portable.h"
+#include "StatsMgr.h"
+#include "ScriptExecutor.h"
 
 using namespace std;
 
 volatile int serviceShutdown;
 volatile int linkstateChange;
 
+static void printClientStats(std::ostream & out) {
+    ClntIfaceMgr().printStats(out);
+    ScriptExecutor().printStats(out);
+}
+
 TDHCPClient::TDHCPClient(const std::string config)
   :IsDone(false)
 {
@@ -46,8 +53,10 @@ TDHCPClient::TDHCPClient(const std::string config)
         this->IsDone = true;
         return;
     }
+    ClntCfgMgr().setupScriptExecutor();
 
-	TClntAddrMgr::instanceCreate(ClntCfgMgr().getDUID(), ClntCfgMgr().useConfirm(), CLNTADDRMGR_FILE, false);
+	TClntAddrMgr::instanceCreate(ClntCfgMgr().getDUID(), ClntCfgMgr().useConfirm(), CLNTADDRMGR_FILE, false,
+                                 ClntCfgMgr().getBinaryLeaseDb() ? CLNTADDRDB_FILE : "");
     if ( ClntAddrMgr().isDone() ) {
      	Log(Crit) << "Fatal error during AddrMgr initialization." << LogEnd;
   	    IsDone = true;
@@ -65,6 +74,9 @@ TDHCPClient::TDHCPClient(const std::string config)
         initLinkStateChange();
     else
 	Log(Debug) << "Confirm disabled, skipping link change detection." << LogEnd;
+
+    StatsMgr().addProvider(printClientStats);
+    StatsMgr().open(CLNTSTATS_SOCKET);
 }
 
 /** 
@@ -145,13 +157,17 @@ void TDHCPClient::run()
 #ifdef MOD_CLNT_CONFIRM	
         if (linkstateChange) {
           ClntAddrMgr().setIA2Confirm(&linkstates);
+          ClntTransMgr().scheduleCheck();
           this->resetLinkstate();
         }
 #endif
 
 	ClntTransMgr().doDuties();
+	ScriptExecutor().doDuties();
 	
 	unsigned int timeout = ClntTransMgr().getTimeout();
+	if (timeout > ScriptExecutor().getTimeout())
+	    timeout = ScriptExecutor().getTimeout();
 
 	if (timeout == 0)
 	    timeout = 1;
@@ -175,6 +191,9 @@ void TDHCPClient::run()
             ClntTransMgr().relayMsg(msg);
         }
     }
+    ClntIfaceMgr().flushDNSUpdates();
+    ScriptExecutor().flush(ScriptExecutor().getScriptTimeout());
+    StatsMgr().close();
     Log(Notice) << "Bye bye." << LogEnd;
 }
 
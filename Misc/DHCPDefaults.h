@@ -55,4 +55,91 @@
 
 #define CLIENT_DEFAULT_FQDN_FLAG_S true
 
+/* min. number of seconds between two periodic dumps of client state files */
+#define CLIENT_DEFAULT_DUMP_INTERVAL 5
+
+/* min. number of seconds between two dumps of server config (and its counters) */
+#define SERVER_DEFAULT_DUMP_INTERVAL 10
+
+/* min. number of seconds between two writes of server lease database (0 = after every message) */
+#define SERVER_DEFAULT_LEASE_DUMP_INTERVAL 1
+
+/* number of seconds address offered in ADVERTISE is held for client (waiting for REQUEST) */
+#define SERVER_DEFAULT_OFFER_LIFETIME 60
+
+/* max. number of addresses (and separately temp. addresses, prefixes) held as offers on one link */
+#define SERVER_DEFAULT_OFFER_LIMIT 4096
+
+/* admission control: how often (in secs) refilled per-client and per-link buckets are forgotten */
+#define SERVER_DEFAULT_ADMISSION_PURGE 60
+
+/* max. number of received packets waiting to be processed by server */
+#define SERVER_DEFAULT_RECV_QUEUE_SIZE 256
+
+/* received packets waiting longer (in ms) are considered stale and dropped */
+#define SERVER_DEFAULT_RECV_QUEUE_MAX_AGE 2000
+
+/* max. number of queued packets decoded together (their HMACs are computed in
+   one multi-buffer pass, so it matches SHA_MB_LANES) */
+#define SERVER_DEFAULT_DECODE_BATCH 8
+
+/* lease replication: heartbeat interval, peer timeout and reconnect interval (in secs) */
+#define SERVER_DEFAULT_REPL_HEARTBEAT 5
+#define SERVER_DEFAULT_REPL_TIMEOUT 15
+#define SERVER_DEFAULT_REPL_RETRY 5
+
+/* lease replication: connection is reset when more bytes wait to be sent (peer too slow) */
+#define SERVER_DEFAULT_REPL_MAX_BACKLOG 16777216
+
+/* lease replication: random picks that found no free address of our own, after which
+   our part of the pool is considered exhausted and peer-owned addresses are used */
+#define SERVER_DEFAULT_REPL_OWNER_TRIES 256
+
+/* lease replication: nothing is assigned after start until peer's leases are received,
+   or this many seconds pass (in secs) */
+#define SERVER_DEFAULT_REPL_GRACE 30
+
+/* lease replication: leases refreshed within this many seconds are equally old, when
+   deciding which one wins a conflict (clock skew and delay between servers, in secs) */
+#define SERVER_DEFAULT_REPL_CLOCK_SKEW 2
+
+/* server workers: max. number of worker processes (dibbler-server -w) */
+#define SERVER_MAX_WORKERS 64
+
+/* server workers: leases kept in shared lease store (table is twice as large) */
+#define SERVER_DEFAULT_LEASE_STORE_SIZE 131072
+
+/* server workers: max. time (in secs) worker waits for previous one to bind its sockets */
+#define SERVER_DEFAULT_WORKER_BIND_TIMEOUT 30
+
+/* how often (in secs) expired authentication keys are removed */
+#define AUTH_DEFAULT_KEY_PURGE 60
+
+/* number of seconds without any reply after which relay considers server down */
+#define RELAY_DEFAULT_FAILOVER_TIMEOUT 3
+
+/* number of seconds after which server considered down is tried again */
+#define RELAY_DEFAULT_FAILOVER_RETRY 30
+
+/* number of consecutive unanswered transactions before server is considered down */
+#define RELAY_DEFAULT_FAILOVER_COUNT 3
+
+/* number of relay worker threads (0 - everything is done by the main thread) */
+#define RELAY_DEFAULT_WORKERS 0
+
+/* max. number of relay worker threads accepted on the command line */
+#define RELAY_MAX_WORKERS 64
+
+/* max. number of notify scripts running at the same time */
+#define SCRIPT_DEFAULT_CONCURRENCY 4
+
+/* max. number of events waiting for notify script (newer events are dropped) */
+#define SCRIPT_DEFAULT_QUEUE_SIZE 1024
+
+/* number of seconds after which notify script is killed */
+#define SCRIPT_DEFAULT_TIMEOUT 30
+
+/* max. number of events passed to one script invocation (1 - no batching) */
+#define SCRIPT_DEFAULT_BATCH 1
+
 #endif /* DHCPDEFAULTS_H */
@@ -15,14 +15,21 @@
 #include "RelCfgMgr.h"
 #include "RelTransMgr.h"
 #include "RelMsg.h"
+#include "StatsMgr.h"
 
 using namespace std;
 
 volatile int serviceShutdown;
+volatile int serviceDump;
+
+static void printRelayStats(std::ostream & out) {
+    RelTransMgr().printStats(out);
+}
 
 TDHCPRelay::TDHCPRelay(const std::string& config)
 {
     serviceShutdown = 0;
+    serviceDump = 0;
     srand(now());
     IsDone = false;
 
@@ -50,17 +57,29 @@ TDHCPRelay::TDHCPRelay(const std::string& config)
     }
     RelIfaceMgr().dump();
     RelTransMgr().dump();
+
+    StatsMgr().addProvider(printRelayStats);
+    StatsMgr().open(RELSTATS_SOCKET);
 }
 
 void TDHCPRelay::run()
 {
     bool silent = false;
+    RelTransMgr().startWorkers();
     while ( (!isDone()) && (!RelTransMgr().isDone()) ) {
     	if (serviceShutdown)
 	    RelTransMgr().shutdown();
+
+	if (serviceDump) {
+	    serviceDump = 0;
+	    Log(Notice) << "Dump requested, writing state files." << LogEnd;
+	    RelIfaceMgr().dump();
+	    RelCfgMgr().dump();
+	    RelTransMgr().dump();
+	}
 	
 	RelTransMgr().doDuties();
-	unsigned int timeout = DHCPV6_INFINITY/2;
+	unsigned int timeout = RelTransMgr().getTimeout();
 	if (serviceShutdown)     timeout = 0;
 	
 	if (!silent)
@@ -75,6 +94,7 @@ void TDHCPRelay::run()
 #endif
 	
 	SPtr<TRelMsg> msg = RelIfaceMgr().select(timeout);
+	RelTransMgr().updateLinkAddrs();
 	if (!msg) 
 	    continue;
 	silent = false;
@@ -85,17 +105,24 @@ void TDHCPRelay::run()
 		    << "/" << iface;
 	if (msg->getType()!=RELAY_FORW_MSG && msg->getType()!=RELAY_REPL_MSG)
 	    Log(Cont) << hex << ",TransID=0x" << msg->getTransID() << dec;
-	Log(Cont) << ", " << msg->countOption() << " opts:";
-	SPtr<TOpt> ptrOpt;
-	msg->firstOption();
-	while ( ptrOpt = msg->getOption() ) {
-	    Log(Cont) << " " << ptrOpt->getOptType(); 
-            // uncomment this to get detailed info about option lengths Log(Cont) << "/" << ptrOpt->getSize();
+	if (msg->getRawData() && !msg->countOption()) {
+	    // options are not decoded, message is relayed as received
+	    Log(Cont) << ", " << msg->getRawLen() << " bytes";
+	} else {
+	    Log(Cont) << ", " << msg->countOption() << " opts:";
+	    SPtr<TOpt> ptrOpt;
+	    msg->firstOption();
+	    while ( ptrOpt = msg->getOption() ) {
+		Log(Cont) << " " << ptrOpt->getOptType(); 
+		// uncomment this to get detailed info about option lengths Log(Cont) << "/" << ptrOpt->getSize();
+	    }
 	}
 	// Log(Cont) << ", " << msg->getRelayCount() << " relay(s).";
 	Log(Cont) << LogEnd;
 	RelTransMgr().relayMsg(msg);
     }
+    RelTransMgr().stopWorkers();
+    StatsMgr().close();
     Log(Notice) << "Bye bye." << LogEnd;
 }
 
@@ -114,11 +141,27 @@ void TDHCPRelay::stop() {
 
 }
 
+/**
+ * requests writing all state files. Dump itself is done in the main loop,
+ * so this is safe to call from a signal handler.
+ */
+void TDHCPRelay::requestDump() {
+    serviceDump = 1;
+}
+
 void TDHCPRelay::setWorkdir(std::string workdir) {
     RelCfgMgr().setWorkdir(workdir);
     RelCfgMgr().dump();
 }
 
+/**
+ * sets number of worker threads relaying client messages (0 - none)
+ */
+void TDHCPRelay::setWorkers(int workers) {
+    RelCfgMgr().setWorkers(workers);
+    RelCfgMgr().dump();
+}
+
 TDHCPRelay::~TDHCPRelay() {
 }
 
@@ -20,9 +20,11 @@ class TDHCPRelay
     TDHCPRelay(const std::string& config);
     void run();
     void stop();
+    void requestDump();
     bool isDone();
     bool checkPrivileges();
     void setWorkdir(std::string workdir);
+    void setWorkers(int workers);
     ~TDHCPRelay();
 
   private:
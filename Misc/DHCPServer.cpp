@@ -8,22 +8,48 @@
  *
  */
 
+#include <sstream>
+#ifndef WIN32
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "DHCPServer.h"
 #include "AddrClient.h"
 #include "Logger.h"
 #include "SrvIfaceMgr.h"
 #include "SrvCfgMgr.h"
 #include "SrvTransMgr.h"
+#include "SrvReplMgr.h"
+#include "SrvLeaseStore.h"
+#include "StatsMgr.h"
+#include "ScriptExecutor.h"
+#include "DHCPDefaults.h"
 
 using namespace std;
 
 volatile int serviceShutdown;
+volatile int serviceDump;
+
+static void printServerStats(std::ostream & out) {
+    SrvIfaceMgr().printStats(out);
+    SrvCfgMgr().printStats(out);
+    SrvTransMgr().printStats(out);
+    SrvReplMgr().printStats(out);
+    SrvLeaseStore().printStats(out);
+    ScriptExecutor().printStats(out);
+}
 
-TDHCPServer::TDHCPServer(const std::string& config)
+static void countLeases(SPtr<TAddrClient> client) {
+    SrvCfgMgr().setCounters(client);
+}
+
+TDHCPServer::TDHCPServer(const std::string& config, int workers)
 {
     serviceShutdown = 0;
-    srand(now());
+    serviceDump = 0;
     IsDone = false;
+    Worker = 0;
+    Workers = 1;
 
     TSrvIfaceMgr::instanceCreate(SRVIFACEMGR_FILE);
     if ( SrvIfaceMgr().isDone() ) {
@@ -40,26 +66,133 @@ TDHCPServer::TDHCPServer(const std::string& config)
         return;
     }
     SrvCfgMgr().dump();
+    SrvCfgMgr().setupScriptExecutor();
 
-    TSrvAddrMgr::instanceCreate(SRVADDRMGR_FILE, true /*always load DB*/ );
+    if (workers > 1) {
+        Workers = startWorkers(workers);
+        if (IsDone)
+            return;
+    }
+    srand(now() + Worker);
+
+    TSrvAddrMgr::instanceCreate(SRVADDRMGR_FILE, true /*always load DB*/, countLeases);
     if ( SrvAddrMgr().isDone() ) {
         Log(Crit) << "Fatal error during AddrMgr initialization." << LogEnd;
         this->IsDone = true;
         return;
     }
     SrvAddrMgr().dump();
+    SrvAddrMgr().setDumpInterval(SrvCfgMgr().getLeaseDumpInterval());
+    SrvAddrMgr().setOfferLifetime(SrvCfgMgr().getOfferLifetime());
+    SrvAddrMgr().setOfferLimit(SrvCfgMgr().getOfferLimit());
+    SrvLeaseStore().exportLeases();
+    SrvLeaseStore().adoptLeases();
+
+    if (Workers == 1 &&
+        !SrvReplMgr().start(SrvCfgMgr().getReplicationPort(), SrvCfgMgr().getReplicationPeer(),
+                            SrvCfgMgr().getReplicationPeerPort())) {
+        Log(Crit) << "Fatal error during lease replication initialization." << LogEnd;
+        this->IsDone = true;
+        return;
+    }
 
+    // kernel numbers SO_REUSEPORT sockets in bind order, workers must bind in their order
+    if (!SrvLeaseStore().waitTurn())
+        Log(Warning) << "Previous worker did not open its sockets in time, "
+                     << "clients may be spread between workers randomly." << LogEnd;
     TSrvTransMgr::instanceCreate(SRVTRANSMGR_FILE);
+    SrvLeaseStore().endTurn();
     if ( SrvTransMgr().isDone() ) {
         Log(Crit) << "Fatal error during TransMgr initialization." << LogEnd;
         this->IsDone = true;
         return;
     }
 
-    SrvCfgMgr().setCounters();
     SrvCfgMgr().dump();
     SrvIfaceMgr().dump(); // dump it once more (important, if relay interfaces were added)
     SrvTransMgr().dump();
+
+    StatsMgr().addProvider(printServerStats);
+    if (Worker) {
+        // each worker has its own socket, in its own directory
+        string sock = SRVSTATS_SOCKET;
+        StatsMgr().open(sock.substr(sock.find_last_of("/\\") + 1));
+    } else
+        StatsMgr().open(SRVSTATS_SOCKET);
+}
+
+#ifndef WIN32
+static bool fileExists(const std::string& name) {
+    struct stat st;
+    return !stat(name.c_str(), &st);
+}
+#endif
+
+/**
+ * starts worker processes. Each worker keeps its lease database in its own
+ * subdirectory of the working directory and assigns leases from its own part
+ * of each pool. Leases of all workers are recorded in shared lease store.
+ *
+ * @param workers requested number of workers
+ *
+ * @return number of workers started (1 = running as a single process)
+ */
+int TDHCPServer::startWorkers(int workers)
+{
+#ifdef WIN32
+    Log(Warning) << "Workers are not supported on this system, running as a single process." << LogEnd;
+    return 1;
+#else
+    if (workers > SERVER_MAX_WORKERS) {
+        Log(Warning) << "At most " << SERVER_MAX_WORKERS << " workers are supported." << LogEnd;
+        workers = SERVER_MAX_WORKERS;
+    }
+    if (SrvCfgMgr().getReplicationPort() || SrvCfgMgr().getReplicationPeer()) {
+        Log(Warning) << "Lease replication is not supported with workers, replication disabled." << LogEnd;
+    }
+    if (!SrvLeaseStore().create(SERVER_DEFAULT_LEASE_STORE_SIZE, workers)) {
+        Log(Error) << "Unable to start workers, running as a single process." << LogEnd;
+        return 1;
+    }
+
+    // leases of previous runs: database of single process server and databases
+    // of all workers (workers started again keep theirs, the rest is adopted)
+    if (fileExists(SRVADDRMGR_FILE) || fileExists(SRVADDRDB_FILE))
+        SrvLeaseStore().loadDb(SRVADDRMGR_FILE, SRVADDRDB_FILE, -1);
+    for (int i=0; i<SERVER_MAX_WORKERS; i++) {
+        ostringstream prev;
+        prev << "worker-" << i << "/";
+        if (fileExists(prev.str() + SRVADDRMGR_FILE) || fileExists(prev.str() + SRVADDRDB_FILE))
+            SrvLeaseStore().loadDb(prev.str() + SRVADDRMGR_FILE, prev.str() + SRVADDRDB_FILE,
+                                   i < workers ? i : -1);
+    }
+
+    int index = worker_spawn(workers);
+    if (index < 0) {
+        Log(Error) << "Unable to start workers, running as a single process." << LogEnd;
+        return 1;
+    }
+
+    ostringstream dir;
+    dir << "worker-" << index;
+    if (index) {
+        ostringstream name;
+        name << "Server-" << index;
+        logger::setLogName(name.str());
+    }
+    mkdir(dir.str().c_str(), 0755);
+    if (chdir(dir.str().c_str())) {
+        Log(Crit) << "Unable to change directory to " << dir.str() << "." << LogEnd;
+        IsDone = true;
+    }
+    Log(Notice) << "Worker " << index << " of " << workers << " started." << LogEnd;
+
+    Worker = index;
+    SrvLeaseStore().setWorker(index);
+    SrvCfgMgr().setWorker(index, workers);
+    SrvIfaceMgr().setWorker(index, workers);
+    return workers;
+#endif
 }
 
 void TDHCPServer::run()
@@ -68,9 +201,36 @@ void TDHCPServer::run()
     while ( (!isDone()) && (!SrvTransMgr().isDone()) ) {
     	if (serviceShutdown)
 	    SrvTransMgr().shutdown();
+
+	if (serviceDump) {
+	    serviceDump = 0;
+	    Log(Notice) << "Dump requested, writing state files." << LogEnd;
+	    SrvIfaceMgr().dump();
+	    SrvCfgMgr().dump();
+	    SrvAddrMgr().dump();
+	    SrvAddrMgr().cacheDump();
+	    SrvTransMgr().dump();
+	}
 	
+	if (Workers > 1 && !Worker && !serviceShutdown) {
+	    int dead = worker_check();
+	    if (dead) {
+		Log(Crit) << "Worker " << dead << " died, shutting down." << LogEnd;
+		stop();
+	    }
+	}
+
 	SrvTransMgr().doDuties();
+	ScriptExecutor().doDuties();
+	SrvReplMgr().doDuties();
+	SrvIfaceMgr().doDuties();
 	unsigned int timeout = SrvTransMgr().getTimeout();
+	if (timeout > ScriptExecutor().getTimeout())
+	    timeout = ScriptExecutor().getTimeout();
+	if (timeout > SrvReplMgr().getTimeout())
+	    timeout = SrvReplMgr().getTimeout();
+	if (timeout > SrvIfaceMgr().getTimeout())
+	    timeout = SrvIfaceMgr().getTimeout();
 	if (timeout == 0)        timeout = 1;
 	if (serviceShutdown)     timeout = 0;
 	
@@ -89,6 +249,8 @@ void TDHCPServer::run()
 	if (!msg) 
 	    continue;
 	silent = false;
+	if (!SrvTransMgr().ownsMsg(msg))
+	    continue;
 	int iface = msg->getIface();
 	SPtr<TIfaceIface> ptrIface;
 	ptrIface = SrvIfaceMgr().getIfaceByID(iface);
@@ -109,6 +271,12 @@ void TDHCPServer::run()
 	} 
 	SrvTransMgr().relayMsg(msg);
     }
+    SrvIfaceMgr().flushDNSUpdates();
+    ScriptExecutor().flush(ScriptExecutor().getScriptTimeout());
+    SrvReplMgr().stop();
+    StatsMgr().close();
+    if (!Worker)
+        worker_stop();
     Log(Notice) << "Bye bye." << LogEnd;
 }
 
@@ -127,12 +295,26 @@ void TDHCPServer::stop() {
 
 }
 
+/**
+ * requests writing all state files. Dump itself is done in the main loop,
+ * so this is safe to call from a signal handler.
+ */
+void TDHCPServer::requestDump() {
+    serviceDump = 1;
+}
+
 void TDHCPServer::setWorkdir(std::string workdir) {
     SrvCfgMgr().setWorkdir(workdir);
     SrvCfgMgr().dump();
 }
 
+int TDHCPServer::getWorker() {
+    return Worker;
+}
+
 TDHCPServer::~TDHCPServer()
 {
+    if (Workers > 1 && !Worker)
+        worker_stop();
 }
 
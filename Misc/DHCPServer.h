@@ -17,16 +17,22 @@
 class TDHCPServer
 {
   public:
-    TDHCPServer(const std::string& config);
+    TDHCPServer(const std::string& config, int workers = 1);
     void run();
     void stop();
+    void requestDump();
     bool isDone();
     bool checkPrivileges();
     void setWorkdir(std::string workdir);
+    int getWorker();
     ~TDHCPServer();
 
   private:
+    int startWorkers(int workers);
+
     bool IsDone;
+    int Worker;  // index of this worker process (0 = main process)
+    int Workers; // number of worker processes (1 = no workers)
 };
 
 #endif
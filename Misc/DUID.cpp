@@ -171,6 +171,10 @@ int TDUID::getLen() {
     return this->len;
 }
 
+const char * TDUID::get() {
+    return this->DUID;
+}
+
 const string TDUID::getPlain() {
     return this->Plain;
 }
@@ -0,0 +1,124 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <string>
+#include <vector>
+
+#define HASHMAP_MIN_BUCKETS 64
+
+/**
+ * hash table with string keys (binary keys, like DUIDs or addresses, are fine)
+ *
+ * Entries are kept in chains hanging off a bucket array (as in KeyList). The
+ * array doubles when there are more entries than buckets and shrinks when
+ * less than a quarter is used, so lookups do not depend on number of entries.
+ * Pointers returned by find() stay valid until that entry is erased.
+ */
+template <class T>
+class THashMap {
+public:
+    struct Node {
+        std::string Key;
+        T Value;
+        Node * Next;
+        Node(const std::string & key) :Key(key), Value(), Next(0) { }
+    };
+
+    THashMap() :Buckets(HASHMAP_MIN_BUCKETS, (Node*)0), Count(0) { }
+    ~THashMap() { clear(); }
+
+    /// returns value stored for key or NULL
+    T * find(const std::string & key) {
+        for (Node * n = Buckets[bucket(key)]; n; n = n->Next) {
+            if (n->Key == key)
+                return &n->Value;
+        }
+        return 0;
+    }
+
+    /// returns value stored for key, default value is inserted if there is none
+    T & operator[](const std::string & key) {
+        T * value = find(key);
+        if (value)
+            return *value;
+        if (Count >= Buckets.size())
+            rehash(Buckets.size()*2);
+        Node * n = new Node(key);
+        unsigned int b = bucket(key);
+        n->Next = Buckets[b];
+        Buckets[b] = n;
+        Count++;
+        return n->Value;
+    }
+
+    /// removes entry, returns false if there was none
+    bool erase(const std::string & key) {
+        unsigned int b = bucket(key);
+        for (Node ** n = &Buckets[b]; *n; n = &(*n)->Next) {
+            if ((*n)->Key != key)
+                continue;
+            Node * tmp = *n;
+            *n = tmp->Next;
+            delete tmp;
+            Count--;
+            if (Count < Buckets.size()/4 && Buckets.size() > HASHMAP_MIN_BUCKETS)
+                rehash(Buckets.size()/2);
+            return true;
+        }
+        return false;
+    }
+
+    void clear() {
+        for (unsigned int i = 0; i < Buckets.size(); i++) {
+            while (Node * n = Buckets[i]) {
+                Buckets[i] = n->Next;
+                delete n;
+            }
+        }
+        Buckets.assign(HASHMAP_MIN_BUCKETS, (Node*)0);
+        Count = 0;
+    }
+
+    unsigned long size() const { return Count; }
+
+private:
+    THashMap(const THashMap &);
+    THashMap & operator=(const THashMap &);
+
+    /// FNV-1a, bucket count is always a power of 2
+    unsigned int bucket(const std::string & key) const {
+        unsigned int hash = 2166136261U;
+        for (std::string::size_type i = 0; i < key.length(); i++) {
+            hash ^= (unsigned char)key[i];
+            hash *= 16777619U;
+        }
+        return hash & (Buckets.size() - 1);
+    }
+
+    void rehash(unsigned int buckets) {
+        std::vector<Node*> old(buckets, (Node*)0);
+        Buckets.swap(old);
+        for (unsigned int i = 0; i < old.size(); i++) {
+            while (Node * n = old[i]) {
+                old[i] = n->Next;
+                unsigned int b = bucket(n->Key);
+                n->Next = Buckets[b];
+                Buckets[b] = n;
+            }
+        }
+    }
+
+    std::vector<Node*> Buckets;
+    unsigned long Count;
+};
+
+#endif
@@ -9,20 +9,78 @@
  * $Id: KeyList.cpp,v 1.3 2008-08-29 00:07:30 thomson Exp $
  */
 
+#include <time.h>
+#include <stdio.h>
 #include "KeyList.h"
+#include "DHCPDefaults.h"
 #include "Logger.h"
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#define KEYLIST_MIN_BUCKETS 64
+
+#ifdef WIN32
+// there are no reader-writer locks on older Windows, readers are serialized
+#define KEYLIST_LOCK_T          CRITICAL_SECTION
+#define KEYLIST_LOCK_INIT(l)    InitializeCriticalSection(l)
+#define KEYLIST_LOCK_DESTROY(l) DeleteCriticalSection(l)
+#define KEYLIST_RDLOCK(l)       EnterCriticalSection(l)
+#define KEYLIST_WRLOCK(l)       EnterCriticalSection(l)
+#define KEYLIST_UNLOCK(l)       LeaveCriticalSection(l)
+#else
+#define KEYLIST_LOCK_T          pthread_rwlock_t
+#define KEYLIST_LOCK_INIT(l)    pthread_rwlock_init(l, NULL)
+#define KEYLIST_LOCK_DESTROY(l) pthread_rwlock_destroy(l)
+#define KEYLIST_RDLOCK(l)       pthread_rwlock_rdlock(l)
+#define KEYLIST_WRLOCK(l)       pthread_rwlock_wrlock(l)
+#define KEYLIST_UNLOCK(l)       pthread_rwlock_unlock(l)
+#endif
+
+#define LOCK ((KEYLIST_LOCK_T*)Lock)
+
+KeyList::KeyList()
+    :Buckets(KEYLIST_MIN_BUCKETS, (KeyListElement*)NULL), Count(0), Lifetime(0),
+     LastPurge((unsigned long)time(NULL)) {
+    Lock = new KEYLIST_LOCK_T;
+    KEYLIST_LOCK_INIT(LOCK);
+}
 
 KeyList::~KeyList() {
-        KeyListElement * tmp1 = beginning, * tmp2;
+    for (unsigned int i = 0; i < Buckets.size(); i++) {
+        KeyListElement * tmp1 = Buckets[i], * tmp2;
         while(tmp1) {
-                tmp2 = tmp1;
-                tmp1 = tmp1->next;
-                delete tmp2->AuthInfoKey;
-                delete tmp2;
+            tmp2 = tmp1;
+            tmp1 = tmp1->next;
+            destroy(tmp2);
         }
+    }
+    for (int gen = 0; gen < 2; gen++)
+        for (unsigned int i = 0; i < Retired[gen].size(); i++)
+            destroy(Retired[gen][i]);
+
+    KEYLIST_LOCK_DESTROY(LOCK);
+    delete LOCK;
+}
+
+/// SPIs are usually random, but multiplicative hashing spreads sequential ones, too
+unsigned int KeyList::bucket(uint32_t SPI) {
+    return (unsigned int)((SPI * 2654435761UL) & 0xffffffffUL) % Buckets.size();
+}
+
+/// returns entry for SPI (if it is not expired), caller must hold the lock
+KeyListElement * KeyList::find(uint32_t SPI, unsigned long now) {
+    KeyListElement * tmp = Buckets[bucket(SPI)];
+    while (tmp) {
+        if (tmp->SPI == SPI)
+            return (!tmp->Expire || now < tmp->Expire) ? tmp : NULL;
+        tmp = tmp->next;
+    }
+    return NULL;
 }
 
-#include <stdio.h>
 void KeyList::Add(uint32_t SPI, uint32_t AAASPI, char * AuthInfoKey) {
     char buf[100];
     sprintf(buf, "Auth: Key (SPI: 0x%8.8x, AAASPI: 0x%8.8x, pointer: %p) added to keylist.", SPI, AAASPI, AuthInfoKey);
@@ -33,59 +91,229 @@ void KeyList::Add(uint32_t SPI, uint32_t AAASPI, char * AuthInfoKey) {
         return;
     }
 
-    KeyListElement * act = beginning;
-    KeyListElement * act2 = NULL;
+    purge();
+
+    unsigned long now = (unsigned long)time(NULL);
+    KEYLIST_WRLOCK(LOCK);
+
+    KeyListElement * act = Buckets[bucket(SPI)];
     while (act) {
-        if (act->SPI == SPI) {
-            Log(Debug) << "Auth: Strange, SPI already exists in KeyList" << LogEnd;
-            return;
-        }
-        act2 = act;
+        if (act->SPI == SPI)
+            break;
         act = act->next;
     }
+    if (act && (!act->Expire || now < act->Expire)) {
+        KEYLIST_UNLOCK(LOCK);
+        Log(Debug) << "Auth: Strange, SPI already exists in KeyList" << LogEnd;
+        return;
+    }
+    if (act) {
+        // expired key with the same SPI, replace it with a new entry
+        unlink(SPI);
+    }
+
+    if (Count >= Buckets.size())
+        rehash(Buckets.size()*2);
 
     KeyListElement * new_el = new KeyListElement;
     new_el->SPI = SPI;
     new_el->AAASPI = AAASPI;
-    new_el->AuthInfoKey = new char[AUTHKEYLEN];
     memcpy(new_el->AuthInfoKey, AuthInfoKey, AUTHKEYLEN);
-    new_el->next = NULL;
-    if (act2)
-        act2->next = new_el;
-    else
-        beginning = new_el;
+    new_el->Expire = Lifetime ? now + Lifetime : 0;
+    new_el->ReplayRcvd = 0;
+    new_el->Hmac = NULL;
+
+    unsigned int b = bucket(SPI);
+    new_el->next = Buckets[b];
+    Buckets[b] = new_el;
+    Count++;
+
+    KEYLIST_UNLOCK(LOCK);
 }
 
 char * KeyList::Get(uint32_t SPI) {
-    // char buf[100];
-    //sprintf(buf, "KeyList get: 0x%8.8x", SPI);
-    //Log(Debug) << buf << LogEnd;
+    KEYLIST_RDLOCK(LOCK);
+    KeyListElement * tmp = find(SPI, (unsigned long)time(NULL));
+    KEYLIST_UNLOCK(LOCK);
+
+    // missing key is not always an error (e.g. when looking for unused SPI),
+    // so it is up to caller to complain
+    return tmp ? tmp->AuthInfoKey : NULL;
+}
+
+/**
+ * checks replay detection value received from a client and remembers it
+ *
+ * @param SPI SPI of the key used by the client
+ * @param replayDetection received replay detection value
+ *
+ * @return KEY_REPLAY_OK if value is newer than any received before
+ */
+EKeyReplay KeyList::checkReplay(uint32_t SPI, uint64_t replayDetection) {
+    EKeyReplay result = KEY_REPLAY_UNKNOWN;
+
+    KEYLIST_WRLOCK(LOCK);
+    KeyListElement * tmp = find(SPI, (unsigned long)time(NULL));
+    if (tmp) {
+        if ( (!tmp->ReplayRcvd && !replayDetection) || tmp->ReplayRcvd < replayDetection) {
+            tmp->ReplayRcvd = replayDetection;
+            result = KEY_REPLAY_OK;
+        } else {
+            result = KEY_REPLAY_DETECTED;
+        }
+    }
+    KEYLIST_UNLOCK(LOCK);
+
+    return result;
+}
+
+/**
+ * returns HMAC key prepared for SPI, so the padded key blocks are hashed only once
+ *
+ * @param SPI SPI of the key
+ * @param AuthInfoKey key that is going to be used (must match the stored one)
+ * @param type hmac type (see hmac_key_init())
+ * @param hk prepared key is copied here
+ *
+ * @return true if prepared key was copied, false if it has to be computed by caller
+ */
+bool KeyList::getHmac(uint32_t SPI, const char * AuthInfoKey, int type, struct hmac_key * hk) {
+    if (!AuthInfoKey)
+        return false;
+
+    KEYLIST_RDLOCK(LOCK);
+    KeyListElement * tmp = find(SPI, (unsigned long)time(NULL));
+    if (!tmp || memcmp(tmp->AuthInfoKey, AuthInfoKey, AUTHKEYLEN)) {
+        KEYLIST_UNLOCK(LOCK);
+        return false;
+    }
+    if (tmp->Hmac && tmp->Hmac->type == type) {
+        memcpy(hk, tmp->Hmac, sizeof(*hk));
+        KEYLIST_UNLOCK(LOCK);
+        return true;
+    }
+    KEYLIST_UNLOCK(LOCK);
+
+    if (hmac_key_init(hk, AuthInfoKey, AUTHKEYLEN, type))
+        return false;
+
+    // remember it (entry could have been removed in the meantime, so look again)
+    KEYLIST_WRLOCK(LOCK);
+    tmp = find(SPI, (unsigned long)time(NULL));
+    if (tmp && !memcmp(tmp->AuthInfoKey, AuthInfoKey, AUTHKEYLEN)) {
+        if (!tmp->Hmac)
+            tmp->Hmac = new struct hmac_key;
+        memcpy(tmp->Hmac, hk, sizeof(*hk));
+    }
+    KEYLIST_UNLOCK(LOCK);
+
+    return true;
+}
 
-    KeyListElement * tmp = beginning;
+/// removes entry from its chain and retires it, caller must hold the lock
+void KeyList::unlink(uint32_t SPI) {
+    unsigned int b = bucket(SPI);
+    KeyListElement * tmp = Buckets[b], * prev = NULL;
     while (tmp) {
-        if (tmp->SPI == SPI)
-            return tmp->AuthInfoKey;
+        if (tmp->SPI == SPI) {
+            if (prev)
+                prev->next = tmp->next;
+            else
+                Buckets[b] = tmp->next;
+            Retired[0].push_back(tmp);
+            Count--;
+            return;
+        }
+        prev = tmp;
         tmp = tmp->next;
     }
-
-    Log(Warning) << "Auth: Required key (SPI=" << SPI << ") not found." << LogEnd;
-    return NULL;
 }
 
 void KeyList::Del(uint32_t SPI) {
-        KeyListElement * tmp = beginning, * prev = NULL;
+    KEYLIST_WRLOCK(LOCK);
+    unlink(SPI);
+    KEYLIST_UNLOCK(LOCK);
+}
+
+void KeyList::destroy(KeyListElement * el) {
+    delete el->Hmac;
+    delete el;
+}
+
+/// keys expire after specified number of seconds (0 or DHCPV6_INFINITY means never)
+void KeyList::setLifetime(unsigned long lifetime) {
+    if (lifetime == DHCPV6_INFINITY)
+        lifetime = 0;
+    Lifetime = lifetime;
+}
+
+/**
+ * removes expired keys and frees entries removed before previous purge
+ *
+ * It is called from Add(), so there is no need to call it periodically.
+ */
+void KeyList::purge() {
+    unsigned long now = (unsigned long)time(NULL);
+    if (now - LastPurge < AUTH_DEFAULT_KEY_PURGE)
+        return;
+
+    KEYLIST_WRLOCK(LOCK);
+    if (now - LastPurge < AUTH_DEFAULT_KEY_PURGE) {
+        // other thread was faster
+        KEYLIST_UNLOCK(LOCK);
+        return;
+    }
+    LastPurge = now;
+
+    // entries retired one interval ago can't be used by anyone anymore
+    for (unsigned int i = 0; i < Retired[1].size(); i++)
+        destroy(Retired[1][i]);
+    Retired[1].clear();
+    Retired[1].swap(Retired[0]);
+
+    for (unsigned int i = 0; i < Buckets.size(); i++) {
+        KeyListElement * tmp = Buckets[i], * prev = NULL;
         while (tmp) {
-                if (tmp->SPI == SPI) {
-                        if (prev)
-                                prev->next = tmp->next;
-                        else
-                                beginning = tmp->next;
-
-                        delete tmp->AuthInfoKey;
-                        delete tmp;
-                        return;
-                }
+            KeyListElement * next = tmp->next;
+            if (tmp->Expire && now >= tmp->Expire) {
+                if (prev)
+                    prev->next = next;
+                else
+                    Buckets[i] = next;
+                Retired[0].push_back(tmp);
+                Count--;
+            } else {
                 prev = tmp;
-                tmp = tmp->next;
+            }
+            tmp = next;
         }
+    }
+
+    if (Count < Buckets.size()/4 && Buckets.size() > KEYLIST_MIN_BUCKETS)
+        rehash(Buckets.size()/2);
+
+    KEYLIST_UNLOCK(LOCK);
+}
+
+/// moves all entries to a new bucket table, caller must hold write lock
+void KeyList::rehash(unsigned int buckets) {
+    std::vector<KeyListElement*> old(buckets, (KeyListElement*)NULL);
+    Buckets.swap(old);
+    for (unsigned int i = 0; i < old.size(); i++) {
+        KeyListElement * tmp = old[i];
+        while (tmp) {
+            KeyListElement * next = tmp->next;
+            unsigned int b = bucket(tmp->SPI);
+            tmp->next = Buckets[b];
+            Buckets[b] = tmp;
+            tmp = next;
+        }
+    }
+}
+
+unsigned long KeyList::count() {
+    KEYLIST_RDLOCK(LOCK);
+    unsigned long cnt = Count;
+    KEYLIST_UNLOCK(LOCK);
+    return cnt;
 }
@@ -16,8 +16,10 @@
  */
 
 #include "DHCPConst.h"
+#include "hmac.h"
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 
 #ifndef  KEYLIST_FILE_HEADER_INC
 #define  KEYLIST_FILE_HEADER_INC
@@ -27,20 +29,58 @@ struct KeyListElement {
         uint32_t SPI;
 
         uint32_t AAASPI;
-        char * AuthInfoKey;
+        char AuthInfoKey[AUTHKEYLEN];
+
+        unsigned long Expire;     // 0 = never
+        uint64_t ReplayRcvd;      // last replay detection value received
+        struct hmac_key * Hmac;   // prepared HMAC key (created on first use)
 
         KeyListElement * next;
 };
 
+typedef enum {
+    KEY_REPLAY_OK,        // value is newer than the last one, recorded
+    KEY_REPLAY_DETECTED,  // value was already seen
+    KEY_REPLAY_UNKNOWN    // there is no key for this SPI
+} EKeyReplay;
+
+/**
+ * authentication keys, indexed by SPI
+ *
+ * Keys are kept in a hash table (chains of elements), so lookups do not
+ * depend on number of authenticated clients. Each entry carries its AAA-SPI,
+ * last received replay detection value, expiry time and prepared HMAC key.
+ *
+ * Get() and checkReplay() may be called concurrently from several threads.
+ * Removed and expired entries are not freed immediately, but one purge
+ * interval later, so a key returned by Get() stays valid while message
+ * is processed.
+ */
 class KeyList {
         public:
-                KeyList(): beginning(NULL) {}
+                KeyList();
                 ~KeyList();
                 void Add(uint32_t SPI, uint32_t AAASPI, char * AuthInfoKey);
                 void Del(uint32_t SPI);
                 char * Get(uint32_t SPI);
+                EKeyReplay checkReplay(uint32_t SPI, uint64_t replayDetection);
+                bool getHmac(uint32_t SPI, const char * AuthInfoKey, int type, struct hmac_key * hk);
+                void setLifetime(unsigned long lifetime);
+                void purge();
+                unsigned long count();
         protected:
-                KeyListElement * beginning;
+                KeyListElement * find(uint32_t SPI, unsigned long now);
+                void unlink(uint32_t SPI);
+                void rehash(unsigned int buckets);
+                static void destroy(KeyListElement * el);
+                unsigned int bucket(uint32_t SPI);
+
+                std::vector<KeyListElement*> Buckets;
+                std::vector<KeyListElement*> Retired[2]; // freed after two purges
+                unsigned long Count;
+                unsigned long Lifetime;    // 0 = keys never expire
+                unsigned long LastPurge;
+                void * Lock;
 };
 
 #endif   /* ----- #ifndef KEYLIST_FILE_HEADER_INC  ----- */
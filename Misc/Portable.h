@@ -115,6 +115,21 @@ struct link_state_notify_t
     int cnt;  /* number of iterface indexes filled */
 };
 
+#define MAX_IFACE_EVENTS_AT_ONCE 64
+
+#define IFACE_EVENT_LINK     1 /* link appeared or its flags have changed */
+#define IFACE_EVENT_LINK_DEL 2 /* link has been removed */
+#define IFACE_EVENT_ADDR_ADD 3 /* IPv6 address added (or its flags have changed) */
+#define IFACE_EVENT_ADDR_DEL 4 /* IPv6 address removed */
+
+/* Structure used for reporting asynchronous interface changes */
+struct iface_event {
+    int  type;                     /* one of IFACE_EVENT_xxx */
+    int  id;                       /* interface ID (often called ifindex) */
+    unsigned int flags;            /* interface flags (link events only) */
+    char addr[16];                 /* IPv6 address (address events only) */
+};
+
 /**********************************************************************/
 /*** file setup/default paths *****************************************/
 /**********************************************************************/
@@ -123,12 +138,14 @@ struct link_state_notify_t
 #define CLNTIFACEMGR_FILE "client-IfaceMgr.xml"
 #define CLNTDUID_FILE	  "client-duid"
 #define CLNTADDRMGR_FILE  "client-AddrMgr.xml"
+#define CLNTADDRDB_FILE   "client-AddrMgr.db"
 #define CLNTTRANSMGR_FILE "client-TransMgr.xml"
 
 #define SRVCFGMGR_FILE    "server-CfgMgr.xml"
 #define SRVIFACEMGR_FILE  "server-IfaceMgr.xml"
 #define SRVDUID_FILE	  "server-duid"
 #define SRVADDRMGR_FILE   "server-AddrMgr.xml"
+#define SRVADDRDB_FILE    "server-AddrMgr.db"
 #define SRVTRANSMGR_FILE  "server-TransMgr.xml"
 #define SRVCACHE_FILE     "server-cache.xml"
 
@@ -153,6 +170,9 @@ struct link_state_notify_t
 #define CLNTLOG_FILE       "dibbler-client.log"
 #define SRVLOG_FILE        "dibbler-server.log"
 #define RELLOG_FILE        "dibbler-relay.log"
+#define CLNTSTATS_SOCKET   ""
+#define SRVSTATS_SOCKET    ""
+#define RELSTATS_SOCKET    ""
 #define NULLFILE           "nul"
 #endif
 
@@ -170,6 +190,9 @@ struct link_state_notify_t
 #define CLNTPID_FILE       "/var/lib/dibbler/client.pid"
 #define SRVPID_FILE        "/var/lib/dibbler/server.pid"
 #define RELPID_FILE        "/var/lib/dibbler/relay.pid"
+#define CLNTSTATS_SOCKET   "/var/lib/dibbler/client-stats.sock"
+#define SRVSTATS_SOCKET    "/var/lib/dibbler/server-stats.sock"
+#define RELSTATS_SOCKET    "/var/lib/dibbler/relay-stats.sock"
 #define CLNTLOG_FILE       "/var/log/dibbler/dibbler-client.log"
 #define SRVLOG_FILE        "/var/log/dibbler/dibbler-server.log"
 #define RELLOG_FILE        "/var/log/dibbler/dibbler-relay.log"
@@ -188,6 +211,9 @@ struct link_state_notify_t
 #define CLNTPID_FILE       "/var/lib/dibbler/client.pid"
 #define SRVPID_FILE        "/var/lib/dibbler/server.pid"
 #define RELPID_FILE        "/var/lib/dibbler/relay.pid"
+#define CLNTSTATS_SOCKET   "/var/lib/dibbler/client-stats.sock"
+#define SRVSTATS_SOCKET    "/var/lib/dibbler/server-stats.sock"
+#define RELSTATS_SOCKET    "/var/lib/dibbler/relay-stats.sock"
 #define CLNTLOG_FILE       "/var/log/dibbler/dibbler-client.log"
 #define SRVLOG_FILE        "/var/log/dibbler/dibbler-server.log"
 #define RELLOG_FILE        "/var/log/dibbler/dibbler-relay.log"
@@ -256,6 +282,14 @@ struct link_state_notify_t
 #define LOWLEVEL_ERROR_SOCKET           -11
 #define LOWLEVEL_ERROR_NOT_IMPLEMENTED  -12
 
+/* sock_send_multi() limits */
+#define LOWLEVEL_MAX_IOV   8  /* fragments of one datagram */
+#define LOWLEVEL_MAX_DESTS 16 /* destinations sent in one batch */
+
+/* sock_add() reuse modes */
+#define LOWLEVEL_REUSE_ADDR 1 /* SO_REUSEADDR */
+#define LOWLEVEL_REUSE_PORT 2 /* SO_REUSEADDR and SO_REUSEPORT (server workers) */
+
 #define LOWLEVEL_TENTATIVE_YES 1
 #define LOWLEVEL_TENTATIVE_NO  0
 #define LOWLEVEL_TENTATIVE_DONT_KNOW -1
@@ -299,6 +333,8 @@ unsigned long pref, unsigned long valid, int prefixLength);
     extern int sock_add(char* ifacename,int ifaceid, char* addr, int port, int thisifaceonly, int reuse);
     extern int sock_del(int fd);
     extern int sock_send(int fd, char* addr, char* buf, int buflen, int port, int iface);
+    extern int sock_send_multi(int fd, char** addrs, int addrCnt, char** bufs, int* lens, int bufCnt,
+                               int port, int iface);
     extern int sock_recv(int fd, char* myPlainAddr, char* peerPlainAddr, char* buf, int buflen);
     
     /* pack/unpack address */
@@ -313,7 +349,13 @@ unsigned long pref, unsigned long valid, int prefixLength);
     extern int is_addr_tentative(char* ifacename, int iface, char* plainAddr);
     extern void link_state_change_init(volatile struct link_state_notify_t * changed_links, volatile int * notify);
     extern void link_state_change_cleanup();
+
+    /* asynchronous link/address change notifications */
+    extern int iface_events_open();
+    extern int iface_events_get(int fd, struct iface_event * events, int max);
+    extern void iface_events_close(int fd);
     extern void microsleep(int microsecs);
+    unsigned long long now_ms(void); /* current time in milliseconds */
     uint64_t htonll(uint64_t n);
     uint64_t ntohll(uint64_t n);
     extern char * error_message();
@@ -352,6 +394,42 @@ unsigned long pref, unsigned long valid, int prefixLength);
     uint32_t getAAASPIfromFile();
 
     int execute(const char *filename, const char * argv[], const char *env[]);
+    int execute_async(const char *filename, const char * argv[], const char *env[]);
+    int execute_check(int pid, int * exitCode);
+    void execute_kill(int pid);
+
+    /* in-process notify hooks (shared libraries) */
+    void * plugin_open(const char * path);
+    void * plugin_symbol(void * handle, const char * name);
+    void plugin_close(void * handle);
+
+    /* read-only file mapping (binary lease database) */
+    char * file_map(const char * path, unsigned int * len);
+    void file_unmap(char * buf, unsigned int len);
+    int file_write(const char * path, const char * buf, unsigned int len); /* synced to disk */
+    int get_cpu_count(void);
+
+    /* local control socket (statistics) */
+    int ctrl_sock_open(const char * path);
+    int ctrl_sock_serve(int fd, const char * buf, int len);
+    void ctrl_sock_close(int fd, const char * path);
+
+    /* server workers (processes sharing sockets and lease store) */
+    void * shared_alloc(unsigned long len);
+    int worker_spawn(int count);
+    int worker_check(void);
+    void worker_stop(void);
+    int sock_steer(int fd, int count);
+    unsigned int steer_key(const char * buf, int len);
+
+    /* non-blocking TCP streams (lease replication) */
+    int tcp_listen6(const char * addr, unsigned short port);
+    int tcp_accept(int fd, char * peerPlainAddr);
+    int tcp_connect6(const char * addr, unsigned short port);
+    int tcp_connected(int fd);
+    int tcp_send(int fd, const char * buf, int len);
+    int tcp_recv(int fd, char * buf, int len);
+    void tcp_close(int fd);
     
 #ifdef __cplusplus
 }
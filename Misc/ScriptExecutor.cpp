@@ -0,0 +1,294 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <sstream>
+#include "ScriptExecutor.h"
+#include "StatsMgr.h"
+#include "DHCPDefaults.h"
+#include "DHCPConst.h"
+#include "Portable.h"
+#include "Logger.h"
+
+using namespace std;
+
+TScriptExecutor * TScriptExecutor::Instance = 0;
+
+TScriptExecutor::TScriptExecutor()
+    :Queued(0), Anonymous(0), Concurrency(SCRIPT_DEFAULT_CONCURRENCY),
+     QueueSize(SCRIPT_DEFAULT_QUEUE_SIZE), Timeout(SCRIPT_DEFAULT_TIMEOUT), Batch(SCRIPT_DEFAULT_BATCH),
+     Started(0), Failed(0), Dropped(0), TimedOut(0), PluginCalls(0) {
+}
+
+TScriptExecutor & TScriptExecutor::instance() {
+    if (!Instance)
+        Instance = new TScriptExecutor();
+    return *Instance;
+}
+
+/// @brief queues notify event (or calls plugin right away)
+///
+/// @param script script (or plugin) name
+/// @param action first script argument (add, update, delete, expire)
+/// @param params script variables (copied, may be destroyed after return)
+void TScriptExecutor::run(const std::string & script, const std::string & action,
+                          TNotifyScriptParams & params) {
+    TScriptPluginHook hook = getPlugin(script);
+    if (hook) {
+        PluginCalls++;
+        int returnCode = hook(action.c_str(), &params);
+        if (returnCode)
+            Log(Warning) << "Notify plugin " << script << " returned " << returnCode << "." << LogEnd;
+        return;
+    }
+    if (isPlugin(script))
+        return; // plugin failed to load, already reported
+
+    if (Queued >= QueueSize) {
+        Dropped++;
+        Log(Warning) << "Too many (" << Queued << ") notify script events queued, "
+                     << action << " event dropped." << LogEnd;
+        return;
+    }
+
+    TScriptEvent event;
+    event.Script = script;
+    event.Action = action;
+    for (int i = 0; i < params.envCnt; i++)
+        event.Env.push_back(params.env[i]);
+
+    string key = getKey(event);
+    TScriptKeyQueue & queue = Queues[key];
+    if (queue.Events.empty() && !queue.Busy)
+        Ready.push_back(key);
+    queue.Events.push_back(event);
+    Queued++;
+
+    doDuties();
+}
+
+/// returns key events are serialized on: client-id (and script name)
+std::string TScriptExecutor::getKey(const TScriptEvent & event) {
+    static const string clientID("SRV_OPTION1=");
+    for (unsigned int i = 0; i < event.Env.size(); i++) {
+        if (event.Env[i].compare(0, clientID.length(), clientID) == 0)
+            return event.Script + " " + event.Env[i].substr(clientID.length());
+    }
+    // nothing to keep in order with
+    stringstream tmp;
+    tmp << event.Script << " #" << ++Anonymous;
+    return tmp.str();
+}
+
+/// clients' events may be started again, after their script has finished
+void TScriptExecutor::release(const std::vector<std::string> & keys) {
+    for (unsigned int i = 0; i < keys.size(); i++) {
+        map<string, TScriptKeyQueue>::iterator it = Queues.find(keys[i]);
+        if (it == Queues.end())
+            continue;
+        it->second.Busy = false;
+        if (it->second.Events.empty())
+            Queues.erase(it);
+        else
+            Ready.push_back(keys[i]);
+    }
+}
+
+/// collects finished scripts, kills timed out ones and starts queued events
+void TScriptExecutor::doDuties() {
+    unsigned long current = now();
+
+    for (unsigned int i = 0; i < Running.size(); ) {
+        TScriptRunning & s = Running[i];
+        int returnCode = 0;
+        int result = execute_check(s.Pid, &returnCode);
+        if (!result) {
+            if (!s.Killed && current - s.Started >= Timeout) {
+                Log(Warning) << "Script " << s.Script << " (pid " << s.Pid << ") is running for "
+                             << current - s.Started << " seconds, killing it." << LogEnd;
+                execute_kill(s.Pid);
+                s.Killed = true;
+                TimedOut++;
+            }
+            i++;
+            continue;
+        }
+        if (result < 0 || returnCode < 0) {
+            if (!s.Killed) // already counted as timed out
+                Failed++;
+            Log(Warning) << "Script " << s.Script << " (pid " << s.Pid << ", " << s.Keys.size()
+                         << " event(s)) failed, return code=" << returnCode << LogEnd;
+        } else {
+            Log(Debug) << "Script " << s.Script << " (pid " << s.Pid << ", " << s.Keys.size()
+                       << " event(s)) complete, return code=" << returnCode << LogEnd;
+        }
+        release(s.Keys);
+        Running.erase(Running.begin() + i);
+    }
+
+    while (!Ready.empty() && (int)Running.size() < Concurrency) {
+        // clients with queued events for the same script, first event of each
+        string script = Queues[Ready.front()].Events.front().Script;
+        vector<string> keys;
+        for (unsigned int i = 0; i < Ready.size() && (int)keys.size() < Batch; ) {
+            if (Queues[Ready[i]].Events.front().Script != script) {
+                i++;
+                continue;
+            }
+            keys.push_back(Ready[i]);
+            Ready.erase(Ready.begin() + i);
+        }
+
+        vector<TScriptEvent> events;
+        for (unsigned int i = 0; i < keys.size(); i++) {
+            TScriptKeyQueue & queue = Queues[keys[i]];
+            events.push_back(queue.Events.front());
+            queue.Events.pop_front();
+            queue.Busy = true;
+            Queued--;
+        }
+
+        if (events.size() == 1) {
+            start(script, events[0].Action, events[0].Env, keys);
+            continue;
+        }
+
+        vector<string> env;
+        stringstream tmp;
+        tmp << "EVENTS=" << events.size();
+        env.push_back(tmp.str());
+        for (unsigned int i = 0; i < events.size(); i++) {
+            TScriptEvent & event = events[i];
+            tmp.str("");
+            tmp << "EVENT" << i + 1 << "_";
+            string prefix = tmp.str();
+            env.push_back(prefix + "ACTION=" + event.Action);
+            for (unsigned int j = 0; j < event.Env.size(); j++) {
+                if (event.Env[j].compare(0, 5, "PATH=") == 0) {
+                    if (!i)
+                        env.push_back(event.Env[j]);
+                    continue;
+                }
+                env.push_back(prefix + event.Env[j]);
+            }
+        }
+        start(script, "batch", env, keys);
+    }
+}
+
+/// starts script in the background (or waits for it, if that is not supported)
+bool TScriptExecutor::start(const std::string & script, const std::string & action,
+                            std::vector<std::string> & env, std::vector<std::string> & keys) {
+    const char * argv[3];
+    vector<const char *> envp;
+
+    // parameters: [0] - script name, [1] - action (add, update, delete, expire, batch)
+    argv[0] = script.c_str();
+    argv[1] = action.c_str();
+    argv[2] = NULL;
+    for (unsigned int i = 0; i < env.size(); i++)
+        envp.push_back(env[i].c_str());
+    envp.push_back(NULL);
+
+    Log(Debug) << "About to execute " << script << " script (" << action << "), "
+               << env.size() << " variables." << LogEnd;
+    Started++;
+    int pid = execute_async(script.c_str(), argv, &envp[0]);
+    if (pid == LOWLEVEL_ERROR_NOT_IMPLEMENTED) {
+        int returnCode = execute(script.c_str(), argv, &envp[0]);
+        release(keys);
+        if (returnCode < 0) {
+            Failed++;
+            Log(Warning) << "Script execution failed, return code=" << returnCode << LogEnd;
+            return false;
+        }
+        Log(Debug) << "Script execution complete, return code=" << returnCode << LogEnd;
+        return true;
+    }
+    if (pid < 0) {
+        Failed++;
+        release(keys);
+        Log(Warning) << "Unable to execute " << script << " script." << LogEnd;
+        return false;
+    }
+
+    TScriptRunning s;
+    s.Pid     = pid;
+    s.Script  = script;
+    s.Started = now();
+    s.Keys    = keys;
+    s.Killed  = false;
+    Running.push_back(s);
+    return true;
+}
+
+/// returns plugin hook, if script is a plugin (loads it on first use)
+TScriptPluginHook TScriptExecutor::getPlugin(const std::string & script) {
+    if (!isPlugin(script))
+        return 0;
+
+    map<string, void*>::iterator it = Plugins.find(script);
+    if (it == Plugins.end()) {
+        void * handle = plugin_open(script.c_str());
+        if (handle && !plugin_symbol(handle, SCRIPT_PLUGIN_SYMBOL)) {
+            Log(Error) << "Notify plugin " << script << " does not export " << SCRIPT_PLUGIN_SYMBOL
+                       << "() function." << LogEnd;
+            plugin_close(handle);
+            handle = 0;
+        } else if (!handle) {
+            Log(Error) << "Unable to load notify plugin " << script << "." << LogEnd;
+        } else {
+            Log(Notice) << "Notify plugin " << script << " loaded." << LogEnd;
+        }
+        it = Plugins.insert(make_pair(script, handle)).first;
+    }
+    if (!it->second)
+        return 0;
+    return (TScriptPluginHook)plugin_symbol(it->second, SCRIPT_PLUGIN_SYMBOL);
+}
+
+bool TScriptExecutor::isPlugin(const std::string & script) {
+    return script.length() > 3 && script.substr(script.length() - 3) == ".so";
+}
+
+/// returns max. time main loop may sleep (scripts are checked once a second)
+unsigned long TScriptExecutor::getTimeout() {
+    if (Running.empty() && !Queued)
+        return DHCPV6_INFINITY;
+    return 1;
+}
+
+/// waits (at most timeout seconds) for queued and running scripts, used at shutdown
+void TScriptExecutor::flush(unsigned int timeout) {
+    if (Running.empty() && !Queued)
+        return;
+    Log(Info) << "Waiting for " << Running.size() << " running script(s) and "
+              << Queued << " queued event(s)." << LogEnd;
+    unsigned long start = now();
+    while ((!Running.empty() || Queued) && now() - start < timeout) {
+        doDuties();
+        microsleep(10000);
+    }
+    if (Queued)
+        Log(Warning) << Queued << " notify script event(s) were not processed." << LogEnd;
+}
+
+void TScriptExecutor::printStats(std::ostream & out) {
+    TStatsMgr::printType(out, "dibbler_scripts_total", "counter", "Notify scripts started and plugin calls.");
+    out << "dibbler_scripts_total{result=\"started\"} " << Started << endl;
+    out << "dibbler_scripts_total{result=\"failed\"} " << Failed << endl;
+    out << "dibbler_scripts_total{result=\"timeout\"} " << TimedOut << endl;
+    out << "dibbler_scripts_total{result=\"plugin\"} " << PluginCalls << endl;
+    TStatsMgr::printType(out, "dibbler_script_events_dropped_total", "counter",
+                         "Notify events dropped, because queue was full.");
+    out << "dibbler_script_events_dropped_total " << Dropped << endl;
+    TStatsMgr::printType(out, "dibbler_script_events_queued", "gauge", "Notify events waiting for script.");
+    out << "dibbler_script_events_queued " << Queued << endl;
+    TStatsMgr::printType(out, "dibbler_scripts_running", "gauge", "Notify scripts currently running.");
+    out << "dibbler_scripts_running " << Running.size() << endl;
+}
@@ -0,0 +1,120 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SCRIPTEXECUTOR_H
+#define SCRIPTEXECUTOR_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include "ScriptParams.h"
+
+#define ScriptExecutor() (TScriptExecutor::instance())
+
+/// function exported by notify plugins (script name ending with .so)
+#define SCRIPT_PLUGIN_SYMBOL "dibbler_notify"
+
+extern "C" {
+    /// @brief notify plugin entry point
+    ///
+    /// @param action add, update, delete or expire (the same as script's first argument)
+    /// @param params the same variables script gets in its environment
+    ///
+    /// @return 0 on success
+    typedef int (*TScriptPluginHook)(const char * action, TNotifyScriptParams * params);
+}
+
+/// @brief Runs notify scripts without stopping the daemon.
+///
+/// Events are queued and scripts are started in the background, at most
+/// Concurrency at once. doDuties() (called from the main loop) collects
+/// finished scripts, kills those running longer than Timeout and starts
+/// queued ones. If Batch is greater than 1, queued events for the same
+/// script are passed to one invocation with "batch" action: EVENTS
+/// variable holds number of events and variables of each event get
+/// EVENTn_ prefix (EVENTn_ACTION holds its action).
+///
+/// Events of one client (the same client-id, so the same leases) are kept
+/// in their own queue and never run concurrently: next event of a client
+/// is started only after script handling the previous one has finished,
+/// so e.g. expire can not overtake add of the same lease.
+///
+/// Script names ending with .so are loaded as plugins and their
+/// dibbler_notify() function is called directly, for every event.
+class TScriptExecutor {
+  public:
+    static TScriptExecutor & instance();
+
+    void run(const std::string & script, const std::string & action, TNotifyScriptParams & params);
+    void doDuties();
+    unsigned long getTimeout();
+    void flush(unsigned int timeout);
+    void printStats(std::ostream & out);
+
+    void setConcurrency(int concurrency) { Concurrency = concurrency; }
+    void setQueueSize(unsigned int size) { QueueSize = size; }
+    void setTimeout(unsigned int timeout) { Timeout = timeout; }
+    unsigned int getScriptTimeout() { return Timeout; }
+    void setBatch(int batch) { Batch = batch; }
+
+  private:
+    struct TScriptEvent {
+        std::string Script;
+        std::string Action;
+        std::vector<std::string> Env;
+    };
+
+    struct TScriptRunning {
+        int Pid;
+        std::string Script;
+        unsigned long Started;
+        std::vector<std::string> Keys; // clients whose events are handled
+        bool Killed;
+    };
+
+    /// events of one client, Busy is set while script handles one of them
+    struct TScriptKeyQueue {
+        std::deque<TScriptEvent> Events;
+        bool Busy;
+        TScriptKeyQueue() :Busy(false) {}
+    };
+
+    TScriptExecutor();
+    bool start(const std::string & script, const std::string & action, std::vector<std::string> & env,
+               std::vector<std::string> & keys);
+    void release(const std::vector<std::string> & keys);
+    std::string getKey(const TScriptEvent & event);
+    TScriptPluginHook getPlugin(const std::string & script);
+    static bool isPlugin(const std::string & script);
+
+    static TScriptExecutor * Instance;
+
+    std::map<std::string, TScriptKeyQueue> Queues; // client key -> its events
+    std::deque<std::string> Ready; // keys with events and no running script, in arrival order
+    unsigned int Queued;           // events in all queues
+    unsigned long Anonymous;       // used to build unique keys for events without client-id
+    std::vector<TScriptRunning> Running;
+    std::map<std::string, void*> Plugins; // script -> plugin handle (0 if loading failed)
+
+    int Concurrency;
+    unsigned int QueueSize;
+    unsigned int Timeout;
+    int Batch;
+
+    // counters
+    unsigned long Started;
+    unsigned long Failed;
+    unsigned long Dropped;
+    unsigned long TimedOut;
+    unsigned long PluginCalls;
+};
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "StateFile.h"
+#include "Portable.h"
+#include "Logger.h"
+extern "C" {
+#include "md5.h"
+}
+
+using namespace std;
+
+TStateFile::TStateFile(const std::string& filename)
+    :Filename(filename), Written(false) {
+}
+
+/// @brief stores content in the file, unless it has not changed since last write
+///
+/// @param content complete new file content
+/// @param volatileOffset start of a part ignored when looking for changes
+/// @param volatileLen length of that part
+///
+/// @return true if file was actually written
+bool TStateFile::write(const std::string& content, size_t volatileOffset, size_t volatileLen) {
+    uint32_t digest[MD5_DIGESTSIZE/4];
+    struct md5_ctx ctx;
+    md5_init_ctx(&ctx);
+    if (volatileOffset < content.length()) {
+        md5_process_bytes(content.data(), volatileOffset, &ctx);
+        if (volatileOffset + volatileLen < content.length())
+            md5_process_bytes(content.data() + volatileOffset + volatileLen,
+                              content.length() - volatileOffset - volatileLen, &ctx);
+    } else {
+        md5_process_bytes(content.data(), content.length(), &ctx);
+    }
+    md5_finish_ctx(&ctx, digest);
+    if (Written && !memcmp(digest, LastDigest, sizeof(LastDigest)))
+        return false;
+
+    string tmpName = Filename + ".tmp";
+    if (file_write(tmpName.c_str(), content.data(), content.length()) != LOWLEVEL_NO_ERROR) {
+        Log(Error) << "Failed to write " << tmpName << "." << LogEnd;
+        remove(tmpName.c_str());
+        return false;
+    }
+
+#ifdef WIN32
+    remove(Filename.c_str()); // rename() can't replace existing file on Windows
+#endif
+    if (rename(tmpName.c_str(), Filename.c_str())) {
+        Log(Error) << "Unable to rename " << tmpName << " to " << Filename << "." << LogEnd;
+        remove(tmpName.c_str());
+        return false;
+    }
+
+    memcpy(LastDigest, digest, sizeof(LastDigest));
+    Written = true;
+    return true;
+}
+
+void TStateFile::setFilename(const std::string& filename) {
+    if (Filename != filename)
+        Written = false; // new file, needs to be written on next occasion
+    Filename = filename;
+}
+
+const std::string& TStateFile::getFilename() const {
+    return Filename;
+}
@@ -0,0 +1,35 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef STATEFILE_H
+#define STATEFILE_H
+
+#include <string>
+
+/// @brief Keeps on-disk state dump (e.g. client-AddrMgr.xml) in sync with memory.
+///
+/// The file is rewritten only when its content differs from what was written
+/// last time. Only a digest of the last content is kept; a part that changes
+/// on every dump (e.g. a timestamp) can be excluded from the comparison.
+/// New content is written to a temporary file, synced to disk and then
+/// renamed, so readers (and power loss) never see a truncated file.
+class TStateFile {
+public:
+    TStateFile(const std::string& filename);
+    bool write(const std::string& content,
+               size_t volatileOffset = std::string::npos, size_t volatileLen = 0);
+    void setFilename(const std::string& filename);
+    const std::string& getFilename() const;
+private:
+    std::string Filename;
+    unsigned char LastDigest[16];
+    bool Written;
+};
+
+#endif
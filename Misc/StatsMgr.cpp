@@ -0,0 +1,142 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <sstream>
+#include <string.h>
+#include "StatsMgr.h"
+#include "Portable.h"
+#include "Logger.h"
+
+using namespace std;
+
+TStatsMgr * TStatsMgr::Instance = 0;
+
+TStatsMsgCounters::TStatsMsgCounters() {
+    memset(Rx, 0, sizeof(Rx));
+    memset(Tx, 0, sizeof(Tx));
+}
+
+TStatsHistogram::TStatsHistogram()
+    :Count(0), Sum(0) {
+    memset(Buckets, 0, sizeof(Buckets));
+}
+
+void TStatsHistogram::add(unsigned long ms) {
+    int bucket = 0;
+    while (bucket < STATS_HISTOGRAM_BUCKETS && ms > (1ul << bucket))
+        bucket++;
+    Buckets[bucket]++;
+    Count++;
+    Sum += ms;
+}
+
+/// prints histogram as cumulative Prometheus buckets (in seconds)
+void TStatsHistogram::print(std::ostream & out, const std::string & name) const {
+    unsigned long total = 0;
+    for (int i = 0; i < STATS_HISTOGRAM_BUCKETS; i++) {
+        total += Buckets[i];
+        out << name << "_bucket{le=\"" << (double)(1ul << i)/1000 << "\"} " << total << endl;
+    }
+    out << name << "_bucket{le=\"+Inf\"} " << Count << endl;
+    out << name << "_sum " << (double)Sum/1000 << endl;
+    out << name << "_count " << Count << endl;
+}
+
+TStatsMgr::TStatsMgr()
+    :DecodeErrors(0), AuthFailures(0), ReplyCacheHits(0), DnsUpdates(0),
+     DnsUpdateFailures(0), DnsUpdatesInProgress(0), FD(-1) {
+}
+
+TStatsMgr & TStatsMgr::instance() {
+    if (!Instance)
+        Instance = new TStatsMgr();
+    return *Instance;
+}
+
+/// @brief opens control socket statistics are served from
+///
+/// @param path unix socket path (empty disables control socket)
+///
+/// @return true if socket is listening
+bool TStatsMgr::open(const std::string & path) {
+    if (path.empty())
+        return false;
+    int fd = ctrl_sock_open(path.c_str());
+    if (fd < 0) {
+        Log(Warning) << "Unable to open statistics socket " << path << " (error "
+                     << fd << "), statistics will not be available." << LogEnd;
+        return false;
+    }
+    FD = fd;
+    Path = path;
+    Log(Debug) << "Statistics available on " << path << " socket." << LogEnd;
+    return true;
+}
+
+void TStatsMgr::close() {
+    if (FD < 0)
+        return;
+    ctrl_sock_close(FD, Path.c_str());
+    FD = -1;
+}
+
+int TStatsMgr::getFD() {
+    return FD;
+}
+
+/// accepts pending scrape and writes all metrics to it
+void TStatsMgr::serve() {
+    ostringstream out;
+    print(out);
+    string text = out.str();
+    ctrl_sock_serve(FD, text.c_str(), text.length());
+}
+
+void TStatsMgr::addProvider(TStatsProvider provider) {
+    Providers.push_back(provider);
+}
+
+void TStatsMgr::print(std::ostream & out) {
+    printType(out, "dibbler_decode_errors_total", "counter", "Received messages that could not be parsed.");
+    out << "dibbler_decode_errors_total " << DecodeErrors << endl;
+    printType(out, "dibbler_auth_failures_total", "counter", "Messages dropped by authentication or replay detection.");
+    out << "dibbler_auth_failures_total " << AuthFailures << endl;
+    printType(out, "dibbler_reply_cache_hits_total", "counter", "Retransmissions answered with a buffered reply.");
+    out << "dibbler_reply_cache_hits_total " << ReplyCacheHits << endl;
+    printType(out, "dibbler_dns_updates_total", "counter", "DNS updates performed.");
+    out << "dibbler_dns_updates_total " << DnsUpdates << endl;
+    printType(out, "dibbler_dns_update_failures_total", "counter", "DNS updates that failed.");
+    out << "dibbler_dns_update_failures_total " << DnsUpdateFailures << endl;
+    printType(out, "dibbler_dns_updates_in_progress", "gauge", "DNS updates currently in progress.");
+    out << "dibbler_dns_updates_in_progress " << DnsUpdatesInProgress << endl;
+    printType(out, "dibbler_dns_update_seconds", "histogram", "DNS update latency.");
+    DnsUpdateLatency.print(out, "dibbler_dns_update_seconds");
+
+    for (vector<TStatsProvider>::iterator it = Providers.begin(); it != Providers.end(); ++it)
+        (*it)(out);
+}
+
+void TStatsMgr::printType(std::ostream & out, const char * name, const char * type,
+                          const char * help) {
+    out << "# HELP " << name << " " << help << endl;
+    out << "# TYPE " << name << " " << type << endl;
+}
+
+/// prints received (or sent) message counters of one interface (only non-zero ones)
+void TStatsMgr::printMsgCounters(std::ostream & out, const std::string & iface,
+                                 const TStatsMsgCounters & counters, bool tx) {
+    const unsigned long * cnt = tx ? counters.Tx : counters.Rx;
+    for (int i = 0; i < STATS_MSG_TYPES; i++) {
+        if (!cnt[i])
+            continue;
+        out << (tx ? "dibbler_tx_messages_total" : "dibbler_rx_messages_total")
+            << "{iface=\"" << iface << "\",type=\"" << (i ? MsgTypeToString(i) : "?")
+            << "\"} " << cnt[i] << endl;
+    }
+}
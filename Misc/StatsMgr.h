@@ -0,0 +1,89 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef STATSMGR_H
+#define STATSMGR_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define StatsMgr() (TStatsMgr::instance())
+
+/// message types counted separately, all other types are counted as 0
+#define STATS_MSG_TYPES 32
+
+/// latency histogram buckets: 1ms, 2ms, 4ms ... 16s (and +Inf)
+#define STATS_HISTOGRAM_BUCKETS 15
+
+/// @brief received and sent messages, by message type (kept per interface)
+struct TStatsMsgCounters {
+    unsigned long Rx[STATS_MSG_TYPES];
+    unsigned long Tx[STATS_MSG_TYPES];
+
+    TStatsMsgCounters();
+    inline void rx(int type) { Rx[(unsigned int)type < STATS_MSG_TYPES ? type : 0]++; }
+    inline void tx(int type) { Tx[(unsigned int)type < STATS_MSG_TYPES ? type : 0]++; }
+};
+
+/// @brief latency histogram with power-of-two buckets (in ms)
+struct TStatsHistogram {
+    unsigned long Buckets[STATS_HISTOGRAM_BUCKETS + 1];
+    unsigned long Count;
+    unsigned long long Sum;
+
+    TStatsHistogram();
+    void add(unsigned long ms);
+    void print(std::ostream & out, const std::string & name) const;
+};
+
+/// @brief Counters shared by all daemons and the control socket they are read from.
+///
+/// Daemons are single-threaded, so counters are plain integers, updated
+/// without any locking. Relay worker threads keep their own counters.
+/// Everything is printed in the Prometheus text format when a connection
+/// is accepted on the control socket (e.g. "socat - UNIX:/var/lib/dibbler/server-stats.sock").
+class TStatsMgr {
+  public:
+    /// prints daemon specific metrics (interfaces, pools, ...)
+    typedef void (*TStatsProvider)(std::ostream & out);
+
+    static TStatsMgr & instance();
+
+    bool open(const std::string & path);
+    void close();
+    int getFD();
+    void serve();
+
+    void addProvider(TStatsProvider provider);
+    void print(std::ostream & out);
+
+    static void printType(std::ostream & out, const char * name, const char * type, const char * help);
+    static void printMsgCounters(std::ostream & out, const std::string & iface,
+                                 const TStatsMsgCounters & counters, bool tx);
+
+    // --- counters ---
+    unsigned long DecodeErrors;   // malformed messages
+    unsigned long AuthFailures;   // messages dropped by auth/replay detection
+    unsigned long ReplyCacheHits; // retransmissions answered with buffered reply
+    unsigned long DnsUpdates;
+    unsigned long DnsUpdateFailures;
+    unsigned long DnsUpdatesInProgress; // TCP updates waiting for the DNS server
+    TStatsHistogram DnsUpdateLatency;
+
+  private:
+    TStatsMgr();
+    static TStatsMgr * Instance;
+
+    int FD;
+    std::string Path;
+    std::vector<TStatsProvider> Providers;
+};
+
+#endif
@@ -0,0 +1,79 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include "TokenBucket.h"
+
+using namespace std;
+
+TTokenBuckets::TTokenBuckets()
+    :Rate(0), Burst(0)
+{
+}
+
+void TTokenBuckets::setLimit(unsigned int rate, unsigned int burst)
+{
+    Rate  = rate;
+    Burst = burst;
+    Buckets.clear();
+}
+
+/**
+ * @brief refills bucket and checks if a token can be taken from it
+ *
+ * @param key client, link or interface the bucket belongs to
+ * @param now current time (in ms)
+ * @param retransmission if true, bucket must be at least half full
+ *
+ * @return true if token is available (or this limit is disabled)
+ */
+bool TTokenBuckets::check(const std::string& key, unsigned long long now, bool retransmission)
+{
+    if (!Rate)
+        return true;
+
+    TBucketMap::iterator it = Buckets.find(key);
+    if (it == Buckets.end()) {
+        TBucket fresh;
+        fresh.Tokens = Burst;
+        fresh.Last   = now;
+        it = Buckets.insert(make_pair(key, fresh)).first;
+    }
+
+    TBucket & bucket = it->second;
+    if (now > bucket.Last) {
+        bucket.Tokens += (double)(now - bucket.Last) * Rate / 1000;
+        if (bucket.Tokens > Burst)
+            bucket.Tokens = Burst;
+        bucket.Last = now;
+    }
+
+    return bucket.Tokens >= (retransmission ? (double)Burst/2 : 1.0);
+}
+
+/// takes a token from bucket, that was accepted by check()
+void TTokenBuckets::take(const std::string& key)
+{
+    TBucketMap::iterator it = Buckets.find(key);
+    if (it != Buckets.end())
+        it->second.Tokens -= 1.0;
+}
+
+/// forgets buckets that are full again
+void TTokenBuckets::purge(unsigned long long now)
+{
+    TBucketMap::iterator it = Buckets.begin();
+    while (it != Buckets.end()) {
+        const TBucket & bucket = it->second;
+        double elapsed = now > bucket.Last ? (double)(now - bucket.Last) : 0;
+        if (bucket.Tokens + elapsed * Rate / 1000 >= Burst)
+            Buckets.erase(it++);
+        else
+            ++it;
+    }
+}
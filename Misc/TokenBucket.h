@@ -0,0 +1,44 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef TOKENBUCKET_H
+#define TOKENBUCKET_H
+
+#include <string>
+#include <map>
+
+/// @brief Set of token buckets (one per client, link or interface) sharing one limit.
+///
+/// Every bucket holds up to Burst tokens and is refilled with Rate tokens per
+/// second. check() only refills and looks at the bucket, take() removes a token,
+/// so the caller can check several buckets first and consume tokens only if all
+/// of them admit the message. Buckets that are full again are equal to the
+/// new ones and can be forgotten with purge(). Rate 0 disables the limit.
+class TTokenBuckets {
+public:
+    TTokenBuckets();
+    void setLimit(unsigned int rate, unsigned int burst);
+    bool enabled() const { return Rate != 0; }
+    bool check(const std::string& key, unsigned long long now, bool retransmission);
+    void take(const std::string& key);
+    void purge(unsigned long long now);
+    unsigned long size() const { return Buckets.size(); }
+private:
+    struct TBucket {
+        double Tokens;
+        unsigned long long Last; // ms timestamp of last refill
+    };
+    typedef std::map<std::string, TBucket> TBucketMap;
+
+    TBucketMap Buckets;
+    unsigned int Rate;
+    unsigned int Burst;
+};
+
+#endif
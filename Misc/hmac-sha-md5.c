@@ -15,49 +15,37 @@
 #include <string.h>
 #include <stdlib.h>
 #include "hmac.h"
-#include "md5.h"
-#include "sha1.h"
-#include "sha256.h"
-#include "sha512.h"
+#include "sha-mb.h"
 
 /* "Feeding The Void With Emptiness..." ;) */
-#define SHA_CASE(x,y)                                                                       \
-          case x:                                                                           \
-                  ctx = malloc(sizeof(struct sha##y##_ctx));                                \
-                  init_ctx      = (void(*)(void *))                &sha##x##_init_ctx;      \
-                  process_bytes = (void(*)(void *, size_t, void *))&sha##y##_process_bytes; \
-                  finish_ctx    = (void* (*)(void *, void *))      &sha##x##_finish_ctx;    \
-                  blocksize = SHA##x##_BLOCKSIZE;                                           \
-                  digestsize = SHA##x##_DIGESTSIZE;                                         \
-                  break;
+#define SHA_CASE(x,y)                                                                               \
+          case x:                                                                                   \
+                  d->init_ctx      = (void(*)(void *))                      &sha##x##_init_ctx;     \
+                  d->process_bytes = (void(*)(const void *, size_t, void *))&sha##y##_process_bytes;\
+                  d->finish_ctx    = (void* (*)(void *, void *))            &sha##x##_finish_ctx;   \
+                  d->blocksize = SHA##x##_BLOCKSIZE;                                                \
+                  d->digestsize = SHA##x##_DIGESTSIZE;                                              \
+                  return 0;
 
-/* Take buffer and key (and their lengths), generate HMAC-SHA (or HMAC-MD5)     */
-/* and write the result to RESBUF                                               */
-/* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
-static void *
-hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) {
-  /* SHA512_BLOCKSIZE and SHA512_DIGESTSIZE are the biggest, so we can use it with other algorithms */
-  char Ki[SHA512_BLOCKSIZE];
-  char Ko[SHA512_BLOCKSIZE];
-  char tmpbuf[SHA512_DIGESTSIZE];
-  int i;
-  int blocksize;
-  int digestsize;
-  void *ctx;
+struct digest_ops {
   void (*init_ctx)(void *);
-  void (*process_bytes)(void *, size_t, void *);
+  void (*process_bytes)(const void *, size_t, void *);
   void *(*finish_ctx)(void *, void *);
-  void *result;
+  int blocksize;
+  int digestsize;
+};
 
+/* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
+static int
+digest_ops_get (int type, struct digest_ops *d) {
   switch (type) {
           case 5: /* Oh, it's MD5! */
-                  ctx = malloc(sizeof(struct md5_ctx));
-                  init_ctx      = (void(*)(void *))                 &md5_init_ctx;
-                  process_bytes = (void(*)(void *, size_t, void *)) &md5_process_bytes;
-                  finish_ctx    = (void* (*)(void *, void *))       &md5_finish_ctx;
-                  blocksize = MD5_BLOCKSIZE;
-                  digestsize = MD5_DIGESTSIZE;
-                  break;
+                  d->init_ctx      = (void(*)(void *))                       &md5_init_ctx;
+                  d->process_bytes = (void(*)(const void *, size_t, void *)) &md5_process_bytes;
+                  d->finish_ctx    = (void* (*)(void *, void *))             &md5_finish_ctx;
+                  d->blocksize = MD5_BLOCKSIZE;
+                  d->digestsize = MD5_DIGESTSIZE;
+                  return 0;
                /*   .--------< SHA variant   
                     |                        
                     v                   */
@@ -67,16 +55,31 @@ hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *r
           SHA_CASE(384, 512)
           SHA_CASE(512, 512)
           default:
-                  return NULL;
+                  return -1;
   }
+}
+
+/* Prepare HMAC key: hash inner and outer padded key blocks, so they don't */
+/* have to be hashed again for every message. Returns 0 on success.        */
+int
+hmac_key_init (struct hmac_key *hk, const char *key, size_t key_len, int type) {
+  /* SHA512_BLOCKSIZE and SHA512_DIGESTSIZE are the biggest, so we can use it with other algorithms */
+  char Ki[SHA512_BLOCKSIZE];
+  char Ko[SHA512_BLOCKSIZE];
+  int i;
+  struct digest_ops d;
+
+  if (digest_ops_get(type, &d))
+          return -1;
+  hk->type = type;
 
   /* if given key is longer that algorithm's block, we must change it to
      hash of the original key (of size of algorithm's digest) */
-  if (key_len > blocksize) {
-          init_ctx (&ctx);
-          process_bytes (key, key_len, &ctx);
-          finish_ctx (&ctx, Ki);
-          key_len = digestsize;
+  if (key_len > (size_t)d.blocksize) {
+          d.init_ctx (&hk->inner);
+          d.process_bytes (key, key_len, &hk->inner);
+          d.finish_ctx (&hk->inner, Ki);
+          key_len = d.digestsize;
           memcpy(Ko, Ki, key_len);
   } else {
           memcpy(Ki, key, key_len);
@@ -84,28 +87,203 @@ hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *r
   }
 
   /* prepare input and output key */
-  for (i = 0; i < key_len; i++) {
+  for (i = 0; i < (int)key_len; i++) {
           Ki[i] ^= 0x36;
           Ko[i] ^= 0x5c;
   }
-  for (; i < blocksize; i++) {
+  for (; i < d.blocksize; i++) {
           Ki[i] = 0x36;
           Ko[i] = 0x5c;
   }
 
-  init_ctx (ctx);
-  process_bytes (Ki, blocksize, ctx);
-  process_bytes ((void *)buffer, len, ctx);
-  finish_ctx (ctx, tmpbuf);
+  d.init_ctx (&hk->inner);
+  d.process_bytes (Ki, d.blocksize, &hk->inner);
+
+  d.init_ctx (&hk->outer);
+  d.process_bytes (Ko, d.blocksize, &hk->outer);
+
+  return 0;
+}
+
+/* Generate HMAC of buffer using prepared key and write the result to RESBUF */
+void *
+hmac_key_digest (const struct hmac_key *hk, const char *buffer, size_t len, char *resbuf) {
+  char tmpbuf[SHA512_DIGESTSIZE];
+  struct hmac_key ctx; /* only used as storage for a copy of inner/outer state */
+  struct digest_ops d;
+
+  if (digest_ops_get(hk->type, &d))
+          return NULL;
+
+  memcpy(&ctx.inner, &hk->inner, sizeof(ctx.inner));
+  d.process_bytes ((const void *)buffer, len, &ctx.inner);
+  d.finish_ctx (&ctx.inner, tmpbuf);
+
+  memcpy(&ctx.outer, &hk->outer, sizeof(ctx.outer));
+  d.process_bytes (tmpbuf, d.digestsize, &ctx.outer);
+
+  return d.finish_ctx (&ctx.outer, resbuf);
+}
+
+/* digest of lane is stored in big endian order */
+static void
+sha_mb_store (const uint32_t *state, int len, unsigned char *out) {
+  int i;
+  for (i = 0; i < len; i++)
+          out[i] = (unsigned char)(state[i/4] >> (24 - 8*(i%4)));
+}
 
-  init_ctx (ctx);
-  process_bytes (Ko, blocksize, ctx);
-  process_bytes (tmpbuf, digestsize, ctx);
+/* Runs multi-buffer compression over messages of different length. Lanes
+   that have no more blocks are left out, so the batch shrinks as it goes. */
+static void
+sha_mb_run (int sha1, uint32_t st[][8], const unsigned char *data[], const size_t full[],
+            unsigned char tail[][2*SHA256_BLOCKSIZE], const size_t blocks[], int n) {
+  uint32_t *state[SHA_MB_LANES];
+  const unsigned char *block[SHA_MB_LANES];
+  size_t b, maxBlocks = 0;
+  int l, m;
+
+  for (l = 0; l < n; l++) {
+          if (blocks[l] > maxBlocks)
+                  maxBlocks = blocks[l];
+  }
+
+  for (b = 0; b < maxBlocks; b++) {
+          for (l = 0, m = 0; l < n; l++) {
+                  if (b >= blocks[l])
+                          continue;
+                  state[m] = st[l];
+                  block[m] = b < full[l] ? data[l] + 64*b : tail[l] + 64*(b - full[l]);
+                  m++;
+          }
+          if (sha1)
+                  sha1_mb_process_block (state, block, m);
+          else
+                  sha256_mb_process_block (state, block, m);
+  }
+}
+
+/* pads message (which follows TOTAL bytes already hashed into the state) */
+static size_t
+sha_mb_pad (const unsigned char *data, size_t len, uint64_t total, size_t *full,
+            unsigned char *tail) {
+  size_t rem = len % 64;
+  size_t tailBlocks = rem < 56 ? 1 : 2;
+  uint64_t bits = (total + len) * 8;
+  int i;
+
+  *full = len / 64;
+  memset(tail, 0, tailBlocks*64);
+  memcpy(tail, data + *full*64, rem);
+  tail[rem] = 0x80;
+  for (i = 0; i < 8; i++)
+          tail[tailBlocks*64 - 1 - i] = (unsigned char)(bits >> (8*i));
+  return *full + tailBlocks;
+}
+
+static void
+sha_mb_state_get (int sha1, const struct hmac_key *hk, int outer, uint32_t *st, uint64_t *total) {
+  if (sha1) {
+          const struct sha1_ctx *ctx = outer ? &hk->outer.sha1 : &hk->inner.sha1;
+          st[0] = ctx->A;
+          st[1] = ctx->B;
+          st[2] = ctx->C;
+          st[3] = ctx->D;
+          st[4] = ctx->E;
+          *total = ((uint64_t)ctx->total[1] << 32) | ctx->total[0];
+  } else {
+          const struct sha256_ctx *ctx = outer ? &hk->outer.sha256 : &hk->inner.sha256;
+          memcpy(st, ctx->state, sizeof(ctx->state));
+          *total = ((uint64_t)ctx->total[1] << 32) | ctx->total[0];
+  }
+}
+
+/* HMAC-SHA1/SHA224/SHA256 of up to SHA_MB_LANES messages (all of the same family) */
+static void
+hmac_sha_mb (int sha1, const struct hmac_key *hk[], const char *buffer[], const size_t len[],
+             char *resbuf[], const int idx[], int n) {
+  uint32_t st[SHA_MB_LANES][8];
+  unsigned char tail[SHA_MB_LANES][2*SHA256_BLOCKSIZE];
+  unsigned char inner[SHA_MB_LANES][SHA256_DIGESTSIZE];
+  const unsigned char *data[SHA_MB_LANES];
+  size_t full[SHA_MB_LANES] = {0}, blocks[SHA_MB_LANES] = {0};
+  uint64_t total;
+  int l, digestLen = sha1 ? SHA1_DIGESTSIZE : SHA256_DIGESTSIZE;
+
+  /* inner hash: H(K^ipad || message) */
+  for (l = 0; l < n; l++) {
+          sha_mb_state_get(sha1, hk[idx[l]], 0, st[l], &total);
+          data[l] = (const unsigned char *)buffer[idx[l]];
+          blocks[l] = sha_mb_pad(data[l], len[idx[l]], total, &full[l], tail[l]);
+  }
+  sha_mb_run(sha1, st, data, full, tail, blocks, n);
+
+  /* outer hash: H(K^opad || inner hash), SHA-224 inner hash is truncated */
+  for (l = 0; l < n; l++) {
+          int innerLen = hk[idx[l]]->type == 224 ? SHA224_DIGESTSIZE : digestLen;
+          sha_mb_store(st[l], innerLen, inner[l]);
+          sha_mb_state_get(sha1, hk[idx[l]], 1, st[l], &total);
+          data[l] = inner[l];
+          blocks[l] = sha_mb_pad(inner[l], innerLen, total, &full[l], tail[l]);
+  }
+  sha_mb_run(sha1, st, data, full, tail, blocks, n);
+
+  for (l = 0; l < n; l++) {
+          int resLen = hk[idx[l]]->type == 224 ? SHA224_DIGESTSIZE : digestLen;
+          sha_mb_store(st[l], resLen, (unsigned char *)resbuf[idx[l]]);
+  }
+}
+
+/* Generate HMACs of N buffers (each with its own prepared key) at once.
+   SHA-1, SHA-224 and SHA-256 are computed by multi-buffer code, so a batch of
+   received messages costs about as much as one of them; the rest is done one
+   message after another. */
+void
+hmac_key_digest_mb (const struct hmac_key *hk[], const char *buffer[], const size_t len[],
+                    char *resbuf[], int n) {
+  int idx[2][SHA_MB_LANES];
+  int lanes[2] = { 0, 0 };
+  int i, f;
+
+  for (i = 0; i < n; i++) {
+          switch (hk[i]->type) {
+          case 1:
+                  f = 0;
+                  break;
+          case 224:
+          case 256:
+                  f = 1;
+                  break;
+          default:
+                  hmac_key_digest(hk[i], buffer[i], len[i], resbuf[i]);
+                  continue;
+          }
+          idx[f][lanes[f]++] = i;
+          if (lanes[f] == SHA_MB_LANES) {
+                  hmac_sha_mb(f == 0, hk, buffer, len, resbuf, idx[f], lanes[f]);
+                  lanes[f] = 0;
+          }
+  }
+
+  for (f = 0; f < 2; f++) {
+          if (lanes[f] == 1)
+                  hmac_key_digest(hk[idx[f][0]], buffer[idx[f][0]], len[idx[f][0]], resbuf[idx[f][0]]);
+          else if (lanes[f])
+                  hmac_sha_mb(f == 0, hk, buffer, len, resbuf, idx[f], lanes[f]);
+  }
+}
+
+/* Take buffer and key (and their lengths), generate HMAC-SHA (or HMAC-MD5)     */
+/* and write the result to RESBUF                                               */
+/* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
+static void *
+hmac_sha_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) {
+  struct hmac_key hk;
 
-  result = finish_ctx (ctx, resbuf);
-  free(ctx);
+  if (hmac_key_init(&hk, key, key_len, type))
+          return NULL;
 
-  return result;
+  return hmac_key_digest(&hk, buffer, len, resbuf);
 }
 
 /* HMAC-SHA function wrapper */
@@ -7,12 +7,43 @@
  * Released under GNU GPL v2 licence
  *
  * $Id: hmac.h,v 1.2 2006-11-30 03:39:29 thomson Exp $
- */	
+ */
+
+#ifndef HMAC_H
+#define HMAC_H
+
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#include "md5.h"
+#include "sha1.h"
+#include "sha256.h"
+#include "sha512.h"
+
+/* HMAC key with inner and outer padded key blocks already hashed. Computing
+   HMAC with it saves two compression rounds (and key preparation) per
+   message, so it is worth keeping for keys used more than once. */
+struct hmac_key {
+  int type;
+  union {
+    struct md5_ctx    md5;
+    struct sha1_ctx   sha1;
+    struct sha256_ctx sha256;
+    struct sha512_ctx sha512;
+  } inner, outer;
+};
+
+/* type is one of the following: 1, 224, 256, 384, 512 (for SHA) or 5 (for MD5) */
+int   hmac_key_init (struct hmac_key *hk, const char *key, size_t key_len, int type);
+void *hmac_key_digest (const struct hmac_key *hk, const char *buffer, size_t len, char *resbuf);
+
+/* computes HMACs of N messages at once (multi-buffer SHA, see sha-mb.h) */
+void  hmac_key_digest_mb (const struct hmac_key *hk[], const char *buffer[], const size_t len[],
+                          char *resbuf[], int n);
+
 void *hmac_sha (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type);
 void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf);
 
@@ -20,3 +51,4 @@ void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char
 }
 #endif
 
+#endif
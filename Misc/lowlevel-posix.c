@@ -7,12 +7,32 @@
  *
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include "Portable.h"
 #include <stdio.h>
 #include <errno.h>
 #include <unistd.h>
 #include <stdlib.h>
 #include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <signal.h>
+#include <spawn.h>
+#include <dlfcn.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/time.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <string.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
 
 int execute(const char *filename, const char * argv[], const char *env[])
 {
@@ -55,3 +75,375 @@ int execute(const char *filename, const char * argv[], const char *env[])
             return LOWLEVEL_ERROR_UNSPEC;
     }
 }
+
+/**
+ * starts script without waiting for it (posix_spawn() does not copy
+ * the whole daemon, as fork() would)
+ *
+ * @return pid of the started script or negative error code
+ */
+int execute_async(const char *filename, const char * argv[], const char *env[])
+{
+    pid_t pid;
+    if (posix_spawn(&pid, filename, NULL, NULL, (char * const *)argv, (char * const *)env))
+        return LOWLEVEL_ERROR_UNSPEC;
+    return pid;
+}
+
+/**
+ * checks if script started with execute_async() has finished (does not block)
+ *
+ * @param pid script pid
+ * @param exitCode script return code is stored here (if finished)
+ *
+ * @return 1 if finished, 0 if still running, negative error code otherwise
+ */
+int execute_check(int pid, int * exitCode)
+{
+    int status = 0;
+    int result = waitpid(pid, &status, WNOHANG);
+    if (result == 0)
+        return 0;
+    if (result < 0)
+        return LOWLEVEL_ERROR_UNSPEC;
+    *exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : LOWLEVEL_ERROR_UNSPEC;
+    return 1;
+}
+
+void execute_kill(int pid)
+{
+    kill(pid, SIGKILL);
+}
+
+void * plugin_open(const char * path)
+{
+    return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+}
+
+void * plugin_symbol(void * handle, const char * name)
+{
+    return dlsym(handle, name);
+}
+
+void plugin_close(void * handle)
+{
+    dlclose(handle);
+}
+
+/**
+ * maps whole file into memory (read-only)
+ *
+ * @param path file to be mapped
+ * @param len file length is stored here
+ *
+ * @return pointer to the file content or NULL (missing or empty file)
+ */
+char * file_map(const char * path, unsigned int * len)
+{
+    struct stat st;
+    void * buf;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+    if (fstat(fd, &st) || !st.st_size) {
+        close(fd);
+        return NULL;
+    }
+    buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (buf == MAP_FAILED)
+        return NULL;
+    *len = st.st_size;
+    return (char*)buf;
+}
+
+void file_unmap(char * buf, unsigned int len)
+{
+    munmap(buf, len);
+}
+
+/**
+ * writes whole buffer to a file (truncated first) and flushes it to disk
+ *
+ * @param path file to be written
+ * @param buf content
+ * @param len content length
+ *
+ * @return LOWLEVEL_NO_ERROR or LOWLEVEL_ERROR_FILE
+ */
+int file_write(const char * path, const char * buf, unsigned int len)
+{
+    ssize_t cnt;
+    int fd = open(path, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+    if (fd < 0)
+        return LOWLEVEL_ERROR_FILE;
+    while (len) {
+        cnt = write(fd, buf, len);
+        if (cnt < 0 && errno == EINTR)
+            continue;
+        if (cnt <= 0) {
+            close(fd);
+            return LOWLEVEL_ERROR_FILE;
+        }
+        buf += cnt;
+        len -= cnt;
+    }
+    if (fsync(fd)) {
+        close(fd);
+        return LOWLEVEL_ERROR_FILE;
+    }
+    return close(fd) ? LOWLEVEL_ERROR_FILE : LOWLEVEL_NO_ERROR;
+}
+
+/** returns current time in milliseconds (used to measure intervals) */
+unsigned long long now_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (unsigned long long)tv.tv_sec*1000 + tv.tv_usec/1000;
+}
+
+/** returns number of online CPUs (at least 1) */
+int get_cpu_count(void)
+{
+    long cnt = sysconf(_SC_NPROCESSORS_ONLN);
+    return cnt > 0 ? (int)cnt : 1;
+}
+
+/**
+ * allocates zeroed memory shared with processes forked later (never freed)
+ *
+ * @param len number of bytes
+ *
+ * @return pointer to the memory or NULL
+ */
+void * shared_alloc(unsigned long len)
+{
+    void * buf;
+#if defined(MAP_ANONYMOUS) || defined(MAP_ANON)
+#ifndef MAP_ANONYMOUS
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+    buf = mmap(NULL, len, PROT_READ|PROT_WRITE, MAP_SHARED|MAP_ANONYMOUS, -1, 0);
+#else
+    int fd = open("/dev/zero", O_RDWR);
+    if (fd < 0)
+	return NULL;
+    buf = mmap(NULL, len, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+#endif
+    return (buf == MAP_FAILED) ? NULL : buf;
+}
+
+/**
+ * opens listening unix socket (removes stale one first). The socket is
+ * created with mode 0660, so only owner and group may connect.
+ *
+ * @param path socket path
+ *
+ * @return socket descriptor or negative error code
+ */
+int ctrl_sock_open(const char * path)
+{
+    struct sockaddr_un addr;
+    mode_t mask;
+    int fd, result;
+
+    if (strlen(path) >= sizeof(addr.sun_path))
+        return LOWLEVEL_ERROR_UNSPEC;
+
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return LOWLEVEL_ERROR_SOCKET;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    /* restrictive umask closes the window between bind() and chmod() */
+    mask = umask(0117);
+    result = bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+    umask(mask);
+    if (result < 0 || chmod(path, 0660) < 0 || listen(fd, 4) < 0) {
+        close(fd);
+        return LOWLEVEL_ERROR_BIND_FAILED;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+/**
+ * accepts one connection, writes the buffer to it and closes it. Slow
+ * readers are not waited for longer than one second in total.
+ *
+ * @return number of bytes written or negative error code
+ */
+int ctrl_sock_serve(int fd, const char * buf, int len)
+{
+    struct pollfd pfd;
+    unsigned long long deadline;
+    int written = 0;
+    int conn = accept(fd, NULL, NULL);
+    if (conn < 0)
+        return LOWLEVEL_ERROR_SOCKET;
+
+#ifdef SO_NOSIGPIPE
+    {
+        int on = 1;
+        setsockopt(conn, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+    }
+#endif
+    fcntl(conn, F_SETFL, fcntl(conn, F_GETFL) | O_NONBLOCK);
+    deadline = now_ms() + 1000;
+    pfd.fd = conn;
+    pfd.events = POLLOUT;
+    while (written < len) {
+        unsigned long long now;
+        int result = send(conn, buf + written, len - written, MSG_NOSIGNAL);
+        if (result > 0) {
+            written += result;
+            continue;
+        }
+        if (result == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            break;
+        now = now_ms();
+        if (now >= deadline)
+            break;
+        if (poll(&pfd, 1, (int)(deadline - now)) < 0 && errno != EINTR)
+            break;
+    }
+    close(conn);
+    return written;
+}
+
+void ctrl_sock_close(int fd, const char * path)
+{
+    close(fd);
+    unlink(path);
+}
+
+static int tcp_sockaddr6(struct sockaddr_in6 * sa, const char * addr, unsigned short port)
+{
+    memset(sa, 0, sizeof(*sa));
+    sa->sin6_family = AF_INET6;
+    sa->sin6_port = htons(port);
+    if (addr && inet_pton(AF_INET6, addr, &sa->sin6_addr) <= 0)
+        return LOWLEVEL_ERROR_UNSPEC;
+    return LOWLEVEL_NO_ERROR;
+}
+
+static void tcp_nonblock(int fd)
+{
+    int one = 1;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+/**
+ * opens non-blocking listening TCP socket
+ *
+ * @param addr plain address to bind to (NULL means any)
+ * @param port port number
+ *
+ * @return socket descriptor or negative error code
+ */
+int tcp_listen6(const char * addr, unsigned short port)
+{
+    struct sockaddr_in6 sa;
+    int one = 1;
+    int fd;
+
+    if (tcp_sockaddr6(&sa, addr, port) < 0)
+        return LOWLEVEL_ERROR_UNSPEC;
+    fd = socket(AF_INET6, SOCK_STREAM, 0);
+    if (fd < 0)
+        return LOWLEVEL_ERROR_SOCKET;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (bind(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0 || listen(fd, 4) < 0) {
+        close(fd);
+        return LOWLEVEL_ERROR_BIND_FAILED;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    return fd;
+}
+
+/**
+ * accepts pending connection
+ *
+ * @param fd listening socket
+ * @param peerPlainAddr peer's address is stored here (at least 48 bytes, may be NULL)
+ *
+ * @return (non-blocking) descriptor of accepted connection or negative error code
+ */
+int tcp_accept(int fd, char * peerPlainAddr)
+{
+    struct sockaddr_in6 sa;
+    socklen_t len = sizeof(sa);
+    int conn = accept(fd, (struct sockaddr*)&sa, &len);
+    if (conn < 0)
+        return LOWLEVEL_ERROR_SOCKET;
+    tcp_nonblock(conn);
+    if (peerPlainAddr)
+        inet_ntop(AF_INET6, &sa.sin6_addr, peerPlainAddr, 48);
+    return conn;
+}
+
+/**
+ * starts non-blocking connect. Socket becomes writable when the connection
+ * is established (or failed), use tcp_connected() to find out which one.
+ *
+ * @return socket descriptor or negative error code
+ */
+int tcp_connect6(const char * addr, unsigned short port)
+{
+    struct sockaddr_in6 sa;
+    int fd;
+
+    if (tcp_sockaddr6(&sa, addr, port) < 0)
+        return LOWLEVEL_ERROR_UNSPEC;
+    fd = socket(AF_INET6, SOCK_STREAM, 0);
+    if (fd < 0)
+        return LOWLEVEL_ERROR_SOCKET;
+    tcp_nonblock(fd);
+    if (connect(fd, (struct sockaddr*)&sa, sizeof(sa)) < 0 && errno != EINPROGRESS) {
+        close(fd);
+        return LOWLEVEL_ERROR_SOCKET;
+    }
+    return fd;
+}
+
+/** returns 0 if connection started by tcp_connect6() is established */
+int tcp_connected(int fd)
+{
+    int err = 0;
+    socklen_t len = sizeof(err);
+    if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) < 0 || err)
+        return LOWLEVEL_ERROR_SOCKET;
+    return LOWLEVEL_NO_ERROR;
+}
+
+/** returns number of bytes sent (0 if socket buffer is full) or negative error code */
+int tcp_send(int fd, const char * buf, int len)
+{
+    int result = send(fd, buf, len, MSG_NOSIGNAL);
+    if (result < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : LOWLEVEL_ERROR_SOCKET;
+    return result;
+}
+
+/** returns number of bytes received (0 if there is nothing to read) or negative error code (also when peer closed the connection) */
+int tcp_recv(int fd, char * buf, int len)
+{
+    int result = recv(fd, buf, len, 0);
+    if (result < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) ? 0 : LOWLEVEL_ERROR_SOCKET;
+    if (result == 0)
+        return LOWLEVEL_ERROR_SOCKET;
+    return result;
+}
+
+void tcp_close(int fd)
+{
+    close(fd);
+}
@@ -0,0 +1,171 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+/* SIMD kernels of multi-buffer SHA-1 and SHA-256. This file is included by
+   sha-mb.c once for every instruction set, with following macros defined:
+   VEC       - GCC vector type of VEC_WIDTH 32-bit words
+   VEC_WIDTH - number of lanes
+   VEC_NAME  - suffix of generated function names
+   VEC_ATTR  - function attributes (target instruction set) */
+
+#define VEC_FN2(name, suffix) name##_##suffix
+#define VEC_FN1(name, suffix) VEC_FN2(name, suffix)
+#define VEC_FN(name) VEC_FN1(name, VEC_NAME)
+
+/* loads word j of lane states, lanes above n repeat lane 0 */
+#define VEC_LOAD_STATE(x, j) do {                                  \
+        for (l = 0; l < VEC_WIDTH; l++)                             \
+            u.w[l] = state[l < n ? l : 0][j];                       \
+        x = u.v;                                                    \
+    } while (0)
+
+#define VEC_STORE_STATE(x, j) do {                                 \
+        u.v = x;                                                    \
+        for (l = 0; l < n; l++)                                     \
+            state[l][j] += u.w[l];                                  \
+    } while (0)
+
+/* loads (big endian) word j of lane blocks */
+#define VEC_LOAD_BLOCK(x, j) do {                                  \
+        for (l = 0; l < VEC_WIDTH; l++) {                           \
+            const unsigned char *p = block[l < n ? l : 0] + 4*(j);  \
+            u.w[l] = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) \
+                   | ((uint32_t)p[2] << 8) | p[3];                  \
+        }                                                           \
+        x = u.v;                                                    \
+    } while (0)
+
+#define VEC_ROL(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+#define VEC_ROR(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+static void VEC_ATTR
+VEC_FN(sha1_block) (uint32_t *state[], const unsigned char *block[], int n)
+{
+  union { VEC v; uint32_t w[VEC_WIDTH]; } u;
+  VEC zero = { 0 };
+  VEC a, b, c, d, e, f, k, t, w[16];
+  int i, l;
+
+  VEC_LOAD_STATE(a, 0);
+  VEC_LOAD_STATE(b, 1);
+  VEC_LOAD_STATE(c, 2);
+  VEC_LOAD_STATE(d, 3);
+  VEC_LOAD_STATE(e, 4);
+  for (i = 0; i < 16; i++)
+    VEC_LOAD_BLOCK(w[i], i);
+
+  for (i = 0; i < 80; i++) {
+    if (i >= 16) {
+      t = w[(i-3)&15] ^ w[(i-8)&15] ^ w[(i-14)&15] ^ w[i&15];
+      w[i&15] = VEC_ROL(t, 1);
+    }
+    if (i < 20) {
+      f = d ^ (b & (c ^ d));
+      k = zero + 0x5a827999U;
+    } else if (i < 40) {
+      f = b ^ c ^ d;
+      k = zero + 0x6ed9eba1U;
+    } else if (i < 60) {
+      f = (b & c) | (d & (b | c));
+      k = zero + 0x8f1bbcdcU;
+    } else {
+      f = b ^ c ^ d;
+      k = zero + 0xca62c1d6U;
+    }
+    t = VEC_ROL(a, 5) + f + e + k + w[i&15];
+    e = d;
+    d = c;
+    c = VEC_ROL(b, 30);
+    b = a;
+    a = t;
+  }
+
+  VEC_STORE_STATE(a, 0);
+  VEC_STORE_STATE(b, 1);
+  VEC_STORE_STATE(c, 2);
+  VEC_STORE_STATE(d, 3);
+  VEC_STORE_STATE(e, 4);
+}
+
+static void VEC_ATTR
+VEC_FN(sha256_block) (uint32_t *state[], const unsigned char *block[], int n)
+{
+  union { VEC v; uint32_t w[VEC_WIDTH]; } u;
+  VEC zero = { 0 };
+  VEC a, b, c, d, e, f, g, h, k, t1, t2, w[16];
+  int i, l;
+
+  VEC_LOAD_STATE(a, 0);
+  VEC_LOAD_STATE(b, 1);
+  VEC_LOAD_STATE(c, 2);
+  VEC_LOAD_STATE(d, 3);
+  VEC_LOAD_STATE(e, 4);
+  VEC_LOAD_STATE(f, 5);
+  VEC_LOAD_STATE(g, 6);
+  VEC_LOAD_STATE(h, 7);
+  for (i = 0; i < 16; i++)
+    VEC_LOAD_BLOCK(w[i], i);
+
+  for (i = 0; i < 64; i++) {
+    if (i >= 16) {
+      t1 = w[(i-2)&15];
+      t2 = w[(i-15)&15];
+      w[i&15] += (VEC_ROR(t1, 17) ^ VEC_ROR(t1, 19) ^ (t1 >> 10)) + w[(i-7)&15]
+               + (VEC_ROR(t2, 7) ^ VEC_ROR(t2, 18) ^ (t2 >> 3));
+    }
+    k = zero + sha_mb_k256[i];
+    t1 = h + (VEC_ROR(e, 6) ^ VEC_ROR(e, 11) ^ VEC_ROR(e, 25))
+           + (g ^ (e & (f ^ g))) + k + w[i&15];
+    t2 = (VEC_ROR(a, 2) ^ VEC_ROR(a, 13) ^ VEC_ROR(a, 22))
+           + ((a & b) | (c & (a | b)));
+    h = g;
+    g = f;
+    f = e;
+    e = d + t1;
+    d = c;
+    c = b;
+    b = a;
+    a = t1 + t2;
+  }
+
+  VEC_STORE_STATE(a, 0);
+  VEC_STORE_STATE(b, 1);
+  VEC_STORE_STATE(c, 2);
+  VEC_STORE_STATE(d, 3);
+  VEC_STORE_STATE(e, 4);
+  VEC_STORE_STATE(f, 5);
+  VEC_STORE_STATE(g, 6);
+  VEC_STORE_STATE(h, 7);
+}
+
+/* processes up to SHA_MB_LANES lanes, VEC_WIDTH at a time */
+static void VEC_ATTR
+VEC_FN(sha1_mb) (uint32_t *state[], const unsigned char *block[], int n)
+{
+  int i;
+  for (i = 0; i < n; i += VEC_WIDTH)
+    VEC_FN(sha1_block) (state + i, block + i, n - i < VEC_WIDTH ? n - i : VEC_WIDTH);
+}
+
+static void VEC_ATTR
+VEC_FN(sha256_mb) (uint32_t *state[], const unsigned char *block[], int n)
+{
+  int i;
+  for (i = 0; i < n; i += VEC_WIDTH)
+    VEC_FN(sha256_block) (state + i, block + i, n - i < VEC_WIDTH ? n - i : VEC_WIDTH);
+}
+
+#undef VEC_FN2
+#undef VEC_FN1
+#undef VEC_FN
+#undef VEC_LOAD_STATE
+#undef VEC_STORE_STATE
+#undef VEC_LOAD_BLOCK
+#undef VEC_ROL
+#undef VEC_ROR
@@ -0,0 +1,185 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+/* Multi-buffer SHA-1/SHA-256: several messages are hashed at the same time,
+   each one in its own lane of SSE (4 lanes) or AVX2 (8 lanes) registers.
+   SIMD kernels are built with GCC vector extensions and target attributes, so
+   the rest of dibbler does not have to be compiled for these instruction sets.
+   The best kernel the CPU supports is chosen at first use. On other compilers
+   and architectures, blocks are processed one after another by sha1.c and
+   sha256.c code. */
+
+#include <string.h>
+#include "sha-mb.h"
+#include "sha1.h"
+#include "sha256.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+# define SHA_MB_X86 1
+#endif
+
+typedef void (*sha_mb_fn) (uint32_t *state[], const unsigned char *block[], int n);
+
+static void
+sha1_mb_generic (uint32_t *state[], const unsigned char *block[], int n)
+{
+  struct sha1_ctx ctx;
+  uint32_t words[16]; /* aligned copy of the block */
+  int i;
+
+  for (i = 0; i < n; i++) {
+    ctx.A = state[i][0];
+    ctx.B = state[i][1];
+    ctx.C = state[i][2];
+    ctx.D = state[i][3];
+    ctx.E = state[i][4];
+    ctx.total[0] = ctx.total[1] = 0;
+    memcpy (words, block[i], 64);
+    sha1_process_block (words, 64, &ctx);
+    state[i][0] = ctx.A;
+    state[i][1] = ctx.B;
+    state[i][2] = ctx.C;
+    state[i][3] = ctx.D;
+    state[i][4] = ctx.E;
+  }
+}
+
+static void
+sha256_mb_generic (uint32_t *state[], const unsigned char *block[], int n)
+{
+  struct sha256_ctx ctx;
+  uint32_t words[16]; /* aligned copy of the block */
+  int i;
+
+  for (i = 0; i < n; i++) {
+    memcpy (ctx.state, state[i], sizeof(ctx.state));
+    ctx.total[0] = ctx.total[1] = 0;
+    memcpy (words, block[i], 64);
+    sha256_process_block (words, 64, &ctx);
+    memcpy (state[i], ctx.state, sizeof(ctx.state));
+  }
+}
+
+#ifdef SHA_MB_X86
+
+static const uint32_t sha_mb_k256[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+  0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+  0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+  0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+  0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+  0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+typedef uint32_t sha_mb_v4 __attribute__ ((vector_size (16)));
+typedef uint32_t sha_mb_v8 __attribute__ ((vector_size (32)));
+
+#define VEC       sha_mb_v4
+#define VEC_WIDTH 4
+#define VEC_NAME  sse41
+#define VEC_ATTR  __attribute__ ((target ("sse4.1")))
+#include "sha-mb-kernel.h"
+#undef VEC
+#undef VEC_WIDTH
+#undef VEC_NAME
+#undef VEC_ATTR
+
+#define VEC       sha_mb_v8
+#define VEC_WIDTH 8
+#define VEC_NAME  avx2
+#define VEC_ATTR  __attribute__ ((target ("avx2")))
+#include "sha-mb-kernel.h"
+#undef VEC
+#undef VEC_WIDTH
+#undef VEC_NAME
+#undef VEC_ATTR
+
+#endif /* SHA_MB_X86 */
+
+struct sha_mb_impl {
+  const char *name;
+  sha_mb_fn sha1;
+  sha_mb_fn sha256;
+};
+
+/* best first */
+static const struct sha_mb_impl sha_mb_impls[] = {
+#ifdef SHA_MB_X86
+  { "avx2",    sha1_mb_avx2,    sha256_mb_avx2 },
+  { "sse4.1",  sha1_mb_sse41,   sha256_mb_sse41 },
+#endif
+  { "generic", sha1_mb_generic, sha256_mb_generic }
+};
+
+#define SHA_MB_IMPLS ((int)(sizeof(sha_mb_impls)/sizeof(sha_mb_impls[0])))
+
+static const struct sha_mb_impl *sha_mb_current = 0;
+
+static int
+sha_mb_supported (const struct sha_mb_impl *impl)
+{
+#ifdef SHA_MB_X86
+  __builtin_cpu_init ();
+  if (!strcmp (impl->name, "avx2"))
+    return __builtin_cpu_supports ("avx2");
+  if (!strcmp (impl->name, "sse4.1"))
+    return __builtin_cpu_supports ("sse4.1");
+#endif
+  return impl->sha1 == sha1_mb_generic;
+}
+
+static const struct sha_mb_impl *
+sha_mb_get (void)
+{
+  int i;
+
+  if (sha_mb_current)
+    return sha_mb_current;
+  for (i = 0; i < SHA_MB_IMPLS; i++) {
+    if (sha_mb_supported (&sha_mb_impls[i]))
+      break;
+  }
+  sha_mb_current = &sha_mb_impls[i < SHA_MB_IMPLS ? i : SHA_MB_IMPLS - 1];
+  return sha_mb_current;
+}
+
+const char *
+sha_mb_impl (void)
+{
+  return sha_mb_get ()->name;
+}
+
+int
+sha_mb_use (const char *name)
+{
+  int i;
+
+  for (i = 0; i < SHA_MB_IMPLS; i++) {
+    if (!strcmp (sha_mb_impls[i].name, name) && sha_mb_supported (&sha_mb_impls[i])) {
+      sha_mb_current = &sha_mb_impls[i];
+      return 0;
+    }
+  }
+  return -1;
+}
+
+void
+sha1_mb_process_block (uint32_t *state[], const unsigned char *block[], int n)
+{
+  sha_mb_get ()->sha1 (state, block, n);
+}
+
+void
+sha256_mb_process_block (uint32_t *state[], const unsigned char *block[], int n)
+{
+  sha_mb_get ()->sha256 (state, block, n);
+}
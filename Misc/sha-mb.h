@@ -0,0 +1,39 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SHA_MB_H
+#define SHA_MB_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* max. number of messages hashed at the same time */
+#define SHA_MB_LANES 8
+
+/* Multi-buffer SHA-1 and SHA-256 (SHA-224) compression: one 64-byte block of
+   each of N independent messages is processed at once, every message in its own
+   SIMD lane. state[i] points to 5 (SHA-1) or 8 (SHA-256) words of lane i and is
+   updated in place, block[i] points to its block. N is at most SHA_MB_LANES. */
+void sha1_mb_process_block (uint32_t *state[], const unsigned char *block[], int n);
+void sha256_mb_process_block (uint32_t *state[], const unsigned char *block[], int n);
+
+/* Implementation is chosen at first use, based on CPU features: "avx2",
+   "sse4.1" or "generic" (one message after another). sha_mb_use() selects
+   given one (e.g. for tests), returns 0 if it is available on this CPU. */
+const char *sha_mb_impl (void);
+int sha_mb_use (const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,133 @@
+#include <IPv6Addr.h>
+#include <AddrTrie.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+    class AddrTrieTest : public ::testing::Test {
+    public:
+        AddrTrieTest() { }
+
+        void insert(const char* lo, const char* hi, int value) {
+            TIPv6Addr l(lo, true), h(hi, true);
+            Trie.insert(l.getAddr(), h.getAddr(), value);
+        }
+
+        int find(const char* addr) {
+            TIPv6Addr a(addr, true);
+            return Trie.find(a.getAddr());
+        }
+
+        TAddrTrie<int> Trie;
+    };
+
+TEST_F(AddrTrieTest, empty) {
+    EXPECT_TRUE(Trie.empty());
+    EXPECT_EQ(0, find("2001:db8::1"));
+
+    insert("2001:db8::", "2001:db8::ff", 1);
+    EXPECT_FALSE(Trie.empty());
+    EXPECT_EQ(1, find("2001:db8::1"));
+
+    Trie.clear();
+    EXPECT_TRUE(Trie.empty());
+    EXPECT_EQ(0, find("2001:db8::1"));
+}
+
+TEST_F(AddrTrieTest, unalignedRange) {
+    // neither end is aligned, range is split into several prefixes
+    insert("2001:db8::5", "2001:db8::1a", 1);
+
+    EXPECT_EQ(0, find("2001:db8::"));
+    EXPECT_EQ(0, find("2001:db8::4"));
+    EXPECT_EQ(1, find("2001:db8::5"));
+    EXPECT_EQ(1, find("2001:db8::8"));
+    EXPECT_EQ(1, find("2001:db8::10"));
+    EXPECT_EQ(1, find("2001:db8::19"));
+    EXPECT_EQ(1, find("2001:db8::1a"));
+    EXPECT_EQ(0, find("2001:db8::1b"));
+    EXPECT_EQ(0, find("2001:db8::20"));
+
+    // range crossing byte boundary
+    insert("2001:db8:1::fff0", "2001:db8:1::1:000f", 2);
+    EXPECT_EQ(0, find("2001:db8:1::ffef"));
+    EXPECT_EQ(2, find("2001:db8:1::fff0"));
+    EXPECT_EQ(2, find("2001:db8:1::ffff"));
+    EXPECT_EQ(2, find("2001:db8:1::1:0"));
+    EXPECT_EQ(2, find("2001:db8:1::1:f"));
+    EXPECT_EQ(0, find("2001:db8:1::1:10"));
+}
+
+TEST_F(AddrTrieTest, reversedRange) {
+    insert("2001:db8::20", "2001:db8::10", 1);
+    EXPECT_EQ(0, find("2001:db8::f"));
+    EXPECT_EQ(1, find("2001:db8::10"));
+    EXPECT_EQ(1, find("2001:db8::20"));
+    EXPECT_EQ(0, find("2001:db8::21"));
+}
+
+TEST_F(AddrTrieTest, singleAddress) {
+    // /128 pool
+    insert("2001:db8::7", "2001:db8::7", 1);
+    EXPECT_EQ(0, find("2001:db8::6"));
+    EXPECT_EQ(1, find("2001:db8::7"));
+    EXPECT_EQ(0, find("2001:db8::8"));
+
+    insert("::", "::", 2);
+    EXPECT_EQ(2, find("::"));
+    EXPECT_EQ(0, find("::1"));
+
+    insert("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 3);
+    EXPECT_EQ(3, find("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(0, find("ffff:ffff:ffff:ffff:ffff:ffff:ffff:fffe"));
+}
+
+TEST_F(AddrTrieTest, wholeSpace) {
+    insert("::", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff", 1);
+    EXPECT_EQ(1, find("::"));
+    EXPECT_EQ(1, find("2001:db8::1"));
+    EXPECT_EQ(1, find("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+}
+
+TEST_F(AddrTrieTest, highBytes) {
+    // bytes above 0x7f must not be compared as signed chars
+    insert("fe80::", "fe80::ffff", 1);
+    EXPECT_EQ(1, find("fe80::1"));
+    EXPECT_EQ(1, find("fe80::ffff"));
+    EXPECT_EQ(0, find("fe80::1:0"));
+    EXPECT_EQ(0, find("fe7f:ffff:ffff:ffff:ffff:ffff:ffff:ffff"));
+    EXPECT_EQ(0, find("2001:db8::1"));
+}
+
+TEST_F(AddrTrieTest, overlappingClasses) {
+    // class defined first wins, as with linear scan over classes
+    insert("2001:db8::", "2001:db8::ff", 1);
+    insert("2001:db8::80", "2001:db8::17f", 2);
+    EXPECT_EQ(1, find("2001:db8::7f"));
+    EXPECT_EQ(1, find("2001:db8::80"));
+    EXPECT_EQ(1, find("2001:db8::ff"));
+    EXPECT_EQ(2, find("2001:db8::100"));
+    EXPECT_EQ(2, find("2001:db8::17f"));
+    EXPECT_EQ(0, find("2001:db8::180"));
+
+    // smaller class defined before larger one, that contains it
+    insert("2001:db8:1::40", "2001:db8:1::4f", 3);
+    insert("2001:db8:1::", "2001:db8:1::ffff", 4);
+    EXPECT_EQ(4, find("2001:db8:1::3f"));
+    EXPECT_EQ(3, find("2001:db8:1::40"));
+    EXPECT_EQ(3, find("2001:db8:1::4f"));
+    EXPECT_EQ(4, find("2001:db8:1::50"));
+
+    // larger class first hides the smaller one completely
+    insert("2001:db8:2::", "2001:db8:2::ffff", 5);
+    insert("2001:db8:2::40", "2001:db8:2::4f", 6);
+    EXPECT_EQ(5, find("2001:db8:2::45"));
+
+    // the same range defined twice
+    insert("2001:db8:3::", "2001:db8:3::f", 7);
+    insert("2001:db8:3::", "2001:db8:3::f", 8);
+    EXPECT_EQ(7, find("2001:db8:3::a"));
+}
+
+}
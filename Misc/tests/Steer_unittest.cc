@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <string>
+#include <vector>
+#include <Portable.h>
+#include <DHCPConst.h>
+
+namespace {
+
+#ifdef LINUX
+
+    // appends option (code, length, data) to the message
+    void addOption(std::string & msg, int code, const std::string & data) {
+        msg += (char)(code >> 8);
+        msg += (char)code;
+        msg += (char)(data.length() >> 8);
+        msg += (char)data.length();
+        msg += data;
+    }
+
+    // DUID-LL with given last byte of MAC address
+    std::string duid(int i) {
+        const char ll[] = { 0, 3, 0, 1, 0x02, 0x42, 0x0a, 0x0b, 0x0c, 0 };
+        std::string x(ll, sizeof(ll));
+        x[9] = (char)i;
+        return x;
+    }
+
+    std::string solicit(const std::string & clientId, bool elapsedFirst) {
+        std::string msg("\x01\x12\x34\x56", 4);
+        if (elapsedFirst)
+            addOption(msg, OPTION_ELAPSED_TIME, std::string(2, '\0'));
+        addOption(msg, OPTION_CLIENTID, clientId);
+        addOption(msg, OPTION_ELAPSED_TIME, std::string(2, '\0'));
+        return msg;
+    }
+
+    std::string relayForw(const std::string & inner) {
+        std::string msg(34, '\0');
+        msg[0] = RELAY_FORW_MSG;
+        addOption(msg, OPTION_INTERFACE_ID, "eth0");
+        addOption(msg, OPTION_RELAY_MSG, inner);
+        return msg;
+    }
+
+    unsigned int key(const std::string & msg) {
+        return steer_key(msg.data(), (int)msg.length());
+    }
+
+    // sockets bound with SO_REUSEPORT to the same port of ::1, with steering
+    // program attached, so kernel tells which worker would get a message
+    class SteerGroup {
+    public:
+        SteerGroup(int count) :Client(-1), Port(0) {
+            for (int i = 0; i < count; i++) {
+                int fd = socket(AF_INET6, SOCK_DGRAM, 0);
+                if (fd < 0)
+                    return;
+                Socks.push_back(fd);
+                int on = 1;
+                struct sockaddr_in6 sa;
+                memset(&sa, 0, sizeof(sa));
+                sa.sin6_family = AF_INET6;
+                sa.sin6_addr = in6addr_loopback;
+                sa.sin6_port = Port;
+                socklen_t len = sizeof(sa);
+                if (setsockopt(fd, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) ||
+                    bind(fd, (struct sockaddr*)&sa, sizeof(sa)) ||
+                    getsockname(fd, (struct sockaddr*)&sa, &len))
+                    return;
+                Port = sa.sin6_port;
+            }
+            if (sock_steer(Socks[0], count))
+                return;
+            Client = socket(AF_INET6, SOCK_DGRAM, 0);
+        }
+
+        ~SteerGroup() {
+            for (unsigned int i = 0; i < Socks.size(); i++)
+                close(Socks[i]);
+            if (Client >= 0)
+                close(Client);
+        }
+
+        bool ready() { return Client >= 0; }
+
+        // index of the socket that received the message (-1 if none)
+        int deliver(const std::string & msg) {
+            struct sockaddr_in6 sa;
+            memset(&sa, 0, sizeof(sa));
+            sa.sin6_family = AF_INET6;
+            sa.sin6_addr = in6addr_loopback;
+            sa.sin6_port = Port;
+            if (sendto(Client, msg.data(), msg.length(), 0, (struct sockaddr*)&sa, sizeof(sa)) < 0)
+                return -1;
+
+            std::vector<struct pollfd> fds(Socks.size());
+            for (unsigned int i = 0; i < Socks.size(); i++) {
+                fds[i].fd = Socks[i];
+                fds[i].events = POLLIN;
+                fds[i].revents = 0;
+            }
+            if (poll(&fds[0], fds.size(), 1000) <= 0)
+                return -1;
+            for (unsigned int i = 0; i < fds.size(); i++) {
+                if (fds[i].revents & POLLIN) {
+                    char buf[1500];
+                    recv(Socks[i], buf, sizeof(buf), 0);
+                    return i;
+                }
+            }
+            return -1;
+        }
+
+    private:
+        std::vector<int> Socks;
+        int Client;
+        in_port_t Port;
+    };
+
+TEST(SteerTest, key) {
+    // last 4 bytes of DUID, mixed
+    unsigned int tail = 0x0a0b0c05;
+    EXPECT_EQ(((tail * 0x9E3779B1U) & 0xffffffffU) >> 16, key(solicit(duid(5), false)));
+
+    // options before CLIENTID are skipped, relays are walked through
+    EXPECT_EQ(key(solicit(duid(5), false)), key(solicit(duid(5), true)));
+    EXPECT_EQ(key(solicit(duid(5), false)), key(relayForw(solicit(duid(5), true))));
+    EXPECT_EQ(key(solicit(duid(5), false)),
+              key(relayForw(relayForw(relayForw(relayForw(solicit(duid(5), false)))))));
+    EXPECT_NE(key(solicit(duid(5), false)), key(solicit(duid(6), false)));
+
+    // too many relays, no CLIENTID, truncated messages
+    EXPECT_EQ(0u, key(relayForw(relayForw(relayForw(relayForw(relayForw(solicit(duid(5), false))))))));
+    EXPECT_EQ(0u, key(std::string("\x01\x12\x34\x56", 4)));
+    std::string msg = solicit(duid(5), true);
+    EXPECT_EQ(0u, key(msg.substr(0, msg.length() - 8)));
+    EXPECT_EQ(0u, key(relayForw(solicit(duid(5), false)).substr(0, 40)));
+    EXPECT_EQ(0u, key(std::string()));
+}
+
+TEST(SteerTest, kernelAgrees) {
+    const int workers = 4;
+    SteerGroup group(workers);
+    if (!group.ready()) {
+        std::cout << "SO_REUSEPORT steering is not available, test skipped." << std::endl;
+        return;
+    }
+
+    std::vector<std::string> msgs;
+    for (int i = 0; i < 32; i++) {
+        msgs.push_back(solicit(duid(i), i % 2));
+        msgs.push_back(relayForw(solicit(duid(i), i % 2)));
+        msgs.push_back(relayForw(relayForw(solicit(duid(i), true))));
+    }
+    msgs.push_back(relayForw(relayForw(relayForw(relayForw(relayForw(solicit(duid(1), false)))))));
+    msgs.push_back(std::string("\x01\x12\x34\x56", 4));
+    msgs.push_back(solicit(duid(1), true).substr(0, 18));
+    msgs.push_back(relayForw(solicit(duid(1), false)).substr(0, 40));
+
+    bool used[workers] = { false, false, false, false };
+    for (unsigned int i = 0; i < msgs.size(); i++) {
+        int expected = (int)(key(msgs[i]) % workers);
+        EXPECT_EQ(expected, group.deliver(msgs[i])) << "message " << i;
+        used[expected] = true;
+    }
+    // clients are spread between all workers
+    for (int i = 0; i < workers; i++)
+        EXPECT_TRUE(used[i]) << "worker " << i;
+}
+
+#endif
+
+}
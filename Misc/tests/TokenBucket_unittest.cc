@@ -0,0 +1,105 @@
+#include <TokenBucket.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(TokenBucketTest, disabled) {
+    TTokenBuckets b;
+    EXPECT_FALSE(b.enabled());
+    for (int i = 0; i < 100; i++) {
+        EXPECT_TRUE(b.check("client", 0, false));
+        b.take("client");
+    }
+    EXPECT_EQ(0u, b.size());
+}
+
+TEST(TokenBucketTest, burst) {
+    TTokenBuckets b;
+    b.setLimit(1, 3);
+    EXPECT_TRUE(b.enabled());
+
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(b.check("client", 1000, false));
+        b.take("client");
+    }
+    EXPECT_FALSE(b.check("client", 1000, false));
+
+    // other keys have their own buckets
+    EXPECT_TRUE(b.check("other", 1000, false));
+    EXPECT_EQ(2u, b.size());
+}
+
+TEST(TokenBucketTest, refill) {
+    TTokenBuckets b;
+    b.setLimit(2, 2);
+
+    b.check("client", 1000, false);
+    b.take("client");
+    b.take("client");
+    EXPECT_FALSE(b.check("client", 1000, false));
+    EXPECT_FALSE(b.check("client", 1400, false));
+    EXPECT_TRUE(b.check("client", 1500, false)); // 2 tokens/s, one after 0.5s
+
+    // never refilled above burst
+    EXPECT_TRUE(b.check("client", 100000, false));
+    b.take("client");
+    b.take("client");
+    EXPECT_FALSE(b.check("client", 100000, false));
+}
+
+TEST(TokenBucketTest, checkDoesNotTake) {
+    // check() alone must not consume tokens, so a message rejected by
+    // another bucket does not cost anything
+    TTokenBuckets b;
+    b.setLimit(1, 1);
+    for (int i = 0; i < 10; i++)
+        EXPECT_TRUE(b.check("client", 1000, false));
+    b.take("client");
+    EXPECT_FALSE(b.check("client", 1000, false));
+}
+
+TEST(TokenBucketTest, retransmission) {
+    TTokenBuckets b;
+    b.setLimit(1, 4);
+
+    // retransmissions need at least half of the bucket
+    b.check("link", 1000, false);
+    b.take("link");
+    EXPECT_TRUE(b.check("link", 1000, true));
+    b.take("link");
+    EXPECT_TRUE(b.check("link", 1000, true));
+    b.take("link");
+    EXPECT_FALSE(b.check("link", 1000, true));
+    EXPECT_TRUE(b.check("link", 1000, false));
+}
+
+TEST(TokenBucketTest, purge) {
+    TTokenBuckets b;
+    b.setLimit(1, 2);
+
+    b.check("full", 1000, false);
+    b.check("used", 1000, false);
+    b.take("used");
+    b.take("used");
+    EXPECT_EQ(2u, b.size());
+
+    b.purge(1000);
+    EXPECT_EQ(1u, b.size());
+
+    // not full yet
+    b.purge(2500);
+    EXPECT_EQ(1u, b.size());
+
+    b.purge(3000);
+    EXPECT_EQ(0u, b.size());
+
+    // clock going backwards doesn't break anything
+    b.check("client", 5000, false);
+    b.take("client");
+    b.purge(4000);
+    EXPECT_EQ(1u, b.size());
+    EXPECT_TRUE(b.check("client", 4000, false));
+}
+
+}
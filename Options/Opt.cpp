@@ -37,18 +37,40 @@ int TOpt::getSubOptSize() {
     return size;
 }
 
+/**
+ * stores option type and leaves room for option length
+ *
+ * Length is not known until option data (and sub-options) are stored, so
+ * storeSelf() implementations call storeLength() when they are done. This
+ * way, nested options are not sized separately before they are stored.
+ *
+ * @param buf buffer, where option begins
+ *
+ * @return pointer to the place, where option data should be stored
+ */
 char* TOpt::storeHeader(char* buf) {
     buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf,getSize() - 4);
-    return buf;
+    return buf + sizeof(uint16_t);
+}
+
+/**
+ * stores option length in the header written by storeHeader()
+ *
+ * @param start beginning of the option (as passed to storeHeader())
+ * @param end end of the option
+ *
+ * @return end of the option
+ */
+char* TOpt::storeLength(char* start, char* end) {
+    writeUint16(start + sizeof(uint16_t), end - start - 4);
+    return end;
 }
 
 char* TOpt::storeSubOpt( char* buf){
     SPtr<TOpt> ptr;
     SubOptions.first();
     while ( ptr = SubOptions.get() ) {
-	ptr->storeSelf(buf);
-	buf += ptr->getSize();
+	buf = ptr->storeSelf(buf);
     }
     return buf;
 }
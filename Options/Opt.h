@@ -96,6 +96,7 @@ class TOpt
 
  protected:
     char* storeHeader(char* buf);
+    char* storeLength(char* start, char* end);
     char* storeSubOpt(char* buf);
     int getSubOptSize();
 
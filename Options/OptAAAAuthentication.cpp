@@ -78,8 +78,8 @@ TOptAAAAuthentication::TOptAAAAuthentication(TMsg* parent)
 
  char * TOptAAAAuthentication::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize() - 4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = writeUint32(buf, AAASPI);
 
     memset(buf, 0, AAAAuthInfoLen);
@@ -92,5 +92,5 @@ TOptAAAAuthentication::TOptAAAAuthentication(TMsg* parent)
 
     buf+=AAAAuthInfoLen;
 
-    return buf;
+    return storeLength(start, buf);
 }
@@ -49,12 +49,12 @@ std::string TOptAddr::getPlain() {
 
 char * TOptAddr::storeSelf(char* buf) {
     // store generic header
-    buf = writeUint16( buf, OptType );
-    buf = writeUint16( buf, getSize() - 4 );
+    char* start = buf;
+    buf = storeHeader(buf);
 
     // store address
     buf = Addr->storeSelf(buf);
 
     // store sub-options (if three are any)
-    return storeSubOpt(buf);
+    return storeLength(start, storeSubOpt(buf));
 }
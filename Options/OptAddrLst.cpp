@@ -39,12 +39,13 @@ TOptAddrLst::TOptAddrLst(int type, const char* buf, unsigned short bufSize, TMsg
 char * TOptAddrLst::storeSelf(char* buf) {
     SPtr<TIPv6Addr> addr;
 
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+
+    buf = storeHeader(buf);
     AddrLst.first();
     while(addr=AddrLst.get())
 	buf=addr->storeSelf(buf);
-    return buf;
+    return storeLength(start, buf);
 }
 
 int TOptAddrLst::getSize()
@@ -48,8 +48,12 @@ TOptAuthentication::TOptAuthentication( char * &buf,  int &n, TMsg* parent)
 
     this->Parent->setAuthInfoPtr(buf);
 
-    if (this->Parent->getType() != ADVERTISE_MSG)
-        this->Parent->setAuthInfoKey(this->Parent->AuthKeys->Get(this->Parent->getSPI()));
+    if (this->Parent->getType() != ADVERTISE_MSG) {
+        char * key = this->Parent->AuthKeys->Get(this->Parent->getSPI());
+        if (!key)
+            Log(Warning) << "Auth: Required key (SPI=" << this->Parent->getSPI() << ") not found." << LogEnd;
+        this->Parent->setAuthInfoKey(key);
+    }
 
     PrintHex("Received digest: ", buf, AuthInfoLen);
     
@@ -78,8 +82,9 @@ TOptAuthentication::TOptAuthentication(TMsg* parent)
     uint32_t spi = this->Parent->getSPI();
     uint32_t aaaspi = this->Parent->getAAASPI();
 
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize() - 4);
+    char* start = buf;
+
+    buf = storeHeader(buf);
     *buf = RDM;
     buf+=1;
     buf = writeUint64(buf, this->Parent->getReplayDetection());
@@ -100,5 +105,5 @@ TOptAuthentication::TOptAuthentication(TMsg* parent)
 
     buf+=AuthInfoLen;
 
-    return buf;
+    return storeLength(start, buf);
 }
@@ -73,8 +73,8 @@ TOptDomainLst::TOptDomainLst(int type, const char *buf, unsigned short bufsize,
 char * TOptDomainLst::storeSelf(char* buf)
 {
     SPtr<string> x;
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     std::string::size_type dotpos;
    
     StringLst.first();
@@ -102,7 +102,7 @@ char * TOptDomainLst::storeSelf(char* buf)
 	*buf=0;
 	buf++;
     }
-    return buf;
+    return storeLength(start, buf);
 }
 
 int TOptDomainLst::getSize() {
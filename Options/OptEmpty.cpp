@@ -24,7 +24,7 @@ TOptEmpty::TOptEmpty(int code, TMsg* parent)
 }
 
  char * TOptEmpty::storeSelf( char* buf) {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
-    return buf;
+    char* start = buf;
+    buf = storeHeader(buf);
+    return storeLength(start, buf);
 }
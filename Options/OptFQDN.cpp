@@ -113,9 +113,9 @@ int TOptFQDN::getSize() {
 }
 
 char * TOptFQDN::storeSelf(char *buffer) {
-    // Type and size
-    buffer = writeUint16(buffer, OptType);
-    buffer = writeUint16(buffer, getSize()-4);
+    // Type and size (size is stored at the end)
+    char* start = buffer;
+    buffer = storeHeader(buffer);
     //Flag Initialization
     *buffer = 0;
     if (flag_N) {
@@ -149,9 +149,9 @@ char * TOptFQDN::storeSelf(char *buffer) {
         buffer += copy.length();
     }
     *buffer = 0;
-    //buffer++;
+    buffer++;
 
-    return buffer;
+    return storeLength(start, buffer);
 }
 
 bool TOptFQDN::isValid() {
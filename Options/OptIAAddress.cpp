@@ -58,9 +58,8 @@ void TOptIAAddress::setValid(unsigned long valid) {
 
  char * TOptIAAddress::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-
-    buf = writeUint16(buf, getSize() - 4 );
+    char* start = buf;
+    buf = storeHeader(buf);
 
     memcpy(buf,Addr->getAddr(),16);
     buf+=16;
@@ -71,7 +70,7 @@ void TOptIAAddress::setValid(unsigned long valid) {
 
     buf=storeSubOpt(buf);
 
-    return buf;
+    return storeLength(start, buf);
 }
 
  SPtr<TIPv6Addr> TOptIAAddress::getAddr()
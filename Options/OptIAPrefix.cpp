@@ -61,8 +61,8 @@ void TOptIAPrefix::setPrefixLenght(char prefix_length){
 
 char * TOptIAPrefix::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
 
     buf = writeUint32(buf, Pref);
     buf = writeUint32(buf, Valid);
@@ -73,7 +73,7 @@ char * TOptIAPrefix::storeSelf( char* buf)
     buf+=16;
        
     buf=storeSubOpt(buf);
-    return buf;
+    return storeLength(start, buf);
 }
 
  SPtr<TIPv6Addr> TOptIAPrefix::getPrefix()
@@ -77,15 +77,15 @@ int TOptIA_NA::getSize() {
 }
 
 char * TOptIA_NA::storeSelf( char* buf) {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize() - 4 );
+    char* start = buf;
+    buf = storeHeader(buf);
 
     buf = writeUint32(buf, IAID);
     buf = writeUint32(buf, T1);
     buf = writeUint32(buf, T2);
 
     buf = storeSubOpt(buf);
-    return buf;
+    return storeLength(start, buf);
 }
 
 unsigned long TOptIA_NA::getMaxValid() {
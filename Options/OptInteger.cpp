@@ -70,7 +70,7 @@ char * TOptInteger::storeSelf(char* buf)
 	*buf = (char)this->Value;
 	break;
     case 2:
-	buf = writeUint16(buf, this->Value);
+	writeUint16(buf, this->Value);
 	break;
     case 3:
     {
@@ -81,7 +81,7 @@ char * TOptInteger::storeSelf(char* buf)
 	break;
     }
     case 4:
-        buf = writeUint32(buf, this->Value);
+        writeUint32(buf, this->Value);
 	break;
     default:
 	/* this should never happen */
@@ -77,8 +77,8 @@ TOptKeyGeneration::TOptKeyGeneration(TMsg* parent)
 
  char * TOptKeyGeneration::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize() - 4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = writeUint32(buf, this->Parent->getSPI());
     buf = writeUint32(buf, Lifetime);
     buf = writeUint32(buf, this->Parent->getAAASPI());
@@ -93,7 +93,7 @@ TOptKeyGeneration::TOptKeyGeneration(TMsg* parent)
     if (0 == this->Parent->setAuthInfoKey())
         this->Parent->AuthKeys->Add(this->Parent->getSPI(), this->Parent->getAAASPI(), this->Parent->getAuthInfoKey());
 
-    return buf;
+    return storeLength(start, buf);
 }
 
 TOptKeyGeneration::~TOptKeyGeneration()
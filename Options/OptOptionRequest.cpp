@@ -42,15 +42,15 @@ char * TOptOptionRequest::storeSelf( char* buf)
 {
     if (!OptCnt) 
         return buf;
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     int i=0;
     while(i<OptCnt)
     {
         buf = writeUint16(buf, Options[i]);
         i++;
     }
-    return buf;
+    return storeLength(start, buf);
 }
 
 TOptOptionRequest::TOptOptionRequest( char * &buf,  int &bufSize, TMsg* parent)
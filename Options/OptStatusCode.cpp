@@ -59,12 +59,12 @@ string TOptStatusCode::getText()
 
 char * TOptStatusCode::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = writeUint16(buf, this->StatusCode);
     strncpy((char *)buf,Message.c_str(),Message.length());
     buf+=Message.length();
-    return buf;
+    return storeLength(start, buf);
 }
 TOptStatusCode::TOptStatusCode(int status,const std::string& message, TMsg* parent)
     :TOpt(OPTION_STATUS_CODE, parent)
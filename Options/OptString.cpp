@@ -32,18 +32,18 @@ TOptString::TOptString(int type, const char *buf, unsigned short bufsize, TMsg*
 
 char * TOptString::storeSelf(char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     memcpy(buf,Str.c_str(),Str.length());
     buf[Str.length()]=0;  // null-terminated
-    return buf+this->Str.length()+1;
+    return storeLength(start, buf+this->Str.length()+1);
 
     *buf = (char)Str.length(); // length of a string (with first byte)
     buf++;
     memcpy(buf,this->Str.c_str(),this->Str.length());
     buf += this->Str.length();
     *buf=0; // add final 0.
-    return buf+1;
+    return storeLength(start, buf+1);
 }
 
 int TOptString::getSize() {
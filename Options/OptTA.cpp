@@ -54,11 +54,11 @@ int TOptTA::getSize() {
 }
 
 char * TOptTA::storeSelf( char* buf) {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = writeUint32(buf, IAID);
     buf=this->storeSubOpt(buf);
-    return buf;
+    return storeLength(start, buf);
 }
 
 unsigned long TOptTA::getMaxValid() {
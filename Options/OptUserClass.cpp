@@ -29,7 +29,7 @@ TOptUserClass::TOptUserClass( char * &buf,  int &n, TMsg* parent)
 
  char * TOptUserClass::storeSelf( char* buf)
 {
-    return 0;
+    return buf;
 }
 bool TOptUserClass::isValid()
 {
@@ -65,12 +65,12 @@ int TOptVendorData::getSize()
  */
 char * TOptVendorData::storeSelf( char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = writeUint32(buf, this->Vendor);
     memmove(buf, this->VendorData, this->VendorDataLen);
     buf+=this->VendorDataLen;
-    return buf;    
+    return storeLength(start, buf);    
 }
 
 bool TOptVendorData::isValid()
@@ -93,11 +93,9 @@ int TOptVendorSpecInfo::getSize()
 
 char * TOptVendorSpecInfo::storeSelf( char* buf)
 {
-    // option-code OPTION_VENDOR_OPTS (2 bytes long)
-    buf = writeUint16(buf, OptType);
-
-    // option-len size of total option-data
-    buf = writeUint16(buf, getSize()-4);
+    // option-code OPTION_VENDOR_OPTS, option-len is stored when the data is known
+    char* start = buf;
+    buf = storeHeader(buf);
 
     // enterprise-number (4 bytes long)
     buf = writeUint32(buf, this->Vendor);
@@ -110,7 +108,7 @@ char * TOptVendorSpecInfo::storeSelf( char* buf)
         buf = opt->storeSelf(buf);
     }
     
-    return buf;
+    return storeLength(start, buf);
 }
 
 bool TOptVendorSpecInfo::isValid()
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "IPv6Addr.h"
+#include "OptAddrLst.h"
+
+namespace {
+
+char expected[] = { 0, 23, 0, 32, // OPTION_DNS_SERVERS, length = 2*16
+                    0x20, 0x1, 0x0d, 0xb8, 0, 1, 0, 0,
+                    0, 0, 0, 0, 0, 0, 0, 1,
+                    0x20, 0x1, 0x0d, 0xb8, 0, 1, 0, 0,
+                    0, 0, 0, 0, 0, 0, 0, 2 };
+
+TEST(OptAddrLstTest, storeSelf) {
+    char buf[128];
+
+    List(TIPv6Addr) addrs;
+    addrs.append(new TIPv6Addr("2001:db8:1::1", true));
+    addrs.append(new TIPv6Addr("2001:db8:1::2", true));
+    TOptAddrLst* opt = new TOptAddrLst(OPTION_DNS_SERVERS, addrs, NULL);
+
+    ASSERT_EQ(36, opt->getSize());
+
+    char* ptr = opt->storeSelf(buf);
+    ASSERT_EQ(buf+36, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 36) );
+
+    delete opt;
+}
+
+TEST(OptAddrLstTest, parse) {
+    char buf[128];
+
+    TOptAddrLst* opt = new TOptAddrLst(OPTION_DNS_SERVERS, expected+4, 32, NULL);
+
+    ASSERT_TRUE(opt->isValid());
+    ASSERT_EQ(2, opt->getAddrLst().count());
+    opt->firstAddr();
+    EXPECT_EQ(std::string("2001:db8:1::1"), opt->getAddr()->getPlain());
+    EXPECT_EQ(std::string("2001:db8:1::2"), opt->getAddr()->getPlain());
+
+    ASSERT_EQ(36, opt->getSize());
+    ASSERT_EQ(buf+36, opt->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 36) );
+
+    delete opt;
+}
+
+TEST(OptAddrLstTest, truncated) {
+    TOptAddrLst* opt = new TOptAddrLst(OPTION_DNS_SERVERS, expected+4, 20, NULL);
+    EXPECT_FALSE(opt->isValid());
+    delete opt;
+}
+
+}
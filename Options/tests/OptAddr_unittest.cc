@@ -35,7 +35,7 @@ TEST(OptAddrTest, parse) {
     TOptAddr* opt = new TOptAddr(OPTION_UNICAST, expected+4, 16, NULL);
     SPtr<TIPv6Addr> addr = opt->getAddr();
 
-    EXPECT_EQ(string("2001:db8:1::dead:beef"), addr->getPlain());
+    EXPECT_EQ(std::string("2001:db8:1::dead:beef"), addr->getPlain());
 
     EXPECT_EQ(OPTION_UNICAST, opt->getOptType() );
 
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "OptDomainLst.h"
+
+namespace {
+
+char expected[] = { 0, 24, 0, 30, // OPTION_DOMAIN_LIST, length = 30
+                    7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+                    3, 'c', 'o', 'm', 0,
+                    3, 'l', 'a', 'b',
+                    7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+                    3, 'o', 'r', 'g', 0 };
+
+TEST(OptDomainLstTest, storeSelf) {
+    char buf[128];
+
+    List(std::string) domains;
+    domains.append(new std::string("example.com"));
+    domains.append(new std::string("lab.example.org"));
+    TOptDomainLst* opt = new TOptDomainLst(OPTION_DOMAIN_LIST, domains, NULL);
+
+    ASSERT_EQ(34, opt->getSize());
+
+    char* ptr = opt->storeSelf(buf);
+    ASSERT_EQ(buf+34, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 34) );
+
+    delete opt;
+}
+
+TEST(OptDomainLstTest, parse) {
+    char buf[128];
+
+    TOptDomainLst* opt = new TOptDomainLst(OPTION_DOMAIN_LIST, expected+4, 30, NULL);
+
+    List(std::string) domains = opt->getDomainLst();
+    ASSERT_EQ(2, domains.count());
+    domains.first();
+    EXPECT_EQ(std::string("example.com"), *domains.get());
+    EXPECT_EQ(std::string("lab.example.org"), *domains.get());
+
+    ASSERT_EQ(34, opt->getSize());
+    ASSERT_EQ(buf+34, opt->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 34) );
+
+    delete opt;
+}
+
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "OptFQDN.h"
+
+namespace {
+
+// TOptFQDN is abstract (doDuties() lives in the client/server classes)
+class NakedOptFQDN : public TOptFQDN {
+public:
+    NakedOptFQDN(const std::string& fqdn)
+        :TOptFQDN(fqdn, NULL) {}
+    NakedOptFQDN(char* &buf, int &bufsize)
+        :TOptFQDN(buf, bufsize, NULL) {}
+    bool doDuties() { return true; }
+};
+
+char expected[] = { 0, 39, 0, 19, // OPTION_FQDN, length = 19
+                    FQDN_S,       // flags
+                    4, 'h', 'o', 's', 't',
+                    7, 'e', 'x', 'a', 'm', 'p', 'l', 'e',
+                    3, 'c', 'o', 'm',
+                    0 };
+
+TEST(OptFQDNTest, storeSelf) {
+    char buf[128];
+
+    TOptFQDN* opt = new NakedOptFQDN("host.example.com");
+    opt->setSFlag(true);
+
+    ASSERT_EQ(23, opt->getSize());
+
+    char* ptr = opt->storeSelf(buf);
+    ASSERT_EQ(buf+23, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 23) );
+
+    delete opt;
+}
+
+TEST(OptFQDNTest, parse) {
+    char buf[128];
+
+    char* ptr = expected+4;
+    int len = 19;
+    TOptFQDN* opt = new NakedOptFQDN(ptr, len);
+
+    ASSERT_TRUE(opt->isValid());
+    EXPECT_EQ(std::string("host.example.com"), opt->getFQDN());
+    EXPECT_TRUE(opt->getSFlag());
+    EXPECT_FALSE(opt->getNFlag());
+    EXPECT_FALSE(opt->getOFlag());
+
+    ASSERT_EQ(23, opt->getSize());
+    ASSERT_EQ(buf+23, opt->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 23) );
+
+    delete opt;
+}
+
+TEST(OptFQDNTest, emptyName) {
+    char buf[128];
+    char empty[] = { 0, 39, 0, 2, FQDN_N, 0 };
+
+    TOptFQDN* opt = new NakedOptFQDN("");
+    opt->setNFlag(true);
+
+    ASSERT_EQ(6, opt->getSize());
+    ASSERT_EQ(buf+6, opt->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, empty, 6) );
+
+    delete opt;
+}
+
+}
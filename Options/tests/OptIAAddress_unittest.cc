@@ -41,7 +41,7 @@ TEST(OptIAAddressTest, parse) {
     TOptIAAddress* opt = new TOptIAAddress(ptr, len, NULL);
     SPtr<TIPv6Addr> addr = opt->getAddr();
 
-    EXPECT_EQ(string("2001:db8:1::dead:beef"), addr->getPlain());
+    EXPECT_EQ(std::string("2001:db8:1::dead:beef"), addr->getPlain());
 
     EXPECT_EQ(OPTION_IAADDR, opt->getOptType() );
 
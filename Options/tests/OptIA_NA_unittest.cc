@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "IPv6Addr.h"
+#include "OptIA_NA.h"
+#include "OptIAAddress.h"
+#include "OptStatusCode.h"
+
+namespace {
+
+// TOptIA_NA is abstract (doDuties() lives in the client/server classes)
+class NakedOptIA_NA : public TOptIA_NA {
+public:
+    NakedOptIA_NA(long iaid, long t1, long t2)
+        :TOptIA_NA(iaid, t1, t2, NULL) {}
+    NakedOptIA_NA(char* &buf, int &len)
+        :TOptIA_NA(buf, len, NULL) {}
+    bool doDuties() { return true; }
+};
+
+char expected[] = {
+    0, 3, 0, 56, // OPTION_IA_NA, length = 12 + 36 + 8
+    0, 0, 0, 1,  // IAID = 1
+    0, 0, 0x3, 0xe8, // T1 = 1000
+    0, 0, 0x7, 0xd0, // T2 = 2000
+    //   v--- IAADDR within IA_NA
+    0, 5, 0, 32, // OPTION_IAADDR, length = 24 + 8
+    0x20, 0x1, 0x0d, 0xb8, 0, 1, 0, 0,
+    0, 0, 0, 0, 0xde, 0xad, 0xbe, 0xef,
+    0, 0, 0xb, 0xb8, // pref = 3000
+    0, 0, 0xf, 0xa0, // valid = 4000
+    //       v--- STATUS_CODE within IAADDR
+    0, 13, 0, 4, // OPTION_STATUS_CODE, length = 4
+    0, 0, 'o', 'k',
+    //   v--- STATUS_CODE within IA_NA
+    0, 13, 0, 4,
+    0, 0, 'o', 'k'
+};
+
+TEST(OptIA_NATest, storeSelf) {
+    char buf[128];
+
+    SPtr<TIPv6Addr> addr = new TIPv6Addr("2001:db8:1::dead:beef", true);
+    SPtr<TOptIAAddress> iaaddr = new TOptIAAddress(addr, 3000, 4000, NULL);
+    iaaddr->addOption(new TOptStatusCode(STATUSCODE_SUCCESS, "ok", NULL));
+
+    NakedOptIA_NA* ia = new NakedOptIA_NA(1, 1000, 2000);
+    ia->addOption((Ptr*)iaaddr);
+    ia->addOption(new TOptStatusCode(STATUSCODE_SUCCESS, "ok", NULL));
+
+    ASSERT_EQ(60, ia->getSize());
+
+    char* ptr = ia->storeSelf(buf);
+    ASSERT_EQ(buf+60, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 60) );
+
+    delete ia;
+}
+
+TEST(OptIA_NATest, parse) {
+    char buf[128];
+
+    char* ptr = expected+4;
+    int len = 56;
+    NakedOptIA_NA* ia = new NakedOptIA_NA(ptr, len);
+    ASSERT_TRUE(ia->isValid());
+    EXPECT_EQ(expected+16, ptr);
+    EXPECT_EQ(44, len);
+
+    EXPECT_EQ(1u, ia->getIAID());
+    EXPECT_EQ(1000u, ia->getT1());
+    EXPECT_EQ(2000u, ia->getT2());
+
+    // IAADDR with its own STATUS_CODE
+    ptr += 4; len -= 4;
+    int iaaddrLen = 32;
+    SPtr<TOptIAAddress> iaaddr = new TOptIAAddress(ptr, iaaddrLen, NULL);
+    ASSERT_TRUE(iaaddr->isValid());
+    EXPECT_EQ(std::string("2001:db8:1::dead:beef"), iaaddr->getAddr()->getPlain());
+    EXPECT_EQ(3000u, iaaddr->getPref());
+    EXPECT_EQ(4000u, iaaddr->getValid());
+    ptr += 4; iaaddrLen -= 4;
+    iaaddr->addOption(new TOptStatusCode(ptr, iaaddrLen, NULL));
+    ptr += iaaddrLen;
+    len -= 32;
+    ia->addOption((Ptr*)iaaddr);
+
+    // STATUS_CODE directly in IA_NA
+    ptr += 4; len -= 4;
+    SPtr<TOptStatusCode> status = new TOptStatusCode(ptr, len, NULL);
+    EXPECT_EQ(STATUSCODE_SUCCESS, status->getCode());
+    EXPECT_EQ(std::string("ok"), status->getText());
+    ia->addOption((Ptr*)status);
+
+    EXPECT_EQ(1, ia->countAddrs());
+    EXPECT_EQ(STATUSCODE_SUCCESS, ia->getStatusCode());
+
+    // storing parsed option must yield the very same wire format
+    ASSERT_EQ(60, ia->getSize());
+    ASSERT_EQ(buf+60, ia->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 60) );
+
+    delete ia;
+}
+
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "IPv6Addr.h"
+#include "OptIA_PD.h"
+#include "OptIAPrefix.h"
+
+namespace {
+
+// IA_PD and IAPREFIX are abstract (doDuties() lives in the client/server classes)
+class NakedOptIA_PD : public TOptIA_PD {
+public:
+    NakedOptIA_PD(long iaid, long t1, long t2)
+        :TOptIA_PD(iaid, t1, t2, NULL) {}
+    NakedOptIA_PD(char* &buf, int &len)
+        :TOptIA_PD(buf, len, NULL) {}
+    bool doDuties() { return true; }
+};
+
+class NakedOptIAPrefix : public TOptIAPrefix {
+public:
+    NakedOptIAPrefix(SPtr<TIPv6Addr> prefix, char length, unsigned long pref,
+                     unsigned long valid)
+        :TOptIAPrefix(prefix, length, pref, valid, NULL) {}
+    NakedOptIAPrefix(char* &buf, int &len)
+        :TOptIAPrefix(buf, len, NULL) {}
+    bool doDuties() { return true; }
+};
+
+char expected[] = {
+    0, 25, 0, 41, // OPTION_IA_PD, length = 12 + 29
+    0, 0, 0, 2,   // IAID = 2
+    0, 0, 0x3, 0xe8, // T1 = 1000
+    0, 0, 0x7, 0xd0, // T2 = 2000
+    //   v--- IAPREFIX within IA_PD
+    0, 26, 0, 25, // OPTION_IAPREFIX, length = 25
+    0, 0, 0xb, 0xb8, // pref = 3000
+    0, 0, 0xf, 0xa0, // valid = 4000
+    56, // prefix-length
+    0x20, 0x1, 0x0d, 0xb8, 0, 1, 0xff, 0,
+    0, 0, 0, 0, 0, 0, 0, 0 // 2001:db8:1:ff00::
+};
+
+TEST(OptIA_PDTest, storeSelf) {
+    char buf[128];
+
+    SPtr<TIPv6Addr> prefix = new TIPv6Addr("2001:db8:1:ff00::", true);
+    SPtr<TOpt> iaprefix = new NakedOptIAPrefix(prefix, 56, 3000, 4000);
+
+    NakedOptIA_PD* pd = new NakedOptIA_PD(2, 1000, 2000);
+    pd->addOption(iaprefix);
+
+    ASSERT_EQ(45, pd->getSize());
+
+    char* ptr = pd->storeSelf(buf);
+    ASSERT_EQ(buf+45, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 45) );
+
+    delete pd;
+}
+
+TEST(OptIA_PDTest, parse) {
+    char buf[128];
+
+    char* ptr = expected+4;
+    int len = 41;
+    NakedOptIA_PD* pd = new NakedOptIA_PD(ptr, len);
+    ASSERT_TRUE(pd->isValid());
+    EXPECT_EQ(2u, pd->getIAID());
+    EXPECT_EQ(1000u, pd->getT1());
+    EXPECT_EQ(2000u, pd->getT2());
+
+    ptr += 4; len -= 4;
+    SPtr<NakedOptIAPrefix> iaprefix = new NakedOptIAPrefix(ptr, len);
+    ASSERT_TRUE(iaprefix->isValid());
+    EXPECT_EQ(0, len);
+    EXPECT_EQ(expected+45, ptr);
+    EXPECT_EQ(std::string("2001:db8:1:ff00::"), iaprefix->getPrefix()->getPlain());
+    EXPECT_EQ(56, iaprefix->getPrefixLength());
+    EXPECT_EQ(3000u, iaprefix->getPref());
+    EXPECT_EQ(4000u, iaprefix->getValid());
+    pd->addOption((Ptr*)iaprefix);
+
+    EXPECT_EQ(1, pd->countPrefixes());
+
+    ASSERT_EQ(45, pd->getSize());
+    ASSERT_EQ(buf+45, pd->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 45) );
+
+    delete pd;
+}
+
+}
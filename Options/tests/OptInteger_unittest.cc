@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "OptInteger.h"
+
+namespace {
+
+// TOptInteger is abstract (doDuties() lives in the client/server classes)
+class NakedOptInteger : public TOptInteger {
+public:
+    NakedOptInteger(int type, unsigned int len, unsigned int value)
+        :TOptInteger(type, len, value, NULL) {}
+    NakedOptInteger(int type, unsigned int len, char* &buf, int &bufsize)
+        :TOptInteger(type, len, buf, bufsize, NULL) {}
+    bool doDuties() { return true; }
+};
+
+char expected1[] = { 0, 7, 0, 1,     // OPTION_PREFERENCE, length = 1
+                     200 };
+char expected2[] = { 0, 8, 0, 2,     // OPTION_ELAPSED_TIME, length = 2
+                     0x12, 0x34 };
+char expected4[] = { 0, 32, 0, 4,    // OPTION_INFORMATION_REFRESH_TIME, length = 4
+                     0x12, 0x34, 0x56, 0x78 };
+
+// stores a freshly created option, checks wire format, parses it back and
+// checks that storing the parsed option gives the same bytes
+void roundTrip(int type, unsigned int len, unsigned int value, const char* expected) {
+    char buf[32];
+    int total = 4 + len;
+
+    TOptInteger* opt = new NakedOptInteger(type, len, value);
+    ASSERT_EQ(total, opt->getSize());
+    char* ptr = opt->storeSelf(buf);
+    ASSERT_EQ(buf+total, ptr);
+    EXPECT_FALSE( memcmp(buf, expected, total) );
+    delete opt;
+
+    ptr = buf+4;
+    int bufsize = len;
+    opt = new NakedOptInteger(type, len, ptr, bufsize);
+    ASSERT_TRUE(opt->isValid());
+    EXPECT_EQ(buf+total, ptr);
+    EXPECT_EQ(0, bufsize);
+    EXPECT_EQ(value, opt->getValue());
+    EXPECT_EQ(type, opt->getOptType());
+
+    char buf2[32];
+    ASSERT_EQ(buf2+total, opt->storeSelf(buf2));
+    EXPECT_FALSE( memcmp(buf2, expected, total) );
+    delete opt;
+}
+
+TEST(OptIntegerTest, oneByte) {
+    roundTrip(OPTION_PREFERENCE, 1, 200, expected1);
+}
+
+TEST(OptIntegerTest, twoBytes) {
+    roundTrip(OPTION_ELAPSED_TIME, 2, 0x1234, expected2);
+}
+
+TEST(OptIntegerTest, fourBytes) {
+    roundTrip(OPTION_INFORMATION_REFRESH_TIME, 4, 0x12345678, expected4);
+}
+
+TEST(OptIntegerTest, truncated) {
+    char* ptr = expected4+4;
+    int bufsize = 3;
+    TOptInteger* opt = new NakedOptInteger(OPTION_INFORMATION_REFRESH_TIME, 4, ptr, bufsize);
+    EXPECT_FALSE(opt->isValid());
+    delete opt;
+}
+
+}
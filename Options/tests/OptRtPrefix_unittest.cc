@@ -77,7 +77,7 @@ TEST(OptAddrTest, rtPrefixParse) {
     SPtr<TOptRtPrefix> rtPrefix = (Ptr*)nextHop->getOption(OPTION_RTPREFIX);
 
     // there should be option OPTION_RTPREFIX
-    ASSERT_TRUE(rtPrefix);
+    ASSERT_TRUE(rtPrefix != 0);
     EXPECT_TRUE(nextHop->isValid());
 
     EXPECT_EQ(1000, rtPrefix->getLifetime());
@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include "DHCPConst.h"
+#include "OptVendorSpecInfo.h"
+#include "OptGeneric.h"
+
+namespace {
+
+char expected[] = { 0, 17, 0, 14,      // OPTION_VENDOR_OPTS, length = 14
+                    0, 0, 0x11, 0x8b,  // enterprise-number = 4491
+                    0, 1, 0, 2, 'a', 'b',      // sub-option 1
+                    0, 2, 0, 0 };              // sub-option 2 (empty)
+
+TEST(OptVendorSpecInfoTest, storeSelf) {
+    char buf[128];
+
+    TOptVendorSpecInfo* opt = new TOptVendorSpecInfo(4491, 1, (char*)"ab", 2, NULL);
+    opt->addOption(new TOptGeneric(2, NULL));
+
+    ASSERT_EQ(18, opt->getSize());
+
+    char* ptr = opt->storeSelf(buf);
+    ASSERT_EQ(buf+18, ptr);
+
+    EXPECT_FALSE( memcmp(buf, expected, 18) );
+
+    delete opt;
+}
+
+TEST(OptVendorSpecInfoTest, parse) {
+    char buf[128];
+
+    TOptVendorSpecInfo* opt = new TOptVendorSpecInfo(OPTION_VENDOR_OPTS, expected+4, 14, NULL);
+
+    ASSERT_TRUE(opt->isValid());
+    EXPECT_EQ(4491u, opt->getVendor());
+    EXPECT_EQ(2, opt->countOption());
+
+    ASSERT_EQ(18, opt->getSize());
+    ASSERT_EQ(buf+18, opt->storeSelf(buf));
+    EXPECT_FALSE( memcmp(buf, expected, 18) );
+
+    delete opt;
+}
+
+}
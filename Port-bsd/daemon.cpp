@@ -12,6 +12,8 @@
 #include <string>
 #include <fstream>
 #include <signal.h>
+#include <string.h>
+#include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -191,6 +193,21 @@ int stop(const char * pidfile) {
     return 0;
 }
 
+/** asks running process to write its state files (see SIGUSR1 handler) */
+int dump(const char * pidfile) {
+    pid_t pid = getPID((char*)pidfile);
+    if (pid<0) {
+	cout << "Process is not running." << endl;
+	return -1;
+    }
+    cout << "Sending USR1 signal to process " << pid << endl;
+    if (-1 == kill(pid, SIGUSR1)) {
+	cout << "Signal sending failed: " << strerror(errno) << endl;
+	return -1;
+    }
+    return 0;
+}
+
 int install() {
     return 0;
 }
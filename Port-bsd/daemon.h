@@ -23,6 +23,7 @@
 
 int start(const char * pidfile, const char * workdir);
 int stop(const char * pidfile);
+int dump(const char * pidfile);
 
 int init(const char * pidfile, const char * workdir);
 int getPID(char * pidfile);
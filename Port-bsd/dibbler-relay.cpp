@@ -9,21 +9,29 @@
  *
  */
 
+#include <string.h>
 #include <signal.h>
+#include <stdlib.h>
 #include "DHCPRelay.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 #include "Logger.h"
 #include "daemon.h"
 
 using namespace std;
 
 TDHCPRelay * ptr;
+int workers = 0; // worker threads, set with -w
 
 void signal_handler(int n) {
     Log(Crit) << "Signal received. Shutting down." << LogEnd;
     ptr->stop();
 }
 
+void dump_handler(int n) {
+    ptr->requestDump();
+}
+
 int status() {
     int pid = getServerPID();
     if (pid==-1) {
@@ -60,10 +68,13 @@ int run() {
     if (ptr->isDone()) {
 	return -1;
     }
+    if (workers)
+	ptr->setWorkers(workers);
     
     // connect signals
     signal(SIGTERM, signal_handler);
     signal(SIGINT, signal_handler);
+    signal(SIGUSR1, dump_handler); // on-demand dump of state files
     
     ptr->run();
     
@@ -73,15 +84,17 @@ int run() {
 
 int help() {
     cout << "Usage:" << endl;
-    cout << " dibbler-relay ACTION" << endl
-	 << " ACTION = status|start|stop|install|uninstall|run" << endl
+    cout << " dibbler-relay ACTION [-w NUM]" << endl
+	 << " ACTION = status|start|stop|dump|install|uninstall|run" << endl
 	 << " status    - show status and exit" << endl
 	 << " start     - start installed service" << endl
 	 << " stop      - stop installed service" << endl
+	 << " dump      - write state files of running service" << endl
 	 << " install   - Not available in Linux/Unix systems." << endl
 	 << " uninstall - Not available in Linux/Unix systems." << endl
 	 << " run       - run in the console" << endl
-	 << " help      - displays usage info." << endl;
+	 << " help      - displays usage info." << endl
+	 << " -w NUM    - relay client messages in NUM worker threads (run, start)" << endl;
     return 0;
 }
 
@@ -102,6 +115,19 @@ int main(int argc, char * argv[])
     } else {
 	memset(command,0,256);
     }
+    for (int i=2; i<argc; i++) {
+	if (!strcmp(argv[i], "-w")) {
+	    char * end = 0;
+	    long val = (i+1<argc) ? strtol(argv[++i], &end, 10) : -1;
+	    if (!end || end==argv[i] || *end || val<0 || val>RELAY_MAX_WORKERS) {
+		cout << "Invalid number of worker threads: " << (end ? argv[i] : "(missing)")
+		     << " (allowed: 0-" << RELAY_MAX_WORKERS << ")" << endl;
+		logEnd();
+		return EXIT_FAILURE;
+	    }
+	    workers = val;
+	}
+    }
 
     if (!strncasecmp(command,"start",5) ) {
 	result = start(RELPID_FILE, WORKDIR);
@@ -112,6 +138,9 @@ int main(int argc, char * argv[])
     if (!strncasecmp(command,"stop",4)) {
 	result = stop(RELPID_FILE);
     } else
+    if (!strncasecmp(command,"dump",4)) {
+	result = dump(RELPID_FILE);
+    } else
     if (!strncasecmp(command,"status",6)) {
 	result = status();
     } else
@@ -12,6 +12,7 @@
 
 #include <signal.h>
 #include "DHCPServer.h"
+#include "SrvAddrMgr.h"
 #include "Portable.h"
 #include "Logger.h"
 #include "daemon.h"
@@ -25,6 +26,10 @@ void signal_handler(int n) {
     ptr->stop();
 }
 
+void dump_handler(int n) {
+    ptr->requestDump();
+}
+
 int status() {
     int pid = getServerPID();
     if (pid==-1) {
@@ -68,6 +73,7 @@ int run() {
     // connect signals
     signal(SIGTERM, signal_handler);
     signal(SIGINT, signal_handler);
+    signal(SIGUSR1, dump_handler); // on-demand dump of state files
     
     ptr->run();
 
@@ -79,13 +85,16 @@ int run() {
 int help() {
     cout << "Usage:" << endl;
     cout << " dibbler-server ACTION" << endl
-	 << " ACTION = status|start|stop|run" << endl
+	 << " ACTION = status|start|stop|dump|run|convert" << endl
 	 << " status    - show status and exit" << endl
 	 << " start     - start installed service" << endl
 	 << " stop      - stop installed service" << endl
+	 << " dump      - write state files of running service" << endl
 	 << " install   - Not available in Linux/Unix systems." << endl
 	 << " uninstall - Not available in Linux/Unix systems." << endl
 	 << " run       - run in the console" << endl
+	 << " convert SRC DST - convert lease database (files ending with .xml are" << endl
+	 << "             XML, other are binary, e.g. " << SRVADDRDB_FILE << ")" << endl
 	 << " help      - displays usage info." << endl;
     return 0;
 }
@@ -117,6 +126,16 @@ int main(int argc, char * argv[])
     if (!strncasecmp(command,"stop",4)) {
 	result = stop(SRVPID_FILE);
     } else
+    if (!strncasecmp(command,"dump",4)) {
+	result = dump(SRVPID_FILE);
+    } else
+    if (!strncasecmp(command,"convert",7)) {
+	if (argc != 4) {
+	    help();
+	} else {
+	    result = TSrvAddrMgr::convertDb(argv[2], argv[3]) ? 0 : -1;
+	}
+    } else
     if (!strncasecmp(command,"status",6)) {
 	result = status();
     } else
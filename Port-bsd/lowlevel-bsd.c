@@ -38,7 +38,9 @@
 
 // #define LOWLEVEL_DEBUG 0
 
-char Message[1024] = {0};
+/* last error, returned by error_message(); one per thread, as relay worker
+   threads send and receive on their own */
+static __thread char Message[1024] = {0};
 
 int lowlevelInit() {
     return LOWLEVEL_NO_ERROR;
@@ -393,6 +395,53 @@ int sock_send(int sock, char *addr, char *buf, int message_len, int port, int if
     return LOWLEVEL_NO_ERROR;
 }
 
+/*
+ * sends one datagram, given as bufCnt fragments, to addrCnt destinations
+ * (packed, 16 bytes each). Returns number of destinations the datagram was
+ * sent to or error code if nothing was sent.
+ */
+int sock_send_multi(int sock, char **addrs, int addrCnt, char **bufs, int *lens, int bufCnt,
+                    int port, int iface) {
+    struct sockaddr_in6 dst;
+    struct iovec iov[LOWLEVEL_MAX_IOV];
+    struct msghdr msg;
+    int i, sent = 0;
+
+    if (bufCnt > LOWLEVEL_MAX_IOV) {
+        sprintf(Message, "Unable to send data: too many fragments (%d)", bufCnt);
+        return LOWLEVEL_ERROR_UNSPEC;
+    }
+
+    for (i = 0; i < bufCnt; i++) {
+        iov[i].iov_base = bufs[i];
+        iov[i].iov_len = lens[i];
+    }
+
+    memset(&msg, 0, sizeof (msg));
+    msg.msg_name = &dst;
+    msg.msg_namelen = sizeof (struct sockaddr_in6);
+    msg.msg_iov = iov;
+    msg.msg_iovlen = bufCnt;
+
+    for (i = 0; i < addrCnt; i++) {
+        memset(&dst, 0, sizeof (struct sockaddr_in6));
+        dst.sin6_len = sizeof(struct sockaddr_in6);
+        dst.sin6_family = PF_INET6;
+        dst.sin6_port = htons(port);
+        memcpy(&dst.sin6_addr, addrs[i], 16);
+        dst.sin6_scope_id = iface;
+        if (sendmsg(sock, &msg, 0) < 0) {
+            sprintf(Message, "Unable to send data, error=%d", errno);
+            break;
+        }
+        sent++;
+    }
+
+    if (!sent && addrCnt)
+        return LOWLEVEL_ERROR_SOCKET;
+    return sent;
+}
+
 /*
  *
  */
@@ -556,3 +605,50 @@ void link_state_change_cleanup()
 {
     return;
 }
+
+/**
+ * asynchronous interface notifications (not supported, interfaces are polled)
+ */
+int iface_events_open()
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int iface_events_get(int fd, struct iface_event * events, int max)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+void iface_events_close(int fd)
+{
+    return;
+}
+
+/**
+ * server workers (SO_REUSEPORT steering is Linux-specific, server runs
+ * in a single process)
+ */
+int sock_steer(int fd, int count)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+unsigned int steer_key(const char * buf, int len)
+{
+    return 0;
+}
+
+int worker_spawn(int count)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int worker_check(void)
+{
+    return 0;
+}
+
+void worker_stop(void)
+{
+    return;
+}
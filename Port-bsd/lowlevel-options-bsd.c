@@ -17,8 +17,6 @@
 #define CR 0x0a
 #define LF 0x0d
 
-extern char * Message;
-
 /*
  * results 0 - ok
           -1 - unable to open temp. file
@@ -215,7 +215,13 @@ int stop(const char * pidfile) {
 	return -1;
     }
 
+#ifdef PTRACE_SEIZE
+    // unlike PTRACE_ATTACH, this does not stop the process. Stopped worker
+    // threads of a multi-threaded process (relay) would never be continued.
+    ptrace_failed = ptrace(PTRACE_SEIZE, pid, NULL, NULL);
+#else
     ptrace_failed = ptrace(PTRACE_ATTACH, pid, NULL, NULL);
+#endif
     if (ptrace_failed) {
 	saved_errno = errno;
 	cout << "Attaching to process " << pid << " failed: "
@@ -249,6 +255,21 @@ int stop(const char * pidfile) {
     return 0;
 }
 
+/** asks running process to write its state files (see SIGUSR1 handler) */
+int dump(const char * pidfile) {
+    pid_t pid = getPID((char*)pidfile);
+    if (pid<0) {
+	cout << "Process is not running." << endl;
+	return -1;
+    }
+    cout << "Sending USR1 signal to process " << pid << endl;
+    if (-1 == kill(pid, SIGUSR1)) {
+	cout << "Signal sending failed: " << strerror(errno) << endl;
+	return -1;
+    }
+    return 0;
+}
+
 int install() {
     return 0;
 }
@@ -41,6 +41,7 @@
 
 int start(const char * pidfile, const char * workdir);
 int stop(const char * pidfile);
+int dump(const char * pidfile);
 
 int init(const char * pidfile, const char * workdir);
 pid_t getPID(char * pidfile);
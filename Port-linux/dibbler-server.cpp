@@ -13,19 +13,26 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "DHCPServer.h"
+#include "SrvAddrMgr.h"
 #include "Portable.h"
 #include "Logger.h"
+#include "DHCPDefaults.h"
 #include "daemon.h"
 
 using namespace std;
 
 TDHCPServer * ptr = 0;
+int workers = 1; // worker processes, set with -w
 
 void signal_handler(int n) {
     Log(Crit) << "Signal received. Shutting down." << LogEnd;
     ptr->stop();
 }
 
+void dump_handler(int n) {
+    ptr->requestDump();
+}
+
 int status() {
     pid_t pid = getServerPID();
     if (pid==-1) {
@@ -58,36 +65,44 @@ int run() {
 	return -1;
     }
 
-    TDHCPServer srv(SRVCONF_FILE);
+    TDHCPServer srv(SRVCONF_FILE, workers);
     
     ptr = &srv;
     if (ptr->isDone()) {
-	die(SRVPID_FILE);
+	if (!ptr->getWorker())
+	    die(SRVPID_FILE);
 	return -1;
     }
     
     // connect signals
     signal(SIGTERM, signal_handler);
     signal(SIGINT, signal_handler);
+    signal(SIGUSR1, dump_handler); // on-demand dump of state files
     
     ptr->run();
 
-    die(SRVPID_FILE);
+    // pid file belongs to the main process
+    if (!ptr->getWorker())
+	die(SRVPID_FILE);
     return 0;
 }
 
 
 int help() {
     cout << "Usage:" << endl;
-    cout << " dibbler-server ACTION" << endl
-	 << " ACTION = status|start|stop|run" << endl
+    cout << " dibbler-server ACTION [-w NUM]" << endl
+	 << " ACTION = status|start|stop|dump|run|convert" << endl
 	 << " status    - show status and exit" << endl
 	 << " start     - start installed service" << endl
 	 << " stop      - stop installed service" << endl
+	 << " dump      - write state files of running service" << endl
 	 << " install   - Not available in Linux/Unix systems." << endl
 	 << " uninstall - Not available in Linux/Unix systems." << endl
 	 << " run       - run in the console" << endl
-	 << " help      - displays usage info." << endl;
+	 << " convert SRC DST - convert lease database (files ending with .xml are" << endl
+	 << "             XML, other are binary, e.g. " << SRVADDRDB_FILE << ")" << endl
+	 << " help      - displays usage info." << endl
+	 << " -w NUM    - serve clients in NUM worker processes (run, start)" << endl;
     return 0;
 }
 
@@ -108,6 +123,18 @@ int main(int argc, char * argv[])
     } else {
 	memset(command,0,256);
     }
+    for (int i=2; i<argc; i++) {
+	if (strcmp(argv[i], "-w"))
+	    continue;
+	char * end = 0;
+	long num = (i+1 < argc) ? strtol(argv[++i], &end, 10) : 0;
+	if (!end || end == argv[i] || *end || num < 1 || num > SERVER_MAX_WORKERS) {
+	    cout << "Invalid number of workers (-w): expected 1.." << SERVER_MAX_WORKERS << "." << endl;
+	    logEnd();
+	    return EXIT_FAILURE;
+	}
+	workers = (int)num;
+    }
 
     if (!strncasecmp(command,"start",5) ) {
 	result = start(SRVPID_FILE, WORKDIR);
@@ -118,6 +145,16 @@ int main(int argc, char * argv[])
     if (!strncasecmp(command,"stop",4)) {
 	result = stop(SRVPID_FILE);
     } else
+    if (!strncasecmp(command,"dump",4)) {
+	result = dump(SRVPID_FILE);
+    } else
+    if (!strncasecmp(command,"convert",7)) {
+	if (argc != 4) {
+	    help();
+	} else {
+	    result = TSrvAddrMgr::convertDb(argv[2], argv[3]) ? 0 : -1;
+	}
+    } else
     if (!strncasecmp(command,"status",6)) {
 	result = status();
     } else
@@ -34,6 +34,10 @@
 #include <fnmatch.h>
 #include <time.h>
 #include <errno.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <sys/prctl.h>
+#include <linux/filter.h>
 
 
 #include "libnetlink.h"
@@ -41,6 +45,7 @@
 #include "utils.h"
 #include "rt_names.h"
 #include "Portable.h"
+#include "DHCPConst.h"
 
 /*
 #define LOWLEVEL_DEBUG 1
@@ -50,12 +55,23 @@
 #define IPV6_RECVPKTINFO IPV6_PKTINFO
 #endif
 
+#ifndef SO_REUSEPORT
+#define SO_REUSEPORT 15
+#endif
+
+#ifndef SO_ATTACH_REUSEPORT_CBPF
+#define SO_ATTACH_REUSEPORT_CBPF 51
+#endif
+
 #define ADDROPER_DEL 0
 #define ADDROPER_ADD 1
 #define ADDROPER_UPDATE 2
 
 struct rtnl_handle rth;
-char Message[1024] = {0};
+
+/* last error, returned by error_message(); one per thread, as relay worker
+   threads send and receive on their own */
+static __thread char Message[1024] = {0};
 
 int lowlevelInit()
 {
@@ -286,6 +302,115 @@ void ipaddr_global_get(int *count, char **bufPtr, int ifindex, struct nlmsg_list
     *bufPtr = buf;
 }
 
+/**
+ * opens rtnetlink socket subscribed to link and IPv6 address changes
+ *
+ * @return socket descriptor (or negative error code)
+ */
+int iface_events_open()
+{
+    struct rtnl_handle evh;
+    int rcvbuf = 1024*1024; /* bursts on hosts with many VLANs are quite large */
+
+    memset(&evh, 0, sizeof(evh));
+    if (rtnl_open(&evh, RTMGRP_LINK | RTMGRP_IPV6_IFADDR) < 0) {
+	if (evh.fd > 0)
+	    close(evh.fd);
+	sprintf(Message, "Cannot open rtnetlink event socket\n");
+	return LOWLEVEL_ERROR_SOCKET;
+    }
+    setsockopt(evh.fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    fcntl(evh.fd, F_SETFL, fcntl(evh.fd, F_GETFL, 0) | O_NONBLOCK);
+
+    return evh.fd;
+}
+
+/**
+ * reads pending link/address notifications (does not block)
+ *
+ * @param fd socket descriptor returned by iface_events_open()
+ * @param events table to be filled with received events
+ * @param max size of the events table
+ *
+ * @return number of events stored, LOWLEVEL_ERROR_UNSPEC if some notifications
+ *         were lost (caller should re-read whole interface list) or
+ *         LOWLEVEL_ERROR_SOCKET on socket failure
+ */
+int iface_events_get(int fd, struct iface_event * events, int max)
+{
+    char buf[8192];
+    struct nlmsghdr *n;
+    struct rtattr * tb[IFA_MAX+1];
+    int len, cnt = 0, lost = 0;
+
+    while (cnt < max) {
+	len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT);
+	if (len < 0) {
+	    if (errno == EINTR)
+		continue;
+	    if (errno == EAGAIN || errno == EWOULDBLOCK)
+		break;
+	    if (errno == ENOBUFS) {
+		/* kernel dropped some notifications */
+		lost = 1;
+		continue;
+	    }
+	    sprintf(Message, "Failed to read rtnetlink events: %s\n", strerror(errno));
+	    return LOWLEVEL_ERROR_SOCKET;
+	}
+
+	for (n = (struct nlmsghdr*)buf; NLMSG_OK(n, len); n = NLMSG_NEXT(n, len)) {
+	    if (cnt == max) {
+		lost = 1;
+		break;
+	    }
+	    switch (n->nlmsg_type) {
+	    case RTM_NEWLINK:
+	    case RTM_DELLINK:
+	    {
+		struct ifinfomsg *ifi = NLMSG_DATA(n);
+		memset(&events[cnt], 0, sizeof(struct iface_event));
+		events[cnt].type  = (n->nlmsg_type==RTM_NEWLINK)?IFACE_EVENT_LINK:IFACE_EVENT_LINK_DEL;
+		events[cnt].id    = ifi->ifi_index;
+		events[cnt].flags = ifi->ifi_flags;
+		cnt++;
+		break;
+	    }
+	    case RTM_NEWADDR:
+	    case RTM_DELADDR:
+	    {
+		struct ifaddrmsg *ifa = NLMSG_DATA(n);
+		if (ifa->ifa_family != AF_INET6)
+		    break;
+		memset(tb, 0, sizeof(tb));
+		parse_rtattr(tb, IFA_MAX, IFA_RTA(ifa), n->nlmsg_len - NLMSG_LENGTH(sizeof(*ifa)));
+		if (!tb[IFA_ADDRESS])
+		    tb[IFA_ADDRESS] = tb[IFA_LOCAL];
+		if (!tb[IFA_ADDRESS])
+		    break;
+		memset(&events[cnt], 0, sizeof(struct iface_event));
+		events[cnt].type = (n->nlmsg_type==RTM_NEWADDR)?IFACE_EVENT_ADDR_ADD:IFACE_EVENT_ADDR_DEL;
+		events[cnt].id   = ifa->ifa_index;
+		memcpy(events[cnt].addr, RTA_DATA(tb[IFA_ADDRESS]), 16);
+		cnt++;
+		break;
+	    }
+	    default:
+		break;
+	    }
+	}
+    }
+
+    if (lost)
+	return LOWLEVEL_ERROR_UNSPEC;
+    return cnt;
+}
+
+void iface_events_close(int fd)
+{
+    close(fd);
+}
+
 /** 
  * adds, updates or deletes addresses to interface
  * 
@@ -452,6 +577,14 @@ int sock_add(char * ifacename,int ifaceid, char * addr, int port, int thisifaceo
 	}
     }
 
+    /* several server workers receive on the same address and port */
+    if (reuse==LOWLEVEL_REUSE_PORT) {
+	if (setsockopt(Insock, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) < 0)  {
+	    sprintf(Message, "Unable to set up socket option SO_REUSEPORT: %s", strerror(errno));
+	    return LOWLEVEL_ERROR_REUSE_FAILED;
+	}
+    }
+
     /* bind socket to a specified port */
     bzero(&bindme, sizeof(struct sockaddr_in6));
     bindme.sin6_family = AF_INET6;
@@ -517,6 +650,82 @@ int sock_send(int sock, char *addr, char *buf, int message_len, int port, int if
     return LOWLEVEL_NO_ERROR;
 }
 
+/*
+ * sends one datagram, given as bufCnt fragments (scatter-gather), to addrCnt
+ * destinations (packed, 16 bytes each). Fragments are never copied. When
+ * available, all destinations are sent with one sendmmsg() call.
+ * Returns number of destinations the datagram was sent to (less than addrCnt
+ * if sending stopped on error) or error code if nothing was sent.
+ */
+int sock_send_multi(int sock, char **addrs, int addrCnt, char **bufs, int *lens, int bufCnt,
+                    int port, int iface)
+{
+    struct sockaddr_in6 dst[LOWLEVEL_MAX_DESTS];
+    struct iovec iov[LOWLEVEL_MAX_IOV];
+    int i, sent = 0, result;
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14))
+    struct mmsghdr msgs[LOWLEVEL_MAX_DESTS];
+#else
+    struct msghdr msg;
+#endif
+
+    if (addrCnt > LOWLEVEL_MAX_DESTS || bufCnt > LOWLEVEL_MAX_IOV) {
+	sprintf(Message, "Unable to send data: too many destinations (%d) or fragments (%d)",
+		addrCnt, bufCnt);
+	return LOWLEVEL_ERROR_UNSPEC;
+    }
+
+    for (i = 0; i < bufCnt; i++) {
+	iov[i].iov_base = bufs[i];
+	iov[i].iov_len  = lens[i];
+    }
+
+    memset(dst, 0, sizeof(dst));
+    for (i = 0; i < addrCnt; i++) {
+	dst[i].sin6_family = AF_INET6;
+	dst[i].sin6_port   = htons(port);
+	memcpy(&dst[i].sin6_addr, addrs[i], 16);
+	if (IN6_IS_ADDR_LINKLOCAL(&dst[i].sin6_addr))
+	    dst[i].sin6_scope_id = iface;
+    }
+
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14))
+    memset(msgs, 0, sizeof(msgs));
+    for (i = 0; i < addrCnt; i++) {
+	msgs[i].msg_hdr.msg_name    = &dst[i];
+	msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in6);
+	msgs[i].msg_hdr.msg_iov     = iov;
+	msgs[i].msg_hdr.msg_iovlen  = bufCnt;
+    }
+    while (sent < addrCnt) {
+	result = sendmmsg(sock, msgs + sent, addrCnt - sent, 0);
+	if (result <= 0)
+	    break;
+	sent += result;
+    }
+#else
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_namelen = sizeof(struct sockaddr_in6);
+    msg.msg_iov     = iov;
+    msg.msg_iovlen  = bufCnt;
+    for (i = 0; i < addrCnt; i++) {
+	msg.msg_name = &dst[i];
+	result = sendmsg(sock, &msg, 0);
+	if (result < 0)
+	    break;
+	sent++;
+    }
+#endif
+
+    if (sent < addrCnt) {
+	char plain[48];
+	inet_ntop6(addrs[sent], plain);
+	sprintf(Message, "Unable to send data (dst addr: %s)", plain);
+	return sent ? sent : LOWLEVEL_ERROR_SOCKET;
+    }
+    return sent;
+}
+
 /*
  *
  */
@@ -566,6 +775,287 @@ int sock_recv(int fd, char * myPlainAddr, char * peerPlainAddr, char * buf, int
     return result;
 }
 
+/*
+ * Steering packets between server workers
+ *
+ * Workers bind the same addresses with SO_REUSEPORT. Kernel picks the socket
+ * (worker) for each unicast packet by running a classic BPF program, which
+ * walks down through RELAY-FORW messages to the client message, takes the last
+ * 4 bytes of its CLIENTID option (usually the end of MAC address), mixes them
+ * and returns (mixed key) % workers. Packets without CLIENTID (or truncated
+ * ones) go to the worker 0. Multicast packets are copied to all sockets
+ * instead, so workers filter them with steer_key(), which follows the same
+ * rules. Options and relay levels are searched only up to the limits below
+ * (BPF can't loop, program is unrolled).
+ */
+#define STEER_MAX_HOPS    4  /* relay levels searched for the client message */
+#define STEER_MAX_OPTIONS 16 /* options searched in each message */
+#define STEER_MIX         0x9E3779B1U
+
+/* emits option walk: looks for option code starting at X; when found, jumps
+   to the instruction following the walk (X points to the option), otherwise
+   returns 0 */
+static int steer_walk(struct sock_filter * f, int pos, int code)
+{
+    struct sock_filter ldCode = BPF_STMT(BPF_LD|BPF_H|BPF_IND, 0);
+    struct sock_filter ldLen  = BPF_STMT(BPF_LD|BPF_H|BPF_IND, 2);
+    struct sock_filter add4   = BPF_STMT(BPF_ALU|BPF_ADD|BPF_K, 4);
+    struct sock_filter addX   = BPF_STMT(BPF_ALU|BPF_ADD|BPF_X, 0);
+    struct sock_filter tax    = BPF_STMT(BPF_MISC|BPF_TAX, 0);
+    struct sock_filter ret0   = BPF_STMT(BPF_RET|BPF_K, 0);
+    int i;
+
+    for (i=0; i<STEER_MAX_OPTIONS; i++) {
+	struct sock_filter isCode = BPF_JUMP(BPF_JMP|BPF_JEQ|BPF_K, code, 0, 1);
+	struct sock_filter found  = BPF_STMT(BPF_JMP|BPF_JA, 7*(STEER_MAX_OPTIONS-i) - 2);
+	f[pos++] = ldCode;
+	f[pos++] = isCode;
+	f[pos++] = found;
+	f[pos++] = ldLen;   /* X = X + 4 + option length */
+	f[pos++] = add4;
+	f[pos++] = addX;
+	f[pos++] = tax;
+    }
+    f[pos++] = ret0;
+    return pos;
+}
+
+/* emits instructions that move X by k bytes */
+static int steer_skip(struct sock_filter * f, int pos, int k)
+{
+    struct sock_filter txa = BPF_STMT(BPF_MISC|BPF_TXA, 0);
+    struct sock_filter add = BPF_STMT(BPF_ALU|BPF_ADD|BPF_K, k);
+    struct sock_filter tax = BPF_STMT(BPF_MISC|BPF_TAX, 0);
+    f[pos++] = txa;
+    f[pos++] = add;
+    f[pos++] = tax;
+    return pos;
+}
+
+/**
+ * attaches packet steering program to a socket bound with SO_REUSEPORT
+ * (all sockets bound to the same address share the program)
+ *
+ * @param fd socket descriptor
+ * @param count number of workers (sockets in the group)
+ *
+ * @return 0 on success, negative error code otherwise
+ */
+int sock_steer(int fd, int count)
+{
+    struct sock_filter prog[(STEER_MAX_HOPS+1)*(2*7*STEER_MAX_OPTIONS+16) + 16];
+    struct sock_fprog fprog;
+    int toClientId[STEER_MAX_HOPS+1];
+    int hop, pos = 0, jump, i;
+
+    if (count < 1) {
+	sprintf(Message, "Invalid number of workers: %d", count);
+	return LOWLEVEL_ERROR_UNSPEC;
+    }
+
+    for (hop=0; hop<=STEER_MAX_HOPS; hop++) {
+	struct sock_filter ldType = BPF_STMT(BPF_LD|BPF_B|BPF_IND, 0);
+	prog[pos++] = ldType;
+	if (hop < STEER_MAX_HOPS) {
+	    /* relayed message: skip relay header, find RELAY_MSG, go one level down */
+	    struct sock_filter isRelay = BPF_JUMP(BPF_JMP|BPF_JEQ|BPF_K, RELAY_FORW_MSG, 1, 0);
+	    prog[pos++] = isRelay;
+	    jump = pos++; /* to client message */
+	    pos = steer_skip(prog, pos, 34);
+	    pos = steer_walk(prog, pos, OPTION_RELAY_MSG);
+	    pos = steer_skip(prog, pos, 4);
+	    {
+		struct sock_filter next = BPF_STMT(BPF_JMP|BPF_JA, 0);
+		prog[pos++] = next;
+	    }
+	    {
+		struct sock_filter toClient = BPF_STMT(BPF_JMP|BPF_JA, pos - jump - 1);
+		prog[jump] = toClient;
+	    }
+	    jump = pos - 1; /* to next level, patched below */
+	} else {
+	    /* too many relays */
+	    struct sock_filter isRelay = BPF_JUMP(BPF_JMP|BPF_JEQ|BPF_K, RELAY_FORW_MSG, 0, 1);
+	    struct sock_filter ret0 = BPF_STMT(BPF_RET|BPF_K, 0);
+	    prog[pos++] = isRelay;
+	    prog[pos++] = ret0;
+	    jump = -1;
+	}
+
+	/* client message: skip type and transaction-id, find CLIENTID */
+	pos = steer_skip(prog, pos, 4);
+	pos = steer_walk(prog, pos, OPTION_CLIENTID);
+	toClientId[hop] = pos++;
+
+	if (jump >= 0)
+	    prog[jump].k = pos - jump - 1;
+    }
+
+    for (i=0; i<=STEER_MAX_HOPS; i++) {
+	struct sock_filter ja = BPF_STMT(BPF_JMP|BPF_JA, pos - toClientId[i] - 1);
+	prog[toClientId[i]] = ja;
+    }
+
+    /* X points to CLIENTID option, key is the last word of DUID */
+    {
+	struct sock_filter tail[] = {
+	    BPF_STMT(BPF_LD|BPF_H|BPF_IND, 2),
+	    BPF_JUMP(BPF_JMP|BPF_JGE|BPF_K, 4, 1, 0),
+	    BPF_STMT(BPF_RET|BPF_K, 0),
+	    BPF_STMT(BPF_ALU|BPF_ADD|BPF_X, 0),
+	    BPF_STMT(BPF_MISC|BPF_TAX, 0),
+	    BPF_STMT(BPF_LD|BPF_W|BPF_IND, 0),
+	    BPF_STMT(BPF_ALU|BPF_MUL|BPF_K, STEER_MIX),
+	    BPF_STMT(BPF_ALU|BPF_RSH|BPF_K, 16),
+	    BPF_STMT(BPF_ALU|BPF_MOD|BPF_K, (unsigned int)count),
+	    BPF_STMT(BPF_RET|BPF_A, 0)
+	};
+	memcpy(prog + pos, tail, sizeof(tail));
+	pos += sizeof(tail)/sizeof(tail[0]);
+    }
+
+    fprog.len = pos;
+    fprog.filter = prog;
+    if (setsockopt(fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &fprog, sizeof(fprog)) < 0) {
+	sprintf(Message, "Unable to attach steering program: %s", strerror(errno));
+	return LOWLEVEL_ERROR_SOCK_OPTS;
+    }
+    return 0;
+}
+
+/**
+ * computes steering key of a received message (worker is key % workers),
+ * mirrors program attached by sock_steer()
+ *
+ * @param buf message (UDP payload)
+ * @param len message length
+ *
+ * @return steering key
+ */
+unsigned int steer_key(const char * buf, int len)
+{
+    const unsigned char * p = (const unsigned char *)buf;
+    int hop, i, x = 0, relay;
+    unsigned int code, optLen, key;
+
+    for (hop=0; hop<=STEER_MAX_HOPS; hop++) {
+	if (x >= len)
+	    return 0;
+	relay = (p[x] == RELAY_FORW_MSG);
+	if (relay && hop == STEER_MAX_HOPS)
+	    return 0;
+	x += relay ? 34 : 4;
+	code = relay ? OPTION_RELAY_MSG : OPTION_CLIENTID;
+
+	for (i=0; i<STEER_MAX_OPTIONS; i++) {
+	    if (x + 2 > len)
+		return 0;
+	    if ((unsigned int)(p[x]<<8 | p[x+1]) == code)
+		break;
+	    if (x + 4 > len)
+		return 0;
+	    x += 4 + (p[x+2]<<8 | p[x+3]);
+	}
+	if (i == STEER_MAX_OPTIONS)
+	    return 0;
+
+	if (relay) {
+	    x += 4;
+	    continue;
+	}
+
+	if (x + 4 > len)
+	    return 0;
+	optLen = p[x+2]<<8 | p[x+3];
+	if (optLen < 4)
+	    return 0;
+	x += optLen;
+	if (x + 4 > len)
+	    return 0;
+	key = (unsigned int)p[x]<<24 | p[x+1]<<16 | p[x+2]<<8 | p[x+3];
+	return ((key * STEER_MIX) & 0xffffffffU) >> 16;
+    }
+    return 0;
+}
+
+static pid_t * Workers = NULL;
+static int WorkersCnt = 0;
+
+/**
+ * forks server workers. Children are terminated when parent process dies.
+ *
+ * @param count total number of workers (including calling process)
+ *
+ * @return worker index (0 in the calling process) or negative error code
+ */
+int worker_spawn(int count)
+{
+    pid_t parent = getpid();
+    int i;
+
+    Workers = (pid_t*)calloc(count, sizeof(pid_t));
+    if (!Workers) {
+	sprintf(Message, "Out of memory");
+	return LOWLEVEL_ERROR_UNSPEC;
+    }
+    WorkersCnt = count;
+    Workers[0] = parent;
+
+    for (i=1; i<count; i++) {
+	pid_t pid = fork();
+	if (pid < 0) {
+	    sprintf(Message, "Unable to fork worker %d: %s", i, strerror(errno));
+	    worker_stop();
+	    return LOWLEVEL_ERROR_UNSPEC;
+	}
+	if (pid == 0) {
+	    free(Workers);
+	    Workers = NULL;
+	    WorkersCnt = 0;
+	    prctl(PR_SET_PDEATHSIG, SIGTERM);
+	    if (getppid() != parent) /* parent died before prctl() */
+		_exit(EXIT_FAILURE);
+	    return i;
+	}
+	Workers[i] = pid;
+    }
+    return 0;
+}
+
+/**
+ * checks if all workers are still running (called in the parent)
+ *
+ * @return index of a terminated worker or 0 if all are running
+ */
+int worker_check(void)
+{
+    int i, status;
+    for (i=1; i<WorkersCnt; i++) {
+	if (Workers[i] > 0 && waitpid(Workers[i], &status, WNOHANG) == Workers[i]) {
+	    Workers[i] = 0;
+	    return i;
+	}
+    }
+    return 0;
+}
+
+/**
+ * terminates workers and waits for them (called in the parent)
+ */
+void worker_stop(void)
+{
+    int i, status;
+    for (i=1; i<WorkersCnt; i++)
+	if (Workers[i] > 0)
+	    kill(Workers[i], SIGTERM);
+    for (i=1; i<WorkersCnt; i++)
+	if (Workers[i] > 0)
+	    waitpid(Workers[i], &status, 0);
+    free(Workers);
+    Workers = NULL;
+    WorkersCnt = 0;
+}
+
 void microsleep(int microsecs)
 {
     struct timespec x,y;
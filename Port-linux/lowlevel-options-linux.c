@@ -27,8 +27,6 @@
 #define MAX_LINE_LEN 511
 
 
-extern char * Message;
-
 /* in iproute.c, borrowed from iproute2 */
 extern int iproute_modify(int cmd, unsigned flags, int argc, char **argv);
 
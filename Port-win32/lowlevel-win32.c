@@ -453,6 +453,39 @@ int sock_send(int fd, char * addr, char * buf, int buflen, int port,int iface)
     return LOWLEVEL_NO_ERROR;
 }
 
+/*
+ * sends one datagram, given as bufCnt fragments, to addrCnt destinations
+ * (packed, 16 bytes each). Fragments are glued together first, as there
+ * is no scatter-gather send here. Returns number of destinations the
+ * datagram was sent to or error code if nothing was sent.
+ */
+int sock_send_multi(int fd, char ** addrs, int addrCnt, char ** bufs, int * lens, int bufCnt,
+                    int port, int iface)
+{
+    char buf[8192];
+    char plain[48];
+    int buflen = 0;
+    int i, sent = 0;
+
+    for (i=0; i<bufCnt; i++) {
+	if (buflen + lens[i] > (int)sizeof(buf))
+	    return LOWLEVEL_ERROR_UNSPEC;
+	memcpy(buf + buflen, bufs[i], lens[i]);
+	buflen += lens[i];
+    }
+
+    for (i=0; i<addrCnt; i++) {
+	inet_ntop6(addrs[i], plain);
+	if (sock_send(fd, plain, buf, buflen, port, iface) < 0)
+	    break;
+	sent++;
+    }
+
+    if (!sent && addrCnt)
+	return LOWLEVEL_ERROR_SOCKET;
+    return sent;
+}
+
 int sock_recv(int fd, char * myPlainAddr, char * peerPlainAddr, char * buf, int buflen)
 {
     struct sockaddr_in6 info;  
@@ -647,6 +680,71 @@ void link_state_change_cleanup()
    /// @todo: implement this
 }
 
+int iface_events_open()
+{
+    /// @todo: implement this (NotifyIpInterfaceChange)
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int iface_events_get(int fd, struct iface_event * events, int max)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+void iface_events_close(int fd)
+{
+}
+
+int ctrl_sock_open(const char * path)
+{
+    /// @todo: implement this (named pipe?)
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int ctrl_sock_serve(int fd, const char * buf, int len)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+void ctrl_sock_close(int fd, const char * path)
+{
+}
+
+int tcp_listen6(const char * addr, unsigned short port)
+{
+    /// @todo: implement this (winsock, ioctlsocket(FIONBIO))
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int tcp_accept(int fd, char * peerPlainAddr)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int tcp_connect6(const char * addr, unsigned short port)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int tcp_connected(int fd)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int tcp_send(int fd, const char * buf, int len)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int tcp_recv(int fd, char * buf, int len)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+void tcp_close(int fd)
+{
+}
+
 int execute(const char *filename, char * argv[], char *env[])
 {
     intptr_t i;
@@ -654,3 +752,164 @@ int execute(const char *filename, char * argv[], char *env[])
 
 	return i;
 }
+
+/* _spawnvpe(_P_NOWAIT) returns process handle, not pid. Handles of running
+   scripts are kept here, so pid can not be reused until script is checked. */
+#define EXECUTE_MAX_ASYNC 64
+static struct {
+    int pid;
+    HANDLE handle;
+} AsyncScripts[EXECUTE_MAX_ASYNC];
+
+/* returns slot of running script with given pid (0 = free slot) or -1 */
+static int execute_find(int pid)
+{
+    int i;
+    for (i = 0; i < EXECUTE_MAX_ASYNC; i++) {
+        if (AsyncScripts[i].pid == pid)
+            return i;
+    }
+    return -1;
+}
+
+int execute_async(const char *filename, const char * argv[], const char *env[])
+{
+    intptr_t handle;
+    int slot = execute_find(0);
+    if (slot < 0) {
+        /* too many scripts running, caller runs this one synchronously */
+        return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+    }
+    handle = _spawnvpe(_P_NOWAIT, filename, argv, env);
+    if (handle == -1)
+        return LOWLEVEL_ERROR_UNSPEC;
+    AsyncScripts[slot].handle = (HANDLE)handle;
+    AsyncScripts[slot].pid = GetProcessId((HANDLE)handle);
+    if (!AsyncScripts[slot].pid) {
+        /* unable to track it, wait for it like execute() does */
+        WaitForSingleObject((HANDLE)handle, INFINITE);
+        CloseHandle((HANDLE)handle);
+        AsyncScripts[slot].handle = NULL;
+        return LOWLEVEL_ERROR_UNSPEC;
+    }
+    return AsyncScripts[slot].pid;
+}
+
+int execute_check(int pid, int * exitCode)
+{
+    DWORD code;
+    int slot = pid ? execute_find(pid) : -1;
+    if (slot < 0)
+        return LOWLEVEL_ERROR_UNSPEC;
+    if (WaitForSingleObject(AsyncScripts[slot].handle, 0) == WAIT_TIMEOUT)
+        return 0;
+    *exitCode = GetExitCodeProcess(AsyncScripts[slot].handle, &code) ? (int)code : LOWLEVEL_ERROR_UNSPEC;
+    CloseHandle(AsyncScripts[slot].handle);
+    AsyncScripts[slot].handle = NULL;
+    AsyncScripts[slot].pid = 0;
+    return 1;
+}
+
+void execute_kill(int pid)
+{
+    int slot = pid ? execute_find(pid) : -1;
+    if (slot >= 0)
+        TerminateProcess(AsyncScripts[slot].handle, 1);
+}
+
+void * plugin_open(const char * path)
+{
+    return NULL;
+}
+
+void * plugin_symbol(void * handle, const char * name)
+{
+    return NULL;
+}
+
+void plugin_close(void * handle)
+{
+}
+
+char * file_map(const char * path, unsigned int * len)
+{
+    /// @todo: use CreateFileMapping(), file is simply read for now
+    char * buf;
+    long size;
+    FILE * f = fopen(path, "rb");
+    if (!f)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    if (size <= 0 || !(buf = (char*)malloc(size))) {
+        fclose(f);
+        return NULL;
+    }
+    if (fread(buf, 1, size, f) != (size_t)size) {
+        free(buf);
+        fclose(f);
+        return NULL;
+    }
+    fclose(f);
+    *len = size;
+    return buf;
+}
+
+void file_unmap(char * buf, unsigned int len)
+{
+    free(buf);
+}
+
+int file_write(const char * path, const char * buf, unsigned int len)
+{
+    FILE * f = fopen(path, "wb");
+    if (!f)
+        return LOWLEVEL_ERROR_FILE;
+    if (fwrite(buf, 1, len, f) != len || fflush(f) || _commit(_fileno(f))) {
+        fclose(f);
+        return LOWLEVEL_ERROR_FILE;
+    }
+    return fclose(f) ? LOWLEVEL_ERROR_FILE : LOWLEVEL_NO_ERROR;
+}
+
+unsigned long long now_ms(void)
+{
+    return GetTickCount();
+}
+
+int get_cpu_count(void)
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? info.dwNumberOfProcessors : 1;
+}
+
+void * shared_alloc(unsigned long len)
+{
+    return NULL;
+}
+
+int sock_steer(int fd, int count)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+unsigned int steer_key(const char * buf, int len)
+{
+    return 0;
+}
+
+int worker_spawn(int count)
+{
+    return LOWLEVEL_ERROR_NOT_IMPLEMENTED;
+}
+
+int worker_check(void)
+{
+    return 0;
+}
+
+void worker_stop(void)
+{
+}
@@ -19,13 +19,16 @@ using namespace std;
 #include "FlexLexer.h"
 #include "RelParser.h"
 #include "RelCfgMgr.h"
+#include "DHCPDefaults.h"
 
 int TRelCfgMgr::NextRelayID = RELAY_MIN_IFINDEX;
 
 TRelCfgMgr * TRelCfgMgr::Instance = 0;
 
 TRelCfgMgr::TRelCfgMgr(const std::string cfgFile, const std::string xmlFile)
-    :TCfgMgr(), XmlFile(xmlFile)
+    :TCfgMgr(), XmlFile(xmlFile), FailoverTimeout(RELAY_DEFAULT_FAILOVER_TIMEOUT),
+     FailoverRetry(RELAY_DEFAULT_FAILOVER_RETRY), FailoverCount(RELAY_DEFAULT_FAILOVER_COUNT),
+     Workers(RELAY_DEFAULT_WORKERS)
 {
     // load config file
     if (!this->parseConfigFile(cfgFile)) {
@@ -99,6 +102,10 @@ bool TRelCfgMgr::setupGlobalOpts(SPtr<TRelParsGlobalOpt> opt) {
 
     this->RemoteID         = opt->getRemoteID();
     this->Echo             = opt->getEcho();
+
+    this->FailoverTimeout  = opt->getFailoverTimeout();
+    this->FailoverRetry    = opt->getFailoverRetry();
+    this->FailoverCount    = opt->getFailoverCount();
     return true;
 }
 
@@ -256,6 +263,46 @@ SPtr<TRelOptEcho> TRelCfgMgr::getEcho()
     return Echo;
 }
 
+void TRelCfgMgr::setFailoverTimeout(unsigned int timeout)
+{
+    FailoverTimeout = timeout;
+}
+
+unsigned int TRelCfgMgr::getFailoverTimeout()
+{
+    return FailoverTimeout;
+}
+
+void TRelCfgMgr::setFailoverRetry(unsigned int retry)
+{
+    FailoverRetry = retry;
+}
+
+unsigned int TRelCfgMgr::getFailoverRetry()
+{
+    return FailoverRetry;
+}
+
+void TRelCfgMgr::setFailoverCount(unsigned int count)
+{
+    FailoverCount = count;
+}
+
+unsigned int TRelCfgMgr::getFailoverCount()
+{
+    return FailoverCount;
+}
+
+void TRelCfgMgr::setWorkers(int workers)
+{
+    Workers = workers;
+}
+
+int TRelCfgMgr::getWorkers()
+{
+    return Workers;
+}
+
 void TRelCfgMgr::instanceCreate( const std::string cfgFile, const std::string xmlFile )
 {
     if (Instance)
@@ -316,6 +363,10 @@ ostream & operator<<(ostream &out, TRelCfgMgr &x) {
     } else {
 	out << "  <!-- <EchoRequest/> -->" << endl;
     }
+    out << "  <FailoverTimeout>" << x.FailoverTimeout << "</FailoverTimeout>" << endl;
+    out << "  <FailoverRetry>" << x.FailoverRetry << "</FailoverRetry>" << endl;
+    out << "  <FailoverCount>" << x.FailoverCount << "</FailoverCount>" << endl;
+    out << "  <Workers>" << x.Workers << "</Workers>" << endl;
     
     SPtr<TRelCfgIface> ptrIface;
     x.firstIface();
@@ -53,6 +53,15 @@ public:
     SPtr<TOptVendorData> getRemoteID();
     SPtr<TRelOptEcho>     getEcho();
 
+    void setFailoverTimeout(unsigned int timeout);
+    unsigned int getFailoverTimeout();
+    void setFailoverRetry(unsigned int retry);
+    unsigned int getFailoverRetry();
+    void setFailoverCount(unsigned int count);
+    unsigned int getFailoverCount();
+    void setWorkers(int workers);
+    int getWorkers();
+
 private:
     static TRelCfgMgr * Instance;
     TRelCfgMgr(const std::string cfgFile, const std::string xmlFile);
@@ -75,6 +84,11 @@ private:
 
     SPtr<TOptVendorData> RemoteID;
     SPtr<TRelOptEcho> Echo;
+
+    unsigned int FailoverTimeout; // no reply for that long: server is down
+    unsigned int FailoverRetry;   // server down for that long: try it again
+    unsigned int FailoverCount;   // that many unanswered transactions in a row: server is down
+    int Workers;
 };
 
 #endif /* RELCONFMGR_H */
@@ -347,8 +347,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 40
-#define YY_END_OF_BUFFER 41
+#define YY_NUM_RULES 43
+#define YY_END_OF_BUFFER 44
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -356,52 +356,54 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[393] =
+static yyconst flex_int16_t yy_accept[419] =
     {   0,
-        1,    1,    0,    0,    0,    0,   41,   39,    2,    1,
-        1,   39,   22,   39,   39,   37,   37,   39,   39,   39,
-       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
-       39,   39,   39,   39,   39,   26,   26,   40,    1,    1,
-        1,    0,   34,   22,    0,   34,   24,   23,   37,    0,
-        0,   36,    0,   31,   35,   35,   35,   35,   35,   35,
-       35,   35,   35,   35,   35,   19,   35,   35,   35,   35,
-       35,   35,   35,   25,   23,   37,    0,    0,   30,   38,
-       29,   29,   35,   35,   35,   35,   35,   35,   35,   35,
-       35,   35,   35,   35,   35,   35,   35,   18,   37,    0,
-
-        0,    0,   28,   28,    0,   29,    0,   29,   35,   35,
-       35,   35,   35,   35,   35,   35,   35,   35,   35,   35,
-       20,   35,   35,   37,    0,    0,    0,    0,   28,    0,
-       28,    0,   29,   29,   29,   29,   35,   35,   35,   21,
-       35,    3,   35,   35,   35,   35,   35,   35,   35,   35,
-       35,   35,    0,    0,    0,    0,   28,   28,   28,   28,
-        0,   29,   29,   29,    0,   29,    4,   35,   35,   35,
-       35,   35,   35,   35,   11,   35,    5,   35,   35,    0,
-        0,    0,   28,   28,   28,    0,   28,    0,    0,   29,
-       29,   29,   29,   35,   35,   35,   35,   35,   35,   35,
-
-       35,    6,   35,    0,    0,    0,    0,    0,   28,   28,
-       28,   28,    0,   29,   29,   29,    0,   29,   35,   35,
-       35,   35,   16,   14,   35,   35,   17,    0,    0,    0,
-       28,   28,   28,    0,   28,   33,   29,   29,   29,   29,
-       35,   35,   35,   15,    7,   12,    0,    0,    0,   32,
-       28,   28,   28,   28,   29,   29,   29,    0,   29,   35,
-       10,   35,    0,    0,   28,   28,   28,    0,   28,   29,
-       29,   29,   29,   35,   35,    0,    0,    0,   28,   28,
-       28,   28,   29,   29,   29,    0,   29,   13,    8,    0,
-        0,   28,   28,   28,    0,   28,   29,   29,   29,   29,
-
-       35,    0,    0,    0,   28,   28,   28,   28,   29,   29,
-       29,    0,   29,   35,    0,   27,   30,   28,   28,   28,
-        0,   28,   29,   29,   29,   29,   35,    0,   27,    0,
-       28,   28,   28,   28,   28,   29,   29,   29,    0,   29,
-       35,   27,   30,   28,    0,   28,   28,   28,   28,   29,
-       29,   29,   35,   27,   28,   28,   28,   28,   29,   29,
-       29,    9,   28,   28,    0,   28,   28,   29,   28,   28,
-       29,   28,   28,    0,   28,   28,   28,   28,    0,   28,
-       28,   28,   28,    0,   28,   28,   28,   28,    0,   28,
-       28,    0
-
+        1,    1,    0,    0,    0,    0,   44,   42,    2,    1,
+        1,   42,   25,   42,   42,   40,   40,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   29,   29,   29,   43,    1,
+        1,    1,    0,   37,   25,    0,   37,   27,   26,   40,
+        0,    0,   39,    0,   34,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   22,   38,   38,   38,
+       38,   38,   38,   38,   28,    0,   26,   40,    0,    0,
+       33,   41,   32,   32,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+
+       21,   40,    0,    0,    0,   31,   31,    0,   32,    0,
+       32,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   23,   38,   38,   40,    0,    0,
+        0,    0,   31,    0,   31,    0,   32,   32,   32,   32,
+       38,   38,   38,   38,   24,   38,    3,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,    0,    0,    0,
+        0,   31,   31,   31,   31,    0,   32,   32,   32,    0,
+       32,    4,   38,   38,   38,   38,   38,   38,   38,   38,
+       11,   38,    5,   38,   38,    0,    0,    0,   31,   31,
+       31,    0,   31,    0,    0,   32,   32,   32,   32,   38,
+
+       38,   38,   38,   38,   38,   38,   38,   38,    6,   38,
+        0,    0,    0,    0,    0,   31,   31,   31,   31,    0,
+       32,   32,   32,    0,   32,   38,   38,   38,   38,   38,
+       19,   17,   38,   38,   20,    0,    0,    0,   31,   31,
+       31,    0,   31,   36,   32,   32,   32,   32,   38,   38,
+       38,   38,   18,    7,   12,    0,    0,    0,   35,   31,
+       31,   31,   31,   32,   32,   32,    0,   32,   38,   38,
+       38,   38,   10,   38,    0,    0,   31,   31,   31,    0,
+       31,   32,   32,   32,   32,   38,   38,   38,   38,   38,
+        0,    0,    0,   31,   31,   31,   31,   32,   32,   32,
+
+        0,   32,   13,   38,   38,   38,    8,    0,    0,   31,
+       31,   31,    0,   31,   32,   32,   32,   32,   38,   38,
+       38,   38,    0,    0,    0,   31,   31,   31,   31,   32,
+       32,   32,    0,   32,   16,   15,   38,   38,    0,   30,
+       33,   31,   31,   31,    0,   31,   32,   32,   32,   32,
+       38,   38,    0,   30,    0,   31,   31,   31,   31,   31,
+       32,   32,   32,    0,   32,   14,   38,   30,   33,   31,
+        0,   31,   31,   31,   31,   32,   32,   32,   38,   30,
+       31,   31,   31,   31,   32,   32,   32,    9,   31,   31,
+        0,   31,   31,   32,   31,   31,   32,   31,   31,    0,
+
+       31,   31,   31,   31,    0,   31,   31,   31,   31,    0,
+       31,   31,   31,   31,    0,   31,   31,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -438,138 +440,116 @@ static yyconst flex_int32_t yy_ec[256] =
 
 static yyconst flex_int32_t yy_meta[63] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    3,    4,
-        1,    5,    5,    6,    5,    5,    5,    5,    5,    5,
-        3,    7,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    8,    3,    5,
-        5,    5,    5,    5,    3,    7,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        8,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[518] =
+static yyconst flex_int16_t yy_base[419] =
     {   0,
-        0,    0, 1280, 1279,    0,    0, 1286, 1289, 1289,   60,
-       62, 1280,    0, 1277,   59,   59,   62, 1269,  112,  147,
-       52,   62,   54, 1268,   66,   69,   78,   85,   65,   90,
-      125,  143,   68,   93,  127, 1289, 1270, 1289,   87,  112,
-      139, 1275, 1289,    0, 1272, 1271, 1289,    0,  164, 1263,
-      126, 1289,    0,  137, 1262,  199, 1261,  124,  157,  125,
-      166,  167,  170,  178,  180, 1260,  187,  181,  206,  191,
-      199,  218,  214, 1289,    0,  223,  237, 1259,  221,    0,
-      242,  243,  272,  252,  246,  244,  248,  183,  253,  254,
-      260,  279,  251,  250,  287,  291,  285, 1258,  306,  307,
-
-     1257, 1256,  324,  268,  310,  329,  312,  297,  342,  317,
-      326,  330,  313,  337,  333,  349,  356,  352,  353,  375,
-     1255,  357,  381,  379,  393, 1254, 1253,  395,  399,  402,
-      364,  407,  414,  419,  422,  427, 1252,  382,  408, 1251,
-      429, 1250,  428,  430,  416,  436,  438,  432,  439,  433,
-      442,  443, 1249, 1248, 1247,  454,  477,  460,  482,  467,
-      487,  491, 1246,  496,  499,  470, 1245,  483,  493,  499,
-      457,  503,  501,  504, 1244,  445, 1243,  508,  509, 1242,
-     1241,  512,  517, 1240,  523,  528,  524,  536,  540,  545,
-      550,  556,  553,  540,  533,  558,  559,  560,  562,  563,
-
-      566, 1239,  568, 1238, 1237, 1236,  574,  578,  594,  583,
-      602,  607,  597,  612, 1235,  617,  620,  624,  604,  622,
-      623,  621, 1234, 1233,  614,  627, 1232, 1231, 1230,  631,
-      639, 1229,  644,  647,  636,  655,  662,  651,  667,  668,
-      669,  670,  676, 1228, 1227, 1226, 1225, 1224, 1223,  674,
-      681,  682,  687,  688,  693, 1222,  704,  696,  701,  690,
-     1221,  696, 1220, 1219,  712, 1218,  717,  708,  718,  723,
-      724,  735,  730,  725,  736, 1217, 1216, 1215,  743,  748,
-      751,  756,  759, 1214,  767,  729,  773, 1213,  775, 1212,
-     1211,  778, 1210,  783,  739,  784,  789,  790,  795,  796,
-
-      797, 1209, 1208, 1207,  802,  803,  808,  809,  815, 1206,
-      820,  755,  821,  810, 1205, 1204,    0,  826, 1203,  831,
-      762,  836,  841,  838,  846,  847,  848, 1202, 1201, 1200,
-     1199,  857,  854,  862, 1202,  866, 1197,  871,    0,  863,
-      868, 1196, 1289,  965,    0,  879,  939,  884,  916,  888,
-      885,    0,  872,  911,  910,  909,  893,  912,  900,  907,
-        0,  906,  905,  902,    0,  905, 1289,    0,  895,  894,
-     1289,  893,  874,    0,  849,  833,  823,  772,    0,  771,
-      762,  746,  659,    0,  649,  641,  606,  597,    0,  587,
-      584, 1289,  927,  935,  943,  951,  959,  963,  969,  977,
-
-      981,  984,  590,  587,  986,  989,  578,  992,  994,  997,
-      999, 1002, 1005,  556, 1007, 1009, 1012,  481, 1015, 1018,
-     1020, 1022, 1025, 1028, 1031,  473, 1033, 1035, 1038,  464,
-     1041, 1044, 1046, 1048, 1051, 1054, 1057,  457, 1059, 1061,
-     1064,  426, 1067, 1070, 1072, 1074, 1077, 1080, 1083,  418,
-     1085, 1087, 1090,  416, 1093, 1096, 1098, 1100, 1103, 1106,
-     1109,  397, 1111, 1113, 1116,  359, 1119, 1122, 1124, 1126,
-     1129, 1132, 1135,  345, 1137, 1139,  343, 1142,  292, 1145,
-     1148, 1150, 1152, 1155, 1158, 1160,  274, 1162, 1164,  271,
-     1167, 1169,  225, 1171, 1173, 1176,  197, 1177,  178,  130,
-
-     1179, 1181, 1183,  101, 1185, 1187, 1189,   98, 1191, 1193,
-     1195,   82, 1197, 1199, 1201,   80, 1203
+        0,    0,   62,    0,  124,    0,  187, 2791, 2791,  185,
+      187,  190,  252,  314,  369,  369,  340,  241,  416,  353,
+      373,  377,  467,  358,  376,  366,  363,  370,  370,  469,
+      471,  460,  465,  465,  476, 2791, 2791,  383, 2791,    0,
+        0,    0,    0, 2791,    0,    0,  390, 2791,  522,  573,
+      582,  393, 2791,  591,  624,    0,  633,    0,  473,  475,
+      631,  479,  572,  571,  617,  621,    0,  622,  631,  627,
+      625,  638,  631,  636, 2791,    0,    0,  678,  487,  687,
+      696,    0,  731,  491,  740,  691,  713,  728,  729,  730,
+      747,  747,  394,  734,  746,  747,  742,  751,  762,  762,
+
+        0,  796,  493,  805,  814,  849,  608,  617,  858,  867,
+      713,  900,  768,  399,  776,  853,  848,  878,  871,  896,
+      882,  885,  891,  887,    0,  752,  410,  410,  477,  937,
+      946,  659,  955,  988,  785,  508,  997,  794, 1006,  831,
+      605,  894,  937,  975,    0,  618,    0, 1007, 1014, 1006,
+      820, 1019, 1014, 1024, 1013, 1019, 1035,  641, 1066, 1075,
+      674, 1084,  840, 1117,  921,  675, 1049,  675, 1126, 1135,
+      926,    0, 1037, 1055, 1039, 1029, 1104, 1131, 1135, 1141,
+        0,  708,    0, 1130, 1142, 1178, 1187,  720, 1170,  710,
+     1196, 1229,  972,  725,  747, 1238,  981, 1247, 1060, 1179,
+
+     1220, 1245, 1251, 1257, 1258, 1264, 1252, 1263,    0, 1261,
+      775, 1302, 1311,  790,  788, 1320, 1101, 1353, 1110,  882,
+      828,  837, 1362, 1371, 1213, 1267,  879, 1316, 1357, 1359,
+        0,    0, 1364, 1374,    0, 1407, 1416, 1042,  913,  918,
+     1425, 1458, 1222,    0, 1467, 1286, 1476, 1293, 1420, 1480,
+     1462,  926,    0,    0,    0,  962, 1510, 1526,    0, 1543,
+     1299, 1559, 1337,  969,  988, 1576, 1592, 1397, 1480, 1495,
+     1514, 1517,    0, 1559, 1609, 1625, 1050, 1057, 1642, 1658,
+     1442, 1675, 1693, 1708, 1697, 1556, 1588, 1622, 1654, 1630,
+     1062, 1717, 1726, 1759, 1701, 1768, 1743, 1091, 1098, 1777,
+
+     1810, 1752,    0, 1661, 1676, 1772, 1112, 1819, 1828, 1157,
+     1158, 1861, 1870, 1794, 1879, 1845, 1912, 1854, 1706, 1794,
+     1855, 1864, 1160, 1921, 1930, 1963, 1896, 1972, 1905, 1172,
+     1174, 1981, 2014, 1947,    0,    0, 1900, 1963, 2023, 2032,
+     2065, 1178, 1203, 2074, 2083, 1956, 2116, 1998, 2125, 2007,
+     2003, 2070, 1210, 2134, 1229, 2167, 2176, 2049, 2185, 2058,
+     1270, 1280, 2218, 2227, 2109,    0, 2129, 2236, 2791, 2269,
+     2278, 1281, 1290, 2287, 2151, 2320, 2202, 2329, 2065, 1299,
+     2338, 2371, 2380, 2211, 1327, 1334, 2389,    0, 1342, 2422,
+     2431,    0, 2791, 2440, 2473, 2482, 2791, 1343, 2491, 2524,
+
+     2533, 2542, 1345, 2575, 2584, 2593, 2626, 1385, 2635, 2644,
+     2677, 2686, 1387, 2695, 1405, 2728, 1432, 2791
     } ;
 
-static yyconst flex_int16_t yy_def[518] =
+static yyconst flex_int16_t yy_def[419] =
     {   0,
-      392,    1,  393,  393,  394,  394,  392,  392,  392,  392,
-      392,  395,  396,  397,  392,  398,  398,  392,  399,  399,
-       20,   20,  399,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  399,  399,  399,  392,  392,  392,  392,  392,
-      392,  395,  392,  396,  397,  392,  392,  400,  401,  402,
-      401,  392,  403,  404,  399,   20,  399,  399,   56,   56,
-      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  399,  392,  400,  405,  405,  406,  407,  403,
-      408,  408,   56,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  399,  399,  399,  399,  399,  399,  409,  409,
-
-      410,  411,  412,  412,  392,  413,  414,  413,   56,  399,
-      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  399,  409,  124,  415,  416,  392,  417,  418,
-      417,  392,  419,  419,  420,  420,  109,  399,  399,  399,
-      399,  399,  399,  399,  399,  399,  399,  399,  399,  399,
-      399,  399,  392,  421,  422,  392,  423,  423,  424,  424,
-      392,  392,  392,  425,  426,  425,  399,  399,  399,  399,
-      399,  399,  399,  399,  399,  399,  399,  399,  399,  427,
-      428,  392,  392,  392,  429,  430,  429,  392,  392,  431,
-      431,  432,  432,  399,  399,  399,  399,  399,  399,  399,
-
-      399,  399,  399,  392,  433,  434,  392,  392,  435,  435,
-      436,  436,  392,  392,  392,  437,  438,  437,  399,  399,
-      399,  399,  399,  399,  399,  399,  399,  439,  440,  392,
-      392,  392,  441,  442,  441,  392,  443,  443,  444,  444,
-      399,  399,  399,  399,  399,  399,  392,  445,  446,  392,
-      447,  447,  448,  448,  392,  392,  449,  450,  449,  399,
-      399,  399,  451,  452,  392,  392,  453,  454,  453,  455,
-      455,  456,  456,  399,  399,  392,  457,  458,  459,  459,
-      460,  460,  392,  392,  461,  462,  461,  399,  399,  463,
-      464,  392,  392,  465,  466,  465,  467,  467,  468,  468,
-
-      399,  392,  469,  470,  471,  471,  472,  472,  392,  392,
-      473,  474,  473,  399,  475,  476,  477,  392,  392,  478,
-      479,  478,  480,  480,  481,  481,  399,  392,  482,  392,
-      483,  484,  484,  485,  485,  392,  392,  486,  487,  486,
-      399,  488,  392,  489,  490,  392,  392,  491,  491,  492,
-      492,  493,  399,  392,  494,  495,  496,  496,  392,  392,
-      497,  399,  392,  498,  499,  392,  392,  500,  501,  502,
-      392,  392,  503,  504,  505,  506,  392,  507,  508,  509,
-      510,  392,  511,  512,  513,  514,  392,  515,  516,  517,
-      392,    0,  392,  392,  392,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392
+      418,    1,  418,    3,  418,    5,  418,  418,  418,  418,
+       10,  418,  418,  418,  418,  418,   16,  418,   16,   19,
+       19,   19,   19,   23,   24,   24,   23,   24,   24,   24,
+       24,   24,   24,   24,   24,  418,  418,  418,  418,   10,
+       11,   10,   12,  418,   13,   14,  418,  418,  418,   17,
+      418,   50,  418,  418,  418,   24,   19,   24,   24,   57,
+       57,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       23,   24,   24,   24,  418,   14,   49,   17,   78,  418,
+      418,   54,  418,   83,   19,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+
+       24,   17,  102,   80,   51,  418,  106,  418,   83,  418,
+      109,   19,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,  102,  103,   80,
+      418,  418,  106,  418,  133,  108,   83,  137,   83,  139,
+      112,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,   24,   24,  418,  131,   51,
+      132,  106,  162,  106,  164,  418,  418,  418,  139,  418,
+      169,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,  131,  418,  418,  418,  418,
+      164,  418,  191,  166,  167,  139,  196,   83,  198,   24,
+
+       24,   24,   24,   24,   24,   24,   24,   24,   24,   24,
+      418,  187,   51,  188,  189,  164,  216,  106,  218,  418,
+      167,  418,  198,  418,  223,   23,   24,   24,   24,   24,
+       24,   24,   24,   24,   24,  187,  418,  418,  189,  418,
+      218,  418,  241,  220,  198,  245,   83,  247,   24,   24,
+       24,   24,   24,   24,   24,  418,  237,   51,  238,  218,
+      260,  106,  262,  167,  418,  247,  418,  266,   24,   24,
+       24,   24,   24,   24,  237,  418,  189,  418,  262,  418,
+      279,  247,  282,   83,  284,   24,   23,   24,   24,   24,
+      418,  276,   51,  262,  294,  106,  296,  167,  418,  284,
+
+      418,  300,   24,   24,   24,   24,   24,  276,  418,  189,
+      418,  296,  418,  312,  284,  315,   83,  317,   24,   24,
+       24,   24,  418,  309,  418,  296,  326,  106,  328,  167,
+      418,  317,  418,  332,   24,   24,   23,   24,  309,  418,
+      418,  189,  418,  328,  418,  344,  317,  347,   83,  349,
+       24,   24,  418,  340,  418,  418,  328,  357,  215,  359,
+      167,  418,  349,  418,  363,   24,   24,  340,  418,  356,
+      418,  189,  418,  215,  374,  349,  376,  418,   24,  418,
+      356,  418,  215,  383,  167,  418,  418,   24,  418,  382,
+      418,  215,  418,  418,  382,  418,  418,  418,  396,  418,
+
+      396,  418,  418,  402,  418,  402,  418,  418,  407,  418,
+      407,  418,  418,  412,  345,  412,  418,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[1352] =
+static yyconst flex_int16_t yy_nxt[2854] =
     {   0,
         8,    9,   10,   11,   12,   13,   14,    8,    8,    8,
        15,   16,   17,   18,   19,   19,   20,   19,   21,   22,
@@ -577,152 +557,317 @@ static yyconst flex_int16_t yy_nxt[1352] =
        24,   30,   31,   32,   33,   24,   34,   24,   35,   19,
        20,   19,   21,   22,   23,   24,   25,   24,   26,   27,
        28,   29,   24,   24,   30,   31,   32,   33,   24,   34,
-       24,   35,   39,   40,   41,   40,   47,  392,   59,   48,
-       49,   49,   50,   49,   49,   50,   60,   55,  392,  392,
-       52,  392,  392,   52,  335,   62,  386,   55,   61,   39,
-       40,  392,   59,   63,   67,   71,   53,   64,  392,  392,
-
-       55,   60,  381,  392,   52,  376,  392,   52,   68,   62,
-       55,   61,   65,   66,   41,   40,   63,   67,   71,   53,
-       64,   72,  392,   56,   56,   50,   56,   56,   56,   56,
-       56,   56,   68,   57,  371,   65,   66,  392,  392,   50,
-      392,   39,   40,   69,   72,   73,   84,   52,   81,   81,
-       86,   56,   56,   56,   56,   56,  392,   57,   56,   56,
-       50,   56,   56,   56,   56,   56,   56,   69,   57,   73,
-       84,   52,   58,   86,   70,   76,   76,   50,   85,  392,
-      392,   88,  370,  392,   87,   52,   56,   56,   56,   56,
-       56,  392,   57,  392,  392,   58,  392,   70,   90,  114,
-
-      392,  368,   85,   89,  392,   91,   88,   93,   87,   52,
-       83,   83,  392,   83,   83,   83,   83,   83,   83,  392,
-       92,   96,   90,  114,   55,   95,   89,  392,   91,  361,
-       93,  392,  103,  103,   99,   99,   50,   94,   83,   83,
-       83,   83,   83,   92,   52,   96,   98,   55,   95,   97,
-       50,  105,  392,  106,  106,  107,  107,  392,   52,  392,
-       94,  392,  116,  392,  392,  392,  392,  392,   52,   98,
-      110,  115,   97,  392,  111,  356,  112,  392,  352,  119,
-      113,  130,   52,  109,  109,  120,  109,  109,  109,  109,
-      109,  109,  392,  117,  110,  115,  335,  111,  392,  112,
-
-      392,  118,  119,  113,  392,  121,  392,  122,  120,  123,
-      107,  109,  109,  109,  109,  109,  117,  124,  124,   50,
-       50,  132,  132,  135,  135,  118,  392,   52,   52,  121,
-      392,  122,  123,  128,  139,  129,  129,  130,  105,  392,
-      133,  133,  107,  392,  138,  141,  392,  331,  140,  326,
-      392,   52,   52,  137,  137,  142,  137,  137,  137,  137,
-      137,  137,  392,  308,  143,  392,  392,  138,  141,  392,
-      392,  151,  140,  392,  144,  145,  146,  130,  147,  142,
-      148,  137,  137,  137,  137,  137,  149,  143,  392,  152,
-      124,  124,  392,  150,  392,  392,  151,  144,  145,  146,
-
-       52,  300,  147,  148,  125,  125,  156,  156,  128,  149,
-      157,  157,  130,  159,  159,  167,  161,  150,  132,  132,
-      282,  392,  273,  105,   52,  162,  162,  107,  392,  392,
-      254,  105,  107,  164,  164,  165,  392,  169,  167,  168,
-      165,  392,  392,  392,  172,  392,  392,  170,  171,  392,
-      173,  392,  392,  201,  174,  392,  392,  176,  392,  175,
-      179,  240,  168,  182,  177,  156,  156,  172,  212,  392,
-      392,  170,  171,  130,  178,  173,  392,  193,  174,  392,
-      186,  176,  175,  165,  179,  160,  128,  177,  183,  183,
-      130,  128,  197,  185,  185,  186,  392,  178,  188,  188,
-
-      105,  194,  189,  189,  107,  105,  392,  190,  190,  165,
-      192,  192,  392,  196,  392,  197,  392,  392,  200,  195,
-      198,  392,  392,  207,  207,  194,  128,  199,  208,  208,
-      130,  203,  128,  392,  209,  209,  186,  186,  196,  211,
-      211,  202,  195,  200,  198,  213,  392,  188,  188,  105,
-      199,  189,  189,  392,  105,  203,  214,  214,  165,  392,
-      136,  220,  392,  165,  202,  105,  217,  216,  216,  217,
-      219,  392,  392,  392,  221,  392,  392,  222,  223,  392,
-      224,  392,  104,  230,  220,  207,  207,  128,  226,  208,
-      208,   82,  392,  219,   80,  225,  186,  389,  221,  227,
-
-      389,  222,  223,  128,  224,  231,  231,  186,  236,  236,
-      389,  128,  226,  233,  233,  234,  392,  392,  225,  384,
-      234,  105,  227,  189,  189,  165,  105,  392,  237,  237,
-      217,  239,  239,  392,  392,  392,  392,  217,  241,  242,
-      392,  243,  250,  250,  246,  392,  244,  245,  128,  234,
-      208,  208,  186,  128,  389,  251,  251,  234,  253,  253,
-      392,  241,  384,  242,  217,  243,  236,  236,  246,  244,
-      245,  105,  384,  255,  255,  217,  105,  392,  257,  257,
-      258,  258,  392,  392,  262,  250,  250,  260,  261,  392,
-      128,  392,  265,  265,  234,  234,  128,  392,  267,  267,
-
-      268,  268,  105,  392,  189,  189,  217,  272,  272,  392,
-      392,  260,  261,  105,  258,  270,  270,  258,  275,  281,
-      281,  128,  274,  208,  208,  234,  128,  392,  279,  279,
-      268,  268,  105,  392,  283,  283,  258,  258,  392,  392,
-      299,  299,  275,  286,  105,  274,  285,  285,  286,  392,
-      307,  307,  128,  289,  292,  292,  268,  392,  288,  379,
-      128,  268,  294,  294,  295,  392,  325,  325,  105,  295,
-      189,  189,  258,  334,  334,  384,  105,  289,  297,  297,
-      286,  288,  392,  301,  379,  379,  286,  128,  392,  208,
-      208,  268,  128,  392,  305,  305,  295,  295,  105,  392,
-
-      309,  309,  286,  286,  105,  392,  311,  311,  312,  312,
-      392,  128,  392,  318,  318,  295,  295,  128,  392,  320,
-      320,  321,  321,  392,  105,  314,  189,  189,  286,  105,
-      392,  323,  323,  312,  312,  128,  374,  208,  208,  295,
-      128,  327,  332,  332,  321,  392,  379,  392,  314,  321,
-      105,  312,  336,  336,  312,  105,  392,  338,  338,  339,
-      339,  392,  374,  392,  327,  341,  128,  321,  346,  346,
-      321,  128,  392,  348,  348,  105,  339,  189,  189,  312,
-      105,  392,  350,  350,  339,  392,  353,  374,  128,  341,
-      208,  208,  321,  128,  392,  357,  357,  105,  339,  359,
-
-      359,  339,  128,  362,  366,  366,  365,  374,  365,  105,
-      353,  189,  189,  339,  128,  365,  208,  208,  345,  392,
-      339,  392,  365,  345,  330,  392,  362,   36,   36,   36,
-       36,   36,   36,   36,   36,   38,   38,   38,   38,   38,
-       38,   38,   38,   42,   42,   42,   42,   42,   42,   42,
-       42,   44,  321,   44,   44,   44,   44,   44,   44,   45,
-       45,   45,   45,   45,   45,   45,   45,   51,   51,   51,
-       51,   55,   55,   55,   55,   55,   55,   75,  345,   75,
-       75,   75,   75,   75,   75,   77,   77,   77,   78,   78,
-      100,  100,  100,  101,  101,  108,  108,  108,  125,  125,
-
-      125,  126,  126,  127,  127,  131,  131,  131,  134,  134,
-      134,  153,  153,  154,  154,  158,  158,  158,  163,  163,
-      163,  166,  166,  166,  180,  180,  181,  181,  184,  184,
-      184,  187,  187,  187,  191,  191,  191,  204,  204,  205,
-      205,  210,  210,  210,  215,  215,  215,  218,  218,  218,
-      228,  228,  229,  229,  232,  232,  232,  235,  235,  235,
-      238,  238,  238,  247,  247,  248,  248,  252,  252,  252,
-      256,  256,  256,  259,  259,  259,  263,  263,  264,  264,
-      266,  266,  266,  269,  269,  269,  271,  271,  271,  276,
-      276,  277,  277,  280,  280,  280,  284,  284,  284,  287,
-
-      287,  287,  290,  290,  291,  291,  293,  293,  293,  296,
-      296,  296,  298,  298,  298,  302,  302,  303,  303,  306,
-      306,  306,  310,  310,  310,  313,  313,  313,  315,  315,
-      316,  316,  319,  319,  319,  322,  322,  322,  324,  324,
-      324,  328,  328,  329,  329,  333,  333,  333,  337,  337,
-      337,  340,  340,  340,  342,  342,  344,  344,  347,  347,
-      347,  349,  349,  351,  351,  351,  354,  354,  355,  355,
-      358,  358,  360,  360,  360,  363,  363,  364,  364,  367,
-      367,  369,  369,  372,  372,  373,  373,  375,  375,  377,
-      377,  378,  378,  380,  380,  382,  382,  383,  383,  385,
-
-      385,  387,  387,  388,  388,  390,  390,  391,  391,  330,
-      312,  392,  345,  343,  330,  304,  295,  330,  304,  286,
-      317,  304,  278,  268,  304,  278,  392,  258,   79,  278,
-      249,  234,  278,  249,  392,  217,   79,  249,  206,  392,
-      392,  392,  186,  249,  206,  392,  392,  392,  165,   79,
-      206,  155,  392,  130,  206,  155,  392,  392,  392,  107,
-       79,  155,  102,  392,  392,  392,  155,  102,  392,   79,
-      102,  392,  102,  392,  392,  392,   79,   45,   46,   43,
-       74,  392,   54,   46,   43,  392,   37,   37,    7,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392
+       24,   35,   36,   36,   37,   36,   36,   36,   36,   38,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,   39,   39,   39,   39,
+       39,   39,   39,   39,   39,   39,  418,   40,   41,   42,
+       43,   43,   43,   43,   44,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   45,   45,   55,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   46,   46,   46,   46,   46,   46,
+       47,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   48,  418,   59,   49,
+       50,   50,   51,   52,   52,   52,   52,   52,   52,   60,
+       53,   61,   56,   75,   65,   63,   76,   66,   67,   68,
+
+      418,   59,  120,   64,   79,   79,   54,  143,   52,   52,
+       52,   52,   52,   60,   53,   56,   61,   65,  157,   63,
+       66,   67,   68,  418,   56,   56,   64,   57,   57,   54,
+       57,   57,   57,   57,   57,   57,   56,   58,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   57,   57,   57,   57,   57,
+       56,   58,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+      418,   56,   56,   56,   56,   56,   56,   69,   56,   70,
+      418,   71,   72,   73,   74,   86,   87,   90,  103,  103,
+
+      418,   62,  111,  111,  129,  129,   56,   56,   56,   56,
+       56,   69,   56,   70,   71,   72,   73,  166,   74,   86,
+       87,   90,   77,   77,   62,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   78,   78,   91,   79,   79,   79,
+       79,   79,   79,   80,   80,   81,   80,   80,   80,   80,
+
+       80,   80,   82,   82,   92,   82,   82,   82,   82,   82,
+       82,   91,   79,   79,   79,   79,   79,  418,  418,  135,
+      135,   80,   80,   80,   80,   80,  175,   92,  136,  136,
+       82,   82,   82,   82,   82,   83,   83,   93,   84,   84,
+       84,   84,   84,   84,   85,   85,   94,   85,   85,   85,
+       85,   85,   85,   88,  105,   95,   89,   96,   97,   98,
+       99,   93,  100,   84,   84,   84,   84,   84,  101,   94,
+      161,  161,   85,   85,   85,   85,   85,   88,   95,   89,
+       96,   97,   98,  188,   99,  100,  194,  194,  110,  102,
+      102,  101,  103,  103,  103,  103,  103,  103,  104,  104,
+
+      105,  104,  104,  104,  104,  104,  104,  106,  106,  113,
+      107,  107,  107,  107,  107,  107,  208,  103,  103,  103,
+      103,  103,  418,  134,  138,  138,  104,  104,  104,  104,
+      104,  214,  214,  113,  220,  107,  107,  107,  107,  107,
+      108,  114,  109,  109,  110,  111,  111,  111,  111,  111,
+      111,  112,  112,  115,  112,  112,  112,  112,  112,  112,
+      418,  116,  117,  118,  114,  119,  156,  121,  122,  125,
+      111,  111,  111,  111,  111,  123,  115,  124,  126,  112,
+      112,  112,  112,  112,  116,  117,  127,  118,  160,  119,
+      121,  156,  122,  125,  418,  142,  163,  163,  123,  238,
+
+      124,  418,  126,  418,  144,  168,  168,  128,  128,  127,
+      129,  129,  129,  129,  129,  129,  130,  130,  142,  130,
+      130,  130,  130,  130,  130,  131,  131,  144,  131,  131,
+      131,  131,  131,  131,  179,  129,  129,  129,  129,  129,
+      418,  170,  171,  171,  130,  130,  130,  130,  130,  418,
+      170,  190,  190,  131,  131,  131,  131,  131,  132,  179,
+      133,  133,  134,  135,  135,  135,  135,  135,  135,  137,
+      137,  145,  138,  138,  138,  138,  138,  138,  139,  139,
+      146,  140,  140,  140,  140,  140,  140,  250,  135,  135,
+      135,  135,  135,  244,  244,  145,  147,  138,  138,  138,
+
+      138,  138,  148,  146,  152,  155,  140,  140,  140,  140,
+      140,  141,  141,  153,  141,  141,  141,  141,  141,  141,
+      147,  149,  150,  151,  154,  148,  192,  172,  152,  155,
+      418,  192,  193,  193,  274,  418,  153,  197,  197,  141,
+      141,  141,  141,  141,  149,  150,  151,  154,  158,  158,
+      172,  158,  158,  158,  158,  158,  158,  159,  159,  160,
+      159,  159,  159,  159,  159,  159,  162,  162,  173,  163,
+      163,  163,  163,  163,  163,  213,  158,  158,  158,  158,
+      158,  418,  224,  217,  217,  159,  159,  159,  159,  159,
+      418,  173,  222,  222,  163,  163,  163,  163,  163,  164,
+
+      164,  224,  165,  165,  165,  165,  165,  165,  167,  167,
+      174,  168,  168,  168,  168,  168,  168,  169,  169,  170,
+      171,  171,  171,  171,  171,  171,  176,  165,  165,  165,
+      165,  165,  177,  174,  178,  180,  168,  168,  168,  168,
+      168,  181,  182,  203,  183,  171,  171,  171,  171,  171,
+      176,  184,  185,  259,  259,  200,  177,  178,  108,  180,
+      195,  195,  110,  242,  181,  202,  182,  183,  203,  418,
+      242,  225,  225,  201,  184,  258,  185,  186,  186,  200,
+      186,  186,  186,  186,  186,  186,  187,  187,  202,  187,
+      187,  187,  187,  187,  187,  189,  189,  201,  190,  190,
+
+      190,  190,  190,  190,  267,  186,  186,  186,  186,  186,
+      418,  267,  240,  240,  187,  187,  187,  187,  187,  418,
+      322,  243,  243,  190,  190,  190,  190,  190,  191,  191,
+      192,  193,  193,  193,  193,  193,  193,  196,  196,  204,
+      197,  197,  197,  197,  197,  197,  198,  198,  205,  199,
+      199,  199,  199,  199,  199,  207,  193,  193,  193,  193,
+      193,  206,  204,  209,  210,  197,  197,  197,  197,  197,
+      280,  280,  205,  293,  199,  199,  199,  199,  199,  132,
+      207,  215,  215,  134,  206,  301,  209,  301,  210,  211,
+      211,  313,  211,  211,  211,  211,  211,  211,  212,  212,
+
+      213,  212,  212,  212,  212,  212,  212,  216,  216,  226,
+      217,  217,  217,  217,  217,  217,  313,  211,  211,  211,
+      211,  211,  418,  325,  246,  246,  212,  212,  212,  212,
+      212,  418,  226,  261,  261,  217,  217,  217,  217,  217,
+      218,  218,  369,  219,  219,  219,  219,  219,  219,  221,
+      221,  227,  222,  222,  222,  222,  222,  222,  223,  223,
+      224,  225,  225,  225,  225,  225,  225,  229,  219,  219,
+      219,  219,  219,  228,  227,  230,  231,  222,  222,  222,
+      222,  222,  232,  333,  233,  234,  225,  225,  225,  225,
+      225,  229,  235,  333,  345,  418,  228,  265,  265,  230,
+
+      231,  249,  418,  345,  268,  268,  232,  233,  418,  234,
+      278,  278,  355,  236,  236,  235,  236,  236,  236,  236,
+      236,  236,  237,  237,  249,  237,  237,  237,  237,  237,
+      237,  239,  239,  251,  240,  240,  240,  240,  240,  240,
+      364,  236,  236,  236,  236,  236,  418,  364,  281,  281,
+      237,  237,  237,  237,  237,  371,  391,  251,  400,  240,
+      240,  240,  240,  240,  241,  241,  242,  243,  243,  243,
+      243,  243,  243,  245,  245,  252,  246,  246,  246,  246,
+      246,  246,  247,  247,  253,  248,  248,  248,  248,  248,
+      248,  255,  243,  243,  243,  243,  243,  254,  405,  252,
+
+      410,  246,  246,  246,  246,  246,  418,  253,  283,  283,
+      248,  248,  248,  248,  248,  255,  360,  360,  256,  256,
+      254,  256,  256,  256,  256,  256,  256,  257,  257,  258,
+      257,  257,  257,  257,  257,  257,  260,  260,  269,  261,
+      261,  261,  261,  261,  261,  415,  256,  256,  256,  256,
+      256,  418,    0,  295,  295,  257,  257,  257,  257,  257,
+        0,    0,  269,    0,  261,  261,  261,  261,  261,  262,
+      262,    0,  263,  263,  263,  263,  263,  263,  264,  264,
+      273,  265,  265,  265,  265,  265,  265,  266,  266,  267,
+      268,  268,  268,  268,  268,  268,  270,  263,  263,  263,
+
+      263,  263,    0,    0,  273,    0,  265,  265,  265,  265,
+      265,  271,  286,  272,    0,  268,  268,  268,  268,  268,
+      270,  275,  275,  287,  275,  275,  275,  275,  275,  275,
+        0,    0,  288,    0,  271,  286,  272,  276,  276,  289,
+      276,  276,  276,  276,  276,  276,  287,    0,    0,  275,
+      275,  275,  275,  275,  277,  277,  288,  278,  278,  278,
+      278,  278,  278,  289,    0,  276,  276,  276,  276,  276,
+      279,  279,  280,  281,  281,  281,  281,  281,  281,    0,
+        0,  290,  278,  278,  278,  278,  278,  282,  282,  303,
+      283,  283,  283,  283,  283,  283,    0,    0,  281,  281,
+
+      281,  281,  281,  284,  284,  290,  285,  285,  285,  285,
+      285,  285,  303,    0,    0,  283,  283,  283,  283,  283,
+      291,  291,  304,  291,  291,  291,  291,  291,  291,    0,
+        0,  285,  285,  285,  285,  285,  292,  292,  293,  292,
+      292,  292,  292,  292,  292,  304,    0,  307,  291,  291,
+      291,  291,  291,  294,  294,  305,  295,  295,  295,  295,
+      295,  295,    0,    0,  292,  292,  292,  292,  292,  296,
+      296,  307,  297,  297,  297,  297,  297,  297,  305,    0,
+      306,  295,  295,  295,  295,  295,  298,  298,  319,  299,
+      299,  299,  299,  299,  299,    0,    0,  297,  297,  297,
+
+      297,  297,  418,  306,  299,  299,  418,  320,  302,  302,
+      418,  319,  311,  311,  299,  299,  299,  299,  299,  300,
+      300,  301,  302,  302,  302,  302,  302,  302,  308,  308,
+      320,  308,  308,  308,  308,  308,  308,  309,  309,  335,
+      309,  309,  309,  309,  309,  309,    0,  302,  302,  302,
+      302,  302,  418,    0,  314,  314,  308,  308,  308,  308,
+      308,  418,  335,  316,  316,  309,  309,  309,  309,  309,
+      310,  310,    0,  311,  311,  311,  311,  311,  311,  312,
+      312,  313,  314,  314,  314,  314,  314,  314,  315,  315,
+      321,  316,  316,  316,  316,  316,  316,    0,  311,  311,
+
+      311,  311,  311,  418,    0,  327,  327,  314,  314,  314,
+      314,  314,    0,    0,  321,    0,  316,  316,  316,  316,
+      316,  317,  317,    0,  318,  318,  318,  318,  318,  318,
+      323,  323,  336,  323,  323,  323,  323,  323,  323,  324,
+      324,  325,  324,  324,  324,  324,  324,  324,    0,  318,
+      318,  318,  318,  318,  418,  336,  331,  331,  323,  323,
+      323,  323,  323,  418,    0,  334,  334,  324,  324,  324,
+      324,  324,  326,  326,    0,  327,  327,  327,  327,  327,
+      327,  328,  328,  337,  329,  329,  329,  329,  329,  329,
+      330,  330,  338,  331,  331,  331,  331,  331,  331,    0,
+
+      327,  327,  327,  327,  327,  418,  337,  343,  343,  329,
+      329,  329,  329,  329,  418,  338,  346,  346,  331,  331,
+      331,  331,  331,  332,  332,  333,  334,  334,  334,  334,
+      334,  334,  339,  339,  351,  339,  339,  339,  339,  339,
+      339,  340,  340,  341,  340,  340,  340,  340,  340,  340,
+        0,  334,  334,  334,  334,  334,  418,  351,  348,  348,
+      339,  339,  339,  339,  339,  418,    0,  358,  358,  340,
+      340,  340,  340,  340,  342,  342,    0,  343,  343,  343,
+      343,  343,  343,  344,  344,  345,  346,  346,  346,  346,
+      346,  346,  347,  347,  352,  348,  348,  348,  348,  348,
+
+      348,    0,  343,  343,  343,  343,  343,  418,    0,  362,
+      362,  346,  346,  346,  346,  346,  418,  352,  365,  365,
+      348,  348,  348,  348,  348,  349,  349,    0,  350,  350,
+      350,  350,  350,  350,  353,  353,  366,  353,  353,  353,
+      353,  353,  353,  354,  354,  355,  354,  354,  354,  354,
+      354,  354,    0,  350,  350,  350,  350,  350,  418,  366,
+      373,  373,  353,  353,  353,  353,  353,  418,    0,  375,
+      375,  354,  354,  354,  354,  354,  356,  356,    0,  356,
+      356,  356,  356,  356,  356,  357,  357,  367,  358,  358,
+      358,  358,  358,  358,  359,  359,  388,  360,  360,  360,
+
+      360,  360,  360,    0,  356,  356,  356,  356,  356,    0,
+        0,  367,    0,  358,  358,  358,  358,  358,  418,  388,
+      377,  377,  360,  360,  360,  360,  360,  361,  361,    0,
+      362,  362,  362,  362,  362,  362,  363,  363,  364,  365,
+      365,  365,  365,  365,  365,  368,  368,  379,  368,  368,
+      368,  368,  368,  368,    0,  362,  362,  362,  362,  362,
+      418,    0,  384,  384,  365,  365,  365,  365,  365,    0,
+        0,  379,    0,  368,  368,  368,  368,  368,  370,  370,
+      371,  370,  370,  370,  370,  370,  370,  372,  372,    0,
+      373,  373,  373,  373,  373,  373,  374,  374,    0,  375,
+
+      375,  375,  375,  375,  375,    0,  370,  370,  370,  370,
+      370,  418,    0,  386,  386,  373,  373,  373,  373,  373,
+      418,    0,  393,  393,  375,  375,  375,  375,  375,  376,
+      376,    0,  377,  377,  377,  377,  377,  377,  378,  378,
+        0,  378,  378,  378,  378,  378,  378,  380,  380,    0,
+      380,  380,  380,  380,  380,  380,    0,  377,  377,  377,
+      377,  377,    0,    0,    0,    0,  378,  378,  378,  378,
+      378,    0,    0,    0,    0,  380,  380,  380,  380,  380,
+      381,  381,    0,  381,  381,  381,  381,  381,  381,  382,
+      382,    0,  382,  382,  382,  382,  382,  382,  383,  383,
+
+        0,  384,  384,  384,  384,  384,  384,    0,  381,  381,
+      381,  381,  381,    0,    0,    0,    0,  382,  382,  382,
+      382,  382,    0,    0,    0,    0,  384,  384,  384,  384,
+      384,  385,  385,    0,  386,  386,  386,  386,  386,  386,
+      387,  387,    0,  387,  387,  387,  387,  387,  387,  389,
+      389,    0,  389,  389,  389,  389,  389,  389,    0,  386,
+      386,  386,  386,  386,    0,    0,    0,    0,  387,  387,
+      387,  387,  387,    0,    0,    0,    0,  389,  389,  389,
+      389,  389,  390,  390,  391,  390,  390,  390,  390,  390,
+      390,  392,  392,    0,  393,  393,  393,  393,  393,  393,
+
+      394,  394,    0,  394,  394,  394,  394,  394,  394,    0,
+      390,  390,  390,  390,  390,    0,    0,    0,    0,  393,
+      393,  393,  393,  393,    0,    0,    0,    0,  394,  394,
+      394,  394,  394,  395,  395,    0,  395,  395,  395,  395,
+      395,  395,  396,  396,    0,  396,  396,  396,  396,  396,
+      396,  397,  397,    0,  397,  397,  397,  397,  397,  397,
+        0,  395,  395,  395,  395,  395,    0,    0,    0,    0,
+      396,  396,  396,  396,  396,    0,    0,    0,    0,  397,
+      397,  397,  397,  397,  398,  398,    0,  398,  398,  398,
+      398,  398,  398,  399,  399,  400,  399,  399,  399,  399,
+
+      399,  399,  401,  401,    0,  401,  401,  401,  401,  401,
+      401,    0,  398,  398,  398,  398,  398,    0,    0,    0,
+        0,  399,  399,  399,  399,  399,    0,    0,    0,    0,
+      401,  401,  401,  401,  401,  402,  402,    0,  402,  402,
+      402,  402,  402,  402,  403,  403,    0,  403,  403,  403,
+      403,  403,  403,  404,  404,  405,  404,  404,  404,  404,
+      404,  404,    0,  402,  402,  402,  402,  402,    0,    0,
+        0,    0,  403,  403,  403,  403,  403,    0,    0,    0,
+        0,  404,  404,  404,  404,  404,  406,  406,    0,  406,
+      406,  406,  406,  406,  406,  407,  407,    0,  407,  407,
+
+      407,  407,  407,  407,  408,  408,    0,  408,  408,  408,
+      408,  408,  408,    0,  406,  406,  406,  406,  406,    0,
+        0,    0,    0,  407,  407,  407,  407,  407,    0,    0,
+        0,    0,  408,  408,  408,  408,  408,  409,  409,  410,
+      409,  409,  409,  409,  409,  409,  411,  411,    0,  411,
+      411,  411,  411,  411,  411,  412,  412,    0,  412,  412,
+      412,  412,  412,  412,    0,  409,  409,  409,  409,  409,
+        0,    0,    0,    0,  411,  411,  411,  411,  411,    0,
+        0,    0,    0,  412,  412,  412,  412,  412,  413,  413,
+        0,  413,  413,  413,  413,  413,  413,  414,  414,  415,
+
+      414,  414,  414,  414,  414,  414,  416,  416,    0,  416,
+      416,  416,  416,  416,  416,    0,  413,  413,  413,  413,
+      413,    0,    0,    0,    0,  414,  414,  414,  414,  414,
+        0,    0,    0,    0,  416,  416,  416,  416,  416,  417,
+      417,    0,  417,  417,  417,  417,  417,  417,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  417,  417,  417,
+      417,  417,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        7,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418
     } ;
 
-static yyconst flex_int16_t yy_chk[1352] =
+static yyconst flex_int16_t yy_chk[2854] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -730,157 +875,322 @@ static yyconst flex_int16_t yy_chk[1352] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,   10,   10,   11,   11,   15,   23,   21,   15,
-       16,   16,   16,   17,   17,   17,   22,   21,   29,   25,
-       16,   33,   26,   17,  516,   25,  512,   22,   23,   39,
-       39,   27,   21,   25,   29,   33,   16,   26,   28,   17,
-
-       21,   22,  508,   30,   16,  504,   34,   17,   30,   25,
-       22,   23,   27,   28,   40,   40,   25,   29,   33,   16,
-       26,   34,   17,   19,   19,   19,   19,   19,   19,   19,
-       19,   19,   30,   19,  500,   27,   28,   58,   31,   51,
-       35,   41,   41,   31,   34,   35,   58,   51,   54,   54,
-       60,   19,   19,   19,   19,   19,   32,   19,   20,   20,
-       20,   20,   20,   20,   20,   20,   20,   31,   20,   35,
-       58,   51,   20,   60,   32,   49,   49,   49,   59,   61,
-       62,   62,  499,   63,   61,   49,   20,   20,   20,   20,
-       20,   64,   20,   65,   68,   20,   88,   32,   64,   88,
-
-       67,  497,   59,   63,   70,   65,   62,   68,   61,   49,
-       56,   56,   71,   56,   56,   56,   56,   56,   56,   69,
-       67,   71,   64,   88,   56,   70,   63,   73,   65,  493,
-       68,   72,   79,   79,   76,   76,   76,   69,   56,   56,
-       56,   56,   56,   67,   76,   71,   73,   56,   70,   72,
-       77,   81,   82,   81,   81,   81,   82,   86,   77,   85,
-       69,   87,   90,   94,   93,   84,   89,   90,   76,   73,
-       84,   89,   72,   91,   85,  490,   86,  104,  487,   93,
-       87,  104,   77,   83,   83,   94,   83,   83,   83,   83,
-       83,   83,   92,   91,   84,   89,  479,   85,   97,   86,
-
-       95,   92,   93,   87,   96,   95,  108,   96,   94,   97,
-      108,   83,   83,   83,   83,   83,   91,   99,   99,   99,
-      100,  105,  105,  107,  107,   92,  113,   99,  100,   95,
-      110,   96,   97,  103,  111,  103,  103,  103,  106,  111,
-      106,  106,  106,  112,  110,  113,  115,  477,  112,  474,
-      114,   99,  100,  109,  109,  114,  109,  109,  109,  109,
-      109,  109,  116,  466,  115,  118,  119,  110,  113,  117,
-      122,  122,  112,  131,  116,  116,  116,  131,  117,  114,
-      118,  109,  109,  109,  109,  109,  119,  115,  120,  123,
-      124,  124,  124,  120,  123,  138,  122,  116,  116,  116,
-
-      124,  462,  117,  118,  125,  125,  128,  128,  129,  119,
-      129,  129,  129,  130,  130,  138,  132,  120,  132,  132,
-      454,  139,  450,  133,  124,  133,  133,  133,  134,  145,
-      442,  135,  134,  135,  135,  135,  136,  141,  138,  139,
-      136,  143,  141,  144,  145,  148,  150,  143,  144,  146,
-      146,  147,  149,  176,  147,  151,  152,  149,  176,  148,
-      152,  438,  139,  156,  150,  156,  156,  145,  430,  158,
-      171,  143,  144,  158,  151,  146,  160,  426,  147,  166,
-      160,  149,  148,  166,  152,  418,  157,  150,  157,  157,
-      157,  159,  171,  159,  159,  159,  168,  151,  161,  161,
-
-      162,  168,  162,  162,  162,  164,  169,  164,  164,  164,
-      165,  165,  170,  170,  173,  171,  172,  174,  174,  169,
-      172,  178,  179,  182,  182,  168,  183,  173,  183,  183,
-      183,  179,  185,  187,  185,  185,  185,  187,  170,  186,
-      186,  178,  169,  174,  172,  188,  195,  188,  188,  189,
-      173,  189,  189,  194,  190,  179,  190,  190,  190,  191,
-      414,  195,  193,  191,  178,  192,  193,  192,  192,  192,
-      194,  196,  197,  198,  196,  199,  200,  197,  198,  201,
-      199,  203,  407,  207,  195,  207,  207,  208,  201,  208,
-      208,  404,  210,  194,  403,  200,  210,  391,  196,  203,
-
-      390,  197,  198,  209,  199,  209,  209,  209,  213,  213,
-      388,  211,  201,  211,  211,  211,  212,  219,  200,  387,
-      212,  214,  203,  214,  214,  214,  216,  225,  216,  216,
-      216,  217,  217,  218,  222,  220,  221,  218,  219,  220,
-      226,  221,  230,  230,  226,  235,  222,  225,  231,  235,
-      231,  231,  231,  233,  386,  233,  233,  233,  234,  234,
-      238,  219,  385,  220,  238,  221,  236,  236,  226,  222,
-      225,  237,  383,  237,  237,  237,  239,  240,  239,  239,
-      239,  240,  241,  242,  243,  250,  250,  241,  242,  243,
-      251,  252,  251,  251,  251,  252,  253,  254,  253,  253,
-
-      253,  254,  255,  260,  255,  255,  255,  258,  258,  262,
-      259,  241,  242,  257,  259,  257,  257,  257,  262,  268,
-      268,  265,  260,  265,  265,  265,  267,  269,  267,  267,
-      267,  269,  270,  271,  270,  270,  270,  271,  274,  273,
-      286,  286,  262,  273,  272,  260,  272,  272,  272,  275,
-      295,  295,  279,  275,  279,  279,  279,  280,  274,  382,
-      281,  280,  281,  281,  281,  282,  312,  312,  283,  282,
-      283,  283,  283,  321,  321,  381,  285,  275,  285,  285,
-      285,  274,  287,  289,  380,  378,  287,  292,  289,  292,
-      292,  292,  294,  296,  294,  294,  294,  296,  297,  298,
-
-      297,  297,  297,  298,  299,  300,  299,  299,  299,  300,
-      301,  305,  306,  305,  305,  305,  306,  307,  308,  307,
-      307,  307,  308,  314,  309,  301,  309,  309,  309,  311,
-      313,  311,  311,  311,  313,  318,  377,  318,  318,  318,
-      320,  314,  320,  320,  320,  322,  376,  324,  301,  322,
-      323,  324,  323,  323,  323,  325,  326,  325,  325,  325,
-      326,  327,  375,  333,  314,  327,  332,  333,  332,  332,
-      332,  334,  340,  334,  334,  336,  340,  336,  336,  336,
-      338,  341,  338,  338,  338,  353,  341,  373,  346,  327,
-      346,  346,  346,  348,  351,  348,  348,  350,  351,  350,
-
-      350,  350,  357,  353,  357,  357,  372,  370,  369,  359,
-      341,  359,  359,  359,  366,  364,  366,  366,  363,  362,
-      360,  358,  356,  355,  354,  349,  353,  393,  393,  393,
-      393,  393,  393,  393,  393,  394,  394,  394,  394,  394,
-      394,  394,  394,  395,  395,  395,  395,  395,  395,  395,
-      395,  396,  347,  396,  396,  396,  396,  396,  396,  397,
-      397,  397,  397,  397,  397,  397,  397,  398,  398,  398,
-      398,  399,  399,  399,  399,  399,  399,  400,  344,  400,
-      400,  400,  400,  400,  400,  401,  401,  401,  402,  402,
-      405,  405,  405,  406,  406,  408,  408,  408,  409,  409,
-
-      409,  410,  410,  411,  411,  412,  412,  412,  413,  413,
-      413,  415,  415,  416,  416,  417,  417,  417,  419,  419,
-      419,  420,  420,  420,  421,  421,  422,  422,  423,  423,
-      423,  424,  424,  424,  425,  425,  425,  427,  427,  428,
-      428,  429,  429,  429,  431,  431,  431,  432,  432,  432,
-      433,  433,  434,  434,  435,  435,  435,  436,  436,  436,
-      437,  437,  437,  439,  439,  440,  440,  441,  441,  441,
-      443,  443,  443,  444,  444,  444,  445,  445,  446,  446,
-      447,  447,  447,  448,  448,  448,  449,  449,  449,  451,
-      451,  452,  452,  453,  453,  453,  455,  455,  455,  456,
-
-      456,  456,  457,  457,  458,  458,  459,  459,  459,  460,
-      460,  460,  461,  461,  461,  463,  463,  464,  464,  465,
-      465,  465,  467,  467,  467,  468,  468,  468,  469,  469,
-      470,  470,  471,  471,  471,  472,  472,  472,  473,  473,
-      473,  475,  475,  476,  476,  478,  478,  478,  480,  480,
-      480,  481,  481,  481,  482,  482,  483,  483,  484,  484,
-      484,  485,  485,  486,  486,  486,  488,  488,  489,  489,
-      491,  491,  492,  492,  492,  494,  494,  495,  495,  496,
-      496,  498,  498,  501,  501,  502,  502,  503,  503,  505,
-      505,  506,  506,  507,  507,  509,  509,  510,  510,  511,
-
-      511,  513,  513,  514,  514,  515,  515,  517,  517,  342,
-      337,  335,  331,  330,  329,  328,  319,  316,  315,  310,
-      304,  303,  302,  293,  291,  290,  288,  284,  278,  277,
-      276,  266,  264,  263,  261,  256,  249,  248,  247,  246,
-      245,  244,  232,  229,  228,  227,  224,  223,  215,  206,
-      205,  204,  202,  184,  181,  180,  177,  175,  167,  163,
-      155,  154,  153,  142,  140,  137,  127,  126,  121,  102,
-      101,   98,   78,   66,   57,   55,   50,   46,   45,   42,
-       37,   24,   18,   14,   12,    7,    4,    3,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392,  392,  392,  392,  392,  392,  392,  392,  392,  392,
-      392
+        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    7,   10,   10,   11,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   13,   13,   18,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   15,   17,   20,   15,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   21,
+       16,   22,   24,   38,   26,   25,   47,   27,   28,   29,
+
+       17,   20,   93,   25,   52,   52,   16,  114,   16,   16,
+       16,   16,   16,   21,   16,   24,   22,   26,  127,   25,
+       27,   28,   29,  128,   19,   19,   25,   19,   19,   16,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   30,   23,   31,
+      129,   32,   33,   34,   35,   59,   60,   62,   79,   79,
+
+       84,   23,   84,   84,  103,  103,   23,   23,   23,   23,
+       23,   30,   23,   31,   32,   33,   34,  136,   35,   59,
+       60,   62,   49,   49,   23,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   50,   50,   63,   50,   50,   50,
+       50,   50,   50,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   54,   54,   64,   54,   54,   54,   54,   54,
+       54,   63,   50,   50,   50,   50,   50,  107,  141,  107,
+      107,   51,   51,   51,   51,   51,  146,   64,  108,  108,
+       54,   54,   54,   54,   54,   55,   55,   65,   55,   55,
+       55,   55,   55,   55,   57,   57,   66,   57,   57,   57,
+       57,   57,   57,   61,  158,   68,   61,   69,   70,   71,
+       72,   65,   73,   55,   55,   55,   55,   55,   74,   66,
+      132,  132,   57,   57,   57,   57,   57,   61,   68,   61,
+       69,   70,   71,  161,   72,   73,  166,  166,  168,   78,
+       78,   74,   78,   78,   78,   78,   78,   78,   80,   80,
+
+       80,   80,   80,   80,   80,   80,   80,   81,   81,   86,
+       81,   81,   81,   81,   81,   81,  182,   78,   78,   78,
+       78,   78,  111,  190,  111,  111,   80,   80,   80,   80,
+       80,  188,  188,   86,  194,   81,   81,   81,   81,   81,
+       83,   87,   83,   83,   83,   83,   83,   83,   83,   83,
+       83,   85,   85,   88,   85,   85,   85,   85,   85,   85,
+      195,   89,   90,   91,   87,   92,  126,   94,   95,   98,
+       83,   83,   83,   83,   83,   96,   88,   97,   99,   85,
+       85,   85,   85,   85,   89,   90,  100,   91,  211,   92,
+       94,  126,   95,   98,  135,  113,  135,  135,   96,  214,
+
+       97,  215,   99,  138,  115,  138,  138,  102,  102,  100,
+      102,  102,  102,  102,  102,  102,  104,  104,  113,  104,
+      104,  104,  104,  104,  104,  105,  105,  115,  105,  105,
+      105,  105,  105,  105,  151,  102,  102,  102,  102,  102,
+      140,  221,  140,  140,  104,  104,  104,  104,  104,  163,
+      222,  163,  163,  105,  105,  105,  105,  105,  106,  151,
+      106,  106,  106,  106,  106,  106,  106,  106,  106,  109,
+      109,  116,  109,  109,  109,  109,  109,  109,  110,  110,
+      117,  110,  110,  110,  110,  110,  110,  227,  106,  106,
+      106,  106,  106,  220,  220,  116,  118,  109,  109,  109,
+
+      109,  109,  119,  117,  121,  124,  110,  110,  110,  110,
+      110,  112,  112,  122,  112,  112,  112,  112,  112,  112,
+      118,  120,  120,  120,  123,  119,  239,  142,  121,  124,
+      165,  240,  165,  165,  252,  171,  122,  171,  171,  112,
+      112,  112,  112,  112,  120,  120,  120,  123,  130,  130,
+      142,  130,  130,  130,  130,  130,  130,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  133,  133,  143,  133,
+      133,  133,  133,  133,  133,  256,  130,  130,  130,  130,
+      130,  193,  264,  193,  193,  131,  131,  131,  131,  131,
+      197,  143,  197,  197,  133,  133,  133,  133,  133,  134,
+
+      134,  265,  134,  134,  134,  134,  134,  134,  137,  137,
+      144,  137,  137,  137,  137,  137,  137,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  148,  134,  134,  134,
+      134,  134,  149,  144,  150,  152,  137,  137,  137,  137,
+      137,  153,  154,  176,  155,  139,  139,  139,  139,  139,
+      148,  156,  157,  238,  238,  173,  149,  150,  167,  152,
+      167,  167,  167,  277,  153,  175,  154,  155,  176,  199,
+      278,  199,  199,  174,  156,  291,  157,  159,  159,  173,
+      159,  159,  159,  159,  159,  159,  160,  160,  175,  160,
+      160,  160,  160,  160,  160,  162,  162,  174,  162,  162,
+
+      162,  162,  162,  162,  298,  159,  159,  159,  159,  159,
+      217,  299,  217,  217,  160,  160,  160,  160,  160,  219,
+      307,  219,  219,  162,  162,  162,  162,  162,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  169,  169,  177,
+      169,  169,  169,  169,  169,  169,  170,  170,  178,  170,
+      170,  170,  170,  170,  170,  180,  164,  164,  164,  164,
+      164,  179,  177,  184,  185,  169,  169,  169,  169,  169,
+      310,  311,  178,  323,  170,  170,  170,  170,  170,  189,
+      180,  189,  189,  189,  179,  330,  184,  331,  185,  186,
+      186,  342,  186,  186,  186,  186,  186,  186,  187,  187,
+
+      187,  187,  187,  187,  187,  187,  187,  191,  191,  200,
+      191,  191,  191,  191,  191,  191,  343,  186,  186,  186,
+      186,  186,  225,  353,  225,  225,  187,  187,  187,  187,
+      187,  243,  200,  243,  243,  191,  191,  191,  191,  191,
+      192,  192,  355,  192,  192,  192,  192,  192,  192,  196,
+      196,  201,  196,  196,  196,  196,  196,  196,  198,  198,
+      198,  198,  198,  198,  198,  198,  198,  203,  192,  192,
+      192,  192,  192,  202,  201,  204,  205,  196,  196,  196,
+      196,  196,  206,  361,  207,  208,  198,  198,  198,  198,
+      198,  203,  210,  362,  372,  246,  202,  246,  246,  204,
+
+      205,  226,  248,  373,  248,  248,  206,  207,  261,  208,
+      261,  261,  380,  212,  212,  210,  212,  212,  212,  212,
+      212,  212,  213,  213,  226,  213,  213,  213,  213,  213,
+      213,  216,  216,  228,  216,  216,  216,  216,  216,  216,
+      385,  212,  212,  212,  212,  212,  263,  386,  263,  263,
+      213,  213,  213,  213,  213,  389,  398,  228,  403,  216,
+      216,  216,  216,  216,  218,  218,  218,  218,  218,  218,
+      218,  218,  218,  223,  223,  229,  223,  223,  223,  223,
+      223,  223,  224,  224,  230,  224,  224,  224,  224,  224,
+      224,  234,  218,  218,  218,  218,  218,  233,  408,  229,
+
+      413,  223,  223,  223,  223,  223,  268,  230,  268,  268,
+      224,  224,  224,  224,  224,  234,  415,  415,  236,  236,
+      233,  236,  236,  236,  236,  236,  236,  237,  237,  237,
+      237,  237,  237,  237,  237,  237,  241,  241,  249,  241,
+      241,  241,  241,  241,  241,  417,  236,  236,  236,  236,
+      236,  281,    0,  281,  281,  237,  237,  237,  237,  237,
+        0,    0,  249,    0,  241,  241,  241,  241,  241,  242,
+      242,    0,  242,  242,  242,  242,  242,  242,  245,  245,
+      251,  245,  245,  245,  245,  245,  245,  247,  247,  247,
+      247,  247,  247,  247,  247,  247,  250,  242,  242,  242,
+
+      242,  242,    0,    0,  251,    0,  245,  245,  245,  245,
+      245,  250,  269,  250,    0,  247,  247,  247,  247,  247,
+      250,  257,  257,  270,  257,  257,  257,  257,  257,  257,
+        0,    0,  271,    0,  250,  269,  250,  258,  258,  272,
+      258,  258,  258,  258,  258,  258,  270,    0,    0,  257,
+      257,  257,  257,  257,  260,  260,  271,  260,  260,  260,
+      260,  260,  260,  272,    0,  258,  258,  258,  258,  258,
+      262,  262,  262,  262,  262,  262,  262,  262,  262,    0,
+        0,  274,  260,  260,  260,  260,  260,  266,  266,  286,
+      266,  266,  266,  266,  266,  266,    0,    0,  262,  262,
+
+      262,  262,  262,  267,  267,  274,  267,  267,  267,  267,
+      267,  267,  286,    0,    0,  266,  266,  266,  266,  266,
+      275,  275,  287,  275,  275,  275,  275,  275,  275,    0,
+        0,  267,  267,  267,  267,  267,  276,  276,  276,  276,
+      276,  276,  276,  276,  276,  287,    0,  290,  275,  275,
+      275,  275,  275,  279,  279,  288,  279,  279,  279,  279,
+      279,  279,    0,    0,  276,  276,  276,  276,  276,  280,
+      280,  290,  280,  280,  280,  280,  280,  280,  288,    0,
+      289,  279,  279,  279,  279,  279,  282,  282,  304,  282,
+      282,  282,  282,  282,  282,    0,    0,  280,  280,  280,
+
+      280,  280,  283,  289,  283,  283,  285,  305,  285,  285,
+      295,  304,  295,  295,  282,  282,  282,  282,  282,  284,
+      284,  284,  284,  284,  284,  284,  284,  284,  292,  292,
+      305,  292,  292,  292,  292,  292,  292,  293,  293,  319,
+      293,  293,  293,  293,  293,  293,    0,  284,  284,  284,
+      284,  284,  297,    0,  297,  297,  292,  292,  292,  292,
+      292,  302,  319,  302,  302,  293,  293,  293,  293,  293,
+      294,  294,    0,  294,  294,  294,  294,  294,  294,  296,
+      296,  296,  296,  296,  296,  296,  296,  296,  300,  300,
+      306,  300,  300,  300,  300,  300,  300,    0,  294,  294,
+
+      294,  294,  294,  314,    0,  314,  314,  296,  296,  296,
+      296,  296,    0,    0,  306,    0,  300,  300,  300,  300,
+      300,  301,  301,    0,  301,  301,  301,  301,  301,  301,
+      308,  308,  320,  308,  308,  308,  308,  308,  308,  309,
+      309,  309,  309,  309,  309,  309,  309,  309,    0,  301,
+      301,  301,  301,  301,  316,  320,  316,  316,  308,  308,
+      308,  308,  308,  318,    0,  318,  318,  309,  309,  309,
+      309,  309,  312,  312,    0,  312,  312,  312,  312,  312,
+      312,  313,  313,  321,  313,  313,  313,  313,  313,  313,
+      315,  315,  322,  315,  315,  315,  315,  315,  315,    0,
+
+      312,  312,  312,  312,  312,  327,  321,  327,  327,  313,
+      313,  313,  313,  313,  329,  322,  329,  329,  315,  315,
+      315,  315,  315,  317,  317,  317,  317,  317,  317,  317,
+      317,  317,  324,  324,  337,  324,  324,  324,  324,  324,
+      324,  325,  325,  325,  325,  325,  325,  325,  325,  325,
+        0,  317,  317,  317,  317,  317,  334,  337,  334,  334,
+      324,  324,  324,  324,  324,  346,    0,  346,  346,  325,
+      325,  325,  325,  325,  326,  326,    0,  326,  326,  326,
+      326,  326,  326,  328,  328,  328,  328,  328,  328,  328,
+      328,  328,  332,  332,  338,  332,  332,  332,  332,  332,
+
+      332,    0,  326,  326,  326,  326,  326,  348,    0,  348,
+      348,  328,  328,  328,  328,  328,  350,  338,  350,  350,
+      332,  332,  332,  332,  332,  333,  333,    0,  333,  333,
+      333,  333,  333,  333,  339,  339,  351,  339,  339,  339,
+      339,  339,  339,  340,  340,  340,  340,  340,  340,  340,
+      340,  340,    0,  333,  333,  333,  333,  333,  358,  351,
+      358,  358,  339,  339,  339,  339,  339,  360,    0,  360,
+      360,  340,  340,  340,  340,  340,  341,  341,    0,  341,
+      341,  341,  341,  341,  341,  344,  344,  352,  344,  344,
+      344,  344,  344,  344,  345,  345,  379,  345,  345,  345,
+
+      345,  345,  345,    0,  341,  341,  341,  341,  341,    0,
+        0,  352,    0,  344,  344,  344,  344,  344,  365,  379,
+      365,  365,  345,  345,  345,  345,  345,  347,  347,    0,
+      347,  347,  347,  347,  347,  347,  349,  349,  349,  349,
+      349,  349,  349,  349,  349,  354,  354,  367,  354,  354,
+      354,  354,  354,  354,    0,  347,  347,  347,  347,  347,
+      375,    0,  375,  375,  349,  349,  349,  349,  349,    0,
+        0,  367,    0,  354,  354,  354,  354,  354,  356,  356,
+      356,  356,  356,  356,  356,  356,  356,  357,  357,    0,
+      357,  357,  357,  357,  357,  357,  359,  359,    0,  359,
+
+      359,  359,  359,  359,  359,    0,  356,  356,  356,  356,
+      356,  377,    0,  377,  377,  357,  357,  357,  357,  357,
+      384,    0,  384,  384,  359,  359,  359,  359,  359,  363,
+      363,    0,  363,  363,  363,  363,  363,  363,  364,  364,
+        0,  364,  364,  364,  364,  364,  364,  368,  368,    0,
+      368,  368,  368,  368,  368,  368,    0,  363,  363,  363,
+      363,  363,    0,    0,    0,    0,  364,  364,  364,  364,
+      364,    0,    0,    0,    0,  368,  368,  368,  368,  368,
+      370,  370,    0,  370,  370,  370,  370,  370,  370,  371,
+      371,    0,  371,  371,  371,  371,  371,  371,  374,  374,
+
+        0,  374,  374,  374,  374,  374,  374,    0,  370,  370,
+      370,  370,  370,    0,    0,    0,    0,  371,  371,  371,
+      371,  371,    0,    0,    0,    0,  374,  374,  374,  374,
+      374,  376,  376,    0,  376,  376,  376,  376,  376,  376,
+      378,  378,    0,  378,  378,  378,  378,  378,  378,  381,
+      381,    0,  381,  381,  381,  381,  381,  381,    0,  376,
+      376,  376,  376,  376,    0,    0,    0,    0,  378,  378,
+      378,  378,  378,    0,    0,    0,    0,  381,  381,  381,
+      381,  381,  382,  382,  382,  382,  382,  382,  382,  382,
+      382,  383,  383,    0,  383,  383,  383,  383,  383,  383,
+
+      387,  387,    0,  387,  387,  387,  387,  387,  387,    0,
+      382,  382,  382,  382,  382,    0,    0,    0,    0,  383,
+      383,  383,  383,  383,    0,    0,    0,    0,  387,  387,
+      387,  387,  387,  390,  390,    0,  390,  390,  390,  390,
+      390,  390,  391,  391,    0,  391,  391,  391,  391,  391,
+      391,  394,  394,    0,  394,  394,  394,  394,  394,  394,
+        0,  390,  390,  390,  390,  390,    0,    0,    0,    0,
+      391,  391,  391,  391,  391,    0,    0,    0,    0,  394,
+      394,  394,  394,  394,  395,  395,    0,  395,  395,  395,
+      395,  395,  395,  396,  396,  396,  396,  396,  396,  396,
+
+      396,  396,  399,  399,    0,  399,  399,  399,  399,  399,
+      399,    0,  395,  395,  395,  395,  395,    0,    0,    0,
+        0,  396,  396,  396,  396,  396,    0,    0,    0,    0,
+      399,  399,  399,  399,  399,  400,  400,    0,  400,  400,
+      400,  400,  400,  400,  401,  401,    0,  401,  401,  401,
+      401,  401,  401,  402,  402,  402,  402,  402,  402,  402,
+      402,  402,    0,  400,  400,  400,  400,  400,    0,    0,
+        0,    0,  401,  401,  401,  401,  401,    0,    0,    0,
+        0,  402,  402,  402,  402,  402,  404,  404,    0,  404,
+      404,  404,  404,  404,  404,  405,  405,    0,  405,  405,
+
+      405,  405,  405,  405,  406,  406,    0,  406,  406,  406,
+      406,  406,  406,    0,  404,  404,  404,  404,  404,    0,
+        0,    0,    0,  405,  405,  405,  405,  405,    0,    0,
+        0,    0,  406,  406,  406,  406,  406,  407,  407,  407,
+      407,  407,  407,  407,  407,  407,  409,  409,    0,  409,
+      409,  409,  409,  409,  409,  410,  410,    0,  410,  410,
+      410,  410,  410,  410,    0,  407,  407,  407,  407,  407,
+        0,    0,    0,    0,  409,  409,  409,  409,  409,    0,
+        0,    0,    0,  410,  410,  410,  410,  410,  411,  411,
+        0,  411,  411,  411,  411,  411,  411,  412,  412,  412,
+
+      412,  412,  412,  412,  412,  412,  414,  414,    0,  414,
+      414,  414,  414,  414,  414,    0,  411,  411,  411,  411,
+      411,    0,    0,    0,    0,  412,  412,  412,  412,  412,
+        0,    0,    0,    0,  414,  414,  414,  414,  414,  416,
+      416,    0,  416,  416,  416,  416,  416,  416,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  416,  416,  416,
+      416,  416,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,  418,
+      418,  418,  418
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[41] =
+static yyconst flex_int32_t yy_rule_can_match_eol[44] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 
-    0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 
+    0, 0, 0, 0,     };
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -913,7 +1223,7 @@ using namespace std;
 namespace std{
   yy_RelParser_stype yylval;
 }
-#line 917 "RelLexer.cpp"
+#line 1227 "RelLexer.cpp"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1023,7 +1333,7 @@ YY_DECL
 #line 44 "RelLexer.l"
 
 
-#line 1027 "RelLexer.cpp"
+#line 1337 "RelLexer.cpp"
 
 	if ( !(yy_init) )
 		{
@@ -1076,13 +1386,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 393 )
+				if ( yy_current_state >= 419 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 1289 );
+		while ( yy_base[yy_current_state] != 2791 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1184,75 +1494,90 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 61 "RelLexer.l"
-{ return RelParser::LOGNAME_;}
+#line 60 "RelLexer.l"
+{ return RelParser::FAILOVER_TIMEOUT_; }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 62 "RelLexer.l"
-{ return RelParser::LOGLEVEL_;}
+#line 61 "RelLexer.l"
+{ return RelParser::FAILOVER_RETRY_; }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 63 "RelLexer.l"
-{ return RelParser::LOGMODE_; }
+#line 62 "RelLexer.l"
+{ return RelParser::FAILOVER_COUNT_; }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 65 "RelLexer.l"
-{ return RelParser::WORKDIR_;}
+#line 64 "RelLexer.l"
+{ return RelParser::LOGNAME_;}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 67 "RelLexer.l"
-{ yylval.ival=1; return RelParser::INTNUMBER_;}
+#line 65 "RelLexer.l"
+{ return RelParser::LOGLEVEL_;}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 68 "RelLexer.l"
-{ yylval.ival=0; return RelParser::INTNUMBER_;}
+#line 66 "RelLexer.l"
+{ return RelParser::LOGMODE_; }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 69 "RelLexer.l"
-{ yylval.ival=1; return RelParser::INTNUMBER_;}
+#line 68 "RelLexer.l"
+{ return RelParser::WORKDIR_;}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 70 "RelLexer.l"
-{ yylval.ival=0; return RelParser::INTNUMBER_;}
+{ yylval.ival=1; return RelParser::INTNUMBER_;}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
+#line 71 "RelLexer.l"
+{ yylval.ival=0; return RelParser::INTNUMBER_;}
+	YY_BREAK
+case 23:
+YY_RULE_SETUP
 #line 72 "RelLexer.l"
+{ yylval.ival=1; return RelParser::INTNUMBER_;}
+	YY_BREAK
+case 24:
+YY_RULE_SETUP
+#line 73 "RelLexer.l"
+{ yylval.ival=0; return RelParser::INTNUMBER_;}
+	YY_BREAK
+case 25:
+YY_RULE_SETUP
+#line 75 "RelLexer.l"
 ;
 	YY_BREAK
-case 23:
+case 26:
 YY_RULE_SETUP
-#line 74 "RelLexer.l"
+#line 77 "RelLexer.l"
 ;
 	YY_BREAK
-case 24:
+case 27:
 YY_RULE_SETUP
-#line 76 "RelLexer.l"
+#line 79 "RelLexer.l"
 {
   BEGIN(COMMENT);
   ComBeg=yylineno; 
 }
 	YY_BREAK
-case 25:
+case 28:
 YY_RULE_SETUP
-#line 81 "RelLexer.l"
+#line 84 "RelLexer.l"
 BEGIN(INITIAL);
 	YY_BREAK
-case 26:
-/* rule 26 can match eol */
+case 29:
+/* rule 29 can match eol */
 YY_RULE_SETUP
-#line 82 "RelLexer.l"
+#line 85 "RelLexer.l"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
-#line 83 "RelLexer.l"
+#line 86 "RelLexer.l"
 {
     Log(Crit) << "Comment not closed. (/* in line " << ComBeg << LogEnd;
   { YYABORT; }
@@ -1260,9 +1585,9 @@ case YY_STATE_EOF(COMMENT):
 	YY_BREAK
  //IPv6 address - various forms
 
-case 27:
+case 30:
 YY_RULE_SETUP
-#line 90 "RelLexer.l"
+#line 93 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1272,9 +1597,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 31:
 YY_RULE_SETUP
-#line 99 "RelLexer.l"
+#line 102 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1284,9 +1609,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 32:
 YY_RULE_SETUP
-#line 108 "RelLexer.l"
+#line 111 "RelLexer.l"
 { 
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1296,9 +1621,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 33:
 YY_RULE_SETUP
-#line 117 "RelLexer.l"
+#line 120 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1308,9 +1633,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 34:
 YY_RULE_SETUP
-#line 126 "RelLexer.l"
+#line 129 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1320,9 +1645,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 35:
 YY_RULE_SETUP
-#line 135 "RelLexer.l"
+#line 138 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1332,9 +1657,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 36:
 YY_RULE_SETUP
-#line 144 "RelLexer.l"
+#line 147 "RelLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) { 
         Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -1344,10 +1669,10 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
-/* rule 34 can match eol */
+case 37:
+/* rule 37 can match eol */
 YY_RULE_SETUP
-#line 153 "RelLexer.l"
+#line 156 "RelLexer.l"
 {
     yylval.strval=new char[strlen(yytext)-1];
     strncpy(yylval.strval, yytext+1, strlen(yytext)-2);
@@ -1355,9 +1680,9 @@ YY_RULE_SETUP
     return RelParser::STRING_;
 }
 	YY_BREAK
-case 35:
+case 38:
 YY_RULE_SETUP
-#line 160 "RelLexer.l"
+#line 163 "RelLexer.l"
 {
     int len = strlen(yytext);
     if ( ( (len>2) && !strncasecmp("yes",yytext,3) ) ||
@@ -1379,9 +1704,9 @@ YY_RULE_SETUP
     return RelParser::STRING_;
 }
 	YY_BREAK
-case 36:
+case 39:
 YY_RULE_SETUP
-#line 181 "RelLexer.l"
+#line 184 "RelLexer.l"
 {
     // HEX NUMBER
     yytext[strlen(yytext)-1]='\n';
@@ -1392,9 +1717,9 @@ YY_RULE_SETUP
     return RelParser::HEXNUMBER_;
 }
 	YY_BREAK
-case 37:
+case 40:
 YY_RULE_SETUP
-#line 191 "RelLexer.l"
+#line 194 "RelLexer.l"
 { 
     if(!sscanf(yytext,"%u",&(yylval.ival))) { 
         Log(Crit) << "Decimal value [" << yytext << " parsing failed." << LogEnd; 
@@ -1403,9 +1728,9 @@ YY_RULE_SETUP
     return RelParser::INTNUMBER_;
 }
 	YY_BREAK
-case 38:
+case 41:
 YY_RULE_SETUP
-#line 199 "RelLexer.l"
+#line 202 "RelLexer.l"
 {
     // DUID
     int len;
@@ -1438,17 +1763,17 @@ YY_RULE_SETUP
    return RelParser::DUID_;
 }
 	YY_BREAK
-case 39:
+case 42:
 YY_RULE_SETUP
-#line 231 "RelLexer.l"
+#line 234 "RelLexer.l"
 { return yytext[0]; } 
 	YY_BREAK
-case 40:
+case 43:
 YY_RULE_SETUP
-#line 234 "RelLexer.l"
+#line 237 "RelLexer.l"
 ECHO;
 	YY_BREAK
-#line 1452 "RelLexer.cpp"
+#line 1777 "RelLexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(ADDR):
 	yyterminate();
@@ -1830,7 +2155,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 393 )
+			if ( yy_current_state >= 419 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -1858,11 +2183,11 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 393 )
+		if ( yy_current_state >= 419 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 392);
+	yy_is_jam = (yy_current_state == 418);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
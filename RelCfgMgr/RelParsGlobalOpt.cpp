@@ -10,6 +10,7 @@
 
 #include "RelParsGlobalOpt.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 
 using namespace std;
 
@@ -17,6 +18,9 @@ TRelParsGlobalOpt::TRelParsGlobalOpt(void) {
     WorkDir   = WORKDIR;
     GuessMode = false;
     InterfaceIDOrder = REL_IFACE_ID_ORDER_BEFORE;
+    FailoverTimeout = RELAY_DEFAULT_FAILOVER_TIMEOUT;
+    FailoverRetry   = RELAY_DEFAULT_FAILOVER_RETRY;
+    FailoverCount   = RELAY_DEFAULT_FAILOVER_COUNT;
 }
 
 TRelParsGlobalOpt::~TRelParsGlobalOpt(void) {
@@ -66,3 +70,33 @@ SPtr<TRelOptEcho> TRelParsGlobalOpt::getEcho()
 {
     return Echo;
 }
+
+void TRelParsGlobalOpt::setFailoverTimeout(unsigned int timeout)
+{
+    FailoverTimeout = timeout;
+}
+
+unsigned int TRelParsGlobalOpt::getFailoverTimeout()
+{
+    return FailoverTimeout;
+}
+
+void TRelParsGlobalOpt::setFailoverRetry(unsigned int retry)
+{
+    FailoverRetry = retry;
+}
+
+unsigned int TRelParsGlobalOpt::getFailoverRetry()
+{
+    return FailoverRetry;
+}
+
+void TRelParsGlobalOpt::setFailoverCount(unsigned int count)
+{
+    FailoverCount = count;
+}
+
+unsigned int TRelParsGlobalOpt::getFailoverCount()
+{
+    return FailoverCount;
+}
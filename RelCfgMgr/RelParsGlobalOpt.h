@@ -45,6 +45,13 @@ class TRelParsGlobalOpt : public TRelParsIfaceOpt
     void setEcho(SPtr<TRelOptEcho> echo);
     SPtr<TRelOptEcho> getEcho();
 
+    void setFailoverTimeout(unsigned int timeout);
+    unsigned int getFailoverTimeout();
+    void setFailoverRetry(unsigned int retry);
+    unsigned int getFailoverRetry();
+    void setFailoverCount(unsigned int count);
+    unsigned int getFailoverCount();
+
 private:
     std::string WorkDir;
     bool GuessMode;
@@ -52,5 +59,9 @@ private:
     ERelIfaceIdOrder InterfaceIDOrder;
     SPtr<TOptVendorData> RemoteID;
     SPtr<TRelOptEcho>     Echo;
+
+    unsigned int FailoverTimeout;
+    unsigned int FailoverRetry;
+    unsigned int FailoverCount;
 };
 #endif
@@ -366,10 +366,13 @@ typedef
 #define	REMOTE_ID_	271
 #define	ECHO_REQUEST_	272
 #define	GUESS_MODE_	273
-#define	STRING_	274
-#define	HEXNUMBER_	275
-#define	INTNUMBER_	276
-#define	IPV6ADDR_	277
+#define	FAILOVER_TIMEOUT_	274
+#define	FAILOVER_RETRY_	275
+#define	FAILOVER_COUNT_	276
+#define	STRING_	277
+#define	HEXNUMBER_	278
+#define	INTNUMBER_	279
+#define	IPV6ADDR_	280
 
 
 #line 263 "../bison++/bison.cc"
@@ -435,6 +438,9 @@ static const int OPTION_;
 static const int REMOTE_ID_;
 static const int ECHO_REQUEST_;
 static const int GUESS_MODE_;
+static const int FAILOVER_TIMEOUT_;
+static const int FAILOVER_RETRY_;
+static const int FAILOVER_COUNT_;
 static const int STRING_;
 static const int HEXNUMBER_;
 static const int INTNUMBER_;
@@ -463,10 +469,13 @@ enum YY_RelParser_ENUM_TOKEN { YY_RelParser_NULL_TOKEN=0
 	,REMOTE_ID_=271
 	,ECHO_REQUEST_=272
 	,GUESS_MODE_=273
-	,STRING_=274
-	,HEXNUMBER_=275
-	,INTNUMBER_=276
-	,IPV6ADDR_=277
+	,FAILOVER_TIMEOUT_=274
+	,FAILOVER_RETRY_=275
+	,FAILOVER_COUNT_=276
+	,STRING_=277
+	,HEXNUMBER_=278
+	,INTNUMBER_=279
+	,IPV6ADDR_=280
 
 
 #line 310 "../bison++/bison.cc"
@@ -519,10 +528,13 @@ const int YY_RelParser_CLASS::OPTION_=270;
 const int YY_RelParser_CLASS::REMOTE_ID_=271;
 const int YY_RelParser_CLASS::ECHO_REQUEST_=272;
 const int YY_RelParser_CLASS::GUESS_MODE_=273;
-const int YY_RelParser_CLASS::STRING_=274;
-const int YY_RelParser_CLASS::HEXNUMBER_=275;
-const int YY_RelParser_CLASS::INTNUMBER_=276;
-const int YY_RelParser_CLASS::IPV6ADDR_=277;
+const int YY_RelParser_CLASS::FAILOVER_TIMEOUT_=274;
+const int YY_RelParser_CLASS::FAILOVER_RETRY_=275;
+const int YY_RelParser_CLASS::FAILOVER_COUNT_=276;
+const int YY_RelParser_CLASS::STRING_=277;
+const int YY_RelParser_CLASS::HEXNUMBER_=278;
+const int YY_RelParser_CLASS::INTNUMBER_=279;
+const int YY_RelParser_CLASS::IPV6ADDR_=280;
 
 
 #line 341 "../bison++/bison.cc"
@@ -541,18 +553,18 @@ YY_RelParser_CONSTRUCTOR_CODE;
  #line 352 "../bison++/bison.cc"
 
 
-#define	YYFINAL		72
+#define	YYFINAL		81
 #define	YYFLAG		-32768
-#define	YYNTBASE	27
+#define	YYNTBASE	30
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 277 ? yytranslate[x] : 53)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 280 ? yytranslate[x] : 59)
 
 static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,    26,    25,     2,     2,     2,     2,     2,
+     2,     2,     2,    29,    28,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -560,7 +572,7 @@ static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,    23,     2,    24,     2,     2,     2,     2,     2,
+     2,     2,    26,     2,    27,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -575,129 +587,139 @@ static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     1,     2,     3,     4,     5,
      6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22
+    16,    17,    18,    19,    20,    21,    22,    23,    24,    25
 };
 
 #if YY_RelParser_DEBUG != 0
 static const short yyprhs[] = {     0,
      0,     2,     5,     7,    10,    12,    14,    16,    18,    20,
-    22,    24,    26,    28,    31,    33,    36,    38,    40,    42,
-    44,    46,    47,    54,    55,    62,    64,    66,    70,    74,
-    78,    81,    85,    88,    91,    94,    97,   100,   102,   105,
-   111,   112,   117,   119,   123
+    22,    24,    26,    28,    30,    32,    34,    37,    39,    42,
+    44,    46,    48,    50,    52,    53,    60,    61,    68,    70,
+    72,    76,    80,    84,    87,    91,    94,    97,   100,   103,
+   106,   108,   111,   117,   118,   123,   125,   129,   132,   135,
+   138
 };
 
-static const short yyrhs[] = {    28,
-     0,    29,    31,     0,    30,     0,    29,    30,     0,    43,
-     0,    42,     0,    44,     0,    45,     0,    46,     0,    52,
-     0,    48,     0,    49,     0,    34,     0,    31,    34,     0,
-    33,     0,    32,    33,     0,    39,     0,    38,     0,    41,
-     0,    40,     0,    47,     0,     0,     3,    19,    23,    35,
-    32,    24,     0,     0,     3,    37,    23,    36,    32,    24,
-     0,    20,     0,    21,     0,     5,     6,    22,     0,     4,
-     6,    22,     0,     5,     7,    37,     0,     5,     7,     0,
-     4,     7,    37,     0,     4,     7,     0,    11,    37,     0,
-    12,    19,     0,    10,    19,     0,    13,    19,     0,    18,
-     0,     8,    37,     0,    15,    16,    37,    25,    14,     0,
-     0,    15,    17,    50,    51,     0,    37,     0,    51,    26,
-    37,     0,     9,    19,     0
+static const short yyrhs[] = {    31,
+     0,    32,    34,     0,    33,     0,    32,    33,     0,    46,
+     0,    45,     0,    47,     0,    48,     0,    49,     0,    58,
+     0,    51,     0,    52,     0,    55,     0,    56,     0,    57,
+     0,    37,     0,    34,    37,     0,    36,     0,    35,    36,
+     0,    42,     0,    41,     0,    44,     0,    43,     0,    50,
+     0,     0,     3,    22,    26,    38,    35,    27,     0,     0,
+     3,    40,    26,    39,    35,    27,     0,    23,     0,    24,
+     0,     5,     6,    25,     0,     4,     6,    25,     0,     5,
+     7,    40,     0,     5,     7,     0,     4,     7,    40,     0,
+     4,     7,     0,    11,    40,     0,    12,    22,     0,    10,
+    22,     0,    13,    22,     0,    18,     0,     8,    40,     0,
+    15,    16,    40,    28,    14,     0,     0,    15,    17,    53,
+    54,     0,    40,     0,    54,    29,    40,     0,    19,    40,
+     0,    20,    40,     0,    21,    40,     0,     9,    22,     0
 };
 
 #endif
 
 #if (YY_RelParser_DEBUG != 0) || defined(YY_RelParser_ERROR_VERBOSE) 
 static const short yyrline[] = { 0,
-    81,    85,    89,    90,    94,    95,    96,    97,    98,    99,
-   100,   101,   105,   106,   110,   111,   115,   116,   117,   118,
-   119,   123,   128,   136,   141,   152,   153,   157,   164,   171,
-   175,   182,   186,   193,   199,   204,   211,   218,   224,   231,
-   238,   244,   249,   254,   261
+    82,    86,    90,    91,    95,    96,    97,    98,    99,   100,
+   101,   102,   103,   104,   105,   109,   110,   114,   115,   119,
+   120,   121,   122,   123,   127,   132,   140,   145,   156,   157,
+   161,   168,   175,   179,   186,   190,   197,   203,   208,   215,
+   222,   228,   235,   242,   248,   253,   258,   265,   275,   281,
+   291
 };
 
 static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","CLIENT_",
 "SERVER_","UNICAST_","MULTICAST_","IFACE_ID_","IFACE_ID_ORDER_","LOGNAME_","LOGLEVEL_",
 "LOGMODE_","WORKDIR_","DUID_","OPTION_","REMOTE_ID_","ECHO_REQUEST_","GUESS_MODE_",
-"STRING_","HEXNUMBER_","INTNUMBER_","IPV6ADDR_","'{'","'}'","'-'","','","Grammar",
-"GlobalList","GlobalOptionsList","GlobalOption","IfaceList","IfaceOptionList",
-"IfaceOptions","Iface","@1","@2","Number","ServerUnicastOption","ClientUnicastOption",
-"ServerMulticast","ClientMulticastOption","LogLevelOption","LogModeOption","LogNameOption",
-"WorkDirOption","GuessMode","IfaceID","RemoteID","EchoRequest","@3","OptionIdList",
-"IfaceIDOrder",""
+"FAILOVER_TIMEOUT_","FAILOVER_RETRY_","FAILOVER_COUNT_","STRING_","HEXNUMBER_",
+"INTNUMBER_","IPV6ADDR_","'{'","'}'","'-'","','","Grammar","GlobalList","GlobalOptionsList",
+"GlobalOption","IfaceList","IfaceOptionList","IfaceOptions","Iface","@1","@2",
+"Number","ServerUnicastOption","ClientUnicastOption","ServerMulticast","ClientMulticastOption",
+"LogLevelOption","LogModeOption","LogNameOption","WorkDirOption","GuessMode",
+"IfaceID","RemoteID","EchoRequest","@3","OptionIdList","FailoverTimeout","FailoverRetry",
+"FailoverCount","IfaceIDOrder",""
 };
 #endif
 
 static const short yyr1[] = {     0,
-    27,    28,    29,    29,    30,    30,    30,    30,    30,    30,
-    30,    30,    31,    31,    32,    32,    33,    33,    33,    33,
-    33,    35,    34,    36,    34,    37,    37,    38,    39,    40,
-    40,    41,    41,    42,    43,    44,    45,    46,    47,    48,
-    50,    49,    51,    51,    52
+    30,    31,    32,    32,    33,    33,    33,    33,    33,    33,
+    33,    33,    33,    33,    33,    34,    34,    35,    35,    36,
+    36,    36,    36,    36,    38,    37,    39,    37,    40,    40,
+    41,    42,    43,    43,    44,    44,    45,    46,    47,    48,
+    49,    50,    51,    53,    52,    54,    54,    55,    56,    57,
+    58
 };
 
 static const short yyr2[] = {     0,
      1,     2,     1,     2,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     2,     1,     2,     1,     1,     1,     1,
-     1,     0,     6,     0,     6,     1,     1,     3,     3,     3,
-     2,     3,     2,     2,     2,     2,     2,     1,     2,     5,
-     0,     4,     1,     3,     2
+     1,     1,     1,     1,     1,     1,     2,     1,     2,     1,
+     1,     1,     1,     1,     0,     6,     0,     6,     1,     1,
+     3,     3,     3,     2,     3,     2,     2,     2,     2,     2,
+     1,     2,     5,     0,     4,     1,     3,     2,     2,     2,
+     2
 };
 
 static const short yydefact[] = {     0,
-     0,     0,     0,     0,     0,     0,    38,     1,     0,     3,
-     6,     5,     7,     8,     9,    11,    12,    10,    45,    36,
-    26,    27,    34,    35,    37,     0,    41,     0,     4,     2,
-    13,     0,     0,     0,     0,    14,     0,    43,    42,    22,
-    24,    40,     0,     0,     0,    44,     0,     0,     0,     0,
-    15,    18,    17,    20,    19,    21,     0,     0,    33,     0,
-    31,    39,    23,    16,    25,    29,    32,    28,    30,     0,
-     0,     0
+     0,     0,     0,     0,     0,     0,    41,     0,     0,     0,
+     1,     0,     3,     6,     5,     7,     8,     9,    11,    12,
+    13,    14,    15,    10,    51,    39,    29,    30,    37,    38,
+    40,     0,    44,    48,    49,    50,     0,     4,     2,    16,
+     0,     0,     0,     0,    17,     0,    46,    45,    25,    27,
+    43,     0,     0,     0,    47,     0,     0,     0,     0,    18,
+    21,    20,    23,    22,    24,     0,     0,    36,     0,    34,
+    42,    26,    19,    28,    32,    35,    31,    33,     0,     0,
+     0
 };
 
-static const short yydefgoto[] = {    70,
-     8,     9,    10,    30,    50,    51,    31,    44,    45,    23,
-    52,    53,    54,    55,    11,    12,    13,    14,    15,    56,
-    16,    17,    33,    39,    18
+static const short yydefgoto[] = {    79,
+    11,    12,    13,    39,    59,    60,    40,    53,    54,    29,
+    61,    62,    63,    64,    14,    15,    16,    17,    18,    65,
+    19,    20,    42,    48,    21,    22,    23,    24
 };
 
-static const short yypact[] = {    37,
-   -18,   -16,     6,   -13,    -7,    15,-32768,-32768,    27,-32768,
+static const short yypact[] = {     2,
+   -14,   -12,    30,    -6,    -3,    40,-32768,    30,    30,    30,
+-32768,    27,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,     6,-32768,     1,-32768,    22,
--32768,   -11,     6,    18,    20,-32768,    14,-32768,     8,-32768,
--32768,-32768,     6,    11,    11,-32768,    47,    50,     6,     0,
--32768,-32768,-32768,-32768,-32768,-32768,     5,    29,     6,    36,
-     6,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    44,
-    59,-32768
+-32768,    30,-32768,-32768,-32768,-32768,     9,-32768,    24,-32768,
+     7,    30,    15,    17,-32768,    35,-32768,    32,-32768,-32768,
+-32768,    30,    47,    47,-32768,    52,    57,    30,    -1,-32768,
+-32768,-32768,-32768,-32768,-32768,     1,    41,    30,    42,    30,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    65,    68,
+-32768
 };
 
 static const short yypgoto[] = {-32768,
--32768,-32768,    51,-32768,    16,   -39,    32,-32768,-32768,   -26,
+-32768,-32768,    58,-32768,    18,   -41,    34,-32768,-32768,    -8,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768
 };
 
 
-#define	YYLAST		62
+#define	YYLAST		73
 
 
-static const short yytable[] = {    32,
-    19,    35,    20,    47,    48,    24,    38,    49,    47,    48,
-    64,    25,    49,    37,    47,    48,    46,    64,    49,    34,
-    21,    22,    62,    63,    28,    21,    22,    42,    65,    28,
-    26,    27,    67,    43,    69,     1,     2,     3,     4,     5,
-    40,     6,    41,    71,     7,     1,     2,     3,     4,     5,
-    66,     6,    58,    59,     7,    60,    61,    68,    72,    29,
-    57,    36
+static const short yytable[] = {    34,
+    35,    36,    56,    57,    56,    57,    58,    25,    58,    26,
+     1,     2,     3,     4,     5,    30,     6,    73,    31,     7,
+     8,     9,    10,    41,    73,    72,    37,    74,    44,    37,
+    43,    27,    28,    47,    46,     1,     2,     3,     4,     5,
+    49,     6,    50,    55,     7,     8,     9,    10,    51,    71,
+    56,    57,    27,    28,    58,    32,    33,    67,    68,    76,
+    52,    78,    69,    70,    80,    75,    77,    81,     0,    38,
+     0,    66,    45
 };
 
-static const short yycheck[] = {    26,
-    19,    28,    19,     4,     5,    19,    33,     8,     4,     5,
-    50,    19,     8,    25,     4,     5,    43,    57,     8,    19,
-    20,    21,    49,    24,     3,    20,    21,    14,    24,     3,
-    16,    17,    59,    26,    61,     9,    10,    11,    12,    13,
-    23,    15,    23,     0,    18,     9,    10,    11,    12,    13,
-    22,    15,     6,     7,    18,     6,     7,    22,     0,     9,
-    45,    30
+static const short yycheck[] = {     8,
+     9,    10,     4,     5,     4,     5,     8,    22,     8,    22,
+     9,    10,    11,    12,    13,    22,    15,    59,    22,    18,
+    19,    20,    21,    32,    66,    27,     3,    27,    37,     3,
+    22,    23,    24,    42,    28,     9,    10,    11,    12,    13,
+    26,    15,    26,    52,    18,    19,    20,    21,    14,    58,
+     4,     5,    23,    24,     8,    16,    17,     6,     7,    68,
+    29,    70,     6,     7,     0,    25,    25,     0,    -1,    12,
+    -1,    54,    39
 };
 
 #line 352 "../bison++/bison.cc"
@@ -1193,15 +1215,15 @@ YYLABEL(yyreduce)
 
   switch (yyn) {
 
-case 22:
-#line 124 "RelParser.y"
+case 25:
+#line 128 "RelParser.y"
 {
     CheckIsIface(string(yyvsp[-1].strval)); //If no - everything is ok
     StartIfaceDeclaration();
 ;
     break;}
-case 23:
-#line 129 "RelParser.y"
+case 26:
+#line 133 "RelParser.y"
 {
     //Information about new interface has been read
     //Add it to list of read interfaces
@@ -1210,137 +1232,163 @@ case 23:
     EndIfaceDeclaration();
 ;
     break;}
-case 24:
-#line 137 "RelParser.y"
+case 27:
+#line 141 "RelParser.y"
 {
     CheckIsIface(yyvsp[-1].ival);   //If no - everything is ok
     StartIfaceDeclaration();
 ;
     break;}
-case 25:
-#line 142 "RelParser.y"
+case 28:
+#line 146 "RelParser.y"
 {
     RelCfgIfaceLst.append(new TRelCfgIface(yyvsp[-4].ival));
     EndIfaceDeclaration();
 ;
     break;}
-case 26:
-#line 152 "RelParser.y"
+case 29:
+#line 156 "RelParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 27:
-#line 153 "RelParser.y"
+case 30:
+#line 157 "RelParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 28:
-#line 158 "RelParser.y"
+case 31:
+#line 162 "RelParser.y"
 {
     ParserOptStack.getLast()->setServerUnicast(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 29:
-#line 165 "RelParser.y"
+case 32:
+#line 169 "RelParser.y"
 {
     ParserOptStack.getLast()->setClientUnicast(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 30:
-#line 172 "RelParser.y"
+case 33:
+#line 176 "RelParser.y"
 { 
     ParserOptStack.getLast()->setServerMulticast(yyvsp[0].ival);
 ;
     break;}
-case 31:
-#line 176 "RelParser.y"
+case 34:
+#line 180 "RelParser.y"
 {
     ParserOptStack.getLast()->setServerMulticast(true);
 ;
     break;}
-case 32:
-#line 183 "RelParser.y"
+case 35:
+#line 187 "RelParser.y"
 { 
     ParserOptStack.getLast()->setClientMulticast(yyvsp[0].ival);
 ;
     break;}
-case 33:
-#line 187 "RelParser.y"
+case 36:
+#line 191 "RelParser.y"
 {
     ParserOptStack.getLast()->setClientMulticast(true);
 ;
     break;}
-case 34:
-#line 193 "RelParser.y"
+case 37:
+#line 197 "RelParser.y"
 {
     logger::setLogLevel(yyvsp[0].ival);
 ;
     break;}
-case 35:
-#line 199 "RelParser.y"
+case 38:
+#line 203 "RelParser.y"
 {
     logger::setLogMode(yyvsp[0].strval);
 ;
     break;}
-case 36:
-#line 205 "RelParser.y"
+case 39:
+#line 209 "RelParser.y"
 {
     logger::setLogName(yyvsp[0].strval);
 ;
     break;}
-case 37:
-#line 212 "RelParser.y"
+case 40:
+#line 216 "RelParser.y"
 {
     ParserOptStack.getLast()->setWorkDir(yyvsp[0].strval);
 ;
     break;}
-case 38:
-#line 219 "RelParser.y"
+case 41:
+#line 223 "RelParser.y"
 {
     ParserOptStack.getLast()->setGuessMode(true);
 ;
     break;}
-case 39:
-#line 225 "RelParser.y"
+case 42:
+#line 229 "RelParser.y"
 {
     ParserOptStack.getLast()->setInterfaceID(yyvsp[0].ival);
 ;
     break;}
-case 40:
-#line 232 "RelParser.y"
+case 43:
+#line 236 "RelParser.y"
 {
     Log(Debug) << "RemoteID set: enterprise-number=" << yyvsp[-2].ival << ", remote-id length=" << yyvsp[0].duidval.length << LogEnd;
     ParserOptStack.getLast()->setRemoteID( new TOptVendorData(yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0));
 ;
     break;}
-case 41:
-#line 239 "RelParser.y"
+case 44:
+#line 243 "RelParser.y"
 {
     EchoOpt = new TRelOptEcho(0);
     ParserOptStack.getLast()->setEcho(EchoOpt);
     Log(Debug) << "Echo Request option will be added with opt(s): ";
 ;
     break;}
-case 42:
-#line 244 "RelParser.y"
+case 45:
+#line 248 "RelParser.y"
 {
     Log(Cont) << ", " << EchoOpt->count() << " opt(s) total." << LogEnd;
 ;
     break;}
-case 43:
-#line 250 "RelParser.y"
+case 46:
+#line 254 "RelParser.y"
 {
     EchoOpt->addOption(yyvsp[0].ival);
     Log(Cont) << " " << yyvsp[0].ival;
 ;
     break;}
-case 44:
-#line 255 "RelParser.y"
+case 47:
+#line 259 "RelParser.y"
 {
     EchoOpt->addOption(yyvsp[0].ival);
     Log(Cont) << " " << yyvsp[0].ival;
 ;
     break;}
-case 45:
-#line 262 "RelParser.y"
+case 48:
+#line 266 "RelParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "failover-timeout must be at least 1 second." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setFailoverTimeout(yyvsp[0].ival);
+;
+    break;}
+case 49:
+#line 276 "RelParser.y"
+{
+    ParserOptStack.getLast()->setFailoverRetry(yyvsp[0].ival);
+;
+    break;}
+case 50:
+#line 282 "RelParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "failover-count must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setFailoverCount(yyvsp[0].ival);
+;
+    break;}
+case 51:
+#line 292 "RelParser.y"
 {
     if (!strncasecmp(yyvsp[0].strval,"before",6)) 
     {
@@ -1564,7 +1612,7 @@ YYLABEL(yyerrhandle)
 /* END */
 
  #line 1038 "../bison++/bison.cc"
-#line 282 "RelParser.y"
+#line 312 "RelParser.y"
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -249,10 +249,13 @@ typedef
 #define	REMOTE_ID_	271
 #define	ECHO_REQUEST_	272
 #define	GUESS_MODE_	273
-#define	STRING_	274
-#define	HEXNUMBER_	275
-#define	INTNUMBER_	276
-#define	IPV6ADDR_	277
+#define	FAILOVER_TIMEOUT_	274
+#define	FAILOVER_RETRY_	275
+#define	FAILOVER_COUNT_	276
+#define	STRING_	277
+#define	HEXNUMBER_	278
+#define	INTNUMBER_	279
+#define	IPV6ADDR_	280
 
 
 #line 169 "../bison++/bison.h"
@@ -317,6 +320,9 @@ static const int OPTION_;
 static const int REMOTE_ID_;
 static const int ECHO_REQUEST_;
 static const int GUESS_MODE_;
+static const int FAILOVER_TIMEOUT_;
+static const int FAILOVER_RETRY_;
+static const int FAILOVER_COUNT_;
 static const int STRING_;
 static const int HEXNUMBER_;
 static const int INTNUMBER_;
@@ -345,10 +351,13 @@ static const int IPV6ADDR_;
 	,REMOTE_ID_=271
 	,ECHO_REQUEST_=272
 	,GUESS_MODE_=273
-	,STRING_=274
-	,HEXNUMBER_=275
-	,INTNUMBER_=276
-	,IPV6ADDR_=277
+	,FAILOVER_TIMEOUT_=274
+	,FAILOVER_RETRY_=275
+	,FAILOVER_COUNT_=276
+	,STRING_=277
+	,HEXNUMBER_=278
+	,INTNUMBER_=279
+	,IPV6ADDR_=280
 
 
 #line 215 "../bison++/bison.h"
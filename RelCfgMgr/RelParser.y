@@ -63,6 +63,7 @@ virtual ~RelParser();
 %token LOGNAME_, LOGLEVEL_, LOGMODE_, WORKDIR_
 %token DUID_, OPTION_, REMOTE_ID_, ECHO_REQUEST_
 %token GUESS_MODE_
+%token FAILOVER_TIMEOUT_, FAILOVER_RETRY_, FAILOVER_COUNT_
 
 %token <strval>     STRING_
 %token <ival>       HEXNUMBER_
@@ -99,6 +100,9 @@ GlobalOption
 | IfaceIDOrder
 | RemoteID
 | EchoRequest
+| FailoverTimeout
+| FailoverRetry
+| FailoverCount
 ;
 
 IfaceList
@@ -257,6 +261,32 @@ OptionIdList
     Log(Cont) << " " << $3;
 };
 
+FailoverTimeout
+:FAILOVER_TIMEOUT_ Number
+{
+    if (!$2) {
+	Log(Crit) << "failover-timeout must be at least 1 second." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setFailoverTimeout($2);
+};
+
+FailoverRetry
+:FAILOVER_RETRY_ Number
+{
+    ParserOptStack.getLast()->setFailoverRetry($2);
+};
+
+FailoverCount
+:FAILOVER_COUNT_ Number
+{
+    if (!$2) {
+	Log(Crit) << "failover-count must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setFailoverCount($2);
+};
+
 IfaceIDOrder
 :IFACE_ID_ORDER_ STRING_
 {
@@ -10,6 +10,7 @@
 #include <unistd.h>
 #include <fstream>
 #include "Logger.h"
+#include "StatsMgr.h"
 #include "IPv6Addr.h"
 #include "Iface.h"
 #include "SocketIPv6.h"
@@ -26,10 +27,12 @@ TRelIfaceMgr * TRelIfaceMgr::Instance = 0;
 using namespace std;
 
 /*
- * constructor. Do nothing particular, just invoke IfaceMgr constructor
+ * constructor. Invokes IfaceMgr constructor and subscribes to address changes,
+ * so link-address in relayed messages follows interface addresses.
  */
 TRelIfaceMgr::TRelIfaceMgr(const std::string& xmlFile) 
     : TIfaceMgr(xmlFile, true) {
+    trackIfaceEvents();
 }
 
 TRelIfaceMgr::~TRelIfaceMgr() {
@@ -75,9 +78,44 @@ bool TRelIfaceMgr::send(int ifindex, char *data, int dataLen, SPtr<TIPv6Addr> ad
     // send it!
     if (ptrSocket->send(data, dataLen, addr, port) < 0)
 	return false;
+    iface->countTx(data[0]);
     return true;
 }
 
+/**
+ * sends one datagram, stored in several fragments (e.g. relay header and
+ * message as received), to several addresses at once.
+ * @param ifindex interface ID
+ * @param bufs    fragments of the datagram (sent without copying)
+ * @param lens    fragment lengths
+ * @param bufCnt  number of fragments
+ * @param addrs   destination addresses
+ * @param port    UDP port to send the data to
+ * returns true if message was sent to all addresses
+ */
+bool TRelIfaceMgr::send(int ifindex, char **bufs, int *lens, int bufCnt, List(TIPv6Addr) & addrs, int port)
+{
+    SPtr<TIfaceIface> iface = this->getIfaceByID(ifindex);
+    if (!iface) {
+	Log(Error)  << "Send failed: No such interface id=" << ifindex << LogEnd;
+	return false;
+    }
+
+    SPtr<TIfaceSocket> ptrSocket;
+    iface->firstSocket();
+    ptrSocket = iface->getSocket();
+    if (!ptrSocket) {
+	Log(Error) << "Send failed: interface " << iface->getName() 
+		   << "/" << iface->getID() << " has no open sockets." << LogEnd;
+	return false;
+    }
+
+    int sent = ptrSocket->send(bufs, lens, bufCnt, addrs, port);
+    for (int i = 0; i < sent; i++)
+        iface->countTx(bufs[0][0]);
+    return sent == addrs.count();
+}
+
 /**
  * reads messages from all interfaces
  * it's wrapper around IfaceMgr::select(...) method
@@ -99,6 +137,7 @@ SPtr<TRelMsg> TRelIfaceMgr::select(unsigned long timeout) {
     if (sockid>0) {
 	if (dataLen<4) {
 	    Log(Warning) << "Received message is truncated (" << dataLen << " bytes)." << LogEnd;
+	    StatsMgr().DecodeErrors++;
 	    return 0; //NULL
 	}
 	
@@ -107,6 +146,7 @@ SPtr<TRelMsg> TRelIfaceMgr::select(unsigned long timeout) {
 
         if (msgtype > LEASEQUERY_REPLY_MSG) {
             Log(Warning) << "Invalid message type " << msgtype << " received." << LogEnd;
+            StatsMgr().DecodeErrors++;
             return 0;
         }
 	SPtr<TMsg> ptr;
@@ -127,7 +167,10 @@ SPtr<TRelMsg> TRelIfaceMgr::select(unsigned long timeout) {
 	    return 0;
 	}
 
-	return this->decodeMsg(iface, peer, data, dataLen);
+	SPtr<TRelMsg> msg = this->decodeMsg(iface, peer, data, dataLen);
+	if (!msg)
+	    StatsMgr().DecodeErrors++;
+	return msg;
     } 
     return 0;
 }
@@ -136,7 +179,9 @@ SPtr<TRelMsg> TRelIfaceMgr::decodeRelayForw(SPtr<TIfaceIface> iface,
 						SPtr<TIPv6Addr> peer, 
 						char * data, int dataLen) {
     int ifindex = iface->getID();
-    SPtr<TRelMsg> msg = new TRelMsgRelayForw(ifindex, peer, data, dataLen);
+    // options are not needed: message is relayed as received
+    SPtr<TRelMsg> msg = new TRelMsgRelayForw(ifindex, peer, data, dataLen, false);
+    msg->setRawData(data, dataLen);
     return msg;
 }
 
@@ -144,7 +189,10 @@ SPtr<TRelMsg> TRelIfaceMgr::decodeGeneric(SPtr<TIfaceIface> iface,
 					      SPtr<TIPv6Addr> peer, 
 					      char * buf, int bufsize) {
     int ifindex = iface->getID();
-    return new TRelMsgGeneric(ifindex, peer, buf, bufsize);
+    // options are not needed: message is relayed as received
+    SPtr<TRelMsg> msg = new TRelMsgGeneric(ifindex, peer, buf, bufsize, false);
+    msg->setRawData(buf, bufsize);
+    return msg;
 }
 
 SPtr<TRelMsg> TRelIfaceMgr::decodeRelayRepl(SPtr<TIfaceIface> iface, 
@@ -258,6 +306,7 @@ SPtr<TRelMsg> TRelIfaceMgr::decodeRelayRepl(SPtr<TIfaceIface> iface,
     case RELAY_REPL_MSG:
 	//msg = this->decodeRelayRepl(iface, peer, buf, bufsize);
 	msg = new TRelMsgRelayRepl(iface->getID(), peer, relayBuf, relayLen);
+	msg->setRawData(relayBuf, relayLen);
 	break;
     case RELAY_FORW_MSG:
 	Log(Error) << "RELAY_REPL contains RELAY_FORW message." << LogEnd;
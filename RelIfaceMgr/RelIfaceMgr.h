@@ -41,6 +41,7 @@ class TRelIfaceMgr: public TIfaceMgr {
     
     // ---sends messages---
     bool send(int iface, char *data, int dataLen, SPtr<TIPv6Addr> addr, int port);
+    bool send(int iface, char **bufs, int *lens, int bufCnt, List(TIPv6Addr) & addrs, int port);
     
     // ---receives messages---
     SPtr<TRelMsg> select(unsigned long timeout);
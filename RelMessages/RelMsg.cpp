@@ -16,14 +16,15 @@
 #include "RelOptGeneric.h"
 
 //Constructor builds message on the basis of received message
-TRelMsg::TRelMsg(int iface,  SPtr<TIPv6Addr> addr, char* data,  int dataLen)
-    :TMsg(iface, addr, data, dataLen) {
+TRelMsg::TRelMsg(int iface,  SPtr<TIPv6Addr> addr, char* data,  int dataLen, bool decode)
+    :TMsg(iface, addr, data, dataLen), RawData(0), RawLen(0) {
     // data+=4, dataLen-=4 is modified in TMsg
     if (dataLen<=0) // avoid decoding of empty messages.
         return;
 
     this->HopCount = 0;
-    this->decodeOpts(data, dataLen);
+    if (decode)
+        this->decodeOpts(data, dataLen);
 }
 
 void TRelMsg::decodeOpts(char * buf, int bufSize) {
@@ -96,3 +97,20 @@ SPtr<TIPv6Addr> TRelMsg::getDestAddr() {
 int TRelMsg::getHopCount() {
     return this->HopCount;
 }
+
+/**
+ * remembers where the message was received, so it can be relayed without
+ * storing it again. Data is not copied.
+ */
+void TRelMsg::setRawData(char * data, int dataLen) {
+    this->RawData = data;
+    this->RawLen  = dataLen;
+}
+
+char * TRelMsg::getRawData() {
+    return this->RawData;
+}
+
+int TRelMsg::getRawLen() {
+    return this->RawLen;
+}
@@ -17,19 +17,27 @@ class TRelMsg;
 class TRelMsg : public TMsg
 {
 public:
-    TRelMsg(int iface,  SPtr<TIPv6Addr> addr, char* data,  int dataLen);
+    TRelMsg(int iface,  SPtr<TIPv6Addr> addr, char* data,  int dataLen, bool decode = true);
     virtual bool check() = 0;
     void setDestination(int ifindex, SPtr<TIPv6Addr> dest);
     int getDestIface();
     SPtr<TIPv6Addr> getDestAddr();
     void decodeOpts(char * data, int dataLen);
     int getHopCount();
+
+    void setRawData(char * data, int dataLen);
+    char * getRawData();
+    int getRawLen();
     
  protected:
     int DestIface;
     SPtr<TIPv6Addr>   DestAddr;
 
     int HopCount; // mormal messages =0, RELAY_FORW, RELAY_REPL = (0..32)
+
+    // message as received (points to receive buffer, valid until next receive)
+    char * RawData;
+    int RawLen;
 };
 
 #endif
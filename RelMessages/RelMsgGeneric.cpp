@@ -13,8 +13,8 @@
 
 using namespace std;
 
-TRelMsgGeneric::TRelMsgGeneric(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen)
-    :TRelMsg(iface, addr, data, dataLen) {
+TRelMsgGeneric::TRelMsgGeneric(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen, bool decode)
+    :TRelMsg(iface, addr, data, dataLen, decode) {
 
 }
 
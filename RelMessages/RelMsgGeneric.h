@@ -16,7 +16,7 @@
 class TRelMsgGeneric: public TRelMsg {
 
  public:
-    TRelMsgGeneric(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen);
+    TRelMsgGeneric(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen, bool decode = true);
     std::string getName() const;
     bool check();
 };
@@ -14,7 +14,7 @@
 
 // --- options ---
 
-TRelMsgRelayForw::TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen)
+TRelMsgRelayForw::TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen, bool decode)
     :TRelMsg(iface, addr, 0, 0) // 0,0 - avoid decoding anything
 {
     this->MsgType = RELAY_FORW_MSG;
@@ -24,7 +24,7 @@ TRelMsgRelayForw::TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data,
     }
 
     this->MsgType  = data[0]; // ignored
-    this->HopCount = data[1];
+    this->HopCount = (unsigned char)data[1];
     if (this->HopCount >= HOP_COUNT_LIMIT) {
 	Log(Warning) << "RelayForw with hopLimit " << this->HopCount << " received (max. allowed is " << HOP_COUNT_LIMIT
 		     << ". Message dropped." << LogEnd;
@@ -39,11 +39,13 @@ TRelMsgRelayForw::TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data,
     dataLen -= 34;
 
     // decode options
-    this->decodeOpts(data, dataLen);
+    if (decode)
+        this->decodeOpts(data, dataLen);
 }
 
 bool TRelMsgRelayForw::check() {
-    return true;
+    // message that went through too many relays must not be relayed again
+    return this->HopCount < HOP_COUNT_LIMIT;
 }
 
 std::string TRelMsgRelayForw::getName() const {
@@ -65,8 +67,7 @@ int TRelMsgRelayForw::storeSelf(char * buffer)
 
     TOptList::iterator option;
     for (option=Options.begin(); option!=Options.end(); ++option) {
-        (*option)->storeSelf(buffer);
-	buffer += (*option)->getSize();
+        buffer = (*option)->storeSelf(buffer);
     }
     return buffer-start;
 }
@@ -19,7 +19,7 @@
 class TRelMsgRelayForw: public TRelMsg {
 
  public:
-    TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen);
+    TRelMsgRelayForw(int iface, SPtr<TIPv6Addr> addr, char * data, int dataLen, bool decode = true);
     std::string getName() const;
     bool check();
 
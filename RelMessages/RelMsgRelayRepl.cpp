@@ -72,8 +72,7 @@ int TRelMsgRelayRepl::storeSelf(char * buffer)
 
     TOptList::iterator option;
     for (option=Options.begin(); option!=Options.end(); ++option) {
-        (*option)->storeSelf(buffer);
-	buffer += (*option)->getSize();
+        buffer = (*option)->storeSelf(buffer);
     }
     return buffer-start;
 }
@@ -14,6 +14,7 @@
 #define RELAY_FORW_MSG_LEN 36
 
 #include <fstream>
+#include <string.h>
 #include "RelTransMgr.h"
 #include "RelCfgMgr.h"
 #include "RelIfaceMgr.h"
@@ -23,11 +24,22 @@
 #include "Logger.h"
 #include "Portable.h"
 
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#include <sys/select.h>
+#include <signal.h>
+#endif
+
 TRelTransMgr * TRelTransMgr::Instance = 0; // singleton implementation
 
 TRelTransMgr::TRelTransMgr(const std::string xmlFile)
-    :XmlFile(xmlFile), IsDone(false)
+    :XmlFile(xmlFile), IsDone(false), WorkersRunning(false)
 {
+#ifndef WIN32
+    pthread_mutex_init(&this->SharedLock, NULL);
+#endif
     // for each interface in CfgMgr, create socket (in IfaceMgr)
     SPtr<TRelCfgIface> confIface;
     RelCfgMgr().firstIface();
@@ -36,7 +48,10 @@ TRelTransMgr::TRelTransMgr(const std::string xmlFile)
 	    this->IsDone = true;
 	    break;
 	}
+	this->prepareForwHdr(confIface);
+	this->prepareUpstream(confIface);
     }
+    this->LinkAddrChanges = RelIfaceMgr().addrChanges();
 }
 
 /*
@@ -98,77 +113,58 @@ bool TRelTransMgr::openSocket(SPtr<TRelCfgIface> cfgIface) {
 
 
 /**
- * relays normal (i.e. not server replies) messages to defined servers
+ * builds RELAY-FORW for messages received on this interface. Everything
+ * except hop-count, peer-addr and relay-msg length is the same for all
+ * messages, so it is stored once and relayed messages are only wrapped
+ * with it.
  */
-void TRelTransMgr::relayMsg(SPtr<TRelMsg> msg)
+void TRelTransMgr::prepareForwHdr(SPtr<TRelCfgIface> cfgIface)
 {
-    static char buf[MAX_PACKET_LEN];
-    int offset = 0;
-    int bufLen;
-    int hopCount = 0;
-    if (!msg->check()) {
-	Log(Warning) << "Invalid message received." << LogEnd;
-	return;
-    }
-
-    if (msg->getDestAddr()) {
-	this->relayMsgRepl(msg);
-	return;
-    }
-
-    if (msg->getType() == RELAY_FORW_MSG) {
-	hopCount = msg->getHopCount()+1;
-    }
-
-    // prepare message
-    SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(msg->getIface());
+    SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(cfgIface->getID());
+    TRelayForwHdr & hdr = this->ForwHdrs[cfgIface->getID()];
+    char * buf = hdr.Prefix;
+    static char tmp[MAX_PACKET_LEN];
+    char * end = tmp;
     SPtr<TIPv6Addr> addr;
 
-    // store header
-    buf[offset++] = RELAY_FORW_MSG;
-    buf[offset++] = hopCount;
+    // store header (hop-count is set for each message)
+    *(buf++) = RELAY_FORW_MSG;
+    *(buf++) = 0;
 
-    // store link-addr
-    iface->firstGlobalAddr();
-    addr = iface->getGlobalAddr();
+    // store link-addr (updated in updateLinkAddrs() when addresses change)
+    addr = linkAddr(iface);
     if (!addr) {
 	Log(Warning) << "Interface " << iface->getFullName() << " does not have global address." << LogEnd;
 	addr = new TIPv6Addr("::", true);
     }
-    addr->storeSelf(buf+offset);
-    offset += 16;
+    addr->storeSelf(buf);
+    buf += 16;
 
-    // store peer-addr
-    addr = msg->getAddr();
-    addr->storeSelf(buf+offset);
-    offset += 16;
+    // peer-addr is set for each message
+    memset(buf, 0, 16);
+    buf += 16;
 
-    SPtr<TRelCfgIface> cfgIface;
-    cfgIface = RelCfgMgr().getIfaceByID(msg->getIface());
     TRelOptInterfaceID ifaceID(cfgIface->getInterfaceID(), 0);
 
     if (RelCfgMgr().getInterfaceIDOrder()==REL_IFACE_ID_ORDER_BEFORE)
     {
 	// store InterfaceID option
-	ifaceID.storeSelf(buf + offset);
-	offset += ifaceID.getSize();
-	Log(Debug) << "Interface-id option added before relayed message." << LogEnd;
+	buf = ifaceID.storeSelf(buf);
+	Log(Debug) << "Interface-id option will be added before relayed message on the "
+		   << iface->getFullName() << " interface." << LogEnd;
     }
 
-    // store relay msg option
-    writeUint16((buf+offset), OPTION_RELAY_MSG);
-    offset += sizeof(uint16_t);
-    writeUint16((buf+offset), msg->getSize());
-    offset += sizeof(uint16_t);
-    bufLen = msg->storeSelf(buf+offset);
-    offset += bufLen;
+    // store relay msg option header (length is set for each message)
+    buf = writeUint16(buf, OPTION_RELAY_MSG);
+    buf = writeUint16(buf, 0);
+    hdr.PrefixLen = buf - hdr.Prefix;
 
     if (RelCfgMgr().getInterfaceIDOrder()==REL_IFACE_ID_ORDER_AFTER)
     {
 	// store InterfaceID option
-	ifaceID.storeSelf(buf + offset);
-	offset += ifaceID.getSize();
-	Log(Debug) << "Interface-id option added after relayed message." << LogEnd;
+	end = ifaceID.storeSelf(end);
+	Log(Debug) << "Interface-id option will be added after relayed message on the "
+		   << iface->getFullName() << " interface." << LogEnd;
     }
 
     if (RelCfgMgr().getInterfaceIDOrder()==REL_IFACE_ID_ORDER_NONE)
@@ -179,18 +175,16 @@ void TRelTransMgr::relayMsg(SPtr<TRelMsg> msg)
 
     SPtr<TOptVendorData> remoteID = RelCfgMgr().getRemoteID();
     if (remoteID) {
-	remoteID->storeSelf(buf+offset);
-	offset += remoteID->getSize();
-	Log(Debug) << "Appended RemoteID with " << remoteID->getVendorDataLen() 
-		   << "-byte long data (option length="
-		   << remoteID->getSize() << ")." << LogEnd;
+	char * start = end;
+	end = remoteID->storeSelf(end);
+	Log(Debug) << "RemoteID with " << remoteID->getVendorDataLen() 
+		   << "-byte long data (option length=" << (end - start) << ") will be appended." << LogEnd;
     }
 
     SPtr<TRelOptEcho> echo = RelCfgMgr().getEcho();
     if (echo) {
-	echo->storeSelf(buf+offset);
-	offset += echo->getSize();
-	Log(Debug) << "Appended EchoRequest option with ";
+	end = echo->storeSelf(end);
+	Log(Debug) << "EchoRequest option will be appended with ";
 
 	int i=0;
 	char tmpBuf[256];
@@ -200,42 +194,517 @@ void TRelTransMgr::relayMsg(SPtr<TRelMsg> msg)
 	for (int i=0; i<echo->count(); i++) {
 	    int code = echo->getReqOpt(i);
 	    SPtr<TRelOptGeneric> gen = new TRelOptGeneric(code, tmpBuf, 4, 0);
-	    gen->storeSelf(buf+offset);
-	    offset += gen->getSize();
+	    end = gen->storeSelf(end);
 	    Log(Cont) << code << " ";
 	}
 	Log(Cont) << " opt(s)." << LogEnd;
     }
 
-    RelCfgMgr().firstIface();
-    while (cfgIface = RelCfgMgr().getIface()) {
-	if (cfgIface->getServerUnicast()) {
-	    Log(Notice) << "Relaying encapsulated " << msg->getName() << " message on the " << cfgIface->getFullName()
-			<< " interface to unicast (" << cfgIface->getServerUnicast()->getPlain() << ") address, port "
-			<< DHCPSERVER_PORT << "." << LogEnd;
+    hdr.Suffix.assign(tmp, end - tmp);
+}
 
-	    if (!RelIfaceMgr().send(cfgIface->getID(), buf, offset, cfgIface->getServerUnicast(), DHCPSERVER_PORT)) {
-		Log(Error) << "Failed to send data to server unicast address." << LogEnd;
-	    }
+/**
+ * copies RELAY-FORW header prepared for an interface and sets fields that
+ * differ for each message. Used by both main thread and workers.
+ *
+ * @param hdr header prepared by prepareForwHdr()
+ * @param prefix buffer (RELAY_FORW_PREFIX_MAX bytes), hdr.PrefixLen bytes are stored
+ * @param hopCount hop-count to set
+ * @param peer packed (16 bytes) peer-addr
+ * @param dataLen length of the relayed message
+ */
+void TRelTransMgr::patchForwHdr(const TRelayForwHdr & hdr, char * prefix, int hopCount,
+				const char * peer, int dataLen)
+{
+    memcpy(prefix, hdr.Prefix, hdr.PrefixLen);
+    prefix[1] = hopCount;
+    memcpy(prefix + 18, peer, 16);
+    writeUint16(prefix + hdr.PrefixLen - sizeof(uint16_t), dataLen);
+}
+
+/**
+ * returns address used as link-addr for messages received on this interface
+ * (first global address), NULL if there is none
+ */
+SPtr<TIPv6Addr> TRelTransMgr::linkAddr(SPtr<TIfaceIface> iface)
+{
+    iface->firstGlobalAddr();
+    return iface->getGlobalAddr();
+}
 
+/**
+ * re-reads link-addr of all RELAY-FORW headers if addresses have changed since
+ * last time (RelIfaceMgr tracks address notifications). Cheap when nothing
+ * changed, so it is called after every select().
+ */
+void TRelTransMgr::updateLinkAddrs()
+{
+    unsigned long changes = RelIfaceMgr().addrChanges();
+    if (changes == this->LinkAddrChanges)
+	return;
+    this->LinkAddrChanges = changes;
+
+    for (std::map<int, TRelayForwHdr>::iterator hdr = this->ForwHdrs.begin();
+	 hdr != this->ForwHdrs.end(); ++hdr) {
+	SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(hdr->first);
+	if (!iface)
+	    continue;
+	SPtr<TIPv6Addr> addr = linkAddr(iface);
+	if (!addr)
+	    addr = new TIPv6Addr("::", true);
+	if (!memcmp(hdr->second.Prefix + 2, addr->getAddr(), 16))
+	    continue;
+
+	Log(Notice) << "Link-address for messages received on " << iface->getFullName()
+		    << " changed to " << addr->getPlain() << "." << LogEnd;
+#ifndef WIN32
+	pthread_mutex_lock(&this->SharedLock);
+#endif
+	addr->storeSelf(hdr->second.Prefix + 2);
+#ifndef WIN32
+	pthread_mutex_unlock(&this->SharedLock);
+#endif
+    }
+}
+
+/**
+ * remembers server addresses reachable over this interface. Multicast
+ * destination gets every message, unicast servers (from all interfaces)
+ * share clients among themselves.
+ */
+void TRelTransMgr::prepareUpstream(SPtr<TRelCfgIface> cfgIface)
+{
+    if (cfgIface->getServerUnicast()) {
+	TRelayServer srv;
+	srv.Iface      = cfgIface->getID();
+	srv.Name       = cfgIface->getFullName();
+	srv.Addr       = cfgIface->getServerUnicast();
+	memcpy(srv.Packed, srv.Addr->getAddr(), 16);
+	srv.FD         = -1;
+	srv.Alive      = true;
+	srv.DeadSince  = 0;
+	srv.LastReply  = 0;
+	srv.Sent       = 0;
+	srv.Answered   = 0;
+	srv.Lost       = 0;
+	srv.Unanswered = 0;
+	srv.Failovers  = 0;
+	srv.LatencySum = 0;
+	srv.LatencyMax = 0;
+	this->Servers.push_back(srv);
+    }
+
+    if (cfgIface->getServerMulticast()) {
+	TRelayUpstream up;
+	up.Iface = cfgIface->getID();
+	up.Name  = cfgIface->getFullName();
+	SPtr<TIPv6Addr> addr = new TIPv6Addr(ALL_DHCP_SERVERS, true);
+	up.Addrs.append(addr);
+	memcpy(up.Packed, addr->getAddr(), 16);
+	up.FD = -1;
+	this->Upstreams.push_back(up);
+    }
+}
+
+/**
+ * finds option in the options part of a message
+ *
+ * @param buf options
+ * @param bufLen length of the options
+ * @param optType option to look for
+ * @param optLen length of the option data will be stored here
+ *
+ * @return pointer to the option data or 0, if there is no such option
+ */
+static char * findOpt(char * buf, int bufLen, int optType, int & optLen)
+{
+    while (bufLen >= 4) {
+	int code = readUint16(buf);
+	int len  = readUint16(buf + sizeof(uint16_t));
+	if (len > bufLen - 4)
+	    return 0;
+	if (code == optType) {
+	    optLen = len;
+	    return buf + 4;
 	}
-	if (cfgIface->getServerMulticast()) {
-	    addr = new TIPv6Addr(ALL_DHCP_SERVERS, true);
-	    Log(Notice) << "Relaying encapsulated " << msg->getName() << " message on the " << cfgIface->getFullName()
-			<< " interface to multicast (" << addr->getPlain() << ") address, port "
-			<< DHCPSERVER_PORT << "." << LogEnd;
-	    if (!RelIfaceMgr().send(cfgIface->getID(), buf, offset, addr, DHCPSERVER_PORT)) {
-		Log(Error) << "Failed to send data to server multicast address." << LogEnd;
-	    }
+	buf    += 4 + len;
+	bufLen -= 4 + len;
+    }
+    return 0;
+}
+
+/**
+ * finds data identifying client: remote-id inserted by other relay
+ * or client DUID. Relayed messages are searched recursively.
+ *
+ * @param data message
+ * @param dataLen message length
+ * @param keyLen key length will be stored here
+ *
+ * @return pointer to the key or 0, if not found
+ */
+char * TRelTransMgr::findClientKey(char * data, int dataLen, int & keyLen)
+{
+    int len;
+    for (int hop = 0; hop < HOP_COUNT_LIMIT && dataLen >= 4; hop++) {
+	if (data[0] != RELAY_FORW_MSG && data[0] != RELAY_REPL_MSG)
+	    return findOpt(data + 4, dataLen - 4, OPTION_CLIENTID, keyLen);
+	if (dataLen < 34)
+	    return 0;
+	char * key = findOpt(data + 34, dataLen - 34, OPTION_REMOTE_ID, keyLen);
+	if (key)
+	    return key;
+	data = findOpt(data + 34, dataLen - 34, OPTION_RELAY_MSG, len);
+	if (!data)
+	    return 0;
+	dataLen = len;
+    }
+    return 0;
+}
+
+/**
+ * returns transaction-id of the (possibly relayed) client/server message
+ */
+static bool findTransID(char * data, int dataLen, unsigned long & transID)
+{
+    int len;
+    for (int hop = 0; hop < HOP_COUNT_LIMIT && dataLen >= 4; hop++) {
+	if (data[0] != RELAY_FORW_MSG && data[0] != RELAY_REPL_MSG) {
+	    transID = readUint32(data) & 0x00ffffff;
+	    return true;
+	}
+	if (dataLen < 34)
+	    return false;
+	data = findOpt(data + 34, dataLen - 34, OPTION_RELAY_MSG, len);
+	if (!data)
+	    return false;
+	dataLen = len;
+    }
+    return false;
+}
+
+/**
+ * chooses unicast server for a message (rendezvous hashing). The same client
+ * is always relayed to the same server as long as that server is alive.
+ * When server goes down, only its clients are moved to other servers.
+ * Called by worker threads, too, so it must not modify anything.
+ *
+ * @param peer packed client address, used if there is no better key
+ *
+ * @return index of the chosen server or -1, if there are no unicast servers
+ */
+int TRelTransMgr::selectServer(char * data, int dataLen, char * peer)
+{
+    if (this->Servers.empty())
+	return -1;
+
+    int keyLen = 0;
+    char * key = findClientKey(data, dataLen, keyLen);
+    if (!key) {
+	key    = peer;
+	keyLen = 16;
+    }
+
+    // FNV-1a
+    unsigned long keyHash = 2166136261UL;
+    for (int i = 0; i < keyLen; i++)
+	keyHash = ((keyHash ^ (unsigned char)key[i]) * 16777619UL) & 0xffffffffUL;
+
+    int best = -1, bestAlive = -1;
+    unsigned long bestScore = 0, bestAliveScore = 0;
+    for (unsigned int i = 0; i < this->Servers.size(); i++) {
+	const TRelayServer & srv = this->Servers[i];
+	unsigned long score = keyHash;
+	for (int j = 0; j < 16; j++)
+	    score = ((score ^ (unsigned char)srv.Packed[j]) * 16777619UL) & 0xffffffffUL;
+
+	if (best == -1 || score > bestScore) {
+	    best = i;
+	    bestScore = score;
+	}
+	if (srv.Alive && (bestAlive == -1 || score > bestAliveScore)) {
+	    bestAlive = i;
+	    bestAliveScore = score;
 	}
     }
 
-    // save DB state regardless of action taken
-    RelCfgMgr().dump();
+    // all servers are down, keep relaying to the usual one
+    return bestAlive != -1 ? bestAlive : best;
+}
+
+/**
+ * remembers that message was relayed to the server, so its reply can be matched
+ */
+void TRelTransMgr::serverSent(int server, SPtr<TRelMsg> msg)
+{
+    this->Servers[server].Sent++;
+
+    char * data = msg->getRawData();
+    static char buf[MAX_PACKET_LEN];
+    int dataLen = msg->getRawLen();
+    if (!data) {
+	dataLen = msg->storeSelf(buf);
+	data    = buf;
+    }
+
+    unsigned long transID;
+    if (findTransID(data, dataLen, transID))
+	this->addPending(server, transID, now_ms());
+}
+
+void TRelTransMgr::addPending(int server, unsigned long transID, unsigned long long sent)
+{
+    if (this->Pending.size() >= RELAY_MAX_PENDING)
+	return;
+
+    TRelayPendingKey key(server, transID);
+    this->Pending[key].Sent = sent;
+    this->PendingQueue.push_back(std::make_pair(sent, key));
+}
+
+/**
+ * takes over messages relayed by worker threads since the last call,
+ * so their replies can be matched
+ */
+void TRelTransMgr::drainWorkers()
+{
+#ifndef WIN32
+    std::vector<TRelaySent> sent;
+    for (unsigned int i = 0; i < this->Workers.size(); i++) {
+	TRelayWorker * w = this->Workers[i];
+	pthread_mutex_lock(&w->Lock);
+	sent.swap(w->SentLog);
+	pthread_mutex_unlock(&w->Lock);
+
+	for (unsigned int j = 0; j < sent.size(); j++)
+	    this->addPending(sent[j].Server, sent[j].TransID, sent[j].Sent);
+	sent.clear();
+    }
+#endif
+}
+
+/**
+ * matches server reply with the relayed transaction, updates server
+ * latency and marks server as alive
+ */
+void TRelTransMgr::serverReplied(SPtr<TRelMsg> msg)
+{
+    if (this->Servers.empty())
+	return;
+
+    unsigned long long current = now_ms();
+    int server = -1;
+
+    this->drainWorkers();
+
+    char * data = msg->getRawData();
+    static char buf[MAX_PACKET_LEN];
+    int dataLen = msg->getRawLen();
+    if (!data) {
+	dataLen = msg->storeSelf(buf);
+	data    = buf;
+    }
+
+    // server is recognized by its address; transaction-id only tells
+    // which of its transactions was answered
+    for (unsigned int i = 0; i < this->Servers.size(); i++) {
+	if (*this->Servers[i].Addr == *msg->getAddr()) {
+	    server = i;
+	    break;
+	}
+    }
+
+    unsigned long transID;
+    std::map<TRelayPendingKey, TRelayPending>::iterator it = this->Pending.end();
+    if (findTransID(data, dataLen, transID)) {
+	if (server != -1) {
+	    it = this->Pending.find(TRelayPendingKey(server, transID));
+	} else {
+	    // replied from other address than the one we send to
+	    for (unsigned int i = 0; i < this->Servers.size() && it == this->Pending.end(); i++)
+		it = this->Pending.find(TRelayPendingKey(i, transID));
+	}
+    }
+    if (it != this->Pending.end()) {
+	server = it->first.first;
+	TRelayServer & srv = this->Servers[server];
+	unsigned long latency = (unsigned long)(current - it->second.Sent);
+	srv.Answered++;
+	srv.LatencySum += latency;
+	if (latency > srv.LatencyMax)
+	    srv.LatencyMax = latency;
+	this->Pending.erase(it);
+    }
+    if (server == -1)
+	return;
+
+    TRelayServer & srv = this->Servers[server];
+    srv.LastReply  = current;
+    srv.Unanswered = 0;
+    if (!srv.Alive) {
+	Log(Notice) << "Server " << srv.Addr->getPlain() << " (" << srv.Name
+		    << ") replied, considered up again." << LogEnd;
+	this->setAlive(srv, true);
+    }
+}
+
+/**
+ * changes server state; workers read it while choosing server
+ */
+void TRelTransMgr::setAlive(TRelayServer & srv, bool alive)
+{
+#ifndef WIN32
+    pthread_mutex_lock(&this->SharedLock);
+#endif
+    srv.Alive = alive;
+#ifndef WIN32
+    pthread_mutex_unlock(&this->SharedLock);
+#endif
+}
+
+/**
+ * expires transactions not answered in time. Server is considered down after
+ * failover-count such transactions in a row, if it did not send anything
+ * since the last of them was relayed to it. One lost transaction (e.g.
+ * client that went away, or a dropped packet) is not enough.
+ */
+void TRelTransMgr::expirePending()
+{
+    unsigned long long current = now_ms();
+    unsigned long long timeout = (unsigned long long)RelCfgMgr().getFailoverTimeout()*1000;
+
+    this->drainWorkers();
+
+    while (!this->PendingQueue.empty() && this->PendingQueue.front().first + timeout <= current) {
+	unsigned long long sent = this->PendingQueue.front().first;
+	std::map<TRelayPendingKey, TRelayPending>::iterator it =
+	    this->Pending.find(this->PendingQueue.front().second);
+	this->PendingQueue.pop_front();
+
+	// answered or retransmitted later
+	if (it == this->Pending.end() || it->second.Sent != sent)
+	    continue;
+
+	TRelayServer & srv = this->Servers[it->first.first];
+	this->Pending.erase(it);
+	srv.Lost++;
+	if (srv.LastReply >= sent)
+	    continue; // replied to something else meanwhile, so it is alive
+	srv.Unanswered++;
+	if (srv.Alive && srv.Unanswered >= RelCfgMgr().getFailoverCount()) {
+	    Log(Warning) << "Server " << srv.Addr->getPlain() << " (" << srv.Name << ") did not answer "
+			 << srv.Unanswered << " transaction(s) in a row within "
+			 << RelCfgMgr().getFailoverTimeout() << " second(s), considered down. Its clients "
+			 << "will be relayed to other servers." << LogEnd;
+	    this->setAlive(srv, false);
+	    srv.DeadSince = now();
+	    srv.Failovers++;
+	}
+    }
+
+    for (unsigned int i = 0; i < this->Servers.size(); i++) {
+	TRelayServer & srv = this->Servers[i];
+	if (!srv.Alive && (unsigned long)now() - srv.DeadSince >= RelCfgMgr().getFailoverRetry()) {
+	    Log(Notice) << "Server " << srv.Addr->getPlain() << " (" << srv.Name
+			<< ") was down for " << RelCfgMgr().getFailoverRetry()
+			<< " seconds, trying it again." << LogEnd;
+	    this->setAlive(srv, true);
+	}
+    }
+}
+
+/**
+ * relays normal (i.e. not server replies) messages to defined servers
+ *
+ * Message is relayed as it was received: only the pre-built RELAY-FORW
+ * header is patched and both are passed to the kernel without copying
+ * into one buffer. All addresses on one interface are sent in one batch.
+ * Multicast destinations get every message, but only one of the unicast
+ * servers is chosen for each client (see selectServer()).
+ */
+void TRelTransMgr::relayMsg(SPtr<TRelMsg> msg)
+{
+    static char buf[MAX_PACKET_LEN];
+    char prefix[RELAY_FORW_PREFIX_MAX];
+    char * data;
+    int dataLen;
+    int hopCount = 0;
+    if (!msg->check()) {
+	Log(Warning) << "Invalid message received." << LogEnd;
+	return;
+    }
+
+    if (msg->getDestAddr()) {
+	this->relayMsgRepl(msg);
+	return;
+    }
+
+    if (msg->getType() == RELAY_FORW_MSG) {
+	hopCount = msg->getHopCount()+1;
+    }
+
+    std::map<int, TRelayForwHdr>::iterator hdr = this->ForwHdrs.find(msg->getIface());
+    if (hdr == this->ForwHdrs.end()) {
+	Log(Error) << "Unable to relay message received on not configured interface (ifindex="
+		   << msg->getIface() << ")." << LogEnd;
+	return;
+    }
+
+    // use message as received, if possible
+    data    = msg->getRawData();
+    dataLen = msg->getRawLen();
+    if (!data) {
+	dataLen = msg->storeSelf(buf);
+	data    = buf;
+    }
+
+    // set hop-count, peer-addr and relay-msg length
+    patchForwHdr(hdr->second, prefix, hopCount, msg->getAddr()->getAddr(), dataLen);
+
+    char * bufs[3] = { prefix, data, (char*)hdr->second.Suffix.data() };
+    int    lens[3] = { hdr->second.PrefixLen, dataLen, (int)hdr->second.Suffix.size() };
+
+    this->expirePending();
+
+    for (std::list<TRelayUpstream>::iterator up = this->Upstreams.begin();
+	 up != this->Upstreams.end(); ++up) {
+	Log(Notice) << "Relaying encapsulated " << msg->getName() << " message on the " << up->Name
+		    << " interface to";
+	SPtr<TIPv6Addr> addr;
+	up->Addrs.first();
+	while (addr = up->Addrs.get())
+	    Log(Cont) << " " << addr->getPlain();
+	Log(Cont) << ", port " << DHCPSERVER_PORT << "." << LogEnd;
+
+	if (!RelIfaceMgr().send(up->Iface, bufs, lens, 3, up->Addrs, DHCPSERVER_PORT)) {
+	    Log(Error) << "Failed to send data to server address(es)." << LogEnd;
+	}
+    }
+
+    int server = this->selectServer(data, dataLen, msg->getAddr()->getAddr());
+    if (server == -1)
+	return;
+
+    TRelayServer & srv = this->Servers[server];
+    List(TIPv6Addr) addrs;
+    addrs.append(srv.Addr);
+    Log(Notice) << "Relaying encapsulated " << msg->getName() << " message on the " << srv.Name
+		<< " interface to " << srv.Addr->getPlain() << ", port " << DHCPSERVER_PORT;
+    if (this->Servers.size() > 1)
+	Log(Cont) << " (server " << server+1 << " of " << this->Servers.size() << ")";
+    Log(Cont) << "." << LogEnd;
+
+    if (!RelIfaceMgr().send(srv.Iface, bufs, lens, 3, addrs, DHCPSERVER_PORT)) {
+	Log(Error) << "Failed to send data to server address." << LogEnd;
+	return;
+    }
+    this->serverSent(server, msg);
 }
 
 void TRelTransMgr::relayMsgRepl(SPtr<TRelMsg> msg) {
     int port;
+    this->serverReplied(msg);
+
     SPtr<TRelCfgIface> cfgIface = RelCfgMgr().getIfaceByInterfaceID(msg->getDestIface());
     if (!cfgIface) {
 	Log(Error) << "Unable to relay message: Invalid interfaceID value:" << msg->getDestIface() << LogEnd;
@@ -245,6 +714,7 @@ void TRelTransMgr::relayMsgRepl(SPtr<TRelMsg> msg) {
     SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(cfgIface->getID());
     SPtr<TIPv6Addr> addr = msg->getDestAddr();
     static char buf[MAX_PACKET_LEN];
+    char * data;
     int bufLen;
 
     if (!iface) {
@@ -253,7 +723,13 @@ void TRelTransMgr::relayMsgRepl(SPtr<TRelMsg> msg) {
 	return;
     }
 
-    bufLen = msg->storeSelf(buf);
+    // relay message as received, if possible
+    data = msg->getRawData();
+    bufLen = msg->getRawLen();
+    if (!data) {
+	bufLen = msg->storeSelf(buf);
+	data = buf;
+    }
     if (msg->getType() == RELAY_REPL_MSG)
 	port = DHCPSERVER_PORT;
     else
@@ -261,12 +737,358 @@ void TRelTransMgr::relayMsgRepl(SPtr<TRelMsg> msg) {
     Log(Notice) << "Relaying decapsulated " << msg->getName() << " message on the " << iface->getFullName()
 		<< " interface to the " << addr->getPlain() << ", port " << port << "." << LogEnd;
 
-    if (!RelIfaceMgr().send(iface->getID(), buf, bufLen, addr, port)) {
+    if (!RelIfaceMgr().send(iface->getID(), data, bufLen, addr, port)) {
 	Log(Error) << "Failed to decapsulated data." << LogEnd;
     }
 
 }
 
+/**
+ * returns socket used to send data on the interface (see TRelIfaceMgr::send())
+ */
+int TRelTransMgr::upstreamFD(int ifindex)
+{
+    SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(ifindex);
+    if (!iface)
+	return -1;
+    iface->firstSocket();
+    SPtr<TIfaceSocket> sock = iface->getSocket();
+    if (!sock)
+	return -1;
+    return sock->getFD();
+}
+
+/**
+ * Starts worker threads (if configured). Sockets of interfaces used only
+ * for receiving client messages are split among workers and removed from
+ * the main loop. Each worker relays messages from its sockets on its own,
+ * using the same RELAY-FORW headers and server selection as the main
+ * thread. Main thread still handles server replies and other interfaces.
+ */
+void TRelTransMgr::startWorkers()
+{
+    int count = RelCfgMgr().getWorkers();
+    if (count <= 0 || this->WorkersRunning)
+	return;
+
+#ifdef WIN32
+    Log(Warning) << "Worker threads are not supported on this system, all messages will be "
+		 << "relayed by the main thread." << LogEnd;
+#else
+    // sockets of each client-only interface
+    std::vector<std::vector<TRelayWorkerSocket> > ifaces;
+    SPtr<TRelCfgIface> cfgIface;
+    RelCfgMgr().firstIface();
+    while (cfgIface = RelCfgMgr().getIface()) {
+	if (cfgIface->getServerUnicast() || cfgIface->getServerMulticast())
+	    continue;
+	SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(cfgIface->getID());
+	if (!iface)
+	    continue;
+
+	std::vector<TRelayWorkerSocket> socks;
+	SPtr<TIfaceSocket> sock;
+	iface->firstSocket();
+	while (sock = iface->getSocket()) {
+	    TRelayWorkerSocket s;
+	    s.FD        = sock->getFD();
+	    s.Iface     = iface->getID();
+	    memcpy(s.Addr, sock->getAddr()->getAddr(), 16);
+	    s.CheckAddr = !iface->flagLoopback();
+	    socks.push_back(s);
+	}
+	if (!socks.empty())
+	    ifaces.push_back(socks);
+    }
+
+    if (ifaces.empty()) {
+	Log(Warning) << "There are no interfaces used for clients only, worker threads not started." << LogEnd;
+	return;
+    }
+    if (count > (int)ifaces.size())
+	count = ifaces.size();
+
+    for (unsigned int i = 0; i < this->Servers.size(); i++)
+	this->Servers[i].FD = this->upstreamFD(this->Servers[i].Iface);
+    for (std::list<TRelayUpstream>::iterator up = this->Upstreams.begin();
+	 up != this->Upstreams.end(); ++up)
+	up->FD = this->upstreamFD(up->Iface);
+
+    for (int i = 0; i < count; i++) {
+	TRelayWorker * w = new TRelayWorker();
+	w->ID       = i;
+	w->Mgr      = this;
+	w->Done     = false;
+	w->Counters.Received = 0;
+	w->Counters.Relayed  = 0;
+	w->Counters.Dropped  = 0;
+	w->Counters.Errors   = 0;
+	w->Counters.ServerSent.assign(this->Servers.size(), 0);
+	SPtr<TIfaceIface> iface;
+	RelIfaceMgr().firstIface();
+	while (iface = RelIfaceMgr().getIface())
+	    w->Counters.Stats[iface->getID()] = TStatsMsgCounters();
+	w->Shared    = w->Counters;
+	w->Published = now();
+	pthread_mutex_init(&w->Lock, NULL);
+	this->Workers.push_back(w);
+    }
+    for (unsigned int i = 0; i < ifaces.size(); i++) {
+	TRelayWorker * w = this->Workers[i % count];
+	w->Sockets.insert(w->Sockets.end(), ifaces[i].begin(), ifaces[i].end());
+    }
+
+    // workers don't handle signals, main thread does
+    sigset_t all, old;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    int started = 0;
+    for (int i = 0; i < count; i++) {
+	TRelayWorker * w = this->Workers[i];
+	if (pthread_create(&w->Thread, NULL, workerMain, w)) {
+	    Log(Error) << "Unable to start worker thread " << i << ", its " << w->Sockets.size()
+		       << " socket(s) will be handled by the main thread." << LogEnd;
+	    w->Done = true;
+	    w->Sockets.clear();
+	    continue;
+	}
+	for (unsigned int j = 0; j < w->Sockets.size(); j++)
+	    FD_CLR(w->Sockets[j].FD, TIfaceSocket::getFDS());
+	started++;
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    this->WorkersRunning = started > 0;
+    Log(Notice) << "Started " << started << " worker thread(s), relaying client messages received on "
+		<< ifaces.size() << " interface(s)." << LogEnd;
+#endif
+}
+
+/**
+ * stops worker threads and gives their sockets back to the main loop
+ */
+void TRelTransMgr::stopWorkers()
+{
+    if (!this->WorkersRunning)
+	return;
+#ifndef WIN32
+    for (unsigned int i = 0; i < this->Workers.size(); i++) {
+	pthread_mutex_lock(&this->Workers[i]->Lock);
+	this->Workers[i]->Done = true;
+	pthread_mutex_unlock(&this->Workers[i]->Lock);
+    }
+
+    for (unsigned int i = 0; i < this->Workers.size(); i++) {
+	TRelayWorker * w = this->Workers[i];
+	if (w->Sockets.empty())
+	    continue;
+	pthread_join(w->Thread, NULL);
+	for (unsigned int j = 0; j < w->Sockets.size(); j++)
+	    FD_SET(w->Sockets[j].FD, TIfaceSocket::getFDS());
+    }
+    Log(Notice) << "Worker threads stopped." << LogEnd;
+#endif
+    this->WorkersRunning = false;
+}
+
+/**
+ * returns max. time main loop may wait for messages. Workers must not wait
+ * for replies to be matched for too long.
+ */
+unsigned long TRelTransMgr::getTimeout()
+{
+    if (this->WorkersRunning)
+	return 1;
+    return DHCPV6_INFINITY/2;
+}
+
+void * TRelTransMgr::workerMain(void * arg)
+{
+    TRelayWorker * w = (TRelayWorker*)arg;
+    w->Mgr->workerLoop(w);
+    return 0;
+}
+
+/**
+ * worker thread main loop. Nothing is logged here (logger is not thread
+ * safe), counters are available in the RelTransMgr dump. Worker counts
+ * into its own counters and shares their copy with the main thread when
+ * idle, but at least once a second.
+ */
+void TRelTransMgr::workerLoop(TRelayWorker * w)
+{
+#ifndef WIN32
+    char myPlainAddr[48];
+    char peerPlainAddr[48];
+    char myAddr[16];
+    char peer[16];
+    char anycast[16] = {0};
+
+    fd_set all;
+    int maxFD = 0;
+    FD_ZERO(&all);
+    for (unsigned int i = 0; i < w->Sockets.size(); i++) {
+	FD_SET(w->Sockets[i].FD, &all);
+	if (w->Sockets[i].FD > maxFD)
+	    maxFD = w->Sockets[i].FD;
+    }
+
+    bool done = false;
+    while (!done) {
+	fd_set fds = all;
+	struct timeval tv;
+	tv.tv_sec  = 1; // check Done flag once a second
+	tv.tv_usec = 0;
+	int cnt = ::select(maxFD + 1, &fds, NULL, NULL, &tv);
+
+	pthread_mutex_lock(&w->Lock);
+	done = w->Done;
+	if (cnt <= 0 || done || (unsigned long)now() != w->Published) {
+	    w->Shared    = w->Counters;
+	    w->Published = now();
+	}
+	pthread_mutex_unlock(&w->Lock);
+	if (cnt <= 0)
+	    continue;
+
+	for (unsigned int i = 0; i < w->Sockets.size(); i++) {
+	    TRelayWorkerSocket & s = w->Sockets[i];
+	    if (!FD_ISSET(s.FD, &fds))
+		continue;
+
+	    int len = sock_recv(s.FD, myPlainAddr, peerPlainAddr, w->Buf, RELAY_WORKER_BUF_SIZE);
+	    if (len < 0) {
+		w->Counters.Errors++;
+		continue;
+	    }
+	    inet_pton6(myPlainAddr, myAddr);
+	    inet_pton6(peerPlainAddr, peer);
+
+	    // multicast is received on unicast socket, too (see TIfaceMgr::select())
+	    if (s.CheckAddr && memcmp(s.Addr, myAddr, 16) && memcmp(s.Addr, anycast, 16))
+		continue;
+
+	    w->Counters.Received++;
+	    if (len > 0)
+		w->Counters.Stats[s.Iface].rx(w->Buf[0]);
+	    this->workerRelay(w, s, w->Buf, len, peer);
+	}
+    }
+#endif
+}
+
+/**
+ * relays one message received by a worker, the same way as relayMsg() does.
+ * Only worker's own buffers and counters are modified.
+ */
+void TRelTransMgr::workerRelay(TRelayWorker * w, TRelayWorkerSocket & s,
+			       char * data, int dataLen, char * peer)
+{
+#ifndef WIN32
+    int hopCount = 0;
+    if (dataLen < 4) {
+	w->Counters.Dropped++;
+	return;
+    }
+
+    switch (data[0]) {
+    case SOLICIT_MSG:
+    case REQUEST_MSG:
+    case CONFIRM_MSG:
+    case RENEW_MSG:
+    case REBIND_MSG:
+    case RELEASE_MSG:
+    case DECLINE_MSG:
+    case INFORMATION_REQUEST_MSG:
+    case ADVERTISE_MSG:
+    case REPLY_MSG:
+	break;
+    case RELAY_FORW_MSG:
+	if (dataLen < 34 || (unsigned char)data[1] >= HOP_COUNT_LIMIT) {
+	    w->Counters.Dropped++;
+	    return;
+	}
+	hopCount = (unsigned char)data[1] + 1;
+	break;
+    default:
+	// server replies are expected on server interfaces only
+	w->Counters.Dropped++;
+	return;
+    }
+
+    std::map<int, TRelayForwHdr>::const_iterator hdr = this->ForwHdrs.find(s.Iface);
+    if (hdr == this->ForwHdrs.end()) {
+	w->Counters.Dropped++;
+	return;
+    }
+
+    // link-addr and server state may be changed by the main thread
+    pthread_mutex_lock(&this->SharedLock);
+    patchForwHdr(hdr->second, w->Prefix, hopCount, peer, dataLen);
+    int server = this->selectServer(data, dataLen, peer);
+    pthread_mutex_unlock(&this->SharedLock);
+
+    char * bufs[3] = { w->Prefix, data, (char*)hdr->second.Suffix.data() };
+    int    lens[3] = { hdr->second.PrefixLen, dataLen, (int)hdr->second.Suffix.size() };
+    bool ok = true;
+
+    for (std::list<TRelayUpstream>::const_iterator up = this->Upstreams.begin();
+	 up != this->Upstreams.end(); ++up) {
+	char * addr = (char*)up->Packed;
+	if (sock_send_multi(up->FD, &addr, 1, bufs, lens, 3, DHCPSERVER_PORT, up->Iface) <= 0)
+	    ok = false;
+	else
+	    w->Counters.Stats[up->Iface].tx(RELAY_FORW_MSG);
+    }
+
+    if (server != -1) {
+	const TRelayServer & srv = this->Servers[server];
+
+	// reported before sending, so fast reply can't be matched too early
+	unsigned long transID;
+	if (findTransID(data, dataLen, transID)) {
+	    TRelaySent sent;
+	    sent.Server  = server;
+	    sent.TransID = transID;
+	    sent.Sent    = now_ms();
+	    pthread_mutex_lock(&w->Lock);
+	    if (w->SentLog.size() < RELAY_MAX_PENDING)
+		w->SentLog.push_back(sent);
+	    pthread_mutex_unlock(&w->Lock);
+	}
+
+	char * addr = (char*)srv.Packed;
+	if (sock_send_multi(srv.FD, &addr, 1, bufs, lens, 3, DHCPSERVER_PORT, srv.Iface) <= 0)
+	    ok = false;
+	else {
+	    w->Counters.ServerSent[server]++;
+	    w->Counters.Stats[srv.Iface].tx(RELAY_FORW_MSG);
+	}
+    }
+
+    if (ok)
+	w->Counters.Relayed++;
+    else
+	w->Counters.Errors++;
+#endif
+}
+
+/**
+ * returns copy of worker counters, as last shared by the worker
+ */
+TRelTransMgr::TRelayWorkerCounters TRelTransMgr::workerCounters(TRelayWorker * w)
+{
+#ifndef WIN32
+    pthread_mutex_lock(&w->Lock);
+    TRelayWorkerCounters cnt = w->Shared;
+    pthread_mutex_unlock(&w->Lock);
+    return cnt;
+#else
+    return w->Shared;
+#endif
+}
+
 void TRelTransMgr::shutdown() {
     IsDone = true;
 }
@@ -276,6 +1098,7 @@ bool TRelTransMgr::isDone() {
 }
 
 bool TRelTransMgr::doDuties() {
+    this->expirePending();
     return 0;
 }
 
@@ -288,14 +1111,110 @@ int  TRelTransMgr::getCtrlIface() {
 }
 
 void TRelTransMgr::dump() {
+    this->expirePending();
     std::ofstream xmlDump;
     xmlDump.open(this->XmlFile.c_str());
     xmlDump << *this;
     xmlDump.close();
 }
 
+/**
+ * prints statistics: messages per interface (including those handled by
+ * workers), unicast servers and workers. Worker counters are shared by
+ * workers at least once a second, so they may be a bit behind.
+ */
+void TRelTransMgr::printStats(std::ostream & out) {
+    std::vector<TRelayWorkerCounters> workers;
+    for (unsigned int i = 0; i < this->Workers.size(); i++)
+	workers.push_back(this->workerCounters(this->Workers[i]));
+
+    std::vector<std::pair<std::string, TStatsMsgCounters> > ifaces;
+    SPtr<TIfaceIface> iface;
+    RelIfaceMgr().firstIface();
+    while (iface = RelIfaceMgr().getIface()) {
+	TStatsMsgCounters cnt = iface->getStats();
+	for (unsigned int i = 0; i < workers.size(); i++) {
+	    std::map<int, TStatsMsgCounters>::const_iterator w = workers[i].Stats.find(iface->getID());
+	    if (w == workers[i].Stats.end())
+		continue;
+	    for (int j = 0; j < STATS_MSG_TYPES; j++) {
+		cnt.Rx[j] += w->second.Rx[j];
+		cnt.Tx[j] += w->second.Tx[j];
+	    }
+	}
+	ifaces.push_back(std::make_pair(std::string(iface->getName()), cnt));
+    }
+    TStatsMgr::printType(out, "dibbler_rx_messages_total", "counter", "Received messages by interface and type.");
+    for (unsigned int i = 0; i < ifaces.size(); i++)
+	TStatsMgr::printMsgCounters(out, ifaces[i].first, ifaces[i].second, false);
+    TStatsMgr::printType(out, "dibbler_tx_messages_total", "counter", "Sent messages by interface and type.");
+    for (unsigned int i = 0; i < ifaces.size(); i++)
+	TStatsMgr::printMsgCounters(out, ifaces[i].first, ifaces[i].second, true);
+
+    if (!this->Servers.empty()) {
+	static const char * names[] = { "dibbler_relay_server_sent_total",
+					"dibbler_relay_server_answered_total",
+					"dibbler_relay_server_lost_total",
+					"dibbler_relay_server_failovers_total",
+					"dibbler_relay_server_up" };
+	static const char * help[] = { "Messages relayed to server.",
+				       "Transactions answered by server.",
+				       "Transactions not answered in time.",
+				       "How many times server was marked down.",
+				       "Whether server is considered alive." };
+	for (int n = 0; n < 5; n++) {
+	    TStatsMgr::printType(out, names[n], n == 4 ? "gauge" : "counter", help[n]);
+	    for (unsigned int i = 0; i < this->Servers.size(); i++) {
+		const TRelayServer & srv = this->Servers[i];
+		unsigned long val = 0;
+		switch (n) {
+		case 0:
+		    val = srv.Sent;
+		    for (unsigned int j = 0; j < workers.size(); j++)
+			val += workers[j].ServerSent[i];
+		    break;
+		case 1: val = srv.Answered;  break;
+		case 2: val = srv.Lost;      break;
+		case 3: val = srv.Failovers; break;
+		case 4: val = srv.Alive;     break;
+		}
+		SPtr<TIfaceIface> iface = RelIfaceMgr().getIfaceByID(srv.Iface);
+		out << names[n] << "{iface=\"" << (iface ? iface->getName() : srv.Name.c_str())
+		    << "\",server=\"" << srv.Addr->getPlain()
+		    << "\"} " << val << std::endl;
+	    }
+	}
+    }
+
+    if (!this->Workers.empty()) {
+	TStatsMgr::printType(out, "dibbler_relay_worker_messages_total", "counter",
+			     "Client messages handled by worker threads.");
+	for (unsigned int i = 0; i < this->Workers.size(); i++) {
+	    int id = this->Workers[i]->ID;
+	    out << "dibbler_relay_worker_messages_total{worker=\"" << id << "\",result=\"received\"} "
+		<< workers[i].Received << std::endl;
+	    out << "dibbler_relay_worker_messages_total{worker=\"" << id << "\",result=\"relayed\"} "
+		<< workers[i].Relayed << std::endl;
+	    out << "dibbler_relay_worker_messages_total{worker=\"" << id << "\",result=\"dropped\"} "
+		<< workers[i].Dropped << std::endl;
+	    out << "dibbler_relay_worker_messages_total{worker=\"" << id << "\",result=\"error\"} "
+		<< workers[i].Errors << std::endl;
+	}
+    }
+}
+
 TRelTransMgr::~TRelTransMgr() {
     Log(Debug) << "RelTransMgr cleanup." << LogEnd;
+    this->stopWorkers();
+    for (unsigned int i = 0; i < this->Workers.size(); i++) {
+#ifndef WIN32
+	pthread_mutex_destroy(&this->Workers[i]->Lock);
+#endif
+	delete this->Workers[i];
+    }
+#ifndef WIN32
+    pthread_mutex_destroy(&this->SharedLock);
+#endif
 }
 
 void TRelTransMgr::instanceCreate(const std::string& xmlFile)
@@ -316,8 +1235,31 @@ TRelTransMgr& TRelTransMgr::instance()
 
 std::ostream & operator<<(std::ostream &s, TRelTransMgr &x)
 {
+    std::vector<TRelTransMgr::TRelayWorkerCounters> workers;
+    for (unsigned int i = 0; i < x.Workers.size(); i++)
+	workers.push_back(x.workerCounters(x.Workers[i]));
+
     s << "<TRelTransMgr>" << std::endl;
-    s << "<!-- RelTransMgr dumps are not implemented yet -->" << std::endl;
+    s << "  <!-- " << x.Pending.size() << " transaction(s) waiting for reply -->" << std::endl;
+    for (unsigned int i = 0; i < x.Servers.size(); i++) {
+	TRelTransMgr::TRelayServer & srv = x.Servers[i];
+	unsigned long sent = srv.Sent;
+	for (unsigned int j = 0; j < workers.size(); j++)
+	    sent += workers[j].ServerSent[i];
+	s << "  <Server iface=\"" << srv.Name << "\" alive=\"" << (srv.Alive?"true":"false")
+	  << "\" sent=\"" << sent << "\" answered=\"" << srv.Answered
+	  << "\" lost=\"" << srv.Lost << "\" failovers=\"" << srv.Failovers
+	  << "\" latencyAvg=\"" << (srv.Answered ? srv.LatencySum/srv.Answered : 0)
+	  << "\" latencyMax=\"" << srv.LatencyMax << "\">" << srv.Addr->getPlain()
+	  << "</Server>" << std::endl;
+    }
+    for (unsigned int i = 0; i < x.Workers.size(); i++) {
+	TRelTransMgr::TRelayWorker * w = x.Workers[i];
+	s << "  <Worker id=\"" << w->ID << "\" sockets=\"" << w->Sockets.size()
+	  << "\" received=\"" << workers[i].Received << "\" relayed=\"" << workers[i].Relayed
+	  << "\" dropped=\"" << workers[i].Dropped << "\" errors=\"" << workers[i].Errors
+	  << "\"/>" << std::endl;
+    }
     s << "</TRelTransMgr>" << std::endl;
     return s;
 }
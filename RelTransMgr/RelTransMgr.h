@@ -13,12 +13,32 @@ class TRelTransMgr;
 #define RELTRANSMGR_H
 
 #include <iostream>
+#include <map>
+#include <list>
+#include <vector>
+#include <deque>
 #include "SmartPtr.h"
 #include "RelCfgIface.h"
 #include "RelMsg.h"
+#include "Iface.h"
+#include "StatsMgr.h"
+
+#ifndef WIN32
+#include <pthread.h>
+#endif
 
 #define RelTransMgr() (TRelTransMgr::instance())
 
+/// max. length of RELAY-FORW part stored before relayed message
+/// (header, interface-id and relay-msg option header)
+#define RELAY_FORW_PREFIX_MAX 64
+
+/// max. number of relayed transactions waiting for server reply
+#define RELAY_MAX_PENDING 4096
+
+/// receive buffer size of a worker thread
+#define RELAY_WORKER_BUF_SIZE 2048
+
 class TRelTransMgr
 {
     friend std::ostream & operator<<(std::ostream &strum, TRelTransMgr &x);
@@ -34,15 +54,132 @@ class TRelTransMgr
 
     void relayMsg(SPtr<TRelMsg> msg);
     void relayMsgRepl(SPtr<TRelMsg> msg);
+    void updateLinkAddrs();
     void dump();
+    void printStats(std::ostream & out);
 
     bool isDone();
     void shutdown();
+
+    void startWorkers();
+    void stopWorkers();
+    unsigned long getTimeout();
     
     char * getCtrlAddr();
     int    getCtrlIface();
     
   private:
+    /// RELAY-FORW built once for messages received on one interface.
+    /// Only hop-count, peer-addr and relay-msg length change per message.
+    struct TRelayForwHdr {
+        char Prefix[RELAY_FORW_PREFIX_MAX]; // header .. relay-msg option header
+        int PrefixLen;
+        std::string Suffix;                 // options stored after relay-msg option
+    };
+
+    /// multicast destinations reachable over one interface
+    struct TRelayUpstream {
+        int Iface;
+        std::string Name;
+        List(TIPv6Addr) Addrs;
+        char Packed[16];                    // the same address, for workers
+        int FD;                             // socket used by workers
+    };
+
+    /// unicast server, clients are spread among all such servers
+    struct TRelayServer {
+        int Iface;
+        std::string Name;
+        SPtr<TIPv6Addr> Addr;
+        char Packed[16];
+        int FD;                             // socket used by workers
+        bool Alive;                         // changed under SharedLock, read by workers
+        unsigned long DeadSince;            // when server was marked down (s)
+        unsigned long long LastReply;       // last reply received (ms)
+        unsigned long Sent;
+        unsigned long Answered;
+        unsigned long Lost;                 // transactions not answered in time
+        unsigned int Unanswered;            // lost in a row, since the last reply
+        unsigned long Failovers;            // how many times marked down
+        unsigned long long LatencySum;      // ms, answered transactions only
+        unsigned long LatencyMax;
+    };
+
+    /// relayed transaction waiting for server reply; several servers
+    /// may use the same transaction-id, so it is keyed by both
+    typedef std::pair<int, unsigned long> TRelayPendingKey; // (server index, transid)
+    struct TRelayPending {
+        unsigned long long Sent;            // ms
+    };
+
+    /// message relayed by a worker, waiting to be tracked by the main thread
+    struct TRelaySent {
+        int Server;
+        unsigned long TransID;
+        unsigned long long Sent;            // ms
+    };
+
+    /// socket read by a worker thread
+    struct TRelayWorkerSocket {
+        int FD;
+        int Iface;
+        char Addr[16];                      // address socket is bound to
+        bool CheckAddr;
+    };
+
+    /// counters of one worker thread
+    struct TRelayWorkerCounters {
+        unsigned long Received;
+        unsigned long Relayed;
+        unsigned long Dropped;
+        unsigned long Errors;
+        std::vector<unsigned long> ServerSent;
+        std::map<int, TStatsMsgCounters> Stats; // ifindex -> messages (all keys added at start)
+    };
+
+    /// Worker thread relaying client messages received on its own sockets.
+    /// It only reads forwarding tables; everything it writes is its own.
+    struct TRelayWorker {
+        int ID;
+        TRelTransMgr * Mgr;
+        std::vector<TRelayWorkerSocket> Sockets;
+        char Buf[RELAY_WORKER_BUF_SIZE];
+        char Prefix[RELAY_FORW_PREFIX_MAX];
+
+        TRelayWorkerCounters Counters;      // updated by the worker only
+        unsigned long Published;            // when Counters were last copied to Shared (s)
+
+        // guarded by Lock
+        bool Done;
+        TRelayWorkerCounters Shared;        // copy of Counters read by the main thread
+        std::vector<TRelaySent> SentLog;
+#ifndef WIN32
+        pthread_t Thread;
+        pthread_mutex_t Lock;
+#endif
+    };
+
+    void prepareForwHdr(SPtr<TRelCfgIface> cfgIface);
+    static void patchForwHdr(const TRelayForwHdr & hdr, char * prefix, int hopCount,
+			     const char * peer, int dataLen);
+    static SPtr<TIPv6Addr> linkAddr(SPtr<TIfaceIface> iface);
+    void prepareUpstream(SPtr<TRelCfgIface> cfgIface);
+    int  upstreamFD(int ifindex);
+
+    int  selectServer(char * data, int dataLen, char * peer);
+    void serverSent(int server, SPtr<TRelMsg> msg);
+    void serverReplied(SPtr<TRelMsg> msg);
+    void addPending(int server, unsigned long transID, unsigned long long sent);
+    void expirePending();
+    void drainWorkers();
+
+    static void * workerMain(void * arg);
+    void workerLoop(TRelayWorker * w);
+    void workerRelay(TRelayWorker * w, TRelayWorkerSocket & s, char * data, int dataLen, char * peer);
+    TRelayWorkerCounters workerCounters(TRelayWorker * w);
+    void setAlive(TRelayServer & srv, bool alive);
+    static char * findClientKey(char * data, int dataLen, int & keyLen);
+
     TRelTransMgr(const std::string xmlFile);
     static TRelTransMgr * Instance;
     std::string XmlFile;
@@ -50,6 +187,20 @@ class TRelTransMgr
 
     int ctrlIface;
     char ctrlAddr[48];
+
+    std::map<int, TRelayForwHdr> ForwHdrs; // ifindex -> RELAY-FORW header
+    unsigned long LinkAddrChanges;         // RelIfaceMgr().addrChanges() when link-addrs were set
+#ifndef WIN32
+    pthread_mutex_t SharedLock;            // guards link-addrs in ForwHdrs and Servers[].Alive
+#endif
+    std::list<TRelayUpstream> Upstreams;
+    std::vector<TRelayServer> Servers;
+
+    std::map<TRelayPendingKey, TRelayPending> Pending;
+    std::deque<std::pair<unsigned long long, TRelayPendingKey> > PendingQueue; // (sent, key)
+
+    std::vector<TRelayWorker*> Workers;
+    bool WorkersRunning;
 };
 
 
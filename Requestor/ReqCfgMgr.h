@@ -21,6 +21,14 @@ typedef struct {
     // message specific parameters
     char * addr;
     char * duid;
+
+    // client emulation (load testing) parameters
+    int emulate;      // number of emulated clients (0 = emulation disabled)
+    int rate;         // emulated clients started per second
+    int renews;       // number of RENEWs sent by each emulated client
+    char * relay;     // if set, act as relay bound to this address
+    char * linkaddr;  // link-addr used in RELAY-FORW
+    int interfaceid;  // interface-id used in RELAY-FORW (0 = not sent)
 } ReqCfgMgr;
 
 #endif
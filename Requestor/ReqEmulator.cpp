@@ -0,0 +1,453 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * Released under GNU GPL v2 licence
+ *
+ */
+
+#include <string.h>
+#include <iomanip>
+#include "ReqEmulator.h"
+#include "ReqMsg.h"
+#include "ReqOpt.h"
+#include "DHCPConst.h"
+#include "Portable.h"
+#include "Logger.h"
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <sys/time.h>
+#endif
+
+using namespace std;
+
+/// how long to wait for a response before transaction is considered failed (ms)
+#define EMULATOR_TRANS_TIMEOUT 3000
+
+/// how long bound client waits before next RENEW/RELEASE if server sent T1=0 (ms)
+#define EMULATOR_DEFAULT_T1 1000
+
+ReqEmulator::ReqEmulator(TIfaceMgr * ifaceMgr, ReqCfgMgr * cfgMgr)
+    :IfaceMgr(ifaceMgr), CfgMgr(cfgMgr), Active(0)
+{
+    memset(Stats, 0, sizeof(Stats));
+}
+
+bool ReqEmulator::BindSockets()
+{
+    Iface = IfaceMgr->getIfaceByName(CfgMgr->iface);
+    if (!Iface) {
+        Log(Crit) << "Unable to bind sockets: Interface " << CfgMgr->iface << " not found." << LogEnd;
+        return false;
+    }
+
+    SPtr<TIPv6Addr> addr;
+    int port;
+    if (CfgMgr->relay) {
+        // we pretend to be a relay, so server will respond to port 547
+        addr = new TIPv6Addr(CfgMgr->relay, true);
+        port = DHCPSERVER_PORT;
+        DstAddr = new TIPv6Addr(CfgMgr->dstaddr?CfgMgr->dstaddr:"::1", true);
+    } else {
+        char* llAddr = 0;
+        Iface->firstLLAddress();
+        llAddr = Iface->getLLAddress();
+        if (!llAddr) {
+            Log(Error) << "Interface " << Iface->getFullName() << " does not have link-local address." << LogEnd;
+            return false;
+        }
+        addr = new TIPv6Addr(llAddr);
+        port = DHCPCLIENT_PORT;
+        DstAddr = new TIPv6Addr(CfgMgr->dstaddr?CfgMgr->dstaddr:"ff02::1:2", true);
+    }
+
+    if (!Iface->addSocket(addr, port, true, true)) {
+        Log(Crit) << "Socket creation or binding to " << addr->getPlain() << ", port " << port
+                  << " failed." << LogEnd;
+        return false;
+    }
+    Iface->firstSocket();
+    Socket = Iface->getSocket();
+    if (!Socket) {
+        Log(Crit) << "No socket found. Something is wrong." << LogEnd;
+        return false;
+    }
+    Log(Debug) << "Socket " << Socket->getFD() << " bound to " << addr->getPlain() << ", port " << port
+               << " on the " << Iface->getFullName() << " interface." << LogEnd;
+    return true;
+}
+
+bool ReqEmulator::Run()
+{
+    Log(Notice) << "Emulating " << CfgMgr->emulate << " client(s), starting " << CfgMgr->rate
+                << " per second, " << CfgMgr->renews << " RENEW(s) each"
+                << (CfgMgr->relay?", relayed":"") << "." << LogEnd;
+
+    // create virtual clients, each with DUID-LL with unique MAC
+    unsigned long long start = now_ms();
+    Clients.resize(CfgMgr->emulate);
+    for (int i=0; i<CfgMgr->emulate; i++) {
+        char duid[10] = { 0x00, 0x03, 0x00, 0x01, 0x02, 0x00, 0, 0, 0, 0 };
+        writeUint32(duid+6, i);
+        Clients[i].Duid = new TDUID(duid, sizeof(duid));
+
+        char peer[16] = { (char)0xfe, (char)0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        writeUint32(peer+12, i);
+        Clients[i].PeerAddr = new TIPv6Addr(peer, false);
+
+        Clients[i].State = STATE_IDLE;
+        Clients[i].TransID = 0;
+        Clients[i].Sent = 0;
+        Clients[i].TimerSet = false;
+        Clients[i].HaveAddr = false;
+        Clients[i].T1 = 0;
+        Clients[i].Renews = 0;
+        setTimer(i, start + (unsigned long long)i*1000/CfgMgr->rate);
+    }
+    Active = CfgMgr->emulate;
+
+    char buf[2048];
+    SPtr<TIPv6Addr> sender = new TIPv6Addr();
+    while (Active) {
+        unsigned long long now = now_ms();
+
+        // fire all expired timers
+        while (!Timers.empty() && Timers.begin()->first <= now) {
+            int client = Timers.begin()->second;
+            Timers.erase(Timers.begin());
+            Clients[client].TimerSet = false;
+            onTimer(client);
+        }
+        if (!Active)
+            break;
+
+        // sleep until next timer
+        unsigned long long wait = 1000;
+        if (!Timers.empty())
+            wait = Timers.begin()->first - now;
+        struct timeval timeout;
+        timeout.tv_sec = (long)(wait/1000);
+        timeout.tv_usec = (long)(wait%1000)*1000;
+
+        int bufLen = sizeof(buf);
+        if (IfaceMgr->select(timeout, buf, bufLen, sender) > 0 && bufLen > 0)
+            onMsg(buf, bufLen);
+    }
+
+    Log(Notice) << "Emulation finished after " << (now_ms()-start) << "ms." << LogEnd;
+    return true;
+}
+
+void ReqEmulator::setTimer(int client, unsigned long long when)
+{
+    cancelTimer(client);
+    Clients[client].Timer = Timers.insert(make_pair(when, client));
+    Clients[client].TimerSet = true;
+}
+
+void ReqEmulator::cancelTimer(int client)
+{
+    if (Clients[client].TimerSet) {
+        Timers.erase(Clients[client].Timer);
+        Clients[client].TimerSet = false;
+    }
+}
+
+void ReqEmulator::onTimer(int client)
+{
+    VirtualClient & c = Clients[client];
+    switch (c.State) {
+    case STATE_IDLE:
+        sendMsg(client, SOLICIT_MSG);
+        break;
+    case STATE_BOUND:
+        if (c.Renews < CfgMgr->renews) {
+            c.Renews++;
+            sendMsg(client, RENEW_MSG);
+        } else {
+            sendMsg(client, RELEASE_MSG);
+        }
+        break;
+    case STATE_SOLICITING:
+        finish(client, SOLICIT_MSG, false);
+        break;
+    case STATE_REQUESTING:
+        finish(client, REQUEST_MSG, false);
+        break;
+    case STATE_RENEWING:
+        finish(client, RENEW_MSG, false);
+        break;
+    case STATE_RELEASING:
+        finish(client, RELEASE_MSG, false);
+        break;
+    case STATE_DONE:
+        break;
+    }
+}
+
+/// @brief Builds and sends a message on behalf of a virtual client.
+bool ReqEmulator::sendMsg(int client, int msgType)
+{
+    VirtualClient & c = Clients[client];
+
+    // transaction-id identifies client when response comes back, so it must be unique
+    dropTransaction(client);
+    SPtr<TReqMsg> msg;
+    do {
+        msg = new TReqMsg(Iface->getID(), DstAddr, msgType);
+    } while (Transactions.find(msg->getTransID()) != Transactions.end());
+
+    SPtr<TOpt> opt = new TReqOptDUID(OPTION_CLIENTID, c.Duid, &*msg);
+    msg->addOption(opt);
+
+    if (msgType != SOLICIT_MSG) {
+        opt = new TReqOptGeneric(OPTION_SERVERID, c.ServerID.c_str(), c.ServerID.length(), &*msg);
+        msg->addOption(opt);
+    }
+
+    char tmp[40];
+    memset(tmp, 0, sizeof(tmp));
+    opt = new TReqOptGeneric(OPTION_ELAPSED_TIME, tmp, OPTION_ELAPSED_TIME_LEN, &*msg);
+    msg->addOption(opt);
+
+    // IA_NA: IAID=1, T1=T2=0, with IAADDR if we have an address already
+    int iaLen = 12;
+    writeUint32(tmp, 1);
+    if (c.HaveAddr && msgType != SOLICIT_MSG) {
+        writeUint16(tmp+iaLen, OPTION_IAADDR);
+        writeUint16(tmp+iaLen+2, 24);
+        memcpy(tmp+iaLen+4, c.Addr, 16);
+        iaLen += 28; // option header + addr + pref + valid (all zeros)
+    }
+    opt = new TReqOptGeneric(OPTION_IA_NA, tmp, iaLen, &*msg);
+    msg->addOption(opt);
+
+    char buf[1024];
+    int bufLen = msg->storeSelf(buf);
+
+    if (CfgMgr->relay) {
+        // wrap it in RELAY-FORW: type, hop-count, link-addr, peer-addr, options
+        char relayBuf[1100];
+        char * ptr = relayBuf;
+        *(ptr++) = RELAY_FORW_MSG;
+        *(ptr++) = 0;
+        SPtr<TIPv6Addr> link = new TIPv6Addr(CfgMgr->linkaddr?CfgMgr->linkaddr:"::", true);
+        memcpy(ptr, link->getAddr(), 16);
+        ptr += 16;
+        memcpy(ptr, c.PeerAddr->getAddr(), 16);
+        ptr += 16;
+        if (CfgMgr->interfaceid) {
+            ptr = writeUint16(ptr, OPTION_INTERFACE_ID);
+            ptr = writeUint16(ptr, 4);
+            ptr = writeUint32(ptr, CfgMgr->interfaceid);
+        }
+        ptr = writeUint16(ptr, OPTION_RELAY_MSG);
+        ptr = writeUint16(ptr, bufLen);
+        memcpy(ptr, buf, bufLen);
+        ptr += bufLen;
+        bufLen = ptr - relayBuf;
+        memcpy(buf, relayBuf, bufLen);
+    }
+
+    c.TransID = msg->getTransID();
+    Transactions[c.TransID] = client;
+    c.Sent = now_ms();
+    stats(msgType).Sent++;
+
+    switch (msgType) {
+    case SOLICIT_MSG: c.State = STATE_SOLICITING; break;
+    case REQUEST_MSG: c.State = STATE_REQUESTING; break;
+    case RENEW_MSG:   c.State = STATE_RENEWING;   break;
+    case RELEASE_MSG: c.State = STATE_RELEASING;  break;
+    }
+    setTimer(client, c.Sent + EMULATOR_TRANS_TIMEOUT);
+
+    if (Socket->send(buf, bufLen, DstAddr, DHCPSERVER_PORT) < 0) {
+        Log(Error) << "Failed to send " << msg->getName() << " for client " << client << LogEnd;
+        cancelTimer(client);
+        finish(client, msgType, false);
+        return false;
+    }
+    return true;
+}
+
+/// @brief Forgets transaction-id of a client (unless it was reused by another client).
+void ReqEmulator::dropTransaction(int client)
+{
+    map<unsigned long, int>::iterator it = Transactions.find(Clients[client].TransID);
+    if (it != Transactions.end() && it->second == client)
+        Transactions.erase(it);
+}
+
+/// @brief Dispatches received ADVERTISE or REPLY to its virtual client.
+void ReqEmulator::onMsg(char * buf, int bufLen)
+{
+    if (bufLen < 4)
+        return;
+
+    if (buf[0] == RELAY_REPL_MSG) {
+        int len = 0;
+        char * inner = bufLen > 34 ? findOpt(buf+34, bufLen-34, OPTION_RELAY_MSG, len) : 0;
+        if (!inner || len < 4)
+            return;
+        buf = inner;
+        bufLen = len;
+    }
+
+    int msgType = buf[0];
+    unsigned long transid = ((unsigned char)buf[1] << 16) + ((unsigned char)buf[2] << 8)
+        + (unsigned char)buf[3];
+    map<unsigned long, int>::iterator it = Transactions.find(transid);
+    if (it == Transactions.end())
+        return; // late response or not ours
+    int client = it->second;
+    VirtualClient & c = Clients[client];
+    char * opts = buf + 4;
+    int optsLen = bufLen - 4;
+
+    int len = 0;
+    char * ia = findOpt(opts, optsLen, OPTION_IA_NA, len);
+    char * addr = 0;
+    int addrLen = 0;
+    if (ia && len >= 12) {
+        addr = findOpt(ia+12, len-12, OPTION_IAADDR, addrLen);
+        if (addr && addrLen < 24)
+            addr = 0;
+        c.T1 = readUint32(ia+4);
+    }
+
+    if (msgType == ADVERTISE_MSG && c.State == STATE_SOLICITING) {
+        char * srvid = findOpt(opts, optsLen, OPTION_SERVERID, len);
+        if (!srvid || !addr) {
+            finish(client, SOLICIT_MSG, false);
+            return;
+        }
+        c.ServerID = string(srvid, len);
+        memcpy(c.Addr, addr, 16);
+        c.HaveAddr = true;
+        finish(client, SOLICIT_MSG, true);
+        return;
+    }
+
+    if (msgType != REPLY_MSG)
+        return;
+
+    switch (c.State) {
+    case STATE_REQUESTING:
+        finish(client, REQUEST_MSG, addr != 0);
+        break;
+    case STATE_RENEWING:
+        finish(client, RENEW_MSG, addr != 0);
+        break;
+    case STATE_RELEASING:
+        finish(client, RELEASE_MSG, true);
+        break;
+    default:
+        break;
+    }
+}
+
+/// @brief Ends current transaction of a client and moves it to the next state.
+void ReqEmulator::finish(int client, int msgType, bool success)
+{
+    VirtualClient & c = Clients[client];
+    unsigned long long now = now_ms();
+
+    cancelTimer(client);
+    dropTransaction(client);
+
+    if (success) {
+        stats(msgType).Success++;
+        recordLatency(msgType, now - c.Sent);
+    } else {
+        stats(msgType).Failed++;
+    }
+
+    if (success && msgType == SOLICIT_MSG) {
+        sendMsg(client, REQUEST_MSG);
+        return;
+    }
+
+    if (success && (msgType == REQUEST_MSG || msgType == RENEW_MSG)) {
+        c.State = STATE_BOUND;
+        unsigned long long t1 = c.T1 ? (unsigned long long)c.T1*1000 : EMULATOR_DEFAULT_T1;
+        if (CfgMgr->timeout && t1 > (unsigned long long)CfgMgr->timeout*1000)
+            t1 = (unsigned long long)CfgMgr->timeout*1000;
+        setTimer(client, now + t1);
+        return;
+    }
+
+    // RELEASE done or something failed: this client is finished
+    c.State = STATE_DONE;
+    Active--;
+}
+
+ReqEmulator::MsgStats & ReqEmulator::stats(int msgType)
+{
+    switch (msgType) {
+    case SOLICIT_MSG: return Stats[0];
+    case REQUEST_MSG: return Stats[1];
+    case RENEW_MSG:   return Stats[2];
+    default:          return Stats[3];
+    }
+}
+
+void ReqEmulator::recordLatency(int msgType, unsigned long long latency)
+{
+    MsgStats & s = stats(msgType);
+    s.LatencySum += latency;
+    if (latency > s.LatencyMax)
+        s.LatencyMax = (unsigned long)latency;
+
+    int bucket = 0;
+    while (bucket < EMULATOR_HISTOGRAM_BUCKETS-1 && latency >= (1ULL << bucket))
+        bucket++;
+    s.Histogram[bucket]++;
+}
+
+void ReqEmulator::PrintStats()
+{
+    const char * names[] = { "SOLICIT", "REQUEST", "RENEW", "RELEASE" };
+    for (int i=0; i<4; i++) {
+        MsgStats & s = Stats[i];
+        if (!s.Sent)
+            continue;
+        Log(Notice) << names[i] << ": sent=" << s.Sent << ", success=" << s.Success
+                    << " (" << (s.Success*100/s.Sent) << "%), failed=" << s.Failed
+                    << ", avg=" << (s.Success?s.LatencySum/s.Success:0) << "ms, max="
+                    << s.LatencyMax << "ms" << LogEnd;
+        for (int b=0; b<EMULATOR_HISTOGRAM_BUCKETS; b++) {
+            if (!s.Histogram[b])
+                continue;
+            if (b==EMULATOR_HISTOGRAM_BUCKETS-1)
+                Log(Notice) << "  >= " << setfill(' ') << setw(5) << (1UL << (b-1)) << "ms: ";
+            else
+                Log(Notice) << "   < " << setfill(' ') << setw(5) << (1UL << b) << "ms: ";
+            Log(Cont) << s.Histogram[b] << LogEnd;
+        }
+    }
+}
+
+/// @brief Finds option in a buffer with options.
+///
+/// @return pointer to option data (or NULL if not found), optLen is set to its length
+char * ReqEmulator::findOpt(char * buf, int bufLen, int optType, int & optLen)
+{
+    int pos = 0;
+    while (pos+4 <= bufLen) {
+        int code = readUint16(buf+pos);
+        int len  = readUint16(buf+pos+2);
+        if (pos+4+len > bufLen)
+            return 0;
+        if (code == optType) {
+            optLen = len;
+            return buf+pos+4;
+        }
+        pos += 4+len;
+    }
+    return 0;
+}
+
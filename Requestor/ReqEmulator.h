@@ -0,0 +1,102 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * Released under GNU GPL v2 licence
+ *
+ */
+
+#ifndef REQEMULATOR_H
+#define REQEMULATOR_H
+
+#include <map>
+#include <vector>
+#include <string>
+#include "IfaceMgr.h"
+#include "ReqCfgMgr.h"
+#include "DUID.h"
+#include "IPv6Addr.h"
+
+/// number of latency histogram buckets (1ms, 2ms, 4ms, ... 32s, more)
+#define EMULATOR_HISTOGRAM_BUCKETS 17
+
+/// @brief Emulates many DHCPv6 clients at once (server load testing).
+///
+/// Every virtual client has its own synthetic DUID and goes through
+/// SOLICIT, REQUEST, a configurable number of RENEWs and finally RELEASE.
+/// All clients share one socket and one timer queue. Optionally messages
+/// are wrapped in RELAY-FORW, so a server can be driven over loopback
+/// without touching real interfaces.
+class ReqEmulator {
+public:
+    ReqEmulator(TIfaceMgr * ifaceMgr, ReqCfgMgr * cfgMgr);
+    bool BindSockets();
+    bool Run();
+    void PrintStats();
+
+private:
+    typedef enum {
+        STATE_IDLE,
+        STATE_SOLICITING,
+        STATE_REQUESTING,
+        STATE_BOUND,
+        STATE_RENEWING,
+        STATE_RELEASING,
+        STATE_DONE
+    } EmulatorState;
+
+    typedef std::multimap<unsigned long long, int> TimerQueue; // time (ms) -> client
+
+    struct VirtualClient {
+        SPtr<TDUID> Duid;
+        SPtr<TIPv6Addr> PeerAddr; // used as peer-addr in RELAY-FORW
+        EmulatorState State;
+        unsigned long TransID;
+        unsigned long long Sent; // when current transaction started (ms)
+        TimerQueue::iterator Timer;
+        bool TimerSet;
+        std::string ServerID;    // raw SERVERID option content
+        char Addr[16];           // assigned address
+        bool HaveAddr;
+        unsigned long T1;
+        int Renews;
+    };
+
+    struct MsgStats {
+        unsigned long Sent;
+        unsigned long Success;
+        unsigned long Failed;
+        unsigned long long LatencySum;
+        unsigned long LatencyMax;
+        unsigned long Histogram[EMULATOR_HISTOGRAM_BUCKETS];
+    };
+
+    void setTimer(int client, unsigned long long when);
+    void cancelTimer(int client);
+    void onTimer(int client);
+    void onMsg(char * buf, int bufLen);
+
+    bool sendMsg(int client, int msgType);
+    void dropTransaction(int client);
+    void finish(int client, int msgType, bool success);
+    void recordLatency(int msgType, unsigned long long latency);
+    MsgStats & stats(int msgType);
+
+    static char * findOpt(char * buf, int bufLen, int optType, int & optLen);
+
+    TIfaceMgr * IfaceMgr;
+    ReqCfgMgr * CfgMgr;
+    SPtr<TIfaceIface> Iface;
+    SPtr<TIfaceSocket> Socket;
+    SPtr<TIPv6Addr> DstAddr;
+
+    std::vector<VirtualClient> Clients;
+    std::map<unsigned long, int> Transactions; // transid -> client
+    TimerQueue Timers;
+    int Active; // clients not in DONE state
+
+    MsgStats Stats[4]; // SOLICIT, REQUEST, RENEW, RELEASE
+};
+
+#endif
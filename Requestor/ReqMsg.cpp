@@ -30,6 +30,14 @@ TReqMsg::TReqMsg(int iface, SPtr<TIPv6Addr> addr, char* &buf, int &bufSize)
 std::string TReqMsg::getName() const
 {
     switch (MsgType) {
+    case SOLICIT_MSG:
+        return "SOLICIT";
+    case REQUEST_MSG:
+        return "REQUEST";
+    case RENEW_MSG:
+        return "RENEW";
+    case RELEASE_MSG:
+        return "RELEASE";
     case LEASEQUERY_MSG:
         return "LEASEQUERY";    
     case LEASEQUERY_REPLY_MSG:
@@ -30,7 +30,7 @@ bool TReqOptDUID::doDuties()
     return true;
 }
 
-TReqOptGeneric::TReqOptGeneric(int optType, char * data, int dataLen, TMsg* parent)
+TReqOptGeneric::TReqOptGeneric(int optType, const char * data, int dataLen, TMsg* parent)
     :TOptGeneric(optType, data, dataLen, parent)
 {
 }
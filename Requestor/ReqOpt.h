@@ -36,7 +36,7 @@ protected:
 class TReqOptGeneric : public TOptGeneric
 {
 public:
-    TReqOptGeneric(int optType, char * data, int dataLen, TMsg* parent);
+    TReqOptGeneric(int optType, const char * data, int dataLen, TMsg* parent);
 protected:
     bool doDuties();
 };
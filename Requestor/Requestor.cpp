@@ -14,6 +14,7 @@
 #include "Portable.h"
 #include "IfaceMgr.h"
 #include "ReqTransMgr.h"
+#include "ReqEmulator.h"
 #include "Logger.h"
 
 #ifdef WIN32
@@ -30,7 +31,16 @@ void printHelp()
          << "-addr ADDR - query about address, e.g. -addr 2000::43" << endl
          << "-duid DUID - query about DUID, e.g. -duid 00:11:22:33:44:55:66:77:88" << endl
          << "-timeout 10 - query timeout, specified in seconds" << endl
-         << "-dstaddr 2000::1 - destination address (by default it is ff02::1:2)" << endl;
+         << "-dstaddr 2000::1 - destination address (by default it is ff02::1:2)" << endl
+         << endl
+         << "Client emulation (server load testing):" << endl
+         << "-emulate N - emulate N clients (SOLICIT, REQUEST, RENEW(s), RELEASE)" << endl
+         << "-rate N - start N emulated clients per second (default 100)" << endl
+         << "-renews N - number of RENEWs sent by each emulated client (default 1)" << endl
+         << "-relay ADDR - act as relay bound to ADDR, e.g. -relay ::1 (by default dstaddr is ::1)" << endl
+         << "-linkaddr ADDR - link-addr field in RELAY-FORW (default ::)" << endl
+         << "-interfaceid N - interface-id option in RELAY-FORW (default not sent)" << endl
+         << "   -timeout is then max. time (in seconds) between RENEWs" << endl;
 }
 
 bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
@@ -40,6 +50,12 @@ bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
     char * iface   = 0;
     char * dstaddr = 0;
     int timeout  = 60; // default timeout value
+    int emulate  = 0;
+    int rate     = 100;
+    int renews   = 1;
+    char * relay = 0;
+    char * linkaddr = 0;
+    int interfaceid = 0;
     for (int i=1; i<argc; i++) {
         if (!strncmp(argv[i],"-addr", 5)) {
             if (argc==i) {
@@ -57,7 +73,7 @@ bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
             duid = argv[++i];
             continue;
         }
-        if (!strncmp(argv[i],"-i", 2)) {
+        if (!strcmp(argv[i],"-i")) {
             if (argc==i) {
                 Log(Error) << "Unable to parse command-line. -i used, but actual interface name is missing." << LogEnd;
                 return false;
@@ -80,6 +96,54 @@ bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
             dstaddr = argv[++i];
             continue;
         }
+        if (!strncmp(argv[i],"-emulate", 8)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -emulate used, but number of clients is missing." << LogEnd;
+                return false;
+            }
+            emulate = atoi(argv[++i]);
+            continue;
+        }
+        if (!strncmp(argv[i],"-rate", 5)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -rate used, but actual rate is missing." << LogEnd;
+                return false;
+            }
+            rate = atoi(argv[++i]);
+            continue;
+        }
+        if (!strncmp(argv[i],"-renews", 7)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -renews used, but number of renews is missing." << LogEnd;
+                return false;
+            }
+            renews = atoi(argv[++i]);
+            continue;
+        }
+        if (!strncmp(argv[i],"-relay", 6)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -relay used, but relay address is missing." << LogEnd;
+                return false;
+            }
+            relay = argv[++i];
+            continue;
+        }
+        if (!strncmp(argv[i],"-linkaddr", 9)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -linkaddr used, but link address is missing." << LogEnd;
+                return false;
+            }
+            linkaddr = argv[++i];
+            continue;
+        }
+        if (!strncmp(argv[i],"-interfaceid", 12)) {
+            if (argc==i+1) {
+                Log(Error) << "Unable to parse command-line. -interfaceid used, but interface-id is missing." << LogEnd;
+                return false;
+            }
+            interfaceid = atoi(argv[++i]);
+            continue;
+        }
         if (!strncmp(argv[i], "--help", 5) || !strncmp(argv[i], "-h", 5) || !strncmp(argv[i], "/help", 5) ||
             !strncmp(argv[i], "-?", 2) || !strncmp(argv[i], "/?",2)) {
             return false;
@@ -90,11 +154,20 @@ bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
         return false;
     }
 
-    if (!addr && !duid) {
+    if (emulate>0) {
+        if (addr || duid) {
+            Log(Error) << "-emulate can't be used together with -addr or -duid." << LogEnd;
+            return false;
+        }
+        if (rate<=0) {
+            Log(Error) << "Invalid -rate value, must be greater than 0." << LogEnd;
+            return false;
+        }
+    } else if (!addr && !duid) {
         Log(Error) << "Both address and DUID not defined." << LogEnd;
         return false;
     }
-    if (addr && duid) {
+    if (!emulate && addr && duid) {
         Log(Error) << "Both address and DUID defined." << LogEnd;
         return false;
     }
@@ -109,6 +182,12 @@ bool parseCmdLine(ReqCfgMgr *a, int argc, char *argv[])
     a->iface = iface;
     a->timeout= timeout;
     a->dstaddr = dstaddr;
+    a->emulate = emulate;
+    a->rate    = rate;
+    a->renews  = renews;
+    a->relay   = relay;
+    a->linkaddr = linkaddr;
+    a->interfaceid = interfaceid;
     return true;
 }
 
@@ -151,6 +230,18 @@ int main(int argc, char *argv[])
     }
 
     TIfaceMgr   * ifaceMgr = new TIfaceMgr(REQIFACEMGR_FILE, true);
+
+    if (a.emulate) {
+        ReqEmulator emulator(ifaceMgr, &a);
+        if (!emulator.BindSockets()) {
+            Log(Crit) << "Aborted. Socket binding failed." << LogEnd;
+            return LOWLEVEL_ERROR_BIND_FAILED;
+        }
+        emulator.Run();
+        emulator.PrintStats();
+        return LOWLEVEL_NO_ERROR;
+    }
+
     ReqTransMgr * transMgr = new ReqTransMgr(ifaceMgr);
 
     transMgr->SetParams(&a);
@@ -180,6 +271,10 @@ extern "C"
 {
     void *hmac_sha (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf, int type) { return 0; }
     void *hmac_md5 (const char *buffer, size_t len, char *key, size_t key_len, char *resbuf) { return 0; }
+    int   hmac_key_init (struct hmac_key *hk, const char *key, size_t key_len, int type) { return -1; }
+    void *hmac_key_digest (const struct hmac_key *hk, const char *buffer, size_t len, char *resbuf) { return 0; }
+    void  hmac_key_digest_mb (const struct hmac_key *hk[], const char *buffer[], const size_t len[],
+                              char *resbuf[], int n) { }
 }
 
 #ifndef WIN32
@@ -11,23 +11,60 @@
  */
 
 #include <stdlib.h>
+#include <stdio.h>
+#include <sstream>
 #include "SrvAddrMgr.h"
+#include "SrvReplMgr.h"
+#include "SrvLeaseStore.h"
 #include "AddrClient.h"
 #include "AddrIA.h"
 #include "AddrAddr.h"
 #include "Logger.h"
 #include "SrvCfgAddrClass.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 
 using namespace std;
 
 TSrvAddrMgr * TSrvAddrMgr::Instance = 0;
 
-TSrvAddrMgr::TSrvAddrMgr(const std::string& xmlfile, bool loadDB)
-    :TAddrMgr(xmlfile, loadDB) {
+TSrvAddrMgr::TSrvAddrMgr(const std::string& xmlfile, bool loadDB, const std::string& binfile,
+                         TLoadHook hook)
+    :TAddrMgr(xmlfile, false, binfile), OfferLifetime(SERVER_DEFAULT_OFFER_LIFETIME),
+     OfferLimit(SERVER_DEFAULT_OFFER_LIMIT), CacheSize(0), CacheMaxSize(999999999),
+     CacheDumpFile(SRVCACHE_FILE), CacheDumpPending(false), LastCacheDump(now()), DumpPending(false), LastDump(0),
+     DumpInterval(SERVER_DEFAULT_LEASE_DUMP_INTERVAL) {
+
+    LoadHook = hook;
+    if (loadDB)
+        load(xmlfile);
+    else
+        cacheRead();
+    countClntAddrs();
+}
 
-    this->CacheMaxSize = 999999999;
-    this->cacheRead();
+/**
+ * @brief loads lease database and address cache
+ *
+ * Binary database is used if it is available. Otherwise XML database is
+ * parsed by several threads (one per CPU) and cache is read in the meantime.
+ *
+ * @param xmlFile XML database
+ */
+void TSrvAddrMgr::load(const std::string& xmlFile) {
+    if (binIsCurrent(xmlFile) && binLoad(BinFile.c_str())) {
+        cacheRead();
+        return;
+    }
+
+    if (xmlLoadStart(xmlFile.c_str(), get_cpu_count())) {
+        cacheRead();
+        xmlLoadFinish();
+        return;
+    }
+
+    dbLoad(xmlFile.c_str());
+    cacheRead();
 }
 
 TSrvAddrMgr::~TSrvAddrMgr() {
@@ -60,12 +97,7 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
                               bool quiet)
 {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -111,6 +143,11 @@ bool TSrvAddrMgr::addClntAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
     if (!quiet)
         Log(Debug) << "Adding " << ptrAddr->get()->getPlain()
                    << " to IA (IAID=" << IAID << ") to addrDB." << LogEnd;
+    SrvReplMgr().addLease(TAddrIA::TYPE_IA, clntDuid, clntAddr, iface, IAID, T1, T2,
+                          addr, pref, valid, 128);
+    SrvLeaseStore().addLease(TAddrIA::TYPE_IA, clntDuid, clntAddr, iface, IAID, T1, T2,
+                             addr, pref, valid, 128);
+    ClntAddrCount[string(clntDuid->get(), clntDuid->getLen())]++;
     return true;
 }
 
@@ -127,12 +164,7 @@ bool TSrvAddrMgr::delClntAddr(SPtr<TDUID> clntDuid, unsigned long IAID,
 {
 
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
     if (!ptrClient) { // have we found this client?
         Log(Warning) << "Client (DUID=" << clntDuid->getPlain()
                      << ") not found in addrDB, cannot delete address and/or client." << LogEnd;
@@ -166,6 +198,12 @@ bool TSrvAddrMgr::delClntAddr(SPtr<TDUID> clntDuid, unsigned long IAID,
 
     ptrIA->delAddr(clntAddr);
     this->addCachedEntry(clntDuid, clntAddr, TAddrIA::TYPE_IA);
+    string duidKey(clntDuid->get(), clntDuid->getLen());
+    unsigned long * cnt = ClntAddrCount.find(duidKey);
+    if (cnt && !--*cnt)
+        ClntAddrCount.erase(duidKey);
+    SrvReplMgr().delLease(TAddrIA::TYPE_IA, clntDuid, IAID, clntAddr);
+    SrvLeaseStore().delLease(TAddrIA::TYPE_IA, clntDuid, IAID, clntAddr);
     if (!quiet)
         Log(Debug) << "Deleted address " << *clntAddr << " from addrDB." << LogEnd;
 
@@ -203,12 +241,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
                             int iface, unsigned long iaid, SPtr<TIPv6Addr> addr,
                             unsigned long pref, unsigned long valid) {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -268,12 +301,7 @@ bool TSrvAddrMgr::addTAAddr(SPtr<TDUID> clntDuid , SPtr<TIPv6Addr> clntAddr,
 bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
                             SPtr<TIPv6Addr> clntAddr, bool quiet) {
     // find this client
-    SPtr <TAddrClient> ptrClient;
-    this->firstClient();
-    while ( ptrClient = this->getClient() ) {
-        if ( (*ptrClient->getDUID()) == (*clntDuid) )
-            break;
-    }
+    SPtr<TAddrClient> ptrClient = this->getClient(clntDuid);
 
     // have we found this client?
     if (!ptrClient) {
@@ -330,43 +358,80 @@ bool TSrvAddrMgr::delTAAddr(SPtr<TDUID> clntDuid, unsigned long iaid,
     return true;
 }
 
+bool TSrvAddrMgr::addPrefix(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr,
+                            int iface, unsigned long IAID, unsigned long T1, unsigned long T2,
+                            SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
+                            int length, bool quiet)
+{
+    bool result = TAddrMgr::addPrefix(clntDuid, clntAddr, iface, IAID, T1, T2, prefix,
+                                      pref, valid, length, quiet);
+    if (result) {
+        SrvReplMgr().addLease(TAddrIA::TYPE_PD, clntDuid, clntAddr, iface, IAID, T1, T2,
+                              prefix, pref, valid, length);
+        SrvLeaseStore().addLease(TAddrIA::TYPE_PD, clntDuid, clntAddr, iface, IAID, T1, T2,
+                                 prefix, pref, valid, length);
+    }
+    return result;
+}
+
 bool TSrvAddrMgr::delPrefix(SPtr<TDUID> clntDuid, unsigned long IAID, SPtr<TIPv6Addr> prefix, bool quiet)
 {
     bool result = TAddrMgr::delPrefix(clntDuid, IAID, prefix, quiet);
-    if (result)
+    if (result) {
         addCachedEntry(clntDuid, prefix, TAddrIA::TYPE_PD);
+        SrvReplMgr().delLease(TAddrIA::TYPE_PD, clntDuid, IAID, prefix);
+        SrvLeaseStore().delLease(TAddrIA::TYPE_PD, clntDuid, IAID, prefix);
+    }
     return result;
 }
 
+/// checks if prefix is unused (also by other workers) and may be assigned by this server,
+/// if pool is shared with peer (peer-owned prefixes only if peerOwned is set)
+bool TSrvAddrMgr::prefixIsFree(SPtr<TIPv6Addr> prefix, bool peerOwned)
+{
+    return TAddrMgr::prefixIsFree(prefix) && SrvLeaseStore().isFree(TAddrIA::TYPE_PD, prefix)
+        && SrvReplMgr().mayAssign(prefix, peerOwned);
+}
+
 /*
  * how many addresses does this client have?
+ * (counted when addresses are added or deleted, see countClntAddrs())
  */
 unsigned long TSrvAddrMgr::getAddrCount(SPtr<TDUID> duid)
 {
-    SPtr <TAddrClient> ptrClient;
-    ClntsLst.first();
-    while ( ptrClient = ClntsLst.get() ) {
-        if ( (*ptrClient->getDUID()) == (*duid))
-            break;
-    }
-    // Have we found this client?
-    if (!ptrClient) {
-        return 0;
-    }
+    unsigned long * cnt = ClntAddrCount.find(string(duid->get(), duid->getLen()));
+    return cnt ? *cnt : 0;
+}
 
-    unsigned long count=0;
+/**
+ * @brief counts addresses of every client loaded from lease database
+ *
+ * Later these counters are updated in addClntAddr() and delClntAddr().
+ */
+void TSrvAddrMgr::countClntAddrs()
+{
+    ClntAddrCount.clear();
 
-    // look at each of client's IAs
-    SPtr <TAddrIA> ptrIA;
-    ptrClient->firstIA();
-    while ( ptrIA = ptrClient->getIA() ) {
-        count += ptrIA->countAddr();
+    SPtr<TAddrClient> client;
+    ClntsLst.first();
+    while (client = ClntsLst.get()) {
+        unsigned long count = 0;
+        SPtr<TAddrIA> ia;
+        client->firstIA();
+        while (ia = client->getIA())
+            count += ia->countAddr();
+        if (count)
+            ClntAddrCount[string(client->getDUID()->get(), client->getDUID()->getLen())] = count;
     }
-    return count;
 }
 
-bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr)
+/// checks if address is unused (also by other workers) and may be assigned by this server,
+/// if pool is shared with peer (peer-owned addresses only if peerOwned is set)
+bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr, bool peerOwned)
 {
+    if (addrIsOffered(addr, TAddrIA::TYPE_IA))
+        return false;
+
     // for each client...
     SPtr <TAddrClient> ptrClient;
     ClntsLst.first();
@@ -383,7 +448,9 @@ bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr)
                 return false;
         }
     }
-    return true;
+
+    // other worker may have assigned it, pool may be shared with replication peer
+    return SrvLeaseStore().isFree(TAddrIA::TYPE_IA, addr) && SrvReplMgr().mayAssign(addr, peerOwned);
 }
 
 /**
@@ -395,6 +462,9 @@ bool TSrvAddrMgr::addrIsFree(SPtr<TIPv6Addr> addr)
  */
 bool TSrvAddrMgr::taAddrIsFree(SPtr<TIPv6Addr> addr)
 {
+    if (addrIsOffered(addr, TAddrIA::TYPE_TA))
+        return false;
+
     // for each client...
     SPtr <TAddrClient> ptrClient;
     ClntsLst.first();
@@ -411,51 +481,6 @@ bool TSrvAddrMgr::taAddrIsFree(SPtr<TIPv6Addr> addr)
     return true;
 }
 
-void TSrvAddrMgr::getAddrsCount(
-     SPtr<TContainer<SPtr<TSrvCfgAddrClass> > > classes,
-     long    *clntCnt,
-     long    *addrCnt,
-     SPtr<TDUID> duid,
-     int iface)
-{
-    memset(clntCnt,0,sizeof(long)*classes->count());
-    memset(addrCnt,0,sizeof(long)*classes->count());
-    int classNr=0;
-
-    SPtr<TAddrClient> ptrClient;
-    firstClient();
-    while(ptrClient=getClient())
-    {
-        bool thisClient=(*(ptrClient->getDUID())==*duid);
-        ptrClient->firstIA();
-        SPtr<TAddrIA> ptrIA;
-        while(ptrIA=ptrClient->getIA())
-        {
-            SPtr<TAddrAddr> ptrAddr;
-            ptrIA->firstAddr();
-            while(ptrAddr=ptrIA->getAddr())
-            {
-                if(ptrIA->getIface()==iface)
-                {
-                    SPtr<TSrvCfgAddrClass> ptrClass;
-                    classes->first();
-                    classNr=0;
-                    while(ptrClass=classes->get())
-                    {
-                        if(ptrClass->addrInPool(ptrAddr->get()))
-                        {
-                            if(thisClient)
-                                clntCnt[classNr]++;
-                            addrCnt[classNr]++;
-                        }
-                        classNr++;
-                    }
-                }
-            }
-        }
-    }
-}
-
 SPtr<TIPv6Addr> TSrvAddrMgr::getFirstAddr(SPtr<TDUID> clntDuid)
 {
     SPtr<TAddrClient> ptrAddrClient = this->getClient(clntDuid);
@@ -571,8 +596,215 @@ void TSrvAddrMgr::doDuties(std::vector<TExpiredInfo>& addrLst,
     } // while (client)
 }
 
+// --------------------------------------------------------------------
+// --- tentative offers -----------------------------------------------
+// --------------------------------------------------------------------
+
+/// builds offer key for a client's IA
+std::string TSrvAddrMgr::offerKey(TAddrIA::TIAType type, unsigned long iaid, SPtr<TDUID> duid) {
+    std::string key(1, (char)type);
+    for (int i = 24; i >= 0; i -= 8)
+        key.append(1, (char)(iaid >> i));
+    key.append(duid->get(), duid->getLen());
+    return key;
+}
+
+/// builds key of offered addresses counter for a link
+std::string TSrvAddrMgr::countKey(int iface, TAddrIA::TIAType type) {
+    std::ostringstream key;
+    key << iface << "/" << (int)type;
+    return key.str();
+}
+
+/// builds key of offered addresses counter for a pool (class) on a link
+std::string TSrvAddrMgr::countKey(int iface, TAddrIA::TIAType type, unsigned long pool) {
+    std::ostringstream key;
+    key << iface << "/" << (int)type << "/" << pool;
+    return key.str();
+}
+
+/**
+ * remembers address or prefix offered to a client in ADVERTISE. It is not stored
+ * in the lease database, but is not offered to other clients until REQUEST arrives
+ * or offer lifetime passes.
+ *
+ * At most OfferLimit addresses (of each type) are held on a link, so a flood
+ * of SOLICITs can't reserve whole pool. When limit is reached, address is
+ * still advertised, but it is not held.
+ *
+ * @param clntDuid client DUID
+ * @param iaid IAID of client's IA (or PD)
+ * @param type type of offer (TYPE_IA, TYPE_TA or TYPE_PD)
+ * @param addr offered address (or prefix)
+ * @param iface interface index of the link
+ * @param pool ID of the class (or TA, PD pool) address belongs to
+ *
+ * @return true if offer is held, false if limit was reached
+ */
+bool TSrvAddrMgr::addOffer(SPtr<TDUID> clntDuid, unsigned long iaid, TAddrIA::TIAType type,
+                           SPtr<TIPv6Addr> addr, int iface, unsigned long pool) {
+    if (!OfferLifetime)
+        return false;
+
+    std::string key = offerKey(type, iaid, clntDuid);
+    std::string addrKey = cacheKey(type, addr);
+
+    std::map<std::string, std::string>::iterator old = OfferedAddrs.find(addrKey);
+    if (old != OfferedAddrs.end() && old->second != key) {
+        TOfferMap::iterator other = Offers.find(old->second);
+        if (other != Offers.end())
+            delOffer(other);
+    }
+
+    TOfferMap::iterator it = Offers.find(key);
+    if (it != Offers.end() && it->second.Expire->first < now()) {
+        delOffer(it); // expired, but not removed yet
+        it = Offers.end();
+    }
+
+    if (getOfferedCount(iface, type) >= OfferLimit) {
+        expireOffers();
+        if (getOfferedCount(iface, type) >= OfferLimit) {
+            Log(Debug) << "Offer: " << OfferLimit << " addresses are already offered on this link, "
+                       << addr->getPlain() << " is not held." << LogEnd;
+            return false;
+        }
+        it = Offers.find(key);
+    }
+
+    if (it == Offers.end()) {
+        it = Offers.insert(std::make_pair(key, TSrvOffer())).first;
+        it->second.Iface = iface;
+        it->second.Expire = OfferExpiry.insert(std::make_pair(now() + OfferLifetime, key));
+    }
+    it->second.Addrs.push_back(addr);
+    it->second.Pools.push_back(pool);
+    OfferedAddrs[addrKey] = key;
+    OfferedCount[countKey(iface, type)]++;
+    OfferedCount[countKey(iface, type, pool)]++;
+
+    Log(Debug) << "Offer: " << addr->getPlain() << " held for client (DUID=" << clntDuid->getPlain()
+               << ", IAID=" << iaid << ") for " << OfferLifetime << " seconds." << LogEnd;
+    return true;
+}
+
+/**
+ * removes offer made to a client's IA (e.g. when client sends REQUEST, so
+ * offered address can be assigned to it).
+ *
+ * @param clntDuid client DUID
+ * @param iaid IAID of client's IA (or PD)
+ * @param type type of offer (TYPE_IA, TYPE_TA or TYPE_PD)
+ *
+ * @return first offered address (or prefix), 0 if there was no offer
+ */
+SPtr<TIPv6Addr> TSrvAddrMgr::takeOffer(SPtr<TDUID> clntDuid, unsigned long iaid, TAddrIA::TIAType type) {
+    TOfferMap::iterator it = Offers.find(offerKey(type, iaid, clntDuid));
+    if (it == Offers.end())
+        return 0;
+    SPtr<TIPv6Addr> addr;
+    if (it->second.Expire->first >= now() && !it->second.Addrs.empty())
+        addr = it->second.Addrs[0];
+    delOffer(it);
+    return addr;
+}
+
+/// checks if address (or prefix) is currently offered to any client
+bool TSrvAddrMgr::addrIsOffered(SPtr<TIPv6Addr> addr, TAddrIA::TIAType type) {
+    if (OfferedAddrs.empty())
+        return false;
+    std::map<std::string, std::string>::iterator it = OfferedAddrs.find(cacheKey(type, addr));
+    if (it == OfferedAddrs.end())
+        return false;
+    TOfferMap::iterator offer = Offers.find(it->second);
+    return offer != Offers.end() && offer->second.Expire->first >= now();
+}
+
+/// returns number of addresses (or prefixes) offered on a link
+unsigned long TSrvAddrMgr::getOfferedCount(int iface, TAddrIA::TIAType type) {
+    if (OfferedCount.empty())
+        return 0;
+    std::map<std::string, unsigned long>::iterator it = OfferedCount.find(countKey(iface, type));
+    return it == OfferedCount.end() ? 0 : it->second;
+}
+
+/// returns number of addresses (or prefixes) offered from a pool (class) on a link
+unsigned long TSrvAddrMgr::getOfferedCount(int iface, TAddrIA::TIAType type, unsigned long pool) {
+    if (OfferedCount.empty())
+        return 0;
+    std::map<std::string, unsigned long>::iterator it = OfferedCount.find(countKey(iface, type, pool));
+    return it == OfferedCount.end() ? 0 : it->second;
+}
+
+/// removes offer and all its addresses
+void TSrvAddrMgr::delOffer(TOfferMap::iterator offer) {
+    TAddrIA::TIAType type = (TAddrIA::TIAType)offer->first[0];
+    for (unsigned int i = 0; i < offer->second.Addrs.size(); i++) {
+        std::map<std::string, std::string>::iterator it =
+            OfferedAddrs.find(cacheKey(type, offer->second.Addrs[i]));
+        if (it != OfferedAddrs.end() && it->second == offer->first)
+            OfferedAddrs.erase(it);
+
+        std::string keys[2] = { countKey(offer->second.Iface, type),
+                                countKey(offer->second.Iface, type, offer->second.Pools[i]) };
+        for (int j = 0; j < 2; j++) {
+            std::map<std::string, unsigned long>::iterator cnt = OfferedCount.find(keys[j]);
+            if (cnt != OfferedCount.end() && !--cnt->second)
+                OfferedCount.erase(cnt);
+        }
+    }
+    OfferExpiry.erase(offer->second.Expire);
+    Offers.erase(offer);
+}
+
+/// returns number of seconds until the oldest offer expires
+unsigned long TSrvAddrMgr::getOfferTimeout() {
+    if (OfferExpiry.empty())
+        return DHCPV6_INFINITY;
+    unsigned long current = now();
+    if (OfferExpiry.begin()->first < current)
+        return 0;
+    return OfferExpiry.begin()->first - current + 1;
+}
+
+/// removes offers that were not followed by REQUEST in time
+void TSrvAddrMgr::expireOffers() {
+    unsigned long current = now();
+    int cnt = 0;
+    while (!OfferExpiry.empty() && OfferExpiry.begin()->first < current) {
+        TOfferMap::iterator it = Offers.find(OfferExpiry.begin()->second);
+        if (it == Offers.end()) {
+            OfferExpiry.erase(OfferExpiry.begin()); // should not happen
+            continue;
+        }
+        delOffer(it);
+        cnt++;
+    }
+    if (cnt)
+        Log(Debug) << "Offer: " << cnt << " offer(s) expired without REQUEST." << LogEnd;
+}
+
+// --------------------------------------------------------------------
+// --- address and prefix cache ---------------------------------------
+// --------------------------------------------------------------------
+
+/// builds cache index key for a client DUID
+std::string TSrvAddrMgr::cacheKey(TAddrIA::TIAType type, SPtr<TDUID> duid) {
+    std::string key(1, (char)type);
+    key.append(duid->get(), duid->getLen());
+    return key;
+}
+
+/// builds cache index key for an address or prefix
+std::string TSrvAddrMgr::cacheKey(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr) {
+    std::string key(1, (char)type);
+    key.append(addr->getAddr(), 16);
+    return key;
+}
+
 /**
- * returns address or prefix cached for this client.
+ * returns address or prefix cached for this client. Found entry becomes the most
+ * recently used one.
  *
  * @param clntDuid
  * @param type type of entry looked for (TYPE_IA for address or TYPE_PD for prefix)
@@ -582,23 +814,19 @@ void TSrvAddrMgr::doDuties(std::vector<TExpiredInfo>& addrLst,
 SPtr<TIPv6Addr> TSrvAddrMgr::getCachedEntry(SPtr<TDUID> clntDuid, TAddrIA::TIAType type) {
     if (!this->CacheMaxSize)
         return 0;
-    SPtr<TSrvCacheEntry> entry;
-    this->Cache.first();
-
-    while (entry = this->Cache.get()) {
-            if (!entry->Duid)
-                continue; // something is wrong. VERY wrong. But shut up and continue.
-            if ((entry->type==type) && (*entry->Duid == *clntDuid) ) {
-                Log(Debug) << "Cache: Cached " << (type==TAddrIA::TYPE_IA?"address":"prefix")
-                           << " for client (DUID=" << clntDuid->getPlain() << ") found: "
-                           << entry->Addr->getPlain() << LogEnd;
-                return entry->Addr;
-            }
+
+    TCacheList::iterator * it = CacheByDuid.find(cacheKey(type, clntDuid));
+    if (!it) {
+        Log(Debug) << "Cache: There are no cached " << (type==TAddrIA::TYPE_IA?"address":"prefix")
+                   << " address entries for client (DUID=" << clntDuid->getPlain() << ")." << LogEnd;
+        return 0;
     }
 
-    Log(Debug) << "Cache: There are no cached " << (type==TAddrIA::TYPE_IA?"address":"prefix")
-               << " address entries for client (DUID=" << clntDuid->getPlain() << ")." << LogEnd;
-    return 0;
+    Cache.splice(Cache.end(), Cache, *it);
+    Log(Debug) << "Cache: Cached " << (type==TAddrIA::TYPE_IA?"address":"prefix")
+               << " for client (DUID=" << clntDuid->getPlain() << ") found: "
+               << (*it)->Addr->getPlain() << LogEnd;
+    return (*it)->Addr;
 }
 
 /**
@@ -613,21 +841,15 @@ bool TSrvAddrMgr::delCachedEntry(SPtr<TIPv6Addr> addr, TAddrIA::TIAType type) {
     if (!this->CacheMaxSize)
             return false;
 
-    this->Cache.first();
-    SPtr<TSrvCacheEntry> entry;
-    while (entry = this->Cache.get()) {
-            if (!entry->Addr)
-                continue; // something is wrong. VERY wrong. But shut up and continue.
-            if ( (entry->type==type) && (*(entry->Addr) == *addr) ) {
-                this->Cache.del();
-                this->Cache.first();
-                Log(Debug) << "Cache: " << (type==TAddrIA::TYPE_IA?"Address ":"Prefix ")
-                           << *addr << " was deleted." << LogEnd;
-                return true;
-            }
+    TCacheList::iterator * it = CacheByAddr.find(cacheKey(type, addr));
+    if (!it) {
+        Log(Debug) << "Cache: Attempt to delete " << *addr << " failed." << LogEnd;
+        return false;
     }
-    Log(Debug) << "Cache: Attempt to delete " << *addr << " failed." << LogEnd;
-    return false;
+    cacheErase(*it);
+    Log(Debug) << "Cache: " << (type==TAddrIA::TYPE_IA?"Address ":"Prefix ")
+               << *addr << " was deleted." << LogEnd;
+    return true;
 }
 
  /**
@@ -642,21 +864,14 @@ bool TSrvAddrMgr::delCachedEntry(SPtr<TDUID> clntDuid, TAddrIA::TIAType type) {
     if (!this->CacheMaxSize)
         return false;
 
-    this->Cache.first();
-    SPtr<TSrvCacheEntry> entry;
-    while (entry = this->Cache.get()) {
-        if (!entry->Duid)
-            continue; // something is wrong. VERY wrong. But shut up and continue.
-        if ( (entry->type==type) && (*(entry->Duid) == *clntDuid) ) {
-            this->Cache.del();
-            this->Cache.first();
-            Log(Debug) << "Cache: Entry for client (DUID=" << clntDuid->getPlain() << ") was deleted." << LogEnd;
-            return true;
-        }
+    TCacheList::iterator * it = CacheByDuid.find(cacheKey(type, clntDuid));
+    if (!it) {
+        // delete attempt is done on multiple occasions as a safety precausion, so don't warn if it is missing
+        return false;
     }
-    // delete attempt is done on multiple occasions as a safety precausion, so don't warn if it is missing
-    // Log(Debug) << "Cache: Attempt to delete entry for client (DUID=" << clntDuid->getPlain() << ") failed." << LogEnd;
-    return false;
+    cacheErase(*it);
+    Log(Debug) << "Cache: Entry for client (DUID=" << clntDuid->getPlain() << ") was deleted." << LogEnd;
+    return true;
 }
 
 /**
@@ -669,68 +884,144 @@ bool TSrvAddrMgr::delCachedEntry(SPtr<TDUID> clntDuid, TAddrIA::TIAType type) {
 void TSrvAddrMgr::addCachedEntry(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> cachedAddr, TAddrIA::TIAType type) {
     if (!this->CacheMaxSize)
         return;
-    SPtr<TSrvCacheEntry> entry;
-
-    // is there an entry for this client, delete it. New entry will be added at the end
-    this->delCachedEntry(clntDuid, type);
 
-    entry = new TSrvCacheEntry();
-    entry->type = type;
-    entry->Duid = clntDuid;
-    entry->Addr = cachedAddr;
+    cacheInsert(clntDuid, cachedAddr, type);
     Log(Debug) << "Cache: " << (type==TAddrIA::TYPE_IA?"Address ":"Prefix ") << cachedAddr->getPlain()
                << " added for client (DUID=" << clntDuid->getPlain() << "). " << LogEnd;
-    this->Cache.append(entry);
     this->checkCacheSize();
 }
 
+/**
+ * adds an entry as the most recently used one. Previous entry for this client and entry
+ * for this address (possibly cached for other client) are replaced.
+ *
+ * @param clntDuid
+ * @param addr
+ * @param type type of entry (TYPE_IA for address or TYPE_PD for prefix)
+ */
+void TSrvAddrMgr::cacheInsert(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> addr, TAddrIA::TIAType type) {
+    std::string duidKey = cacheKey(type, clntDuid);
+    std::string addrKey = cacheKey(type, addr);
+
+    TCacheList::iterator * it = CacheByDuid.find(duidKey);
+    if (it)
+        cacheErase(*it);
+    it = CacheByAddr.find(addrKey);
+    if (it)
+        cacheErase(*it);
+
+    TSrvCacheEntry entry;
+    entry.type = type;
+    entry.Duid = clntDuid;
+    entry.Addr = addr;
+    // list node, DUID and address objects, and a hash node + key + bucket in both indexes
+    entry.Size = sizeof(TSrvCacheEntry) + 2*sizeof(void*) + sizeof(TIPv6Addr) + sizeof(TDUID)
+        + clntDuid->getLen() + 2*(sizeof(TCacheIndex::Node) + sizeof(void*))
+        + duidKey.length() + addrKey.length();
+
+    TCacheList::iterator pos = Cache.insert(Cache.end(), entry);
+    CacheByDuid[duidKey] = pos;
+    CacheByAddr[addrKey] = pos;
+    CacheSize += entry.Size;
+    CacheDumpPending = true;
+}
+
+/// removes entry from cache and both its indexes
+void TSrvAddrMgr::cacheErase(TCacheList::iterator entry) {
+    CacheByDuid.erase(cacheKey(entry->type, entry->Duid));
+    CacheByAddr.erase(cacheKey(entry->type, entry->Addr));
+    CacheSize -= entry->Size;
+    Cache.erase(entry);
+    CacheDumpPending = true;
+}
+
 void TSrvAddrMgr::setCacheSize(int bytes) {
-    int entrySize = sizeof(TSrvCacheEntry) + sizeof(TIPv6Addr) + sizeof(TDUID);
-    this->CacheMaxSize = bytes/entrySize;
-    Log(Debug) << "Cache: size set to " << bytes << " bytes, 1 cache entry size is " << entrySize
-                   << " bytes, so maximum " << this->CacheMaxSize << " address-client pair(s) may be cached." << LogEnd;
+    this->CacheMaxSize = bytes;
+    Log(Debug) << "Cache: size set to " << bytes << " bytes, " << CacheSize << " bytes used by "
+               << Cache.size() << " address-client pair(s)." << LogEnd;
     this->checkCacheSize();
 }
 
 /**
- * this function checks if the cache size was not exceeded. If that is so, oldest entries are removed
+ * this function checks if the cache size was not exceeded. If that is so, least
+ * recently used entries are removed
  *
  */
 void TSrvAddrMgr::checkCacheSize() {
-    if (this->Cache.count() <= this->CacheMaxSize)
-        return;
-
-    // there are too many cached elements, delete some
-    while (this->Cache.count() > this->CacheMaxSize) {
-        this->Cache.delFirst();
+    while (CacheSize > CacheMaxSize && !Cache.empty()) {
+        cacheErase(Cache.begin());
     }
 }
 
 void TSrvAddrMgr::print(std::ostream & out) {
-    out << "  <cache size=\"" << this->Cache.count() << "\"/>" << endl;
+    out << "  <cache size=\"" << this->Cache.size() << "\"/>" << endl;
 }
 
+/**
+ * dumps lease database. Cache is written only if it changed and SERVER_DEFAULT_DUMP_INTERVAL
+ * passed since it was written last time, as it may be large.
+ */
 void TSrvAddrMgr::dump() {
 
     TAddrMgr::dump(); // perform normal dump of the AddrMgr
-    cacheDump();
+    DumpPending = false;
+    LastDump = now();
+    cacheDumpIfDue();
 }
 
 /**
- * dumps address cache into a file specified by SRVCACHE_FILE
+ * notes that leases changed. Database is written later from the main loop,
+ * at most once per DumpInterval seconds, so busy server does not rewrite
+ * (possibly large) database after every message. With DumpInterval 0 it is
+ * written right away.
+ */
+void TSrvAddrMgr::scheduleDump() {
+    DumpPending = true;
+    if (!DumpInterval)
+        dump();
+}
+
+/// writes scheduled dump, if DumpInterval passed since the last one
+void TSrvAddrMgr::dumpIfDue() {
+    if (DumpPending && !getDumpTimeout())
+        dump();
+}
+
+/// returns number of seconds until scheduled dump is due
+unsigned long TSrvAddrMgr::getDumpTimeout() {
+    if (!DumpPending)
+        return DHCPV6_INFINITY;
+    unsigned long current = now();
+    if (current - LastDump >= DumpInterval)
+        return 0;
+    return DumpInterval - (current - LastDump);
+}
+
+/// returns number of seconds until changed cache should be written
+unsigned long TSrvAddrMgr::getCacheDumpTimeout() {
+    if (!CacheDumpPending)
+        return DHCPV6_INFINITY;
+    unsigned long current = now();
+    if (current - LastCacheDump >= SERVER_DEFAULT_DUMP_INTERVAL)
+        return 0;
+    return SERVER_DEFAULT_DUMP_INTERVAL - (current - LastCacheDump);
+}
+
+/// writes the cache, if it changed and dump interval passed since the last write
+void TSrvAddrMgr::cacheDumpIfDue() {
+    if (CacheDumpPending && !getCacheDumpTimeout())
+        cacheDump();
+}
+
+/**
+ * dumps address cache into a file specified by SRVCACHE_FILE. File is replaced
+ * atomically (see TStateFile) and only if its content has changed.
  *
  */
 void TSrvAddrMgr::cacheDump() {
-    std::ofstream f;
-    f.open(SRVCACHE_FILE);
-    if (!f.is_open()) {
-        Log(Error) << "Cache: File " << SRVCACHE_FILE << " creation failed." << LogEnd;
-        return;
-    }
-    f << "<cache size=\"" << this->Cache.count() << "\">" << endl;
-    SPtr<TSrvCacheEntry> x;
-    this->Cache.first();
-    while (x=this->Cache.get()) {
+    std::ostringstream f;
+    f << "<cache size=\"" << this->Cache.size() << "\">" << endl;
+    for (TCacheList::iterator x = Cache.begin(); x != Cache.end(); ++x) {
         f << "  <entry type=\"";
         switch (x->type) {
         case TAddrIA::TYPE_IA:
@@ -753,7 +1044,9 @@ void TSrvAddrMgr::cacheDump() {
         f << "</entry>" << endl;
     }
     f << "</cache>" << endl;
-    f.close();
+    CacheDumpFile.write(f.str());
+    CacheDumpPending = false;
+    LastCacheDump = now();
 }
 
 /**
@@ -762,7 +1055,10 @@ void TSrvAddrMgr::cacheDump() {
  */
 void TSrvAddrMgr::cacheRead() {
 
-    this->Cache.clear();
+    Cache.clear();
+    CacheByDuid.clear();
+    CacheByAddr.clear();
+    CacheSize = 0;
     bool started = false;
     bool ended = false;
     bool parsed = false;
@@ -825,7 +1121,7 @@ void TSrvAddrMgr::cacheRead() {
 
                 SPtr<TIPv6Addr> tmp2 = new TIPv6Addr(addr.c_str(), true);
                 SPtr<TDUID>     tmp1 = new TDUID(duid.c_str());
-                addCachedEntry(tmp1, tmp2, type);
+                cacheInsert(tmp1, tmp2, type);
             } else {
                 Log(Error) << "Cache: " << SRVCACHE_FILE << " file: missing duid=\"...\" in line " << lineno
                            << "." << LogEnd;
@@ -846,9 +1142,11 @@ void TSrvAddrMgr::cacheRead() {
     }
     f.close();
 
-    if (this->Cache.count() != entries) {
+    checkCacheSize();
+    CacheDumpPending = false;
+    if ((int)this->Cache.size() != entries) {
         Log(Debug) << "Cache: " << SRVCACHE_FILE << " file: " << entries << " entries expected, but "
-                   << this->Cache.count() << " found." << LogEnd;
+                   << this->Cache.size() << " found." << LogEnd;
     }
     if (!parsed) {
         Log(Info) << "Did not find any useful information in " << SRVCACHE_FILE << LogEnd;
@@ -858,13 +1156,61 @@ void TSrvAddrMgr::cacheRead() {
     }
 }
 
-void TSrvAddrMgr::instanceCreate( const std::string xmlFile, bool loadDB )
+void TSrvAddrMgr::instanceCreate( const std::string xmlFile, bool loadDB, TLoadHook hook )
 {
     if (Instance) {
         Log(Crit) << "SrvAddrMgr already exists! Application error" << LogEnd;
         return;
     }
-    Instance = new TSrvAddrMgr(xmlFile, loadDB);
+    Instance = new TSrvAddrMgr(xmlFile, loadDB, SRVADDRDB_FILE, hook);
+}
+
+/**
+ * @brief converts lease database between XML and binary format
+ *
+ * Format is selected by file name: files ending with .xml are XML,
+ * all other are binary.
+ *
+ * @param src database to be read
+ * @param dst database to be written
+ *
+ * @return true if conversion was successful
+ */
+bool TSrvAddrMgr::convertDb(const std::string& src, const std::string& dst)
+{
+    TSrvAddrMgr db(src, false, "", 0);
+    bool loaded;
+    if (src.length() > 4 && src.substr(src.length() - 4) == ".xml") {
+        if (db.xmlLoadStart(src.c_str(), get_cpu_count()))
+            loaded = db.xmlLoadFinish();
+        else
+            loaded = db.xmlLoadBuiltIn(src.c_str());
+    }
+    else
+        loaded = db.binLoad(src.c_str());
+    if (!loaded) {
+        Log(Error) << "Unable to load lease database from " << src << "." << LogEnd;
+        return false;
+    }
+    if (!db.dbSave(dst.c_str())) {
+        Log(Error) << "Unable to write lease database to " << dst << "." << LogEnd;
+        return false;
+    }
+    Log(Notice) << db.countClient() << " client(s) converted from " << src << " to " << dst << "." << LogEnd;
+    return true;
+}
+
+/**
+ * @brief loads lease database other than server's own one (e.g. of other worker)
+ *
+ * @param xmlFile XML database
+ * @param binFile binary database (used if it is not older than XML one)
+ *
+ * @return loaded database
+ */
+SPtr<TSrvAddrMgr> TSrvAddrMgr::loadDb(const std::string& xmlFile, const std::string& binFile)
+{
+    return new TSrvAddrMgr(xmlFile, true, binFile, 0);
 }
 
 TSrvAddrMgr & TSrvAddrMgr::instance()
@@ -13,7 +13,11 @@
 #define SRVADDRMGR_H
 
 #include <vector>
+#include <list>
+#include <map>
+#include <string>
 #include "AddrMgr.h"
+#include "HashMap.h"
 #include "SrvCfgAddrClass.h"
 #include "SrvCfgPD.h"
 
@@ -22,8 +26,10 @@
 class TSrvAddrMgr : public TAddrMgr
 {
   public:
-    static void instanceCreate(const std::string xmlFile, bool loadDB);
+    static void instanceCreate(const std::string xmlFile, bool loadDB, TLoadHook hook = 0);
     static TSrvAddrMgr & instance();
+    static bool convertDb(const std::string& src, const std::string& dst);
+    static SPtr<TSrvAddrMgr> loadDb(const std::string& xmlFile, const std::string& binFile);
 
     class TSrvCacheEntry
     {
@@ -31,6 +37,7 @@ class TSrvAddrMgr : public TAddrMgr
         TAddrIA::TIAType type; // address or prefix
         SPtr<TIPv6Addr> Addr;  // cached address, previously assigned to a client
         SPtr<TDUID>     Duid;  // client's duid
+        unsigned int    Size;  // memory used by this entry (incl. indexes), in bytes
     };
 
     struct TExpiredInfo
@@ -58,7 +65,12 @@ class TSrvAddrMgr : public TAddrMgr
     bool delTAAddr(SPtr<TDUID> duid,unsigned long iaid, SPtr<TIPv6Addr> addr, bool quiet);
 
     // prefix management
+    virtual bool addPrefix(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr,
+                           int iface, unsigned long IAID, unsigned long T1, unsigned long T2,
+                           SPtr<TIPv6Addr> prefix, unsigned long pref, unsigned long valid,
+                           int length, bool quiet);
     virtual bool delPrefix(SPtr<TDUID> clntDuid, unsigned long IAID, SPtr<TIPv6Addr> prefix, bool quiet);
+    bool prefixIsFree(SPtr<TIPv6Addr> prefix, bool peerOwned = false);
 
     // how many addresses does this client have?
     unsigned long getAddrCount(SPtr<TDUID> duid);
@@ -67,10 +79,7 @@ class TSrvAddrMgr : public TAddrMgr
                   std::vector<TExpiredInfo>& tempAddrLst,
                   std::vector<TExpiredInfo>& prefixLst);
 
-    void getAddrsCount(SPtr<List(TSrvCfgAddrClass)> classes, long *clntCnt,
-                       long *addrCnt, SPtr<TDUID> duid, int iface);
-
-    bool addrIsFree(SPtr<TIPv6Addr> addr);
+    bool addrIsFree(SPtr<TIPv6Addr> addr, bool peerOwned = false);
     bool taAddrIsFree(SPtr<TIPv6Addr> addr);
 
     SPtr<TIPv6Addr> getFirstAddr(SPtr<TDUID> clntDuid);
@@ -81,21 +90,86 @@ class TSrvAddrMgr : public TAddrMgr
     bool delCachedEntry(SPtr<TDUID> clntDuid, TAddrIA::TIAType type);
     void addCachedEntry(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> cachedEntry, TAddrIA::TIAType type);
 
+    // tentative offers (sent in ADVERTISE, kept in memory only)
+    bool addOffer(SPtr<TDUID> clntDuid, unsigned long iaid, TAddrIA::TIAType type,
+                  SPtr<TIPv6Addr> addr, int iface, unsigned long pool);
+    SPtr<TIPv6Addr> takeOffer(SPtr<TDUID> clntDuid, unsigned long iaid, TAddrIA::TIAType type);
+    bool addrIsOffered(SPtr<TIPv6Addr> addr, TAddrIA::TIAType type);
+    unsigned int getOfferCount() { return Offers.size(); }
+    unsigned long getOfferedCount(int iface, TAddrIA::TIAType type);
+    unsigned long getOfferedCount(int iface, TAddrIA::TIAType type, unsigned long pool);
+    unsigned long getOfferTimeout();
+    void expireOffers();
+    void setOfferLifetime(unsigned int lifetime) { OfferLifetime = lifetime; }
+    void setOfferLimit(unsigned long limit) { OfferLimit = limit; }
+
     void setCacheSize(int bytes);
+    unsigned int getCacheCount() { return Cache.size(); }
+    unsigned long getCacheUsage() { return CacheSize; }
+    unsigned long getCacheDumpTimeout();
+    void cacheDumpIfDue();
+    void cacheDump();
     void dump();
+    void scheduleDump();
+    void dumpIfDue();
+    unsigned long getDumpTimeout();
+    void setDumpInterval(unsigned int interval) { DumpInterval = interval; }
 
  protected:
     void print(std::ostream & out);
+    TSrvAddrMgr(const std::string& xmlfile, bool loadDB, const std::string& binfile, TLoadHook hook);
 
  private:
-    TSrvAddrMgr(const std::string& xmlfile, bool loadDB);
     static TSrvAddrMgr * Instance;
 
+    void load(const std::string& xmlFile);
     void cacheRead();
-    void cacheDump();
     void checkCacheSize();
-    List(TSrvCacheEntry) Cache; // list of cached addresses
-    int CacheMaxSize;           // maximum number of cached elements
+    void cacheInsert(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> addr, TAddrIA::TIAType type);
+    void countClntAddrs();
+
+    typedef std::list<TSrvCacheEntry> TCacheList;
+    typedef THashMap<TCacheList::iterator> TCacheIndex;
+
+    void cacheErase(TCacheList::iterator entry);
+    static std::string cacheKey(TAddrIA::TIAType type, SPtr<TDUID> duid);
+    static std::string cacheKey(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr);
+
+    typedef std::multimap<unsigned long, std::string> TOfferExpiry;
+    struct TSrvOffer
+    {
+        std::vector<SPtr<TIPv6Addr> > Addrs; // offered addresses or prefixes
+        std::vector<unsigned long> Pools;    // pool (class) ID of each address
+        int Iface;                           // link the offer was made on
+        TOfferExpiry::iterator Expire;       // position in OfferExpiry
+    };
+    typedef std::map<std::string, TSrvOffer> TOfferMap;
+
+    void delOffer(TOfferMap::iterator offer);
+    static std::string offerKey(TAddrIA::TIAType type, unsigned long iaid, SPtr<TDUID> duid);
+    static std::string countKey(int iface, TAddrIA::TIAType type);
+    static std::string countKey(int iface, TAddrIA::TIAType type, unsigned long pool);
+
+    TOfferMap Offers;          // type+IAID+DUID -> offer
+    TOfferExpiry OfferExpiry;  // expiration time -> offer key
+    std::map<std::string, std::string> OfferedAddrs; // type+address -> offer key
+    std::map<std::string, unsigned long> OfferedCount; // iface+type[+pool] -> offered addresses
+    unsigned int OfferLifetime;  // how long offer is held (in secs)
+    unsigned long OfferLimit;    // max. offered addresses per link and type
+
+    THashMap<unsigned long> ClntAddrCount; // DUID -> addresses in its IAs
+
+    TCacheList Cache;          // cached entries, least recently used first
+    TCacheIndex CacheByDuid;   // type+DUID -> entry
+    TCacheIndex CacheByAddr;   // type+address -> entry
+    unsigned long CacheSize;    // memory used by cached entries (in bytes)
+    unsigned long CacheMaxSize; // maximum memory used by cache (in bytes)
+    TStateFile CacheDumpFile;   // SRVCACHE_FILE
+    bool CacheDumpPending;      // cache changed since it was written to disk
+    unsigned long LastCacheDump;// timestamp of the last cache write
+    bool DumpPending;           // leases changed since database was written
+    unsigned long LastDump;     // timestamp of the last database write
+    unsigned int DumpInterval;  // min. time between database writes (in secs)
 };
 
 #endif
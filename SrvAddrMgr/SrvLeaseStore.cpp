@@ -0,0 +1,653 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <vector>
+#include "SrvLeaseStore.h"
+#include "SrvAddrMgr.h"
+#include "SrvCfgMgr.h"
+#include "AddrClient.h"
+#include "DHCPConst.h"
+#include "DHCPDefaults.h"
+#include "StatsMgr.h"
+#include "Logger.h"
+#ifndef WIN32
+#include <pthread.h>
+#endif
+
+using namespace std;
+
+#define LEASE_STORE_STRIPES  64
+#define LEASE_STORE_MAX_DUID 130
+#define LEASE_STORE_NO_WORKER 0xff // lease of previous run, not adopted by any worker yet
+
+#ifdef WIN32
+// there are no workers on Windows, the store is never created
+#define STORE_LOCK_T          int
+#define STORE_LOCK(l)
+#define STORE_UNLOCK(l)
+#else
+#define STORE_LOCK_T          pthread_mutex_t
+#define STORE_LOCK(l)         lockStripe(l)
+#define STORE_UNLOCK(l)       pthread_mutex_unlock(l)
+#endif
+
+typedef enum {
+    SLOT_EMPTY   = 0,
+    SLOT_USED    = 1,
+    SLOT_DELETED = 2 // lookups continue past deleted slots
+} ESlotState;
+
+struct TLeaseRecord {
+    uint8_t  State;
+    uint8_t  Type;       // TAddrIA::TIAType
+    uint8_t  PrefixLen;
+    uint8_t  Worker;     // owner
+    uint16_t DuidLen;
+    int32_t  Iface;
+    uint32_t IAID;
+    uint32_t T1;
+    uint32_t T2;
+    uint32_t Pref;
+    uint32_t Valid;
+    uint32_t Timestamp;  // last refresh
+    char     Addr[16];
+    char     ClntAddr[16];
+    char     Duid[LEASE_STORE_MAX_DUID];
+};
+
+struct TLeaseStoreStripe {
+    STORE_LOCK_T Lock;
+    uint32_t Used;
+    uint32_t Deleted;
+};
+
+struct TLeaseStoreHdr {
+    uint32_t StripeSlots;      // records in each stripe
+    int32_t  Workers;
+    volatile int32_t BindTurn; // worker that may bind its sockets now
+};
+
+#ifndef WIN32
+static bool initLock(pthread_mutex_t * m)
+{
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+#ifdef LINUX
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+#endif
+    int result = pthread_mutex_init(m, &attr);
+    pthread_mutexattr_destroy(&attr);
+    return !result;
+}
+
+static void lockStripe(pthread_mutex_t * m)
+{
+#ifdef LINUX
+    // worker died while holding the lock (the whole server is going down then)
+    if (pthread_mutex_lock(m) == EOWNERDEAD)
+        pthread_mutex_consistent(m);
+#else
+    pthread_mutex_lock(m);
+#endif
+}
+#endif
+
+TSrvLeaseStore * TSrvLeaseStore::Instance = 0;
+
+TSrvLeaseStore & TSrvLeaseStore::instance()
+{
+    if (!Instance)
+        Instance = new TSrvLeaseStore();
+    return *Instance;
+}
+
+TSrvLeaseStore::TSrvLeaseStore()
+    :Hdr(0), Stripes(0), Records(0), Worker(0), Importing(false),
+     Full(0), Imports(0), Adopted(0), Conflicts(0)
+{
+}
+
+/**
+ * allocates the store (must be called before workers are started)
+ *
+ * @param leases expected max. number of leases (table is twice as large)
+ * @param workers number of workers
+ *
+ * @return true if store was created
+ */
+bool TSrvLeaseStore::create(unsigned long leases, int workers)
+{
+#ifdef WIN32
+    Log(Error) << "Shared lease store is not supported on this system." << LogEnd;
+    return false;
+#else
+    unsigned long slots = (2*leases + LEASE_STORE_STRIPES - 1) / LEASE_STORE_STRIPES;
+    unsigned long len = sizeof(TLeaseStoreHdr) + LEASE_STORE_STRIPES*sizeof(TLeaseStoreStripe)
+        + LEASE_STORE_STRIPES*slots*sizeof(TLeaseRecord);
+
+    char * buf = (char*)shared_alloc(len);
+    if (!buf) {
+        Log(Error) << "Unable to allocate " << len/1024 << "kB for shared lease store." << LogEnd;
+        return false;
+    }
+    Hdr = (TLeaseStoreHdr*)buf;
+    Stripes = (TLeaseStoreStripe*)(buf + sizeof(TLeaseStoreHdr));
+    Records = (TLeaseRecord*)(buf + sizeof(TLeaseStoreHdr) + LEASE_STORE_STRIPES*sizeof(TLeaseStoreStripe));
+
+    Hdr->StripeSlots = slots;
+    Hdr->Workers = workers;
+    Hdr->BindTurn = 0;
+    for (int i=0; i<LEASE_STORE_STRIPES; i++) {
+        if (!initLock(&Stripes[i].Lock)) {
+            Log(Error) << "Unable to initialize shared lease store locks." << LogEnd;
+            Hdr = 0;
+            return false;
+        }
+    }
+
+    Log(Info) << "Shared lease store created: " << LEASE_STORE_STRIPES*slots << " slots, "
+              << len/1024 << "kB." << LogEnd;
+    return true;
+#endif
+}
+
+void TSrvLeaseStore::setWorker(int index)
+{
+    Worker = index;
+}
+
+/// FNV-1a of lease type and address
+unsigned int TSrvLeaseStore::hash(int type, const char * addr)
+{
+    uint32_t h = 2166136261U;
+    h = (h ^ (uint8_t)type) * 16777619U;
+    for (int i=0; i<16; i++)
+        h = (h ^ (uint8_t)addr[i]) * 16777619U;
+    return h;
+}
+
+/// is the lease still valid?
+bool TSrvLeaseStore::live(const TLeaseRecord * rec, unsigned long now)
+{
+    return rec->Valid == DHCPV6_INFINITY || now < (unsigned long)rec->Timestamp + rec->Valid;
+}
+
+/**
+ * finds lease in its stripe, caller must hold stripe's lock
+ *
+ * @param hash hash of the lease (see hash())
+ * @param type lease type
+ * @param addr address or prefix
+ * @param insert return free slot if lease is not there?
+ *
+ * @return record (or free slot), 0 if not found (or stripe is full)
+ */
+TLeaseRecord * TSrvLeaseStore::lookup(unsigned int hash, int type, const char * addr, bool insert)
+{
+    TLeaseRecord * base = Records + (hash % LEASE_STORE_STRIPES) * Hdr->StripeSlots;
+    unsigned int slot = (hash / LEASE_STORE_STRIPES) % Hdr->StripeSlots;
+    TLeaseRecord * freeSlot = 0;
+
+    for (unsigned int i=0; i<Hdr->StripeSlots; i++) {
+        TLeaseRecord * rec = base + slot;
+        if (rec->State == SLOT_EMPTY)
+            return insert ? (freeSlot ? freeSlot : rec) : 0;
+        if (rec->State == SLOT_DELETED) {
+            if (!freeSlot)
+                freeSlot = rec;
+        } else if (rec->Type == type && !memcmp(rec->Addr, addr, 16)) {
+            return rec;
+        }
+        if (++slot == Hdr->StripeSlots)
+            slot = 0;
+    }
+    return insert ? freeSlot : 0;
+}
+
+/// removes deleted slots from stripe (they make lookups slower), caller must hold the lock
+void TSrvLeaseStore::compact(unsigned int stripe)
+{
+    TLeaseRecord * base = Records + stripe * Hdr->StripeSlots;
+    vector<TLeaseRecord> used;
+    used.reserve(Stripes[stripe].Used);
+    for (unsigned int i=0; i<Hdr->StripeSlots; i++)
+        if (base[i].State == SLOT_USED)
+            used.push_back(base[i]);
+
+    memset(base, 0, Hdr->StripeSlots * sizeof(TLeaseRecord));
+    for (unsigned int i=0; i<used.size(); i++)
+        *lookup(hash(used[i].Type, used[i].Addr), used[i].Type, used[i].Addr, true) = used[i];
+    Stripes[stripe].Deleted = 0;
+}
+
+// --------------------------------------------------------------------
+// --- lease changes --------------------------------------------------
+// --------------------------------------------------------------------
+
+void TSrvLeaseStore::addLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                              int iface, unsigned long iaid, unsigned long t1, unsigned long t2,
+                              SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid,
+                              int prefixLen)
+{
+    if (!Hdr || Importing || type == TAddrIA::TYPE_TA)
+        return;
+    put(type, duid, clntAddr, iface, iaid, t1, t2, addr, pref, valid, prefixLen, now(), Worker);
+}
+
+/// stores lease owned by given worker (newer record of other worker is kept, but
+/// lease of previous run never wins over the same client's lease of a worker)
+void TSrvLeaseStore::put(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                         int iface, unsigned long iaid, unsigned long t1, unsigned long t2,
+                         SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid,
+                         int prefixLen, unsigned long timestamp, int owner)
+{
+    if (duid->getLen() > LEASE_STORE_MAX_DUID)
+        return;
+
+    unsigned int h = hash(type, addr->getAddr());
+    TLeaseStoreStripe * stripe = &Stripes[h % LEASE_STORE_STRIPES];
+    STORE_LOCK(&stripe->Lock);
+
+    TLeaseRecord * rec = lookup(h, type, addr->getAddr(), true);
+    if (!rec) {
+        STORE_UNLOCK(&stripe->Lock);
+        if (!Full++)
+            Log(Warning) << "Shared lease store is full, lease " << addr->getPlain()
+                         << " is known to this worker only." << LogEnd;
+        return;
+    }
+
+    if (rec->State == SLOT_USED && (rec->Worker != owner || owner == LEASE_STORE_NO_WORKER)
+        && live(rec, now())) {
+        bool sameClient = rec->DuidLen == duid->getLen() && !memcmp(rec->Duid, duid->get(), rec->DuidLen);
+        if (!sameClient) {
+            Conflicts++;
+            if (rec->Worker == LEASE_STORE_NO_WORKER)
+                Log(Warning) << "Lease " << addr->getPlain() << " is also assigned to other client "
+                             << "in database of previous run." << LogEnd;
+            else
+                Log(Warning) << "Lease " << addr->getPlain() << " is also assigned by worker "
+                             << (int)rec->Worker << " to other client." << LogEnd;
+        }
+        if (rec->Timestamp > timestamp &&
+            (!sameClient || rec->Worker != LEASE_STORE_NO_WORKER || owner == LEASE_STORE_NO_WORKER)) {
+            STORE_UNLOCK(&stripe->Lock);
+            return;
+        }
+    }
+
+    if (rec->State != SLOT_USED) {
+        if (rec->State == SLOT_DELETED)
+            stripe->Deleted--;
+        stripe->Used++;
+    }
+    rec->State     = SLOT_USED;
+    rec->Type      = type;
+    rec->PrefixLen = prefixLen;
+    rec->Worker    = owner;
+    rec->DuidLen   = duid->getLen();
+    rec->Iface     = iface;
+    rec->IAID      = iaid;
+    rec->T1        = t1;
+    rec->T2        = t2;
+    rec->Pref      = pref;
+    rec->Valid     = valid;
+    rec->Timestamp = timestamp;
+    memcpy(rec->Addr, addr->getAddr(), 16);
+    if (clntAddr)
+        memcpy(rec->ClntAddr, clntAddr->getAddr(), 16);
+    else
+        memset(rec->ClntAddr, 0, 16);
+    memcpy(rec->Duid, duid->get(), rec->DuidLen);
+
+    STORE_UNLOCK(&stripe->Lock);
+}
+
+void TSrvLeaseStore::delLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                              SPtr<TIPv6Addr> addr)
+{
+    if (!Hdr || type == TAddrIA::TYPE_TA)
+        return;
+
+    unsigned int h = hash(type, addr->getAddr());
+    unsigned int s = h % LEASE_STORE_STRIPES;
+    STORE_LOCK(&Stripes[s].Lock);
+
+    // lease may have been taken over by other worker in the meantime
+    TLeaseRecord * rec = lookup(h, type, addr->getAddr(), false);
+    if (rec && rec->Worker == Worker) {
+        rec->State = SLOT_DELETED;
+        Stripes[s].Used--;
+        Stripes[s].Deleted++;
+        if (Stripes[s].Deleted > Hdr->StripeSlots/4)
+            compact(s);
+    }
+
+    STORE_UNLOCK(&Stripes[s].Lock);
+}
+
+/// refreshes all leases of client's IA (called when IA was renewed)
+void TSrvLeaseStore::renewLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid)
+{
+    if (!Hdr || type == TAddrIA::TYPE_TA)
+        return;
+
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(duid);
+    SPtr<TAddrIA> ia;
+    if (client)
+        ia = (type == TAddrIA::TYPE_PD) ? client->getPD(iaid) : client->getIA(iaid);
+    if (!ia)
+        return;
+
+    // leases are added again, so leases taken over by other worker are claimed back
+    if (type == TAddrIA::TYPE_IA) {
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while (addr = ia->getAddr())
+            put(type, duid, ia->getSrvAddr(), ia->getIface(), iaid, ia->getT1(), ia->getT2(),
+                addr->get(), addr->getPref(), addr->getValid(), 128, now(), Worker);
+    } else {
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while (prefix = ia->getPrefix())
+            put(type, duid, ia->getSrvAddr(), ia->getIface(), iaid, ia->getT1(), ia->getT2(),
+                prefix->get(), prefix->getPref(), prefix->getValid(), prefix->getLength(), now(),
+                Worker);
+    }
+}
+
+/// records all leases from lease database (called after database was loaded)
+void TSrvLeaseStore::exportLeases()
+{
+    if (!Hdr)
+        return;
+    unsigned long cnt = putAll(SrvAddrMgr(), Worker);
+    Log(Info) << cnt << " lease(s) recorded in shared lease store." << LogEnd;
+}
+
+/**
+ * records leases from lease database of previous run (called before workers
+ * are started)
+ *
+ * @param xmlFile XML database
+ * @param binFile binary database (used if it is not older than XML one)
+ * @param owner worker that will use this database, -1 if its leases are to be
+ *              adopted by workers (see adoptLeases())
+ *
+ * @return number of leases recorded
+ */
+unsigned long TSrvLeaseStore::loadDb(const std::string& xmlFile, const std::string& binFile, int owner)
+{
+    if (!Hdr)
+        return 0;
+    SPtr<TSrvAddrMgr> db = TSrvAddrMgr::loadDb(xmlFile, binFile);
+    unsigned long cnt = putAll(*db, owner < 0 ? LEASE_STORE_NO_WORKER : owner);
+    Log(Info) << cnt << " lease(s) of previous run loaded from " << xmlFile << "." << LogEnd;
+    return cnt;
+}
+
+/// records all leases of the database as owned by given worker
+unsigned long TSrvLeaseStore::putAll(TSrvAddrMgr & db, int owner)
+{
+    unsigned long cnt = 0;
+    SPtr<TAddrClient> client;
+    SPtr<TAddrIA> ia;
+    db.firstClient();
+    while (client = db.getClient()) {
+        client->firstIA();
+        while (ia = client->getIA()) {
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr()) {
+                put(TAddrIA::TYPE_IA, client->getDUID(), ia->getSrvAddr(), ia->getIface(),
+                    ia->getIAID(), ia->getT1(), ia->getT2(), addr->get(), addr->getPref(),
+                    addr->getValid(), 128, addr->getTimestamp(), owner);
+                cnt++;
+            }
+        }
+        client->firstPD();
+        while (ia = client->getPD()) {
+            SPtr<TAddrPrefix> prefix;
+            ia->firstPrefix();
+            while (prefix = ia->getPrefix()) {
+                put(TAddrIA::TYPE_PD, client->getDUID(), ia->getSrvAddr(), ia->getIface(),
+                    ia->getIAID(), ia->getT1(), ia->getT2(), prefix->get(), prefix->getPref(),
+                    prefix->getValid(), prefix->getLength(), prefix->getTimestamp(), owner);
+                cnt++;
+            }
+        }
+    }
+    return cnt;
+}
+
+/**
+ * adopts leases of previous runs that belong to this worker's part of the
+ * pools (called after worker's own database was loaded)
+ */
+void TSrvLeaseStore::adoptLeases()
+{
+    if (!Hdr)
+        return;
+
+    for (unsigned int s=0; s<LEASE_STORE_STRIPES; s++) {
+        vector<TLeaseRecord> adopted;
+        STORE_LOCK(&Stripes[s].Lock);
+        TLeaseRecord * base = Records + s * Hdr->StripeSlots;
+        for (unsigned int i=0; i<Hdr->StripeSlots; i++) {
+            TLeaseRecord * rec = base + i;
+            if (rec->State != SLOT_USED || rec->Worker != LEASE_STORE_NO_WORKER || !live(rec, now()))
+                continue;
+            SPtr<TIPv6Addr> addr = new TIPv6Addr(rec->Addr);
+            if (!SrvCfgMgr().leaseInSlice((TAddrIA::TIAType)rec->Type, rec->Iface, addr))
+                continue;
+            rec->Worker = Worker;
+            adopted.push_back(*rec);
+        }
+        STORE_UNLOCK(&Stripes[s].Lock);
+
+        for (unsigned int i=0; i<adopted.size(); i++) {
+            TAddrIA::TIAType type = (TAddrIA::TIAType)adopted[i].Type;
+            SPtr<TDUID> duid = new TDUID(adopted[i].Duid, adopted[i].DuidLen);
+            SPtr<TIPv6Addr> addr = new TIPv6Addr(adopted[i].Addr);
+            if (!inDb(type, duid, adopted[i].IAID, addr) &&
+                addToDb(type, duid, adopted[i].IAID, addr, adopted[i]))
+                Adopted++;
+        }
+    }
+    if (Adopted)
+        Log(Notice) << Adopted << " lease(s) of previous run adopted by this worker." << LogEnd;
+}
+
+/// checks if lease is in this worker's database
+bool TSrvLeaseStore::inDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                          SPtr<TIPv6Addr> addr)
+{
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(duid);
+    SPtr<TAddrIA> ia;
+    if (client)
+        ia = (type == TAddrIA::TYPE_PD) ? client->getPD(iaid) : client->getIA(iaid);
+    if (!ia)
+        return false;
+    if (type == TAddrIA::TYPE_IA)
+        return ia->getAddr(addr);
+    SPtr<TAddrPrefix> prefix;
+    ia->firstPrefix();
+    while (prefix = ia->getPrefix())
+        if (*prefix->get() == *addr)
+            return true;
+    return false;
+}
+
+/**
+ * checks that lease is not used by other worker
+ *
+ * @param type lease type
+ * @param addr address or prefix
+ *
+ * @return false if other worker has valid lease for it
+ */
+bool TSrvLeaseStore::isFree(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr)
+{
+    if (!Hdr || type == TAddrIA::TYPE_TA)
+        return true;
+
+    unsigned int h = hash(type, addr->getAddr());
+    TLeaseStoreStripe * stripe = &Stripes[h % LEASE_STORE_STRIPES];
+    STORE_LOCK(&stripe->Lock);
+    TLeaseRecord * rec = lookup(h, type, addr->getAddr(), false);
+    bool free = !rec || rec->Worker == Worker || !live(rec, now());
+    STORE_UNLOCK(&stripe->Lock);
+    return free;
+}
+
+/**
+ * takes over a lease that other worker assigned to this client
+ *
+ * @param type lease type
+ * @param duid client's DUID
+ * @param iaid IAID of client's IA (or PD)
+ * @param addr address (or prefix) sent by client
+ *
+ * @return true if lease was added to this worker's database
+ */
+bool TSrvLeaseStore::importLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                                 SPtr<TIPv6Addr> addr)
+{
+    if (!Hdr || type == TAddrIA::TYPE_TA || !duid || duid->getLen() > LEASE_STORE_MAX_DUID)
+        return false;
+
+    // already here?
+    if (inDb(type, duid, iaid, addr))
+        return false;
+
+    unsigned int h = hash(type, addr->getAddr());
+    TLeaseStoreStripe * stripe = &Stripes[h % LEASE_STORE_STRIPES];
+    TLeaseRecord rec;
+    bool found = false;
+    STORE_LOCK(&stripe->Lock);
+    TLeaseRecord * r = lookup(h, type, addr->getAddr(), false);
+    if (r && r->Worker != Worker && r->IAID == iaid && live(r, now()) &&
+        r->DuidLen == duid->getLen() && !memcmp(r->Duid, duid->get(), r->DuidLen)) {
+        rec = *r;
+        r->Worker = Worker;
+        found = true;
+    }
+    STORE_UNLOCK(&stripe->Lock);
+    if (!found || !addToDb(type, duid, iaid, addr, rec))
+        return false;
+
+    Imports++;
+    Log(Info) << "Lease " << addr->getPlain() << " taken over from worker " << (int)rec.Worker
+              << "." << LogEnd;
+    return true;
+}
+
+/// adds lease recorded in the store to this worker's database
+bool TSrvLeaseStore::addToDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                             SPtr<TIPv6Addr> addr, const TLeaseRecord & rec)
+{
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(duid);
+    SPtr<TAddrIA> ia;
+    if (client)
+        ia = (type == TAddrIA::TYPE_PD) ? client->getPD(iaid) : client->getIA(iaid);
+
+    SPtr<TIPv6Addr> clntAddr = new TIPv6Addr(rec.ClntAddr);
+    bool newIA = !ia;
+    bool added;
+    Importing = true;
+    if (type == TAddrIA::TYPE_IA) {
+        added = SrvAddrMgr().addClntAddr(duid, clntAddr, rec.Iface, iaid, rec.T1, rec.T2, addr,
+                                         rec.Pref, rec.Valid, true);
+        if (added)
+            SrvCfgMgr().addClntAddr(rec.Iface, addr);
+    } else {
+        added = SrvAddrMgr().addPrefix(duid, clntAddr, rec.Iface, iaid, rec.T1, rec.T2, addr,
+                                       rec.Pref, rec.Valid, rec.PrefixLen, true);
+        if (added)
+            SrvCfgMgr().incrPrefixCount(rec.Iface, addr);
+    }
+    Importing = false;
+    if (!added)
+        return false;
+
+    // lifetimes are counted from the last refresh done by previous owner
+    client = SrvAddrMgr().getClient(duid);
+    ia = client ? ((type == TAddrIA::TYPE_PD) ? client->getPD(iaid) : client->getIA(iaid)) : 0;
+    if (!ia)
+        return false;
+    if (type == TAddrIA::TYPE_IA) {
+        SPtr<TAddrAddr> lease = ia->getAddr(addr);
+        if (lease)
+            lease->setTimestamp(rec.Timestamp);
+    } else {
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while (prefix = ia->getPrefix())
+            if (*prefix->get() == *addr)
+                prefix->setTimestamp(rec.Timestamp);
+    }
+    if (newIA)
+        ia->setTimestamp(rec.Timestamp);
+    return true;
+}
+
+// --------------------------------------------------------------------
+// --- socket binding order -------------------------------------------
+// --------------------------------------------------------------------
+
+/// waits until all workers with lower index have bound their sockets
+bool TSrvLeaseStore::waitTurn()
+{
+    if (!Hdr)
+        return true;
+    unsigned long start = now();
+    while (Hdr->BindTurn < Worker) {
+        if (now() - start > SERVER_DEFAULT_WORKER_BIND_TIMEOUT)
+            return false;
+        microsleep(10000);
+    }
+    return true;
+}
+
+void TSrvLeaseStore::endTurn()
+{
+    if (Hdr && Hdr->BindTurn <= Worker)
+        Hdr->BindTurn = Worker + 1;
+}
+
+void TSrvLeaseStore::printStats(std::ostream & out)
+{
+    if (!Hdr)
+        return;
+    unsigned long used = 0;
+    for (int i=0; i<LEASE_STORE_STRIPES; i++)
+        used += Stripes[i].Used;
+
+    TStatsMgr::printType(out, "dibbler_lease_store_entries", "gauge",
+                         "Leases of all workers in shared lease store.");
+    out << "dibbler_lease_store_entries " << used << endl;
+    TStatsMgr::printType(out, "dibbler_lease_store_slots", "gauge",
+                         "Size of shared lease store.");
+    out << "dibbler_lease_store_slots " << LEASE_STORE_STRIPES * Hdr->StripeSlots << endl;
+    TStatsMgr::printType(out, "dibbler_lease_store_full_total", "counter",
+                         "Leases not recorded in shared lease store (it was full).");
+    out << "dibbler_lease_store_full_total " << Full << endl;
+    TStatsMgr::printType(out, "dibbler_lease_store_imports_total", "counter",
+                         "Leases taken over from other workers.");
+    out << "dibbler_lease_store_imports_total " << Imports << endl;
+    TStatsMgr::printType(out, "dibbler_lease_store_adopted_total", "counter",
+                         "Leases of previous runs adopted at startup.");
+    out << "dibbler_lease_store_adopted_total " << Adopted << endl;
+    TStatsMgr::printType(out, "dibbler_lease_store_conflicts_total", "counter",
+                         "Leases assigned by other worker to different client.");
+    out << "dibbler_lease_store_conflicts_total " << Conflicts << endl;
+}
@@ -0,0 +1,114 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVLEASESTORE_H
+#define SRVLEASESTORE_H
+
+#include <iostream>
+#include <string>
+#include "Portable.h"
+#include "SmartPtr.h"
+#include "DUID.h"
+#include "IPv6Addr.h"
+#include "AddrIA.h"
+
+#define SrvLeaseStore() (TSrvLeaseStore::instance())
+
+struct TLeaseStoreHdr;
+struct TLeaseStoreStripe;
+struct TLeaseRecord;
+class TSrvAddrMgr;
+
+/**
+ * @brief leases of all server workers, kept in memory shared by worker processes
+ *
+ * When server runs in several worker processes (dibbler-server -w), each
+ * worker keeps its own lease database, but every lease (address or prefix,
+ * temporary addresses are not included) is also recorded here, together with
+ * the worker that owns it. Workers check this table before assigning anything,
+ * so lease of other worker is never assigned twice, and take over leases of
+ * clients that were served by other worker before (e.g. after the number of
+ * workers was changed or when the kernel does not steer packets by client).
+ *
+ * Table is an open addressing hash table (key: lease type and address), which
+ * is divided into stripes. Each stripe has its own process-shared mutex, so
+ * workers rarely wait for each other. Table is allocated before workers are
+ * forked and is never resized; leases that don't fit into their stripe are
+ * known to their worker only.
+ *
+ * Before workers are started, leases from databases of previous runs (database
+ * of single process server and databases of all workers) are loaded into the
+ * store. Leases of workers that are started again stay with them, the rest is
+ * adopted by workers that assign from their part of the pool.
+ */
+class TSrvLeaseStore
+{
+  public:
+    static TSrvLeaseStore & instance();
+
+    bool create(unsigned long leases, int workers);
+    void setWorker(int index);
+    bool isActive() { return Hdr != 0; }
+
+    // lease changes (called by SrvAddrMgr and IA options)
+    void addLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface,
+                  unsigned long iaid, unsigned long t1, unsigned long t2, SPtr<TIPv6Addr> addr,
+                  unsigned long pref, unsigned long valid, int prefixLen);
+    void delLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid, SPtr<TIPv6Addr> addr);
+    void renewLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid);
+    void exportLeases();
+    unsigned long loadDb(const std::string& xmlFile, const std::string& binFile, int owner);
+    void adoptLeases();
+
+    bool isFree(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr);
+    bool importLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid, SPtr<TIPv6Addr> addr);
+
+    // sockets are bound in worker order, so kernel numbers them the same way
+    bool waitTurn();
+    void endTurn();
+
+    void printStats(std::ostream & out);
+
+  protected:
+    TSrvLeaseStore();
+    virtual ~TSrvLeaseStore() {}
+
+    // this worker's lease database
+    virtual bool inDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                      SPtr<TIPv6Addr> addr);
+    virtual bool addToDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                         SPtr<TIPv6Addr> addr, const TLeaseRecord & rec);
+
+  private:
+    static TSrvLeaseStore * Instance;
+
+    void put(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface,
+             unsigned long iaid, unsigned long t1, unsigned long t2, SPtr<TIPv6Addr> addr,
+             unsigned long pref, unsigned long valid, int prefixLen, unsigned long timestamp,
+             int owner);
+    unsigned long putAll(TSrvAddrMgr & db, int owner);
+    TLeaseRecord * lookup(unsigned int hash, int type, const char * addr, bool insert);
+    void compact(unsigned int stripe);
+    static unsigned int hash(int type, const char * addr);
+    static bool live(const TLeaseRecord * rec, unsigned long now);
+
+    TLeaseStoreHdr * Hdr;
+    TLeaseStoreStripe * Stripes;
+    TLeaseRecord * Records;
+    int Worker;
+    bool Importing;            // taking over a lease, don't record it again
+
+    // statistics (this worker only)
+    unsigned long Full;        // leases that did not fit into the store
+    unsigned long Imports;     // leases taken over from other workers
+    unsigned long Adopted;     // leases of previous runs adopted at startup
+    unsigned long Conflicts;   // lease recorded by other worker for different client
+};
+
+#endif
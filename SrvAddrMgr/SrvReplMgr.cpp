@@ -0,0 +1,1089 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#include <string.h>
+#include "SrvReplMgr.h"
+#include "SrvAddrMgr.h"
+#include "SrvCfgMgr.h"
+#include "AddrClient.h"
+#include "DHCPConst.h"
+#include "DHCPDefaults.h"
+#include "StatsMgr.h"
+#include "Logger.h"
+
+using namespace std;
+
+TSrvReplMgr * TSrvReplMgr::Instance = 0;
+
+// record layout (all numbers in network byte order):
+// length (2 bytes, does not include itself), type (1 byte), payload
+//
+// HELLO:  version(1), duid-len(2), duid
+// ADD:    kind(1, 0=address, 1=prefix), prefix-len(1), iaid(4), t1(4), t2(4), pref(4),
+//         valid(4), age(4, seconds since last refresh), lease(16), client-addr(16),
+//         iface-name-len(1), iface-name, duid-len(2), duid
+// DEL:    kind(1), iaid(4), lease(16), duid-len(2), duid
+// RENEW:  kind(1), iaid(4), duid-len(2), duid
+// ACK:    number of records received on this connection so far(4)
+
+static void put8(string & out, unsigned int x) {
+    out.push_back((char)x);
+}
+
+static void put16(string & out, unsigned int x) {
+    char buf[2];
+    writeUint16(buf, (uint16_t)x);
+    out.append(buf, 2);
+}
+
+static void put32(string & out, unsigned long x) {
+    char buf[4];
+    writeUint32(buf, (uint32_t)x);
+    out.append(buf, 4);
+}
+
+static void putAddr(string & out, SPtr<TIPv6Addr> addr) {
+    static const char anyaddr[16] = {0};
+    out.append(addr ? addr->getAddr() : anyaddr, 16);
+}
+
+static void putDuid(string & out, SPtr<TDUID> duid) {
+    put16(out, duid->getLen());
+    out.append(duid->get(), duid->getLen());
+}
+
+/// reads fields of a received record, any read past its end makes it invalid
+class TReplReader {
+  public:
+    TReplReader(const char * buf, int len) : Buf(buf), Len(len), Ok(true) { }
+    bool ok() { return Ok; }
+    unsigned int get8() {
+        const char * p = take(1);
+        return p ? (unsigned char)*p : 0;
+    }
+    unsigned int get16() {
+        const char * p = take(2);
+        return p ? readUint16(p) : 0;
+    }
+    unsigned long get32() {
+        const char * p = take(4);
+        return p ? readUint32(p) : 0;
+    }
+    SPtr<TIPv6Addr> getAddr() {
+        const char * p = take(16);
+        return p ? new TIPv6Addr(p) : 0;
+    }
+    string getStr(int len) {
+        const char * p = take(len);
+        return p ? string(p, len) : string();
+    }
+    SPtr<TDUID> getDuid() {
+        int len = get16();
+        const char * p = take(len);
+        return (p && len) ? new TDUID(p, len) : 0;
+    }
+  private:
+    const char * take(int len) {
+        if (!Ok || len > Len) {
+            Ok = false;
+            return 0;
+        }
+        const char * p = Buf;
+        Buf += len;
+        Len -= len;
+        return p;
+    }
+    const char * Buf;
+    int Len;
+    bool Ok;
+};
+
+/// returns length of the first complete record in buf (0 if it is not complete yet)
+static unsigned int recordLen(const string & buf, unsigned int pos) {
+    if (buf.size() - pos < 2)
+        return 0;
+    unsigned int len = readUint16(buf.data() + pos) + 2;
+    return (buf.size() - pos >= len) ? len : 0;
+}
+
+TSrvReplMgr & TSrvReplMgr::instance()
+{
+    if (!Instance)
+        Instance = new TSrvReplMgr();
+    return *Instance;
+}
+
+TSrvReplMgr::TSrvReplMgr()
+    :Active(false), Applying(false), ListenPort(0), PeerPort(0), ListenFD(-1),
+     OutFD(-1), OutConnected(false), OutSent(0), OutSyncing(false), RecSent(0), RecAcked(0),
+     OutLastAck(0), OutLastSend(0), NextConnect(0),
+     InFD(-1), RecRcvd(0), InLastRecv(0), InSynced(false), Synced(false), StartTime(0), MyIndex(0),
+     Connects(0), RecordsSent(0), RecordsApplied(0), Conflicts(0)
+{
+}
+
+/**
+ * starts replication (if configured)
+ *
+ * @param listenPort port to accept peer's connection on (0 = don't accept)
+ * @param peer address of the peer to send our leases to (0 = don't send)
+ * @param peerPort peer's replication port
+ *
+ * @return false if replication was configured, but can't be started
+ */
+bool TSrvReplMgr::start(unsigned short listenPort, SPtr<TIPv6Addr> peer, unsigned short peerPort)
+{
+    if (!listenPort && !peer)
+        return true;
+
+    // anyone could feed us with leases otherwise
+    if (listenPort && !peer) {
+        Log(Crit) << "Replication: replication-port requires replication-peer, connections "
+                  << "are accepted from peer's address only." << LogEnd;
+        return false;
+    }
+
+    ListenPort = listenPort;
+    Peer       = peer;
+    PeerPort   = peerPort;
+
+    if (ListenPort) {
+        ListenFD = tcp_listen6(NULL, ListenPort);
+        if (ListenFD < 0) {
+            Log(Crit) << "Replication: Unable to listen on port " << ListenPort
+                      << " (error " << ListenFD << ")." << LogEnd;
+            ListenFD = -1;
+            return false;
+        }
+        Log(Notice) << "Replication: Accepting leases from peer on port " << ListenPort << "." << LogEnd;
+    }
+    if (Peer)
+        Log(Notice) << "Replication: Sending leases to " << Peer->getPlain() << ", port "
+                    << PeerPort << "." << LogEnd;
+
+    Active = true;
+    StartTime = now();
+    indexHolders();
+    connectPeer();
+    return true;
+}
+
+void TSrvReplMgr::stop()
+{
+    if (!Active)
+        return;
+    if (OutConnected)
+        flush();
+    closeOut(0);
+    closeIn(0);
+    if (ListenFD >= 0)
+        tcp_close(ListenFD);
+    ListenFD = -1;
+    Active = false;
+    Holders.clear();
+}
+
+/**
+ * is peer alive and synchronized? (only then load is split between servers)
+ *
+ * We must have the whole peer's database (snapshot), otherwise we could
+ * assign addresses that peer assigned before we connected.
+ */
+bool TSrvReplMgr::peerUp()
+{
+    if (!Active || !OutConnected || InFD < 0 || !InSynced || !PeerDuid)
+        return false;
+    unsigned long t = now();
+    return (t - InLastRecv < SERVER_DEFAULT_REPL_TIMEOUT) && (t - OutLastAck < SERVER_DEFAULT_REPL_TIMEOUT);
+}
+
+/**
+ * may shared pools be used at all?
+ *
+ * Right after start, peer may have assigned addresses we don't know about
+ * yet, so nothing is assigned until peer's leases are received. If peer
+ * does not send them within SERVER_DEFAULT_REPL_GRACE seconds, it is
+ * assumed to be down.
+ */
+bool TSrvReplMgr::ready()
+{
+    if (!Active || Synced)
+        return true;
+    return now() - StartTime >= SERVER_DEFAULT_REPL_GRACE;
+}
+
+// --------------------------------------------------------------------
+// --- lease changes --------------------------------------------------
+// --------------------------------------------------------------------
+
+void TSrvReplMgr::addLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                           int iface, unsigned long iaid, unsigned long t1, unsigned long t2,
+                           SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid,
+                           int prefixLen)
+{
+    if (!Active || type == TAddrIA::TYPE_TA)
+        return;
+    THolder & holder = Holders[holderKey(type, addr)];
+    holder.Duid = duid;
+    holder.IAID = iaid;
+
+    // changes made while peer is disconnected are sent in the snapshot after reconnect
+    if (!OutConnected || Applying)
+        return;
+    queueRecord(encodeAdd(type, duid, clntAddr, iface, iaid, t1, t2, addr, pref, valid, prefixLen, 0));
+}
+
+void TSrvReplMgr::delLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                           SPtr<TIPv6Addr> addr)
+{
+    if (!Active || type == TAddrIA::TYPE_TA)
+        return;
+    string key = holderKey(type, addr);
+    THolder * holder = Holders.find(key);
+    if (holder && holder->IAID == iaid && *holder->Duid == *duid)
+        Holders.erase(key);
+
+    if (!OutConnected || Applying)
+        return;
+    string rec;
+    put8(rec, type == TAddrIA::TYPE_PD);
+    put32(rec, iaid);
+    putAddr(rec, addr);
+    putDuid(rec, duid);
+    queueRecord(encodeHeader(REPL_DEL, rec.size()) + rec);
+}
+
+void TSrvReplMgr::renewLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid)
+{
+    if (!OutConnected || Applying || type == TAddrIA::TYPE_TA)
+        return;
+    string rec;
+    put8(rec, type == TAddrIA::TYPE_PD);
+    put32(rec, iaid);
+    putDuid(rec, duid);
+    queueRecord(encodeHeader(REPL_RENEW, rec.size()) + rec);
+}
+
+string TSrvReplMgr::encodeHeader(EReplRecord type, unsigned int len)
+{
+    string hdr;
+    put16(hdr, len + 1);
+    put8(hdr, type);
+    return hdr;
+}
+
+string TSrvReplMgr::encodeAdd(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                              int iface, unsigned long iaid, unsigned long t1, unsigned long t2,
+                              SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid,
+                              int prefixLen, unsigned long age)
+{
+    // interface indexes differ between hosts, names (hopefully) don't
+    string ifaceName;
+    SPtr<TSrvCfgIface> cfgIface = SrvCfgMgr().getIfaceByID(iface);
+    if (cfgIface)
+        ifaceName = cfgIface->getName().substr(0, 255);
+
+    string rec;
+    put8(rec, type == TAddrIA::TYPE_PD);
+    put8(rec, prefixLen);
+    put32(rec, iaid);
+    put32(rec, t1);
+    put32(rec, t2);
+    put32(rec, pref);
+    put32(rec, valid);
+    put32(rec, age);
+    putAddr(rec, addr);
+    putAddr(rec, clntAddr);
+    put8(rec, ifaceName.size());
+    rec += ifaceName;
+    putDuid(rec, duid);
+    return encodeHeader(REPL_ADD, rec.size()) + rec;
+}
+
+// --------------------------------------------------------------------
+// --- load sharing ---------------------------------------------------
+// --------------------------------------------------------------------
+
+/// FNV-1a, upper bits folded in, so the lowest one can be used to split load
+unsigned int TSrvReplMgr::hash(const char * buf, int len)
+{
+    unsigned int h = 2166136261U;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)buf[i];
+        h *= 16777619U;
+    }
+    return h ^ (h >> 16);
+}
+
+bool TSrvReplMgr::ownsHash(unsigned int h)
+{
+    return (int)(h & 1) == MyIndex;
+}
+
+/// server with lower DUID gets index 0, so both servers agree who owns what
+void TSrvReplMgr::updateIndex()
+{
+    SPtr<TDUID> mine = SrvCfgMgr().getDUID();
+    MyIndex = 0;
+    if (!mine || !PeerDuid)
+        return;
+
+    int cmp = mine->getLen() - PeerDuid->getLen();
+    if (!cmp)
+        cmp = memcmp(mine->get(), PeerDuid->get(), mine->getLen());
+    if (!cmp)
+        Log(Warning) << "Replication: Peer uses the same server DUID (" << mine->getPlain()
+                     << "), load will not be split properly." << LogEnd;
+    MyIndex = (cmp > 0) ? 1 : 0;
+}
+
+/**
+ * should this server answer a message from client? Messages sent to
+ * a specific server (with SERVERID) are always answered by that server.
+ *
+ * @param msgType message type
+ * @param duid client's DUID (may be 0)
+ *
+ * @return true if message should be handled by this server
+ */
+bool TSrvReplMgr::ownsClient(int msgType, SPtr<TDUID> duid)
+{
+    switch (msgType) {
+    case SOLICIT_MSG:
+    case REBIND_MSG:
+    case CONFIRM_MSG:
+    case INFORMATION_REQUEST_MSG:
+        break;
+    default:
+        return true;
+    }
+    if (!ready())
+        return false;
+    if (!duid || !peerUp())
+        return true;
+    return ownsHash(hash(duid->get(), duid->getLen()));
+}
+
+/**
+ * may this server assign the address (or prefix) from a pool shared with peer?
+ *
+ * Address space is split by address hash, so both servers never pick
+ * the same address for different clients at the same time. Callers look
+ * for addresses of our own first and ask for peer-owned ones only when
+ * our part of the pool is exhausted (see SERVER_DEFAULT_REPL_OWNER_TRIES).
+ *
+ * @param addr address (or prefix) to be assigned
+ * @param peerOwned true if address owned by peer may be used, too
+ */
+bool TSrvReplMgr::mayAssign(SPtr<TIPv6Addr> addr, bool peerOwned)
+{
+    if (!ready())
+        return false;
+    if (!peerUp() || ownsHash(hash(addr->getAddr(), 16)))
+        return true;
+    if (peerOwned)
+        Log(Debug) << "Replication: No free address of our own found, using peer's "
+                   << addr->getPlain() << "." << LogEnd;
+    return peerOwned;
+}
+
+// --------------------------------------------------------------------
+// --- outgoing stream ------------------------------------------------
+// --------------------------------------------------------------------
+
+void TSrvReplMgr::connectPeer()
+{
+    if (!Peer || OutFD >= 0 || now() < NextConnect)
+        return;
+    NextConnect = now() + SERVER_DEFAULT_REPL_RETRY;
+
+    OutFD = tcp_connect6(Peer->getPlain(), PeerPort);
+    if (OutFD < 0) {
+        Log(Debug) << "Replication: Unable to connect to " << Peer->getPlain() << ", port "
+                   << PeerPort << " (error " << OutFD << ")." << LogEnd;
+        OutFD = -1;
+        return;
+    }
+    OutConnected = false;
+    OutLastAck = now(); // connect timeout
+}
+
+/// queues HELLO and all leases we know about
+void TSrvReplMgr::sendSnapshot()
+{
+    OutSyncing = true;
+    OutBuf.clear();
+    OutSent = 0;
+    RecSent = 0;
+    RecAcked = 0;
+    AckBuf.clear();
+
+    string rec;
+    put8(rec, REPL_PROTO_VERSION);
+    putDuid(rec, SrvCfgMgr().getDUID());
+    queueRecord(encodeHeader(REPL_HELLO, rec.size()) + rec);
+
+    unsigned long t = now();
+    SPtr<TAddrClient> client;
+    SPtr<TAddrIA> ia;
+    SrvAddrMgr().firstClient();
+    while (client = SrvAddrMgr().getClient()) {
+        client->firstIA();
+        while (ia = client->getIA()) {
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr()) {
+                unsigned long ts = addr->getTimestamp();
+                queueRecord(encodeAdd(TAddrIA::TYPE_IA, client->getDUID(), ia->getSrvAddr(),
+                                      ia->getIface(), ia->getIAID(), ia->getT1(), ia->getT2(),
+                                      addr->get(), addr->getPref(), addr->getValid(), 128,
+                                      t > ts ? t - ts : 0));
+            }
+        }
+        client->firstPD();
+        while (ia = client->getPD()) {
+            SPtr<TAddrPrefix> prefix;
+            ia->firstPrefix();
+            while (prefix = ia->getPrefix()) {
+                unsigned long ts = prefix->getTimestamp();
+                queueRecord(encodeAdd(TAddrIA::TYPE_PD, client->getDUID(), ia->getSrvAddr(),
+                                      ia->getIface(), ia->getIAID(), ia->getT1(), ia->getT2(),
+                                      prefix->get(), prefix->getPref(), prefix->getValid(),
+                                      prefix->getLength(), t > ts ? t - ts : 0));
+            }
+        }
+    }
+
+    queueRecord(encodeHeader(REPL_SNAPSHOT_END, 0));
+    Log(Notice) << "Replication: Connected to peer, sending " << RecSent - 2
+                << " lease(s)." << LogEnd;
+}
+
+void TSrvReplMgr::queueRecord(const string & rec)
+{
+    // snapshot may be large, limit applies to records queued afterwards
+    if (!OutSyncing && OutBuf.size() - OutSent > SERVER_DEFAULT_REPL_MAX_BACKLOG) {
+        closeOut("peer does not keep up, too many records waiting");
+        return;
+    }
+    OutBuf += rec;
+    RecSent++;
+    RecordsSent++;
+    OutLastSend = now();
+}
+
+/// writes as much of queued records as socket accepts
+void TSrvReplMgr::flush()
+{
+    while (OutSent < OutBuf.size()) {
+        unsigned int len = OutBuf.size() - OutSent;
+        int result = tcp_send(OutFD, OutBuf.data() + OutSent, len > 65536 ? 65536 : len);
+        if (result < 0) {
+            closeOut("send failed");
+            return;
+        }
+        if (!result)
+            break;
+        OutSent += result;
+    }
+
+    if (OutSent == OutBuf.size()) {
+        OutBuf.clear();
+        OutSent = 0;
+        OutSyncing = false;
+    } else if (OutSent > 65536) {
+        OutBuf.erase(0, OutSent);
+        OutSent = 0;
+    }
+}
+
+void TSrvReplMgr::readAcks()
+{
+    char buf[1024];
+    int result = tcp_recv(OutFD, buf, sizeof(buf));
+    if (result < 0) {
+        closeOut("connection closed by peer");
+        return;
+    }
+    AckBuf.append(buf, result);
+
+    unsigned int pos = 0, len;
+    while ( (len = recordLen(AckBuf, pos)) ) {
+        TReplReader r(AckBuf.data() + pos + 2, len - 2);
+        if (r.get8() == REPL_ACK) {
+            unsigned long acked = r.get32();
+            if (r.ok()) {
+                RecAcked = acked;
+                OutLastAck = now();
+            }
+        }
+        pos += len;
+    }
+    AckBuf.erase(0, pos);
+}
+
+void TSrvReplMgr::closeOut(const char * reason)
+{
+    if (OutFD >= 0) {
+        if (OutConnected && reason)
+            Log(Notice) << "Replication: Connection to peer closed: " << reason << "." << LogEnd;
+        tcp_close(OutFD);
+    }
+    OutFD = -1;
+    OutConnected = false;
+    OutBuf.clear();
+    OutSent = 0;
+    OutSyncing = false;
+    AckBuf.clear();
+    NextConnect = now() + SERVER_DEFAULT_REPL_RETRY;
+}
+
+// --------------------------------------------------------------------
+// --- incoming stream ------------------------------------------------
+// --------------------------------------------------------------------
+
+void TSrvReplMgr::acceptPeer()
+{
+    char peerAddr[48];
+    int fd = tcp_accept(ListenFD, peerAddr);
+    if (fd < 0)
+        return;
+
+    // anyone could feed us with leases otherwise
+    if (strcmp(peerAddr, Peer->getPlain())) {
+        Log(Warning) << "Replication: Connection from " << peerAddr
+                     << " rejected, only " << Peer->getPlain() << " is allowed." << LogEnd;
+        tcp_close(fd);
+        return;
+    }
+
+    if (InFD >= 0)
+        closeIn("peer reconnected");
+    InFD = fd;
+    InBuf.clear();
+    InAckBuf.clear();
+    RecRcvd = 0;
+    InSynced = false;
+    InLastRecv = now();
+}
+
+void TSrvReplMgr::readRecords()
+{
+    char buf[16384];
+    int result = tcp_recv(InFD, buf, sizeof(buf));
+    if (result < 0) {
+        closeIn("connection closed by peer");
+        return;
+    }
+    if (!result)
+        return;
+    InBuf.append(buf, result);
+    InLastRecv = now();
+
+    unsigned int pos = 0, len;
+    while ( (len = recordLen(InBuf, pos)) ) {
+        if (len < 3 || !applyRecord(InBuf.data() + pos + 2, len - 2)) {
+            closeIn("malformed record received");
+            return;
+        }
+        RecRcvd++;
+        pos += len;
+    }
+    if (!pos)
+        return;
+    InBuf.erase(0, pos);
+
+    // one acknowledgement for the whole batch
+    put16(InAckBuf, 5);
+    put8(InAckBuf, REPL_ACK);
+    put32(InAckBuf, RecRcvd);
+    flushAcks();
+}
+
+void TSrvReplMgr::flushAcks()
+{
+    int result = tcp_send(InFD, InAckBuf.data(), InAckBuf.size());
+    if (result < 0) {
+        closeIn("send failed");
+        return;
+    }
+    InAckBuf.erase(0, result);
+}
+
+/**
+ * decodes and applies one record received from peer
+ *
+ * @return false if record is malformed (connection should be closed)
+ */
+bool TSrvReplMgr::applyRecord(const char * buf, int len)
+{
+    TReplReader r(buf, len);
+    switch (r.get8()) {
+    case REPL_HELLO: {
+        unsigned int version = r.get8();
+        SPtr<TDUID> duid = r.getDuid();
+        if (!r.ok() || !duid)
+            return false;
+        if (version != REPL_PROTO_VERSION) {
+            Log(Error) << "Replication: Peer uses unsupported protocol version " << version << "." << LogEnd;
+            return false;
+        }
+        PeerDuid = duid;
+        updateIndex();
+        Log(Notice) << "Replication: Peer (DUID=" << PeerDuid->getPlain() << ") connected, receiving its leases."
+                    << LogEnd;
+        return true;
+    }
+    case REPL_ADD: {
+        TAddrIA::TIAType type = r.get8() ? TAddrIA::TYPE_PD : TAddrIA::TYPE_IA;
+        int prefixLen       = r.get8();
+        unsigned long iaid  = r.get32();
+        unsigned long t1    = r.get32();
+        unsigned long t2    = r.get32();
+        unsigned long pref  = r.get32();
+        unsigned long valid = r.get32();
+        unsigned long age   = r.get32();
+        SPtr<TIPv6Addr> addr     = r.getAddr();
+        SPtr<TIPv6Addr> clntAddr = r.getAddr();
+        string ifaceName = r.getStr(r.get8());
+        SPtr<TDUID> duid = r.getDuid();
+        if (!r.ok() || !duid)
+            return false;
+        applyAdd(type, duid, clntAddr, ifaceName, iaid, t1, t2, addr, pref, valid, prefixLen, age);
+        return true;
+    }
+    case REPL_DEL: {
+        TAddrIA::TIAType type = r.get8() ? TAddrIA::TYPE_PD : TAddrIA::TYPE_IA;
+        unsigned long iaid = r.get32();
+        SPtr<TIPv6Addr> addr = r.getAddr();
+        SPtr<TDUID> duid = r.getDuid();
+        if (!r.ok() || !duid)
+            return false;
+        applyDel(type, duid, iaid, addr);
+        return true;
+    }
+    case REPL_RENEW: {
+        TAddrIA::TIAType type = r.get8() ? TAddrIA::TYPE_PD : TAddrIA::TYPE_IA;
+        unsigned long iaid = r.get32();
+        SPtr<TDUID> duid = r.getDuid();
+        if (!r.ok() || !duid)
+            return false;
+        applyRenew(type, duid, iaid);
+        return true;
+    }
+    case REPL_SNAPSHOT_END:
+        InSynced = true;
+        Synced = true;
+        Log(Notice) << "Replication: Peer's leases received (" << RecRcvd - 1 << " record(s))." << LogEnd;
+        return true;
+    case REPL_HEARTBEAT:
+        return true;
+    default:
+        // sent by newer peer, ignore it
+        return r.ok();
+    }
+}
+
+/// returns client's IA (or PD) with specified IAID
+static SPtr<TAddrIA> findIA(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid)
+{
+    SPtr<TAddrClient> client = SrvAddrMgr().getClient(duid);
+    if (!client)
+        return 0;
+    return (type == TAddrIA::TYPE_PD) ? client->getPD(iaid) : client->getIA(iaid);
+}
+
+/// returns address (or prefix) from IA
+static SPtr<TAddrAddr> findLease(TAddrIA::TIAType type, SPtr<TAddrIA> ia, SPtr<TIPv6Addr> addr)
+{
+    if (type == TAddrIA::TYPE_IA)
+        return ia->getAddr(addr);
+
+    SPtr<TAddrPrefix> prefix;
+    ia->firstPrefix();
+    while (prefix = ia->getPrefix()) {
+        if (*prefix->get() == *addr)
+            return (Ptr*)prefix;
+    }
+    return 0;
+}
+
+/// returns key of an address (or prefix) in Holders
+string TSrvReplMgr::holderKey(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr)
+{
+    string key(addr->getAddr(), 16);
+    key.push_back(type == TAddrIA::TYPE_PD ? 'P' : 'A');
+    return key;
+}
+
+/**
+ * @brief indexes leases loaded from the database
+ *
+ * Later the index is updated in addLease() and delLease(), so conflicts
+ * with peer's leases are found without walking the whole database.
+ */
+void TSrvReplMgr::indexHolders()
+{
+    Holders.clear();
+
+    SPtr<TAddrClient> client;
+    SPtr<TAddrIA> ia;
+    SrvAddrMgr().firstClient();
+    while (client = SrvAddrMgr().getClient()) {
+        client->firstIA();
+        while (ia = client->getIA()) {
+            SPtr<TAddrAddr> addr;
+            ia->firstAddr();
+            while (addr = ia->getAddr()) {
+                THolder & holder = Holders[holderKey(TAddrIA::TYPE_IA, addr->get())];
+                holder.Duid = client->getDUID();
+                holder.IAID = ia->getIAID();
+            }
+        }
+        client->firstPD();
+        while (ia = client->getPD()) {
+            SPtr<TAddrPrefix> prefix;
+            ia->firstPrefix();
+            while (prefix = ia->getPrefix()) {
+                THolder & holder = Holders[holderKey(TAddrIA::TYPE_PD, prefix->get())];
+                holder.Duid = client->getDUID();
+                holder.IAID = ia->getIAID();
+            }
+        }
+    }
+}
+
+/// returns IA (or PD) of any client, that has specified address (or prefix)
+SPtr<TAddrIA> TSrvReplMgr::findHolder(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr,
+                                      SPtr<TDUID> & duid)
+{
+    THolder * holder = Holders.find(holderKey(type, addr));
+    if (!holder)
+        return 0;
+    SPtr<TAddrIA> ia = findIA(type, holder->Duid, holder->IAID);
+    if (!ia || !findLease(type, ia, addr))
+        return 0;
+    duid = holder->Duid;
+    return ia;
+}
+
+void TSrvReplMgr::applyAdd(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                           const string & ifaceName, unsigned long iaid, unsigned long t1,
+                           unsigned long t2, SPtr<TIPv6Addr> addr, unsigned long pref,
+                           unsigned long valid, int prefixLen, unsigned long age)
+{
+    unsigned long t = now();
+    unsigned long ts = t > age ? t - age : 0;
+
+    // lease we already know (e.g. sent again in snapshot), keep the newer one
+    SPtr<TAddrIA> ia = findIA(type, duid, iaid);
+    SPtr<TAddrAddr> lease = ia ? findLease(type, ia, addr) : 0;
+    if (lease) {
+        if ((unsigned long)lease->getTimestamp() < ts) {
+            lease->setPref(pref);
+            lease->setValid(valid);
+            lease->setTimestamp(ts);
+        }
+        if (ia->getTimestamp() < ts)
+            ia->setTimestamp(ts);
+        return;
+    }
+
+    int iface = -1;
+    SPtr<TSrvCfgIface> cfgIface;
+    SrvCfgMgr().firstIface();
+    while (cfgIface = SrvCfgMgr().getIface()) {
+        if (cfgIface->getName() == ifaceName) {
+            iface = cfgIface->getID();
+            break;
+        }
+    }
+    if (iface < 0) {
+        Log(Warning) << "Replication: Lease " << addr->getPlain() << " received from peer is on interface "
+                     << ifaceName << ", which is not configured here. Ignored." << LogEnd;
+        Conflicts++;
+        return;
+    }
+
+    // both servers assigned it (at the same time or while disconnected), keep the older lease
+    SPtr<TDUID> holder;
+    SPtr<TAddrIA> holderIA = findHolder(type, addr, holder);
+    if (holderIA) {
+        Conflicts++;
+        if (!peerWins(addr, findLease(type, holderIA, addr)->getTimestamp(), ts)) {
+            Log(Warning) << "Replication: Lease " << addr->getPlain() << " received from peer is used "
+                         << "by other client (DUID=" << holder->getPlain() << ") here for a longer "
+                         << "time. Ignored." << LogEnd;
+            return;
+        }
+        Log(Warning) << "Replication: Lease " << addr->getPlain() << " of client (DUID="
+                     << holder->getPlain() << ") was assigned by peer to other client earlier. "
+                     << "Deleted, client will get a new one when it tries to renew it." << LogEnd;
+        dropLease(type, holder, holderIA, addr);
+    }
+
+    bool newIA = !ia;
+    bool added;
+    Applying = true;
+    if (type == TAddrIA::TYPE_IA) {
+        added = SrvAddrMgr().addClntAddr(duid, clntAddr, iface, iaid, t1, t2, addr, pref, valid, true);
+        if (added)
+            SrvCfgMgr().addClntAddr(iface, addr);
+    } else {
+        added = SrvAddrMgr().addPrefix(duid, clntAddr, iface, iaid, t1, t2, addr, pref, valid,
+                                       prefixLen, true);
+        if (added)
+            SrvCfgMgr().incrPrefixCount(iface, addr);
+    }
+    Applying = false;
+    if (!added)
+        return;
+
+    // lifetimes are counted from the last refresh done by peer
+    ia = findIA(type, duid, iaid);
+    lease = ia ? findLease(type, ia, addr) : 0;
+    if (lease)
+        lease->setTimestamp(ts);
+    if (ia && (newIA || ia->getTimestamp() < ts))
+        ia->setTimestamp(ts);
+    RecordsApplied++;
+}
+
+/**
+ * decides which of two leases of the same address (or prefix), assigned to
+ * different clients here and on peer, is kept
+ *
+ * Older lease wins. Leases that differ by less than
+ * SERVER_DEFAULT_REPL_CLOCK_SKEW seconds were assigned at the same time,
+ * then the lease assigned by address owner wins. Both servers decide the
+ * same way, so the address ends up with one client on both of them.
+ *
+ * @param addr address (or prefix)
+ * @param mine timestamp of our lease
+ * @param peers timestamp of peer's lease
+ *
+ * @return true if peer's lease should be kept (and ours deleted)
+ */
+bool TSrvReplMgr::peerWins(SPtr<TIPv6Addr> addr, unsigned long mine, unsigned long peers)
+{
+    if (mine + SERVER_DEFAULT_REPL_CLOCK_SKEW < peers)
+        return false;
+    if (peers + SERVER_DEFAULT_REPL_CLOCK_SKEW < mine)
+        return true;
+    return !ownsHash(hash(addr->getAddr(), 16));
+}
+
+/// deletes our lease, that lost a conflict with peer's one (client's RENEW will be refused)
+void TSrvReplMgr::dropLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TAddrIA> ia,
+                            SPtr<TIPv6Addr> addr)
+{
+    // peer did not apply it, there is nothing to delete there
+    Applying = true;
+    if (type == TAddrIA::TYPE_IA) {
+        if (SrvAddrMgr().delClntAddr(duid, ia->getIAID(), addr, true))
+            SrvCfgMgr().delClntAddr(ia->getIface(), addr);
+    } else {
+        if (SrvAddrMgr().delPrefix(duid, ia->getIAID(), addr, true))
+            SrvCfgMgr().decrPrefixCount(ia->getIface(), addr);
+    }
+    Applying = false;
+
+    // don't offer it to this client again
+    SrvAddrMgr().delCachedEntry(addr, type);
+}
+
+void TSrvReplMgr::applyDel(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                           SPtr<TIPv6Addr> addr)
+{
+    // lease may have expired here already
+    SPtr<TAddrIA> ia = findIA(type, duid, iaid);
+    if (!ia || !findLease(type, ia, addr))
+        return;
+    int iface = ia->getIface();
+
+    Applying = true;
+    if (type == TAddrIA::TYPE_IA) {
+        if (SrvAddrMgr().delClntAddr(duid, iaid, addr, true))
+            SrvCfgMgr().delClntAddr(iface, addr);
+    } else {
+        if (SrvAddrMgr().delPrefix(duid, iaid, addr, true))
+            SrvCfgMgr().decrPrefixCount(iface, addr);
+    }
+    Applying = false;
+    RecordsApplied++;
+}
+
+void TSrvReplMgr::applyRenew(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid)
+{
+    SPtr<TAddrIA> ia = findIA(type, duid, iaid);
+    if (!ia)
+        return;
+
+    ia->setTimestamp();
+    if (type == TAddrIA::TYPE_IA) {
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while (addr = ia->getAddr())
+            addr->setTimestamp();
+    } else {
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while (prefix = ia->getPrefix())
+            prefix->setTimestamp();
+    }
+    RecordsApplied++;
+}
+
+void TSrvReplMgr::closeIn(const char * reason)
+{
+    if (InFD >= 0) {
+        if (reason)
+            Log(Notice) << "Replication: Connection from peer closed: " << reason << "." << LogEnd;
+        tcp_close(InFD);
+    }
+    InFD = -1;
+    InBuf.clear();
+    InAckBuf.clear();
+    InSynced = false;
+}
+
+// --------------------------------------------------------------------
+// --- event loop -----------------------------------------------------
+// --------------------------------------------------------------------
+
+/**
+ * adds replication sockets to sets watched by select()
+ *
+ * @return highest descriptor added (or -1)
+ */
+int TSrvReplMgr::addFDs(fd_set * rd, fd_set * wr)
+{
+    if (!Active)
+        return -1;
+
+    int maxFD = -1;
+    if (ListenFD >= 0) {
+        FD_SET(ListenFD, rd);
+        maxFD = ListenFD;
+    }
+    if (OutFD >= 0) {
+        if (OutConnected)
+            FD_SET(OutFD, rd);
+        if (!OutConnected || OutSent < OutBuf.size())
+            FD_SET(OutFD, wr);
+        if (OutFD > maxFD)
+            maxFD = OutFD;
+    }
+    if (InFD >= 0) {
+        FD_SET(InFD, rd);
+        if (!InAckBuf.empty())
+            FD_SET(InFD, wr);
+        if (InFD > maxFD)
+            maxFD = InFD;
+    }
+    return maxFD;
+}
+
+/**
+ * handles replication sockets that are ready
+ *
+ * @return number of ready descriptors handled
+ */
+int TSrvReplMgr::processFDs(fd_set * rd, fd_set * wr)
+{
+    if (!Active)
+        return 0;
+
+    // descriptors may change while processing, so check them first
+    bool listenRd = ListenFD >= 0 && FD_ISSET(ListenFD, rd);
+    bool outRd    = OutFD >= 0 && FD_ISSET(OutFD, rd);
+    bool outWr    = OutFD >= 0 && FD_ISSET(OutFD, wr);
+    bool inRd     = InFD >= 0 && FD_ISSET(InFD, rd);
+    bool inWr     = InFD >= 0 && FD_ISSET(InFD, wr);
+
+    if (outWr && !OutConnected) {
+        if (tcp_connected(OutFD) < 0) {
+            Log(Debug) << "Replication: Unable to connect to " << Peer->getPlain() << ", port "
+                       << PeerPort << "." << LogEnd;
+            closeOut(0);
+        } else {
+            OutConnected = true;
+            OutLastAck = now();
+            Connects++;
+            sendSnapshot();
+        }
+    }
+    if (outRd && OutFD >= 0)
+        readAcks();
+    if (OutConnected)
+        flush();
+
+    if (inRd && InFD >= 0)
+        readRecords();
+    if (inWr && InFD >= 0 && !InAckBuf.empty())
+        flushAcks();
+
+    if (listenRd)
+        acceptPeer();
+
+    return listenRd + outRd + outWr + inRd + inWr;
+}
+
+/// returns number of seconds to the next heartbeat (or connection attempt)
+unsigned long TSrvReplMgr::getTimeout()
+{
+    if (!Active)
+        return DHCPV6_INFINITY;
+    return SERVER_DEFAULT_REPL_HEARTBEAT;
+}
+
+/// sends heartbeats, detects dead peer and reconnects
+void TSrvReplMgr::doDuties()
+{
+    if (!Active)
+        return;
+
+    unsigned long t = now();
+    if (OutFD >= 0 && t - OutLastAck >= SERVER_DEFAULT_REPL_TIMEOUT)
+        closeOut(OutConnected ? "peer does not acknowledge records" : 0);
+    if (InFD >= 0 && t - InLastRecv >= SERVER_DEFAULT_REPL_TIMEOUT)
+        closeIn("nothing received from peer");
+
+    if (OutConnected && t - OutLastSend >= SERVER_DEFAULT_REPL_HEARTBEAT) {
+        queueRecord(encodeHeader(REPL_HEARTBEAT, 0));
+        if (OutConnected)
+            flush();
+    }
+    connectPeer();
+}
+
+void TSrvReplMgr::printStats(std::ostream & out)
+{
+    if (!Active)
+        return;
+    TStatsMgr::printType(out, "dibbler_replication_peer_up", "gauge",
+                         "Replication peer is connected and synchronized (load is shared).");
+    out << "dibbler_replication_peer_up " << (peerUp() ? 1 : 0) << endl;
+    TStatsMgr::printType(out, "dibbler_replication_connects_total", "counter",
+                         "Connections made to replication peer.");
+    out << "dibbler_replication_connects_total " << Connects << endl;
+    TStatsMgr::printType(out, "dibbler_replication_records_total", "counter",
+                         "Lease records sent to and applied from replication peer.");
+    out << "dibbler_replication_records_total{direction=\"sent\"} " << RecordsSent << endl;
+    out << "dibbler_replication_records_total{direction=\"applied\"} " << RecordsApplied << endl;
+    TStatsMgr::printType(out, "dibbler_replication_unacked_records", "gauge",
+                         "Records sent to peer, but not acknowledged yet.");
+    out << "dibbler_replication_unacked_records " << (OutConnected ? RecSent - RecAcked : 0) << endl;
+    TStatsMgr::printType(out, "dibbler_replication_backlog_bytes", "gauge",
+                         "Bytes waiting to be sent to peer.");
+    out << "dibbler_replication_backlog_bytes " << OutBuf.size() - OutSent << endl;
+    TStatsMgr::printType(out, "dibbler_replication_conflicts_total", "counter",
+                         "Leases received from peer, but not applied (used by other client here).");
+    out << "dibbler_replication_conflicts_total " << Conflicts << endl;
+}
@@ -0,0 +1,182 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * authors: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+#ifndef SRVREPLMGR_H
+#define SRVREPLMGR_H
+
+#include <string>
+#include <iostream>
+#include "Portable.h"
+#include "SmartPtr.h"
+#include "DUID.h"
+#include "IPv6Addr.h"
+#include "AddrIA.h"
+#include "HashMap.h"
+
+#define SrvReplMgr() (TSrvReplMgr::instance())
+
+#define REPL_PROTO_VERSION 1
+
+/// record types sent over replication connection
+typedef enum {
+    REPL_HELLO        = 1, // version, sender's server DUID
+    REPL_ADD          = 2, // lease added (or refreshed, during snapshot)
+    REPL_DEL          = 3, // lease released, declined or expired
+    REPL_RENEW        = 4, // IA renewed (all its leases are refreshed)
+    REPL_SNAPSHOT_END = 5, // all leases known at connection time were sent
+    REPL_HEARTBEAT    = 6,
+    REPL_ACK          = 7  // receiver -> sender: number of records received so far
+} EReplRecord;
+
+/**
+ * @brief lease replication between two servers (active-active)
+ *
+ * Every lease change done by SrvAddrMgr (address or prefix added, deleted,
+ * renewed) is encoded as a compact record and streamed over TCP to the
+ * peer server, which applies it to its own lease database. Each server
+ * connects to the peer (replication-peer) and accepts peer's connection
+ * (replication-port), so there are two streams, one in each direction.
+ * Records are carried in one direction, acknowledgements in the other.
+ *
+ * After (re)connecting, the whole lease database is sent first (snapshot),
+ * so records lost while peers were disconnected are caught up. Leases
+ * deleted in the meantime are not, but they expire on their own.
+ *
+ * Records are queued and written when the socket is writable, so many of
+ * them usually go out in a single segment. Receiver acknowledges every
+ * batch it reads. Peer that does not send or acknowledge anything for
+ * SERVER_DEFAULT_REPL_TIMEOUT seconds is considered down.
+ *
+ * When both streams are up, servers split the load: clients are divided
+ * by DUID hash (who answers SOLICIT, REBIND, CONFIRM, INF-REQUEST) and
+ * addresses by address hash (who may assign which address from shared
+ * pools). When peer is down, this server handles everything. After start,
+ * nothing is assigned from shared pools until peer's leases are received
+ * (or SERVER_DEFAULT_REPL_GRACE seconds pass without them).
+ *
+ * If both servers assigned the same address to different clients, the
+ * older lease is kept by both of them. Client that lost it is refused
+ * when it tries to renew it and gets a new address.
+ */
+class TSrvReplMgr
+{
+  public:
+    static TSrvReplMgr & instance();
+
+    bool start(unsigned short listenPort, SPtr<TIPv6Addr> peer, unsigned short peerPort);
+    void stop();
+    bool isActive() { return Active; }
+    bool peerUp();
+    bool ready();
+
+    // lease changes (called by SrvAddrMgr and IA options)
+    void addLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, int iface,
+                  unsigned long iaid, unsigned long t1, unsigned long t2, SPtr<TIPv6Addr> addr,
+                  unsigned long pref, unsigned long valid, int prefixLen);
+    void delLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid, SPtr<TIPv6Addr> addr);
+    void renewLease(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid);
+
+    // load sharing
+    bool ownsClient(int msgType, SPtr<TDUID> duid);
+    bool mayAssign(SPtr<TIPv6Addr> addr, bool peerOwned = false);
+
+    // event loop
+    int addFDs(fd_set * rd, fd_set * wr);
+    int processFDs(fd_set * rd, fd_set * wr);
+    unsigned long getTimeout();
+    void doDuties();
+
+    void printStats(std::ostream & out);
+
+  private:
+    TSrvReplMgr();
+    static TSrvReplMgr * Instance;
+
+    // outgoing stream (records to peer)
+    void connectPeer();
+    void sendSnapshot();
+    void queueRecord(const std::string & rec);
+    void flush();
+    void readAcks();
+    void closeOut(const char * reason);
+
+    // incoming stream (records from peer)
+    void acceptPeer();
+    void readRecords();
+    void flushAcks();
+    bool applyRecord(const char * buf, int len);
+    void applyAdd(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                  const std::string & ifaceName, unsigned long iaid, unsigned long t1,
+                  unsigned long t2, SPtr<TIPv6Addr> addr, unsigned long pref,
+                  unsigned long valid, int prefixLen, unsigned long age);
+    void applyDel(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid, SPtr<TIPv6Addr> addr);
+    void applyRenew(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid);
+    SPtr<TAddrIA> findHolder(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr, SPtr<TDUID> & duid);
+    bool peerWins(SPtr<TIPv6Addr> addr, unsigned long mine, unsigned long peers);
+    void dropLease(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TAddrIA> ia, SPtr<TIPv6Addr> addr);
+    void closeIn(const char * reason);
+
+    std::string encodeAdd(TAddrIA::TIAType type, SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr,
+                          int iface, unsigned long iaid, unsigned long t1, unsigned long t2,
+                          SPtr<TIPv6Addr> addr, unsigned long pref, unsigned long valid,
+                          int prefixLen, unsigned long age);
+    static std::string encodeHeader(EReplRecord type, unsigned int len);
+    static unsigned int hash(const char * buf, int len);
+    bool ownsHash(unsigned int hash);
+    void updateIndex();
+
+    /// client holding an address (or prefix)
+    struct THolder {
+        SPtr<TDUID> Duid;
+        unsigned long IAID;
+        THolder() :IAID(0) { }
+    };
+    static std::string holderKey(TAddrIA::TIAType type, SPtr<TIPv6Addr> addr);
+    void indexHolders();
+
+    bool Active;
+    bool Applying;             // applying peer's record, don't send it back
+
+    unsigned short ListenPort; // 0 = don't accept peer's stream
+    SPtr<TIPv6Addr> Peer;      // 0 = don't send our stream
+    unsigned short PeerPort;
+    int ListenFD;
+
+    int OutFD;
+    bool OutConnected;
+    std::string OutBuf;        // records waiting to be written
+    unsigned int OutSent;      // bytes of OutBuf already written
+    bool OutSyncing;           // snapshot is still being sent
+    unsigned long RecSent;     // records written to current outgoing connection
+    unsigned long RecAcked;    // records acknowledged by peer
+    unsigned long OutLastAck;  // time of last ack received (or connect)
+    unsigned long OutLastSend; // time of last record queued (for heartbeats)
+    unsigned long NextConnect; // time of next connection attempt
+    std::string AckBuf;        // partially received ack
+
+    int InFD;
+    std::string InBuf;         // partially received records
+    std::string InAckBuf;      // acknowledgements waiting to be written
+    unsigned long RecRcvd;     // records received on current incoming connection
+    unsigned long InLastRecv;  // time of last record received
+    bool InSynced;             // peer's snapshot was received
+    bool Synced;               // peer's snapshot was received at least once since start
+    unsigned long StartTime;
+    SPtr<TDUID> PeerDuid;      // peer's server DUID (from HELLO)
+    int MyIndex;               // 0 or 1, server with lower DUID has index 0
+    THashMap<THolder> Holders; // lease -> client, to detect conflicts with peer's leases
+
+    // statistics
+    unsigned long Connects;
+    unsigned long RecordsSent;
+    unsigned long RecordsApplied;
+    unsigned long Conflicts;   // leases assigned to different clients here and on peer
+};
+
+#endif
@@ -0,0 +1,336 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <IPv6Addr.h>
+#include <DUID.h>
+#include <SrvAddrMgr.h>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+    class NakedSrvAddrMgr : public TSrvAddrMgr {
+    public:
+        NakedSrvAddrMgr()
+            :TSrvAddrMgr("SrvAddrMgrTest.xml", false, "", 0) { }
+    };
+
+    class SrvAddrMgrTest : public ::testing::Test {
+    public:
+        SrvAddrMgrTest() { }
+
+        SPtr<TDUID> duid(int i) {
+            char buf[32];
+            sprintf(buf, "00:01:00:0a:0b:%02x", i);
+            return new TDUID(buf);
+        }
+
+        SPtr<TIPv6Addr> addr(int i) {
+            char buf[32];
+            sprintf(buf, "2001:db8::%x", i);
+            return new TIPv6Addr(buf, true);
+        }
+
+        bool add(TSrvAddrMgr & mgr, int client, unsigned long iaid, int a,
+                 unsigned long valid = 4000) {
+            return mgr.addClntAddr(duid(client), addr(0xfe80), 2, iaid, 1000, 2000, addr(a),
+                                   3000, valid, true);
+        }
+    };
+
+TEST_F(SrvAddrMgrTest, cacheAddGet) {
+    NakedSrvAddrMgr mgr;
+    mgr.setCacheSize(1000000);
+
+    mgr.addCachedEntry(duid(1), addr(1), TAddrIA::TYPE_IA);
+    mgr.addCachedEntry(duid(1), addr(2), TAddrIA::TYPE_PD);
+    EXPECT_EQ(2u, mgr.getCacheCount());
+
+    // addresses and prefixes are cached separately
+    SPtr<TIPv6Addr> x = mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA);
+    ASSERT_TRUE(x != 0);
+    EXPECT_TRUE(*x == *addr(1));
+    x = mgr.getCachedEntry(duid(1), TAddrIA::TYPE_PD);
+    ASSERT_TRUE(x != 0);
+    EXPECT_TRUE(*x == *addr(2));
+    EXPECT_TRUE(mgr.getCachedEntry(duid(2), TAddrIA::TYPE_IA) == 0);
+}
+
+TEST_F(SrvAddrMgrTest, cacheReplace) {
+    NakedSrvAddrMgr mgr;
+    mgr.setCacheSize(1000000);
+
+    // new address for the same client replaces the old one
+    mgr.addCachedEntry(duid(1), addr(1), TAddrIA::TYPE_IA);
+    mgr.addCachedEntry(duid(1), addr(2), TAddrIA::TYPE_IA);
+    EXPECT_EQ(1u, mgr.getCacheCount());
+    EXPECT_TRUE(*mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA) == *addr(2));
+    EXPECT_FALSE(mgr.delCachedEntry(addr(1), TAddrIA::TYPE_IA));
+
+    // the same address cached for other client is taken from the first one
+    mgr.addCachedEntry(duid(2), addr(2), TAddrIA::TYPE_IA);
+    EXPECT_EQ(1u, mgr.getCacheCount());
+    EXPECT_TRUE(mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA) == 0);
+    EXPECT_TRUE(*mgr.getCachedEntry(duid(2), TAddrIA::TYPE_IA) == *addr(2));
+}
+
+TEST_F(SrvAddrMgrTest, cacheDelete) {
+    NakedSrvAddrMgr mgr;
+    mgr.setCacheSize(1000000);
+
+    mgr.addCachedEntry(duid(1), addr(1), TAddrIA::TYPE_IA);
+    mgr.addCachedEntry(duid(2), addr(2), TAddrIA::TYPE_IA);
+
+    EXPECT_TRUE(mgr.delCachedEntry(addr(1), TAddrIA::TYPE_IA));
+    EXPECT_FALSE(mgr.delCachedEntry(addr(1), TAddrIA::TYPE_IA));
+    EXPECT_TRUE(mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA) == 0);
+
+    EXPECT_FALSE(mgr.delCachedEntry(duid(2), TAddrIA::TYPE_PD));
+    EXPECT_TRUE(mgr.delCachedEntry(duid(2), TAddrIA::TYPE_IA));
+    EXPECT_EQ(0u, mgr.getCacheCount());
+    EXPECT_EQ(0u, mgr.getCacheUsage());
+}
+
+TEST_F(SrvAddrMgrTest, cacheLRU) {
+    NakedSrvAddrMgr mgr;
+    mgr.setCacheSize(1000000);
+
+    // all entries have the same size
+    mgr.addCachedEntry(duid(1), addr(1), TAddrIA::TYPE_IA);
+    unsigned long entrySize = mgr.getCacheUsage();
+    ASSERT_TRUE(entrySize > 0);
+    mgr.addCachedEntry(duid(2), addr(2), TAddrIA::TYPE_IA);
+    mgr.addCachedEntry(duid(3), addr(3), TAddrIA::TYPE_IA);
+    EXPECT_EQ(3*entrySize, mgr.getCacheUsage());
+
+    // client 1 is used again, so client 2 is the least recently used one
+    ASSERT_TRUE(mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA) != 0);
+    mgr.setCacheSize(3*entrySize);
+    mgr.addCachedEntry(duid(4), addr(4), TAddrIA::TYPE_IA);
+    EXPECT_EQ(3u, mgr.getCacheCount());
+    EXPECT_TRUE(mgr.getCachedEntry(duid(2), TAddrIA::TYPE_IA) == 0);
+    EXPECT_TRUE(mgr.getCachedEntry(duid(1), TAddrIA::TYPE_IA) != 0);
+    EXPECT_TRUE(mgr.getCachedEntry(duid(3), TAddrIA::TYPE_IA) != 0);
+    EXPECT_TRUE(mgr.getCachedEntry(duid(4), TAddrIA::TYPE_IA) != 0);
+
+    // shrinking the cache drops the oldest entries (now 1, then 3)
+    mgr.setCacheSize(entrySize);
+    EXPECT_EQ(1u, mgr.getCacheCount());
+    EXPECT_TRUE(mgr.getCachedEntry(duid(4), TAddrIA::TYPE_IA) != 0);
+
+    // cache size 0 disables the cache
+    mgr.setCacheSize(0);
+    EXPECT_EQ(0u, mgr.getCacheCount());
+    mgr.addCachedEntry(duid(5), addr(5), TAddrIA::TYPE_IA);
+    EXPECT_EQ(0u, mgr.getCacheCount());
+}
+
+TEST_F(SrvAddrMgrTest, cacheMany) {
+    NakedSrvAddrMgr mgr;
+    mgr.setCacheSize(100000000);
+
+    // enough entries to make the indexes grow and shrink a few times
+    for (int i = 1; i <= 2000; i++) {
+        char buf[32];
+        sprintf(buf, "00:01:00:0a:%02x:%02x", i >> 8, i & 0xff);
+        mgr.addCachedEntry(new TDUID(buf), addr(i), TAddrIA::TYPE_IA);
+    }
+    EXPECT_EQ(2000u, mgr.getCacheCount());
+    for (int i = 1; i <= 2000; i++) {
+        if (i % 10) {
+            EXPECT_TRUE(mgr.delCachedEntry(addr(i), TAddrIA::TYPE_IA));
+        }
+    }
+    EXPECT_EQ(200u, mgr.getCacheCount());
+    for (int i = 10; i <= 2000; i += 10) {
+        char buf[32];
+        sprintf(buf, "00:01:00:0a:%02x:%02x", i >> 8, i & 0xff);
+        SPtr<TIPv6Addr> x = mgr.getCachedEntry(new TDUID(buf), TAddrIA::TYPE_IA);
+        ASSERT_TRUE(x != 0);
+        EXPECT_TRUE(*x == *addr(i));
+    }
+}
+
+TEST_F(SrvAddrMgrTest, offerHold) {
+    NakedSrvAddrMgr mgr;
+
+    EXPECT_TRUE(mgr.addrIsFree(addr(1)));
+    EXPECT_TRUE(mgr.addOffer(duid(1), 7, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_TRUE(mgr.addOffer(duid(1), 7, TAddrIA::TYPE_IA, addr(2), 2, 1));
+    EXPECT_EQ(1u, mgr.getOfferCount());
+
+    // offered addresses are not free for other clients
+    EXPECT_TRUE(mgr.addrIsOffered(addr(1), TAddrIA::TYPE_IA));
+    EXPECT_FALSE(mgr.addrIsOffered(addr(1), TAddrIA::TYPE_TA));
+    EXPECT_FALSE(mgr.addrIsFree(addr(1)));
+    EXPECT_FALSE(mgr.addrIsFree(addr(2)));
+    EXPECT_TRUE(mgr.taAddrIsFree(addr(1)));
+
+    // offers are counted per link and per pool
+    EXPECT_EQ(2u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA));
+    EXPECT_EQ(1u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA, 0));
+    EXPECT_EQ(1u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA, 1));
+    EXPECT_EQ(0u, mgr.getOfferedCount(3, TAddrIA::TYPE_IA));
+    EXPECT_EQ(0u, mgr.getOfferedCount(2, TAddrIA::TYPE_PD));
+
+    // other IA of the same client has no offer
+    EXPECT_TRUE(mgr.takeOffer(duid(1), 8, TAddrIA::TYPE_IA) == 0);
+
+    // REQUEST takes the offer
+    SPtr<TIPv6Addr> x = mgr.takeOffer(duid(1), 7, TAddrIA::TYPE_IA);
+    ASSERT_TRUE(x != 0);
+    EXPECT_TRUE(*x == *addr(1));
+    EXPECT_EQ(0u, mgr.getOfferCount());
+    EXPECT_EQ(0u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA));
+    EXPECT_EQ(0u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA, 1));
+    EXPECT_TRUE(mgr.addrIsFree(addr(1)));
+    EXPECT_TRUE(mgr.addrIsFree(addr(2)));
+    EXPECT_EQ(DHCPV6_INFINITY, mgr.getOfferTimeout());
+}
+
+TEST_F(SrvAddrMgrTest, offerMoved) {
+    NakedSrvAddrMgr mgr;
+
+    // address offered to other client is no longer held for the first one
+    EXPECT_TRUE(mgr.addOffer(duid(1), 1, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_TRUE(mgr.addOffer(duid(2), 1, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_EQ(1u, mgr.getOfferCount());
+    EXPECT_EQ(1u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA));
+    EXPECT_TRUE(mgr.takeOffer(duid(1), 1, TAddrIA::TYPE_IA) == 0);
+    EXPECT_TRUE(mgr.takeOffer(duid(2), 1, TAddrIA::TYPE_IA) != 0);
+}
+
+TEST_F(SrvAddrMgrTest, offerLimit) {
+    NakedSrvAddrMgr mgr;
+    mgr.setOfferLimit(2);
+
+    EXPECT_TRUE(mgr.addOffer(duid(1), 1, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_TRUE(mgr.addOffer(duid(2), 1, TAddrIA::TYPE_IA, addr(2), 2, 0));
+
+    // limit is reached on this link, address is not held
+    EXPECT_FALSE(mgr.addOffer(duid(3), 1, TAddrIA::TYPE_IA, addr(3), 2, 0));
+    EXPECT_FALSE(mgr.addrIsOffered(addr(3), TAddrIA::TYPE_IA));
+    EXPECT_TRUE(mgr.takeOffer(duid(3), 1, TAddrIA::TYPE_IA) == 0);
+    EXPECT_EQ(2u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA));
+
+    // other links and other types have their own limits
+    EXPECT_TRUE(mgr.addOffer(duid(3), 1, TAddrIA::TYPE_IA, addr(3), 3, 0));
+    EXPECT_TRUE(mgr.addOffer(duid(3), 1, TAddrIA::TYPE_TA, addr(4), 2, 0));
+
+    // taken offer makes room for another one
+    EXPECT_TRUE(mgr.takeOffer(duid(1), 1, TAddrIA::TYPE_IA) != 0);
+    EXPECT_TRUE(mgr.addOffer(duid(4), 1, TAddrIA::TYPE_IA, addr(5), 2, 0));
+}
+
+TEST_F(SrvAddrMgrTest, offerLifetime) {
+    NakedSrvAddrMgr mgr;
+
+    // lifetime 0 disables offers
+    mgr.setOfferLifetime(0);
+    EXPECT_FALSE(mgr.addOffer(duid(1), 1, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_EQ(0u, mgr.getOfferCount());
+
+    mgr.setOfferLifetime(1);
+    EXPECT_TRUE(mgr.addOffer(duid(1), 1, TAddrIA::TYPE_IA, addr(1), 2, 0));
+    EXPECT_TRUE(mgr.addOffer(duid(2), 1, TAddrIA::TYPE_PD, addr(2), 2, 0));
+    EXPECT_TRUE(mgr.getOfferTimeout() <= 2);
+
+    sleep(2);
+    EXPECT_FALSE(mgr.addrIsOffered(addr(1), TAddrIA::TYPE_IA));
+    EXPECT_EQ(0u, mgr.getOfferTimeout());
+    mgr.expireOffers();
+    EXPECT_EQ(0u, mgr.getOfferCount());
+    EXPECT_EQ(0u, mgr.getOfferedCount(2, TAddrIA::TYPE_IA));
+    EXPECT_EQ(0u, mgr.getOfferedCount(2, TAddrIA::TYPE_PD));
+    EXPECT_EQ(DHCPV6_INFINITY, mgr.getOfferTimeout());
+}
+
+TEST_F(SrvAddrMgrTest, countAddDel) {
+    NakedSrvAddrMgr mgr;
+    EXPECT_EQ(0u, mgr.getAddrCount(duid(1)));
+
+    // addresses in all IAs of the client are counted
+    EXPECT_TRUE(add(mgr, 1, 1, 1));
+    EXPECT_TRUE(add(mgr, 1, 1, 2));
+    EXPECT_TRUE(add(mgr, 1, 2, 3));
+    EXPECT_TRUE(add(mgr, 2, 1, 4));
+    EXPECT_EQ(3u, mgr.getAddrCount(duid(1)));
+    EXPECT_EQ(1u, mgr.getAddrCount(duid(2)));
+
+    // address already assigned is not counted twice
+    EXPECT_FALSE(add(mgr, 1, 1, 1));
+    EXPECT_EQ(3u, mgr.getAddrCount(duid(1)));
+
+    // temporary addresses and prefixes are not counted
+    EXPECT_TRUE(mgr.addTAAddr(duid(1), addr(0xfe80), 2, 5, addr(5), 3000, 4000));
+    EXPECT_TRUE(mgr.addPrefix(duid(1), addr(0xfe80), 2, 6, 1000, 2000, addr(0x600),
+                              3000, 4000, 120, true));
+    EXPECT_EQ(3u, mgr.getAddrCount(duid(1)));
+
+    // addresses that are not assigned (or assigned to other IA) are not removed
+    EXPECT_FALSE(mgr.delClntAddr(duid(1), 1, addr(4), true));
+    EXPECT_FALSE(mgr.delClntAddr(duid(1), 1, addr(3), true));
+    EXPECT_FALSE(mgr.delClntAddr(duid(3), 1, addr(1), true));
+    EXPECT_EQ(3u, mgr.getAddrCount(duid(1)));
+
+    EXPECT_TRUE(mgr.delClntAddr(duid(1), 1, addr(1), true));
+    EXPECT_TRUE(mgr.delClntAddr(duid(1), 2, addr(3), true));
+    EXPECT_EQ(1u, mgr.getAddrCount(duid(1)));
+    EXPECT_TRUE(mgr.delClntAddr(duid(1), 1, addr(2), true));
+    EXPECT_EQ(0u, mgr.getAddrCount(duid(1)));
+    EXPECT_EQ(1u, mgr.getAddrCount(duid(2)));
+
+    // client is added again after all its addresses were released
+    EXPECT_TRUE(add(mgr, 1, 1, 1));
+    EXPECT_EQ(1u, mgr.getAddrCount(duid(1)));
+}
+
+TEST_F(SrvAddrMgrTest, countExpire) {
+    NakedSrvAddrMgr mgr;
+
+    EXPECT_TRUE(add(mgr, 1, 1, 1));
+    EXPECT_TRUE(add(mgr, 1, 1, 2, 0));
+    EXPECT_TRUE(add(mgr, 2, 1, 3, 0));
+    EXPECT_EQ(2u, mgr.getAddrCount(duid(1)));
+
+    // expired addresses are released the same way as server does it
+    std::vector<TSrvAddrMgr::TExpiredInfo> addrs, tempAddrs, prefixes;
+    mgr.doDuties(addrs, tempAddrs, prefixes);
+    ASSERT_EQ(2u, addrs.size());
+    for (unsigned int i = 0; i < addrs.size(); i++)
+        EXPECT_TRUE(mgr.delClntAddr(addrs[i].client->getDUID(), addrs[i].ia->getIAID(),
+                                    addrs[i].addr, true));
+    EXPECT_EQ(1u, mgr.getAddrCount(duid(1)));
+    EXPECT_EQ(0u, mgr.getAddrCount(duid(2)));
+    EXPECT_EQ(1, mgr.countClient());
+}
+
+TEST_F(SrvAddrMgrTest, countLoad) {
+    NakedSrvAddrMgr mgr;
+    EXPECT_TRUE(add(mgr, 1, 1, 1));
+    EXPECT_TRUE(add(mgr, 1, 2, 2));
+    EXPECT_TRUE(add(mgr, 2, 1, 3));
+    EXPECT_TRUE(mgr.addPrefix(duid(3), addr(0xfe80), 2, 1, 1000, 2000, addr(0x600),
+                              3000, 4000, 120, true));
+    ASSERT_TRUE(mgr.dbSave("SrvAddrMgrTest-count.xml"));
+    ASSERT_TRUE(mgr.dbSave("SrvAddrMgrTest-count.db"));
+
+    // addresses of imported database (XML and binary one) are counted once it is loaded
+    const char * bins[] = { "SrvAddrMgrTest-none.db", "SrvAddrMgrTest-count.db" };
+    for (int i = 0; i < 2; i++) {
+        SPtr<TSrvAddrMgr> db = TSrvAddrMgr::loadDb("SrvAddrMgrTest-count.xml", bins[i]);
+        EXPECT_EQ(3, db->countClient()) << bins[i];
+        EXPECT_EQ(2u, db->getAddrCount(duid(1))) << bins[i];
+        EXPECT_EQ(1u, db->getAddrCount(duid(2))) << bins[i];
+        EXPECT_EQ(0u, db->getAddrCount(duid(3))) << bins[i];
+
+        // and updated afterwards
+        EXPECT_TRUE(add(*db, 2, 1, 4));
+        EXPECT_TRUE(db->delClntAddr(duid(1), 2, addr(2), true));
+        EXPECT_EQ(1u, db->getAddrCount(duid(1))) << bins[i];
+        EXPECT_EQ(2u, db->getAddrCount(duid(2))) << bins[i];
+    }
+    unlink("SrvAddrMgrTest-count.xml");
+    unlink("SrvAddrMgrTest-count.db");
+}
+
+}
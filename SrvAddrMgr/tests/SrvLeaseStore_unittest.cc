@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <IPv6Addr.h>
+#include <DUID.h>
+#include <SrvLeaseStore.h>
+
+namespace {
+
+    // store that records taken over leases instead of adding them to SrvAddrMgr
+    class NakedSrvLeaseStore : public TSrvLeaseStore {
+    public:
+        NakedSrvLeaseStore() { }
+
+        std::vector<std::string> Added;
+
+    protected:
+        bool inDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                  SPtr<TIPv6Addr> addr) {
+            for (unsigned int i = 0; i < Added.size(); i++)
+                if (Added[i] == addr->getPlain())
+                    return true;
+            return false;
+        }
+
+        bool addToDb(TAddrIA::TIAType type, SPtr<TDUID> duid, unsigned long iaid,
+                     SPtr<TIPv6Addr> addr, const TLeaseRecord & rec) {
+            Added.push_back(addr->getPlain());
+            return true;
+        }
+    };
+
+    class SrvLeaseStoreTest : public ::testing::Test {
+    public:
+        SrvLeaseStoreTest() { }
+
+        SPtr<TDUID> duid(int i) {
+            char buf[32];
+            sprintf(buf, "00:01:00:0a:0b:%02x", i);
+            return new TDUID(buf);
+        }
+
+        SPtr<TIPv6Addr> addr(int i) {
+            char buf[32];
+            sprintf(buf, "2001:db8::%x", i);
+            return new TIPv6Addr(buf, true);
+        }
+
+        void add(TSrvLeaseStore & store, TAddrIA::TIAType type, int client, unsigned long iaid,
+                 int a, unsigned long valid = 4000) {
+            store.addLease(type, duid(client), addr(0xfe80), 1, iaid, 1000, 2000, addr(a),
+                           3000, valid, type == TAddrIA::TYPE_PD ? 64 : 128);
+        }
+
+        unsigned long stat(TSrvLeaseStore & store, const std::string & name) {
+            std::ostringstream out;
+            store.printStats(out);
+            std::istringstream in(out.str());
+            std::string line;
+            while (std::getline(in, line))
+                if (!line.compare(0, name.length() + 1, name + " "))
+                    return atol(line.c_str() + name.length() + 1);
+            return 0;
+        }
+    };
+
+TEST_F(SrvLeaseStoreTest, inactive) {
+    NakedSrvLeaseStore store;
+    EXPECT_FALSE(store.isActive());
+
+    add(store, TAddrIA::TYPE_IA, 1, 1, 1);
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(1), 1, addr(1)));
+}
+
+TEST_F(SrvLeaseStoreTest, ownership) {
+    NakedSrvLeaseStore store;
+    ASSERT_TRUE(store.create(1000, 2));
+
+    add(store, TAddrIA::TYPE_IA, 1, 1, 1);
+    add(store, TAddrIA::TYPE_PD, 1, 1, 2);
+    add(store, TAddrIA::TYPE_TA, 1, 1, 3);
+
+    // own leases are free for this worker, not for others
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.setWorker(1);
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_PD, addr(2)));
+
+    // addresses and prefixes are separate, temporary addresses are not recorded
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_PD, addr(1)));
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(2)));
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_TA, addr(3)));
+    EXPECT_EQ(2u, stat(store, "dibbler_lease_store_entries"));
+
+    // only owner can delete its lease
+    store.delLease(TAddrIA::TYPE_IA, duid(1), 1, addr(1));
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.setWorker(0);
+    store.delLease(TAddrIA::TYPE_IA, duid(1), 1, addr(1));
+    store.setWorker(1);
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    EXPECT_EQ(1u, stat(store, "dibbler_lease_store_entries"));
+
+    // expired leases are free
+    store.setWorker(0);
+    add(store, TAddrIA::TYPE_IA, 2, 1, 4, 0);
+    store.setWorker(1);
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(4)));
+}
+
+TEST_F(SrvLeaseStoreTest, conflict) {
+    NakedSrvLeaseStore store;
+    ASSERT_TRUE(store.create(1000, 2));
+
+    // the same address assigned by both workers: the newer lease is kept
+    add(store, TAddrIA::TYPE_IA, 1, 1, 1);
+    store.setWorker(1);
+    add(store, TAddrIA::TYPE_IA, 2, 1, 1);
+    EXPECT_EQ(1u, stat(store, "dibbler_lease_store_conflicts_total"));
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.setWorker(0);
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+
+    // the same client is not a conflict
+    add(store, TAddrIA::TYPE_IA, 2, 1, 1);
+    EXPECT_EQ(1u, stat(store, "dibbler_lease_store_conflicts_total"));
+    store.setWorker(1);
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+}
+
+TEST_F(SrvLeaseStoreTest, importLease) {
+    NakedSrvLeaseStore store;
+    ASSERT_TRUE(store.create(1000, 2));
+
+    add(store, TAddrIA::TYPE_IA, 1, 7, 1);
+    add(store, TAddrIA::TYPE_PD, 1, 8, 2);
+    add(store, TAddrIA::TYPE_IA, 2, 7, 3, 0);
+
+    // own leases, other clients, other IAs and expired leases are not taken over
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(1), 7, addr(1)));
+    store.setWorker(1);
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(2), 7, addr(1)));
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(1), 8, addr(1)));
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_PD, duid(1), 7, addr(1)));
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(1), 7, addr(4)));
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(2), 7, addr(3)));
+    EXPECT_TRUE(store.Added.empty());
+
+    EXPECT_TRUE(store.importLease(TAddrIA::TYPE_IA, duid(1), 7, addr(1)));
+    EXPECT_TRUE(store.importLease(TAddrIA::TYPE_PD, duid(1), 8, addr(2)));
+    ASSERT_EQ(2u, store.Added.size());
+    EXPECT_EQ(std::string(addr(1)->getPlain()), store.Added[0]);
+    EXPECT_EQ(2u, stat(store, "dibbler_lease_store_imports_total"));
+
+    // lease is in this worker's database already
+    EXPECT_FALSE(store.importLease(TAddrIA::TYPE_IA, duid(1), 7, addr(1)));
+
+    // lease belongs to the new owner now, previous one can't delete it
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.setWorker(0);
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.delLease(TAddrIA::TYPE_IA, duid(1), 7, addr(1));
+    EXPECT_FALSE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+    store.setWorker(1);
+    store.delLease(TAddrIA::TYPE_IA, duid(1), 7, addr(1));
+    store.setWorker(0);
+    EXPECT_TRUE(store.isFree(TAddrIA::TYPE_IA, addr(1)));
+}
+
+}
@@ -206,6 +206,17 @@ bool TSrvCfgAddrClass::addrInPool(SPtr<TIPv6Addr> addr)
     return Pool->in(addr);
 }
 
+bool TSrvCfgAddrClass::addrInSlice(SPtr<TIPv6Addr> addr)
+{
+    // no slice: server runs as a single process or pool is too small for this worker
+    return Slice ? Slice->in(addr) : (AddrsCount && Pool->in(addr));
+}
+
+SPtr<TStationRange> TSrvCfgAddrClass::getPool()
+{
+    return Pool;
+}
+
 unsigned long TSrvCfgAddrClass::countAddrInPool()
 {
     return this->AddrsCount;
@@ -213,9 +224,27 @@ unsigned long TSrvCfgAddrClass::countAddrInPool()
 
 SPtr<TIPv6Addr> TSrvCfgAddrClass::getRandomAddr()
 {
+    if (Slice)
+        return Slice->getRandomAddr();
     return Pool->getRandomAddr();
 }
 
+/**
+ * limits this worker to its part of the pool (used when server runs in several workers)
+ *
+ * @param index worker index
+ * @param count number of workers
+ */
+void TSrvCfgAddrClass::setSlice(int index, int count)
+{
+    Slice = Pool->getSlice(index, count, 0);
+    if (ClassMaxLease < DHCPV6_INFINITY) // limit is split, rounding up
+        ClassMaxLease = ClassMaxLease / count + (ClassMaxLease % count ? 1 : 0);
+    AddrsCount = Slice ? Slice->rangeCount() : 0;
+    if (ClassMaxLease > AddrsCount)
+        ClassMaxLease = AddrsCount;
+}
+
 unsigned long TSrvCfgAddrClass::getClassMaxLease() {
     return ClassMaxLease;
 }
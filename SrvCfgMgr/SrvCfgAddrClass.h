@@ -44,7 +44,10 @@ class TSrvCfgAddrClass
 
     //checks if the address belongs to the pool
     bool addrInPool(SPtr<TIPv6Addr> addr);
+    //checks if the address belongs to this worker's part of the pool
+    bool addrInSlice(SPtr<TIPv6Addr> addr);
     unsigned long countAddrInPool();
+    SPtr<TStationRange> getPool();
     SPtr<TIPv6Addr> getRandomAddr();
 
     unsigned long getT1(unsigned long clntT1);
@@ -62,6 +65,7 @@ class TSrvCfgAddrClass
     long decrAssigned(int count=1);
 
     void setOptions(SPtr<TSrvParsGlobalOpt> opt);
+    void setSlice(int index, int count);
     SPtr<TSrvOptAddrParams> getAddrParams();
 
     virtual ~TSrvCfgAddrClass();
@@ -81,6 +85,7 @@ class TSrvCfgAddrClass
     long chooseTime(unsigned long beg, unsigned long end, unsigned long clntTime);
 
     SPtr<TStationRange> Pool;
+    SPtr<TStationRange> Slice;   // part of the pool this worker assigns from (0 = whole pool)
     unsigned long ClassMaxLease;
     unsigned long AddrsAssigned;
     unsigned long AddrsCount;
@@ -142,6 +142,22 @@ SPtr<TSrvCfgTA> TSrvCfgIface::getTA() {
 void TSrvCfgIface::addPD(SPtr<TSrvCfgPD> pd) {
     this->PrefixDelegationSupport = true;
     this->SrvCfgPDLst.append(pd);
+
+    SPtr<TStationRange> pool;
+    pd->firstPool();
+    while (pool = pd->getPool())
+        PDTrie.insert(pool->getAddrL()->getAddr(), pool->getAddrR()->getAddr(), pd);
+}
+
+/**
+ * returns PD class, which prefix belongs to
+ *
+ * @param prefix
+ *
+ * @return PD class (or 0 if prefix does not belong to any pool)
+ */
+SPtr<TSrvCfgPD> TSrvCfgIface::getPDByPrefix(SPtr<TIPv6Addr> prefix) {
+    return PDTrie.find(prefix->getAddr());
 }
 
 SPtr<TSrvCfgTA> TSrvCfgIface::getTA(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr) {
@@ -179,37 +195,39 @@ SPtr<TSrvCfgAddrClass> TSrvCfgIface::getClassByID(unsigned long id) {
 }
 
 void TSrvCfgIface::addClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false*/) {
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    this->firstAddrClass();
-    while (ptrClass = this->getAddrClass() ) {
-        if (ptrClass->addrInPool(ptrAddr)) {
-            unsigned int count = ptrClass->incrAssigned();
-            if (quiet)
-                return;
-            Log(Debug) << "Address usage for class " << ptrClass->getID()
-                       << " increased to " << count << "." << LogEnd;
-            return;
-        }
+    SPtr<TSrvCfgAddrClass> ptrClass = getClassByAddr(ptrAddr);
+    if (!ptrClass) {
+        Log(Warning) << "Unable to increase address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return;
     }
-    Log(Warning) << "Unable to increase address usage: no class found for "
-                 << *ptrAddr << LogEnd;
+    unsigned long count = ptrClass->incrAssigned();
+    AssignedCount++;
+    if (quiet)
+        return;
+    Log(Debug) << "Address usage for class " << ptrClass->getID()
+               << " increased to " << count << "." << LogEnd;
 }
 
 void TSrvCfgIface::delClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false*/) {
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    this->firstAddrClass();
-    while (ptrClass = this->getAddrClass() ) {
-        if (ptrClass->addrInPool(ptrAddr)) {
-            unsigned long count = ptrClass->decrAssigned();
-            if (quiet)
-                return;
-            Log(Debug) << "Address usage for class " << ptrClass->getID()
-                       << " decreased to " << count << "." << LogEnd;
-            return;
-        }
+    SPtr<TSrvCfgAddrClass> ptrClass = getClassByAddr(ptrAddr);
+    if (!ptrClass) {
+        Log(Warning) << "Unable to decrease address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return;
     }
-    Log(Warning) << "Unable to decrease address usage: no class found for "
-                 << *ptrAddr << LogEnd;
+    unsigned long count = ptrClass->decrAssigned();
+    if (AssignedCount)
+        AssignedCount--;
+    if (quiet)
+        return;
+    Log(Debug) << "Address usage for class " << ptrClass->getID()
+               << " decreased to " << count << "." << LogEnd;
+}
+
+/// returns number of addresses (IA_NA) assigned from all classes on this interface
+unsigned long TSrvCfgIface::getAssignedCount() {
+    return AssignedCount;
 }
 
 SPtr<TSrvCfgAddrClass> TSrvCfgIface::getRandomClass(SPtr<TDUID> clntDuid,
@@ -264,39 +282,33 @@ SPtr<TSrvCfgPD> TSrvCfgIface::getPDByID(unsigned long id) {
 }
 
 bool TSrvCfgIface::addClntPrefix(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false */) {
-    SPtr<TSrvCfgPD> ptrPD;
-    this->firstPD();
-    while (ptrPD = this->getPD() ) {
-        if (ptrPD->prefixInPool(ptrAddr)) {
-            unsigned long count = ptrPD->incrAssigned();
-            if (quiet)
-                return true;
-            Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
-                       << " increased to " << count << "." << LogEnd;
-            return true;
-        }
-    }
-    Log(Warning) << "Unable to increase prefix usage: no prefix found for "
-                 << *ptrAddr << LogEnd;
-    return false;
+    SPtr<TSrvCfgPD> ptrPD = getPDByPrefix(ptrAddr);
+    if (!ptrPD) {
+        Log(Warning) << "Unable to increase prefix usage: no prefix found for "
+                     << *ptrAddr << LogEnd;
+        return false;
+    }
+    unsigned long count = ptrPD->incrAssigned();
+    if (quiet)
+        return true;
+    Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
+               << " increased to " << count << "." << LogEnd;
+    return true;
 }
 
 bool TSrvCfgIface::delClntPrefix(SPtr<TIPv6Addr> ptrAddr, bool quiet /* =false */) {
-    SPtr<TSrvCfgPD> ptrPD;
-    this->firstPD();
-    while (ptrPD = this->getPD() ) {
-        if (ptrPD->prefixInPool(ptrAddr)) {
-            unsigned long count = ptrPD->decrAssigned();
-            if (quiet)
-                return true;
-            Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
-                       << " decreased to " << count << "." << LogEnd;
-            return true;
-        }
-    }
-    Log(Warning) << "Unable to decrease address usage: no class found for "
-                 << *ptrAddr << LogEnd;
-    return false;
+    SPtr<TSrvCfgPD> ptrPD = getPDByPrefix(ptrAddr);
+    if (!ptrPD) {
+        Log(Warning) << "Unable to decrease address usage: no class found for "
+                     << *ptrAddr << LogEnd;
+        return false;
+    }
+    unsigned long count = ptrPD->decrAssigned();
+    if (quiet)
+        return true;
+    Log(Debug) << "PD: Prefix usage for class " << ptrPD->getID()
+               << " decreased to " << count << "." << LogEnd;
+    return true;
 }
 
 long TSrvCfgIface::countPD() {
@@ -403,6 +415,7 @@ void TSrvCfgIface::setDefaults() {
     this->ID = -1;
     this->NoConfig = false;
     this->preference = 0;
+    this->AssignedCount = 0;
 
     this->UnknownFQDN = SERVER_DEFAULT_UNKNOWN_FQDN;
     this->PrefixDelegationSupport = false;
@@ -431,6 +444,48 @@ bool TSrvCfgIface::getRapidCommit() {
 
 void TSrvCfgIface::addAddrClass(SPtr<TSrvCfgAddrClass> addrClass) {
     this->SrvCfgAddrClassLst.append(addrClass);
+
+    SPtr<TStationRange> pool = addrClass->getPool();
+    if (pool)
+        AddrClassTrie.insert(pool->getAddrL()->getAddr(), pool->getAddrR()->getAddr(), addrClass);
+}
+
+/**
+ * returns class, which address belongs to
+ *
+ * @param addr
+ *
+ * @return class (or 0 if address does not belong to any pool)
+ */
+SPtr<TSrvCfgAddrClass> TSrvCfgIface::getClassByAddr(SPtr<TIPv6Addr> addr) {
+    return AddrClassTrie.find(addr->getAddr());
+}
+
+/**
+ * splits all pools defined on this interface between workers
+ *
+ * @param index worker index
+ * @param count number of workers
+ */
+void TSrvCfgIface::setSlice(int index, int count)
+{
+    SPtr<TSrvCfgAddrClass> addrClass;
+    SrvCfgAddrClassLst.first();
+    while (addrClass = SrvCfgAddrClassLst.get())
+        addrClass->setSlice(index, count);
+
+    SPtr<TSrvCfgTA> ta;
+    SrvCfgTALst.first();
+    while (ta = SrvCfgTALst.get())
+        ta->setSlice(index, count);
+
+    SPtr<TSrvCfgPD> pd;
+    SrvCfgPDLst.first();
+    while (pd = SrvCfgPDLst.get())
+        pd->setSlice(index, count);
+
+    if (IfaceMaxLease < DHCPV6_INFINITY) // limit is split, rounding up
+        IfaceMaxLease = IfaceMaxLease / count + (IfaceMaxLease % count ? 1 : 0);
 }
 
 long TSrvCfgIface::getIfaceMaxLease() {
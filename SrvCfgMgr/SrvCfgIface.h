@@ -24,6 +24,7 @@ class TSrvCfgIface;
 #include <string>
 #include "OptVendorSpecInfo.h"
 #include "SrvCfgOptions.h"
+#include "AddrTrie.h"
 
 class TSrvCfgIface: public TSrvCfgOptions
 {
@@ -48,6 +49,7 @@ public:
     bool getAllowedAddrClassID(SPtr<TDUID> duid, SPtr<TIPv6Addr> clntAddr, unsigned long &classid);
     SPtr<TSrvCfgAddrClass> getAddrClass();
     SPtr<TSrvCfgAddrClass> getClassByID(unsigned long id);
+    SPtr<TSrvCfgAddrClass> getClassByAddr(SPtr<TIPv6Addr> addr);
     SPtr<TSrvCfgAddrClass> getRandomClass(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr);
     long countAddrClass();
 
@@ -65,6 +67,7 @@ public:
     void addPD(SPtr<TSrvCfgPD> pd);
     void firstPD();
     SPtr<TSrvCfgPD> getPD();
+    SPtr<TSrvCfgPD> getPDByPrefix(SPtr<TIPv6Addr> prefix);
     bool addClntPrefix(SPtr<TIPv6Addr> ptrPD, bool quiet = false);
     bool delClntPrefix(SPtr<TIPv6Addr> ptrPD, bool quiet = false);
     bool supportPrefixDelegation();
@@ -73,6 +76,7 @@ public:
     SPtr<TIPv6Addr> getUnicast();
     void setNoConfig();
     void setOptions(SPtr<TSrvParsGlobalOpt> opt);
+    void setSlice(int index, int count);
 
     unsigned char getPreference();
 
@@ -84,6 +88,7 @@ public:
     // IA address functions
     void addClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet = false);
     void delClntAddr(SPtr<TIPv6Addr> ptrAddr, bool quiet = false);
+    unsigned long getAssignedCount();
 
     // TA address functions
     void addTAAddr();
@@ -125,6 +130,8 @@ private:
     unsigned long ClntMaxLease;
     bool RapidCommit;
     List(TSrvCfgAddrClass) SrvCfgAddrClassLst; // IA_NA list (normal addresses)
+    TAddrTrie< SPtr<TSrvCfgAddrClass> > AddrClassTrie; // pool ranges -> class
+    unsigned long AssignedCount; // addresses assigned from all classes
     bool LeaseQuery;
 
     // --- Temporary Addresses ---
@@ -132,6 +139,7 @@ private:
 
     // --- Prefix Delegation ---
     List(TSrvCfgPD) SrvCfgPDLst;
+    TAddrTrie< SPtr<TSrvCfgPD> > PDTrie; // prefix pool ranges -> PD class
     bool PrefixDelegationSupport;
 
     // --- relay ---
@@ -15,15 +15,18 @@
 #include <stdlib.h>
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <string>
 using namespace std;
 #include "SmartPtr.h"
 #include "Portable.h"
+#include "DHCPDefaults.h"
 #include "FlexLexer.h"
 #include "SrvParser.h"
 #include "SrvCfgMgr.h"
 #include "SrvCfgIface.h"
 #include "Logger.h"
+#include "StatsMgr.h"
 #include "IfaceMgr.h"
 #include "SrvIfaceMgr.h"
 #include "AddrMgr.h"
@@ -34,7 +37,8 @@ TSrvCfgMgr * TSrvCfgMgr::Instance = 0;
 int TSrvCfgMgr::NextRelayID = RELAY_MIN_IFINDEX;
 
 TSrvCfgMgr::TSrvCfgMgr(const std::string& cfgFile, const std::string& xmlFile)
-    :TCfgMgr(), XmlFile(xmlFile), reconfigure(false)
+    :TCfgMgr(), DumpFile(xmlFile), DumpPending(false), LastDump(0),
+     DumpInterval(SERVER_DEFAULT_DUMP_INTERVAL), reconfigure(false), Worker(0), Workers(1)
 {
     setDefaults();
  
@@ -55,6 +59,7 @@ TSrvCfgMgr::TSrvCfgMgr(const std::string& cfgFile, const std::string& xmlFile)
 
 #ifndef MOD_DISABLE_AUTH
     AuthKeys = new KeyList();
+    AuthKeys->setLifetime(AuthLifetime);
 #endif
 
     IsDone = false;
@@ -132,11 +137,81 @@ bool TSrvCfgMgr::parseConfigFile(const std::string& cfgFile) {
     return true;
 }
 
+/**
+ * writes config dump right now (file is touched only if its content changed)
+ */
 void TSrvCfgMgr::dump() {
-    std::ofstream xmlDump;
-    xmlDump.open(this->XmlFile.c_str());
+    std::ostringstream xmlDump;
     xmlDump << *this;
-    xmlDump.close();
+    DumpFile.write(xmlDump.str());
+    DumpPending = false;
+    LastDump = now();
+}
+
+/**
+ * notes that config (or its counters) changed. Dump will be written later
+ * from the main loop, at most once per DumpInterval seconds, so message
+ * processing does not write any files.
+ */
+void TSrvCfgMgr::scheduleDump() {
+    DumpPending = true;
+}
+
+/// writes scheduled dump, if DumpInterval passed since the last one
+void TSrvCfgMgr::dumpIfDue() {
+    if (DumpPending && !getDumpTimeout())
+        dump();
+}
+
+/// returns number of seconds until scheduled dump is due
+unsigned long TSrvCfgMgr::getDumpTimeout() {
+    if (!DumpPending)
+        return DHCPV6_INFINITY;
+    unsigned long current = now();
+    if (current - LastDump >= DumpInterval)
+        return 0;
+    return DumpInterval - (current - LastDump);
+}
+
+/// prints utilization of all address classes and prefix pools (statistics)
+void TSrvCfgMgr::printStats(std::ostream & out) {
+    SPtr<TSrvCfgIface> iface;
+    SPtr<TSrvCfgAddrClass> addrClass;
+    SPtr<TSrvCfgPD> pd;
+
+    for (int size = 0; size < 2; size++) {
+        const char * name = size ? "dibbler_pool_size" : "dibbler_pool_assigned";
+        TStatsMgr::printType(out, name, "gauge", size ?
+                             "Leases available in pool (limited by class max-lease)." :
+                             "Leases assigned from pool.");
+        SrvCfgIfaceLst.first();
+        while (iface = SrvCfgIfaceLst.get()) {
+            iface->firstAddrClass();
+            while (addrClass = iface->getAddrClass()) {
+                unsigned long cnt = addrClass->getAssignedCount();
+                if (size) {
+                    cnt = addrClass->countAddrInPool();
+                    if (cnt > addrClass->getClassMaxLease())
+                        cnt = addrClass->getClassMaxLease();
+                }
+                out << name << "{iface=\"" << iface->getName() << "\",type=\"na\",class=\""
+                    << addrClass->getID() << "\"} " << cnt << endl;
+            }
+            iface->firstPD();
+            while (pd = iface->getPD()) {
+                out << name << "{iface=\"" << iface->getName() << "\",type=\"pd\",class=\""
+                    << pd->getID() << "\"} "
+                    << (size ? pd->getTotalCount() : pd->getAssignedCount()) << endl;
+            }
+        }
+    }
+
+#ifndef MOD_DISABLE_AUTH
+    if (AuthKeys) {
+        TStatsMgr::printType(out, "dibbler_auth_keys", "gauge", "Authentication keys currently known.");
+        out << "dibbler_auth_keys " << AuthKeys->count() << endl;
+    }
+#endif
 }
 
 bool TSrvCfgMgr::setGlobalOptions(SPtr<TSrvParsGlobalOpt> opt) {
@@ -146,6 +221,15 @@ bool TSrvCfgMgr::setGlobalOptions(SPtr<TSrvParsGlobalOpt> opt) {
     this->InterfaceIDOrder = opt->getInterfaceIDOrder();
     this->InactiveMode     = opt->getInactiveMode(); // should the client accept not ready interfaces?
     this->GuessMode        = opt->getGuessMode();
+    this->SolicitEarlyDrop = opt->getSolicitEarlyDrop();
+    for (int i=0; i<SRV_RATE_LIMIT_MAX; i++)
+        this->RateLimit[i] = opt->getRateLimit((ESrvRateLimit)i);
+    this->ReplicationPort     = opt->getReplicationPort();
+    this->ReplicationPeer     = opt->getReplicationPeer();
+    this->ReplicationPeerPort = opt->getReplicationPeerPort();
+    this->LeaseDumpInterval   = opt->getLeaseDumpInterval();
+    this->OfferLifetime       = opt->getOfferLifetime();
+    this->OfferLimit          = opt->getOfferLimit();
 
 #ifndef MOD_DISABLE_AUTH
     this->DigestLst        = opt->getDigest();
@@ -258,6 +342,7 @@ SPtr<TSrvCfgIface> TSrvCfgMgr::getIface() {
 
 void TSrvCfgMgr::addIface(SPtr<TSrvCfgIface> ptr) {
     SrvCfgIfaceLst.append(ptr);
+    IfaceByID.insert(std::make_pair(ptr->getID(), ptr));
 }
 
 /**
@@ -276,7 +361,9 @@ void TSrvCfgMgr::makeInactiveIface(int ifindex, bool inactive) {
 	    if (x->getID() == ifindex) {
 		Log(Info) << "Switching " << x->getFullName() << " to inactive-mode." << LogEnd;
 		SrvCfgIfaceLst.del();
+		IfaceByID.erase(ifindex);
 		InactiveLst.append(x);
+		scheduleDump();
 		return;
 	    }
 	}
@@ -293,6 +380,7 @@ void TSrvCfgMgr::makeInactiveIface(int ifindex, bool inactive) {
                 InactiveLst.del();
                 InactiveLst.first();
                 addIface(x);
+                scheduleDump();
                 return;
             }
         }
@@ -329,7 +417,8 @@ SPtr<TSrvCfgIface> TSrvCfgMgr::checkInactiveIfaces() {
     if (!InactiveLst.count())
 	return 0;
 
-    SrvIfaceMgr().redetectIfaces();
+    if (!SrvIfaceMgr().ifaceEventsActive())
+        SrvIfaceMgr().redetectIfaces(); // no notifications, we need to poll
     SPtr<TSrvCfgIface> x;
     SPtr<TIfaceIface> iface;
     InactiveLst.first();
@@ -399,13 +488,7 @@ bool TSrvCfgMgr::isIAAddrSupported(int iface, SPtr<TIPv6Addr> addr) {
     SPtr<TSrvCfgIface> ptrIface = this->getIfaceByID(iface);
     if (!ptrIface)
 	return false;
-    ptrIface->firstAddrClass();
-    SPtr<TSrvCfgAddrClass> addrClass;
-    while (addrClass = ptrIface->getAddrClass()) {
-	if (addrClass->addrInPool(addr))
-	    return true;
-    }
-    return false;
+    return ptrIface->getClassByAddr(addr);
 }
 
 /** 
@@ -415,6 +498,10 @@ bool TSrvCfgMgr::isIAAddrSupported(int iface, SPtr<TIPv6Addr> addr) {
  * - clntSupported()
  * - class-max-lease in each class
  * - assignedCount in each class
+ * - addresses currently offered (in ADVERTISE) to other clients
+ *
+ * All usage counters are updated whenever a lease is added or removed, so
+ * the lease database is not consulted here.
  * 
  * @param clntDuid 
  * @param clntAddr 
@@ -426,8 +513,7 @@ long TSrvCfgMgr::countAvailAddrs(SPtr<TDUID> clntDuid,
 				 SPtr<TIPv6Addr> clntAddr,  int iface)
 {
     /// @todo: long long long int (128bit) could come in handy
-    double avail         = 0; // how many are available?
-    double ifaceAssigned = 0; // how many are assigned on this iface?
+    double avail = 0; // how many are available?
     SPtr<TSrvCfgIface> ptrIface;
     ptrIface = this->getIfaceByID(iface);
     if (!ptrIface) {
@@ -436,25 +522,25 @@ long TSrvCfgMgr::countAvailAddrs(SPtr<TDUID> clntDuid,
     }
 
     unsigned long ifaceMaxLease = ptrIface->getIfaceMaxLease();
+    unsigned long ifaceAssigned = ptrIface->getAssignedCount()
+	+ SrvAddrMgr().getOfferedCount(iface, TAddrIA::TYPE_IA);
+    if (ifaceAssigned >= ifaceMaxLease)
+	return 0;
 
     SPtr<TSrvCfgAddrClass> ptrClass;
     ptrIface->firstAddrClass();
     while (ptrClass = ptrIface->getAddrClass()) {
 	if (!ptrClass->clntSupported(clntDuid,clntAddr))
 	    continue;
-	unsigned long classMaxLease;
-	unsigned long classAssigned;
-	double tmp;
-	classMaxLease = ptrClass->getClassMaxLease();
-	classAssigned = ptrClass->getAssignedCount();
-	tmp = classMaxLease - classAssigned;
-	ifaceAssigned += classAssigned;
-	if (tmp>0)
-	    avail += tmp;
+	unsigned long classMaxLease = ptrClass->getClassMaxLease();
+	unsigned long classAssigned = ptrClass->getAssignedCount()
+	    + SrvAddrMgr().getOfferedCount(iface, TAddrIA::TYPE_IA, ptrClass->getID());
+	if (classMaxLease > classAssigned)
+	    avail += (double)(classMaxLease - classAssigned);
     }
 
-    if (avail > (ifaceMaxLease-ifaceAssigned))
-	avail = ifaceMaxLease-ifaceAssigned;
+    if (avail > (double)(ifaceMaxLease - ifaceAssigned))
+	avail = ifaceMaxLease - ifaceAssigned;
     return (long)avail;
 }
 
@@ -468,7 +554,6 @@ long TSrvCfgMgr::countAvailAddrs(SPtr<TDUID> clntDuid,
  */
 SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> addr)
 {
-    this->firstIface();
     SPtr<TSrvCfgIface> ptrIface;
     ptrIface = this->getIfaceByID(iface);
 
@@ -477,14 +562,7 @@ SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> add
 	return 0; // NULL
     }
 
-    SPtr<TSrvCfgAddrClass> ptrClass;
-    ptrIface->firstAddrClass();
-    while (ptrClass = ptrIface->getAddrClass()) {
-	if (ptrClass->addrInPool(addr))
-	    return ptrClass;
-    }
-
-    return 0; // NULL
+    return ptrIface->getClassByAddr(addr);
 }
 
 /**
@@ -497,7 +575,6 @@ SPtr<TSrvCfgAddrClass> TSrvCfgMgr::getClassByAddr(int iface, SPtr<TIPv6Addr> add
  */
 SPtr<TSrvCfgPD> TSrvCfgMgr::getClassByPrefix(int iface, SPtr<TIPv6Addr> addr)
 {
-    this->firstIface();
     SPtr<TSrvCfgIface> ptrIface;
     ptrIface = this->getIfaceByID(iface);
 
@@ -506,14 +583,7 @@ SPtr<TSrvCfgPD> TSrvCfgMgr::getClassByPrefix(int iface, SPtr<TIPv6Addr> addr)
 	return 0;
     }
 
-    SPtr<TSrvCfgPD> ptrClass;
-    ptrIface->firstPD();
-    while (ptrClass = ptrIface->getPD()) {
-	if (ptrClass->prefixInPool(addr))
-	    return ptrClass;
-    }
-
-    return 0;
+    return ptrIface->getPDByPrefix(addr);
 }
 
 
@@ -702,15 +772,10 @@ bool TSrvCfgMgr::validateClass(SPtr<TSrvCfgIface> ptrIface, SPtr<TSrvCfgAddrClas
 }
 
 SPtr<TSrvCfgIface> TSrvCfgMgr::getIfaceByID(int iface) {
-    SPtr<TSrvCfgIface> ptrIface;
-    this->firstIface();
-    while ( ptrIface = this->getIface() ) {
-	if ( ptrIface->getID()==iface )
-	    return ptrIface;
-    }
-    Log(Error) << "Invalid interface (id=" << iface
-	       << ") specifed, cannot get address." << LogEnd;
-    return 0; // NULL
+    std::map<int, SPtr<TSrvCfgIface> >::iterator it = IfaceByID.find(iface);
+    if (it != IfaceByID.end())
+	return it->second;
+    return 0; // NULL, callers report it if it matters
 }
 
 
@@ -801,6 +866,81 @@ int TSrvCfgMgr::getCacheSize() {
     return this->CacheSize;
 }
 
+TSrvRateLimit TSrvCfgMgr::getRateLimit(ESrvRateLimit type) {
+    return RateLimit[type];
+}
+
+bool TSrvCfgMgr::solicitEarlyDrop() {
+    return SolicitEarlyDrop;
+}
+
+unsigned short TSrvCfgMgr::getReplicationPort() {
+    return ReplicationPort;
+}
+
+SPtr<TIPv6Addr> TSrvCfgMgr::getReplicationPeer() {
+    return ReplicationPeer;
+}
+
+unsigned short TSrvCfgMgr::getReplicationPeerPort() {
+    return ReplicationPeerPort;
+}
+
+/**
+ * sets worker index and splits all pools between workers, so each worker
+ * assigns leases from its own part of every pool
+ *
+ * @param index index of this worker
+ * @param count number of workers
+ */
+void TSrvCfgMgr::setWorker(int index, int count) {
+    Worker = index;
+    Workers = count;
+    if (count < 2)
+        return;
+
+    SPtr<TSrvCfgIface> iface;
+    SrvCfgIfaceLst.first();
+    while (iface = SrvCfgIfaceLst.get())
+        iface->setSlice(index, count);
+    InactiveLst.first();
+    while (iface = InactiveLst.get())
+        iface->setSlice(index, count);
+}
+
+int TSrvCfgMgr::getWorker() {
+    return Worker;
+}
+
+int TSrvCfgMgr::getWorkers() {
+    return Workers;
+}
+
+/**
+ * checks if lease belongs to this worker's part of its pool. Leases outside
+ * of all pools (e.g. pool was changed since they were assigned) belong to
+ * the first worker.
+ *
+ * @param type lease type (address or prefix)
+ * @param iface interface index
+ * @param addr address or prefix
+ *
+ * @return true if this worker should keep the lease
+ */
+bool TSrvCfgMgr::leaseInSlice(TAddrIA::TIAType type, int iface, SPtr<TIPv6Addr> addr) {
+    SPtr<TSrvCfgIface> ptrIface = getIfaceByID(iface);
+    if (ptrIface && type == TAddrIA::TYPE_PD) {
+        SPtr<TSrvCfgPD> pd = ptrIface->getPDByPrefix(addr);
+        if (pd)
+            return pd->prefixInSlice(addr);
+    } else if (ptrIface) {
+        SPtr<TSrvCfgAddrClass> addrClass = ptrIface->getClassByAddr(addr);
+        if (addrClass)
+            return addrClass->addrInSlice(addr);
+    }
+    return !Worker;
+}
+
 ESrvIfaceIdOrder TSrvCfgMgr::getInterfaceIDOrder()
 {
     return InterfaceIDOrder;
@@ -962,45 +1102,45 @@ bool TSrvCfgMgr::reconfigureSupport()
  * sets pool usage counters (used during bringup, after AddrDB is loaded from file)
  * 
  */
-void TSrvCfgMgr::setCounters()
+/**
+ * @brief increases pool usage counters for leases of a loaded client
+ *
+ * Called for every client restored from lease database, while the database
+ * is still being loaded (so SrvAddrMgr() must not be used here).
+ *
+ * @param client client restored from lease database
+ */
+void TSrvCfgMgr::setCounters(SPtr<TAddrClient> client)
 {
-    int iaCnt = 0, pdCnt = 0;
-    SrvAddrMgr().firstClient();
-    SPtr<TAddrClient> client;
     SPtr<TSrvCfgIface> iface;
-    while (client = SrvAddrMgr().getClient()) {
-	
-        // addresses
-	SPtr<TAddrIA> ia;
-	client->firstIA();
-	while ( ia=client->getIA() ) {
-	    iface = getIfaceByID(ia->getIface());
-            if (!iface)
-                continue;
-	    
-	    SPtr<TAddrAddr> addr;
-	    ia->firstAddr();
-	    while ( addr=ia->getAddr() ) {
-		iface->addClntAddr(addr->get(), true/*quiet*/);
-		iaCnt++;
-	    }
-	}
 
-        // prefixes
-        client->firstPD();
-        while (ia = client->getPD() ) {
-            iface = getIfaceByID(ia->getIface());
-            if (!iface)
-                continue;
-            SPtr<TAddrPrefix> prefix;
-            ia->firstPrefix();
-            while ( prefix=ia->getPrefix() ) {
-                iface->addClntPrefix(prefix->get(), true);
-                pdCnt++;
-            }
+    // addresses
+    SPtr<TAddrIA> ia;
+    client->firstIA();
+    while ( ia=client->getIA() ) {
+        iface = getIfaceByID(ia->getIface());
+        if (!iface)
+            continue;
+
+        SPtr<TAddrAddr> addr;
+        ia->firstAddr();
+        while ( addr=ia->getAddr() ) {
+            iface->addClntAddr(addr->get(), true/*quiet*/);
+        }
+    }
+
+    // prefixes
+    client->firstPD();
+    while (ia = client->getPD() ) {
+        iface = getIfaceByID(ia->getIface());
+        if (!iface)
+            continue;
+        SPtr<TAddrPrefix> prefix;
+        ia->firstPrefix();
+        while ( prefix=ia->getPrefix() ) {
+            iface->addClntPrefix(prefix->get(), true);
         }
     }
-    Log(Debug) << "Increased pools usage: currently " << iaCnt << " address(es) and " << pdCnt << " prefix(es) are leased." << LogEnd;
 }
 
 
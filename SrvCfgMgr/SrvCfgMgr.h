@@ -18,16 +18,20 @@ class TSrvCfgMgr;
 #include "SrvCfgIface.h"
 #include "SrvIfaceMgr.h"
 #include "CfgMgr.h"
+#include "StateFile.h"
 #include "DHCPConst.h"
 #include "Container.h"
 #include "DUID.h"
+#include "AddrIA.h"
 #include "KeyList.h"
 #include "SrvCfgClientClass.h"
+#include <map>
 
 
 #define SrvCfgMgr() (TSrvCfgMgr::instance())
 
 class SrvParser;
+class TAddrClient;
 
 class TSrvCfgMgr : public TCfgMgr
 {
@@ -50,11 +54,17 @@ public:
     SPtr<TSrvCfgIface> checkInactiveIfaces();
 
     void dump();
+    void scheduleDump();
+    void dumpIfDue();
+    unsigned long getDumpTimeout();
+    void printStats(std::ostream & out);
+    void setDumpInterval(unsigned int interval) { DumpInterval = interval; }
+    unsigned int getDumpInterval() { return DumpInterval; }
 
     bool setupRelay(SPtr<TSrvCfgIface> cfgIface);
 
     //Address assignment connected methods
-    void setCounters();
+    void setCounters(SPtr<TAddrClient> client);
     long countAvailAddrs(SPtr<TDUID> clntDuid, SPtr<TIPv6Addr> clntAddr, int iface);
     SPtr<TSrvCfgAddrClass> getClassByAddr(int iface, SPtr<TIPv6Addr> addr);
     SPtr<TSrvCfgPD> getClassByPrefix(int iface, SPtr<TIPv6Addr> prefix);
@@ -88,6 +98,20 @@ public:
     ESrvIfaceIdOrder getInterfaceIDOrder();
     int getCacheSize();
     bool reconfigureSupport();
+    TSrvRateLimit getRateLimit(ESrvRateLimit type);
+    bool solicitEarlyDrop();
+    unsigned short getReplicationPort();
+    SPtr<TIPv6Addr> getReplicationPeer();
+    unsigned short getReplicationPeerPort();
+    unsigned int getLeaseDumpInterval() { return LeaseDumpInterval; }
+    unsigned int getOfferLifetime() { return OfferLifetime; }
+    unsigned int getOfferLimit() { return OfferLimit; }
+
+    // worker processes (dibbler-server -w)
+    void setWorker(int index, int count);
+    int getWorker();
+    int getWorkers();
+    bool leaseInSlice(TAddrIA::TIAType type, int iface, SPtr<TIPv6Addr> addr);
 
     void setDDNSAddress(SPtr<TIPv6Addr> ddnsAddress);
     SPtr<TIPv6Addr> getDDNSAddress(int iface);
@@ -117,7 +141,10 @@ private:
     TSrvCfgMgr(const std::string& cfgFile, const std::string& xmlFile);
     static TSrvCfgMgr * Instance;
     static int NextRelayID;
-    std::string XmlFile;
+    TStateFile DumpFile;
+    bool DumpPending;          // config (or counters) changed since last dump
+    unsigned long LastDump;    // timestamp of the last dump
+    unsigned int DumpInterval; // min. time between dumps (in secs)
     bool reconfigure;
 
     bool IsDone;
@@ -126,6 +153,7 @@ private:
     bool validateClass(SPtr<TSrvCfgIface> ptrIface, SPtr<TSrvCfgAddrClass> ptrClass);
     List(TSrvCfgIface) SrvCfgIfaceLst;
     List(TSrvCfgIface) InactiveLst;
+    std::map<int, SPtr<TSrvCfgIface> > IfaceByID; // active interfaces, by ifindex
     List(TSrvCfgClientClass) ClientClassLst;
     bool matchParsedSystemInterfaces(SrvParser *parser);
 
@@ -134,6 +162,16 @@ private:
     bool InactiveMode;
     bool GuessMode;
     int  CacheSize;
+    TSrvRateLimit RateLimit[SRV_RATE_LIMIT_MAX];
+    bool SolicitEarlyDrop;
+    unsigned short ReplicationPort;
+    SPtr<TIPv6Addr> ReplicationPeer;
+    unsigned short ReplicationPeerPort;
+    unsigned int LeaseDumpInterval;
+    unsigned int OfferLifetime;
+    unsigned int OfferLimit;
+    int Worker;
+    int Workers;
     ESrvIfaceIdOrder InterfaceIDOrder;
     std::string ScriptName;
 
@@ -11,6 +11,10 @@
 
 #include "Logger.h"
 #include "SrvCfgOptions.h"
+#include "OptAddrLst.h"
+#include "OptDomainLst.h"
+#include "SrvOptTimeZone.h"
+#include "SrvOptLifetime.h"
 
 using namespace std;
 
@@ -55,6 +59,7 @@ void TSrvCfgOptions::SetDefaults() {
 
     ExtraOpts.clear();
     ForcedOpts.clear();
+    EncodedOpts.clear();
 }
 
 // --------------------------------------------------------------------
@@ -275,9 +280,50 @@ bool TSrvCfgOptions::setOptions(SPtr<TSrvParsGlobalOpt> opt) {
     if (opt->supportNISPDomain()) this->setNISPDomain(opt->getNISPDomain());
     if (opt->supportLifetime())   this->setLifetime(opt->getLifetime());
 
+    encodeOptions();
     return true;
 }
 
+/**
+ * Returns configured option in its final wire format or 0 if this
+ * option is not configured here. Returned object is shared between all
+ * replies, so it must not be modified.
+ */
+SPtr<TOpt> TSrvCfgOptions::getEncodedOption(int type) {
+    std::map<int, SPtr<TOpt> >::iterator it = EncodedOpts.find(type);
+    if (it == EncodedOpts.end())
+        return 0;
+    return it->second;
+}
+
+/**
+ * Encodes all configured options once, so replies only need to copy
+ * ready bytes instead of building and serializing option objects.
+ */
+void TSrvCfgOptions::encodeOptions() {
+    EncodedOpts.clear();
+
+    if (supportDNSServer())  encodeOption(new TOptAddrLst(OPTION_DNS_SERVERS, DNSServerLst, 0));
+    if (supportDomain())     encodeOption(new TOptDomainLst(OPTION_DOMAIN_LIST, DomainLst, 0));
+    if (supportNTPServer())  encodeOption(new TOptAddrLst(OPTION_SNTP_SERVERS, NTPServerLst, 0));
+    if (supportTimezone())   encodeOption(new TSrvOptTimeZone(Timezone, 0));
+    if (supportSIPServer())  encodeOption(new TOptAddrLst(OPTION_SIP_SERVER_A, SIPServerLst, 0));
+    if (supportSIPDomain())  encodeOption(new TOptDomainLst(OPTION_SIP_SERVER_D, SIPDomainLst, 0));
+    if (supportNISServer())  encodeOption(new TOptAddrLst(OPTION_NIS_SERVERS, NISServerLst, 0));
+    if (supportNISDomain())  encodeOption(new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, NISDomain, 0));
+    if (supportNISPServer()) encodeOption(new TOptAddrLst(OPTION_NISP_SERVERS, NISPServerLst, 0));
+    if (supportNISPDomain()) encodeOption(new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, NISPDomain, 0));
+    if (supportLifetime())   encodeOption(new TSrvOptLifetime(Lifetime, 0));
+}
+
+void TSrvCfgOptions::encodeOption(SPtr<TOpt> opt) {
+    int len = opt->getSize();
+    char * buf = new char[len];
+    opt->storeSelf(buf);
+    EncodedOpts[opt->getOptType()] = new TOptGeneric(opt->getOptType(), buf+4, len-4, 0);
+    delete [] buf;
+}
+
 // --------------------------------------------------------------------
 // --- operators ------------------------------------------------------
 // --------------------------------------------------------------------
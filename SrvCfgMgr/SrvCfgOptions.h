@@ -17,6 +17,7 @@
 #include <iostream>
 #include <string>
 #include <list>
+#include <map>
 
 #include "SmartPtr.h"
 #include "Container.h"
@@ -109,6 +110,9 @@ public:
     SPtr<TOpt> getExtraOption(int type);
     const TOptList& getForcedOptions();
 
+    // pre-encoded configured options (DNS, domains, NTP, ...)
+    SPtr<TOpt> getEncodedOption(int type);
+
 private:
 
     // options
@@ -143,7 +147,13 @@ private:
     TOptList ForcedOpts; // list of options that are forced to client
     unsigned int Lifetime;
 
+    /// wire-format copies of configured options, built once by encodeOptions()
+    /// and shared (read-only) by all replies
+    std::map<int, SPtr<TOpt> > EncodedOpts;
+
     void SetDefaults();
+    void encodeOptions();
+    void encodeOption(SPtr<TOpt> opt);
 
     SPtr<TOptVendorData> RemoteID;
     SPtr<TDUID> Duid;
@@ -152,6 +152,30 @@ bool TSrvCfgPD::prefixInPool(SPtr<TIPv6Addr> prefix)
     return false;
 }
 
+bool TSrvCfgPD::prefixInSlice(SPtr<TIPv6Addr> prefix)
+{
+    // no slice: server runs as a single process or pool is too small for this worker
+    if (!Slice)
+        return PD_Count && prefixInPool(prefix);
+    // common part follows pool-specific bits (see getRandomList())
+    SPtr<TIPv6Addr> common = new TIPv6Addr(CommonPool->getAddrL()->getAddr(), prefix->getAddr(),
+                                           CommonPool->getPrefixLength());
+    if (Slice->in(common))
+        return true;
+    // prefixes outside of the common section belong to the first worker
+    return !CommonPool->in(common) && *Slice->getAddrL() == *CommonPool->getAddrL();
+}
+
+void TSrvCfgPD::firstPool()
+{
+    PoolLst.first();
+}
+
+SPtr<TStationRange> TSrvCfgPD::getPool()
+{
+    return PoolLst.get();
+}
+
 /**
  * returns random prefix from a first pool
  *
@@ -159,6 +183,13 @@ bool TSrvCfgPD::prefixInPool(SPtr<TIPv6Addr> prefix)
  */
 SPtr<TIPv6Addr> TSrvCfgPD::getRandomPrefix()
 {
+    if (Slice) {
+        // only common part is split between workers
+        List(TIPv6Addr) lst = getRandomList();
+        lst.first();
+        return lst.get();
+    }
+
     SPtr<TStationRange> pool;
     PoolLst.first();
     pool = PoolLst.get();
@@ -181,12 +212,13 @@ List(TIPv6Addr) TSrvCfgPD::getRandomList() {
     List(TIPv6Addr) lst;
     lst.clear();
 
-    commonPart = this->CommonPool->getRandomPrefix();
+    SPtr<TStationRange> common = Slice ? Slice : CommonPool;
+    commonPart = common->getRandomPrefix();
     commonPart->truncate(0, this->getPD_Length());
 
     /// @todo: it's just workaround. Prefix random generation should be implemented for real.
     if (PD_Count == PD_Assigned+1) {
-      	commonPart = new TIPv6Addr(*CommonPool->getAddrR());
+      	commonPart = new TIPv6Addr(*common->getAddrR());
     }
 
     PoolLst.first();
@@ -198,6 +230,29 @@ List(TIPv6Addr) TSrvCfgPD::getRandomList() {
     return lst;
 }
 
+/**
+ * limits this worker to its part of the common section (used when server runs
+ * in several workers)
+ *
+ * @param index worker index
+ * @param count number of workers
+ */
+void TSrvCfgPD::setSlice(int index, int count)
+{
+    Slice = CommonPool->getSlice(index, count, 128 - PD_Length);
+    if (!Slice) {
+        PD_Count = 0;
+        PD_MaxLease = 0;
+        return;
+    }
+    if (PD_Count < DHCPV6_INFINITY)
+        PD_Count = (PD_Count + index) / count; // last PD_Count%count workers get one more
+    if (PD_MaxLease < DHCPV6_INFINITY) // limit is split, rounding up
+        PD_MaxLease = PD_MaxLease / count + (PD_MaxLease % count ? 1 : 0);
+    if (PD_MaxLease > PD_Count)
+        PD_MaxLease = PD_Count;
+}
+
 unsigned long TSrvCfgPD::getPD_MaxLease() {
     return PD_MaxLease;
 }
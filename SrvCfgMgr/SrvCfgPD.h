@@ -61,6 +61,10 @@ class TSrvCfgPD
 
     //checks if the prefix belongs to the pool
     bool prefixInPool(SPtr<TIPv6Addr> prefix);
+    //checks if the prefix belongs to this worker's part of the common section
+    bool prefixInSlice(SPtr<TIPv6Addr> prefix);
+    void firstPool();
+    SPtr<TStationRange> getPool();
     unsigned long countPrefixesInPool();
     SPtr<TIPv6Addr> getRandomPrefix();
     List(TIPv6Addr) getRandomList();
@@ -82,6 +86,7 @@ class TSrvCfgPD
     long decrAssigned(int count=1);
 
     bool setOptions(SPtr<TSrvParsGlobalOpt> opt, int PDPrefix);
+    void setSlice(int index, int count);
     virtual ~TSrvCfgPD();
     void mapAllowDenyList( List(TSrvCfgClientClass) clientClassLst);
 
@@ -103,6 +108,7 @@ class TSrvCfgPD
 
     List(TStationRange) PoolLst;
     SPtr<TStationRange> CommonPool; /* common part of all available prefix pools (section b in the description above) */
+    SPtr<TStationRange> Slice;      /* part of CommonPool this worker assigns from (0 = whole CommonPool) */
     unsigned long PD_MaxLease;
     unsigned long PD_Assigned;
     unsigned long PD_Count;
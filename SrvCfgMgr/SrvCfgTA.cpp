@@ -197,9 +197,27 @@ unsigned long TSrvCfgTA::countAddrInPool()
 
 SPtr<TIPv6Addr> TSrvCfgTA::getRandomAddr()
 {
+    if (Slice)
+        return Slice->getRandomAddr();
     return Pool->getRandomAddr();
 }
 
+/**
+ * limits this worker to its part of the pool (used when server runs in several workers)
+ *
+ * @param index worker index
+ * @param count number of workers
+ */
+void TSrvCfgTA::setSlice(int index, int count)
+{
+    Slice = Pool->getSlice(index, count, 0);
+    if (ClassMaxLease < DHCPV6_INFINITY) // limit is split, rounding up
+        ClassMaxLease = ClassMaxLease / count + (ClassMaxLease % count ? 1 : 0);
+    AddrsCount = Slice ? Slice->rangeCount() : 0;
+    if (ClassMaxLease > AddrsCount)
+        ClassMaxLease = AddrsCount;
+}
+
 unsigned long TSrvCfgTA::getClassMaxLease() {
     return ClassMaxLease;
 }
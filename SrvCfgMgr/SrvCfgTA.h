@@ -48,6 +48,7 @@ class TSrvCfgTA
     long decrAssigned(int count=1);
 
     void setOptions(SPtr<TSrvParsGlobalOpt> opt);
+    void setSlice(int index, int count);
     virtual ~TSrvCfgTA();
 
     void mapAllowDenyList( List(TSrvCfgClientClass) clientClassLst);
@@ -62,6 +63,7 @@ class TSrvCfgTA
     TContainer<SPtr<TStationRange> > RejedClnt;
     TContainer<SPtr<TStationRange> > AcceptClnt;
     SPtr<TStationRange> Pool;
+    SPtr<TStationRange> Slice;   // part of the pool this worker assigns from (0 = whole pool)
     unsigned long ClassMaxLease;
     unsigned long AddrsAssigned;
     unsigned long AddrsCount;
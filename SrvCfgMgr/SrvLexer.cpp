@@ -347,8 +347,8 @@ int yyFlexLexer::yywrap() { return 1; }
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 120
-#define YY_END_OF_BUFFER 121
+#define YY_NUM_RULES 133
+#define YY_END_OF_BUFFER 134
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -356,118 +356,132 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1002] =
+static yyconst flex_int16_t yy_accept[1132] =
     {   0,
-        1,    1,    0,    0,    0,    0,  121,  119,    2,    1,
-        1,  119,  101,  119,  119,  118,  118,  119,  119,  119,
-      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
-      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
-      105,  105,  120,    1,    1,    1,    0,  113,  101,    0,
-      113,  103,  102,  118,    0,    0,  117,    0,  110,   84,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-       98,  114,  114,   86,  114,  114,  114,  114,  114,  114,
-
-      114,  114,  114,  114,  114,   17,   18,  114,  114,  114,
-      114,  114,  114,  114,  114,  104,  102,  118,    0,    0,
-        0,  109,  115,  108,  108,  114,  114,  114,  114,  114,
-       85,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-       97,  118,    0,    0,    0,    0,  107,  107,    0,  108,
-        0,  108,  114,  114,  114,   64,  114,  114,  114,  114,
-
-      114,  114,  114,  114,   92,  114,  114,  114,   31,  114,
-      114,   44,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,    0,  114,  114,  114,  114,  114,  114,   24,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,   99,  114,  114,  114,  114,  118,
-        0,  116,    0,    0,    0,  107,    0,  107,    0,  108,
-      108,  108,  108,  114,  114,  114,  114,   91,  114,  114,
-      114,    4,  114,  114,  114,  114,  114,  114,  114,  100,
-      114,  114,    3,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,    0,  114,  114,  114,  114,  114,
-
-      114,  114,  114,  114,  114,    7,  114,   43,  114,   25,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,    0,    0,    0,    0,    0,  107,  107,  107,  107,
-        0,  108,  108,  108,    0,  108,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,   30,  114,  114,  114,  114,
-      114,   37,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,    0,    0,  114,
-      114,  114,   35,  114,  114,  114,  114,  114,  114,  114,
-       60,  114,  114,  114,   95,  114,  114,  114,  114,  114,
-      114,  114,    0,    0,    0,    0,  107,  107,  107,    0,
-
-      107,    0,    0,  108,  108,  108,  108,  114,  114,   33,
-      114,  114,  114,  114,  114,  114,    0,  114,  114,   94,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,    0,
-        0,  114,  114,  114,  114,  114,   58,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,   22,  114,
-      114,  114,  116,    0,    0,    0,    0,    0,  107,  107,
-      107,  107,    0,  108,  108,  108,    0,  108,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,    0,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-
-      114,  114,  114,  114,   45,  114,   54,  114,  114,   12,
-       10,   83,  114,   42,    0,    0,  114,  114,  114,   56,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,    5,  114,  114,  114,   14,    0,    0,    0,    0,
-      107,  107,  107,    0,  107,  112,  108,  108,  108,  108,
-      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,    0,  114,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,  114,  114,  114,   11,   63,
-        0,    0,  114,  114,  114,   57,  114,  114,  114,  114,
-      114,   32,  114,  114,    6,   93,   39,  114,  114,    0,
-
-        0,    0,    0,  111,  107,  107,  107,  107,  108,  108,
-      108,    0,  108,  114,  114,  114,  114,  114,  114,  114,
-      114,  114,   55,  114,    0,  114,  114,  114,  114,  114,
-      114,  114,  114,   36,  114,  114,   34,  114,  114,  114,
-       13,    0,    0,   51,   50,   38,  114,   23,  114,  114,
-      114,   41,   40,  114,  114,  116,    0,    0,  107,  107,
-      107,    0,  107,  108,  108,  108,  108,  114,   15,  114,
-       62,  114,  114,  114,   71,  114,  114,    0,  114,  114,
-      114,  114,  114,  114,   74,  114,  114,  114,  114,  114,
-      114,   53,   52,  114,  114,  114,  114,  114,   59,    0,
-
-        0,    0,    0,  107,  107,  107,  107,  108,  108,  108,
-        0,  108,  114,  114,   96,   73,  114,  114,  114,    0,
-       82,  114,  114,  114,   49,  114,   75,   61,  114,  114,
-      114,    8,  114,  114,   26,  114,  114,    0,    0,    0,
-      107,  107,  107,    0,  107,  108,  108,  108,  108,  114,
-      114,   72,  114,  114,    0,  114,  114,   48,  114,  114,
-      114,  114,   65,  114,  114,  114,  114,  114,  116,    0,
-        0,    0,  107,  107,  107,  107,  108,  108,  108,    0,
-      108,  114,  114,  114,  114,    0,  114,  114,  114,  114,
-      114,  114,  114,  114,  114,   16,   21,    0,    0,  106,
-
-      109,  107,  107,  107,    0,  107,  108,  108,  108,  108,
-      114,  114,  114,   28,    0,    0,  114,  114,  114,   76,
-      114,  114,   27,  114,  114,  114,    0,    0,  106,    0,
-      107,  107,  107,  107,  107,  108,  108,  108,    0,  108,
-      114,  114,  114,    0,    0,   29,  114,  114,   77,  114,
-      114,  114,  114,  114,  114,  114,  116,  106,  109,  107,
-        0,  107,  107,  107,  107,  108,  108,  108,   66,  114,
-      114,  114,  114,    0,    0,  114,  114,  114,  114,  114,
-      114,   47,  114,   20,  114,    0,  106,  107,  107,  107,
-      107,  108,  108,  108,  114,  114,  114,  114,  114,    0,
-
-        0,  114,  114,   78,   79,   80,   81,    9,   19,    0,
-      107,  107,    0,  107,  107,  108,   46,  114,  114,  114,
-      114,    0,    0,  114,  114,  116,  107,  107,  108,  114,
-      114,  114,  114,    0,    0,    0,  114,  114,  114,    0,
-      107,  107,    0,  114,  114,  114,  114,    0,    0,    0,
-       87,  114,  114,  114,   87,  106,  107,  107,   67,  114,
-      114,  114,    0,   89,    0,  114,   89,  114,  106,  107,
-      107,    0,  114,  114,   70,    0,   88,  114,   88,    0,
-      107,  107,  114,   68,   90,   90,    0,  107,  107,    0,
-       69,  116,  107,  107,    0,  107,  107,    0,  107,  107,
-
+        1,    1,    0,    0,    0,    0,  134,  132,    2,    1,
+        1,  132,  114,  132,  132,  131,  131,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      132,  132,  132,  132,  132,  132,  132,  132,  132,  132,
+      118,  118,  118,  133,    1,    1,    1,    0,  126,  114,
+        0,  126,  116,  115,  131,    0,    0,  130,    0,  123,
+       97,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  111,  127,  127,  127,   99,  127,  127,  127,  127,
+
+      127,  127,  127,  127,  127,  127,  127,  127,   17,   18,
+      127,  127,  127,  127,  127,  127,  127,  127,  117,    0,
+      115,  131,    0,    0,    0,  122,  128,  121,  121,  127,
+      127,  127,  127,  127,   98,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  110,
+      131,    0,    0,    0,    0,  120,  120,    0,  121,    0,
+
+      121,  127,  127,  127,   77,  127,  127,  127,  127,  127,
+      127,  127,  127,  105,  127,  127,  127,   31,  127,  127,
+      127,   44,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,    0,  127,  127,  127,  127,  127,  127,
+      127,   24,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  112,  127,
+      127,  127,  127,  131,    0,  129,    0,    0,    0,  120,
+        0,  120,    0,  121,  121,  121,  121,  127,  127,  127,
+      127,  104,  127,  127,  127,    4,  127,  127,  127,  127,
+      127,  127,  127,  127,  113,  127,  127,    3,  127,  127,
+
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+        0,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,    7,  127,  127,   43,  127,   25,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+        0,    0,    0,    0,    0,  120,  120,  120,  120,    0,
+      121,  121,  121,    0,  121,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,   30,  127,  127,  127,  127,  127,
+       37,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,    0,    0,
+      127,  127,  127,  127,   35,  127,  127,  127,  127,  127,
+
+      127,  127,  127,   69,  127,  127,  127,  127,  108,  127,
+      127,  127,  127,  127,  127,  127,    0,    0,    0,    0,
+      120,  120,  120,    0,  120,    0,    0,  121,  121,  121,
+      121,  127,  127,   33,  127,  127,  127,  127,  127,  127,
+        0,  127,  127,  107,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,    0,    0,  127,  127,
+      127,  127,  127,  127,   67,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,   22,
+      127,  127,  127,  129,    0,    0,    0,    0,    0,  120,
+
+      120,  120,  120,    0,  121,  121,  121,    0,  121,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+        0,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,   45,  127,
+       54,  127,  127,  127,   12,   10,   96,  127,   42,    0,
+        0,  127,  127,  127,  127,   65,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,    5,  127,  127,  127,   14,    0,    0,
+        0,    0,  120,  120,  120,    0,  120,  125,  121,  121,
+      121,  121,  127,  127,  127,  127,  127,  127,  127,  127,
+
+      127,  127,  127,    0,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,   11,   76,    0,    0,  127,  127,
+      127,  127,  127,   66,  127,  127,  127,  127,  127,   32,
+      127,  127,  127,  127,  127,  127,  127,  127,    6,  106,
+       39,  127,  127,    0,    0,    0,    0,  124,  120,  120,
+      120,  120,  121,  121,  121,    0,  121,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,   55,  127,    0,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,   36,  127,
+      127,  127,   34,  127,  127,  127,  127,  127,   13,    0,
+
+        0,   51,   50,   38,  127,  127,  127,   23,  127,  127,
+      127,  127,  127,  127,  127,  127,   41,   40,  127,  127,
+      127,  129,    0,    0,  120,  120,  120,    0,  120,  121,
+      121,  121,  121,  127,   15,  127,   75,  127,  127,  127,
+       84,  127,  127,    0,  127,  127,  127,  127,  127,  127,
+      127,   87,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,   53,   52,  127,   58,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,   68,    0,    0,    0,
+        0,  120,  120,  120,  120,  121,  121,  121,    0,  121,
+      127,  127,  109,   86,  127,  127,  127,    0,   95,  127,
+
+      127,  127,  127,   49,  127,   88,  127,   74,  127,  127,
+      127,  127,    8,  127,  127,  127,  127,   26,  127,  127,
+       73,  127,  127,  127,  127,  127,    0,    0,    0,  120,
+      120,  120,    0,  120,  121,  121,  121,  121,  127,  127,
+       85,  127,  127,    0,  127,  127,  127,   48,  127,  127,
+       56,  127,  127,  127,   78,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  129,    0,    0,
+        0,  120,  120,  120,  120,  121,  121,  121,    0,  121,
+      127,  127,  127,  127,    0,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,   57,  127,  127,   16,  127,
+
+      127,  127,  127,   72,  127,   21,    0,    0,  119,  122,
+      120,  120,  120,    0,  120,  121,  121,  121,  121,  127,
+      127,  127,   28,    0,    0,  127,  127,  127,  127,   89,
+      127,  127,   27,  127,  127,   60,  127,  127,  127,  127,
+      127,  127,  127,    0,    0,  119,    0,  120,  120,  120,
+      120,  120,  121,  121,  121,    0,  121,  127,  127,  127,
+        0,    0,   29,  127,  127,  127,   90,  127,  127,  127,
+      127,   61,  127,  127,  127,   64,   63,  127,  127,  127,
+      129,  119,  122,  120,    0,  120,  120,  120,  120,  121,
+      121,  121,   79,  127,  127,  127,  127,    0,    0,   59,
+
+      127,  127,  127,  127,  127,  127,   47,  127,   20,  127,
+      127,   71,  127,    0,  119,  120,  120,  120,  120,  121,
+      121,  121,  127,  127,  127,  127,  127,    0,    0,  127,
+      127,   91,   92,   93,   94,    9,   19,   70,   62,    0,
+      120,  120,    0,  120,  120,  121,   46,  127,  127,  127,
+      127,    0,    0,  127,  127,  129,  120,  120,  121,  127,
+      127,  127,  127,    0,    0,    0,  127,  127,  127,    0,
+      120,  120,    0,  127,  127,  127,  127,    0,    0,    0,
+      100,  127,  127,  127,  100,  119,  120,  120,   80,  127,
+      127,  127,    0,  102,    0,  127,  102,  127,  119,  120,
+
+      120,    0,  127,  127,   83,    0,  101,  127,  101,    0,
+      120,  120,  127,   81,  103,  103,    0,  120,  120,    0,
+       82,  129,  120,  120,    0,  120,  120,    0,  120,  120,
         0
     } ;
 
@@ -505,267 +519,275 @@ static yyconst flex_int32_t yy_ec[256] =
 
 static yyconst flex_int32_t yy_meta[76] =
     {   0,
-        1,    1,    2,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    4,    1,    3,    3,    3,    3,    3,    3,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    3,    3,    3,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int16_t yy_base[1092] =
+static yyconst flex_int16_t yy_base[1132] =
     {   0,
-        0,    0, 1132, 1131,    0,    0, 1138, 5773, 5773,   73,
-       75, 1132,    0, 1129,   72,   72,   34, 1112, 1110,  136,
-      186,  233,  280,   71,  208,  338,   38,   73,  223,   89,
-      267,  175,  275,  356,  372,  399,   67,  357,  180,  209,
-     5773, 1120, 5773,  111,  137,  222, 1095, 5773,    0, 1089,
-     1088, 5773,    0,  457, 1069,  476, 5773,    0,  502, 5773,
-       61,  545,   86,   89,  185,  208,  231,  279,  221,  265,
-      288,  559,  342,  283,  285,  388,  377,  389,  339,  395,
-      326,  410,  394,  544,  561,  469,  557,  392,  574,  507,
-      326,  542,  576,  455,  538,  584,  582,  594,  606,  462,
-
-      593,  599,  596,  629,  630,  581,  612,  614,  636,  613,
-      643,  627,  641,  645,  648, 5773,    0,  706, 1068,  725,
-     1067,  751,    0,  796,  770,  839,  649,  650,  828,  832,
-      666,  831,  837,  698,  835,  855,  704,  836,  838,  856,
-      875,  887,  886,  888,  873,  756,  876,  896,  903,  891,
-      906,  908,  923,  925,  924,  920,  961,  928,  921,  948,
-      940,  952,  953,  958,  964,  977,  960,  988,  975,  989,
-      981,  994,  993, 1010,  999, 1011, 1022, 1012, 1033, 1023,
-      738, 1091,  814, 1065, 1063, 1062, 1138, 1110,  823, 1183,
-     1226, 1157, 1269, 1010, 1204, 1024, 1027, 1091, 1205, 1044,
-
-     1257, 1143, 1267, 1256, 1032, 1260, 1261, 1274, 1125, 1266,
-     1306, 1298, 1270, 1307, 1187, 1302, 1304, 1309, 1347, 1310,
-     1318, 1299, 1069, 1343, 1322, 1351, 1358, 1353, 1356, 1342,
-     1370, 1374, 1378, 1381, 1362, 1405, 1395, 1408, 1414, 1409,
-     1398, 1402, 1403, 1406, 1399, 1430, 1439, 1443, 1447, 1203,
-     1056, 1018,  995,  984, 1505, 1516, 1559, 1535, 1578, 1604,
-     1623, 1649, 1668,  960, 1442, 1651, 1446, 1426, 1662, 1546,
-     1495, 1591, 1648, 1445, 1666, 1650, 1683, 1670, 1681, 1458,
-     1685, 1698, 1705, 1702, 1712, 1697, 1713, 1710, 1715, 1720,
-     1737, 1718, 1602, 1719, 1750, 1735, 1750, 1758, 1754, 1769,
-
-     1764, 1762, 1770, 1785, 1753, 1538, 1781, 1766, 1772, 1777,
-     1800, 1802, 1808, 1801, 1809, 1824, 1805, 1816, 1823, 1818,
-     1838,  937,  906,  905,  902, 1884, 1898, 1917, 1943, 1962,
-     1926, 1988,  899, 2000, 2043, 2019, 1979, 1837, 2031, 2037,
-     1942, 2038, 2046, 2034, 2041, 2116, 2042, 1822, 2083, 2036,
-     2043, 1885, 2093, 2087, 2098, 2099, 2088, 2101, 2106, 2110,
-     2129, 2104, 2135, 2141, 2134, 2143, 2145, 1928, 2055, 2150,
-     2152, 2154, 2121, 2140, 2170, 2162, 2189, 2190, 2157, 2192,
-     2174, 2193, 2184, 2203, 2191, 2206, 2197, 2208, 2205, 2233,
-     2235, 2226,  892,  865,  852, 2272, 2293,  851, 2305, 2348,
-
-     2324, 2367, 2393, 2404, 2423, 2449, 2468, 2470, 2449, 2326,
-     2447, 2463, 2453, 2482, 2466, 2485, 2224, 2494, 2483, 2227,
-     2499, 2335, 2529, 2500, 2497, 2513, 2534, 2535, 2530, 2533,
-     2536, 2547, 2551, 2553, 2565, 2568, 2581, 2567, 2574, 2266,
-     2349, 2596, 2582, 2584, 2588, 2598, 2383, 2606, 2603, 2626,
-     2619, 2616, 2637, 2633, 2638, 2628, 2641, 2651, 2391, 2661,
-     2650, 2656,  823,  777,  776,  775, 2719, 2730, 2741, 2760,
-     2786, 2805, 2333, 2831,  774, 2843, 2886, 2862, 2864, 2872,
-     2880, 2785, 2640, 2773, 2900, 2888, 2878, 2877, 2655, 2418,
-     2916, 2905, 2925, 2887, 2934, 2728, 2921, 2928, 2936, 2924,
-
-     2929, 2939, 2937, 2923, 2546, 2968, 2672, 2959, 2967, 2683,
-     2938, 2957, 2971, 2961, 2990, 2971, 2986, 2989, 2991, 2976,
-     2990, 3013, 3006, 3009, 3019, 3029, 3021, 3022, 3023, 3026,
-     3041, 3005, 3044, 3040, 3043, 3008,  773,  772,  770, 3102,
-     3113,  740, 3125, 3168, 3144, 3153, 3213, 3187, 3258, 3232,
-     3166, 3246, 3254, 3155, 3257, 3256, 3249, 3258, 3276, 3277,
-     3285, 3049, 3299, 3288, 3296, 3298, 3300, 3301, 3297, 3313,
-     3309, 3329, 3338, 3337, 3342, 3341, 3344, 3336, 3200, 3330,
-     3343, 3356, 3350, 3348, 3349, 3351, 3361, 3381, 3392, 3388,
-     3385, 3353, 3389, 3386, 3384, 3390, 3393, 3413, 3417,  732,
-
-      731,  730,  729, 3241, 3477, 3459, 3522, 3496, 3541,  728,
-     3567, 3610, 3586, 3396, 3596, 3604, 3601, 3605, 3588, 3624,
-     3606, 3611, 3395, 3643, 3415, 3641, 3438, 3645, 3653, 3456,
-     3658, 3652, 3656, 3475, 3668, 3675, 3509, 3672, 3657, 3659,
-     3520, 3671, 3679, 3680, 3686, 3687, 3700, 3691, 3704, 3705,
-     3708, 3696, 3697, 3710, 3725,  727,  692,  687, 3770,  686,
-     3785, 3828, 3804, 3873, 3847, 3918, 3892, 3913, 3703, 3910,
-     3724, 3807, 3912, 3860, 3727, 3738, 3922, 3795, 3909, 3917,
-     3920, 3921, 3919, 3911, 3916, 3956, 3959, 3968, 3969, 3971,
-     3972, 5773, 5773, 3967, 3970, 3961, 3964, 3974, 3963,  685,
-
-      683,  680,  673, 4034, 4053, 4079, 4098, 4124,  672, 4136,
-     4179, 4155, 4169, 4166, 3965, 3966, 4157, 4174, 4078, 3976,
-     4013, 4193, 4173, 4180, 4021, 4209, 4066, 4172, 4221, 4202,
-     4226, 4212, 4229, 4220, 4211, 4215, 4224,  671,  571,  570,
-     4287,  562, 4299, 4342, 4318, 4387, 4361, 4432, 4406, 4217,
-     4225, 4222, 4421, 4422,  570, 4340, 4419, 4223, 4428, 4436,
-     4427, 4431, 4278, 4432, 4434, 4451, 4465, 4472,  557,  556,
-      528,  525, 4532, 4551, 4577, 4596, 4622,  524, 4634, 4677,
-     4653, 4485, 4464, 4466, 4655, 4674, 4666, 4691, 4329, 4576,
-     4693, 4694, 4471, 4707, 4671, 4321, 4374,  523,  522,  521,
-
-        0, 4765,  520, 4777, 4820, 4796, 4865, 4839, 4910, 4884,
-     4679, 4878, 4564, 4467, 4483, 4524, 4912, 4807, 4680, 4637,
-     4756, 4899, 4674, 4915, 4908, 4913,  519,  518,  516,  515,
-      514, 4975, 4994, 5020, 5039, 5065,  513, 5077,    0, 5096,
-     4902, 4907, 5097, 4819, 4834, 4905, 5019, 5080, 4909, 5104,
-     4998, 5007, 5076, 5095, 5098, 4962,  512,  511, 5773,  483,
-        0, 5162,  482, 5174, 5193, 5219, 5238,    0, 4910, 5116,
-     5216, 5101, 5235, 4913, 4932, 5093, 5236, 5153, 5231, 5246,
-     5250, 5092, 5237, 5094, 5238,  481,  480,  479,  478, 5310,
-     5329, 5355,  465,    0, 5239, 5289, 5308, 5252, 5241, 5154,
-
-        0, 5312, 5382, 5161, 5240, 5288, 5309, 5323, 5341,  446,
-      445,  434,    0, 5399, 5773,    0, 5351, 5378, 5382, 5386,
-     5379,    0, 5371, 5435, 5401,  433,  431,  430, 5773, 5407,
-     5383, 5420, 5422, 5434, 5384, 5413, 5440, 5439, 5436,  428,
-      424,  406,    0, 5426, 5437, 5453, 5430, 5454, 5442, 5439,
-     5773, 5474, 5475, 5459, 5467,  395,  356,  355, 5469, 5477,
-     5481, 5472, 5477, 5773, 5502, 5487, 5483, 5510,  353,  352,
-      350,    0, 5499, 5489, 5491, 5525, 5773, 5526, 5511,  346,
-      325,  307, 5521, 5520, 5773, 5522,    0,  305,  276,    0,
-     5523,  267,  262,  260,  258,  254,  251,    0,  229,  214,
-
-     5773, 5596, 5600, 5604, 5608, 5612, 5616, 5618,  232, 5620,
-     5622, 5624, 5626, 5628, 5630, 5632, 5634, 5636, 5638, 5642,
-     5644, 5646, 5648, 5650, 5652, 5654, 5656, 5658, 5660, 5662,
-     5664, 5666, 5668, 5670, 5672, 5674, 5676, 5678, 5680, 5682,
-     5684, 5686, 5688, 5690, 5692, 5694,  231, 5696, 5698, 5700,
-      230, 5702, 5704, 5706,  228,  226, 5708, 5710, 5712,  224,
-     5716, 5720, 5722, 5724,  219,  217, 5728, 5732, 5734, 5736,
-     5738, 5740, 5742,  214, 5744, 5746, 5748, 5750, 5752,  145,
-     5754, 5756, 5758,  131, 5760,  117, 5762, 5764, 5766,   80,
-     5768
-
+        0,    0,   75,    0,  150,    0,  226, 6438, 6438,  224,
+      226,  229,  304,  379,  447,  447,  409,  285,  434,  497,
+      547,  551,  560,  433,  582,  640,  414,  548,  587,  446,
+      642,  608,  645,  455,  676,  689,  542,  566,  543,  555,
+     6438, 6438,  469, 6438,    0,    0,    0,    0, 6438,    0,
+        0,  478, 6438,  753,  816,  833,  859, 6438,  876,  893,
+     6438,    0,  936,  624,  652,  646,    0,  664,  674,  673,
+      682,  692,  909,  685,  686,  687,  696,  797,  820,  934,
+      859,  864,  889,  940,  945,  950,  944,  941,  929,  969,
+      934,    0,  938,  949,  939,    0,  476,  945,  956,  946,
+
+      979,  969,  976,  996,  982,  987, 1004,  998,    0,    0,
+      477,  988,  981,  994,  994,  993,  990,  990, 6438,    0,
+        0, 1048, 1065, 1091, 1108, 1125,    0, 1170, 1153, 1187,
+     1005,  993, 1029, 1049,    0, 1057, 1097, 1125, 1151, 1182,
+     1174, 1176, 1178, 1199,  478, 1204, 1202, 1191, 1203, 1190,
+     1196, 1192, 1209, 1219, 1214, 1219, 1220, 1215,  479, 1224,
+     1221, 1219,  481,  482, 1235, 1232, 1243, 1230, 1237, 1235,
+     1240, 1246, 1241, 1245, 1238, 1251, 1243,  485, 1253, 1243,
+     1255, 1255, 1272, 1271, 1272, 1275, 1270, 1276, 1280,    0,
+     1317, 1334, 1360, 1377, 1420, 1439, 1345, 1403, 1482, 1499,
+
+     1465, 1542, 1318, 1372,    0, 1353,  568,  570, 1415, 1409,
+     1425, 1480,  583,    0, 1463, 1479, 1490,    0,  586, 1497,
+     1511,  617, 1504, 1545, 1531, 1538, 1535, 1534,  618, 1552,
+     1548, 1549,  619,  621, 1556, 1539, 1541, 1546, 1550, 1558,
+     1552,    0, 1563, 1591, 1593, 1572, 1578, 1590, 1595, 1586,
+     1598, 1600, 1602, 1601, 1593, 1588, 1597,  623,    0, 1609,
+     1607, 1597,  624,  613,  614,  616, 1656, 1673, 1699, 1716,
+     1733, 1761,  628, 1776, 1795, 1819, 1838,  618, 1593, 1598,
+     1596,    0, 1605, 1643,  631,  632, 1636, 1664, 1821, 1695,
+     1711, 1736, 1766, 1810,    0, 1823,  633,  634, 1829, 1830,
+
+     1834, 1833, 1825, 1829, 1847, 1839, 1854,  636, 1854, 1849,
+     1854, 1844, 1855, 1856,  667, 1848, 1870, 1858, 1859, 1857,
+      668, 1856,    0, 1872, 1876,    0, 1869,    0, 1875, 1886,
+     1883, 1881, 1887, 1877, 1895, 1878, 1887,  671, 1889, 1904,
+     1945,  660, 1962, 2005,  676, 2022, 1990, 2065, 2050, 2082,
+     2110,  666, 2120, 2137, 2093,  719, 1943, 1926, 1974, 1995,
+     2034, 2114, 2101, 2123, 2192, 2123, 2227, 2237,  721, 2229,
+        0, 2234, 2236, 2246, 2238, 2239, 2231, 2234, 2254, 2243,
+     2257, 2247, 2238, 2257, 2249, 2254, 2249, 2250, 2251, 2262,
+     2255, 2251, 2252, 2285,    0, 2279, 2292, 2288, 2296, 2299,
+
+      722,  725, 2302,  726, 2291, 2287, 2286, 2302,    0, 2299,
+     2290, 2295, 2291, 2300,  727, 2304, 2351, 2368, 2411, 2163,
+     2430,  716, 2454, 2471, 2396,  730,  729, 2514, 2499, 2531,
+     2559, 2552, 2332,  743, 2326, 2379, 2433, 2453, 2479, 2512,
+     2518, 2562, 2526,    0, 2553, 2556, 2562, 2549, 2552, 2572,
+     2565, 2566, 2581, 2582, 2580, 2581, 2584, 2583, 2569, 2577,
+     2595, 2611, 2612, 2613, 2602, 2605, 2609, 2605, 2623, 2603,
+     2605, 2619, 2610, 2610,    0, 2627, 2627, 2618, 2631, 2626,
+     2616, 2661, 2638, 2618,  853, 2625, 2654, 2650, 2657,    0,
+     2663, 2654, 2656,  842,  859, 2718, 2735,  904,  901, 2778,
+
+     2763, 2795, 2823, 2838,  910,  912, 2847, 2864, 2892, 2670,
+     2662, 2663, 2678, 2668,  925, 2686, 2684, 2733, 2751, 2822,
+     2842, 2859, 2880, 2897, 2894, 2880, 2896, 2889, 2888, 2892,
+     2900, 2901, 2894, 2890, 2906, 2887, 2892,  926,    0, 2908,
+        0, 2909, 2897, 2904,    0,    0,    0, 2898,    0, 2917,
+     2897, 2911, 2916, 2917, 2943,    0, 2925,  927, 2947, 2947,
+     2939, 2941, 2950, 2946, 2956, 2943, 2939, 2952, 2953, 2958,
+     2959, 2946, 2959,    0, 2962, 2962, 2953,    0, 3006, 3023,
+     3066, 3049,  916,  917, 3083, 3126, 3111,    0, 3143, 3171,
+     3186, 3205, 3004, 2994, 3011, 3010, 3057, 3088, 3105, 3145,
+
+     3189, 3199,  930, 3191, 3205, 3183, 3188, 3195, 3195, 3196,
+     3211, 3205, 3220, 3204, 3205, 3204,  965, 3220, 1025, 3221,
+     3214, 1026, 1027, 3209,    0,    0, 3220, 3234, 3226, 3223,
+     3224, 3238, 3235,    0, 3234, 3251, 1043, 3244, 3249,    0,
+     3244, 3240, 3247, 3257, 3250, 3250, 3253, 3272,    0,    0,
+        0, 3269, 3270, 3312, 1073, 3329, 3372,    0, 3389, 3357,
+     3432, 3417, 1075, 1125, 3449, 3492, 3477, 3292, 3287, 3332,
+     3352, 3387, 3461, 3482, 3495, 3483,    0, 3489, 3498, 3484,
+     1138, 3499, 3501, 3503, 3486, 3505, 3504, 3501,    0, 3489,
+     3511, 3512,    0, 3502, 1145, 3500, 3507, 3506,    0, 3529,
+
+     3527,    0,    0,    0, 3526, 3527, 3539,    0, 3537, 3541,
+     3546, 3538, 3550, 3551, 3534, 3551,    0,    0, 3539, 3538,
+     3556, 1143, 3596, 3613, 1293, 1294, 3656, 3673, 3641, 3716,
+     3701, 3733, 3761, 3565,    0, 3580,    0, 3610, 3641, 3677,
+        0, 3694, 3735, 3727, 3731, 3755, 1307, 3754, 3755, 3751,
+     1308,    0, 3758, 3772, 3762, 3771, 3772, 3766, 3775, 3776,
+     3772, 6438, 6438, 3773,    0, 3777, 3775, 3765, 3772, 1309,
+     3779, 3767, 3784, 3775, 3779, 3783,    0, 3829, 1298, 3846,
+     3889, 3906, 3874, 3949, 3934, 1299, 1300, 3966, 4009, 3994,
+     3785, 3806,    0,    0, 3858, 3883, 3922, 3965,    0, 4003,
+
+     4004, 3999, 4006,    0, 4006,    0, 4008,    0, 4017, 4021,
+     4014, 4019, 1329, 4013, 4014, 4023, 4023,    0, 4010, 4015,
+        0, 4014, 1397, 4012, 4010, 4047, 4072, 4115, 4132, 1386,
+     1387, 4175, 4192, 4097, 4235, 4160, 4252, 4220, 4050, 4058,
+        0, 4096, 4096, 1432, 4148, 4165, 1477,    0, 4205, 4226,
+        0, 4234, 4240, 4248,    0, 4253, 4260, 4265, 4251, 4267,
+     4254, 4271, 4256, 4256, 4257, 1519, 4283, 1518, 1519, 4325,
+     4342, 4385, 4370, 4402, 4430, 1520, 1521, 4445, 4462, 4490,
+     4319, 1534, 4300, 4354, 4476, 4365, 4406, 4493, 1527, 4443,
+     4466, 4493, 4490, 4482, 4481,    0, 4493, 4483,    0, 4499,
+
+     4488, 4502, 4499,    0, 4505,    0, 4549, 4566, 4609, 4626,
+     1621, 1628, 4669, 4686, 4594, 4729, 4654, 4746, 4714, 4492,
+     4505, 1693,    0, 4511, 4532, 4578, 4634, 4656, 4687,    0,
+     1803, 4709,    0, 4726, 4749,    0, 4742, 4753, 4745, 4744,
+     4751, 4740, 4749, 4804, 1699, 4821, 1733, 4864, 4881, 4849,
+     4926, 4909, 1734, 1741, 4943, 4986, 4971, 4778, 4787, 4984,
+     4837, 4884,    0, 4905, 4925, 4955,    0, 1805, 1786, 1808,
+     4974,    0, 4989, 4990, 4983,    0,    0, 4995, 4994, 4985,
+     1803, 5041, 6438, 5058, 5101, 1910, 1911, 5118, 5086, 5161,
+     5146, 5178,    0, 4997, 4999, 5002, 5191, 5021, 5038,    0,
+
+     5056, 5097, 1917, 1916, 1919, 1922,    0, 5117,    0, 5155,
+     5152,    0, 5162, 5237, 1924, 5254, 5297, 5314, 5282, 1925,
+     1926, 5357, 5171, 5184, 5171, 5180, 5184, 5179, 5412, 5180,
+     5478,    0,    0,    0,    0,    0,    0,    0,    0, 5541,
+     1927, 5558, 5601, 1928, 6438, 5618,    0, 5231, 1941, 1942,
+     5232, 5673, 5309, 5739, 5326, 1932, 5802, 5819, 6438, 5255,
+     5335, 5350, 5525, 5553, 5540, 5560, 5613, 5574, 5613, 5862,
+     1962, 5879, 5922, 5781, 5787, 5804, 5814, 5835, 5864, 5859,
+     6438, 5894, 5882, 5883,    0, 5940, 5983, 6000,    0, 5925,
+     5922, 5936, 5937, 6438, 5999, 5987,    0, 6007, 1963, 1970,
+
+     6045, 6062, 6004, 5999,    0, 6060, 6438, 6061,    0, 6105,
+     6122, 6165, 6059,    0, 6438,    0, 6182, 2022, 6225, 6242,
+        0, 2023, 6285, 6302, 2030, 2032, 6345, 3570, 6362, 2083,
+     6438
     } ;
 
-static yyconst flex_int16_t yy_def[1092] =
+static yyconst flex_int16_t yy_def[1132] =
     {   0,
-     1001,    1, 1002, 1002, 1003, 1003, 1001, 1001, 1001, 1001,
-     1001, 1004, 1005, 1006, 1001, 1001,   16, 1001, 1001, 1001,
-       20,   20,   22,   22,   22,   22,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-     1001, 1001, 1001, 1001, 1001, 1001, 1004, 1001, 1005, 1006,
-     1001, 1001, 1007, 1001, 1008,   54, 1001, 1009, 1001, 1001,
-       26,   26,   62,   62,   62,   26,   26,   26,   26,   26,
-       62,   26,   26,   62,   62,   26,   26,   26,   26,   26,
-       62,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1001, 1007, 1001, 1010,  118,
-     1011, 1001, 1009, 1001,  124,   62,  126,  126,   26,   26,
-       26,   26,   26,  126,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26, 1001,  182, 1012, 1013, 1014, 1001,  187, 1001, 1001,
-     1001,  190,  126,  193,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26, 1001,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,  183,
-      183, 1013, 1015, 1016, 1001, 1001, 1001,  256, 1001, 1001,
-      260, 1001,  262,  193,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26, 1001,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26, 1017, 1001, 1018, 1019, 1001, 1001,  327, 1001,  329,
-     1001, 1001, 1001, 1001, 1001,  334,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1020,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1001, 1001,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26, 1021, 1022, 1023, 1001, 1001, 1001, 1001, 1001,
-
-      399, 1001, 1001, 1001,  404, 1001,  406,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1001,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1001,
-     1001,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26, 1018, 1001, 1024, 1025, 1001, 1001, 1001,  469,
-     1001,  471, 1001, 1001, 1001, 1001, 1001,  476,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1001,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26, 1001, 1001,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1026, 1027, 1028, 1001,
-     1001, 1001, 1001, 1001,  543, 1001, 1001,  547, 1001,  549,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26, 1001,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-     1001, 1001,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26, 1029,
-
-     1001, 1030, 1031, 1001, 1001,  605, 1001,  607, 1001, 1001,
-     1001, 1001,  611,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26, 1001,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26, 1001, 1001,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1032, 1033, 1034, 1001, 1001,
-     1001, 1001,  661, 1001,  664, 1001,  666,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1001,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26, 1001, 1001,   26,   26,   26,   26,   26,   26, 1035,
-
-     1001, 1036, 1037, 1001,  704, 1001,  706, 1001, 1001, 1001,
-     1001,  710,   26,   26,   26,   26,   26,   26,   26, 1001,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1038, 1039, 1040,
-     1001, 1001, 1001, 1001,  743, 1001,  746, 1001,  748,   26,
-       26,   26,   26,   26, 1001,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26,   26, 1041, 1001,
-     1042, 1043, 1001,  773, 1001,  775, 1001, 1001, 1001, 1001,
-      779,   26,   26,   26,   26, 1001,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26,   26, 1044, 1045, 1046,
-
-     1047, 1001, 1001, 1001, 1001,  804, 1001,  807, 1001,  809,
-       26,   26,   26,   26, 1001, 1001,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1048, 1001, 1049, 1001,
-     1050, 1001,  832, 1001,  834, 1001, 1001, 1001, 1051,  838,
-       26,   26,   26, 1001, 1001,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26,   26, 1052, 1053, 1001, 1054,
-     1055, 1001, 1001, 1001,  864, 1001,  866, 1056,   26,   26,
-       26,   26,   26, 1001, 1001,   26,   26,   26,   26,   26,
-       26,   26,   26,   26,   26, 1057, 1001, 1058, 1059, 1001,
-      890, 1001, 1001, 1060,   26,   26,   26,   26,   26, 1001,
-
-     1061,   26, 1062,   26,   26,   26,   26,   26,   26, 1063,
-     1001, 1064, 1065, 1001, 1001, 1066,   26,   26,   26,   26,
-       26, 1067, 1001, 1068,   26, 1069, 1070, 1071, 1001,   26,
-       26,   26,   26, 1001, 1001, 1001,   26,   26,   26, 1072,
-     1001, 1073, 1074,   26,   26,   26,   26, 1001, 1001, 1001,
-     1001,   26,   26,   26,   26, 1075, 1076, 1077,   26,   26,
-       26,   26, 1001, 1001, 1001,   26,   26,   26, 1078, 1001,
-     1079, 1080,   26,   26,   26, 1001, 1001,   26,   26, 1081,
-     1082, 1083,   26,   26, 1001,   26, 1084, 1001, 1085, 1086,
-       26, 1001, 1087, 1088, 1081, 1001, 1089, 1090, 1091, 1001,
-
-        0, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001
-
+     1131,    1, 1131,    3, 1131,    5, 1131, 1131, 1131, 1131,
+       10, 1131, 1131, 1131, 1131, 1131,   16, 1131, 1131,   16,
+       20,   21,   21,   21,   21,   21,   26,   27,   27,   27,
+       27,   27,   27,   27,   26,   27,   27,   27,   27,   27,
+     1131, 1131, 1131, 1131,   10,   11,   10,   12, 1131,   13,
+       14, 1131, 1131, 1131,   17, 1131,   55, 1131, 1131, 1131,
+     1131,   27,   21,   63,   63,   63,   27,   27,   27,   27,
+       27,   63,   27,   27,   63,   63,   27,   27,   27,   27,
+       27,   63,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+
+       27,   26,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   26,   27,   27,   27,   27,   27, 1131,   14,
+       54,   17,   56,  122, 1131, 1131,   59, 1131,  128,   63,
+      130,  130,   27,   27,   27,   27,   27,  130,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       17,  191,  125,  125,   56, 1131,  196, 1131,  128, 1131,
+
+      199,  130,  202,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27, 1131,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,  191,  192,  194,  125, 1131, 1131,  196,
+     1131,  270,  198,  128,  274,  128,  276,  202,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+     1131,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       56, 1131,  268,   56,  269,  196,  346,  196,  348, 1131,
+     1131, 1131,  276, 1131,  353,   27,   27,   27,   27,   27,
+       27,   27,   27,   27, 1131,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27, 1131, 1131,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,  268,  268, 1131, 1131,
+     1131, 1131,  348, 1131,  423,  350,  351,  276,  428,  128,
+      430,   26,   27,   27,   27,   62,   62,   30,   62,   62,
+     1131,   62,   62,   62,   39,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   67,   67,   67, 1131, 1131,   85,   92,
+       92,   92,   78,   89,   92,   83,   84,   92,   92,   92,
+       89,   89,   85,   92,   92,   91,   92,   91,   92,   92,
+       92,   91,   92,  343, 1131,  419,  123,  420,  421,  348,
+
+      500,  196,  502, 1131,  351, 1131,  430, 1131,  507,  109,
+      110,  116,  135,  115,  135,  135,  135,  118,  135,  135,
+     1131,  135,  135,  135,  135,  135,  135,  135,  134,  135,
+      135,  135,  135,  135,  135,  190,  141,  145,  190,  140,
+      190,  144,  177,  168,  190,  190,  190,  150,  190, 1131,
+     1131,  155,  156,  156,  169,  190,  190,  159,  160,  188,
+      190,  168,  188,  166,  172,  173,  190,  170,  170,  171,
+      171,  182,  190,  190,  184,  190,  190,  190,  195,  419,
+     1131, 1131,  421, 1131,  502, 1131,  585,  504,  430,  589,
+      199,  591,  205,  205,  205,  205,  205,  205,  205,  205,
+
+      205,  205,  205, 1131,  205,  214,  214,  211,  214,  214,
+      212,  214,  214,  214,  218,  218,  218,  218,  219,  221,
+      242,  222,  229,  236,  242,  242, 1131, 1131,  242,  237,
+      237,  240,  242,  242,  239,  240,  242,  242,  242,  242,
+      241,  242,  255,  249,  259,  255,  259,  259,  259,  259,
+      259,  254,  254,  419, 1131,  581,  341,  582,  502,  659,
+      270,  661,  351, 1131,  591, 1131,  665,  281,  282,  282,
+      281,  281,  282,  282,  282,  282,  282,  282, 1131,  281,
+      282,  282,  295,  295,  295,  295,  291,  288,  295,  295,
+      295,  295,  295,  295,  295,  304,  299,  323,  323, 1131,
+
+     1131,  323,  323,  323,  322,  322,  323,  323,  323,  323,
+      313,  316,  323,  323,  323,  323,  323,  323,  320,  322,
+      323,  496,  581, 1131,  421, 1131,  661, 1131,  727,  591,
+      730,  351,  732,  359,  371,  371,  371,  371,  366,  364,
+      371,  371,  359, 1131,  358,  371,  356,  371,  371,  371,
+      356,  371,  366,  357,  371,  371,  359,  371,  371,  371,
+      368, 1131, 1131,  368,  371,  371,  368,  371,  371,  369,
+      371,  371,  371,  387,  382,  386,  395,  497, 1131,  724,
+      497,  661,  782,  421,  784,  427, 1131,  732, 1131,  788,
+      395,  395,  395,  395,  395,  395,  395, 1131,  409,  408,
+
+      409,  406,  409,  409,  405,  409,  409,  409,  409,  409,
+      409,  444,  415,  444,  444,  444,  436,  444,  437,  444,
+      444,  433,  434,  444,  435,  444,  581,  724, 1131,  499,
+     1131,  784, 1131,  832,  732,  835,  505,  837,  444,  444,
+      444,  444,  444, 1131,  444,  444,  475,  475,  475,  475,
+      475,  465,  473,  475,  475,  460,  472,  456,  459,  458,
+      473,  460,  465,  473,  474,  475,  475,  656, 1131,  829,
+     1131,  784,  872,  499,  874,  505, 1131,  837, 1131,  878,
+      490,  485,  490,  490, 1131,  486,  490,  486,  490,  490,
+      490,  490,  491,  493,  526,  539,  539,  526,  539,  510,
+
+      539,  510,  539,  539,  535,  539,  579,  829, 1131, 1131,
+      583, 1131,  874, 1131,  913,  837,  916,  589,  918,  539,
+      539,  538,  539, 1131, 1131,  525,  539,  530,  539,  539,
+      539,  534,  539,  537,  535,  539,  539,  539,  539,  539,
+      539,  541,  541,  724, 1131,  909, 1131, 1131,  874,  949,
+     1131,  951,  663, 1131,  918, 1131,  955,  556,  574,  561,
+     1131, 1131,  574,  574,  565,  570,  574,  574,  574,  574,
+      572,  574,  571,  574,  574,  574,  578,  578,  578,  578,
+      780,  909, 1131,  948, 1131,  583, 1131,  951,  988,  918,
+      990, 1131,  625,  625,  625,  593,  597, 1131, 1131,  625,
+
+      624,  625,  625,  625,  625,  625,  625,  614,  625,  618,
+      625,  625,  625,  657, 1131,  948, 1131,  951, 1018,  663,
+     1131, 1131,  625,  625,  625,  625,  625, 1131, 1131,  634,
+     1029,  634,  634,  634,  634,  634,  634,  640,  640,  829,
+     1131, 1017, 1131,  725, 1131, 1131,  649,  644,  649,  649,
+      649, 1131, 1131, 1052,  651,  870, 1017, 1131, 1131,  677,
+      677,  677,  677, 1131, 1131, 1131,  673,  677,  670,  871,
+     1131, 1058, 1131,  677,  677,  677,  677, 1131, 1131, 1131,
+     1131,  677,  677,  689,  689,  909, 1058, 1131,  689,  689,
+      689,  689, 1131, 1131, 1131,  689,  693,  691,  946, 1131,
+
+     1088, 1131,  699,  699,  699, 1131, 1131,  702,  702,  947,
+     1088, 1131,  708,  708, 1131,  708, 1131, 1131, 1112, 1131,
+      717, 1131, 1112, 1131, 1110, 1131, 1124,  914, 1124, 1131,
+        0
     } ;
 
-static yyconst flex_int16_t yy_nxt[5849] =
+static yyconst flex_int16_t yy_nxt[6514] =
     {   0,
         8,    9,   10,   11,   12,   13,   14,    8,    8,    8,
         8,   15,   16,   17,   17,   17,   17,   17,   17,   17,
@@ -774,645 +796,719 @@ static yyconst flex_int16_t yy_nxt[5849] =
        34,   35,   36,   37,   38,   39,   27,   40,   27,   20,
        21,   22,   23,   24,   25,   26,   27,   28,   27,   27,
        29,   30,   31,   32,   33,   27,   34,   35,   36,   37,
-       38,   39,   27,   40,   27,   44,   45,   46,   45,   52,
-     1001,   61,  835,   53,   54,   54,   54,   54,   54,   54,
-       54,   54,   54,   55,   62,   56,   56,   56,   56,   56,
-
-       56,   84,   57,  111,   61,   61, 1001,   61,   61,   85,
-       61,  127,   88,   44,   45,  128,   61,   80,   58,  994,
-       62,   56,   56,   56,   56,   56,   56,   84,   57,  111,
-       61,   61,   61,  992,   61,   85,   61,  127,   88,   46,
-       45,  128,   61,   80,   58,   61,   61,  982,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   55,   61,   62,
-       62,   63,   64,   62,   65,   61,   66,   61,   61,   61,
-       67,   61,   68,   61,   61,   61,   61,   61,   61,   69,
-       61,   61,   61,   61,   61,   62,   62,   63,   64,   62,
-       65,   61,   66,   61,   61,   61,   67,   61,   68,   61,
-
-       61,   61,   61,   61,   61,   69,   61,   61,   61,   61,
-       61,   62,   62,   93,   62,   94,  958,  114,   61,  929,
-       61,  928,   61,   61,   44,   45,  916,  129,  894,   70,
-      889,   81,  868,  831,  123,  998,  115,   62,   62,   93,
-       62,   94,   61,  114,   61,   61,   61,   82,   61,   61,
-      998,   61,   61,  129,   86,   70,   71,   81,   62,   62,
-       87,   62,  115,  132,   61,  130,   61,   72,   61,   61,
-       73,   61,  998,   82,   61,  990,   61,   61,   61, 1001,
-       86,  998,   71,  990,   62,   62,   87,   62,  995,  132,
-       61,  130,   61,   72,   89,   61,   73,  990,   90,  133,
-
-       61,   95,   61,   62,   91,  131,   74,   75,   61,   92,
-       61,   76,   96,  134,   61,   97,   77,   78,   61,  138,
-       89,  139,   61,   79,   90,  133,  972,   95,  990,   62,
-       91,  131,   74,   75,   61,   92,   61,   76,   96,  134,
-       61,   97,   77,   78,   61,  138,  972,  139,   61,   79,
-       61,   61,   61,   61,   61,   61,   61,   61,   61, 1001,
-      145,   61,   61,   61,   61,   61,   61,  859,   61,   61,
-      143,  972,   61,  943,  980,   61,  972,  943,  137,   98,
-      112,   83,   61,   99,  113,   61,  145,   61,   61,   61,
-       61,   61,   61,  100,   61,   61,  143,  101,   61,   61,
-
-       61,   61,  102,  103,  137,   98,  112,   83,   61,   99,
-      113,   61,  106,  107,  104,  105,  830,  140,  141,  100,
-       61,  147,  108,  101,  142,   61,   61,  943,  102,  103,
-      109,   61,   61,  144,  154,   61,  146,   61,   61,  110,
-      104,  105,   61,  140,  141,  913,   61,  147,  108,  801,
-      142,  943,  913,   61,  940,  913,  109,   61,   61,  144,
-      154,   61,  146,   61,   61,  110,  861,  772,   61,  118,
-      118,  118,  118,  118,  118,  118,  118,  118,  119,   61,
-      120,  120,  120,  120,  120,  120,  839,   57,  120,  120,
-      120,  120,  120,  120,  120,  120,  120,  152,   61,  913,
-
-      861,  830,  122,  805,  861,  167,  120,  120,  120,  120,
-      120,  120,   61,   57,  124,  124,  124,  124,  124,  124,
-      124,  124,  124,  152,   61,  125,  125,  125,  125,  125,
-      125,  167,  830,  886,  780,  861,  859,  830,   61,  772,
-      703,  744,  830,  772,  122,  711,  801,  160,  157,  772,
-       61,  125,  125,  125,  125,  125,  125,  126,  126,  126,
-      126,  126,  126,  126,  126,  126,  119,  148,  126,  126,
-      126,  126,  126,  126,  157,   66,   61,  703,  798,  786,
-      158,   61,  135,  662,  149,   61,  153,   61,   61,  150,
-      136,  772,  703,  148,  126,  126,  126,  126,  126,  126,
-
-       61,   66,   61,  151,   61,  155,  158,   61,  135,  162,
-      149,   61,  153,   61,   61,  150,  136,   61,  159,   61,
-      156,  161,  169,  174,   61,   61,   61,   61,   61,  151,
-       61,  155,  163,  168,  170,  162,   61,   61,  164,   61,
-      165,  166,   61,   61,  159,   61,  156,  161,  169,   61,
-       61,   61,  171,   61,  173,   61,  176,   61,  163,  168,
-      170,  178,   61,   61,  164,   61,  165,  166,   61,  172,
-       61,  175,   61,   61,  177,   61,  194,  179,  171,   61,
-      173,   61,  176,   61,   61,  180,   61,  178,   61,  181,
-      195,   61,  603,  612,  122,  172,   61,  175,   61,   61,
-
-      177,  703,  194,  179,  603,   61,  122,  544,  703,   61,
-       61,  180,   61,  603,   61,  181,  195,   61,  182,  182,
-      182,  182,  182,  182,  182,  182,  182,   55,  200,  183,
-      183,  183,  183,  183,  183,   61,   57,  183,  183,  183,
-      183,  183,  183,  183,  183,  183,  203,   61,  700,  477,
-      122,  603,  466,  466,  200,  183,  183,  183,  183,  183,
-      183,  400,   57,  187,  187,  187,  187,  187,  187,  187,
-      187,  187,  203,   61,  188,  188,  188,  188,  188,  188,
-     1001,   61,  192,  192,  192,  192,  192,  192,  192,  192,
-      192,  603,  212,  466,  122,  335,  122,  466,  325,   61,
-
-      188,  188,  188,  188,  188,  188,  189,   61,  190,  190,
-      190,  190,  190,  190,  190,  190,  190,  191,  212,  192,
-      192,  192,  192,  192,  192,   61,  251,  251,  251,  251,
-      251,  251,  251,  251,  251,  259,  259,  259,  259,  259,
-      259,  259,  259,  259,  537,  192,  192,  192,  192,  192,
-      192,  193,  193,  193,  193,  193,  193,  193,  193,  193,
-       55,  198,  193,  193,  193,  193,  193,  193,  196,  197,
-      199,   61,  257,  466,   61,   61,  201,  204,   61,   61,
-       61,   61,  202,  206,  207,  205,  325,  198,  193,  193,
-      193,  193,  193,  193,  196,  197,  199,   61,   61,   61,
-
-       61,   61,  201,  204,   61,   61,   61,   61,  202,  206,
-      208,  205,  209,  325,  211,  210,   61,  213,   61,   61,
-      191,  214,  216,  122,   61,   61,  325,  186,  215,   61,
-       61,   61,  219,  217,   61,  218,  208,  225,  209,   61,
-      211,  210,   61,  213,   61,   61,   61,  214,  216,   61,
-      220,   61,  226,  221,  215,   61,   61,   61,  122,  217,
-       61,  218,  222,   61,   61,   61,   61,   61,   61,  223,
-      224,   61,   61,  227,  230,   61,  220,   61,  226,  221,
-      231, 1001,  228,   61,  232,  233,  229,  234,  222,   61,
-       61,   61,   61,   61,   61,   61,   61,   61,  239,  227,
-
-      230,   61,  236,   61,   61,  325,  231,   61,  228,   61,
-      232,  233,  229,  234,  235,  238,  186,   61,   61,  237,
-       61,   61,   61,  240,   61,  241,  244,   61,  236,   61,
-       61,   61,   61,   61,  242,  243,   61,   61,  245,  322,
-      235,  238,   61,  247,   61,  237,   61,  246,  265,  240,
-       61,  241,  244,   61,   61,   61,  249,   61,   61,  248,
-      242,  243,   61,   61,  245,   61,   61,   61,   61,  247,
-       61,  271,  268,  246,  265,   61,   61, 1001,  295,   61,
-       61,   61,  249,  122,  186,  248,  186,   61,  186,  122,
-      122,   61,   61,   61,   50,   51,   61,  271,  268,   48,
-
-      269,   61,   61,  250,  250,  250,  250,  250,  250,  250,
-      250,  250,   55,   61,  251,  251,  251,  251,  251,  251,
-     1001,   57,  258,  258,  258,  258,  258,  258,  258,  258,
-      258,  116,   60,   59,   61,   51,   48, 1001,   42,   42,
-      251,  251,  251,  251,  251,  251, 1001,   57,  255, 1001,
-      256,  256,  256,  256,  256,  256,  256,  256,  256,  257,
-       61,  258,  258,  258,  258,  258,  258, 1001,   61,  261,
-      261,  261,  261,  261,  261,  261,  261,  261, 1001,  273,
-     1001, 1001, 1001, 1001, 1001, 1001,   61,  258,  258,  258,
-      258,  258,  258,  189,   61,  260,  260,  260,  260,  260,
-
-      260,  260,  260,  260,  191,  273,  261,  261,  261,  261,
-      261,  261,   61,  266,  270,  250,  250,  250,  250,  250,
-      250,  250,  250,  250, 1001, 1001, 1001, 1001, 1001,  284,
-       61,  267,  261,  261,  261,  261,  261,  261,  262,  262,
-      262,  262,  262,  262,  262,  262,  262,   61,   61,  263,
-      263,  263,  263,  263,  263,  284,   61,  267, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001,  275, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001,   61,   61,  263,  263,  263,  263,  263,
-      263,  264,  264,  264,  264,  264,  264,  264,  264,  264,
-      274, 1001,  264,  264,  264,  264,  264,  264,  272,   61,
-
-       61,  276,  277,   61,   61,  278,  279,  281,  294,   61,
-       61,  282, 1001,   61, 1001, 1001,  274,   61,  264,  264,
-      264,  264,  264,  264,  272,   61,   61,  276,  277,   61,
-       61,  278,  279,  280,  283,   61,   61,  282,  285,   61,
-      292,   61,   61,   61,  286,   61, 1001,   61,  293,   61,
-       61,  287,   61,   61, 1001, 1001, 1001, 1001, 1001,  280,
-      283,   61, 1001,  298,  285,   61,  292,   61,   61,  296,
-      286,   61,  288,   61,  293,   61,   61,  287,   61,   61,
-      301,  289,  290,  291,  297,   61,   61,   61,  299,  298,
-       61,   61,  300,  302,   61,  296,   61,  303,  288,   61,
-
-      304,   61, 1001,  305,  307,   61,  301,  289,  290,  291,
-      297,   61,   61,   61,  299,  317,   61,   61,  300,  302,
-       61,   61,   61,  303,   61,   61,  304,   61,  306,  305,
-      307,   61,  308,  309,  314,  310,  313,  316,   61,   61,
-      311,   61,   61,   61,  315,   61,   61,   61,   61,   61,
-       61,   61,   61,  318,  306,  312,  321,   61,  308,  309,
-      314,  310,  313,  316,   61,  319,  311,   61,   61,   61,
-      315,   61,   61,   61,   61,   61,  347,   61,   61,  318,
-      320,  312,   61,   61,  337,   61,   61,  339,   61,   61,
-       61,  319, 1001, 1001, 1001,   61, 1001, 1001, 1001,   61,
-
-     1001,   61,  347, 1001,  344, 1001,  320, 1001,   61, 1001,
-      337,   61,   61,  339,   61,   61,   61,  326,  326,  326,
-      326,  326,  326,  326,  326,  326,  255,   61,  327,  327,
-      327,  327,  327,  327,  327,  327,  327,  257,   61,  328,
-      328,  328,  328,  328,  328, 1001, 1001,  328,  328,  328,
-      328,  328,  328,  328,  328,  328, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001,   61,  328,  328,  328,  328,  328,
-      328,  329,  329,  329,  329,  329,  329,  329,  329,  329,
-      343,   61,  330,  330,  330,  330,  330,  330,  331,   61,
-      259,  259,  259,  259,  259,  259,  259,  259,  259, 1001,
-
-      345, 1001, 1001, 1001, 1001, 1001,  343,   61,  330,  330,
-      330,  330,  330,  330,  189,   61,  332,  332,  332,  332,
-      332,  332,  332,  332,  332,  191,  366,  333,  333,  333,
-      333,  333,  333, 1001,   61,  333,  333,  333,  333,  333,
-      333,  333,  333,  333, 1001,   61, 1001, 1001, 1001, 1001,
-     1001, 1001,  366,  333,  333,  333,  333,  333,  333,  189,
-       61,  334,  334,  334,  334,  334,  334,  334,  334,  334,
-      335,   61,  336,  336,  336,  336,  336,  336, 1001, 1001,
-      336,  336,  336,  336,  336,  336,  336,  336,  336,  338,
-      346,   61,  350,   61,   61,  340,  341,  342,  336,  336,
-
-      336,  336,  336,  336,  348,   61,  352,  355,  349,   61,
-      351,  354,  353,   61,  356,  338,  346,   61,  350,   61,
-       61,  340,  341,  342,   61,  359,   61,  365,   61, 1001,
-      348,   61,  352,  357,  349,   61,  351,  354,  353,   61,
-       61,   61,  362,  358,  360,   61, 1001,  361,   61,  367,
-       61,  359,   61,   61,   61,   61,   61,  363,   61,  357,
-      364,   61,   61,   61, 1001, 1001,   61,   61,  362,  358,
-      360,   61,  370,  361,   61,  367,  368,  371,   61,   61,
-       61,   61,   61,  363,   61,  372,  364,   61,   61,   61,
-      373,  369,  374,   61,  378,  379,   61,   61,  370,  376,
-
-      375,   61,  368,  371,   61,   61,   61,   61,  380,   61,
-      377,  372,   61,   61,  381,   61,  373,  369,  374,   61,
-       61,  379,   61,   61,   61,  376,  375,   61,   61,  383,
-      385,   61,  390,   61,  380,   61,  377,  382,   61,   61,
-      381,   61,  384,   61,   61,   61,   61,  387,   61,  386,
-       61,   61,   61,  388,   61,  383,  385,  389,  391,   61,
-      409,   61,  421,  382,  392,   61,   61,   61,  384,   61,
-       61,   61, 1001,  387,   61,  386, 1001,   61,   61,  388,
-       61,   61, 1001,  389,  391,   61,  409,   61,  421, 1001,
-      392,   61,   61,   61,  396, 1001,  326,  326,  326,  326,
-
-      326,  326,  326,  326,  326, 1001,   61,   61,  255, 1001,
-      397,  397,  397,  397,  397,  397,  397,  397,  397,  257,
-     1001,  398,  398,  398,  398,  398,  398, 1001,   61,  398,
-      398,  398,  398,  398,  398,  398,  398,  398,  402,  402,
-      402,  402,  402,  402,  402,  402,  402,  398,  398,  398,
-      398,  398,  398,  255,   61,  399,  399,  399,  399,  399,
-      399,  399,  399,  399,  400,  440,  401,  401,  401,  401,
-      401,  401, 1001,  412,  401,  401,  401,  401,  401,  401,
-      401,  401,  401, 1001, 1001,   61, 1001, 1001,  408, 1001,
-     1001,  440,  401,  401,  401,  401,  401,  401,  189,  412,
-
-      403,  403,  403,  403,  403,  403,  403,  403,  403,  191,
-      189,   61,  404,  404,  404,  404,  404,  404,  404,  404,
-      404,  335,   61,  405,  405,  405,  405,  405,  405, 1001,
-     1001,  405,  405,  405,  405,  405,  405,  405,  405,  405,
-     1001, 1001, 1001, 1001, 1001,  423, 1001, 1001,   61,  405,
-      405,  405,  405,  405,  405,  406,  406,  406,  406,  406,
-      406,  406,  406,  406,  411,  413,  407,  407,  407,  407,
-      407,  407,  410,  414,   61,  415,  416,   61,  420,   61,
-       61,   61,  441,  424,   61,   61,   61, 1001, 1001,   61,
-      411,  413,  407,  407,  407,  407,  407,  407,  410,  414,
-
-       61,  415,  416,   61,  420,   61,   61,   61,  441,  424,
-       61,   61,   61,  426,  422,   61,  417,  417, 1001,  417,
-      417,  417,  417,  417,  417,  418,   61,  417,  425,  431,
-       61,   61,  429,  427,  428, 1001,   61,  417,  417,  426,
-      422,   61,   61,  430,   61,  432, 1001,   61,  434,   61,
-     1001, 1001,   61,   61,  425,  431,   61,   61,  429,  427,
-      428,  435,   61,  433,   61,  437,  451,   61,   61,  430,
-       61,  432,   61,   61,  434,   61,  436,   61,   61,   61,
-      438,  445,  439,   61,   61,  442,   61,  435,   61,  433,
-       61,  437,  443,   61,  444,   61,  447,   61,   61,  446,
-
-       61,  452,  436,   61,   61,   61,  438,  445,  439,   61,
-       61,  442,   61,   61,   61,  450,  448,   61,  443,   61,
-      444,   61,  447,   61,  454,  446,   61,   61,  453,  449,
-      455,   61,   61,   61,   61,   61,   61,  456,  457,   61,
-       61,  450,  448,   61,  461,  458,   61,  459,   61,   61,
-      454,   61, 1001,   61,  453,  449,  455,  462,   61,   61,
-       61,   61,   61,  456,  457, 1001,   61,  460,  490,   61,
-       61,  458,   61,  459,   61,   61,   61,   61,   61, 1001,
-     1001, 1001, 1001,  462,  467,  467,  467,  467,  467,  467,
-      467,  467,  467,  460,  490,   61,   61, 1001, 1001, 1001,
-
-     1001,  515,   61,  255,   61,  468,  468,  468,  468,  468,
-      468,  468,  468,  468,  257,  255, 1001,  469,  469,  469,
-      469,  469,  469,  469,  469,  469,  400,  515,  470,  470,
-      470,  470,  470,  470, 1001,  483,  470,  470,  470,  470,
-      470,  470,  470,  470,  470,  546,  546,  546,  546,  546,
-      546,  546,  546,  546,  470,  470,  470,  470,  470,  470,
-      471,  471,  471,  471,  471,  471,  471,  471,  471,   61,
-      495,  472,  472,  472,  472,  472,  472,  473,   61,  402,
-      402,  402,  402,  402,  402,  402,  402,  402, 1001,  516,
-     1001, 1001, 1001, 1001, 1001,   61,  495,  472,  472,  472,
-
-      472,  472,  472,  189,   61,  403,  403,  403,  403,  403,
-      403,  403,  403,  403,  189,  516,  474,  474,  474,  474,
-      474,  474,  474,  474,  474,  335,   61,  475,  475,  475,
-      475,  475,  475, 1001,   61,  475,  475,  475,  475,  475,
-      475,  475,  475,  475, 1001,  562, 1001, 1001, 1001, 1001,
-     1001, 1001,   61,  475,  475,  475,  475,  475,  475,  189,
-       61,  476,  476,  476,  476,  476,  476,  476,  476,  476,
-      477,  562,  478,  478,  478,  478,  478,  478, 1001, 1001,
-      478,  478,  478,  478,  478,  478,  478,  478,  478,  482,
-       61,  485,   61, 1001,  484,  486,   61,  488,  478,  478,
-
-      478,  478,  478,  478,  479,  487,   61,  480,  489,   61,
-     1001, 1001, 1001,  481, 1001,  482,   61,  485,   61,  491,
-      484,  486,   61,  488,  500,   61,   61,  493,   61,  492,
-      479,  487,   61,  480,  489,   61,  494,   61,  493,  481,
-       61, 1001,   61,   61,  499,  491, 1001, 1001, 1001,  501,
-      500,   61,   61,  493,   61,  492,   61,  504,  503,  496,
-      505,  506,  494,   61,  493,  497,   61,  498,   61,   61,
-      499,  502,   61,   61,  507,  501,   61,   61,   61,   61,
-      509, 1001,   61,  504,  503,  496,  505,  506,  508,   61,
-       61,  497,  510,  498,   61,  511,   61,  502,   61,   61,
-
-      507, 1001,   61,   61,   61,   61,  509,  513,   61,  512,
-       61,   61,  514, 1001,  508,   61,   61,   61,  510,  517,
-       61,  511,   61, 1001,   61,   61,  518,   61,  519,  520,
-      524,   61,  522,  513,   61,  512,   61,   61,  514,   61,
-      521,   61,  523,   61,  526,  517,   61,  527, 1001,   61,
-       61,   61,  518,   61,  519,  520,  524,   61,  522,   61,
-      528, 1001,   61,  525,  531,   61,  521,   61,  523,   61,
-      526,   61,   61,  527,  555,   61,   61,  529, 1001,  530,
-       61,   61,  532,   61,   61,   61,  528,  533,   61,  525,
-      531,  535,  534,   61,   61,   61,  536,   61,   61,   61,
-
-      555,  561,   61,  529,   61,  530,   61,   61,  532,   61,
-       61, 1001, 1001,  533, 1001,   61, 1001,  535,  534,   61,
-       61, 1001,  536, 1001,   61,   61,   61,  561, 1001,  540,
-       61,  467,  467,  467,  467,  467,  467,  467,  467,  467,
-      255,   61,  468,  468,  468,  468,  468,  468,  468,  468,
-      468,  255,   61,  541,  541,  541,  541,  541,  541,  541,
-      541,  541,  400,  568,  542,  542,  542,  542,  542,  542,
-     1001,   61,  542,  542,  542,  542,  542,  542,  542,  542,
-      542, 1001,  556, 1001, 1001, 1001, 1001, 1001, 1001,  568,
-      542,  542,  542,  542,  542,  542,  255,   61,  543,  543,
-
-      543,  543,  543,  543,  543,  543,  543,  544,  554,  545,
-      545,  545,  545,  545,  545, 1001,   61,  545,  545,  545,
-      545,  545,  545,  545,  545,  545, 1001, 1001,   61, 1001,
-     1001, 1001, 1001, 1001,  554,  545,  545,  545,  545,  545,
-      545,  189,   61,  403,  403,  403,  403,  403,  403,  403,
-      403,  403,  335,  189,   61,  547,  547,  547,  547,  547,
-      547,  547,  547,  547,  477, 1001,  548,  548,  548,  548,
-      548,  548, 1001, 1001,  548,  548,  548,  548,  548,  548,
-      548,  548,  548, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001,  551,  548,  548,  548,  548,  548,  548,  549,  549,
-
-      549,  549,  549,  549,  549,  549,  549,   61,  552,  550,
-      550,  550,  550,  550,  550,   61,  553,  551,  558,  559,
-       61,   61, 1001,   61, 1001,  560, 1001,  557,  564,  566,
-       61,   61,  576,   61,  552,  550,  550,  550,  550,  550,
-      550,   61,  553,   61,  558,  559,   61,   61,   61,   61,
-      563,  560,  565,  557,  564,  566,   61,   61,  569,   61,
-      572,  567,  570,  571,   61,  574,   61,   61,   61,   61,
-      573,   61,   61, 1001,   61, 1001,  563,   61,  565,   61,
-       61,   61,   61,  575,  569,   61,  572,  567,  570,  571,
-       61,  574,   61,   61,   61,  577,  573,   61,   61,  578,
-
-       61,  579,   61,   61,   61,   61,   61,   61,   61,  575,
-       61,   61,  580,  581,   61,  582,  584,  583,  585,   61,
-      586,  577,  587, 1001, 1001,  578,   61,  579,   61,   61,
-       61,  588,   61,   61,   61,  589,   61,   61,  580,  581,
-       61,  582,  584,  583,  585,   61,  586,  592,   61,   61,
-      594,   61,   61,  593,  590,   61,   61,  588,   61,   61,
-       61,  589,   61,  591,   61,   61,   61,  595,  598,   61,
-      596,  597,   61,  592,   61,   61,  594,   61,   61,  593,
-      590,  599,   61,   61,   61,  625,   61,   61,   61,  591,
-       61,   61,   61,  595,  598,   61,  596,  597,   61, 1001,
-
-     1001, 1001, 1001, 1001, 1001, 1001, 1001,  599, 1001,   61,
-       61,  625,   61,   61,  604,  604,  604,  604,  604,  604,
-      604,  604,  604,  255, 1001,  468,  468,  468,  468,  468,
-      468,  468,  468,  468,  400,  255, 1001,  605,  605,  605,
-      605,  605,  605,  605,  605,  605,  544, 1001,  606,  606,
-      606,  606,  606,  606, 1001, 1001,  606,  606,  606,  606,
-      606,  606,  606,  606,  606,  546,  546,  546,  546,  546,
-      546,  546,  546,  546,  606,  606,  606,  606,  606,  606,
-      607,  607,  607,  607,  607,  607,  607,  607,  607,  614,
-      617,  608,  608,  608,  608,  608,  608, 1001,   61,  610,
-
-      610,  610,  610,  610,  610,  610,  610,  610, 1001,   61,
-     1001, 1001, 1001, 1001, 1001,  614,  617,  608,  608,  608,
-      608,  608,  608,  189,   61,  609,  609,  609,  609,  609,
-      609,  609,  609,  609,  477,   61,  610,  610,  610,  610,
-      610,  610, 1001,   61,  613,  613,  613,  613,  613,  613,
-      613,  613,  613,  604,  604,  604,  604,  604,  604,  604,
-      604,  604,  610,  610,  610,  610,  610,  610,  189,   61,
-      611,  611,  611,  611,  611,  611,  611,  611,  611,  612,
-      615,  613,  613,  613,  613,  613,  613,  616,  618,   61,
-      619,  620,   61, 1001,  624,  621, 1001,   61, 1001,   61,
-
-       61,   61, 1001,  622,  623, 1001,  615,  613,  613,  613,
-      613,  613,  613,  616,  618,   61,  619,  620,   61,   61,
-       61,  621,  626,   61,  631,   61,   61,   61,   61,  622,
-      623,   61,  628,  632,  627,  629,  633,  630, 1001,   61,
-       61,   61,   61,   61,   61,   61,   61,  636,  626,  634,
-      631,  638,   61,  640,   61, 1001,   61,   61,  628,  632,
-      627,  629,  633,  630,  637,   61,   61,   61,   61,   61,
-       61,  635,   61,   61,  642,  634,  639,  641,   61,   61,
-       61,   61,   61,  643,   61,   61,  644,   61,  645,  646,
-      637,   61,   61,   61,   61,  647,   61,  635,   61,   61,
-
-      642,  649,  639,  641,   61,   61,   61,   61,  648,  643,
-       61,   61,  644,   61,  645,  646,  651,   61,   61,   61,
-       61,  647,   61,  650,   61,  652,  653,   61,   61,   61,
-       61,   61,   61,   61,  648,   61,   61,  668,   61,   61,
-      654,  678,  651, 1001,  655, 1001, 1001,  680, 1001,  650,
-       61,  652,  653,   61,   61,   61,   61,   61,   61,   61,
-       61,   61,   61,  668,   61,   61,  654,  678, 1001, 1001,
-      655,  660,  660,  660,  660,  660,  660,  660,  660,  660,
-     1001,   61,   61, 1001, 1001, 1001,   61,  255, 1001,  659,
-      659,  659,  659,  659,  659,  659,  659,  659,  544,  683,
-
-      660,  660,  660,  660,  660,  660, 1001,   61,  663,  663,
-      663,  663,  663,  663,  663,  663,  663, 1001,   61, 1001,
-     1001, 1001, 1001, 1001, 1001,  683,  660,  660,  660,  660,
-      660,  660,  255, 1001,  661,  661,  661,  661,  661,  661,
-      661,  661,  661,  662,   61,  663,  663,  663,  663,  663,
-      663,  189,   61,  403,  403,  403,  403,  403,  403,  403,
-      403,  403,  477,   61, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001,  663,  663,  663,  663,  663,  663,  189,   61,  664,
-      664,  664,  664,  664,  664,  664,  664,  664,  612,   61,
-      665,  665,  665,  665,  665,  665, 1001, 1001,  665,  665,
-
-      665,  665,  665,  665,  665,  665,  665, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001,  673,  665,  665,  665,  665,
-      665,  665,  666,  666,  666,  666,  666,  666,  666,  666,
-      666,   61,  675,  667,  667,  667,  667,  667,  667,   61,
-      670,  673,  671,  669,   61, 1001,  672,   61,   61,   61,
-      676, 1001, 1001, 1001,   61,  674, 1001,   61,  675,  667,
-      667,  667,  667,  667,  667,   61,  670,   61,  671,  669,
-       61,  681,  672,   61,   61,   61,  676,  677,  682,  685,
-       61,  674,  679,  684,   61, 1001,   61,  686,   61, 1001,
-      691,  687, 1001,   61,  690,   61,   61,  681,  688,   61,
-
-       61,   61,   61,  677,  682,  685,  689,  692,  679,  684,
-       61,   61,   61,  686,   61,   61,  691,  687,   61,  693,
-      690,   61,   61,   61,  688,   61,   61,   61,   61,   61,
-       61,  694,  689,  692,   61,  697,  696,   61,  695,   61,
-       61,   61, 1001,   61,   61,  693,   61,   61,   61,   61,
-      699,   61,  698,   61, 1001,   61,   61,  694, 1001, 1001,
-       61,  697,  696, 1001,  695,   61,   61,   61,   61,   61,
-       61, 1001,   61,   61,   61, 1001,  699,   61,  698,   61,
-      255,  718,  468,  468,  468,  468,  468,  468,  468,  468,
-      468,  544, 1001,   61,   61,  255,   61,  704,  704,  704,
-
-      704,  704,  704,  704,  704,  704,  662,  718,  705,  705,
-      705,  705,  705,  705, 1001, 1001,  705,  705,  705,  705,
-      705,  705,  705,  705,  705, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001,  720, 1001,  705,  705,  705,  705,  705,  705,
-      706,  706,  706,  706,  706,  706,  706,  706,  706,  715,
-       61,  707,  707,  707,  707,  707,  707, 1001,  720,  709,
-      709,  709,  709,  709,  709,  709,  709,  709, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001,  715,   61,  707,  707,  707,
-      707,  707,  707,  189, 1001,  708,  708,  708,  708,  708,
-      708,  708,  708,  708,  612,  717,  709,  709,  709,  709,
-
-      709,  709, 1001,   61,  712,  712,  712,  712,  712,  712,
-      712,  712,  712, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-      726,  717,  709,  709,  709,  709,  709,  709,  189,   61,
-      710,  710,  710,  710,  710,  710,  710,  710,  710,  711,
-      713,  712,  712,  712,  712,  712,  712,  714,  716,  719,
-      721,  722,   61,   61,   61,   61,   61,  723,  724,   61,
-       61,  725,   61,   61,   61,   61,  713,  712,  712,  712,
-      712,  712,  712,  714,  716,  719,  721,  722,   61,   61,
-       61,   61,   61,  723,  724,   61,   61,  725,   61,   61,
-       61,   61,  727,  728,  729,  733,  730,  731,  732,   61,
-
-      736,  734,   61,  735,   61,  737,   61,   61,   61,   61,
-       61,   61,   61,   61,   61,   61,  755,   61,  727,  728,
-      729,  733,  730,  731,  732,   61,  736,  734,   61,  735,
-       61,  737,   61,   61,   61,   61,   61,   61,   61,   61,
-       61,   61,  755,   61,  255, 1001,  741,  741,  741,  741,
-      741,  741,  741,  741,  741,  662,   61,  742,  742,  742,
-      742,  742,  742, 1001,   61,  742,  742,  742,  742,  742,
-      742,  742,  742,  742, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001,   61,  742,  742,  742,  742,  742,  742,  255,
-       61,  743,  743,  743,  743,  743,  743,  743,  743,  743,
-
-      744,  754,  745,  745,  745,  745,  745,  745, 1001,   61,
-      745,  745,  745,  745,  745,  745,  745,  745,  745, 1001,
-     1001,   61, 1001, 1001, 1001, 1001, 1001,  754,  745,  745,
-      745,  745,  745,  745,  189,   61,  403,  403,  403,  403,
-      403,  403,  403,  403,  403,  612,  189,   61,  746,  746,
-      746,  746,  746,  746,  746,  746,  746,  711, 1001,  747,
-      747,  747,  747,  747,  747, 1001, 1001,  747,  747,  747,
-      747,  747,  747,  747,  747,  747, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001,  752,  747,  747,  747,  747,  747,
-      747,  748,  748,  748,  748,  748,  748,  748,  748,  748,
-
-       61,  753,  749,  749,  749,  749,  749,  749,  750,   61,
-      752,  751,   61,  757,  758,   61,   61,   61, 1001, 1001,
-      756,  764, 1001,   61, 1001,  762,   61,  753,  749,  749,
-      749,  749,  749,  749,  750,   61,   61,  751,   61,  757,
-      758,   61,   61,   61,  759,   61,  756,  761,  766,   61,
-      760,  762,   61,  763,   61,   61,  765,  767,   61,  768,
-      782,  783,   61,   61,   61,   61,   61,   61,   61,   61,
-      759,   61,   61,  761,  766, 1001,  760, 1001,   61,  763,
-       61,   61,  765,  767,   61,  768,  782,  783, 1001,   61,
-       61,   61,   61,   61,   61,   61, 1001,  255,   61,  468,
-
-      468,  468,  468,  468,  468,  468,  468,  468,  662,  255,
-     1001,  773,  773,  773,  773,  773,  773,  773,  773,  773,
-      744,   61,  774,  774,  774,  774,  774,  774, 1001, 1001,
-      774,  774,  774,  774,  774,  774,  774,  774,  774, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001,  820,   61,  774,  774,
-      774,  774,  774,  774,  775,  775,  775,  775,  775,  775,
-      775,  775,  775,  787,   61,  776,  776,  776,  776,  776,
-      776, 1001,   61,  778,  778,  778,  778,  778,  778,  778,
-      778,  778, 1001,   61, 1001, 1001, 1001, 1001, 1001,  787,
-       61,  776,  776,  776,  776,  776,  776,  189,   61,  777,
-
-      777,  777,  777,  777,  777,  777,  777,  777,  711,   61,
-      778,  778,  778,  778,  778,  778, 1001,   61,  781,  781,
-      781,  781,  781,  781,  781,  781,  781, 1001,  788, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001,  778,  778,  778,  778,
-      778,  778,  189,   61,  779,  779,  779,  779,  779,  779,
-      779,  779,  779,  780,  789,  781,  781,  781,  781,  781,
-      781,  784,   61,  785,   61,   61,  790,  791, 1001,  793,
-       61,   61,  792,  812,   61,   61,  794,   61,  795,   61,
-      789,  781,  781,  781,  781,  781,  781,  784,   61,  785,
-       61,   61,  790,  791,   61,  793,   61,   61,  792,  797,
-
-       61,   61,  794,   61,  795,   61,  796,   61,   61,   61,
-       61,  824,  811,  813,   61,   61, 1001,  844, 1001, 1001,
-       61, 1001, 1001, 1001, 1001,  797, 1001, 1001,   61, 1001,
-     1001, 1001,  796,   61,   61,   61,   61,  824,  811,  813,
-       61,   61,  255,  844,  802,  802,  802,  802,  802,  802,
-      802,  802,  802,  744,   61,  803,  803,  803,  803,  803,
-      803, 1001,  845,  803,  803,  803,  803,  803,  803,  803,
-      803,  803, 1001,  843, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001,  803,  803,  803,  803,  803,  803,  255,  845,  804,
-      804,  804,  804,  804,  804,  804,  804,  804,  805,  821,
-
-      806,  806,  806,  806,  806,  806, 1001,   61,  806,  806,
-      806,  806,  806,  806,  806,  806,  806, 1001, 1001,   61,
-     1001, 1001, 1001, 1001, 1001,  821,  806,  806,  806,  806,
-      806,  806,  189,   61,  403,  403,  403,  403,  403,  403,
-      403,  403,  403,  711,  189,   61,  807,  807,  807,  807,
-      807,  807,  807,  807,  807,  780, 1001,  808,  808,  808,
-      808,  808,  808, 1001, 1001,  808,  808,  808,  808,  808,
-      808,  808,  808,  808, 1001, 1001, 1001, 1001, 1001, 1001,
-       61, 1001,  814,  808,  808,  808,  808,  808,  808,  809,
-      809,  809,  809,  809,  809,  809,  809,  809,   61,  815,
-
-      810,  810,  810,  810,  810,  810,   61,  817,  814,   61,
-     1001, 1001, 1001,  826,   61,  816,  818,   61,  848,  841,
-      822,  823,   61,   61,   61,  815,  810,  810,  810,  810,
-      810,  810,  819,  817,   61,   61,   61,   61,  825,  826,
-       61,  816,  818,   61,  848,  841,  822,  823,   61,   61,
-       61, 1001, 1001, 1001, 1001, 1001, 1001, 1001,  819, 1001,
-       61, 1001,   61,   61,  825, 1001, 1001, 1001, 1001,  849,
-      850,  851, 1001,  852, 1001,  255,   61,  468,  468,  468,
-      468,  468,  468,  468,  468,  468,  744,  255, 1001,  832,
-      832,  832,  832,  832,  832,  832,  832,  832,  805,   61,
-
-      833,  833,  833,  833,  833,  833, 1001, 1001,  833,  833,
-      833,  833,  833,  833,  833,  833,  833, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001,   61,  833,  833,  833,  833,
-      833,  833,  834,  834,  834,  834,  834,  834,  834,  834,
-      834,  847,  874,  835,  835,  835,  835,  835,  835, 1001,
-       61,  837,  837,  837,  837,  837,  837,  837,  837,  837,
-     1001,  875, 1001, 1001, 1001, 1001, 1001,  847,  874,  835,
-      835,  835,  835,  835,  835,  189,   61,  836,  836,  836,
-      836,  836,  836,  836,  836,  836,  780,  875,  837,  837,
-      837,  837,  837,  837, 1001, 1001,  840,  840,  840,  840,
-
-      840,  840,  840,  840,  840, 1001,  842, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001,  837,  837,  837,  837,  837,  837,
-      189,   61,  838,  838,  838,  838,  838,  838,  838,  838,
-      838,  839,  842,  840,  840,  840,  840,  840,  840,  846,
-      853,  854,   61,  855,  856,   61,  870,   61,   61,  869,
-       61,   61,   61,   61,  900,   61,   61,  901,   61,  840,
-      840,  840,  840,  840,  840,  846,  853,  854,   61,  855,
-      856,   61,  870, 1001,   61,  869,   61,   61,   61,   61,
-      900,   61,   61,  901,   61,  255, 1001,  862,  862,  862,
-      862,  862,  862,  862,  862,  862,  805,  885,  863,  863,
-
-      863,  863,  863,  863, 1001,   61,  863,  863,  863,  863,
-      863,  863,  863,  863,  863, 1001, 1001, 1001,  880, 1001,
-      881, 1001, 1001,  885,  863,  863,  863,  863,  863,  863,
-      255,   61,  864,  864,  864,  864,  864,  864,  864,  864,
-      864,   61,  876,  865,  865,  865,  865,  865,  865, 1001,
-       61,  865,  865,  865,  865,  865,  865,  865,  865,  865,
-     1001, 1001,   61, 1001, 1001, 1001, 1001,   61,  876,  865,
-      865,  865,  865,  865,  865,  189,   61,  403,  403,  403,
-      403,  403,  403,  403,  403,  403,  780,  189,   61,  866,
-      866,  866,  866,  866,  866,  866,  866,  866,  839, 1001,
-
-      867,  867,  867,  867,  867,  867, 1001,  877,  867,  867,
-      867,  867,  867,  867,  867,  867,  867,  882,  878,   61,
-      871,  879,  883,   61,  897,  884,  867,  867,  867,  867,
-      867,  867,  872,  877,  902,   61,   61,   61,   61,  873,
-       61,   61,  895,  882,   61,   61,  871,   61,  883,   61,
-      897,  884, 1001, 1001, 1001, 1001, 1001, 1001,  872,   61,
-      902,   61,   61,   61,   61,  873,   61,   61,  895,  904,
-       61, 1001,  255,   61,  468,  468,  468,  468,  468,  468,
-      468,  468,  468,  805,  255,   61,  890,  890,  890,  890,
-      890,  890,  890,  890,  890,  922,   61,  891,  891,  891,
-
-      891,  891,  891, 1001,   61,  891,  891,  891,  891,  891,
-      891,  891,  891,  891, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001,  922,   61,  891,  891,  891,  891,  891,  891,  189,
-       61,  892,  892,  892,  892,  892,  892,  892,  892,  892,
-      839,  896,  893,  893,  893,  893,  893,  893, 1001,  905,
-      893,  893,  893,  893,  893,  893,  893,  893,  893,   61,
-      898,  903,  906, 1001,  907,  909,  899,  896,  893,  893,
-      893,  893,  893,  893,   61,  917,  921,  908,   61,   61,
-       61,   61,   61,   61,   61,   61,  898,  903, 1001,   61,
-      920,  909,  899,   61, 1001,   61, 1001, 1001, 1001, 1001,
-
-       61,  917,  921,  908,   61,   61,   61,   61,   61,   61,
-       61, 1001, 1001, 1001,  918,   61,  920, 1001, 1001,   61,
-      255,   61,  914,  914,  914,  914,  914,  914,  914,  914,
-      914,   61,   61,  915,  915,  915,  915,  915,  915, 1001,
-      918,  915,  915,  915,  915,  915,  915,  915,  915,  915,
-     1001,   61,   61,  924,  919,   61, 1001,   61,   61,  915,
-      915,  915,  915,  915,  915,  189,   61,  403,  403,  403,
-      403,  403,  403,  403,  403,  403,  839,   61,   61,  924,
-      919,   61,  923,  923,   61,  923,  923,  923,  923,  923,
-      923,  931,   61,  923,   61,  932, 1001,  935,  936, 1001,
-
-     1001, 1001, 1001,  923,  923,  930,  933,  950,  945,  255,
-       61,  468,  468,  468,  468,  468,  468,  468,  468,  468,
-       61,   61,   61,  935,  936,   61,   61,  938,  939,   61,
-     1001,  930,  933,  950,  945,  934,  934, 1001,  934,  934,
-      934,  934,  934,  934,   61,  944,  934,   61,   61,  951,
-       61,   61,   61,  938,  939,   61,  934,  934,  946,  947,
-      948,  949,  954,   61, 1001,   61,  952,  953,  959,   61,
-       61,  944,  955,  962,  960,  951,   61,  963,  964,   61,
-       61,  965,   61,   61,  946,  947,  948,  949,  954,   61,
-      961,   61,  952,  953,  959,   61,   61,  966,  955,  962,
-
-      960,  968,   61,  963,  964,   61,   61,  965,   61,   61,
-       61,  967,   61,  973,  975,   61,  961,   61,   61,  976,
-       61,  974,   61,  966,   61,  977,   61,  968,   61,  978,
-       61,  984,   61,  979,   61,  983,   61,  967,   61,  973,
-      975,   61,   61,   61,   61,  976,   61,  974,  985,  986,
-       61,  977,   61,   61,   61,  978,   61,  984,   61,  979,
-       61,  983,  991,   61,   61,   61,   61, 1001,   61,   61,
-     1001, 1001, 1001, 1001,  985,  986, 1001, 1001, 1001,   61,
-       61, 1001, 1001, 1001, 1001, 1001, 1001, 1001,  991,   61,
-       61,   61,   61, 1001, 1001,   61,   41,   41,   41,   41,
-
-       43,   43,   43,   43,   47,   47,   47,   47,   49, 1001,
-       49,   49,   50,   50,   50,   50,  117, 1001,  117,  117,
-      121,  121,  184,  184,  185,  185,  252,  252,  253,  253,
-      254,  254,  323,  323,  324,  324,  393,  393,  394,  394,
-      395,  395,  419, 1001,  419,  419,  463,  463,  464,  464,
-      465,  465,  538,  538,  539,  539,  600,  600,  601,  601,
-      602,  602,  656,  656,  657,  657,  658,  658,  538,  538,
-      701,  701,  702,  702,  738,  738,  739,  739,  740,  740,
-      769,  769,  770,  770,  771,  771,  657,  657,  799,  799,
-      800,  800,  827,  827,  828,  828,  829,  829,  857,  857,
-
-      858,  858,  860,  860,  739,  739,  887,  887,  888,  888,
-      910,  910,  911,  911,  912,  912,  923, 1001,  923,  923,
-      925, 1001,  925,  925,  926,  926,  927,  927,  934, 1001,
-      934,  934,  937, 1001,  937,  937,  799,  799,  941,  941,
-      942,  942,  956,  956,  957,  957,  969,  969,  970,  970,
-      971,  971,  858,  858,  981,  981,  987,  987,  988,  988,
-      989,  989,  993,  993,  996,  996,  997,  997,  999,  999,
-     1000, 1000,    7, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001
+       38,   39,   27,   40,   27,   41,   41,   42,   41,   41,
+       41,   41,   43,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44, 1131,   45,   46,   47,   48,
+       48,   48,   48,   49,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   48,   48,   50,   50,   60,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   51,
+       51,   51,   51,   51,   51,   52,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   53, 1131,   61,   62,   54,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   56,   89,
+       57,   57,   57,   57,   57,   57,   62,   58,  100,   81,
+      119, 1131,  101,   62,  120,  167,  183,  216,  230,  234,
+      235,  236,  102,   59,  252,   89,   57,   57,   57,   57,
+
+       57,   57,   62,   58,  100,   81,   62,   62,  101,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,  102,   59,
+       63,   63,   64,   65,   63,   66,   62,   67,   62,   62,
+       62,   68,   62,   69,   62,   62,   62,   62,   62,   62,
+       70,   62,   62,   62,   62,   62,   63,   63,   64,   65,
+       63,   66,   62,   67,   62,   62,   62,   68,   62,   69,
+       62,   62,   62,   62,   62,   62,   70,   62,   62,   62,
+       62,   62,   63,   63,   72,   63,   85,  283,  114,  284,
+      117,   62,  118,   62,   86,   73,   75,   76,   74,  115,
+       71,   77,  289,  116,   62,  293,   78,   79,   63,   63,
+
+       72,   63,   85,   80,  114,   82,  117,   62,  118,   62,
+       86,   73,   75,   76,   74,  115,   71,   77,   87,  116,
+       62,   83,   78,   79,   88,   62,  296,  303,  310,   80,
+      311,   82,  336,  340, 1131, 1131,   94,  341,  350, 1131,
+      363,  364,  375,  376,   87,  386,   95,   83,   96,  131,
+       88,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62, 1131,   94,   62,   62,   62,   62,   62,   62,   90,
+       62,   97,   95,   91,   96,  131,  394,  400,  132,   92,
+      414,  195,   98,   84,   93,   99,  420,  200,  133,   62,
+       62,   62,   62,   62,   62,   90,   62,   97,  134,   91,
+
+      135,  103,  109,  110,  132,   92,  104,  105,   98,   84,
+       93,   99,  111,  106,  133,  136,  137,  138,  107,  108,
+      112,  141,  142,  143,  134,  144,  135,  103,  432,  113,
+      447,  479,  104,  105,  480,  482,  492,  271,  111,  106,
+      504,  136,  137,  138,  107,  108,  112,  141,  142,  143,
+     1131,  144,  514,  121,  121,  113,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  121,  121,
+      121,  121,  121,  121,  121,  121,  121,  121,  122,  122,
+      122,  122,  122,  122,  122,  122,  122,  123,  145,  124,
+      124,  124,  124,  124,  124,  125,  125,  125,  125,  125,
+      125,  125,  125,  125,  126,  146,  125,  125,  125,  125,
+      125,  125,  571,  579,  145,  124,  124,  124,  124,  124,
+      124,  124,  124,  124,  124,  124,  124,  124,  124,  124,
+      344,  146,  125,  125,  125,  125,  125,  125,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  149,  150,  127,
+
+      127,  127,  127,  127,  127,  128,  128,  128,  128,  128,
+      128,  128,  128,  128,  582,  151,  129,  129,  129,  129,
+      129,  129, 1131,  149,  150,  127,  127,  127,  127,  127,
+      127,  354,  139,  354,  598,  621,  635,  424,  424,  678,
+      140,  151,  129,  129,  129,  129,  129,  129,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  123,  139,  130,
+      130,  130,  130,  130,  130,  147,  140,  152,  153,  148,
+      159,  160,  157,  154,  692,  163,  164,  165,  155,   62,
+      158,  166,  168,  169,  170,  130,  130,  130,  130,  130,
+      130,  147,  156,  152,  153,  148,  159,  160,  157,  154,
+
+      161,  163,  164,  165,  155,   62,  158,  166,  168,  169,
+      170,  171,  175,  172,  173,  162,  176,  174,  156,  177,
+      178,  179,  182,  184,  185,  186,  161,  180,  187,  188,
+      189,  190,  203,  204,  694,  697,  698,  171,  175,  172,
+      173,  162,  176,  174,  181,  177,  178,  179,  182,  184,
+      185,  186,  709,  180,  187,  188,  189,  190,  203,  204,
+      191,  191,  191,  191,  191,  191,  191,  191,  191,  205,
+      181,  192,  192,  192,  192,  192,  192,  193,  193,  193,
+      193,  193,  193,  193,  193,  193,  206,  207,  193,  193,
+      193,  193,  193,  193,  497,  205,  508,  192,  192,  192,
+
+      192,  192,  192,  192,  192,  192,  192,  192,  192,  192,
+      192,  192,  206,  207,  193,  193,  193,  193,  193,  193,
+      194,  194,  194,  194,  194,  194,  194,  194,  194,  195,
+      208,  194,  194,  194,  194,  194,  194,  196,  196,  196,
+      196,  196,  196,  196,  196,  196,  508,  746,  197,  197,
+      197,  197,  197,  197,  758,  209,  208,  194,  194,  194,
+      194,  194,  194, 1131,  778,  201,  201,  201,  201,  201,
+      201,  201,  201,  201,  197,  197,  197,  197,  197,  197,
+      198,  209,  199,  199,  199,  199,  199,  199,  199,  199,
+      199,  200,  210,  201,  201,  201,  201,  201,  201,  202,
+
+      202,  202,  202,  202,  202,  202,  202,  202,   56,  211,
+      202,  202,  202,  202,  202,  202,  212,  213,  210,  201,
+      201,  201,  201,  201,  201,  214,  215,  217,  218,  219,
+      220,  221,  222,  223,  224,  211,  202,  202,  202,  202,
+      202,  202,  212,  213,  225,  226,  227,  228,  229,  231,
+      232,  214,  215,  217,  218,  219,  220,  221,  222,  223,
+      224,  233,  237,  238,  242,  243,  244,  245,  239,  246,
+      225,  226,  227,  228,  229,  231,  232,  240,  247,  248,
+      249,  241,  250,  251,  253,  254,  255,  233,  237,  238,
+      242,  243,  244,  245,  239,  246,  256,  257,  258,  259,
+
+      260,  261,  262,  240,  247,  248,  249,  241,  250,  251,
+      253,  254,  255,  263,  586,  586,  801,  805,  820,  657,
+      666,  666,  256,  257,  258,  259,  260,  261,  262,  264,
+      264,  264,  264,  264,  264,  264,  264,  264,  856,  263,
+      265,  265,  265,  265,  265,  265,  265,  265,  265,  265,
+      265,  265,  265,  265,  265, 1131,  279,  272,  272,  272,
+      272,  272,  272,  272,  272,  272,  265,  265,  265,  265,
+      265,  265,  266,  266,  266,  266,  266,  266,  266,  266,
+      266,  280,  279,  266,  266,  266,  266,  266,  266,  267,
+      267,  267,  267,  267,  267,  267,  267,  267,  282,  281,
+
+      267,  267,  267,  267,  267,  267,  864,  728,  728,  266,
+      266,  266,  266,  266,  266,  273,  273,  273,  273,  273,
+      273,  273,  273,  273,  282,  281,  267,  267,  267,  267,
+      267,  267,  268,  268,  268,  268,  268,  268,  268,  268,
+      268,  885,  285,  268,  268,  268,  268,  268,  268,  269,
+      286,  270,  270,  270,  270,  270,  270,  270,  270,  270,
+      271,  287,  272,  272,  272,  272,  272,  272,  285,  268,
+      268,  268,  268,  268,  268, 1131,  286,  275,  275,  275,
+      275,  275,  275,  275,  275,  275,  888,  287,  272,  272,
+      272,  272,  272,  272,  274,  274,  274,  274,  274,  274,
+
+      274,  274,  274,  288,  290,  275,  275,  275,  275,  275,
+      275,  276,  276,  276,  276,  276,  276,  276,  276,  276,
+      291,  292,  277,  277,  277,  277,  277,  277,  905,  288,
+      290,  275,  275,  275,  275,  275,  275,  294,  295,  907,
+      781,  789,  789,  921,  930,  297,  291,  292,  277,  277,
+      277,  277,  277,  277,  278,  278,  278,  278,  278,  278,
+      278,  278,  278,  294,  295,  278,  278,  278,  278,  278,
+      278,  297,  298,  299,  300,  301,  302,  304,  308,  309,
+      314,  315,  312,  316,  317,  318,  305,  306,  307,  319,
+      320,  278,  278,  278,  278,  278,  278,  313,  298,  299,
+
+      300,  301,  302,  304,  308,  309,  314,  315,  312,  316,
+      317,  318,  305,  306,  307,  319,  320,  321,  322,  323,
+      324,  325,  326,  313,  327,  328,  329,  331,  332,  333,
+      334,  335,  337,  338,  339,  356,  357,  358,  359,  360,
+      361,  330,  833,  321,  322,  323,  324,  325,  326,  833,
+      327,  328,  329,  331,  332,  333,  334,  335,  337,  338,
+      339,  356,  357,  358,  359,  360,  361,  330,  342,  342,
+      342,  342,  342,  342,  342,  342,  342,  362,  365,  342,
+      342,  342,  342,  342,  342,  343,  343,  343,  343,  343,
+      343,  343,  343,  343,  344,  366,  343,  343,  343,  343,
+
+      343,  343,  960,  362,  365,  342,  342,  342,  342,  342,
+      342,  345,  345,  345,  345,  345,  345,  345,  345,  345,
+      871,  366,  343,  343,  343,  343,  343,  343,  346,  346,
+      346,  346,  346,  346,  346,  346,  346,  369,  370,  347,
+      347,  347,  347,  347,  347,  348,  348,  348,  348,  348,
+      348,  348,  348,  348,  983,  879,  349,  349,  349,  349,
+      349,  349,  879,  369,  370,  347,  347,  347,  347,  347,
+      347, 1131,  371,  347,  347,  347,  347,  347,  347,  347,
+      347,  347,  349,  349,  349,  349,  349,  349,  351,  351,
+      351,  351,  351,  351,  351,  351,  351,  372,  371,  352,
+
+      352,  352,  352,  352,  352, 1131, 1005,  352,  352,  352,
+      352,  352,  352,  352,  352,  352,  967,  968,  969, 1003,
+      970, 1006, 1004,  372, 1014,  352,  352,  352,  352,  352,
+      352,  353,  353,  353,  353,  353,  353,  353,  353,  353,
+      354,  373,  355,  355,  355,  355,  355,  355, 1131,  374,
+      355,  355,  355,  355,  355,  355,  355,  355,  355,  367,
+      377,  378,  379,  368,  380,  381,  382,  373,  355,  355,
+      355,  355,  355,  355,  383,  374,  384,  385,  387,  388,
+      389,  391,  392,  393,  395,  367,  377,  378,  379,  368,
+      380,  381,  382,  396,  397,  390,  398,  399,  401,  402,
+
+      383,  403,  384,  385,  387,  388,  389,  391,  392,  393,
+      395,  404,  405,  406,  407,  408,  409,  410,  411,  396,
+      397,  390,  398,  399,  401,  402,  412,  403,  413,  415,
+      416,  914,  914, 1032, 1033, 1034, 1035,  404,  405,  406,
+      407,  408,  409,  410,  411,  947,  956,  956,  985, 1131,
+     1061, 1062,  412, 1070,  413,  415,  416,  417,  417,  417,
+      417,  417,  417,  417,  417,  417,  433,  434,  417,  417,
+      417,  417,  417,  417,  418,  418,  418,  418,  418,  418,
+      418,  418,  418, 1043, 1110,  418,  418,  418,  418,  418,
+      418, 1073,  433,  434,  417,  417,  417,  417,  417,  417,
+
+     1131,  435,  422,  422,  422,  422,  422,  422,  422,  422,
+      422,  418,  418,  418,  418,  418,  418,  419,  419,  419,
+      419,  419,  419,  419,  419,  419,  436,  435,  419,  419,
+      419,  419,  419,  419,  421,  421,  421,  421,  421,  421,
+      421,  421,  421, 1102, 1125,  422,  422,  422,  422,  422,
+      422, 1131,  436, 1120,  419,  419,  419,  419,  419,  419,
+     1131,  437,  425,  425,  425,  425,  425,  425,  425,  425,
+      425,  422,  422,  422,  422,  422,  422,  423,  423,  423,
+      423,  423,  423,  423,  423,  423,  424,  437,  425,  425,
+      425,  425,  425,  425,  426,  426,  426,  426,  426,  426,
+
+      426,  426,  426, 1131, 1128,  429,  429,  429,  429,  429,
+      429,  429,  429,  429,  425,  425,  425,  425,  425,  425,
+      198,    0,  427,  427,  427,  427,  427,  427,  427,  427,
+      427,  200,  428,  428,  428,  428,  428,  428,  428,  428,
+      428,  438,  439,  429,  429,  429,  429,  429,  429,  430,
+      430,  430,  430,  430,  430,  430,  430,  430,  440,  444,
+      431,  431,  431,  431,  431,  431,    0,  438,  439,  429,
+      429,  429,  429,  429,  429,  498,  498,  498,  498,  498,
+      498,  498,  498,  498,  440,  444,  431,  431,  431,  431,
+      431,  431,  441,  441,    0,  441,  441,  441,  441,  441,
+
+      441,  442,  443,  441,  443,  443,  443,  443,  443,  443,
+      443,  443,  443,  441,  441,  443,  443,  443,  443,  443,
+      443,  443,  443,  443,  443,  443,  443,  443,  443,  443,
+      443,  443,  443,  443,  443,  443,  443,  443,  443,  443,
+      443,  443,  443,  443,  443,  443,  443,  443,  443,  443,
+      443,  443,  443,  443,  443,  443,  443,  443,  443,  443,
+      443,  443,  443,  443,  443,  443,  443,  445,  446,  448,
+      449,  450,  451,  452,  453,  455,  456,  457,  458,  454,
+      459,  460,  461,  462,  463,  464,  465,  466,  467,  468,
+      469,  470,  471,  445,  446,  448,  449,  450,  451,  452,
+
+      453,  455,  456,  457,  458,  454,  459,  460,  461,  462,
+      463,  464,  465,  466,  467,  468,  469,  470,  471,  472,
+      473,  474,  475,  476,  478,  481,  483,  484,  485,  486,
+      487,  488,  489,  490,  491,  493,  477,    0,    0,    0,
+        0,    0,    0,    0,    0,  472,  473,  474,  475,  476,
+      478,  481,  483,  484,  485,  486,  487,  488,  489,  490,
+      491,  493,  477,  494,  494,  494,  494,  494,  494,  494,
+      494,  494,  513,  515,  494,  494,  494,  494,  494,  494,
+      495,  495,  495,  495,  495,  495,  495,  495,  495,    0,
+        0,  495,  495,  495,  495,  495,  495,    0,  513,  515,
+
+      494,  494,  494,  494,  494,  494, 1131,  516,  501,  501,
+      501,  501,  501,  501,  501,  501,  501,  495,  495,  495,
+      495,  495,  495,  496,  496,  496,  496,  496,  496,  496,
+      496,  496,  497,  516,  496,  496,  496,  496,  496,  496,
+      269,    0,  499,  499,  499,  499,  499,  499,  499,  499,
+      499,  271,    0,    0,    0,    0,    0,    0,    0,    0,
+      496,  496,  496,  496,  496,  496,  500,  500,  500,  500,
+      500,  500,  500,  500,  500,  517,  518,  501,  501,  501,
+      501,  501,  501,  502,  502,  502,  502,  502,  502,  502,
+      502,  502,    0,    0,  503,  503,  503,  503,  503,  503,
+
+        0,  517,  518,  501,  501,  501,  501,  501,  501, 1131,
+      519,  506,  506,  506,  506,  506,  506,  506,  506,  506,
+      503,  503,  503,  503,  503,  503,  505,  505,  505,  505,
+      505,  505,  505,  505,  505,  520,  519,  506,  506,  506,
+      506,  506,  506,  507,  507,  507,  507,  507,  507,  507,
+      507,  507,  508,    0,  509,  509,  509,  509,  509,  509,
+        0,  520,  521,  506,  506,  506,  506,  506,  506, 1131,
+      525,  509,  509,  509,  509,  509,  509,  509,  509,  509,
+      509,  509,  509,  509,  509,  509,  510,  522,  521,  511,
+      526,  527,  528,  531,  532,  512,  525,  523,  529,  533,
+
+      530,  534,  524,  535,  536,  537,  525,  538,  539,  540,
+      541,  542,  510,  522,  543,  511,  526,  527,  528,  531,
+      532,  512,  544,  523,  529,  533,  530,  534,  524,  535,
+      536,  537,  525,  538,  539,  540,  541,  542,  545,  546,
+      543,  547,  548,  549,  550,  551,  552,  553,  544,  554,
+      555,  556,  557,  558,  560,  561,  562,  563,  564,    0,
+        0,  569,  570,  559,  545,  546,  572,  547,  548,  549,
+      550,  551,  552,  553,    0,  554,  555,  556,  557,  558,
+      560,  561,  562,  563,  564,  565,  566,  569,  570,  559,
+      573,  574,  572,  575,  576,  577,  578,  593,  594,  595,
+
+      567,  596,  597,  568,    0,    0,    0,    0,    0,    0,
+        0,  565,  566,  599,  600,    0,  573,  574,    0,  575,
+      576,  577,  578,  593,  594,  595,  567,  596,  597,  568,
+      580,  580,  580,  580,  580,  580,  580,  580,  580,  599,
+      600,  580,  580,  580,  580,  580,  580,  581,  581,  581,
+      581,  581,  581,  581,  581,  581,    0,    0,  581,  581,
+      581,  581,  581,  581,    0,    0,    0,  580,  580,  580,
+      580,  580,  580, 1131,  601,  584,  584,  584,  584,  584,
+      584,  584,  584,  584,  581,  581,  581,  581,  581,  581,
+      583,  583,  583,  583,  583,  583,  583,  583,  583,  602,
+
+      601,  584,  584,  584,  584,  584,  584,  585,  585,  585,
+      585,  585,  585,  585,  585,  585,  586,    0,  587,  587,
+      587,  587,  587,  587,    0,  602,    0,  584,  584,  584,
+      584,  584,  584, 1131,    0,  587,  587,  587,  587,  587,
+      587,  587,  587,  587,  587,  587,  587,  587,  587,  587,
+      588,  588,  588,  588,  588,  588,  588,  588,  588,  589,
+      589,  589,  589,  589,  589,  589,  589,  589,  603,  604,
+      590,  590,  590,  590,  590,  590,  591,  591,  591,  591,
+      591,  591,  591,  591,  591,    0,    0,  592,  592,  592,
+      592,  592,  592,  605,  603,  604,  590,  590,  590,  590,
+
+      590,  590, 1131,  606,  590,  590,  590,  590,  590,  590,
+      590,  590,  590,  592,  592,  592,  592,  592,  592,  605,
+      607,  608,  609,  610,  611,  612,  613,  614,  615,  606,
+      616,  617,  618,  619,  620,  622,  623,  624,  625,  626,
+      627,  628,  629,  630,  631,    0,  607,  608,  609,  610,
+      611,  612,  613,  614,  615,  634,  616,  617,  618,  619,
+      620,  622,  623,  624,  625,  626,  627,  628,  629,  630,
+      631,  632,  636,  637,  638,  639,  640,  641,  633,  642,
+      643,  634,  644,  645,  646,  647,  648,  649,  650,  651,
+      652,  653,    0,    0,    0,    0,    0,  632,  636,  637,
+
+      638,  639,  640,  641,  633,  642,  643,    0,  644,  645,
+      646,  647,  648,  649,  650,  651,  652,  653,  654,  654,
+      654,  654,  654,  654,  654,  654,  654,  668,  669,  654,
+      654,  654,  654,  654,  654,  655,  655,  655,  655,  655,
+      655,  655,  655,  655,  670,  671,  655,  655,  655,  655,
+      655,  655,    0,  668,  669,  654,  654,  654,  654,  654,
+      654,  658,  658,  658,  658,  658,  658,  658,  658,  658,
+      670,  671,  655,  655,  655,  655,  655,  655,  656,  656,
+      656,  656,  656,  656,  656,  656,  656,  657,  672,  656,
+      656,  656,  656,  656,  656,  659,  659,  659,  659,  659,
+
+      659,  659,  659,  659,    0,    0,  660,  660,  660,  660,
+      660,  660,    0,    0,  672,  656,  656,  656,  656,  656,
+      656, 1131,  673,  660,  660,  660,  660,  660,  660,  660,
+      660,  660,  660,  660,  660,  660,  660,  660,  661,  661,
+      661,  661,  661,  661,  661,  661,  661,  674,  673,  662,
+      662,  662,  662,  662,  662,  663,  663,  663,  663,  663,
+      663,  663,  663,  663,    0,    0,  664,  664,  664,  664,
+      664,  664,    0,  674,    0,  662,  662,  662,  662,  662,
+      662, 1131,  675,  664,  664,  664,  664,  664,  664,  664,
+      664,  664,  664,  664,  664,  664,  664,  664,  665,  665,
+
+      665,  665,  665,  665,  665,  665,  665,  666,  675,  667,
+      667,  667,  667,  667,  667, 1131,  676,  667,  667,  667,
+      667,  667,  667,  667,  667,  667,  677,  679,  680,  681,
+      682,  683,  684,  685,  686,  667,  667,  667,  667,  667,
+      667,  687,  676,  688,  689,  690,  691,  693,  695,  696,
+      699,  700,  677,  679,  680,  681,  682,  683,  684,  685,
+      686,  701,  702,  703,  704,  705,  706,  687,  707,  688,
+      689,  690,  691,  693,  695,  696,  699,  700,  708,  710,
+      711,  712,  713,  714,  715,  716,  717,  701,  702,  703,
+      704,  705,  706,  718,  707,  719,  720,  721,    0,    0,
+
+        0,    0,    0,    0,  708,  710,  711,  712,  713,  714,
+      715,  716,  717,    0,    0,    0,    0,    0,    0,  718,
+        0,  719,  720,  721,  722,  722,  722,  722,  722,  722,
+      722,  722,  722,  734,  735,  722,  722,  722,  722,  722,
+      722,  723,  723,  723,  723,  723,  723,  723,  723,  723,
+        0,    0,  723,  723,  723,  723,  723,  723,    0,  734,
+      735,  722,  722,  722,  722,  722,  722, 1131,  736,  726,
+      726,  726,  726,  726,  726,  726,  726,  726,  723,  723,
+      723,  723,  723,  723,  724,  724,  724,  724,  724,  724,
+      724,  724,  724,  737,  736,  724,  724,  724,  724,  724,
+
+      724,  725,  725,  725,  725,  725,  725,  725,  725,  725,
+        0,    0,  726,  726,  726,  726,  726,  726,    0,  737,
+        0,  724,  724,  724,  724,  724,  724, 1131,  738,  729,
+      729,  729,  729,  729,  729,  729,  729,  729,  726,  726,
+      726,  726,  726,  726,  727,  727,  727,  727,  727,  727,
+      727,  727,  727,  728,  738,  729,  729,  729,  729,  729,
+      729,  730,  730,  730,  730,  730,  730,  730,  730,  730,
+        0,    0,  731,  731,  731,  731,  731,  731,    0,    0,
+        0,  729,  729,  729,  729,  729,  729, 1131,  739,  731,
+      731,  731,  731,  731,  731,  731,  731,  731,  731,  731,
+
+      731,  731,  731,  731,  732,  732,  732,  732,  732,  732,
+      732,  732,  732,  740,  739,  733,  733,  733,  733,  733,
+      733,  741,  742,  743,  744,  745,  747,  748,  749,  750,
+      751,  752,  753,  754,  755,  756,  757,  759,  760,  740,
+      761,  733,  733,  733,  733,  733,  733,  741,  742,  743,
+      744,  745,  747,  748,  749,  750,  751,  752,  753,  754,
+      755,  756,  757,  759,  760,  762,  761,  763,  764,  765,
+      766,  767,  768,  769,  770,  771,  772,  773,  774,  775,
+      776,  777,  952,  952,  952,  952,  952,  952,  952,  952,
+      952,  762,  791,  763,  764,  765,  766,  767,  768,  769,
+
+      770,  771,  772,  773,  774,  775,  776,  777,  779,  779,
+      779,  779,  779,  779,  779,  779,  779,  792,  791,  779,
+      779,  779,  779,  779,  779,  780,  780,  780,  780,  780,
+      780,  780,  780,  780,  781,    0,  780,  780,  780,  780,
+      780,  780,    0,  792,    0,  779,  779,  779,  779,  779,
+      779, 1131,  793,  783,  783,  783,  783,  783,  783,  783,
+      783,  783,  780,  780,  780,  780,  780,  780,  782,  782,
+      782,  782,  782,  782,  782,  782,  782,  794,  793,  783,
+      783,  783,  783,  783,  783,  784,  784,  784,  784,  784,
+      784,  784,  784,  784,    0,    0,  785,  785,  785,  785,
+
+      785,  785,    0,  794,    0,  783,  783,  783,  783,  783,
+      783, 1131,  795,  787,  787,  787,  787,  787,  787,  787,
+      787,  787,  785,  785,  785,  785,  785,  785,  786,  786,
+      786,  786,  786,  786,  786,  786,  786,  796,  795,  787,
+      787,  787,  787,  787,  787,  788,  788,  788,  788,  788,
+      788,  788,  788,  788,  789,    0,  790,  790,  790,  790,
+      790,  790,  797,  796,  798,  787,  787,  787,  787,  787,
+      787, 1131,  799,  790,  790,  790,  790,  790,  790,  790,
+      790,  790,  790,  790,  790,  790,  790,  790,  797,  800,
+      798,  802,  803,  804,  806,  807,  808,  809,  799,  810,
+
+      811,  812,  813,  814,  815,  816,  817,  818,  819,  821,
+      822,  823,  824,  825,  826,  800,    0,  802,  803,  804,
+      806,  807,  808,  809,  839,  810,  811,  812,  813,  814,
+      815,  816,  817,  818,  819,  821,  822,  823,  824,  825,
+      826,  827,  827,  827,  827,  827,  827,  827,  827,  827,
+      839,  840,  827,  827,  827,  827,  827,  827,  828,  828,
+      828,  828,  828,  828,  828,  828,  828,    0,    0,  828,
+      828,  828,  828,  828,  828,    0,    0,  840,  827,  827,
+      827,  827,  827,  827, 1131,  841,  831,  831,  831,  831,
+      831,  831,  831,  831,  831,  828,  828,  828,  828,  828,
+
+      828,  829,  829,  829,  829,  829,  829,  829,  829,  829,
+      842,  841,  829,  829,  829,  829,  829,  829,  830,  830,
+      830,  830,  830,  830,  830,  830,  830,    0,    0,  831,
+      831,  831,  831,  831,  831,    0,  842,    0,  829,  829,
+      829,  829,  829,  829, 1131,  843,  834,  834,  834,  834,
+      834,  834,  834,  834,  834,  831,  831,  831,  831,  831,
+      831,  832,  832,  832,  832,  832,  832,  832,  832,  832,
+      833,  843,  834,  834,  834,  834,  834,  834,  835,  835,
+      835,  835,  835,  835,  835,  835,  835,    0,    0,  836,
+      836,  836,  836,  836,  836,    0,    0,    0,  834,  834,
+
+      834,  834,  834,  834, 1131,  844,  836,  836,  836,  836,
+      836,  836,  836,  836,  836,  836,  836,  836,  836,  836,
+      836,  837,  837,  837,  837,  837,  837,  837,  837,  837,
+      845,  844,  838,  838,  838,  838,  838,  838,  846,  847,
+      848,  849,  851,  852,  853,  854,  855,  850,  857,  858,
+      859,  860,  861,  862,  863,  865,  845,  866,  838,  838,
+      838,  838,  838,  838,  846,  847,  848,  849,  851,  852,
+      853,  854,  855,  850,  857,  858,  859,  860,  861,  862,
+      863,  865,  867,  866,  868,  868,  868,  868,  868,  868,
+      868,  868,  868,  881,  882,  868,  868,  868,  868,  868,
+
+      868,    0,    0,    0,    0,    0,    0, 1131,  867,  873,
+      873,  873,  873,  873,  873,  873,  873,  873,    0,  881,
+      882,  868,  868,  868,  868,  868,  868,  869,  869,  869,
+      869,  869,  869,  869,  869,  869,  883,  884,  869,  869,
+      869,  869,  869,  869,  870,  870,  870,  870,  870,  870,
+      870,  870,  870,  871,    0,  870,  870,  870,  870,  870,
+      870,    0,  883,  884,  869,  869,  869,  869,  869,  869,
+     1131,  886,  877,  877,  877,  877,  877,  877,  877,  877,
+      877,  870,  870,  870,  870,  870,  870,  872,  872,  872,
+      872,  872,  872,  872,  872,  872,  887,  886,  873,  873,
+
+      873,  873,  873,  873,  874,  874,  874,  874,  874,  874,
+      874,  874,  874,    0,    0,  875,  875,  875,  875,  875,
+      875,    0,  887,    0,  873,  873,  873,  873,  873,  873,
+     1131,  889,  880,  880,  880,  880,  880,  880,  880,  880,
+      880,  875,  875,  875,  875,  875,  875,  876,  876,  876,
+      876,  876,  876,  876,  876,  876,  890,  889,  877,  877,
+      877,  877,  877,  877,  878,  878,  878,  878,  878,  878,
+      878,  878,  878,  879,  891,  880,  880,  880,  880,  880,
+      880,  892,  890,  893,  877,  877,  877,  877,  877,  877,
+      894,  895,  896,  897,  898,  899,  902,  903,  900,  904,
+
+      891,  880,  880,  880,  880,  880,  880,  892,  901,  893,
+      906,    0,    0,    0,    0,    0,  894,  895,  896,  897,
+      898,  899,  902,  903,  900,  904,    0,    0,    0,    0,
+        0,    0,    0,    0,  901,    0,  906,  908,  908,  908,
+      908,  908,  908,  908,  908,  908,  920,  922,  908,  908,
+      908,  908,  908,  908,  909,  909,  909,  909,  909,  909,
+      909,  909,  909,  910,    0,  909,  909,  909,  909,  909,
+      909,    0,  920,  922,  908,  908,  908,  908,  908,  908,
+     1131,  923,  912,  912,  912,  912,  912,  912,  912,  912,
+      912,  909,  909,  909,  909,  909,  909,  911,  911,  911,
+
+      911,  911,  911,  911,  911,  911,  926,  923,  912,  912,
+      912,  912,  912,  912,  913,  913,  913,  913,  913,  913,
+      913,  913,  913,  914,    0,  915,  915,  915,  915,  915,
+      915,    0,  926,    0,  912,  912,  912,  912,  912,  912,
+     1131,  927,  915,  915,  915,  915,  915,  915,  915,  915,
+      915,  915,  915,  915,  915,  915,  915,  916,  916,  916,
+      916,  916,  916,  916,  916,  916,  931,  927,  917,  917,
+      917,  917,  917,  917,  918,  918,  918,  918,  918,  918,
+      918,  918,  918,    0,    0,  919,  919,  919,  919,  919,
+      919,    0,  931,  932,  917,  917,  917,  917,  917,  917,
+
+     1131,  924,  917,  917,  917,  917,  917,  917,  917,  917,
+      917,  919,  919,  919,  919,  919,  919,  925,  928,  932,
+      933,  934,  935,  936,  937,  938,  939,  924,  940,  941,
+      942,  943,  958,  959,  929,    0,    0,    0,    0,    0,
+        0,    0,    0,  925,  928,  961,  933,  934,  935,  936,
+      937,  938,  939,    0,  940,  941,  942,  943,  958,  959,
+      929,  944,  944,  944,  944,  944,  944,  944,  944,  944,
+      962,  961,  944,  944,  944,  944,  944,  944,  945,  945,
+      945,  945,  945,  945,  945,  945,  945,    0,    0,  945,
+      945,  945,  945,  945,  945,    0,  962,    0,  944,  944,
+
+      944,  944,  944,  944, 1131,  963,  950,  950,  950,  950,
+      950,  950,  950,  950,  950,  945,  945,  945,  945,  945,
+      945,  946,  946,  946,  946,  946,  946,  946,  946,  946,
+      947,  963,  946,  946,  946,  946,  946,  946,  948,  948,
+      948,  948,  948,  948,  948,  948,  948,    0,    0,  948,
+      948,  948,  948,  948,  948,    0,    0,    0,  946,  946,
+      946,  946,  946,  946, 1131,  964,  954,  954,  954,  954,
+      954,  954,  954,  954,  954,  948,  948,  948,  948,  948,
+      948,  949,  949,  949,  949,  949,  949,  949,  949,  949,
+      965,  964,  950,  950,  950,  950,  950,  950,  951,  951,
+
+      951,  951,  951,  951,  951,  951,  951,    0,    0,  952,
+      952,  952,  952,  952,  952,    0,  965,    0,  950,  950,
+      950,  950,  950,  950, 1131,  966,  957,  957,  957,  957,
+      957,  957,  957,  957,  957,  952,  952,  952,  952,  952,
+      952,  953,  953,  953,  953,  953,  953,  953,  953,  953,
+      971,  966,  954,  954,  954,  954,  954,  954,  955,  955,
+      955,  955,  955,  955,  955,  955,  955,  956,  972,  957,
+      957,  957,  957,  957,  957,  973,  971,  974,  954,  954,
+      954,  954,  954,  954,  975,  976,  977,  978,  979,  980,
+        0,    0,    0,    0,  972,  957,  957,  957,  957,  957,
+
+      957,  973,    0,  974,    0,    0,    0,    0,    0,    0,
+      975,  976,  977,  978,  979,  980,  981,  981,  981,  981,
+      981,  981,  981,  981,  981,  993,  994,  981,  981,  981,
+      981,  981,  981,  982,  982,  982,  982,  982,  982,  982,
+      982,  982,    0,    0,  982,  982,  982,  982,  982,  982,
+        0,  993,  994,  981,  981,  981,  981,  981,  981, 1131,
+      998,  987,  987,  987,  987,  987,  987,  987,  987,  987,
+      982,  982,  982,  982,  982,  982,  984,  984,  984,  984,
+      984,  984,  984,  984,  984,  985,  998,  984,  984,  984,
+      984,  984,  984,  986,  986,  986,  986,  986,  986,  986,
+
+      986,  986,    0,    0,  987,  987,  987,  987,  987,  987,
+        0,  999,    0,  984,  984,  984,  984,  984,  984, 1131,
+        0,  989,  989,  989,  989,  989,  989,  989,  989,  989,
+      987,  987,  987,  987,  987,  987,  269,  999,  988,  988,
+      988,  988,  988,  988,  988,  988,  988, 1000, 1001,  989,
+      989,  989,  989,  989,  989,  990,  990,  990,  990,  990,
+      990,  990,  990,  990,    0,    0,  991,  991,  991,  991,
+      991,  991,    0, 1000, 1001,  989,  989,  989,  989,  989,
+      989, 1131, 1002,  991,  991,  991,  991,  991,  991,  991,
+      991,  991,  991,  991,  991,  991,  991,  991,  992,  992,
+
+      992,  992,  992,  992,  992,  992,  992,  995, 1002,  992,
+      992,  992,  992,  992,  992, 1007, 1008, 1009, 1010,  996,
+     1011, 1012, 1013, 1023, 1024, 1025,  997,    0,    0,    0,
+        0,    0,    0,  995,    0,  992,  992,  992,  992,  992,
+      992, 1007, 1008, 1009, 1010,  996, 1011, 1012, 1013, 1023,
+     1024, 1025,  997, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+     1015, 1015, 1028, 1029, 1015, 1015, 1015, 1015, 1015, 1015,
+     1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1016,    0,
+        0, 1016, 1016, 1016, 1016, 1016, 1016,    0, 1028, 1029,
+     1015, 1015, 1015, 1015, 1015, 1015, 1131, 1030, 1019, 1019,
+
+     1019, 1019, 1019, 1019, 1019, 1019, 1019, 1016, 1016, 1016,
+     1016, 1016, 1016, 1017, 1017, 1017, 1017, 1017, 1017, 1017,
+     1017, 1017, 1031, 1030, 1017, 1017, 1017, 1017, 1017, 1017,
+     1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,    0,
+        0, 1019, 1019, 1019, 1019, 1019, 1019,    0, 1031,    0,
+     1017, 1017, 1017, 1017, 1017, 1017, 1131, 1036, 1021, 1021,
+     1021, 1021, 1021, 1021, 1021, 1021, 1021, 1019, 1019, 1019,
+     1019, 1019, 1019, 1020, 1020, 1020, 1020, 1020, 1020, 1020,
+     1020, 1020, 1037, 1036, 1021, 1021, 1021, 1021, 1021, 1021,
+     1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1038,
+
+     1039, 1022, 1022, 1022, 1022, 1022, 1022, 1047, 1037, 1048,
+     1021, 1021, 1021, 1021, 1021, 1021, 1026, 1049, 1050, 1051,
+     1052, 1054, 1027,    0,    0, 1038, 1039, 1022, 1022, 1022,
+     1022, 1022, 1022, 1047,    0, 1048,    0,    0,    0,    0,
+        0,    0, 1026, 1049, 1050, 1051, 1052, 1054, 1027, 1040,
+     1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1060, 1063,
+     1040, 1040, 1040, 1040, 1040, 1040, 1041, 1041, 1041, 1041,
+     1041, 1041, 1041, 1041, 1041,    0,    0, 1041, 1041, 1041,
+     1041, 1041, 1041,    0, 1060, 1063, 1040, 1040, 1040, 1040,
+     1040, 1040, 1131, 1074, 1045, 1045, 1045, 1045, 1045, 1045,
+
+     1045, 1045, 1045, 1041, 1041, 1041, 1041, 1041, 1041, 1042,
+     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1043, 1074,
+     1042, 1042, 1042, 1042, 1042, 1042, 1044, 1044, 1044, 1044,
+     1044, 1044, 1044, 1044, 1044, 1065, 1066, 1045, 1045, 1045,
+     1045, 1045, 1045,    0,    0,    0, 1042, 1042, 1042, 1042,
+     1042, 1042, 1068, 1069,    0,    0,    0,    0,    0,    0,
+     1075, 1065, 1066, 1045, 1045, 1045, 1045, 1045, 1045, 1046,
+     1046, 1046, 1046, 1046, 1046, 1046, 1046, 1046, 1068, 1069,
+     1046, 1046, 1046, 1046, 1046, 1046, 1075,    0, 1076,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0, 1046, 1046, 1046, 1046,
+     1046, 1046, 1053, 1053, 1076, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1053,
+     1053, 1053, 1053, 1053, 1053, 1053, 1053, 1055, 1055,    0,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,    0,
+
+        0, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+     1055, 1055, 1055, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+     1056, 1056, 1077, 1080, 1056, 1056, 1056, 1056, 1056, 1056,
+     1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1078,
+     1079, 1057, 1057, 1057, 1057, 1057, 1057,    0, 1077, 1080,
+     1056, 1056, 1056, 1056, 1056, 1056, 1081, 1084,    0,    0,
+
+        0,    0,    0,    0,    0, 1078, 1079, 1057, 1057, 1057,
+     1057, 1057, 1057, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+     1058, 1058, 1081, 1084, 1058, 1058, 1058, 1058, 1058, 1058,
+     1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1059, 1082,
+     1083, 1059, 1059, 1059, 1059, 1059, 1059,    0,    0, 1085,
+     1058, 1058, 1058, 1058, 1058, 1058,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 1082, 1083, 1059, 1059, 1059,
+     1059, 1059, 1059, 1064, 1064, 1085, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064,
+     1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1067, 1067,
+        0, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+        0,    0, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+
+     1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+     1067, 1067, 1067, 1067, 1071, 1071, 1071, 1071, 1071, 1071,
+     1071, 1071, 1071, 1089, 1090, 1071, 1071, 1071, 1071, 1071,
+     1071, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+     1073, 1091, 1072, 1072, 1072, 1072, 1072, 1072,    0, 1089,
+     1090, 1071, 1071, 1071, 1071, 1071, 1071, 1092, 1093,    0,
+        0,    0,    0,    0,    0,    0,    0, 1091, 1072, 1072,
+     1072, 1072, 1072, 1072, 1086, 1086, 1086, 1086, 1086, 1086,
+     1086, 1086, 1086, 1092, 1093, 1086, 1086, 1086, 1086, 1086,
+     1086, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087, 1087,
+
+     1094, 1095, 1087, 1087, 1087, 1087, 1087, 1087,    0,    0,
+        0, 1086, 1086, 1086, 1086, 1086, 1086, 1096, 1097,    0,
+        0,    0,    0,    0,    0, 1098, 1094, 1095, 1087, 1087,
+     1087, 1087, 1087, 1087, 1088, 1088, 1088, 1088, 1088, 1088,
+     1088, 1088, 1088, 1096, 1097, 1088, 1088, 1088, 1088, 1088,
+     1088, 1098, 1099, 1099, 1099, 1099, 1099, 1099, 1099, 1099,
+     1099, 1103, 1104, 1099, 1099, 1099, 1099, 1099, 1099,    0,
+        0, 1088, 1088, 1088, 1088, 1088, 1088,    0, 1105, 1106,
+        0,    0,    0,    0,    0,    0,    0, 1103, 1104, 1099,
+     1099, 1099, 1099, 1099, 1099, 1100, 1100, 1100, 1100, 1100,
+
+     1100, 1100, 1100, 1100, 1105, 1106, 1100, 1100, 1100, 1100,
+     1100, 1100, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101,
+     1101, 1102, 1107, 1101, 1101, 1101, 1101, 1101, 1101, 1108,
+     1109,    0, 1100, 1100, 1100, 1100, 1100, 1100,    0,    0,
+     1113, 1114,    0,    0,    0,    0,    0,    0, 1107, 1101,
+     1101, 1101, 1101, 1101, 1101, 1108, 1109, 1111, 1111, 1111,
+     1111, 1111, 1111, 1111, 1111, 1111, 1113, 1114, 1111, 1111,
+     1111, 1111, 1111, 1111, 1112, 1112, 1112, 1112, 1112, 1112,
+     1112, 1112, 1112, 1115, 1116, 1112, 1112, 1112, 1112, 1112,
+     1112,    0,    0,    0, 1111, 1111, 1111, 1111, 1111, 1111,
+
+     1121,    0,    0,    0,    0,    0,    0,    0,    0, 1115,
+     1116, 1112, 1112, 1112, 1112, 1112, 1112, 1117, 1117, 1117,
+     1117, 1117, 1117, 1117, 1117, 1117, 1121,    0, 1117, 1117,
+     1117, 1117, 1117, 1117, 1118, 1118, 1118, 1118, 1118, 1118,
+     1118, 1118, 1118,    0,    0, 1118, 1118, 1118, 1118, 1118,
+     1118,    0,    0,    0, 1117, 1117, 1117, 1117, 1117, 1117,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1118, 1118, 1118, 1118, 1118, 1118, 1119, 1119, 1119,
+     1119, 1119, 1119, 1119, 1119, 1119, 1120,    0, 1119, 1119,
+     1119, 1119, 1119, 1119, 1122, 1122, 1122, 1122, 1122, 1122,
+
+     1122, 1122, 1122,    0,    0, 1122, 1122, 1122, 1122, 1122,
+     1122,    0,    0,    0, 1119, 1119, 1119, 1119, 1119, 1119,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1122, 1122, 1122, 1122, 1122, 1122, 1123, 1123, 1123,
+     1123, 1123, 1123, 1123, 1123, 1123,    0,    0, 1123, 1123,
+     1123, 1123, 1123, 1123, 1124, 1124, 1124, 1124, 1124, 1124,
+     1124, 1124, 1124,    0,    0, 1124, 1124, 1124, 1124, 1124,
+     1124,    0,    0,    0, 1123, 1123, 1123, 1123, 1123, 1123,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1124, 1124, 1124, 1124, 1124, 1124, 1126, 1126, 1126,
+
+     1126, 1126, 1126, 1126, 1126, 1126,    0,    0, 1126, 1126,
+     1126, 1126, 1126, 1126, 1127, 1127, 1127, 1127, 1127, 1127,
+     1127, 1127, 1127, 1128,    0, 1127, 1127, 1127, 1127, 1127,
+     1127,    0,    0,    0, 1126, 1126, 1126, 1126, 1126, 1126,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1127, 1127, 1127, 1127, 1127, 1127, 1129, 1129, 1129,
+     1129, 1129, 1129, 1129, 1129, 1129,    0,    0, 1129, 1129,
+     1129, 1129, 1129, 1129, 1130, 1130, 1130, 1130, 1130, 1130,
+     1130, 1130, 1130,    0,    0, 1130, 1130, 1130, 1130, 1130,
+     1130,    0,    0,    0, 1129, 1129, 1129, 1129, 1129, 1129,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1130, 1130, 1130, 1130, 1130, 1130,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    7, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131
     } ;
 
-static yyconst flex_int16_t yy_chk[5849] =
+static yyconst flex_int16_t yy_chk[6514] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -1421,654 +1517,728 @@ static yyconst flex_int16_t yy_chk[5849] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,   10,   10,   11,   11,   15,
-       17,   27, 1090,   15,   16,   16,   16,   16,   16,   16,
-       16,   16,   16,   16,   24,   16,   16,   16,   16,   16,
-
-       16,   28,   16,   37,   61,   24,   17,   27,   24,   28,
-       37,   63,   30,   44,   44,   64,   28,   24,   16, 1086,
-       24,   16,   16,   16,   16,   16,   16,   28,   16,   37,
-       61,   24,   30, 1084,   24,   28,   37,   63,   30,   45,
-       45,   64,   28,   24,   16,   20,   20, 1080,   20,   20,
-       20,   20,   20,   20,   20,   20,   20,   20,   30,   20,
+        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    7,   10,   10,   11,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   13,   13,   18,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   15,   17,   19,   27,   15,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   30,
+       16,   16,   16,   16,   16,   16,   24,   16,   34,   24,
+       43,   17,   34,   27,   52,   97,  111,  145,  159,  163,
+      163,  164,   34,   16,  178,   30,   16,   16,   16,   16,
+
+       16,   16,   24,   16,   34,   24,   20,   20,   34,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   34,   16,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
-
        20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
-       20,   21,   21,   32,   21,   32, 1074,   39,   32, 1066,
-       21, 1065,   21,   39,   46,   46, 1060,   65, 1056,   21,
-     1055,   25, 1051, 1047, 1009, 1000,   40,   21,   21,   32,
-       21,   32,   25,   39,   32,   25,   21,   25,   21,   39,
-      999,   66,   40,   65,   29,   21,   22,   25,   22,   22,
-       29,   22,   40,   69,   69,   67,   29,   22,   25,   22,
-       22,   25,  997,   25,   67,  996,   22,   66,   40,  995,
-       29,  994,   22,  993,   22,   22,   29,   22,  992,   69,
-       69,   67,   29,   22,   31,   22,   22,  989,   31,   70,
-
-       67,   33,   22,   23,   31,   68,   23,   23,   70,   31,
-       31,   23,   33,   71,   23,   33,   23,   23,   33,   74,
-       31,   75,   68,   23,   31,   70,  988,   33,  982,   23,
-       31,   68,   23,   23,   70,   31,   31,   23,   33,   71,
-       23,   33,   23,   23,   33,   74,  981,   75,   68,   23,
-       26,   26,   26,   26,   26,   26,   26,   26,   26,   26,
-       81,   26,   26,   26,   26,   26,   26,  980,   26,   91,
-       79,  971,   26,  970,  969,   26,  958,  957,   73,   34,
-       38,   26,   79,   34,   38,   73,   81,   26,   26,   26,
-       26,   26,   26,   34,   26,   91,   79,   35,   26,   34,
-
-       38,   26,   35,   35,   73,   34,   38,   26,   79,   34,
-       38,   73,   36,   36,   35,   35,  956,   76,   77,   34,
-       77,   83,   36,   35,   78,   34,   38,  942,   35,   35,
-       36,   76,   78,   80,   88,   88,   82,   83,   80,   36,
-       35,   35,   36,   76,   77,  941,   77,   83,   36,  940,
-       78,  928,  927,   82,  926,  912,   36,   76,   78,   80,
-       88,   88,   82,   83,   80,   36,  911,  910,   36,   54,
-       54,   54,   54,   54,   54,   54,   54,   54,   54,   82,
-       54,   54,   54,   54,   54,   54,  893,   54,   56,   56,
-       56,   56,   56,   56,   56,   56,   56,   86,   94,  889,
-
-      888,  887,  886,  863,  860,  100,   54,   54,   54,   54,
-       54,   54,   86,   54,   59,   59,   59,   59,   59,   59,
-       59,   59,   59,   86,   94,   59,   59,   59,   59,   59,
-       59,  100,  858,  857,  837,  831,  830,  829,   86,  828,
-      827,  803,  800,  799,  798,  778,  772,   95,   90,  771,
-       90,   59,   59,   59,   59,   59,   59,   62,   62,   62,
-       62,   62,   62,   62,   62,   62,   62,   84,   62,   62,
-       62,   62,   62,   62,   90,   62,   90,  770,  769,  755,
-       92,   95,   72,  742,   85,   92,   87,   84,   62,   85,
-       72,  740,  739,   84,   62,   62,   62,   62,   62,   62,
-
-       87,   62,   72,   85,   85,   89,   92,   95,   72,   97,
-       85,   92,   87,   84,   62,   85,   72,   89,   93,   93,
-       89,   96,  102,  108,  106,   97,   87,   96,   72,   85,
-       85,   89,   98,  101,  103,   97,  101,   98,   99,  103,
-       99,   99,  102,   89,   93,   93,   89,   96,  102,   99,
-      106,   97,  104,   96,  105,  107,  110,  108,   98,  101,
-      103,  112,  101,   98,   99,  103,   99,   99,  102,  104,
-      112,  109,  104,  105,  111,   99,  127,  113,  104,  109,
-      105,  107,  110,  108,  113,  114,  111,  112,  114,  115,
-      128,  115,  738,  709,  703,  104,  112,  109,  104,  105,
-
-      111,  702,  127,  113,  701,  109,  700,  660,  658,  131,
-      113,  114,  111,  657,  114,  115,  128,  115,  118,  118,
-      118,  118,  118,  118,  118,  118,  118,  118,  134,  118,
-      118,  118,  118,  118,  118,  131,  118,  120,  120,  120,
-      120,  120,  120,  120,  120,  120,  137,  137,  656,  610,
-      603,  602,  601,  600,  134,  118,  118,  118,  118,  118,
-      118,  542,  118,  122,  122,  122,  122,  122,  122,  122,
-      122,  122,  137,  137,  122,  122,  122,  122,  122,  122,
-      125,  181,  125,  125,  125,  125,  125,  125,  125,  125,
-      125,  539,  146,  538,  537,  475,  466,  465,  464,  146,
-
-      122,  122,  122,  122,  122,  122,  124,  181,  124,  124,
-      124,  124,  124,  124,  124,  124,  124,  124,  146,  124,
-      124,  124,  124,  124,  124,  146,  183,  183,  183,  183,
-      183,  183,  183,  183,  183,  189,  189,  189,  189,  189,
-      189,  189,  189,  189,  463,  124,  124,  124,  124,  124,
-      124,  126,  126,  126,  126,  126,  126,  126,  126,  126,
-      126,  132,  126,  126,  126,  126,  126,  126,  129,  130,
-      133,  129,  398,  395,  132,  130,  135,  138,  135,  138,
-      133,  139,  136,  140,  141,  139,  394,  132,  126,  126,
-      126,  126,  126,  126,  129,  130,  133,  129,  136,  140,
-
-      132,  130,  135,  138,  135,  138,  133,  139,  136,  140,
-      142,  139,  143,  393,  145,  144,  145,  147,  141,  147,
-      333,  148,  150,  325,  136,  140,  324,  323,  149,  143,
-      142,  144,  153,  151,  150,  152,  142,  158,  143,  148,
-      145,  144,  145,  147,  141,  147,  149,  148,  150,  151,
-      154,  152,  159,  155,  149,  143,  142,  144,  322,  151,
-      150,  152,  156,  156,  159,  148,  153,  155,  154,  157,
-      157,  158,  149,  160,  161,  151,  154,  152,  159,  155,
-      162,  264,  160,  161,  163,  164,  160,  165,  156,  156,
-      159,  160,  153,  155,  154,  162,  163,  158,  170,  160,
-
-      161,  164,  167,  167,  157,  254,  162,  165,  160,  161,
-      163,  164,  160,  165,  166,  169,  253,  160,  169,  168,
-      166,  162,  163,  171,  171,  172,  175,  164,  167,  167,
-      157,  168,  170,  165,  173,  174,  173,  172,  176,  252,
-      166,  169,  175,  178,  169,  168,  166,  177,  194,  171,
-      171,  172,  175,  174,  176,  178,  180,  168,  170,  179,
-      173,  174,  173,  172,  176,  177,  180,  196,  175,  178,
-      197,  200,  197,  177,  194,  205,  179,  251,  223,  174,
-      176,  178,  180,  186,  185,  179,  184,  200,  121,  119,
-       55,  177,  180,  196,   51,   50,  197,  200,  197,   47,
-
-      198,  205,  179,  182,  182,  182,  182,  182,  182,  182,
-      182,  182,  182,  200,  182,  182,  182,  182,  182,  182,
-      188,  182,  188,  188,  188,  188,  188,  188,  188,  188,
-      188,   42,   19,   18,  198,   14,   12,    7,    4,    3,
-      182,  182,  182,  182,  182,  182,    0,  182,  187,    0,
-      187,  187,  187,  187,  187,  187,  187,  187,  187,  187,
-      198,  187,  187,  187,  187,  187,  187,  192,  209,  192,
-      192,  192,  192,  192,  192,  192,  192,  192,    0,  202,
-        0,    0,    0,    0,    0,    0,  202,  187,  187,  187,
-      187,  187,  187,  190,  209,  190,  190,  190,  190,  190,
-
-      190,  190,  190,  190,  190,  202,  190,  190,  190,  190,
-      190,  190,  202,  195,  199,  250,  250,  250,  250,  250,
-      250,  250,  250,  250,  250,    0,    0,    0,    0,  215,
-      215,  195,  190,  190,  190,  190,  190,  190,  191,  191,
-      191,  191,  191,  191,  191,  191,  191,  195,  199,  191,
-      191,  191,  191,  191,  191,  215,  215,  195,    0,    0,
-        0,    0,    0,    0,    0,  204,    0,    0,    0,    0,
-        0,    0,    0,  195,  199,  191,  191,  191,  191,  191,
-      191,  193,  193,  193,  193,  193,  193,  193,  193,  193,
-      203,    0,  193,  193,  193,  193,  193,  193,  201,  204,
-
-      201,  206,  207,  206,  207,  208,  210,  212,  222,  210,
-      203,  213,    0,  213,    0,    0,  203,  208,  193,  193,
-      193,  193,  193,  193,  201,  204,  201,  206,  207,  206,
-      207,  208,  210,  211,  214,  210,  203,  213,  216,  213,
-      220,  212,  222,  208,  217,  216,    0,  217,  221,  211,
-      214,  218,  218,  220,    0,    0,    0,    0,    0,  211,
-      214,  221,    0,  225,  216,  225,  220,  212,  222,  224,
-      217,  216,  219,  217,  221,  211,  214,  218,  218,  220,
-      228,  219,  219,  219,  224,  230,  224,  221,  226,  225,
-      219,  225,  227,  229,  226,  224,  228,  231,  219,  229,
-
-      232,  227,    0,  233,  235,  235,  228,  219,  219,  219,
-      224,  230,  224,  231,  226,  244,  219,  232,  227,  229,
-      226,  233,  228,  231,  234,  229,  232,  227,  234,  233,
-      235,  235,  236,  237,  241,  238,  240,  243,  237,  231,
-      239,  241,  245,  232,  242,  242,  243,  233,  236,  244,
-      234,  238,  240,  246,  234,  239,  249,  239,  236,  237,
-      241,  238,  240,  243,  237,  247,  239,  241,  245,  268,
-      242,  242,  243,  246,  236,  244,  274,  238,  240,  246,
-      248,  239,  247,  239,  265,  265,  248,  267,  274,  267,
-      249,  247,    0,    0,    0,  268,    0,    0,    0,  246,
-
-        0,  280,  274,    0,  271,    0,  248,    0,  247,    0,
-      265,  265,  248,  267,  274,  267,  249,  255,  255,  255,
-      255,  255,  255,  255,  255,  255,  256,  280,  256,  256,
-      256,  256,  256,  256,  256,  256,  256,  256,  271,  256,
-      256,  256,  256,  256,  256,  258,    0,  258,  258,  258,
-      258,  258,  258,  258,  258,  258,    0,    0,    0,    0,
-        0,    0,    0,    0,  271,  256,  256,  256,  256,  256,
-      256,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      270,  306,  257,  257,  257,  257,  257,  257,  259,  270,
-      259,  259,  259,  259,  259,  259,  259,  259,  259,    0,
-
-      272,    0,    0,    0,    0,    0,  270,  306,  257,  257,
-      257,  257,  257,  257,  260,  270,  260,  260,  260,  260,
-      260,  260,  260,  260,  260,  260,  293,  260,  260,  260,
-      260,  260,  260,  261,  272,  261,  261,  261,  261,  261,
-      261,  261,  261,  261,    0,  293,    0,    0,    0,    0,
-        0,    0,  293,  260,  260,  260,  260,  260,  260,  262,
-      272,  262,  262,  262,  262,  262,  262,  262,  262,  262,
-      262,  293,  262,  262,  262,  262,  262,  262,  263,    0,
-      263,  263,  263,  263,  263,  263,  263,  263,  263,  266,
-      273,  273,  276,  276,  266,  269,  269,  269,  262,  262,
-
-      262,  262,  262,  262,  275,  269,  278,  282,  275,  275,
-      277,  281,  279,  278,  283,  266,  273,  273,  276,  276,
-      266,  269,  269,  269,  279,  286,  277,  292,  281,    0,
-      275,  269,  278,  284,  275,  275,  277,  281,  279,  278,
-      286,  282,  289,  285,  287,  284,    0,  288,  283,  294,
-      279,  286,  277,  288,  281,  285,  287,  290,  289,  284,
-      291,  292,  294,  290,    0,    0,  286,  282,  289,  285,
-      287,  284,  296,  288,  283,  294,  295,  297,  296,  288,
-      291,  285,  287,  290,  289,  298,  291,  292,  294,  290,
-      299,  295,  300,  297,  304,  305,  305,  299,  296,  302,
-
-      301,  298,  295,  297,  296,  302,  291,  301,  307,  308,
-      303,  298,  300,  303,  309,  309,  299,  295,  300,  297,
-      310,  305,  305,  299,  307,  302,  301,  298,  304,  312,
-      314,  302,  319,  301,  307,  308,  303,  311,  300,  303,
-      309,  309,  313,  311,  314,  312,  310,  316,  317,  315,
-      307,  313,  315,  317,  304,  312,  314,  318,  320,  318,
-      338,  320,  348,  311,  321,  348,  319,  316,  313,  311,
-      314,  312,    0,  316,  317,  315,    0,  313,  315,  317,
-      338,  321,    0,  318,  320,  318,  338,  320,  348,    0,
-      321,  348,  319,  316,  326,    0,  326,  326,  326,  326,
-
-      326,  326,  326,  326,  326,    0,  338,  321,  327,    0,
-      327,  327,  327,  327,  327,  327,  327,  327,  327,  327,
-        0,  327,  327,  327,  327,  327,  327,  328,  352,  328,
-      328,  328,  328,  328,  328,  328,  328,  328,  331,  331,
-      331,  331,  331,  331,  331,  331,  331,  327,  327,  327,
-      327,  327,  327,  329,  352,  329,  329,  329,  329,  329,
-      329,  329,  329,  329,  329,  368,  329,  329,  329,  329,
-      329,  329,  330,  341,  330,  330,  330,  330,  330,  330,
-      330,  330,  330,    0,    0,  341,    0,    0,  337,    0,
-        0,  368,  329,  329,  329,  329,  329,  329,  332,  341,
-
-      332,  332,  332,  332,  332,  332,  332,  332,  332,  332,
-      334,  341,  334,  334,  334,  334,  334,  334,  334,  334,
-      334,  334,  337,  334,  334,  334,  334,  334,  334,  336,
-        0,  336,  336,  336,  336,  336,  336,  336,  336,  336,
-        0,    0,    0,    0,    0,  350,    0,    0,  337,  334,
-      334,  334,  334,  334,  334,  335,  335,  335,  335,  335,
-      335,  335,  335,  335,  340,  342,  335,  335,  335,  335,
-      335,  335,  339,  343,  339,  344,  345,  344,  347,  350,
-      340,  342,  369,  351,  345,  347,  351,    0,    0,  343,
-      340,  342,  335,  335,  335,  335,  335,  335,  339,  343,
-
-      339,  344,  345,  344,  347,  350,  340,  342,  369,  351,
-      345,  347,  351,  354,  349,  343,  346,  346,    0,  346,
-      346,  346,  346,  346,  346,  346,  349,  346,  353,  359,
-      354,  357,  357,  355,  356,    0,  353,  346,  346,  354,
-      349,  355,  356,  358,  358,  360,    0,  362,  362,  359,
-        0,    0,  349,  360,  353,  359,  354,  357,  357,  355,
-      356,  363,  353,  361,  373,  365,  379,  355,  356,  358,
-      358,  360,  361,  362,  362,  359,  364,  365,  363,  360,
-      366,  374,  367,  374,  364,  370,  366,  363,  367,  361,
-      373,  365,  371,  370,  372,  371,  376,  372,  361,  375,
-
-      379,  380,  364,  365,  363,  376,  366,  374,  367,  374,
-      364,  370,  366,  375,  367,  378,  377,  381,  371,  370,
-      372,  371,  376,  372,  383,  375,  379,  383,  382,  377,
-      384,  376,  377,  378,  385,  380,  382,  386,  387,  375,
-      387,  378,  377,  381,  391,  388,  384,  389,  389,  386,
-      383,  388,    0,  383,  382,  377,  384,  392,  377,  378,
-      385,  380,  382,  386,  387,    0,  387,  390,  417,  392,
-      420,  388,  384,  389,  389,  386,  390,  388,  391,    0,
-        0,    0,    0,  392,  396,  396,  396,  396,  396,  396,
-      396,  396,  396,  390,  417,  392,  420,    0,    0,    0,
-
-        0,  440,  390,  397,  391,  397,  397,  397,  397,  397,
-      397,  397,  397,  397,  397,  399,    0,  399,  399,  399,
-      399,  399,  399,  399,  399,  399,  399,  440,  399,  399,
-      399,  399,  399,  399,  401,  410,  401,  401,  401,  401,
-      401,  401,  401,  401,  401,  473,  473,  473,  473,  473,
-      473,  473,  473,  473,  399,  399,  399,  399,  399,  399,
-      400,  400,  400,  400,  400,  400,  400,  400,  400,  410,
-      422,  400,  400,  400,  400,  400,  400,  402,  422,  402,
-      402,  402,  402,  402,  402,  402,  402,  402,    0,  441,
-        0,    0,    0,    0,    0,  410,  422,  400,  400,  400,
-
-      400,  400,  400,  403,  422,  403,  403,  403,  403,  403,
-      403,  403,  403,  403,  404,  441,  404,  404,  404,  404,
-      404,  404,  404,  404,  404,  404,  447,  404,  404,  404,
-      404,  404,  404,  405,  459,  405,  405,  405,  405,  405,
-      405,  405,  405,  405,    0,  490,    0,    0,    0,    0,
-        0,    0,  447,  404,  404,  404,  404,  404,  404,  406,
-      459,  406,  406,  406,  406,  406,  406,  406,  406,  406,
-      406,  490,  406,  406,  406,  406,  406,  406,  407,    0,
-      407,  407,  407,  407,  407,  407,  407,  407,  407,  409,
-      411,  412,  409,    0,  411,  413,  413,  415,  406,  406,
-
-      406,  406,  406,  406,  408,  414,  412,  408,  416,  415,
-        0,    0,    0,  408,    0,  409,  411,  412,  409,  418,
-      411,  413,  413,  415,  425,  414,  419,  419,  416,  418,
-      408,  414,  412,  408,  416,  415,  421,  418,  418,  408,
-      425,    0,  421,  424,  424,  418,    0,    0,    0,  426,
-      425,  414,  419,  419,  416,  418,  426,  429,  428,  423,
-      430,  431,  421,  418,  418,  423,  425,  423,  421,  424,
-      424,  427,  423,  429,  432,  426,  430,  427,  428,  431,
-      434,    0,  426,  429,  428,  423,  430,  431,  433,  505,
-      432,  423,  435,  423,  433,  436,  434,  427,  423,  429,
-
-      432,    0,  430,  427,  428,  431,  434,  438,  435,  437,
-      438,  436,  439,    0,  433,  505,  432,  439,  435,  442,
-      433,  436,  434,    0,  437,  443,  443,  444,  444,  445,
-      449,  445,  448,  438,  435,  437,  438,  436,  439,  442,
-      446,  446,  448,  439,  451,  442,  449,  452,    0,  448,
-      437,  443,  443,  444,  444,  445,  449,  445,  448,  452,
-      453,    0,  451,  450,  456,  442,  446,  446,  448,  450,
-      451,  456,  449,  452,  483,  448,  454,  454,    0,  455,
-      453,  455,  457,  483,  457,  452,  453,  458,  451,  450,
-      456,  461,  460,  461,  458,  450,  462,  456,  489,  462,
-
-      483,  489,  454,  454,  460,  455,  453,  455,  457,  483,
-      457,    0,    0,  458,    0,  507,    0,  461,  460,  461,
-      458,    0,  462,    0,  489,  462,  510,  489,    0,  467,
-      460,  467,  467,  467,  467,  467,  467,  467,  467,  467,
-      468,  507,  468,  468,  468,  468,  468,  468,  468,  468,
-      468,  469,  510,  469,  469,  469,  469,  469,  469,  469,
-      469,  469,  469,  496,  469,  469,  469,  469,  469,  469,
-      470,  496,  470,  470,  470,  470,  470,  470,  470,  470,
-      470,    0,  484,    0,    0,    0,    0,    0,    0,  496,
-      469,  469,  469,  469,  469,  469,  471,  496,  471,  471,
-
-      471,  471,  471,  471,  471,  471,  471,  471,  482,  471,
-      471,  471,  471,  471,  471,  472,  484,  472,  472,  472,
-      472,  472,  472,  472,  472,  472,    0,    0,  482,    0,
-        0,    0,    0,    0,  482,  471,  471,  471,  471,  471,
-      471,  474,  484,  474,  474,  474,  474,  474,  474,  474,
-      474,  474,  474,  476,  482,  476,  476,  476,  476,  476,
-      476,  476,  476,  476,  476,    0,  476,  476,  476,  476,
-      476,  476,  478,    0,  478,  478,  478,  478,  478,  478,
-      478,  478,  478,    0,    0,    0,    0,    0,    0,    0,
-        0,  479,  476,  476,  476,  476,  476,  476,  477,  477,
-
-      477,  477,  477,  477,  477,  477,  477,  479,  480,  477,
-      477,  477,  477,  477,  477,  480,  481,  479,  486,  487,
-      488,  487,    0,  481,    0,  488,    0,  485,  492,  494,
-      494,  486,  504,  479,  480,  477,  477,  477,  477,  477,
-      477,  480,  481,  485,  486,  487,  488,  487,  492,  481,
-      491,  488,  493,  485,  492,  494,  494,  486,  497,  491,
-      500,  495,  498,  499,  497,  502,  504,  500,  493,  485,
-      501,  498,  501,    0,  492,    0,  491,  495,  493,  499,
-      503,  511,  502,  503,  497,  491,  500,  495,  498,  499,
-      497,  502,  504,  500,  493,  506,  501,  498,  501,  508,
-
-      512,  509,  508,  495,  514,  499,  503,  511,  502,  503,
-      509,  506,  513,  515,  513,  516,  518,  517,  519,  520,
-      521,  506,  522,    0,    0,  508,  512,  509,  508,  517,
-      514,  523,  518,  521,  519,  524,  509,  506,  513,  515,
-      513,  516,  518,  517,  519,  520,  521,  527,  532,  523,
-      529,  536,  524,  528,  525,  517,  522,  523,  518,  521,
-      519,  524,  525,  526,  527,  528,  529,  530,  534,  530,
-      531,  533,  526,  527,  532,  523,  529,  536,  524,  528,
-      525,  535,  522,  534,  531,  562,  535,  533,  525,  526,
-      527,  528,  529,  530,  534,  530,  531,  533,  526,    0,
-
-        0,    0,    0,    0,    0,    0,    0,  535,    0,  534,
-      531,  562,  535,  533,  540,  540,  540,  540,  540,  540,
-      540,  540,  540,  541,    0,  541,  541,  541,  541,  541,
-      541,  541,  541,  541,  541,  543,    0,  543,  543,  543,
-      543,  543,  543,  543,  543,  543,  543,    0,  543,  543,
-      543,  543,  543,  543,  545,    0,  545,  545,  545,  545,
-      545,  545,  545,  545,  545,  546,  546,  546,  546,  546,
-      546,  546,  546,  546,  543,  543,  543,  543,  543,  543,
-      544,  544,  544,  544,  544,  544,  544,  544,  544,  551,
-      554,  544,  544,  544,  544,  544,  544,  548,  554,  548,
-
-      548,  548,  548,  548,  548,  548,  548,  548,    0,  551,
-        0,    0,    0,    0,    0,  551,  554,  544,  544,  544,
-      544,  544,  544,  547,  554,  547,  547,  547,  547,  547,
-      547,  547,  547,  547,  547,  551,  547,  547,  547,  547,
-      547,  547,  550,  579,  550,  550,  550,  550,  550,  550,
-      550,  550,  550,  604,  604,  604,  604,  604,  604,  604,
-      604,  604,  547,  547,  547,  547,  547,  547,  549,  579,
-      549,  549,  549,  549,  549,  549,  549,  549,  549,  549,
-      552,  549,  549,  549,  549,  549,  549,  553,  555,  552,
-      556,  557,  557,    0,  561,  558,    0,  553,    0,  556,
-
-      555,  558,    0,  559,  560,    0,  552,  549,  549,  549,
-      549,  549,  549,  553,  555,  552,  556,  557,  557,  559,
-      560,  558,  563,  553,  568,  556,  555,  558,  561,  559,
-      560,  564,  565,  569,  564,  566,  570,  567,    0,  565,
-      569,  566,  563,  567,  568,  559,  560,  573,  563,  571,
-      568,  575,  571,  577,  561,    0,  570,  564,  565,  569,
-      564,  566,  570,  567,  574,  565,  569,  566,  563,  567,
-      568,  572,  572,  580,  581,  571,  576,  578,  571,  578,
-      574,  573,  570,  582,  576,  575,  583,  577,  584,  585,
-      574,  584,  585,  583,  586,  587,  592,  572,  572,  580,
-
-      581,  589,  576,  578,  587,  578,  574,  573,  588,  582,
-      576,  575,  583,  577,  584,  585,  591,  584,  585,  583,
-      586,  587,  592,  590,  588,  593,  594,  595,  591,  594,
-      587,  590,  593,  596,  588,  589,  597,  614,  623,  614,
-      598,  625,  591,    0,  599,    0,    0,  627,    0,  590,
-      588,  593,  594,  595,  591,  594,  598,  590,  593,  596,
-      599,  589,  597,  614,  623,  614,  598,  625,    0,  606,
-      599,  606,  606,  606,  606,  606,  606,  606,  606,  606,
-        0,  627,  598,    0,    0,    0,  599,  605,    0,  605,
-      605,  605,  605,  605,  605,  605,  605,  605,  605,  630,
-
-      605,  605,  605,  605,  605,  605,  608,  627,  608,  608,
-      608,  608,  608,  608,  608,  608,  608,    0,  634,    0,
-        0,    0,    0,    0,    0,  630,  605,  605,  605,  605,
-      605,  605,  607,    0,  607,  607,  607,  607,  607,  607,
-      607,  607,  607,  607,  634,  607,  607,  607,  607,  607,
-      607,  609,  637,  609,  609,  609,  609,  609,  609,  609,
-      609,  609,  609,  641,    0,    0,    0,    0,    0,    0,
-        0,  607,  607,  607,  607,  607,  607,  611,  637,  611,
-      611,  611,  611,  611,  611,  611,  611,  611,  611,  641,
-      611,  611,  611,  611,  611,  611,  613,    0,  613,  613,
-
-      613,  613,  613,  613,  613,  613,  613,    0,    0,    0,
-        0,    0,    0,    0,    0,  619,  611,  611,  611,  611,
-      611,  611,  612,  612,  612,  612,  612,  612,  612,  612,
-      612,  619,  621,  612,  612,  612,  612,  612,  612,  615,
-      616,  619,  617,  615,  617,    0,  618,  616,  618,  621,
-      622,    0,    0,    0,  622,  620,    0,  619,  621,  612,
-      612,  612,  612,  612,  612,  615,  616,  620,  617,  615,
-      617,  628,  618,  616,  618,  621,  622,  624,  629,  632,
-      622,  620,  626,  631,  626,    0,  624,  633,  628,    0,
-      640,  635,    0,  620,  639,  632,  629,  628,  636,  633,
-
-      639,  631,  640,  624,  629,  632,  638,  642,  626,  631,
-      626,  635,  624,  633,  628,  638,  640,  635,  636,  643,
-      639,  632,  629,  644,  636,  633,  639,  631,  640,  645,
-      646,  647,  638,  642,  648,  651,  650,  635,  649,  652,
-      653,  638,    0,  647,  636,  643,  669,  649,  650,  644,
-      655,  651,  654,  654,    0,  645,  646,  647,    0,    0,
-      648,  651,  650,    0,  649,  652,  653,  671,  655,  647,
-      675,    0,  669,  649,  650,    0,  655,  651,  654,  654,
-      659,  676,  659,  659,  659,  659,  659,  659,  659,  659,
-      659,  659,    0,  671,  655,  661,  675,  661,  661,  661,
-
-      661,  661,  661,  661,  661,  661,  661,  676,  661,  661,
-      661,  661,  661,  661,  663,    0,  663,  663,  663,  663,
-      663,  663,  663,  663,  663,    0,    0,    0,    0,    0,
-        0,    0,  678,    0,  661,  661,  661,  661,  661,  661,
-      662,  662,  662,  662,  662,  662,  662,  662,  662,  672,
-      672,  662,  662,  662,  662,  662,  662,  665,  678,  665,
-      665,  665,  665,  665,  665,  665,  665,  665,    0,    0,
-        0,    0,    0,    0,    0,  672,  672,  662,  662,  662,
-      662,  662,  662,  664,    0,  664,  664,  664,  664,  664,
-      664,  664,  664,  664,  664,  674,  664,  664,  664,  664,
-
-      664,  664,  667,  674,  667,  667,  667,  667,  667,  667,
-      667,  667,  667,    0,    0,    0,    0,    0,    0,    0,
-      684,  674,  664,  664,  664,  664,  664,  664,  666,  674,
-      666,  666,  666,  666,  666,  666,  666,  666,  666,  666,
-      668,  666,  666,  666,  666,  666,  666,  670,  673,  677,
-      679,  680,  679,  670,  684,  673,  668,  681,  682,  685,
-      680,  683,  683,  681,  682,  677,  668,  666,  666,  666,
-      666,  666,  666,  670,  673,  677,  679,  680,  679,  670,
-      684,  673,  668,  681,  682,  685,  680,  683,  683,  681,
-      682,  677,  686,  687,  688,  694,  689,  690,  691,  686,
-
-      697,  695,  687,  696,  696,  698,  699,  697,  715,  716,
-      694,  688,  689,  695,  690,  691,  720,  698,  686,  687,
-      688,  694,  689,  690,  691,  686,  697,  695,  687,  696,
-      696,  698,  699,  697,  715,  716,  694,  688,  689,  695,
-      690,  691,  720,  698,  704,    0,  704,  704,  704,  704,
-      704,  704,  704,  704,  704,  704,  721,  704,  704,  704,
-      704,  704,  704,  705,  725,  705,  705,  705,  705,  705,
-      705,  705,  705,  705,    0,    0,    0,    0,    0,    0,
-        0,    0,  721,  704,  704,  704,  704,  704,  704,  706,
-      725,  706,  706,  706,  706,  706,  706,  706,  706,  706,
-
-      706,  719,  706,  706,  706,  706,  706,  706,  707,  727,
-      707,  707,  707,  707,  707,  707,  707,  707,  707,    0,
-        0,  719,    0,    0,    0,    0,    0,  719,  706,  706,
-      706,  706,  706,  706,  708,  727,  708,  708,  708,  708,
-      708,  708,  708,  708,  708,  708,  710,  719,  710,  710,
-      710,  710,  710,  710,  710,  710,  710,  710,    0,  710,
-      710,  710,  710,  710,  710,  712,    0,  712,  712,  712,
-      712,  712,  712,  712,  712,  712,    0,    0,    0,    0,
-        0,    0,    0,    0,  717,  710,  710,  710,  710,  710,
-      710,  711,  711,  711,  711,  711,  711,  711,  711,  711,
-
-      717,  718,  711,  711,  711,  711,  711,  711,  713,  714,
-      717,  714,  713,  723,  724,  728,  723,  718,    0,    0,
-      722,  732,    0,  724,    0,  730,  717,  718,  711,  711,
-      711,  711,  711,  711,  713,  714,  722,  714,  713,  723,
-      724,  728,  723,  718,  726,  730,  722,  729,  734,  724,
-      726,  730,  726,  731,  735,  732,  733,  736,  736,  737,
-      750,  751,  722,  734,  729,  752,  758,  737,  751,  731,
-      726,  730,  733,  729,  734,    0,  726,    0,  726,  731,
-      735,  732,  733,  736,  736,  737,  750,  751,    0,  734,
-      729,  752,  758,  737,  751,  731,    0,  741,  733,  741,
-
-      741,  741,  741,  741,  741,  741,  741,  741,  741,  743,
-        0,  743,  743,  743,  743,  743,  743,  743,  743,  743,
-      743,  763,  743,  743,  743,  743,  743,  743,  745,    0,
-      745,  745,  745,  745,  745,  745,  745,  745,  745,    0,
-        0,    0,    0,    0,    0,    0,  789,  763,  743,  743,
-      743,  743,  743,  743,  744,  744,  744,  744,  744,  744,
-      744,  744,  744,  756,  796,  744,  744,  744,  744,  744,
-      744,  747,  789,  747,  747,  747,  747,  747,  747,  747,
-      747,  747,    0,  756,    0,    0,    0,    0,    0,  756,
-      796,  744,  744,  744,  744,  744,  744,  746,  789,  746,
-
-      746,  746,  746,  746,  746,  746,  746,  746,  746,  756,
-      746,  746,  746,  746,  746,  746,  749,  797,  749,  749,
-      749,  749,  749,  749,  749,  749,  749,    0,  757,    0,
-        0,    0,    0,    0,    0,    0,  746,  746,  746,  746,
-      746,  746,  748,  797,  748,  748,  748,  748,  748,  748,
-      748,  748,  748,  748,  759,  748,  748,  748,  748,  748,
-      748,  753,  757,  754,  753,  754,  760,  761,    0,  764,
-      761,  759,  762,  783,  762,  764,  765,  765,  766,  760,
-      759,  748,  748,  748,  748,  748,  748,  753,  757,  754,
-      753,  754,  760,  761,  766,  764,  761,  759,  762,  768,
-
-      762,  764,  765,  765,  766,  760,  767,  783,  767,  784,
-      814,  793,  782,  784,  793,  768,    0,  815,    0,    0,
-      766,    0,    0,    0,    0,  768,    0,    0,  782,    0,
-        0,    0,  767,  783,  767,  784,  814,  793,  782,  784,
-      793,  768,  773,  815,  773,  773,  773,  773,  773,  773,
-      773,  773,  773,  773,  782,  773,  773,  773,  773,  773,
-      773,  774,  816,  774,  774,  774,  774,  774,  774,  774,
-      774,  774,    0,  813,    0,    0,    0,    0,    0,    0,
-        0,  773,  773,  773,  773,  773,  773,  775,  816,  775,
-      775,  775,  775,  775,  775,  775,  775,  775,  775,  790,
-
-      775,  775,  775,  775,  775,  775,  776,  813,  776,  776,
-      776,  776,  776,  776,  776,  776,  776,    0,    0,  790,
-        0,    0,    0,    0,    0,  790,  775,  775,  775,  775,
-      775,  775,  777,  813,  777,  777,  777,  777,  777,  777,
-      777,  777,  777,  777,  779,  790,  779,  779,  779,  779,
-      779,  779,  779,  779,  779,  779,    0,  779,  779,  779,
-      779,  779,  779,  781,    0,  781,  781,  781,  781,  781,
-      781,  781,  781,  781,    0,    0,    0,    0,    0,    0,
-      820,    0,  785,  779,  779,  779,  779,  779,  779,  780,
-      780,  780,  780,  780,  780,  780,  780,  780,  785,  786,
-
-      780,  780,  780,  780,  780,  780,  820,  787,  785,  787,
-        0,    0,    0,  795,  795,  786,  788,  823,  819,  811,
-      791,  792,  811,  819,  785,  786,  780,  780,  780,  780,
-      780,  780,  788,  787,  788,  787,  791,  792,  794,  795,
-      795,  786,  788,  823,  819,  811,  791,  792,  811,  819,
-      794,    0,    0,    0,    0,    0,    0,    0,  788,    0,
-      788,    0,  791,  792,  794,    0,    0,    0,    0,  821,
-      821,  821,    0,  821,    0,  802,  794,  802,  802,  802,
-      802,  802,  802,  802,  802,  802,  802,  804,    0,  804,
-      804,  804,  804,  804,  804,  804,  804,  804,  804,  821,
-
-      804,  804,  804,  804,  804,  804,  806,    0,  806,  806,
-      806,  806,  806,  806,  806,  806,  806,    0,    0,    0,
-        0,    0,    0,    0,    0,  821,  804,  804,  804,  804,
-      804,  804,  805,  805,  805,  805,  805,  805,  805,  805,
-      805,  818,  844,  805,  805,  805,  805,  805,  805,  808,
-      818,  808,  808,  808,  808,  808,  808,  808,  808,  808,
-        0,  845,    0,    0,    0,    0,    0,  818,  844,  805,
-      805,  805,  805,  805,  805,  807,  818,  807,  807,  807,
-      807,  807,  807,  807,  807,  807,  807,  845,  807,  807,
-      807,  807,  807,  807,  810,    0,  810,  810,  810,  810,
-
-      810,  810,  810,  810,  810,    0,  812,    0,    0,    0,
-        0,    0,    0,    0,  807,  807,  807,  807,  807,  807,
-      809,  812,  809,  809,  809,  809,  809,  809,  809,  809,
-      809,  809,  812,  809,  809,  809,  809,  809,  809,  817,
-      822,  824,  822,  825,  826,  841,  842,  812,  846,  841,
-      842,  825,  849,  869,  874,  817,  826,  875,  824,  809,
-      809,  809,  809,  809,  809,  817,  822,  824,  822,  825,
-      826,  841,  842,    0,  846,  841,  842,  825,  849,  869,
-      874,  817,  826,  875,  824,  832,    0,  832,  832,  832,
-      832,  832,  832,  832,  832,  832,  832,  856,  832,  832,
-
-      832,  832,  832,  832,  833,  856,  833,  833,  833,  833,
-      833,  833,  833,  833,  833,    0,    0,    0,  851,    0,
-      852,    0,    0,  856,  832,  832,  832,  832,  832,  832,
-      834,  856,  834,  834,  834,  834,  834,  834,  834,  834,
-      834,  851,  847,  834,  834,  834,  834,  834,  834,  835,
-      852,  835,  835,  835,  835,  835,  835,  835,  835,  835,
-        0,    0,  847,    0,    0,    0,    0,  851,  847,  834,
-      834,  834,  834,  834,  834,  836,  852,  836,  836,  836,
-      836,  836,  836,  836,  836,  836,  836,  838,  847,  838,
-      838,  838,  838,  838,  838,  838,  838,  838,  838,    0,
-
-      838,  838,  838,  838,  838,  838,  840,  848,  840,  840,
-      840,  840,  840,  840,  840,  840,  840,  853,  850,  853,
-      843,  850,  854,  848,  872,  855,  838,  838,  838,  838,
-      838,  838,  843,  848,  876,  882,  876,  884,  854,  843,
-      843,  855,  870,  853,  872,  853,  843,  850,  854,  848,
-      872,  855,    0,    0,    0,    0,    0,    0,  843,  870,
-      876,  882,  876,  884,  854,  843,  843,  855,  870,  878,
-      872,    0,  862,  850,  862,  862,  862,  862,  862,  862,
-      862,  862,  862,  862,  864,  870,  864,  864,  864,  864,
-      864,  864,  864,  864,  864,  900,  878,  864,  864,  864,
-
-      864,  864,  864,  865,  904,  865,  865,  865,  865,  865,
-      865,  865,  865,  865,    0,    0,    0,    0,    0,    0,
-        0,  900,  878,  864,  864,  864,  864,  864,  864,  866,
-      904,  866,  866,  866,  866,  866,  866,  866,  866,  866,
-      866,  871,  866,  866,  866,  866,  866,  866,  867,  879,
-      867,  867,  867,  867,  867,  867,  867,  867,  867,  871,
-      873,  877,  880,    0,  881,  885,  873,  871,  866,  866,
-      866,  866,  866,  866,  879,  895,  899,  883,  873,  877,
-      883,  885,  895,  905,  899,  871,  873,  877,    0,  880,
-      898,  885,  873,  881,    0,  898,    0,    0,    0,    0,
-
-      879,  895,  899,  883,  873,  877,  883,  885,  895,  905,
-      899,    0,    0,    0,  896,  880,  898,    0,    0,  881,
-      890,  898,  890,  890,  890,  890,  890,  890,  890,  890,
-      890,  906,  896,  890,  890,  890,  890,  890,  890,  891,
-      896,  891,  891,  891,  891,  891,  891,  891,  891,  891,
-        0,  897,  907,  902,  897,  902,    0,  906,  896,  890,
-      890,  890,  890,  890,  890,  892,  908,  892,  892,  892,
-      892,  892,  892,  892,  892,  892,  892,  897,  907,  902,
-      897,  902,  903,  903,  909,  903,  903,  903,  903,  903,
-      903,  919,  908,  903,  917,  920,    0,  923,  923,    0,
-
-        0,    0,    0,  903,  903,  918,  921,  935,  931,  914,
-      909,  914,  914,  914,  914,  914,  914,  914,  914,  914,
-      917,  918,  921,  923,  923,  919,  931,  925,  925,  920,
-        0,  918,  921,  935,  931,  924,  924,    0,  924,  924,
-      924,  924,  924,  924,  925,  930,  924,  918,  921,  936,
-      930,  919,  931,  925,  925,  920,  924,  924,  932,  933,
-      934,  934,  938,  932,    0,  933,  937,  937,  944,  944,
-      925,  930,  939,  947,  945,  936,  930,  948,  949,  939,
-      945,  950,  938,  937,  932,  933,  934,  934,  938,  932,
-      946,  933,  937,  937,  944,  944,  946,  952,  939,  947,
-
-      945,  954,  954,  948,  949,  939,  945,  950,  938,  937,
-      955,  953,  959,  960,  962,  962,  946,  952,  953,  963,
-      960,  961,  946,  952,  961,  965,  967,  954,  954,  966,
-      966,  974,  974,  968,  975,  973,  955,  953,  959,  960,
-      962,  962,  973,  952,  953,  963,  960,  961,  976,  978,
-      961,  965,  967,  968,  979,  966,  966,  974,  974,  968,
-      975,  973,  983,  984,  983,  986,  991,    0,  973,  978,
-        0,    0,    0,    0,  976,  978,    0,    0,    0,  968,
-      979,    0,    0,    0,    0,    0,    0,    0,  983,  984,
-      983,  986,  991,    0,    0,  978, 1002, 1002, 1002, 1002,
-
-     1003, 1003, 1003, 1003, 1004, 1004, 1004, 1004, 1005,    0,
-     1005, 1005, 1006, 1006, 1006, 1006, 1007,    0, 1007, 1007,
-     1008, 1008, 1010, 1010, 1011, 1011, 1012, 1012, 1013, 1013,
-     1014, 1014, 1015, 1015, 1016, 1016, 1017, 1017, 1018, 1018,
-     1019, 1019, 1020,    0, 1020, 1020, 1021, 1021, 1022, 1022,
-     1023, 1023, 1024, 1024, 1025, 1025, 1026, 1026, 1027, 1027,
-     1028, 1028, 1029, 1029, 1030, 1030, 1031, 1031, 1032, 1032,
-     1033, 1033, 1034, 1034, 1035, 1035, 1036, 1036, 1037, 1037,
-     1038, 1038, 1039, 1039, 1040, 1040, 1041, 1041, 1042, 1042,
-     1043, 1043, 1044, 1044, 1045, 1045, 1046, 1046, 1048, 1048,
-
-     1049, 1049, 1050, 1050, 1052, 1052, 1053, 1053, 1054, 1054,
-     1057, 1057, 1058, 1058, 1059, 1059, 1061,    0, 1061, 1061,
-     1062,    0, 1062, 1062, 1063, 1063, 1064, 1064, 1067,    0,
-     1067, 1067, 1068,    0, 1068, 1068, 1069, 1069, 1070, 1070,
-     1071, 1071, 1072, 1072, 1073, 1073, 1075, 1075, 1076, 1076,
-     1077, 1077, 1078, 1078, 1079, 1079, 1081, 1081, 1082, 1082,
-     1083, 1083, 1085, 1085, 1087, 1087, 1088, 1088, 1089, 1089,
-     1091, 1091, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001,
-     1001, 1001, 1001, 1001, 1001, 1001, 1001, 1001
+       20,   20,   21,   21,   22,   21,   28,  207,   37,  208,
+       39,   21,   40,   21,   28,   22,   23,   23,   22,   38,
+       21,   23,  213,   38,   22,  219,   23,   23,   21,   21,
+
+       22,   21,   28,   23,   37,   25,   39,   21,   40,   21,
+       28,   22,   23,   23,   22,   38,   21,   23,   29,   38,
+       22,   25,   23,   23,   29,   25,  222,  229,  233,   23,
+      234,   25,  258,  263,  264,  265,   32,  266,  273,  278,
+      285,  286,  297,  298,   29,  308,   32,   25,   32,   64,
+       29,   25,   26,   26,   26,   26,   26,   26,   26,   26,
+       26,   26,   32,   26,   26,   26,   26,   26,   26,   31,
+       26,   33,   32,   31,   32,   64,  315,  321,   65,   31,
+      338,  342,   33,   26,   31,   33,  345,  352,   66,   26,
+       26,   26,   26,   26,   26,   31,   26,   33,   68,   31,
+
+       69,   35,   36,   36,   65,   31,   35,   35,   33,   26,
+       31,   33,   36,   35,   66,   70,   71,   72,   35,   35,
+       36,   74,   75,   76,   68,   77,   69,   35,  356,   36,
+      369,  401,   35,   35,  402,  404,  415,  422,   36,   35,
+      426,   70,   71,   72,   35,   35,   36,   74,   75,   76,
+      427,   77,  434,   54,   54,   36,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   78,   55,
+       55,   55,   55,   55,   55,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   79,   56,   56,   56,   56,
+       56,   56,  485,  494,   78,   55,   55,   55,   55,   55,
+       55,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+      495,   79,   56,   56,   56,   56,   56,   56,   59,   59,
+       59,   59,   59,   59,   59,   59,   59,   81,   82,   59,
+
+       59,   59,   59,   59,   59,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,  498,   83,   60,   60,   60,   60,
+       60,   60,  499,   81,   82,   59,   59,   59,   59,   59,
+       59,  505,   73,  506,  515,  538,  558,  583,  584,  603,
+       73,   83,   60,   60,   60,   60,   60,   60,   63,   63,
+       63,   63,   63,   63,   63,   63,   63,   63,   73,   63,
+       63,   63,   63,   63,   63,   80,   73,   84,   85,   80,
+       88,   89,   87,   86,  617,   91,   93,   94,   86,   63,
+       87,   95,   98,   99,  100,   63,   63,   63,   63,   63,
+       63,   80,   86,   84,   85,   80,   88,   89,   87,   86,
+
+       90,   91,   93,   94,   86,   63,   87,   95,   98,   99,
+      100,  101,  102,  101,  101,   90,  103,  101,   86,  104,
+      105,  106,  108,  112,  113,  114,   90,  107,  115,  116,
+      117,  118,  131,  132,  619,  622,  623,  101,  102,  101,
+      101,   90,  103,  101,  107,  104,  105,  106,  108,  112,
+      113,  114,  637,  107,  115,  116,  117,  118,  131,  132,
+      122,  122,  122,  122,  122,  122,  122,  122,  122,  133,
+      107,  122,  122,  122,  122,  122,  122,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  134,  136,  123,  123,
+      123,  123,  123,  123,  655,  133,  663,  122,  122,  122,
+
+      122,  122,  122,  124,  124,  124,  124,  124,  124,  124,
+      124,  124,  134,  136,  123,  123,  123,  123,  123,  123,
+      125,  125,  125,  125,  125,  125,  125,  125,  125,  125,
+      137,  125,  125,  125,  125,  125,  125,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  664,  681,  126,  126,
+      126,  126,  126,  126,  695,  138,  137,  125,  125,  125,
+      125,  125,  125,  129,  722,  129,  129,  129,  129,  129,
+      129,  129,  129,  129,  126,  126,  126,  126,  126,  126,
+      128,  138,  128,  128,  128,  128,  128,  128,  128,  128,
+      128,  128,  139,  128,  128,  128,  128,  128,  128,  130,
+
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  140,
+      130,  130,  130,  130,  130,  130,  141,  142,  139,  128,
+      128,  128,  128,  128,  128,  143,  144,  146,  147,  148,
+      149,  150,  151,  152,  153,  140,  130,  130,  130,  130,
+      130,  130,  141,  142,  154,  155,  156,  157,  158,  160,
+      161,  143,  144,  146,  147,  148,  149,  150,  151,  152,
+      153,  162,  165,  166,  168,  169,  170,  171,  167,  172,
+      154,  155,  156,  157,  158,  160,  161,  167,  173,  174,
+      175,  167,  176,  177,  179,  180,  181,  162,  165,  166,
+      168,  169,  170,  171,  167,  172,  182,  183,  184,  185,
+
+      186,  187,  188,  167,  173,  174,  175,  167,  176,  177,
+      179,  180,  181,  189,  725,  726,  747,  751,  770,  779,
+      786,  787,  182,  183,  184,  185,  186,  187,  188,  191,
+      191,  191,  191,  191,  191,  191,  191,  191,  813,  189,
+      191,  191,  191,  191,  191,  191,  192,  192,  192,  192,
+      192,  192,  192,  192,  192,  197,  203,  197,  197,  197,
+      197,  197,  197,  197,  197,  197,  191,  191,  191,  191,
+      191,  191,  193,  193,  193,  193,  193,  193,  193,  193,
+      193,  204,  203,  193,  193,  193,  193,  193,  193,  194,
+      194,  194,  194,  194,  194,  194,  194,  194,  206,  204,
+
+      194,  194,  194,  194,  194,  194,  823,  830,  831,  193,
+      193,  193,  193,  193,  193,  198,  198,  198,  198,  198,
+      198,  198,  198,  198,  206,  204,  194,  194,  194,  194,
+      194,  194,  195,  195,  195,  195,  195,  195,  195,  195,
+      195,  844,  209,  195,  195,  195,  195,  195,  195,  196,
+      210,  196,  196,  196,  196,  196,  196,  196,  196,  196,
+      196,  211,  196,  196,  196,  196,  196,  196,  209,  195,
+      195,  195,  195,  195,  195,  201,  210,  201,  201,  201,
+      201,  201,  201,  201,  201,  201,  847,  211,  196,  196,
+      196,  196,  196,  196,  199,  199,  199,  199,  199,  199,
+
+      199,  199,  199,  212,  215,  199,  199,  199,  199,  199,
+      199,  200,  200,  200,  200,  200,  200,  200,  200,  200,
+      216,  217,  200,  200,  200,  200,  200,  200,  866,  212,
+      215,  199,  199,  199,  199,  199,  199,  220,  221,  868,
+      869,  876,  877,  882,  889,  223,  216,  217,  200,  200,
+      200,  200,  200,  200,  202,  202,  202,  202,  202,  202,
+      202,  202,  202,  220,  221,  202,  202,  202,  202,  202,
+      202,  223,  224,  225,  226,  227,  228,  230,  231,  232,
+      236,  237,  235,  238,  239,  240,  230,  230,  230,  241,
+      243,  202,  202,  202,  202,  202,  202,  235,  224,  225,
+
+      226,  227,  228,  230,  231,  232,  236,  237,  235,  238,
+      239,  240,  230,  230,  230,  241,  243,  244,  245,  246,
+      247,  248,  249,  235,  250,  251,  252,  253,  254,  255,
+      256,  257,  260,  261,  262,  279,  280,  281,  283,  283,
+      283,  252,  911,  244,  245,  246,  247,  248,  249,  912,
+      250,  251,  252,  253,  254,  255,  256,  257,  260,  261,
+      262,  279,  280,  281,  283,  283,  283,  252,  267,  267,
+      267,  267,  267,  267,  267,  267,  267,  284,  287,  267,
+      267,  267,  267,  267,  267,  268,  268,  268,  268,  268,
+      268,  268,  268,  268,  268,  288,  268,  268,  268,  268,
+
+      268,  268,  922,  284,  287,  267,  267,  267,  267,  267,
+      267,  269,  269,  269,  269,  269,  269,  269,  269,  269,
+      945,  288,  268,  268,  268,  268,  268,  268,  270,  270,
+      270,  270,  270,  270,  270,  270,  270,  290,  291,  270,
+      270,  270,  270,  270,  270,  271,  271,  271,  271,  271,
+      271,  271,  271,  271,  947,  953,  271,  271,  271,  271,
+      271,  271,  954,  290,  291,  270,  270,  270,  270,  270,
+      270,  272,  292,  272,  272,  272,  272,  272,  272,  272,
+      272,  272,  271,  271,  271,  271,  271,  271,  274,  274,
+      274,  274,  274,  274,  274,  274,  274,  293,  292,  274,
+
+      274,  274,  274,  274,  274,  275,  969,  275,  275,  275,
+      275,  275,  275,  275,  275,  275,  931,  931,  931,  968,
+      931,  970,  968,  293,  981,  274,  274,  274,  274,  274,
+      274,  276,  276,  276,  276,  276,  276,  276,  276,  276,
+      276,  294,  276,  276,  276,  276,  276,  276,  277,  296,
+      277,  277,  277,  277,  277,  277,  277,  277,  277,  289,
+      299,  300,  301,  289,  302,  303,  304,  294,  276,  276,
+      276,  276,  276,  276,  305,  296,  306,  307,  309,  310,
+      311,  312,  313,  314,  316,  289,  299,  300,  301,  289,
+      302,  303,  304,  317,  318,  311,  319,  320,  322,  324,
+
+      305,  325,  306,  307,  309,  310,  311,  312,  313,  314,
+      316,  327,  329,  330,  331,  332,  333,  334,  335,  317,
+      318,  311,  319,  320,  322,  324,  336,  325,  337,  339,
+      340,  986,  987, 1003, 1004, 1005, 1006,  327,  329,  330,
+      331,  332,  333,  334,  335, 1015, 1020, 1021, 1041, 1044,
+     1049, 1050,  336, 1056,  337,  339,  340,  341,  341,  341,
+      341,  341,  341,  341,  341,  341,  357,  358,  341,  341,
+      341,  341,  341,  341,  343,  343,  343,  343,  343,  343,
+      343,  343,  343, 1071, 1099,  343,  343,  343,  343,  343,
+      343, 1100,  357,  358,  341,  341,  341,  341,  341,  341,
+
+      347,  359,  347,  347,  347,  347,  347,  347,  347,  347,
+      347,  343,  343,  343,  343,  343,  343,  344,  344,  344,
+      344,  344,  344,  344,  344,  344,  360,  359,  344,  344,
+      344,  344,  344,  344,  346,  346,  346,  346,  346,  346,
+      346,  346,  346, 1118, 1122,  346,  346,  346,  346,  346,
+      346, 1125,  360, 1126,  344,  344,  344,  344,  344,  344,
+      349,  361,  349,  349,  349,  349,  349,  349,  349,  349,
+      349,  346,  346,  346,  346,  346,  346,  348,  348,  348,
+      348,  348,  348,  348,  348,  348,  348,  361,  348,  348,
+      348,  348,  348,  348,  350,  350,  350,  350,  350,  350,
+
+      350,  350,  350,  355, 1130,  355,  355,  355,  355,  355,
+      355,  355,  355,  355,  348,  348,  348,  348,  348,  348,
+      351,    0,  351,  351,  351,  351,  351,  351,  351,  351,
+      351,  351,  353,  353,  353,  353,  353,  353,  353,  353,
+      353,  362,  363,  353,  353,  353,  353,  353,  353,  354,
+      354,  354,  354,  354,  354,  354,  354,  354,  364,  366,
+      354,  354,  354,  354,  354,  354,    0,  362,  363,  353,
+      353,  353,  353,  353,  353,  420,  420,  420,  420,  420,
+      420,  420,  420,  420,  364,  366,  354,  354,  354,  354,
+      354,  354,  365,  365,    0,  365,  365,  365,  365,  365,
+
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  365,  365,  365,
+      365,  365,  365,  365,  365,  365,  365,  367,  368,  370,
+      372,  373,  374,  375,  376,  377,  378,  379,  380,  376,
+      381,  382,  383,  384,  385,  386,  387,  388,  389,  390,
+      391,  392,  393,  367,  368,  370,  372,  373,  374,  375,
+
+      376,  377,  378,  379,  380,  376,  381,  382,  383,  384,
+      385,  386,  387,  388,  389,  390,  391,  392,  393,  394,
+      396,  397,  398,  399,  400,  403,  405,  406,  407,  408,
+      410,  411,  412,  413,  414,  416,  399,    0,    0,    0,
+        0,    0,    0,    0,    0,  394,  396,  397,  398,  399,
+      400,  403,  405,  406,  407,  408,  410,  411,  412,  413,
+      414,  416,  399,  417,  417,  417,  417,  417,  417,  417,
+      417,  417,  433,  435,  417,  417,  417,  417,  417,  417,
+      418,  418,  418,  418,  418,  418,  418,  418,  418,    0,
+        0,  418,  418,  418,  418,  418,  418,    0,  433,  435,
+
+      417,  417,  417,  417,  417,  417,  425,  436,  425,  425,
+      425,  425,  425,  425,  425,  425,  425,  418,  418,  418,
+      418,  418,  418,  419,  419,  419,  419,  419,  419,  419,
+      419,  419,  419,  436,  419,  419,  419,  419,  419,  419,
+      421,    0,  421,  421,  421,  421,  421,  421,  421,  421,
+      421,  421,    0,    0,    0,    0,    0,    0,    0,    0,
+      419,  419,  419,  419,  419,  419,  423,  423,  423,  423,
+      423,  423,  423,  423,  423,  437,  438,  423,  423,  423,
+      423,  423,  423,  424,  424,  424,  424,  424,  424,  424,
+      424,  424,    0,    0,  424,  424,  424,  424,  424,  424,
+
+        0,  437,  438,  423,  423,  423,  423,  423,  423,  429,
+      439,  429,  429,  429,  429,  429,  429,  429,  429,  429,
+      424,  424,  424,  424,  424,  424,  428,  428,  428,  428,
+      428,  428,  428,  428,  428,  440,  439,  428,  428,  428,
+      428,  428,  428,  430,  430,  430,  430,  430,  430,  430,
+      430,  430,  430,    0,  430,  430,  430,  430,  430,  430,
+        0,  440,  441,  428,  428,  428,  428,  428,  428,  431,
+      443,  431,  431,  431,  431,  431,  431,  431,  431,  431,
+      430,  430,  430,  430,  430,  430,  432,  442,  441,  432,
+      445,  446,  447,  448,  449,  432,  443,  442,  447,  450,
+
+      447,  451,  442,  452,  453,  454,  442,  455,  456,  457,
+      458,  459,  432,  442,  460,  432,  445,  446,  447,  448,
+      449,  432,  461,  442,  447,  450,  447,  451,  442,  452,
+      453,  454,  442,  455,  456,  457,  458,  459,  462,  463,
+      460,  464,  465,  466,  467,  468,  469,  470,  461,  471,
+      472,  473,  474,  476,  477,  478,  479,  480,  481,    0,
+        0,  483,  484,  476,  462,  463,  486,  464,  465,  466,
+      467,  468,  469,  470,    0,  471,  472,  473,  474,  476,
+      477,  478,  479,  480,  481,  482,  482,  483,  484,  476,
+      487,  488,  486,  489,  491,  492,  493,  510,  511,  512,
+
+      482,  513,  514,  482,    0,    0,    0,    0,    0,    0,
+        0,  482,  482,  516,  517,    0,  487,  488,    0,  489,
+      491,  492,  493,  510,  511,  512,  482,  513,  514,  482,
+      496,  496,  496,  496,  496,  496,  496,  496,  496,  516,
+      517,  496,  496,  496,  496,  496,  496,  497,  497,  497,
+      497,  497,  497,  497,  497,  497,    0,    0,  497,  497,
+      497,  497,  497,  497,    0,    0,    0,  496,  496,  496,
+      496,  496,  496,  501,  518,  501,  501,  501,  501,  501,
+      501,  501,  501,  501,  497,  497,  497,  497,  497,  497,
+      500,  500,  500,  500,  500,  500,  500,  500,  500,  519,
+
+      518,  500,  500,  500,  500,  500,  500,  502,  502,  502,
+      502,  502,  502,  502,  502,  502,  502,    0,  502,  502,
+      502,  502,  502,  502,    0,  519,    0,  500,  500,  500,
+      500,  500,  500,  503,    0,  503,  503,  503,  503,  503,
+      503,  503,  503,  503,  502,  502,  502,  502,  502,  502,
+      504,  504,  504,  504,  504,  504,  504,  504,  504,  507,
+      507,  507,  507,  507,  507,  507,  507,  507,  520,  521,
+      507,  507,  507,  507,  507,  507,  508,  508,  508,  508,
+      508,  508,  508,  508,  508,    0,    0,  508,  508,  508,
+      508,  508,  508,  522,  520,  521,  507,  507,  507,  507,
+
+      507,  507,  509,  523,  509,  509,  509,  509,  509,  509,
+      509,  509,  509,  508,  508,  508,  508,  508,  508,  522,
+      524,  525,  526,  527,  528,  529,  530,  531,  532,  523,
+      533,  534,  535,  536,  537,  540,  542,  543,  544,  548,
+      550,  551,  552,  553,  554,    0,  524,  525,  526,  527,
+      528,  529,  530,  531,  532,  557,  533,  534,  535,  536,
+      537,  540,  542,  543,  544,  548,  550,  551,  552,  553,
+      554,  555,  559,  560,  561,  562,  563,  564,  555,  565,
+      566,  557,  567,  568,  569,  570,  571,  572,  573,  575,
+      576,  577,    0,    0,    0,    0,    0,  555,  559,  560,
+
+      561,  562,  563,  564,  555,  565,  566,    0,  567,  568,
+      569,  570,  571,  572,  573,  575,  576,  577,  579,  579,
+      579,  579,  579,  579,  579,  579,  579,  593,  594,  579,
+      579,  579,  579,  579,  579,  580,  580,  580,  580,  580,
+      580,  580,  580,  580,  595,  596,  580,  580,  580,  580,
+      580,  580,    0,  593,  594,  579,  579,  579,  579,  579,
+      579,  582,  582,  582,  582,  582,  582,  582,  582,  582,
+      595,  596,  580,  580,  580,  580,  580,  580,  581,  581,
+      581,  581,  581,  581,  581,  581,  581,  581,  597,  581,
+      581,  581,  581,  581,  581,  585,  585,  585,  585,  585,
+
+      585,  585,  585,  585,    0,    0,  585,  585,  585,  585,
+      585,  585,    0,    0,  597,  581,  581,  581,  581,  581,
+      581,  587,  598,  587,  587,  587,  587,  587,  587,  587,
+      587,  587,  585,  585,  585,  585,  585,  585,  586,  586,
+      586,  586,  586,  586,  586,  586,  586,  599,  598,  586,
+      586,  586,  586,  586,  586,  589,  589,  589,  589,  589,
+      589,  589,  589,  589,    0,    0,  589,  589,  589,  589,
+      589,  589,    0,  599,    0,  586,  586,  586,  586,  586,
+      586,  590,  600,  590,  590,  590,  590,  590,  590,  590,
+      590,  590,  589,  589,  589,  589,  589,  589,  591,  591,
+
+      591,  591,  591,  591,  591,  591,  591,  591,  600,  591,
+      591,  591,  591,  591,  591,  592,  601,  592,  592,  592,
+      592,  592,  592,  592,  592,  592,  602,  604,  605,  606,
+      607,  608,  609,  610,  611,  591,  591,  591,  591,  591,
+      591,  612,  601,  613,  614,  615,  616,  618,  620,  621,
+      624,  627,  602,  604,  605,  606,  607,  608,  609,  610,
+      611,  628,  629,  630,  631,  632,  633,  612,  635,  613,
+      614,  615,  616,  618,  620,  621,  624,  627,  636,  638,
+      639,  641,  642,  643,  644,  645,  646,  628,  629,  630,
+      631,  632,  633,  647,  635,  648,  652,  653,    0,    0,
+
+        0,    0,    0,    0,  636,  638,  639,  641,  642,  643,
+      644,  645,  646,    0,    0,    0,    0,    0,    0,  647,
+        0,  648,  652,  653,  654,  654,  654,  654,  654,  654,
+      654,  654,  654,  668,  669,  654,  654,  654,  654,  654,
+      654,  656,  656,  656,  656,  656,  656,  656,  656,  656,
+        0,    0,  656,  656,  656,  656,  656,  656,    0,  668,
+      669,  654,  654,  654,  654,  654,  654,  660,  670,  660,
+      660,  660,  660,  660,  660,  660,  660,  660,  656,  656,
+      656,  656,  656,  656,  657,  657,  657,  657,  657,  657,
+      657,  657,  657,  671,  670,  657,  657,  657,  657,  657,
+
+      657,  659,  659,  659,  659,  659,  659,  659,  659,  659,
+        0,    0,  659,  659,  659,  659,  659,  659,    0,  671,
+        0,  657,  657,  657,  657,  657,  657,  662,  672,  662,
+      662,  662,  662,  662,  662,  662,  662,  662,  659,  659,
+      659,  659,  659,  659,  661,  661,  661,  661,  661,  661,
+      661,  661,  661,  661,  672,  661,  661,  661,  661,  661,
+      661,  665,  665,  665,  665,  665,  665,  665,  665,  665,
+        0,    0,  665,  665,  665,  665,  665,  665,    0,    0,
+        0,  661,  661,  661,  661,  661,  661,  667,  673,  667,
+      667,  667,  667,  667,  667,  667,  667,  667,  665,  665,
+
+      665,  665,  665,  665,  666,  666,  666,  666,  666,  666,
+      666,  666,  666,  674,  673,  666,  666,  666,  666,  666,
+      666,  675,  676,  678,  679,  680,  682,  683,  684,  685,
+      686,  687,  688,  690,  691,  692,  694,  696,  697,  674,
+      698,  666,  666,  666,  666,  666,  666,  675,  676,  678,
+      679,  680,  682,  683,  684,  685,  686,  687,  688,  690,
+      691,  692,  694,  696,  697,  700,  698,  701,  705,  706,
+      707,  709,  710,  711,  712,  713,  714,  715,  716,  719,
+      720,  721, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,
+     1128,  700,  734,  701,  705,  706,  707,  709,  710,  711,
+
+      712,  713,  714,  715,  716,  719,  720,  721,  723,  723,
+      723,  723,  723,  723,  723,  723,  723,  736,  734,  723,
+      723,  723,  723,  723,  723,  724,  724,  724,  724,  724,
+      724,  724,  724,  724,  724,    0,  724,  724,  724,  724,
+      724,  724,    0,  736,    0,  723,  723,  723,  723,  723,
+      723,  729,  738,  729,  729,  729,  729,  729,  729,  729,
+      729,  729,  724,  724,  724,  724,  724,  724,  727,  727,
+      727,  727,  727,  727,  727,  727,  727,  739,  738,  727,
+      727,  727,  727,  727,  727,  728,  728,  728,  728,  728,
+      728,  728,  728,  728,    0,    0,  728,  728,  728,  728,
+
+      728,  728,    0,  739,    0,  727,  727,  727,  727,  727,
+      727,  731,  740,  731,  731,  731,  731,  731,  731,  731,
+      731,  731,  728,  728,  728,  728,  728,  728,  730,  730,
+      730,  730,  730,  730,  730,  730,  730,  742,  740,  730,
+      730,  730,  730,  730,  730,  732,  732,  732,  732,  732,
+      732,  732,  732,  732,  732,    0,  732,  732,  732,  732,
+      732,  732,  743,  742,  744,  730,  730,  730,  730,  730,
+      730,  733,  745,  733,  733,  733,  733,  733,  733,  733,
+      733,  733,  732,  732,  732,  732,  732,  732,  743,  746,
+      744,  748,  749,  750,  753,  754,  755,  756,  745,  757,
+
+      758,  759,  760,  761,  764,  766,  767,  768,  769,  771,
+      772,  773,  774,  775,  776,  746,    0,  748,  749,  750,
+      753,  754,  755,  756,  791,  757,  758,  759,  760,  761,
+      764,  766,  767,  768,  769,  771,  772,  773,  774,  775,
+      776,  778,  778,  778,  778,  778,  778,  778,  778,  778,
+      791,  792,  778,  778,  778,  778,  778,  778,  780,  780,
+      780,  780,  780,  780,  780,  780,  780,    0,    0,  780,
+      780,  780,  780,  780,  780,    0,    0,  792,  778,  778,
+      778,  778,  778,  778,  783,  795,  783,  783,  783,  783,
+      783,  783,  783,  783,  783,  780,  780,  780,  780,  780,
+
+      780,  781,  781,  781,  781,  781,  781,  781,  781,  781,
+      796,  795,  781,  781,  781,  781,  781,  781,  782,  782,
+      782,  782,  782,  782,  782,  782,  782,    0,    0,  782,
+      782,  782,  782,  782,  782,    0,  796,    0,  781,  781,
+      781,  781,  781,  781,  785,  797,  785,  785,  785,  785,
+      785,  785,  785,  785,  785,  782,  782,  782,  782,  782,
+      782,  784,  784,  784,  784,  784,  784,  784,  784,  784,
+      784,  797,  784,  784,  784,  784,  784,  784,  788,  788,
+      788,  788,  788,  788,  788,  788,  788,    0,    0,  788,
+      788,  788,  788,  788,  788,    0,    0,    0,  784,  784,
+
+      784,  784,  784,  784,  790,  798,  790,  790,  790,  790,
+      790,  790,  790,  790,  790,  788,  788,  788,  788,  788,
+      788,  789,  789,  789,  789,  789,  789,  789,  789,  789,
+      800,  798,  789,  789,  789,  789,  789,  789,  801,  802,
+      803,  805,  807,  809,  810,  811,  812,  805,  814,  815,
+      816,  817,  819,  820,  822,  824,  800,  825,  789,  789,
+      789,  789,  789,  789,  801,  802,  803,  805,  807,  809,
+      810,  811,  812,  805,  814,  815,  816,  817,  819,  820,
+      822,  824,  826,  825,  827,  827,  827,  827,  827,  827,
+      827,  827,  827,  839,  840,  827,  827,  827,  827,  827,
+
+      827,    0,    0,    0,    0,    0,    0,  834,  826,  834,
+      834,  834,  834,  834,  834,  834,  834,  834,    0,  839,
+      840,  827,  827,  827,  827,  827,  827,  828,  828,  828,
+      828,  828,  828,  828,  828,  828,  842,  843,  828,  828,
+      828,  828,  828,  828,  829,  829,  829,  829,  829,  829,
+      829,  829,  829,  829,    0,  829,  829,  829,  829,  829,
+      829,    0,  842,  843,  828,  828,  828,  828,  828,  828,
+      836,  845,  836,  836,  836,  836,  836,  836,  836,  836,
+      836,  829,  829,  829,  829,  829,  829,  832,  832,  832,
+      832,  832,  832,  832,  832,  832,  846,  845,  832,  832,
+
+      832,  832,  832,  832,  833,  833,  833,  833,  833,  833,
+      833,  833,  833,    0,    0,  833,  833,  833,  833,  833,
+      833,    0,  846,    0,  832,  832,  832,  832,  832,  832,
+      838,  849,  838,  838,  838,  838,  838,  838,  838,  838,
+      838,  833,  833,  833,  833,  833,  833,  835,  835,  835,
+      835,  835,  835,  835,  835,  835,  850,  849,  835,  835,
+      835,  835,  835,  835,  837,  837,  837,  837,  837,  837,
+      837,  837,  837,  837,  852,  837,  837,  837,  837,  837,
+      837,  853,  850,  854,  835,  835,  835,  835,  835,  835,
+      856,  857,  858,  859,  860,  861,  863,  864,  862,  865,
+
+      852,  837,  837,  837,  837,  837,  837,  853,  862,  854,
+      867,    0,    0,    0,    0,    0,  856,  857,  858,  859,
+      860,  861,  863,  864,  862,  865,    0,    0,    0,    0,
+        0,    0,    0,    0,  862,    0,  867,  870,  870,  870,
+      870,  870,  870,  870,  870,  870,  881,  883,  870,  870,
+      870,  870,  870,  870,  871,  871,  871,  871,  871,  871,
+      871,  871,  871,  871,    0,  871,  871,  871,  871,  871,
+      871,    0,  881,  883,  870,  870,  870,  870,  870,  870,
+      873,  884,  873,  873,  873,  873,  873,  873,  873,  873,
+      873,  871,  871,  871,  871,  871,  871,  872,  872,  872,
+
+      872,  872,  872,  872,  872,  872,  886,  884,  872,  872,
+      872,  872,  872,  872,  874,  874,  874,  874,  874,  874,
+      874,  874,  874,  874,    0,  874,  874,  874,  874,  874,
+      874,    0,  886,    0,  872,  872,  872,  872,  872,  872,
+      875,  887,  875,  875,  875,  875,  875,  875,  875,  875,
+      875,  874,  874,  874,  874,  874,  874,  878,  878,  878,
+      878,  878,  878,  878,  878,  878,  890,  887,  878,  878,
+      878,  878,  878,  878,  879,  879,  879,  879,  879,  879,
+      879,  879,  879,    0,    0,  879,  879,  879,  879,  879,
+      879,    0,  890,  891,  878,  878,  878,  878,  878,  878,
+
+      880,  885,  880,  880,  880,  880,  880,  880,  880,  880,
+      880,  879,  879,  879,  879,  879,  879,  885,  888,  891,
+      892,  893,  894,  895,  897,  898,  900,  885,  901,  902,
+      903,  905,  920,  921,  888,    0,    0,    0,    0,    0,
+        0,    0,    0,  885,  888,  924,  892,  893,  894,  895,
+      897,  898,  900,    0,  901,  902,  903,  905,  920,  921,
+      888,  907,  907,  907,  907,  907,  907,  907,  907,  907,
+      925,  924,  907,  907,  907,  907,  907,  907,  908,  908,
+      908,  908,  908,  908,  908,  908,  908,    0,    0,  908,
+      908,  908,  908,  908,  908,    0,  925,    0,  907,  907,
+
+      907,  907,  907,  907,  915,  926,  915,  915,  915,  915,
+      915,  915,  915,  915,  915,  908,  908,  908,  908,  908,
+      908,  909,  909,  909,  909,  909,  909,  909,  909,  909,
+      909,  926,  909,  909,  909,  909,  909,  909,  910,  910,
+      910,  910,  910,  910,  910,  910,  910,    0,    0,  910,
+      910,  910,  910,  910,  910,    0,    0,    0,  909,  909,
+      909,  909,  909,  909,  917,  927,  917,  917,  917,  917,
+      917,  917,  917,  917,  917,  910,  910,  910,  910,  910,
+      910,  913,  913,  913,  913,  913,  913,  913,  913,  913,
+      928,  927,  913,  913,  913,  913,  913,  913,  914,  914,
+
+      914,  914,  914,  914,  914,  914,  914,    0,    0,  914,
+      914,  914,  914,  914,  914,    0,  928,    0,  913,  913,
+      913,  913,  913,  913,  919,  929,  919,  919,  919,  919,
+      919,  919,  919,  919,  919,  914,  914,  914,  914,  914,
+      914,  916,  916,  916,  916,  916,  916,  916,  916,  916,
+      932,  929,  916,  916,  916,  916,  916,  916,  918,  918,
+      918,  918,  918,  918,  918,  918,  918,  918,  934,  918,
+      918,  918,  918,  918,  918,  935,  932,  937,  916,  916,
+      916,  916,  916,  916,  938,  939,  940,  941,  942,  943,
+        0,    0,    0,    0,  934,  918,  918,  918,  918,  918,
+
+      918,  935,    0,  937,    0,    0,    0,    0,    0,    0,
+      938,  939,  940,  941,  942,  943,  944,  944,  944,  944,
+      944,  944,  944,  944,  944,  958,  959,  944,  944,  944,
+      944,  944,  944,  946,  946,  946,  946,  946,  946,  946,
+      946,  946,    0,    0,  946,  946,  946,  946,  946,  946,
+        0,  958,  959,  944,  944,  944,  944,  944,  944,  950,
+      961,  950,  950,  950,  950,  950,  950,  950,  950,  950,
+      946,  946,  946,  946,  946,  946,  948,  948,  948,  948,
+      948,  948,  948,  948,  948,  948,  961,  948,  948,  948,
+      948,  948,  948,  949,  949,  949,  949,  949,  949,  949,
+
+      949,  949,    0,    0,  949,  949,  949,  949,  949,  949,
+        0,  962,    0,  948,  948,  948,  948,  948,  948,  952,
+        0,  952,  952,  952,  952,  952,  952,  952,  952,  952,
+      949,  949,  949,  949,  949,  949,  951,  962,  951,  951,
+      951,  951,  951,  951,  951,  951,  951,  964,  965,  951,
+      951,  951,  951,  951,  951,  955,  955,  955,  955,  955,
+      955,  955,  955,  955,    0,    0,  955,  955,  955,  955,
+      955,  955,    0,  964,  965,  951,  951,  951,  951,  951,
+      951,  957,  966,  957,  957,  957,  957,  957,  957,  957,
+      957,  957,  955,  955,  955,  955,  955,  955,  956,  956,
+
+      956,  956,  956,  956,  956,  956,  956,  960,  966,  956,
+      956,  956,  956,  956,  956,  971,  973,  974,  975,  960,
+      978,  979,  980,  994,  995,  996,  960,    0,    0,    0,
+        0,    0,    0,  960,    0,  956,  956,  956,  956,  956,
+      956,  971,  973,  974,  975,  960,  978,  979,  980,  994,
+      995,  996,  960,  982,  982,  982,  982,  982,  982,  982,
+      982,  982,  998,  999,  982,  982,  982,  982,  982,  982,
+      984,  984,  984,  984,  984,  984,  984,  984,  984,    0,
+        0,  984,  984,  984,  984,  984,  984,    0,  998,  999,
+      982,  982,  982,  982,  982,  982,  989, 1001,  989,  989,
+
+      989,  989,  989,  989,  989,  989,  989,  984,  984,  984,
+      984,  984,  984,  985,  985,  985,  985,  985,  985,  985,
+      985,  985, 1002, 1001,  985,  985,  985,  985,  985,  985,
+      988,  988,  988,  988,  988,  988,  988,  988,  988,    0,
+        0,  988,  988,  988,  988,  988,  988,    0, 1002,    0,
+      985,  985,  985,  985,  985,  985,  991, 1008,  991,  991,
+      991,  991,  991,  991,  991,  991,  991,  988,  988,  988,
+      988,  988,  988,  990,  990,  990,  990,  990,  990,  990,
+      990,  990, 1010, 1008,  990,  990,  990,  990,  990,  990,
+      992,  992,  992,  992,  992,  992,  992,  992,  992, 1011,
+
+     1013,  992,  992,  992,  992,  992,  992, 1023, 1010, 1024,
+      990,  990,  990,  990,  990,  990,  997, 1025, 1026, 1027,
+     1028, 1030,  997,    0,    0, 1011, 1013,  992,  992,  992,
+      992,  992,  992, 1023,    0, 1024,    0,    0,    0,    0,
+        0,    0,  997, 1025, 1026, 1027, 1028, 1030,  997, 1014,
+     1014, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1048, 1051,
+     1014, 1014, 1014, 1014, 1014, 1014, 1016, 1016, 1016, 1016,
+     1016, 1016, 1016, 1016, 1016,    0,    0, 1016, 1016, 1016,
+     1016, 1016, 1016,    0, 1048, 1051, 1014, 1014, 1014, 1014,
+     1014, 1014, 1019, 1060, 1019, 1019, 1019, 1019, 1019, 1019,
+
+     1019, 1019, 1019, 1016, 1016, 1016, 1016, 1016, 1016, 1017,
+     1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 1060,
+     1017, 1017, 1017, 1017, 1017, 1017, 1018, 1018, 1018, 1018,
+     1018, 1018, 1018, 1018, 1018, 1053, 1053, 1018, 1018, 1018,
+     1018, 1018, 1018,    0,    0,    0, 1017, 1017, 1017, 1017,
+     1017, 1017, 1055, 1055,    0,    0,    0,    0,    0,    0,
+     1061, 1053, 1053, 1018, 1018, 1018, 1018, 1018, 1018, 1022,
+     1022, 1022, 1022, 1022, 1022, 1022, 1022, 1022, 1055, 1055,
+     1022, 1022, 1022, 1022, 1022, 1022, 1061,    0, 1062,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0, 1022, 1022, 1022, 1022,
+     1022, 1022, 1029, 1029, 1062, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+     1029, 1029, 1029, 1029, 1029, 1029, 1029, 1031, 1031,    0,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,    0,
+
+        0, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+     1031, 1031, 1031, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+     1040, 1040, 1063, 1065, 1040, 1040, 1040, 1040, 1040, 1040,
+     1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1064,
+     1064, 1042, 1042, 1042, 1042, 1042, 1042,    0, 1063, 1065,
+     1040, 1040, 1040, 1040, 1040, 1040, 1066, 1068,    0,    0,
+
+        0,    0,    0,    0,    0, 1064, 1064, 1042, 1042, 1042,
+     1042, 1042, 1042, 1043, 1043, 1043, 1043, 1043, 1043, 1043,
+     1043, 1043, 1066, 1068, 1043, 1043, 1043, 1043, 1043, 1043,
+     1046, 1046, 1046, 1046, 1046, 1046, 1046, 1046, 1046, 1067,
+     1067, 1046, 1046, 1046, 1046, 1046, 1046,    0,    0, 1069,
+     1043, 1043, 1043, 1043, 1043, 1043,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 1067, 1067, 1046, 1046, 1046,
+     1046, 1046, 1046, 1052, 1052, 1069, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052,
+     1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1054, 1054,
+        0, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+        0,    0, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+     1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+     1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+     1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+
+     1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054, 1054,
+     1054, 1054, 1054, 1054, 1057, 1057, 1057, 1057, 1057, 1057,
+     1057, 1057, 1057, 1074, 1075, 1057, 1057, 1057, 1057, 1057,
+     1057, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058,
+     1058, 1076, 1058, 1058, 1058, 1058, 1058, 1058,    0, 1074,
+     1075, 1057, 1057, 1057, 1057, 1057, 1057, 1077, 1078,    0,
+        0,    0,    0,    0,    0,    0,    0, 1076, 1058, 1058,
+     1058, 1058, 1058, 1058, 1070, 1070, 1070, 1070, 1070, 1070,
+     1070, 1070, 1070, 1077, 1078, 1070, 1070, 1070, 1070, 1070,
+     1070, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072,
+
+     1079, 1080, 1072, 1072, 1072, 1072, 1072, 1072,    0,    0,
+        0, 1070, 1070, 1070, 1070, 1070, 1070, 1082, 1083,    0,
+        0,    0,    0,    0,    0, 1084, 1079, 1080, 1072, 1072,
+     1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073,
+     1073, 1073, 1073, 1082, 1083, 1073, 1073, 1073, 1073, 1073,
+     1073, 1084, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1086,
+     1086, 1090, 1091, 1086, 1086, 1086, 1086, 1086, 1086,    0,
+        0, 1073, 1073, 1073, 1073, 1073, 1073,    0, 1092, 1093,
+        0,    0,    0,    0,    0,    0,    0, 1090, 1091, 1086,
+     1086, 1086, 1086, 1086, 1086, 1087, 1087, 1087, 1087, 1087,
+
+     1087, 1087, 1087, 1087, 1092, 1093, 1087, 1087, 1087, 1087,
+     1087, 1087, 1088, 1088, 1088, 1088, 1088, 1088, 1088, 1088,
+     1088, 1088, 1095, 1088, 1088, 1088, 1088, 1088, 1088, 1096,
+     1098,    0, 1087, 1087, 1087, 1087, 1087, 1087,    0,    0,
+     1103, 1104,    0,    0,    0,    0,    0,    0, 1095, 1088,
+     1088, 1088, 1088, 1088, 1088, 1096, 1098, 1101, 1101, 1101,
+     1101, 1101, 1101, 1101, 1101, 1101, 1103, 1104, 1101, 1101,
+     1101, 1101, 1101, 1101, 1102, 1102, 1102, 1102, 1102, 1102,
+     1102, 1102, 1102, 1106, 1108, 1102, 1102, 1102, 1102, 1102,
+     1102,    0,    0,    0, 1101, 1101, 1101, 1101, 1101, 1101,
+
+     1113,    0,    0,    0,    0,    0,    0,    0,    0, 1106,
+     1108, 1102, 1102, 1102, 1102, 1102, 1102, 1110, 1110, 1110,
+     1110, 1110, 1110, 1110, 1110, 1110, 1113,    0, 1110, 1110,
+     1110, 1110, 1110, 1110, 1111, 1111, 1111, 1111, 1111, 1111,
+     1111, 1111, 1111,    0,    0, 1111, 1111, 1111, 1111, 1111,
+     1111,    0,    0,    0, 1110, 1110, 1110, 1110, 1110, 1110,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1111, 1111, 1111, 1111, 1111, 1111, 1112, 1112, 1112,
+     1112, 1112, 1112, 1112, 1112, 1112, 1112,    0, 1112, 1112,
+     1112, 1112, 1112, 1112, 1117, 1117, 1117, 1117, 1117, 1117,
+
+     1117, 1117, 1117,    0,    0, 1117, 1117, 1117, 1117, 1117,
+     1117,    0,    0,    0, 1112, 1112, 1112, 1112, 1112, 1112,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1117, 1117, 1117, 1117, 1117, 1117, 1119, 1119, 1119,
+     1119, 1119, 1119, 1119, 1119, 1119,    0,    0, 1119, 1119,
+     1119, 1119, 1119, 1119, 1120, 1120, 1120, 1120, 1120, 1120,
+     1120, 1120, 1120,    0,    0, 1120, 1120, 1120, 1120, 1120,
+     1120,    0,    0,    0, 1119, 1119, 1119, 1119, 1119, 1119,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1120, 1120, 1120, 1120, 1120, 1120, 1123, 1123, 1123,
+
+     1123, 1123, 1123, 1123, 1123, 1123,    0,    0, 1123, 1123,
+     1123, 1123, 1123, 1123, 1124, 1124, 1124, 1124, 1124, 1124,
+     1124, 1124, 1124, 1124,    0, 1124, 1124, 1124, 1124, 1124,
+     1124,    0,    0,    0, 1123, 1123, 1123, 1123, 1123, 1123,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1124, 1124, 1124, 1124, 1124, 1124, 1127, 1127, 1127,
+     1127, 1127, 1127, 1127, 1127, 1127,    0,    0, 1127, 1127,
+     1127, 1127, 1127, 1127, 1129, 1129, 1129, 1129, 1129, 1129,
+     1129, 1129, 1129,    0,    0, 1129, 1129, 1129, 1129, 1129,
+     1129,    0,    0,    0, 1127, 1127, 1127, 1127, 1127, 1127,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1129, 1129, 1129, 1129, 1129, 1129,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+
+     1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+     1131, 1131, 1131
     } ;
 
 /* Table of booleans, true if rule could match eol. */
-static yyconst flex_int32_t yy_rule_can_match_eol[121] =
+static yyconst flex_int32_t yy_rule_can_match_eol[134] =
     {   0,
 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
-    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 
-    0,     };
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,     };
 
 /* The intent behind this definition is that it'll catch
  * any uses of REJECT which flex missed.
@@ -2081,6 +2251,7 @@ static yyconst flex_int32_t yy_rule_can_match_eol[121] =
 #line 5 "SrvLexer.l"
 #ifdef WIN32
 #define strncasecmp _strnicmp
+#define strcasecmp _stricmp
 #endif
 
 using namespace std;
@@ -2090,7 +2261,7 @@ using namespace std;
 #define YYABORT yyterminate();
 
 
-#line 32 "SrvLexer.l"
+#line 33 "SrvLexer.l"
 using namespace std;
   unsigned ComBeg;    // line, in which comment begins
   unsigned LftCnt;    // how many chars : on the left side of '::' char was interpreted
@@ -2102,7 +2273,7 @@ using namespace std;
 namespace std{
   yy_SrvParser_stype yylval;
 }
-#line 2106 "SrvLexer.cpp"
+#line 2277 "SrvLexer.cpp"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2209,10 +2380,10 @@ YY_DECL
 	register char *yy_cp, *yy_bp;
 	register int yy_act;
     
-#line 45 "SrvLexer.l"
+#line 46 "SrvLexer.l"
 
 
-#line 2216 "SrvLexer.cpp"
+#line 2387 "SrvLexer.cpp"
 
 	if ( !(yy_init) )
 		{
@@ -2265,13 +2436,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1002 )
+				if ( yy_current_state >= 1132 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 5773 );
+		while ( yy_base[yy_current_state] != 6438 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2584,259 +2755,324 @@ YY_RULE_SETUP
 case 56:
 YY_RULE_SETUP
 #line 109 "SrvLexer.l"
-{ return SrvParser::PDCLASS_; }
+{ return SrvParser::DUMP_INTERVAL_; }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 110 "SrvLexer.l"
-{ return SrvParser::PD_LENGTH_; }
+{ return SrvParser::OFFER_LIFETIME_; }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 111 "SrvLexer.l"
-{ return SrvParser::PD_POOL_;}
+{ return SrvParser::OFFER_LIMIT_; }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 112 "SrvLexer.l"
-{ return SrvParser::VENDOR_SPEC_; }
+{ return SrvParser::CLIENT_RATE_LIMIT_; }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 113 "SrvLexer.l"
-{ return SrvParser::SCRIPT_; }
+{ return SrvParser::LINK_RATE_LIMIT_; }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 115 "SrvLexer.l"
-{ return SrvParser::EXPERIMENTAL_; }
+#line 114 "SrvLexer.l"
+{ return SrvParser::IFACE_RATE_LIMIT_; }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 116 "SrvLexer.l"
-{ return SrvParser::ADDR_PARAMS_; }
+#line 115 "SrvLexer.l"
+{ return SrvParser::SOLICIT_EARLY_DROP_; }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 117 "SrvLexer.l"
-{ return SrvParser::REMOTE_AUTOCONF_NEIGHBORS_; }
+#line 116 "SrvLexer.l"
+{ return SrvParser::REPLICATION_PORT_; }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 119 "SrvLexer.l"
-{ return SrvParser::AFTR_; }
+#line 117 "SrvLexer.l"
+{ return SrvParser::REPLICATION_PEER_; }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 120 "SrvLexer.l"
-{ return SrvParser::INACTIVE_MODE_; }
+#line 118 "SrvLexer.l"
+{ return SrvParser::PDCLASS_; }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 121 "SrvLexer.l"
-{ return SrvParser::ACCEPT_LEASEQUERY_; }
+#line 119 "SrvLexer.l"
+{ return SrvParser::PD_LENGTH_; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 122 "SrvLexer.l"
-{ return SrvParser::BULKLQ_ACCEPT_; }
+#line 120 "SrvLexer.l"
+{ return SrvParser::PD_POOL_;}
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 123 "SrvLexer.l"
-{ return SrvParser::BULKLQ_TCPPORT_; }
+#line 121 "SrvLexer.l"
+{ return SrvParser::VENDOR_SPEC_; }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 124 "SrvLexer.l"
-{ return SrvParser::BULKLQ_MAX_CONNS_; }
+#line 122 "SrvLexer.l"
+{ return SrvParser::SCRIPT_; }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 125 "SrvLexer.l"
-{ return SrvParser::BULKLQ_TIMEOUT_; }
+#line 123 "SrvLexer.l"
+{ return SrvParser::SCRIPT_CONCURRENCY_; }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 126 "SrvLexer.l"
-{ return SrvParser::AUTH_METHOD_; }
+#line 124 "SrvLexer.l"
+{ return SrvParser::SCRIPT_QUEUE_SIZE_; }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 127 "SrvLexer.l"
-{ return SrvParser::AUTH_LIFETIME_; }
+#line 125 "SrvLexer.l"
+{ return SrvParser::SCRIPT_TIMEOUT_; }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 128 "SrvLexer.l"
-{ return SrvParser::AUTH_KEY_LEN_; }
+#line 126 "SrvLexer.l"
+{ return SrvParser::SCRIPT_BATCH_; }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 129 "SrvLexer.l"
-{ return SrvParser::DIGEST_NONE_; }
+#line 128 "SrvLexer.l"
+{ return SrvParser::EXPERIMENTAL_; }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 130 "SrvLexer.l"
-{ return SrvParser::DIGEST_PLAIN_; }
+#line 129 "SrvLexer.l"
+{ return SrvParser::ADDR_PARAMS_; }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 131 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_MD5_; }
+#line 130 "SrvLexer.l"
+{ return SrvParser::REMOTE_AUTOCONF_NEIGHBORS_; }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 132 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_SHA1_; }
+{ return SrvParser::AFTR_; }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 133 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_SHA224_; }
+{ return SrvParser::INACTIVE_MODE_; }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 134 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_SHA256_; }
+{ return SrvParser::ACCEPT_LEASEQUERY_; }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 135 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_SHA384_; }
+{ return SrvParser::BULKLQ_ACCEPT_; }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 136 "SrvLexer.l"
-{ return SrvParser::DIGEST_HMAC_SHA512_; }
+{ return SrvParser::BULKLQ_TCPPORT_; }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 137 "SrvLexer.l"
-{ return SrvParser::CLIENT_CLASS_; }
+{ return SrvParser::BULKLQ_MAX_CONNS_; }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 138 "SrvLexer.l"
-{ return SrvParser::MATCH_IF_; }
+{ return SrvParser::BULKLQ_TIMEOUT_; }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 139 "SrvLexer.l"
-{ return SrvParser::EQ_; }
+{ return SrvParser::AUTH_METHOD_; }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 140 "SrvLexer.l"
-{ return SrvParser::AND_; }
+{ return SrvParser::AUTH_LIFETIME_; }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 141 "SrvLexer.l"
-{ return SrvParser::OR_; }
+{ return SrvParser::AUTH_KEY_LEN_; }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 142 "SrvLexer.l"
-{ return SrvParser::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_; }
+{ return SrvParser::DIGEST_NONE_; }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 143 "SrvLexer.l"
-{ return SrvParser::CLIENT_VENDOR_SPEC_DATA_; }
+{ return SrvParser::DIGEST_PLAIN_; }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 144 "SrvLexer.l"
-{ return SrvParser::CLIENT_VENDOR_CLASS_EN_; }
+{ return SrvParser::DIGEST_HMAC_MD5_; }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 145 "SrvLexer.l"
-{ return SrvParser::CLIENT_VENDOR_CLASS_DATA_; }
+{ return SrvParser::DIGEST_HMAC_SHA1_; }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 146 "SrvLexer.l"
-{ return SrvParser::ALLOW_; }
+{ return SrvParser::DIGEST_HMAC_SHA224_; }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 147 "SrvLexer.l"
-{ return SrvParser::DENY_; }
+{ return SrvParser::DIGEST_HMAC_SHA256_; }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 148 "SrvLexer.l"
-{ return SrvParser::SUBSTRING_; }
+{ return SrvParser::DIGEST_HMAC_SHA384_; }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 149 "SrvLexer.l"
-{ return SrvParser::CONTAIN_; }
+{ return SrvParser::DIGEST_HMAC_SHA512_; }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 150 "SrvLexer.l"
-{ return SrvParser::STRING_KEYWORD_; }
+{ return SrvParser::CLIENT_CLASS_; }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 151 "SrvLexer.l"
-{ return SrvParser::ADDRESS_LIST_; }
+{ return SrvParser::MATCH_IF_; }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
-#line 154 "SrvLexer.l"
-{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+#line 152 "SrvLexer.l"
+{ return SrvParser::EQ_; }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
-#line 155 "SrvLexer.l"
-{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+#line 153 "SrvLexer.l"
+{ return SrvParser::AND_; }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
-#line 156 "SrvLexer.l"
-{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+#line 154 "SrvLexer.l"
+{ return SrvParser::OR_; }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 157 "SrvLexer.l"
-{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+#line 155 "SrvLexer.l"
+{ return SrvParser::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_; }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
-#line 159 "SrvLexer.l"
-;
+#line 156 "SrvLexer.l"
+{ return SrvParser::CLIENT_VENDOR_SPEC_DATA_; }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 161 "SrvLexer.l"
-;
+#line 157 "SrvLexer.l"
+{ return SrvParser::CLIENT_VENDOR_CLASS_EN_; }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
+#line 158 "SrvLexer.l"
+{ return SrvParser::CLIENT_VENDOR_CLASS_DATA_; }
+	YY_BREAK
+case 104:
+YY_RULE_SETUP
+#line 159 "SrvLexer.l"
+{ return SrvParser::ALLOW_; }
+	YY_BREAK
+case 105:
+YY_RULE_SETUP
+#line 160 "SrvLexer.l"
+{ return SrvParser::DENY_; }
+	YY_BREAK
+case 106:
+YY_RULE_SETUP
+#line 161 "SrvLexer.l"
+{ return SrvParser::SUBSTRING_; }
+	YY_BREAK
+case 107:
+YY_RULE_SETUP
+#line 162 "SrvLexer.l"
+{ return SrvParser::CONTAIN_; }
+	YY_BREAK
+case 108:
+YY_RULE_SETUP
 #line 163 "SrvLexer.l"
+{ return SrvParser::STRING_KEYWORD_; }
+	YY_BREAK
+case 109:
+YY_RULE_SETUP
+#line 164 "SrvLexer.l"
+{ return SrvParser::ADDRESS_LIST_; }
+	YY_BREAK
+case 110:
+YY_RULE_SETUP
+#line 167 "SrvLexer.l"
+{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 111:
+YY_RULE_SETUP
+#line 168 "SrvLexer.l"
+{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 112:
+YY_RULE_SETUP
+#line 169 "SrvLexer.l"
+{ yylval.ival=1; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 113:
+YY_RULE_SETUP
+#line 170 "SrvLexer.l"
+{ yylval.ival=0; return SrvParser::INTNUMBER_;}
+	YY_BREAK
+case 114:
+YY_RULE_SETUP
+#line 172 "SrvLexer.l"
+;
+	YY_BREAK
+case 115:
+YY_RULE_SETUP
+#line 174 "SrvLexer.l"
+;
+	YY_BREAK
+case 116:
+YY_RULE_SETUP
+#line 176 "SrvLexer.l"
 {
   BEGIN(COMMENT);
   ComBeg=yylineno;
 }
 	YY_BREAK
-case 104:
+case 117:
 YY_RULE_SETUP
-#line 168 "SrvLexer.l"
+#line 181 "SrvLexer.l"
 BEGIN(INITIAL);
 	YY_BREAK
-case 105:
-/* rule 105 can match eol */
+case 118:
+/* rule 118 can match eol */
 YY_RULE_SETUP
-#line 169 "SrvLexer.l"
+#line 182 "SrvLexer.l"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
-#line 170 "SrvLexer.l"
+#line 183 "SrvLexer.l"
 {
     Log(Crit) << "Comment not closed. (/* in line " << ComBeg << LogEnd;
   { YYABORT; }
@@ -2844,9 +3080,9 @@ case YY_STATE_EOF(COMMENT):
 	YY_BREAK
  //IPv6 address - various forms
 
-case 106:
+case 119:
 YY_RULE_SETUP
-#line 177 "SrvLexer.l"
+#line 190 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2856,9 +3092,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 120:
 YY_RULE_SETUP
-#line 186 "SrvLexer.l"
+#line 199 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2868,9 +3104,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 121:
 YY_RULE_SETUP
-#line 195 "SrvLexer.l"
+#line 208 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2880,9 +3116,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 122:
 YY_RULE_SETUP
-#line 204 "SrvLexer.l"
+#line 217 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2892,9 +3128,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 123:
 YY_RULE_SETUP
-#line 213 "SrvLexer.l"
+#line 226 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2904,9 +3140,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 124:
 YY_RULE_SETUP
-#line 222 "SrvLexer.l"
+#line 235 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2916,9 +3152,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 125:
 YY_RULE_SETUP
-#line 231 "SrvLexer.l"
+#line 244 "SrvLexer.l"
 {
     if(!inet_pton6(yytext,yylval.addrval)) {
 	Log(Crit) << "Invalid address format: [" << yytext << "]" << LogEnd;
@@ -2930,10 +3166,10 @@ YY_RULE_SETUP
 	YY_BREAK
  //STRING (interface identifier,dns server etc.)
 
-case 113:
-/* rule 113 can match eol */
+case 126:
+/* rule 126 can match eol */
 YY_RULE_SETUP
-#line 243 "SrvLexer.l"
+#line 256 "SrvLexer.l"
 {
     yylval.strval=new char[strlen(yytext)-1];
     strncpy(yylval.strval, yytext+1, strlen(yytext)-2);
@@ -2941,9 +3177,9 @@ YY_RULE_SETUP
     return SrvParser::STRING_;
 }
 	YY_BREAK
-case 114:
+case 127:
 YY_RULE_SETUP
-#line 250 "SrvLexer.l"
+#line 263 "SrvLexer.l"
 {
     int len = strlen(yytext);
     if ( ( (len>2) && !strncasecmp("yes",yytext,3) ) ||
@@ -2965,9 +3201,9 @@ YY_RULE_SETUP
     return SrvParser::STRING_;
 }
 	YY_BREAK
-case 115:
+case 128:
 YY_RULE_SETUP
-#line 271 "SrvLexer.l"
+#line 284 "SrvLexer.l"
 {
     // DUID
     int len;
@@ -3000,9 +3236,9 @@ YY_RULE_SETUP
    return SrvParser::DUID_;
 }
 	YY_BREAK
-case 116:
+case 129:
 YY_RULE_SETUP
-#line 303 "SrvLexer.l"
+#line 316 "SrvLexer.l"
 {
    int len = (strlen(yytext)+1)/3;
    char * pos = 0;
@@ -3031,9 +3267,9 @@ YY_RULE_SETUP
    return SrvParser::DUID_;
 }
 	YY_BREAK
-case 117:
+case 130:
 YY_RULE_SETUP
-#line 331 "SrvLexer.l"
+#line 344 "SrvLexer.l"
 {
     // HEX NUMBER
     yytext[strlen(yytext)-1]='\n';
@@ -3044,9 +3280,9 @@ YY_RULE_SETUP
     return SrvParser::HEXNUMBER_;
 }
 	YY_BREAK
-case 118:
+case 131:
 YY_RULE_SETUP
-#line 341 "SrvLexer.l"
+#line 354 "SrvLexer.l"
 {
     // DECIMAL NUMBER
     if(!sscanf(yytext,"%u",&(yylval.ival))) {
@@ -3056,17 +3292,17 @@ YY_RULE_SETUP
     return SrvParser::INTNUMBER_;
 }
 	YY_BREAK
-case 119:
+case 132:
 YY_RULE_SETUP
-#line 350 "SrvLexer.l"
+#line 363 "SrvLexer.l"
 { return yytext[0]; }
 	YY_BREAK
-case 120:
+case 133:
 YY_RULE_SETUP
-#line 353 "SrvLexer.l"
+#line 366 "SrvLexer.l"
 ECHO;
 	YY_BREAK
-#line 3070 "SrvLexer.cpp"
+#line 3306 "SrvLexer.cpp"
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(ADDR):
 	yyterminate();
@@ -3448,7 +3684,7 @@ int yyFlexLexer::yy_get_next_buffer()
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1002 )
+			if ( yy_current_state >= 1132 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -3476,11 +3712,11 @@ int yyFlexLexer::yy_get_next_buffer()
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1002 )
+		if ( yy_current_state >= 1132 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1001);
+	yy_is_jam = (yy_current_state == 1131);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3976,7 +4212,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 353 "SrvLexer.l"
+#line 370 "SrvLexer.l"
 
 
 
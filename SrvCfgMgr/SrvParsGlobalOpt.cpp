@@ -23,6 +23,16 @@ TSrvParsGlobalOpt::TSrvParsGlobalOpt(void) {
     this->GuessMode        = false;
     this->AuthLifetime     = DHCPV6_INFINITY;
     this->AuthKeyLen       = 16;
+    this->SolicitEarlyDrop = true;
+    this->ReplicationPort  = 0;
+    this->ReplicationPeerPort = 0;
+    this->LeaseDumpInterval = SERVER_DEFAULT_LEASE_DUMP_INTERVAL;
+    this->OfferLifetime    = SERVER_DEFAULT_OFFER_LIFETIME;
+    this->OfferLimit       = SERVER_DEFAULT_OFFER_LIMIT;
+    for (int i=0; i<SRV_RATE_LIMIT_MAX; i++) {
+        RateLimit[i].Rate  = 0;
+        RateLimit[i].Burst = 0;
+    }
 
     this->DigestLst.clear();
 }
@@ -122,3 +132,80 @@ bool TSrvParsGlobalOpt::getGuessMode()
 {
     return GuessMode;
 }
+
+void TSrvParsGlobalOpt::setRateLimit(ESrvRateLimit type, unsigned int rate, unsigned int burst)
+{
+    RateLimit[type].Rate  = rate;
+    RateLimit[type].Burst = burst ? burst : rate;
+}
+
+TSrvRateLimit TSrvParsGlobalOpt::getRateLimit(ESrvRateLimit type)
+{
+    return RateLimit[type];
+}
+
+void TSrvParsGlobalOpt::setSolicitEarlyDrop(bool drop)
+{
+    SolicitEarlyDrop = drop;
+}
+
+bool TSrvParsGlobalOpt::getSolicitEarlyDrop()
+{
+    return SolicitEarlyDrop;
+}
+
+void TSrvParsGlobalOpt::setReplicationPort(unsigned short port)
+{
+    ReplicationPort = port;
+}
+
+unsigned short TSrvParsGlobalOpt::getReplicationPort()
+{
+    return ReplicationPort;
+}
+
+void TSrvParsGlobalOpt::setReplicationPeer(SPtr<TIPv6Addr> addr, unsigned short port)
+{
+    ReplicationPeer     = addr;
+    ReplicationPeerPort = port;
+}
+
+SPtr<TIPv6Addr> TSrvParsGlobalOpt::getReplicationPeer()
+{
+    return ReplicationPeer;
+}
+
+unsigned short TSrvParsGlobalOpt::getReplicationPeerPort()
+{
+    return ReplicationPeerPort;
+}
+
+void TSrvParsGlobalOpt::setLeaseDumpInterval(unsigned int interval)
+{
+    LeaseDumpInterval = interval;
+}
+
+unsigned int TSrvParsGlobalOpt::getLeaseDumpInterval()
+{
+    return LeaseDumpInterval;
+}
+
+void TSrvParsGlobalOpt::setOfferLifetime(unsigned int lifetime)
+{
+    OfferLifetime = lifetime;
+}
+
+unsigned int TSrvParsGlobalOpt::getOfferLifetime()
+{
+    return OfferLifetime;
+}
+
+void TSrvParsGlobalOpt::setOfferLimit(unsigned int limit)
+{
+    OfferLimit = limit;
+}
+
+unsigned int TSrvParsGlobalOpt::getOfferLimit()
+{
+    return OfferLimit;
+}
@@ -22,6 +22,20 @@ typedef enum {
     SRV_IFACE_ID_ORDER_NONE
 } ESrvIfaceIdOrder;
 
+/// admission control buckets
+typedef enum {
+    SRV_RATE_LIMIT_CLIENT, // per client DUID
+    SRV_RATE_LIMIT_LINK,   // per relay link-address/interface-id
+    SRV_RATE_LIMIT_IFACE,  // per (physical or relay) interface
+    SRV_RATE_LIMIT_MAX
+} ESrvRateLimit;
+
+/// token bucket parameters: Rate messages per second, up to Burst at once (Rate=0 means no limit)
+struct TSrvRateLimit {
+    unsigned int Rate;
+    unsigned int Burst;
+};
+
 class TSrvParsGlobalOpt : public TSrvParsIfaceOpt
 {
 public:
@@ -44,6 +58,21 @@ public:
     bool getInactiveMode();
     void setGuessMode(bool guess);
     bool getGuessMode();
+    void setRateLimit(ESrvRateLimit type, unsigned int rate, unsigned int burst);
+    TSrvRateLimit getRateLimit(ESrvRateLimit type);
+    void setSolicitEarlyDrop(bool drop);
+    bool getSolicitEarlyDrop();
+    void setReplicationPort(unsigned short port);
+    unsigned short getReplicationPort();
+    void setReplicationPeer(SPtr<TIPv6Addr> addr, unsigned short port);
+    SPtr<TIPv6Addr> getReplicationPeer();
+    unsigned short getReplicationPeerPort();
+    void setLeaseDumpInterval(unsigned int interval);
+    unsigned int getLeaseDumpInterval();
+    void setOfferLifetime(unsigned int lifetime);
+    unsigned int getOfferLifetime();
+    void setOfferLimit(unsigned int limit);
+    unsigned int getOfferLimit();
 
     void setAuthLifetime(unsigned int lifetime);
     unsigned int getAuthLifetime();
@@ -61,5 +90,13 @@ private:
     unsigned int AuthKeyLen;
     List(DigestTypes) DigestLst;
     ESrvIfaceIdOrder InterfaceIDOrder;
+    TSrvRateLimit RateLimit[SRV_RATE_LIMIT_MAX];
+    bool   SolicitEarlyDrop;
+    unsigned short ReplicationPort;     // 0 = don't accept replication stream
+    SPtr<TIPv6Addr> ReplicationPeer;    // peer we send our leases to (or 0)
+    unsigned short ReplicationPeerPort;
+    unsigned int LeaseDumpInterval;     // min. time between lease database writes
+    unsigned int OfferLifetime;         // how long ADVERTISEd address is held
+    unsigned int OfferLimit;            // max. addresses held as offers on a link
 };
 #endif
@@ -433,60 +433,73 @@ typedef
 #define	CLNT_MAX_LEASE_	299
 #define	STATELESS_	300
 #define	CACHE_SIZE_	301
-#define	PDCLASS_	302
-#define	PD_LENGTH_	303
-#define	PD_POOL_	304
-#define	SCRIPT_	305
-#define	VENDOR_SPEC_	306
-#define	CLIENT_	307
-#define	DUID_KEYWORD_	308
-#define	REMOTE_ID_	309
-#define	ADDRESS_	310
-#define	GUESS_MODE_	311
-#define	INACTIVE_MODE_	312
-#define	EXPERIMENTAL_	313
-#define	ADDR_PARAMS_	314
-#define	REMOTE_AUTOCONF_NEIGHBORS_	315
-#define	AFTR_	316
-#define	AUTH_METHOD_	317
-#define	AUTH_LIFETIME_	318
-#define	AUTH_KEY_LEN_	319
-#define	DIGEST_NONE_	320
-#define	DIGEST_PLAIN_	321
-#define	DIGEST_HMAC_MD5_	322
-#define	DIGEST_HMAC_SHA1_	323
-#define	DIGEST_HMAC_SHA224_	324
-#define	DIGEST_HMAC_SHA256_	325
-#define	DIGEST_HMAC_SHA384_	326
-#define	DIGEST_HMAC_SHA512_	327
-#define	ACCEPT_LEASEQUERY_	328
-#define	BULKLQ_ACCEPT_	329
-#define	BULKLQ_TCPPORT_	330
-#define	BULKLQ_MAX_CONNS_	331
-#define	BULKLQ_TIMEOUT_	332
-#define	CLIENT_CLASS_	333
-#define	MATCH_IF_	334
-#define	EQ_	335
-#define	AND_	336
-#define	OR_	337
-#define	CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_	338
-#define	CLIENT_VENDOR_SPEC_DATA_	339
-#define	CLIENT_VENDOR_CLASS_EN_	340
-#define	CLIENT_VENDOR_CLASS_DATA_	341
-#define	ALLOW_	342
-#define	DENY_	343
-#define	SUBSTRING_	344
-#define	STRING_KEYWORD_	345
-#define	ADDRESS_LIST_	346
-#define	CONTAIN_	347
-#define	NEXT_HOP_	348
-#define	ROUTE_	349
-#define	INFINITE_	350
-#define	STRING_	351
-#define	HEXNUMBER_	352
-#define	INTNUMBER_	353
-#define	IPV6ADDR_	354
-#define	DUID_	355
+#define	DUMP_INTERVAL_	302
+#define	OFFER_LIFETIME_	303
+#define	OFFER_LIMIT_	304
+#define	CLIENT_RATE_LIMIT_	305
+#define	LINK_RATE_LIMIT_	306
+#define	IFACE_RATE_LIMIT_	307
+#define	SOLICIT_EARLY_DROP_	308
+#define	REPLICATION_PORT_	309
+#define	REPLICATION_PEER_	310
+#define	PDCLASS_	311
+#define	PD_LENGTH_	312
+#define	PD_POOL_	313
+#define	SCRIPT_	314
+#define	SCRIPT_CONCURRENCY_	315
+#define	SCRIPT_QUEUE_SIZE_	316
+#define	SCRIPT_TIMEOUT_	317
+#define	SCRIPT_BATCH_	318
+#define	VENDOR_SPEC_	319
+#define	CLIENT_	320
+#define	DUID_KEYWORD_	321
+#define	REMOTE_ID_	322
+#define	ADDRESS_	323
+#define	GUESS_MODE_	324
+#define	INACTIVE_MODE_	325
+#define	EXPERIMENTAL_	326
+#define	ADDR_PARAMS_	327
+#define	REMOTE_AUTOCONF_NEIGHBORS_	328
+#define	AFTR_	329
+#define	AUTH_METHOD_	330
+#define	AUTH_LIFETIME_	331
+#define	AUTH_KEY_LEN_	332
+#define	DIGEST_NONE_	333
+#define	DIGEST_PLAIN_	334
+#define	DIGEST_HMAC_MD5_	335
+#define	DIGEST_HMAC_SHA1_	336
+#define	DIGEST_HMAC_SHA224_	337
+#define	DIGEST_HMAC_SHA256_	338
+#define	DIGEST_HMAC_SHA384_	339
+#define	DIGEST_HMAC_SHA512_	340
+#define	ACCEPT_LEASEQUERY_	341
+#define	BULKLQ_ACCEPT_	342
+#define	BULKLQ_TCPPORT_	343
+#define	BULKLQ_MAX_CONNS_	344
+#define	BULKLQ_TIMEOUT_	345
+#define	CLIENT_CLASS_	346
+#define	MATCH_IF_	347
+#define	EQ_	348
+#define	AND_	349
+#define	OR_	350
+#define	CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_	351
+#define	CLIENT_VENDOR_SPEC_DATA_	352
+#define	CLIENT_VENDOR_CLASS_EN_	353
+#define	CLIENT_VENDOR_CLASS_DATA_	354
+#define	ALLOW_	355
+#define	DENY_	356
+#define	SUBSTRING_	357
+#define	STRING_KEYWORD_	358
+#define	ADDRESS_LIST_	359
+#define	CONTAIN_	360
+#define	NEXT_HOP_	361
+#define	ROUTE_	362
+#define	INFINITE_	363
+#define	STRING_	364
+#define	HEXNUMBER_	365
+#define	INTNUMBER_	366
+#define	IPV6ADDR_	367
+#define	DUID_	368
 
 
 #line 263 "../bison++/bison.cc"
@@ -580,10 +593,23 @@ static const int CLASS_MAX_LEASE_;
 static const int CLNT_MAX_LEASE_;
 static const int STATELESS_;
 static const int CACHE_SIZE_;
+static const int DUMP_INTERVAL_;
+static const int OFFER_LIFETIME_;
+static const int OFFER_LIMIT_;
+static const int CLIENT_RATE_LIMIT_;
+static const int LINK_RATE_LIMIT_;
+static const int IFACE_RATE_LIMIT_;
+static const int SOLICIT_EARLY_DROP_;
+static const int REPLICATION_PORT_;
+static const int REPLICATION_PEER_;
 static const int PDCLASS_;
 static const int PD_LENGTH_;
 static const int PD_POOL_;
 static const int SCRIPT_;
+static const int SCRIPT_CONCURRENCY_;
+static const int SCRIPT_QUEUE_SIZE_;
+static const int SCRIPT_TIMEOUT_;
+static const int SCRIPT_BATCH_;
 static const int VENDOR_SPEC_;
 static const int CLIENT_;
 static const int DUID_KEYWORD_;
@@ -686,60 +712,73 @@ enum YY_SrvParser_ENUM_TOKEN { YY_SrvParser_NULL_TOKEN=0
 	,CLNT_MAX_LEASE_=299
 	,STATELESS_=300
 	,CACHE_SIZE_=301
-	,PDCLASS_=302
-	,PD_LENGTH_=303
-	,PD_POOL_=304
-	,SCRIPT_=305
-	,VENDOR_SPEC_=306
-	,CLIENT_=307
-	,DUID_KEYWORD_=308
-	,REMOTE_ID_=309
-	,ADDRESS_=310
-	,GUESS_MODE_=311
-	,INACTIVE_MODE_=312
-	,EXPERIMENTAL_=313
-	,ADDR_PARAMS_=314
-	,REMOTE_AUTOCONF_NEIGHBORS_=315
-	,AFTR_=316
-	,AUTH_METHOD_=317
-	,AUTH_LIFETIME_=318
-	,AUTH_KEY_LEN_=319
-	,DIGEST_NONE_=320
-	,DIGEST_PLAIN_=321
-	,DIGEST_HMAC_MD5_=322
-	,DIGEST_HMAC_SHA1_=323
-	,DIGEST_HMAC_SHA224_=324
-	,DIGEST_HMAC_SHA256_=325
-	,DIGEST_HMAC_SHA384_=326
-	,DIGEST_HMAC_SHA512_=327
-	,ACCEPT_LEASEQUERY_=328
-	,BULKLQ_ACCEPT_=329
-	,BULKLQ_TCPPORT_=330
-	,BULKLQ_MAX_CONNS_=331
-	,BULKLQ_TIMEOUT_=332
-	,CLIENT_CLASS_=333
-	,MATCH_IF_=334
-	,EQ_=335
-	,AND_=336
-	,OR_=337
-	,CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=338
-	,CLIENT_VENDOR_SPEC_DATA_=339
-	,CLIENT_VENDOR_CLASS_EN_=340
-	,CLIENT_VENDOR_CLASS_DATA_=341
-	,ALLOW_=342
-	,DENY_=343
-	,SUBSTRING_=344
-	,STRING_KEYWORD_=345
-	,ADDRESS_LIST_=346
-	,CONTAIN_=347
-	,NEXT_HOP_=348
-	,ROUTE_=349
-	,INFINITE_=350
-	,STRING_=351
-	,HEXNUMBER_=352
-	,INTNUMBER_=353
-	,IPV6ADDR_=354
-	,DUID_=355
+	,DUMP_INTERVAL_=302
+	,OFFER_LIFETIME_=303
+	,OFFER_LIMIT_=304
+	,CLIENT_RATE_LIMIT_=305
+	,LINK_RATE_LIMIT_=306
+	,IFACE_RATE_LIMIT_=307
+	,SOLICIT_EARLY_DROP_=308
+	,REPLICATION_PORT_=309
+	,REPLICATION_PEER_=310
+	,PDCLASS_=311
+	,PD_LENGTH_=312
+	,PD_POOL_=313
+	,SCRIPT_=314
+	,SCRIPT_CONCURRENCY_=315
+	,SCRIPT_QUEUE_SIZE_=316
+	,SCRIPT_TIMEOUT_=317
+	,SCRIPT_BATCH_=318
+	,VENDOR_SPEC_=319
+	,CLIENT_=320
+	,DUID_KEYWORD_=321
+	,REMOTE_ID_=322
+	,ADDRESS_=323
+	,GUESS_MODE_=324
+	,INACTIVE_MODE_=325
+	,EXPERIMENTAL_=326
+	,ADDR_PARAMS_=327
+	,REMOTE_AUTOCONF_NEIGHBORS_=328
+	,AFTR_=329
+	,AUTH_METHOD_=330
+	,AUTH_LIFETIME_=331
+	,AUTH_KEY_LEN_=332
+	,DIGEST_NONE_=333
+	,DIGEST_PLAIN_=334
+	,DIGEST_HMAC_MD5_=335
+	,DIGEST_HMAC_SHA1_=336
+	,DIGEST_HMAC_SHA224_=337
+	,DIGEST_HMAC_SHA256_=338
+	,DIGEST_HMAC_SHA384_=339
+	,DIGEST_HMAC_SHA512_=340
+	,ACCEPT_LEASEQUERY_=341
+	,BULKLQ_ACCEPT_=342
+	,BULKLQ_TCPPORT_=343
+	,BULKLQ_MAX_CONNS_=344
+	,BULKLQ_TIMEOUT_=345
+	,CLIENT_CLASS_=346
+	,MATCH_IF_=347
+	,EQ_=348
+	,AND_=349
+	,OR_=350
+	,CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=351
+	,CLIENT_VENDOR_SPEC_DATA_=352
+	,CLIENT_VENDOR_CLASS_EN_=353
+	,CLIENT_VENDOR_CLASS_DATA_=354
+	,ALLOW_=355
+	,DENY_=356
+	,SUBSTRING_=357
+	,STRING_KEYWORD_=358
+	,ADDRESS_LIST_=359
+	,CONTAIN_=360
+	,NEXT_HOP_=361
+	,ROUTE_=362
+	,INFINITE_=363
+	,STRING_=364
+	,HEXNUMBER_=365
+	,INTNUMBER_=366
+	,IPV6ADDR_=367
+	,DUID_=368
 
 
 #line 310 "../bison++/bison.cc"
@@ -820,60 +859,73 @@ const int YY_SrvParser_CLASS::CLASS_MAX_LEASE_=298;
 const int YY_SrvParser_CLASS::CLNT_MAX_LEASE_=299;
 const int YY_SrvParser_CLASS::STATELESS_=300;
 const int YY_SrvParser_CLASS::CACHE_SIZE_=301;
-const int YY_SrvParser_CLASS::PDCLASS_=302;
-const int YY_SrvParser_CLASS::PD_LENGTH_=303;
-const int YY_SrvParser_CLASS::PD_POOL_=304;
-const int YY_SrvParser_CLASS::SCRIPT_=305;
-const int YY_SrvParser_CLASS::VENDOR_SPEC_=306;
-const int YY_SrvParser_CLASS::CLIENT_=307;
-const int YY_SrvParser_CLASS::DUID_KEYWORD_=308;
-const int YY_SrvParser_CLASS::REMOTE_ID_=309;
-const int YY_SrvParser_CLASS::ADDRESS_=310;
-const int YY_SrvParser_CLASS::GUESS_MODE_=311;
-const int YY_SrvParser_CLASS::INACTIVE_MODE_=312;
-const int YY_SrvParser_CLASS::EXPERIMENTAL_=313;
-const int YY_SrvParser_CLASS::ADDR_PARAMS_=314;
-const int YY_SrvParser_CLASS::REMOTE_AUTOCONF_NEIGHBORS_=315;
-const int YY_SrvParser_CLASS::AFTR_=316;
-const int YY_SrvParser_CLASS::AUTH_METHOD_=317;
-const int YY_SrvParser_CLASS::AUTH_LIFETIME_=318;
-const int YY_SrvParser_CLASS::AUTH_KEY_LEN_=319;
-const int YY_SrvParser_CLASS::DIGEST_NONE_=320;
-const int YY_SrvParser_CLASS::DIGEST_PLAIN_=321;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_MD5_=322;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA1_=323;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA224_=324;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA256_=325;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA384_=326;
-const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA512_=327;
-const int YY_SrvParser_CLASS::ACCEPT_LEASEQUERY_=328;
-const int YY_SrvParser_CLASS::BULKLQ_ACCEPT_=329;
-const int YY_SrvParser_CLASS::BULKLQ_TCPPORT_=330;
-const int YY_SrvParser_CLASS::BULKLQ_MAX_CONNS_=331;
-const int YY_SrvParser_CLASS::BULKLQ_TIMEOUT_=332;
-const int YY_SrvParser_CLASS::CLIENT_CLASS_=333;
-const int YY_SrvParser_CLASS::MATCH_IF_=334;
-const int YY_SrvParser_CLASS::EQ_=335;
-const int YY_SrvParser_CLASS::AND_=336;
-const int YY_SrvParser_CLASS::OR_=337;
-const int YY_SrvParser_CLASS::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=338;
-const int YY_SrvParser_CLASS::CLIENT_VENDOR_SPEC_DATA_=339;
-const int YY_SrvParser_CLASS::CLIENT_VENDOR_CLASS_EN_=340;
-const int YY_SrvParser_CLASS::CLIENT_VENDOR_CLASS_DATA_=341;
-const int YY_SrvParser_CLASS::ALLOW_=342;
-const int YY_SrvParser_CLASS::DENY_=343;
-const int YY_SrvParser_CLASS::SUBSTRING_=344;
-const int YY_SrvParser_CLASS::STRING_KEYWORD_=345;
-const int YY_SrvParser_CLASS::ADDRESS_LIST_=346;
-const int YY_SrvParser_CLASS::CONTAIN_=347;
-const int YY_SrvParser_CLASS::NEXT_HOP_=348;
-const int YY_SrvParser_CLASS::ROUTE_=349;
-const int YY_SrvParser_CLASS::INFINITE_=350;
-const int YY_SrvParser_CLASS::STRING_=351;
-const int YY_SrvParser_CLASS::HEXNUMBER_=352;
-const int YY_SrvParser_CLASS::INTNUMBER_=353;
-const int YY_SrvParser_CLASS::IPV6ADDR_=354;
-const int YY_SrvParser_CLASS::DUID_=355;
+const int YY_SrvParser_CLASS::DUMP_INTERVAL_=302;
+const int YY_SrvParser_CLASS::OFFER_LIFETIME_=303;
+const int YY_SrvParser_CLASS::OFFER_LIMIT_=304;
+const int YY_SrvParser_CLASS::CLIENT_RATE_LIMIT_=305;
+const int YY_SrvParser_CLASS::LINK_RATE_LIMIT_=306;
+const int YY_SrvParser_CLASS::IFACE_RATE_LIMIT_=307;
+const int YY_SrvParser_CLASS::SOLICIT_EARLY_DROP_=308;
+const int YY_SrvParser_CLASS::REPLICATION_PORT_=309;
+const int YY_SrvParser_CLASS::REPLICATION_PEER_=310;
+const int YY_SrvParser_CLASS::PDCLASS_=311;
+const int YY_SrvParser_CLASS::PD_LENGTH_=312;
+const int YY_SrvParser_CLASS::PD_POOL_=313;
+const int YY_SrvParser_CLASS::SCRIPT_=314;
+const int YY_SrvParser_CLASS::SCRIPT_CONCURRENCY_=315;
+const int YY_SrvParser_CLASS::SCRIPT_QUEUE_SIZE_=316;
+const int YY_SrvParser_CLASS::SCRIPT_TIMEOUT_=317;
+const int YY_SrvParser_CLASS::SCRIPT_BATCH_=318;
+const int YY_SrvParser_CLASS::VENDOR_SPEC_=319;
+const int YY_SrvParser_CLASS::CLIENT_=320;
+const int YY_SrvParser_CLASS::DUID_KEYWORD_=321;
+const int YY_SrvParser_CLASS::REMOTE_ID_=322;
+const int YY_SrvParser_CLASS::ADDRESS_=323;
+const int YY_SrvParser_CLASS::GUESS_MODE_=324;
+const int YY_SrvParser_CLASS::INACTIVE_MODE_=325;
+const int YY_SrvParser_CLASS::EXPERIMENTAL_=326;
+const int YY_SrvParser_CLASS::ADDR_PARAMS_=327;
+const int YY_SrvParser_CLASS::REMOTE_AUTOCONF_NEIGHBORS_=328;
+const int YY_SrvParser_CLASS::AFTR_=329;
+const int YY_SrvParser_CLASS::AUTH_METHOD_=330;
+const int YY_SrvParser_CLASS::AUTH_LIFETIME_=331;
+const int YY_SrvParser_CLASS::AUTH_KEY_LEN_=332;
+const int YY_SrvParser_CLASS::DIGEST_NONE_=333;
+const int YY_SrvParser_CLASS::DIGEST_PLAIN_=334;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_MD5_=335;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA1_=336;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA224_=337;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA256_=338;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA384_=339;
+const int YY_SrvParser_CLASS::DIGEST_HMAC_SHA512_=340;
+const int YY_SrvParser_CLASS::ACCEPT_LEASEQUERY_=341;
+const int YY_SrvParser_CLASS::BULKLQ_ACCEPT_=342;
+const int YY_SrvParser_CLASS::BULKLQ_TCPPORT_=343;
+const int YY_SrvParser_CLASS::BULKLQ_MAX_CONNS_=344;
+const int YY_SrvParser_CLASS::BULKLQ_TIMEOUT_=345;
+const int YY_SrvParser_CLASS::CLIENT_CLASS_=346;
+const int YY_SrvParser_CLASS::MATCH_IF_=347;
+const int YY_SrvParser_CLASS::EQ_=348;
+const int YY_SrvParser_CLASS::AND_=349;
+const int YY_SrvParser_CLASS::OR_=350;
+const int YY_SrvParser_CLASS::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=351;
+const int YY_SrvParser_CLASS::CLIENT_VENDOR_SPEC_DATA_=352;
+const int YY_SrvParser_CLASS::CLIENT_VENDOR_CLASS_EN_=353;
+const int YY_SrvParser_CLASS::CLIENT_VENDOR_CLASS_DATA_=354;
+const int YY_SrvParser_CLASS::ALLOW_=355;
+const int YY_SrvParser_CLASS::DENY_=356;
+const int YY_SrvParser_CLASS::SUBSTRING_=357;
+const int YY_SrvParser_CLASS::STRING_KEYWORD_=358;
+const int YY_SrvParser_CLASS::ADDRESS_LIST_=359;
+const int YY_SrvParser_CLASS::CONTAIN_=360;
+const int YY_SrvParser_CLASS::NEXT_HOP_=361;
+const int YY_SrvParser_CLASS::ROUTE_=362;
+const int YY_SrvParser_CLASS::INFINITE_=363;
+const int YY_SrvParser_CLASS::STRING_=364;
+const int YY_SrvParser_CLASS::HEXNUMBER_=365;
+const int YY_SrvParser_CLASS::INTNUMBER_=366;
+const int YY_SrvParser_CLASS::IPV6ADDR_=367;
+const int YY_SrvParser_CLASS::DUID_=368;
 
 
 #line 341 "../bison++/bison.cc"
@@ -892,18 +944,18 @@ YY_SrvParser_CONSTRUCTOR_CODE;
  #line 352 "../bison++/bison.cc"
 
 
-#define	YYFINAL		434
+#define	YYFINAL		471
 #define	YYFLAG		-32768
-#define	YYNTBASE	108
+#define	YYNTBASE	121
 
-#define YYTRANSLATE(x) ((unsigned)(x) <= 355 ? yytranslate[x] : 229)
+#define YYTRANSLATE(x) ((unsigned)(x) <= 368 ? yytranslate[x] : 249)
 
 static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,   106,
-   107,     2,     2,   105,   103,     2,   104,     2,     2,     2,
+     2,     2,     2,     2,     2,     2,     2,     2,     2,   119,
+   120,     2,     2,   118,   116,     2,   117,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -911,7 +963,7 @@ static const char yytranslate[] = {     0,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,   101,     2,   102,     2,     2,     2,     2,     2,
+     2,     2,   114,     2,   115,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
      2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -934,7 +986,8 @@ static const char yytranslate[] = {     0,
     66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
     76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
     86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
-    96,    97,    98,    99,   100
+    96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
+   106,   107,   108,   109,   110,   111,   112,   113
 };
 
 #if YY_SrvParser_DEBUG != 0
@@ -944,150 +997,161 @@ static const short yyprhs[] = {     0,
     41,    43,    45,    47,    49,    51,    53,    55,    57,    59,
     61,    63,    65,    67,    69,    71,    73,    75,    77,    79,
     81,    83,    85,    87,    89,    91,    93,    95,    97,    99,
-   101,   103,   105,   107,   109,   111,   113,   115,   117,   118,
-   125,   126,   133,   135,   138,   140,   142,   144,   146,   149,
-   152,   155,   158,   159,   167,   168,   178,   180,   183,   185,
-   187,   189,   191,   193,   195,   197,   199,   201,   203,   205,
-   207,   209,   211,   213,   216,   217,   223,   225,   228,   229,
-   235,   237,   240,   242,   244,   246,   248,   250,   252,   254,
-   256,   257,   263,   265,   268,   270,   272,   274,   276,   278,
-   280,   282,   284,   285,   292,   295,   297,   300,   307,   312,
-   319,   322,   325,   328,   331,   334,   337,   340,   343,   346,
-   349,   351,   355,   359,   363,   369,   375,   377,   379,   381,
-   385,   391,   399,   401,   405,   407,   411,   415,   419,   425,
-   429,   431,   435,   439,   445,   447,   451,   455,   461,   462,
-   466,   467,   471,   472,   476,   477,   481,   484,   487,   492,
-   495,   500,   503,   506,   511,   514,   519,   522,   525,   528,
-   532,   537,   542,   543,   549,   554,   555,   560,   563,   566,
-   569,   572,   575,   578,   581,   584,   587,   589,   591,   594,
-   596,   598,   601,   604,   606,   609,   612,   615,   618,   621,
-   624,   627,   630,   633,   636,   638,   640,   642,   644,   646,
-   648,   650,   652,   654,   656,   658,   660,   663,   666,   667,
-   672,   673,   678,   679,   684,   688,   689,   694,   695,   700,
-   701,   706,   707,   713,   714,   721,   725,   728,   731,   734,
-   737,   738,   743,   744,   749,   753,   757,   761,   762,   767,
-   768,   775,   778,   779,   785,   791,   797,   803,   805,   807,
-   809,   811
+   101,   103,   105,   107,   109,   111,   113,   115,   117,   119,
+   121,   123,   125,   127,   129,   131,   132,   139,   140,   147,
+   149,   152,   154,   156,   158,   160,   163,   166,   169,   172,
+   173,   181,   182,   192,   194,   197,   199,   201,   203,   205,
+   207,   209,   211,   213,   215,   217,   219,   221,   223,   225,
+   227,   230,   231,   237,   239,   242,   243,   249,   251,   254,
+   256,   258,   260,   262,   264,   266,   268,   270,   271,   277,
+   279,   282,   284,   286,   288,   290,   292,   294,   296,   298,
+   299,   306,   309,   311,   314,   321,   326,   333,   336,   339,
+   342,   345,   348,   351,   354,   357,   360,   363,   365,   369,
+   373,   377,   383,   389,   391,   393,   395,   399,   405,   413,
+   415,   419,   421,   425,   429,   433,   439,   443,   445,   449,
+   453,   459,   461,   465,   469,   475,   476,   480,   481,   485,
+   486,   490,   491,   495,   498,   501,   506,   509,   514,   517,
+   520,   525,   528,   533,   536,   539,   542,   546,   551,   556,
+   557,   563,   568,   569,   574,   577,   580,   583,   586,   589,
+   592,   595,   598,   601,   603,   605,   608,   611,   614,   617,
+   620,   622,   624,   627,   630,   633,   636,   639,   642,   645,
+   648,   652,   656,   660,   663,   666,   670,   672,   675,   678,
+   681,   684,   687,   690,   693,   696,   699,   702,   704,   706,
+   708,   710,   712,   714,   716,   718,   720,   722,   724,   726,
+   729,   732,   733,   738,   739,   744,   745,   750,   754,   755,
+   760,   761,   766,   767,   772,   773,   779,   780,   787,   791,
+   794,   797,   800,   803,   804,   809,   810,   815,   819,   823,
+   827,   828,   833,   834,   841,   844,   845,   851,   857,   863,
+   869,   871,   873,   875,   877
 };
 
-static const short yyrhs[] = {   109,
-     0,     0,   110,     0,   112,     0,   109,   110,     0,   109,
-   112,     0,   111,     0,   175,     0,   174,     0,   176,     0,
-   177,     0,   178,     0,   179,     0,   185,     0,   137,     0,
-   138,     0,   139,     0,   183,     0,   184,     0,   212,     0,
-   213,     0,   214,     0,   180,     0,   224,     0,   181,     0,
-   193,     0,   191,     0,   192,     0,   186,     0,   187,     0,
-   188,     0,   189,     0,   190,     0,   171,     0,   173,     0,
-   172,     0,   170,     0,   162,     0,   196,     0,   198,     0,
-   200,     0,   202,     0,   203,     0,   205,     0,   207,     0,
-   211,     0,   215,     0,   219,     0,   217,     0,   220,     0,
-   165,     0,   221,     0,   166,     0,   168,     0,   129,     0,
-   222,     0,   116,     0,   182,     0,     0,     3,    96,   101,
-   113,   115,   102,     0,     0,     3,   141,   101,   114,   115,
-   102,     0,   111,     0,   115,   111,     0,   122,     0,   125,
-     0,   133,     0,   136,     0,   115,   125,     0,   115,   122,
-     0,   115,   133,     0,   115,   136,     0,     0,    52,    53,
-   100,   101,   117,   119,   102,     0,     0,    52,    54,   141,
-   103,   100,   101,   118,   119,   102,     0,   120,     0,   119,
-   120,     0,   196,     0,   198,     0,   200,     0,   202,     0,
-   203,     0,   205,     0,   215,     0,   219,     0,   217,     0,
-   220,     0,   221,     0,   222,     0,   166,     0,   165,     0,
-   121,     0,    55,    99,     0,     0,     7,   101,   123,   124,
-   102,     0,   193,     0,   124,   193,     0,     0,     8,   101,
-   126,   127,   102,     0,   128,     0,   127,   128,     0,   157,
-     0,   158,     0,   152,     0,   163,     0,   148,     0,   150,
-     0,   194,     0,   195,     0,     0,    47,   101,   130,   131,
-   102,     0,   132,     0,   132,   131,     0,   156,     0,   154,
-     0,   158,     0,   157,     0,   160,     0,   161,     0,   194,
-     0,   195,     0,     0,    93,    99,   101,   134,   135,   102,
-     0,    93,    99,     0,   136,     0,   135,   136,     0,    94,
-    99,   104,    98,    25,    98,     0,    94,    99,   104,    98,
-     0,    94,    99,   104,    98,    25,    95,     0,    62,    65,
-     0,    62,    66,     0,    62,    67,     0,    62,    68,     0,
-    62,    69,     0,    62,    70,     0,    62,    71,     0,    62,
-    72,     0,    63,   141,     0,    64,   141,     0,    96,     0,
-    96,   103,   100,     0,    96,   103,    99,     0,   140,   105,
-    96,     0,   140,   105,    96,   103,   100,     0,   140,   105,
-    96,   103,    99,     0,    97,     0,    98,     0,    99,     0,
-   142,   105,    99,     0,   141,   103,   141,   103,   100,     0,
-   143,   105,   141,   103,   141,   103,   100,     0,    96,     0,
-   144,   105,    96,     0,    99,     0,    99,   103,    99,     0,
-    99,   104,    98,     0,   145,   105,    99,     0,   145,   105,
-    99,   103,    99,     0,    99,   104,    98,     0,    99,     0,
-    99,   103,    99,     0,   147,   105,    99,     0,   147,   105,
-    99,   103,    99,     0,   100,     0,   100,   103,   100,     0,
-   147,   105,   100,     0,   147,   105,   100,   103,   100,     0,
-     0,    32,   149,   147,     0,     0,    31,   151,   147,     0,
-     0,    33,   153,   145,     0,     0,    49,   155,   146,     0,
-    48,   141,     0,    37,   141,     0,    37,   141,   103,   141,
-     0,    38,   141,     0,    38,   141,   103,   141,     0,    34,
-   141,     0,    35,   141,     0,    35,   141,   103,   141,     0,
-    36,   141,     0,    36,   141,   103,   141,     0,    44,   141,
-     0,    43,   141,     0,    59,   141,     0,    14,    61,    96,
-     0,    14,   141,    53,   100,     0,    14,   141,    55,    99,
-     0,     0,    14,   141,    91,   167,   142,     0,    14,   141,
-    90,    96,     0,     0,    14,    60,   169,   142,     0,    42,
-   141,     0,    39,    99,     0,    41,   141,     0,    40,   141,
-     0,    10,   141,     0,    11,    96,     0,     9,    96,     0,
-    12,   141,     0,    13,    96,     0,    45,     0,    56,     0,
-    50,    96,     0,    57,     0,    58,     0,     6,    96,     0,
-    46,   141,     0,    73,     0,    73,   141,     0,    74,   141,
-     0,    75,   141,     0,    76,   141,     0,    77,   141,     0,
-     4,    96,     0,     4,   141,     0,     5,   141,     0,     5,
-   100,     0,     5,    96,     0,   157,     0,   158,     0,   152,
-     0,   159,     0,   160,     0,   161,     0,   148,     0,   150,
-     0,   163,     0,   164,     0,   194,     0,   195,     0,    87,
-    96,     0,    88,    96,     0,     0,    14,    15,   197,   142,
-     0,     0,    14,    16,   199,   144,     0,     0,    14,    17,
-   201,   142,     0,    14,    18,    96,     0,     0,    14,    19,
-   204,   142,     0,     0,    14,    20,   206,   144,     0,     0,
-    14,    26,   208,   140,     0,     0,    14,    26,    98,   209,
-   140,     0,     0,    14,    26,    98,    98,   210,   140,     0,
-    27,   141,    96,     0,    27,   141,     0,    28,    99,     0,
-    29,    96,     0,    30,   141,     0,     0,    14,    21,   216,
-   142,     0,     0,    14,    23,   218,   142,     0,    14,    22,
-    96,     0,    14,    24,    96,     0,    14,    25,   141,     0,
-     0,    14,    51,   223,   143,     0,     0,    78,    96,   101,
-   225,   226,   102,     0,    79,   227,     0,     0,   106,   228,
-    92,   228,   107,     0,   106,   228,    80,   228,   107,     0,
-   106,   227,    81,   227,   107,     0,   106,   227,    82,   227,
-   107,     0,    83,     0,    84,     0,    96,     0,   141,     0,
-    89,   106,   228,   105,   141,   105,   141,   107,     0
+static const short yyrhs[] = {   122,
+     0,     0,   123,     0,   125,     0,   122,   123,     0,   122,
+   125,     0,   124,     0,   188,     0,   187,     0,   189,     0,
+   190,     0,   191,     0,   192,     0,   199,     0,   200,     0,
+   201,     0,   202,     0,   203,     0,   204,     0,   205,     0,
+   150,     0,   151,     0,   152,     0,   197,     0,   198,     0,
+   232,     0,   233,     0,   234,     0,   193,     0,   244,     0,
+   194,     0,   195,     0,   213,     0,   211,     0,   212,     0,
+   206,     0,   207,     0,   208,     0,   209,     0,   210,     0,
+   184,     0,   186,     0,   185,     0,   183,     0,   175,     0,
+   216,     0,   218,     0,   220,     0,   222,     0,   223,     0,
+   225,     0,   227,     0,   231,     0,   235,     0,   239,     0,
+   237,     0,   240,     0,   178,     0,   241,     0,   179,     0,
+   181,     0,   142,     0,   242,     0,   129,     0,   196,     0,
+     0,     3,   109,   114,   126,   128,   115,     0,     0,     3,
+   154,   114,   127,   128,   115,     0,   124,     0,   128,   124,
+     0,   135,     0,   138,     0,   146,     0,   149,     0,   128,
+   138,     0,   128,   135,     0,   128,   146,     0,   128,   149,
+     0,     0,    65,    66,   113,   114,   130,   132,   115,     0,
+     0,    65,    67,   154,   116,   113,   114,   131,   132,   115,
+     0,   133,     0,   132,   133,     0,   216,     0,   218,     0,
+   220,     0,   222,     0,   223,     0,   225,     0,   235,     0,
+   239,     0,   237,     0,   240,     0,   241,     0,   242,     0,
+   179,     0,   178,     0,   134,     0,    68,   112,     0,     0,
+     7,   114,   136,   137,   115,     0,   213,     0,   137,   213,
+     0,     0,     8,   114,   139,   140,   115,     0,   141,     0,
+   140,   141,     0,   170,     0,   171,     0,   165,     0,   176,
+     0,   161,     0,   163,     0,   214,     0,   215,     0,     0,
+    56,   114,   143,   144,   115,     0,   145,     0,   145,   144,
+     0,   169,     0,   167,     0,   171,     0,   170,     0,   173,
+     0,   174,     0,   214,     0,   215,     0,     0,   106,   112,
+   114,   147,   148,   115,     0,   106,   112,     0,   149,     0,
+   148,   149,     0,   107,   112,   117,   111,    25,   111,     0,
+   107,   112,   117,   111,     0,   107,   112,   117,   111,    25,
+   108,     0,    75,    78,     0,    75,    79,     0,    75,    80,
+     0,    75,    81,     0,    75,    82,     0,    75,    83,     0,
+    75,    84,     0,    75,    85,     0,    76,   154,     0,    77,
+   154,     0,   109,     0,   109,   116,   113,     0,   109,   116,
+   112,     0,   153,   118,   109,     0,   153,   118,   109,   116,
+   113,     0,   153,   118,   109,   116,   112,     0,   110,     0,
+   111,     0,   112,     0,   155,   118,   112,     0,   154,   116,
+   154,   116,   113,     0,   156,   118,   154,   116,   154,   116,
+   113,     0,   109,     0,   157,   118,   109,     0,   112,     0,
+   112,   116,   112,     0,   112,   117,   111,     0,   158,   118,
+   112,     0,   158,   118,   112,   116,   112,     0,   112,   117,
+   111,     0,   112,     0,   112,   116,   112,     0,   160,   118,
+   112,     0,   160,   118,   112,   116,   112,     0,   113,     0,
+   113,   116,   113,     0,   160,   118,   113,     0,   160,   118,
+   113,   116,   113,     0,     0,    32,   162,   160,     0,     0,
+    31,   164,   160,     0,     0,    33,   166,   158,     0,     0,
+    58,   168,   159,     0,    57,   154,     0,    37,   154,     0,
+    37,   154,   116,   154,     0,    38,   154,     0,    38,   154,
+   116,   154,     0,    34,   154,     0,    35,   154,     0,    35,
+   154,   116,   154,     0,    36,   154,     0,    36,   154,   116,
+   154,     0,    44,   154,     0,    43,   154,     0,    72,   154,
+     0,    14,    74,   109,     0,    14,   154,    66,   113,     0,
+    14,   154,    68,   112,     0,     0,    14,   154,   104,   180,
+   155,     0,    14,   154,   103,   109,     0,     0,    14,    73,
+   182,   155,     0,    42,   154,     0,    39,   112,     0,    41,
+   154,     0,    40,   154,     0,    10,   154,     0,    11,   109,
+     0,     9,   109,     0,    12,   154,     0,    13,   109,     0,
+    45,     0,    69,     0,    59,   109,     0,    60,   154,     0,
+    61,   154,     0,    62,   154,     0,    63,   154,     0,    70,
+     0,    71,     0,     6,   109,     0,    46,   154,     0,    47,
+   154,     0,    48,   154,     0,    49,   154,     0,    50,   154,
+     0,    51,   154,     0,    52,   154,     0,    50,   154,   154,
+     0,    51,   154,   154,     0,    52,   154,   154,     0,    53,
+   154,     0,    54,   154,     0,    55,   112,   154,     0,    86,
+     0,    86,   154,     0,    87,   154,     0,    88,   154,     0,
+    89,   154,     0,    90,   154,     0,     4,   109,     0,     4,
+   154,     0,     5,   154,     0,     5,   113,     0,     5,   109,
+     0,   170,     0,   171,     0,   165,     0,   172,     0,   173,
+     0,   174,     0,   161,     0,   163,     0,   176,     0,   177,
+     0,   214,     0,   215,     0,   100,   109,     0,   101,   109,
+     0,     0,    14,    15,   217,   155,     0,     0,    14,    16,
+   219,   157,     0,     0,    14,    17,   221,   155,     0,    14,
+    18,   109,     0,     0,    14,    19,   224,   155,     0,     0,
+    14,    20,   226,   157,     0,     0,    14,    26,   228,   153,
+     0,     0,    14,    26,   111,   229,   153,     0,     0,    14,
+    26,   111,   111,   230,   153,     0,    27,   154,   109,     0,
+    27,   154,     0,    28,   112,     0,    29,   109,     0,    30,
+   154,     0,     0,    14,    21,   236,   155,     0,     0,    14,
+    23,   238,   155,     0,    14,    22,   109,     0,    14,    24,
+   109,     0,    14,    25,   154,     0,     0,    14,    64,   243,
+   156,     0,     0,    91,   109,   114,   245,   246,   115,     0,
+    92,   247,     0,     0,   119,   248,   105,   248,   120,     0,
+   119,   248,    93,   248,   120,     0,   119,   247,    94,   247,
+   120,     0,   119,   247,    95,   247,   120,     0,    96,     0,
+    97,     0,   109,     0,   154,     0,   102,   119,   248,   118,
+   154,   118,   154,   120,     0
 };
 
 #endif
 
 #if (YY_SrvParser_DEBUG != 0) || defined(YY_SrvParser_ERROR_VERBOSE) 
 static const short yyrline[] = { 0,
-   152,   153,   157,   158,   159,   160,   164,   165,   166,   167,
-   168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
-   178,   179,   180,   181,   182,   188,   189,   190,   191,   192,
-   193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
-   203,   204,   205,   206,   207,   208,   209,   210,   211,   212,
-   213,   214,   215,   216,   217,   218,   219,   220,   225,   230,
-   238,   243,   249,   250,   251,   252,   253,   254,   255,   256,
-   257,   258,   262,   268,   276,   282,   291,   292,   296,   297,
-   298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-   308,   309,   310,   313,   322,   327,   335,   336,   341,   344,
-   352,   353,   356,   357,   358,   359,   360,   361,   362,   363,
-   367,   370,   378,   379,   382,   383,   384,   385,   386,   387,
-   388,   389,   396,   403,   409,   418,   419,   422,   432,   441,
-   455,   456,   457,   458,   459,   460,   461,   462,   466,   470,
-   478,   483,   490,   497,   502,   509,   519,   520,   524,   528,
-   535,   542,   551,   552,   556,   560,   569,   585,   589,   601,
-   624,   628,   637,   641,   650,   655,   665,   670,   684,   688,
-   694,   698,   704,   708,   714,   717,   722,   729,   734,   742,
-   747,   755,   767,   772,   780,   785,   793,   800,   807,   820,
-   828,   834,   842,   846,   851,   859,   870,   879,   886,   893,
-   908,   920,   926,   931,   938,   944,   951,   958,   965,   972,
-   978,   985,  1006,  1017,  1022,  1038,  1049,  1055,  1061,  1070,
-  1074,  1081,  1086,  1091,  1099,  1100,  1101,  1102,  1103,  1104,
-  1105,  1106,  1107,  1108,  1109,  1110,  1114,  1143,  1176,  1180,
-  1189,  1192,  1201,  1205,  1214,  1224,  1227,  1236,  1239,  1249,
-  1257,  1260,  1268,  1272,  1280,  1287,  1292,  1300,  1308,  1325,
-  1335,  1338,  1347,  1350,  1359,  1369,  1379,  1386,  1388,  1395,
-  1398,  1408,  1414,  1414,  1422,  1431,  1440,  1451,  1455,  1459,
-  1464,  1473
+   155,   156,   160,   161,   162,   163,   167,   168,   169,   170,
+   171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
+   181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
+   191,   192,   198,   199,   200,   201,   202,   203,   204,   205,
+   206,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+   216,   217,   218,   219,   220,   221,   222,   223,   224,   225,
+   226,   227,   228,   229,   230,   235,   240,   248,   253,   259,
+   260,   261,   262,   263,   264,   265,   266,   267,   268,   272,
+   278,   286,   292,   301,   302,   306,   307,   308,   309,   310,
+   311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
+   323,   332,   337,   345,   346,   351,   354,   362,   363,   366,
+   367,   368,   369,   370,   371,   372,   373,   377,   380,   388,
+   389,   392,   393,   394,   395,   396,   397,   398,   399,   406,
+   413,   419,   428,   429,   432,   442,   451,   465,   466,   467,
+   468,   469,   470,   471,   472,   476,   480,   488,   493,   500,
+   507,   512,   519,   529,   530,   534,   538,   545,   552,   561,
+   562,   566,   570,   579,   595,   599,   611,   634,   638,   647,
+   651,   660,   665,   675,   680,   694,   698,   704,   708,   714,
+   718,   724,   727,   732,   739,   744,   752,   757,   765,   777,
+   782,   790,   795,   803,   810,   817,   830,   838,   844,   852,
+   856,   861,   869,   880,   889,   896,   903,   918,   930,   936,
+   941,   948,   954,   961,   968,   975,   981,   989,   997,  1005,
+  1016,  1022,  1029,  1050,  1057,  1064,  1071,  1087,  1088,  1089,
+  1091,  1092,  1093,  1097,  1109,  1114,  1125,  1130,  1146,  1157,
+  1163,  1169,  1178,  1182,  1189,  1194,  1199,  1207,  1208,  1209,
+  1210,  1211,  1212,  1213,  1214,  1215,  1216,  1217,  1218,  1222,
+  1251,  1284,  1288,  1297,  1300,  1309,  1313,  1322,  1332,  1335,
+  1344,  1347,  1357,  1365,  1368,  1376,  1380,  1388,  1395,  1400,
+  1408,  1416,  1433,  1443,  1446,  1455,  1458,  1467,  1477,  1487,
+  1494,  1496,  1503,  1506,  1516,  1522,  1522,  1530,  1539,  1548,
+  1559,  1563,  1567,  1572,  1581
 };
 
 static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","RELAY_",
@@ -1097,8 +1161,11 @@ static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","RELA
 "LIFETIME_","FQDN_","ACCEPT_UNKNOWN_FQDN_","FQDN_DDNS_ADDRESS_","DDNS_PROTOCOL_",
 "DDNS_TIMEOUT_","ACCEPT_ONLY_","REJECT_CLIENTS_","POOL_","SHARE_","T1_","T2_",
 "PREF_TIME_","VALID_TIME_","UNICAST_","PREFERENCE_","RAPID_COMMIT_","IFACE_MAX_LEASE_",
-"CLASS_MAX_LEASE_","CLNT_MAX_LEASE_","STATELESS_","CACHE_SIZE_","PDCLASS_","PD_LENGTH_",
-"PD_POOL_","SCRIPT_","VENDOR_SPEC_","CLIENT_","DUID_KEYWORD_","REMOTE_ID_","ADDRESS_",
+"CLASS_MAX_LEASE_","CLNT_MAX_LEASE_","STATELESS_","CACHE_SIZE_","DUMP_INTERVAL_",
+"OFFER_LIFETIME_","OFFER_LIMIT_","CLIENT_RATE_LIMIT_","LINK_RATE_LIMIT_","IFACE_RATE_LIMIT_",
+"SOLICIT_EARLY_DROP_","REPLICATION_PORT_","REPLICATION_PEER_","PDCLASS_","PD_LENGTH_",
+"PD_POOL_","SCRIPT_","SCRIPT_CONCURRENCY_","SCRIPT_QUEUE_SIZE_","SCRIPT_TIMEOUT_",
+"SCRIPT_BATCH_","VENDOR_SPEC_","CLIENT_","DUID_KEYWORD_","REMOTE_ID_","ADDRESS_",
 "GUESS_MODE_","INACTIVE_MODE_","EXPERIMENTAL_","ADDR_PARAMS_","REMOTE_AUTOCONF_NEIGHBORS_",
 "AFTR_","AUTH_METHOD_","AUTH_LIFETIME_","AUTH_KEY_LEN_","DIGEST_NONE_","DIGEST_PLAIN_",
 "DIGEST_HMAC_MD5_","DIGEST_HMAC_SHA1_","DIGEST_HMAC_SHA224_","DIGEST_HMAC_SHA256_",
@@ -1121,49 +1188,52 @@ static const char * const yytname[] = {   "$","error","$illegal.","IFACE_","RELA
 "AddrParams","DsLiteAftrName","ExtraOption","@13","RemoteAutoconfNeighborsOption",
 "@14","IfaceMaxLeaseOption","UnicastAddressOption","RapidCommitOption","PreferenceOption",
 "LogLevelOption","LogModeOption","LogNameOption","LogColors","WorkDirOption",
-"StatelessOption","GuessMode","ScriptName","InactiveMode","Experimental","IfaceIDOrder",
-"CacheSizeOption","AcceptLeaseQuery","BulkLeaseQueryAccept","BulkLeaseQueryTcpPort",
-"BulkLeaseQueryMaxConns","BulkLeaseQueryTimeout","RelayOption","InterfaceIDOption",
-"ClassOptionDeclaration","AllowClientClassDeclaration","DenyClientClassDeclaration",
-"DNSServerOption","@15","DomainOption","@16","NTPServerOption","@17","TimeZoneOption",
-"SIPServerOption","@18","SIPDomainOption","@19","FQDNOption","@20","@21","@22",
-"AcceptUnknownFQDN","FqdnDdnsAddress","DdnsProtocol","DdnsTimeout","NISServerOption",
-"@23","NISPServerOption","@24","NISDomainOption","NISPDomainOption","LifetimeOption",
-"VendorSpecOption","@25","ClientClass","@26","ClientClassDecleration","Condition",
-"Expr",""
+"StatelessOption","GuessMode","ScriptName","ScriptOption","InactiveMode","Experimental",
+"IfaceIDOrder","CacheSizeOption","DumpIntervalOption","OfferLifetimeOption",
+"OfferLimitOption","RateLimitOption","SolicitEarlyDrop","ReplicationOption",
+"AcceptLeaseQuery","BulkLeaseQueryAccept","BulkLeaseQueryTcpPort","BulkLeaseQueryMaxConns",
+"BulkLeaseQueryTimeout","RelayOption","InterfaceIDOption","ClassOptionDeclaration",
+"AllowClientClassDeclaration","DenyClientClassDeclaration","DNSServerOption",
+"@15","DomainOption","@16","NTPServerOption","@17","TimeZoneOption","SIPServerOption",
+"@18","SIPDomainOption","@19","FQDNOption","@20","@21","@22","AcceptUnknownFQDN",
+"FqdnDdnsAddress","DdnsProtocol","DdnsTimeout","NISServerOption","@23","NISPServerOption",
+"@24","NISDomainOption","NISPDomainOption","LifetimeOption","VendorSpecOption",
+"@25","ClientClass","@26","ClientClassDecleration","Condition","Expr",""
 };
 #endif
 
 static const short yyr1[] = {     0,
-   108,   108,   109,   109,   109,   109,   110,   110,   110,   110,
-   110,   110,   110,   110,   110,   110,   110,   110,   110,   110,
-   110,   110,   110,   110,   110,   111,   111,   111,   111,   111,
-   111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
-   111,   111,   111,   111,   111,   111,   111,   111,   111,   111,
-   111,   111,   111,   111,   111,   111,   111,   111,   113,   112,
-   114,   112,   115,   115,   115,   115,   115,   115,   115,   115,
-   115,   115,   117,   116,   118,   116,   119,   119,   120,   120,
-   120,   120,   120,   120,   120,   120,   120,   120,   120,   120,
-   120,   120,   120,   121,   123,   122,   124,   124,   126,   125,
-   127,   127,   128,   128,   128,   128,   128,   128,   128,   128,
-   130,   129,   131,   131,   132,   132,   132,   132,   132,   132,
-   132,   132,   134,   133,   133,   135,   135,   136,   136,   136,
-   137,   137,   137,   137,   137,   137,   137,   137,   138,   139,
-   140,   140,   140,   140,   140,   140,   141,   141,   142,   142,
-   143,   143,   144,   144,   145,   145,   145,   145,   145,   146,
-   147,   147,   147,   147,   147,   147,   147,   147,   149,   148,
-   151,   150,   153,   152,   155,   154,   156,   157,   157,   158,
-   158,   159,   160,   160,   161,   161,   162,   163,   164,   165,
-   166,   166,   167,   166,   166,   169,   168,   170,   171,   172,
-   173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
-   183,   184,   185,   186,   186,   187,   188,   189,   190,   191,
-   191,   192,   192,   192,   193,   193,   193,   193,   193,   193,
-   193,   193,   193,   193,   193,   193,   194,   195,   197,   196,
-   199,   198,   201,   200,   202,   204,   203,   206,   205,   208,
-   207,   209,   207,   210,   207,   211,   211,   212,   213,   214,
-   216,   215,   218,   217,   219,   220,   221,   223,   222,   225,
-   224,   226,   227,   227,   227,   227,   227,   228,   228,   228,
-   228,   228
+   121,   121,   122,   122,   122,   122,   123,   123,   123,   123,
+   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+   123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
+   123,   123,   124,   124,   124,   124,   124,   124,   124,   124,
+   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+   124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+   124,   124,   124,   124,   124,   126,   125,   127,   125,   128,
+   128,   128,   128,   128,   128,   128,   128,   128,   128,   130,
+   129,   131,   129,   132,   132,   133,   133,   133,   133,   133,
+   133,   133,   133,   133,   133,   133,   133,   133,   133,   133,
+   134,   136,   135,   137,   137,   139,   138,   140,   140,   141,
+   141,   141,   141,   141,   141,   141,   141,   143,   142,   144,
+   144,   145,   145,   145,   145,   145,   145,   145,   145,   147,
+   146,   146,   148,   148,   149,   149,   149,   150,   150,   150,
+   150,   150,   150,   150,   150,   151,   152,   153,   153,   153,
+   153,   153,   153,   154,   154,   155,   155,   156,   156,   157,
+   157,   158,   158,   158,   158,   158,   159,   160,   160,   160,
+   160,   160,   160,   160,   160,   162,   161,   164,   163,   166,
+   165,   168,   167,   169,   170,   170,   171,   171,   172,   173,
+   173,   174,   174,   175,   176,   177,   178,   179,   179,   180,
+   179,   179,   182,   181,   183,   184,   185,   186,   187,   188,
+   189,   190,   191,   192,   193,   194,   195,   195,   195,   195,
+   196,   197,   198,   199,   200,   201,   202,   203,   203,   203,
+   203,   203,   203,   204,   205,   205,   206,   206,   207,   208,
+   209,   210,   211,   211,   212,   212,   212,   213,   213,   213,
+   213,   213,   213,   213,   213,   213,   213,   213,   213,   214,
+   215,   217,   216,   219,   218,   221,   220,   222,   224,   223,
+   226,   225,   228,   227,   229,   227,   230,   227,   231,   231,
+   232,   233,   234,   236,   235,   238,   237,   239,   240,   241,
+   243,   242,   245,   244,   246,   247,   247,   247,   247,   247,
+   248,   248,   248,   248,   248
 };
 
 static const short yyr2[] = {     0,
@@ -1172,282 +1242,308 @@ static const short yyr2[] = {     0,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     0,     6,
-     0,     6,     1,     2,     1,     1,     1,     1,     2,     2,
-     2,     2,     0,     7,     0,     9,     1,     2,     1,     1,
      1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     2,     0,     5,     1,     2,     0,     5,
-     1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
-     0,     5,     1,     2,     1,     1,     1,     1,     1,     1,
-     1,     1,     0,     6,     2,     1,     2,     6,     4,     6,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     1,     3,     3,     3,     5,     5,     1,     1,     1,     3,
-     5,     7,     1,     3,     1,     3,     3,     3,     5,     3,
-     1,     3,     3,     5,     1,     3,     3,     5,     0,     3,
-     0,     3,     0,     3,     0,     3,     2,     2,     4,     2,
-     4,     2,     2,     4,     2,     4,     2,     2,     2,     3,
-     4,     4,     0,     5,     4,     0,     4,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     1,     1,     2,     1,
-     1,     2,     2,     1,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     2,     2,     0,     4,
-     0,     4,     0,     4,     3,     0,     4,     0,     4,     0,
-     4,     0,     5,     0,     6,     3,     2,     2,     2,     2,
-     0,     4,     0,     4,     3,     3,     3,     0,     4,     0,
-     6,     2,     0,     5,     5,     5,     5,     1,     1,     1,
-     1,     8
+     1,     1,     1,     1,     1,     0,     6,     0,     6,     1,
+     2,     1,     1,     1,     1,     2,     2,     2,     2,     0,
+     7,     0,     9,     1,     2,     1,     1,     1,     1,     1,
+     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+     2,     0,     5,     1,     2,     0,     5,     1,     2,     1,
+     1,     1,     1,     1,     1,     1,     1,     0,     5,     1,
+     2,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+     6,     2,     1,     2,     6,     4,     6,     2,     2,     2,
+     2,     2,     2,     2,     2,     2,     2,     1,     3,     3,
+     3,     5,     5,     1,     1,     1,     3,     5,     7,     1,
+     3,     1,     3,     3,     3,     5,     3,     1,     3,     3,
+     5,     1,     3,     3,     5,     0,     3,     0,     3,     0,
+     3,     0,     3,     2,     2,     4,     2,     4,     2,     2,
+     4,     2,     4,     2,     2,     2,     3,     4,     4,     0,
+     5,     4,     0,     4,     2,     2,     2,     2,     2,     2,
+     2,     2,     2,     1,     1,     2,     2,     2,     2,     2,
+     1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
+     3,     3,     3,     2,     2,     3,     1,     2,     2,     2,
+     2,     2,     2,     2,     2,     2,     2,     1,     1,     1,
+     1,     1,     1,     1,     1,     1,     1,     1,     1,     2,
+     2,     0,     4,     0,     4,     0,     4,     3,     0,     4,
+     0,     4,     0,     4,     0,     5,     0,     6,     3,     2,
+     2,     2,     2,     0,     4,     0,     4,     3,     3,     3,
+     0,     4,     0,     6,     2,     0,     5,     5,     5,     5,
+     1,     1,     1,     1,     8
 };
 
 static const short yydefact[] = {     2,
      0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,   171,   169,   173,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,   207,     0,
-     0,     0,     0,   208,   210,   211,     0,     0,     0,     0,
-   214,     0,     0,     0,     0,     0,     0,     0,     1,     3,
-     7,     4,    57,    55,    15,    16,    17,   231,   232,   227,
-   225,   226,   228,   229,   230,    38,   233,   234,    51,    53,
-    54,    37,    34,    36,    35,     9,     8,    10,    11,    12,
-    13,    23,    25,    58,    18,    19,    14,    29,    30,    31,
-    32,    33,    27,    28,    26,   235,   236,    39,    40,    41,
-    42,    43,    44,    45,    46,    20,    21,    22,    47,    49,
-    48,    50,    52,    56,    24,     0,   147,   148,     0,   220,
-   221,   224,   223,   222,   212,   204,   202,   203,   205,   206,
-   239,   241,   243,     0,   246,   248,   261,     0,   263,     0,
-     0,   250,   268,   196,     0,     0,   257,   258,   259,   260,
-     0,     0,     0,   182,   183,   185,   178,   180,   199,   201,
-   200,   198,   188,   187,   213,   111,   209,     0,     0,   189,
-   131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
-   215,   216,   217,   218,   219,     0,   237,   238,     5,     6,
-    59,    61,     0,     0,     0,   245,     0,     0,     0,   265,
-     0,   266,   267,   252,     0,     0,     0,   190,     0,     0,
-     0,   193,   256,   161,   165,   172,   170,   155,   174,     0,
-     0,     0,     0,     0,     0,     0,   270,     0,     0,   149,
-   240,   153,   242,   244,   247,   249,   262,   264,   254,     0,
-   141,   251,     0,   269,   197,   191,   192,   195,     0,     0,
-     0,     0,     0,     0,     0,   184,   186,   179,   181,     0,
-   175,     0,   113,   116,   115,   118,   117,   119,   120,   121,
-   122,    73,     0,     0,     0,     0,     0,     0,    63,     0,
-    65,    66,    67,    68,     0,     0,     0,     0,   253,     0,
-     0,     0,     0,   194,   162,   166,   163,   167,   156,   157,
-   158,   177,     0,   112,   114,     0,     0,   273,     0,    95,
-    99,   125,     0,    60,    64,    70,    69,    71,    72,    62,
-   150,   154,   255,   143,   142,   144,     0,     0,     0,     0,
-     0,     0,   176,     0,     0,     0,    77,    93,    92,    91,
-    79,    80,    81,    82,    83,    84,    85,    87,    86,    88,
-    89,    90,    75,   273,   272,   271,     0,     0,   123,     0,
-     0,     0,     0,   164,   168,   159,     0,    94,    74,    78,
-     0,   278,   279,     0,   280,   281,     0,     0,     0,    97,
-     0,   101,   107,   108,   105,   103,   104,   106,   109,   110,
-     0,   129,   146,   145,   151,     0,   160,     0,     0,   273,
-   273,     0,     0,    96,    98,   100,   102,     0,   126,     0,
-     0,    76,     0,     0,     0,     0,     0,   124,   127,   130,
-   128,   152,     0,   276,   277,   275,   274,     0,     0,     0,
-   282,     0,     0,     0
+     0,     0,     0,     0,   178,   176,   180,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,   214,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,   215,   221,   222,     0,
+     0,     0,     0,   237,     0,     0,     0,     0,     0,     0,
+     0,     1,     3,     7,     4,    64,    62,    21,    22,    23,
+   254,   255,   250,   248,   249,   251,   252,   253,    45,   256,
+   257,    58,    60,    61,    44,    41,    43,    42,     9,     8,
+    10,    11,    12,    13,    29,    31,    32,    65,    24,    25,
+    14,    15,    16,    17,    18,    19,    20,    36,    37,    38,
+    39,    40,    34,    35,    33,   258,   259,    46,    47,    48,
+    49,    50,    51,    52,    53,    26,    27,    28,    54,    56,
+    55,    57,    59,    63,    30,     0,   154,   155,     0,   243,
+   244,   247,   246,   245,   223,   211,   209,   210,   212,   213,
+   262,   264,   266,     0,   269,   271,   284,     0,   286,     0,
+     0,   273,   291,   203,     0,     0,   280,   281,   282,   283,
+     0,     0,     0,   189,   190,   192,   185,   187,   206,   208,
+   207,   205,   195,   194,   224,   225,   226,   227,   228,   229,
+   230,   234,   235,     0,   118,   216,   217,   218,   219,   220,
+     0,     0,   196,   138,   139,   140,   141,   142,   143,   144,
+   145,   146,   147,   238,   239,   240,   241,   242,     0,   260,
+   261,     5,     6,    66,    68,     0,     0,     0,   268,     0,
+     0,     0,   288,     0,   289,   290,   275,     0,     0,     0,
+   197,     0,     0,     0,   200,   279,   168,   172,   179,   177,
+   162,   181,     0,     0,     0,     0,   231,   232,   233,   236,
+     0,     0,     0,   293,     0,     0,   156,   263,   160,   265,
+   267,   270,   272,   285,   287,   277,     0,   148,   274,     0,
+   292,   204,   198,   199,   202,     0,     0,     0,     0,     0,
+     0,     0,   191,   193,   186,   188,     0,   182,     0,   120,
+   123,   122,   125,   124,   126,   127,   128,   129,    80,     0,
+     0,     0,     0,     0,     0,    70,     0,    72,    73,    74,
+    75,     0,     0,     0,     0,   276,     0,     0,     0,     0,
+   201,   169,   173,   170,   174,   163,   164,   165,   184,     0,
+   119,   121,     0,     0,   296,     0,   102,   106,   132,     0,
+    67,    71,    77,    76,    78,    79,    69,   157,   161,   278,
+   150,   149,   151,     0,     0,     0,     0,     0,     0,   183,
+     0,     0,     0,    84,   100,    99,    98,    86,    87,    88,
+    89,    90,    91,    92,    94,    93,    95,    96,    97,    82,
+   296,   295,   294,     0,     0,   130,     0,     0,     0,     0,
+   171,   175,   166,     0,   101,    81,    85,     0,   301,   302,
+     0,   303,   304,     0,     0,     0,   104,     0,   108,   114,
+   115,   112,   110,   111,   113,   116,   117,     0,   136,   153,
+   152,   158,     0,   167,     0,     0,   296,   296,     0,     0,
+   103,   105,   107,   109,     0,   133,     0,     0,    83,     0,
+     0,     0,     0,     0,   131,   134,   137,   135,   159,     0,
+   299,   300,   298,   297,     0,     0,     0,   305,     0,     0,
+     0
 };
 
-static const short yydefgoto[] = {   432,
-    49,    50,    51,    52,   228,   229,   280,    53,   306,   371,
-   336,   337,   338,   281,   357,   379,   282,   358,   381,   382,
-    54,   224,   262,   263,   283,   391,   408,   284,    55,    56,
-    57,   242,   376,   231,   244,   233,   219,   333,   216,    58,
-   152,    59,   151,    60,   153,   264,   303,   265,    61,    62,
-    63,    64,    65,    66,    67,    68,    69,    70,   249,    71,
-   207,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-    81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
-    91,    92,    93,    94,    95,    96,    97,    98,   193,    99,
-   194,   100,   195,   101,   102,   197,   103,   198,   104,   205,
-   240,   288,   105,   106,   107,   108,   109,   199,   110,   201,
-   111,   112,   113,   114,   206,   115,   274,   309,   355,   378
+static const short yydefgoto[] = {   469,
+    62,    63,    64,    65,   265,   266,   317,    66,   343,   408,
+   373,   374,   375,   318,   394,   416,   319,   395,   418,   419,
+    67,   261,   299,   300,   320,   428,   445,   321,    68,    69,
+    70,   279,   413,   268,   281,   270,   252,   370,   249,    71,
+   172,    72,   171,    73,   173,   301,   340,   302,    74,    75,
+    76,    77,    78,    79,    80,    81,    82,    83,   286,    84,
+   240,    85,    86,    87,    88,    89,    90,    91,    92,    93,
+    94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+   104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+   114,   115,   116,   117,   118,   226,   119,   227,   120,   228,
+   121,   122,   230,   123,   231,   124,   238,   277,   325,   125,
+   126,   127,   128,   129,   232,   130,   234,   131,   132,   133,
+   134,   239,   135,   311,   346,   392,   415
 };
 
-static const short yypact[] = {   373,
-    25,    63,   103,   -93,   -63,   114,   -50,   114,   -48,   447,
-   114,   -22,   -15,   114,-32768,-32768,-32768,   114,   114,   114,
-   114,   114,    32,   114,   114,   114,   114,   114,-32768,   114,
-    36,    37,    62,-32768,-32768,-32768,   114,   323,   114,   114,
-   114,   114,   114,   114,   114,    99,   122,   137,   373,-32768,
+static const short yypact[] = {   479,
+   130,   180,   224,  -105,   -81,    25,   -63,    25,   -23,    56,
+    25,    34,     3,    25,-32768,-32768,-32768,    25,    25,    25,
+    25,    25,    38,    25,    25,    25,    25,    25,-32768,    25,
+    25,    25,    25,    25,    25,    25,    25,    25,    41,    19,
+    64,    25,    25,    25,    25,   131,-32768,-32768,-32768,    25,
+   350,    25,    25,    25,    25,    25,    25,    25,    69,    71,
+    74,   479,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   135,-32768,-32768,   144,-32768,
+-32768,-32768,-32768,-32768,-32768,    73,-32768,-32768,    78,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,   155,-32768,-32768,-32768,   171,-32768,   177,
-   114,   176,-32768,-32768,   180,   179,   181,-32768,-32768,-32768,
-   130,   130,   154,-32768,   175,   182,   185,   186,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,   194,   114,-32768,
+-32768,-32768,-32768,    93,-32768,-32768,-32768,    96,-32768,   113,
+    25,   121,-32768,-32768,   125,   182,   128,-32768,-32768,-32768,
+   112,   112,   160,-32768,   163,   171,   179,   197,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    25,    25,
+    25,-32768,-32768,    25,-32768,-32768,-32768,-32768,-32768,-32768,
+   133,    25,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   201,-32768,
+-32768,-32768,-32768,-32768,-32768,   212,   216,   212,-32768,   212,
+   216,   212,-32768,   212,-32768,-32768,   215,   218,    25,   212,
+-32768,   217,   220,   233,-32768,-32768,   229,   230,   231,   231,
+   111,   247,    25,    25,    25,    25,-32768,-32768,-32768,-32768,
+   282,   234,   235,-32768,   380,   380,-32768,   250,-32768,   253,
+   250,   250,   253,   250,   250,-32768,   218,   259,   260,   261,
+   262,   250,-32768,-32768,-32768,   212,   274,   277,   144,   280,
+   285,   288,-32768,-32768,-32768,-32768,    25,-32768,   287,   282,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   284,
+   312,   291,   294,   297,   298,-32768,   177,-32768,-32768,-32768,
+-32768,   266,   313,   328,   218,   260,   148,   329,    25,    25,
+   250,-32768,-32768,   323,   324,-32768,-32768,   327,-32768,   330,
+-32768,-32768,     1,   332,   325,   336,-32768,-32768,   339,   338,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   260,
+-32768,-32768,   340,   341,   342,   348,   351,   360,   356,-32768,
+    84,   362,    -2,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,   178,-32768,-32768,-32768,-32768,
--32768,-32768,   197,   184,   197,-32768,   197,   184,   197,-32768,
-   197,-32768,-32768,   200,   204,   114,   197,-32768,   203,   225,
-   229,-32768,-32768,   224,   227,   230,   230,   110,   232,   114,
-   114,   114,   114,   309,   231,   236,-32768,   279,   279,-32768,
-   235,-32768,   243,   235,   235,   243,   235,   235,-32768,   204,
-   247,   254,   257,   256,   235,-32768,-32768,-32768,   197,   264,
-   265,   157,   269,   266,   270,-32768,-32768,-32768,-32768,   114,
--32768,   268,   309,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,   271,   295,   274,   280,   281,   299,-32768,    51,
--32768,-32768,-32768,-32768,   150,   300,   325,   204,   254,   162,
-   328,   114,   114,   235,-32768,-32768,   324,   330,-32768,-32768,
-   331,-32768,   327,-32768,-32768,     8,   337,   335,   340,-32768,
--32768,   342,   351,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,   254,-32768,-32768,   341,   353,   354,   359,   385,
-   360,   382,-32768,   459,   388,     2,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,   245,-32768,-32768,   493,   217,-32768,   390,
-   165,   389,   114,-32768,-32768,-32768,   392,-32768,-32768,-32768,
-     8,-32768,-32768,   386,-32768,-32768,   190,   -16,   480,-32768,
-   462,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
-   397,   471,-32768,-32768,-32768,   394,-32768,    17,   356,   335,
-   335,   356,   356,-32768,-32768,-32768,-32768,    18,-32768,    72,
-   401,-32768,   398,   395,   399,   402,   412,-32768,-32768,-32768,
--32768,-32768,   114,-32768,-32768,-32768,-32768,   416,   114,   415,
--32768,   504,   532,-32768
+   352,-32768,-32768,   553,   106,-32768,   364,   156,   363,    25,
+-32768,-32768,-32768,   366,-32768,-32768,-32768,     1,-32768,-32768,
+   359,-32768,-32768,   181,    21,   326,-32768,   540,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,   372,   469,-32768,
+-32768,-32768,   379,-32768,     0,   134,   325,   325,   134,   134,
+-32768,-32768,-32768,-32768,    40,-32768,     8,   383,-32768,   381,
+   377,   378,   382,   384,-32768,-32768,-32768,-32768,-32768,    25,
+-32768,-32768,-32768,-32768,   385,    25,   416,-32768,   500,   501,
+-32768
 };
 
 static const short yypgoto[] = {-32768,
--32768,   484,  -167,   485,-32768,-32768,   306,-32768,-32768,-32768,
-   166,  -301,-32768,  -174,-32768,-32768,  -133,-32768,-32768,   159,
--32768,-32768,   275,-32768,  -129,-32768,-32768,  -274,-32768,-32768,
--32768,  -208,    -1,   100,-32768,   343,-32768,-32768,   391,  -313,
--32768,  -308,-32768,  -251,-32768,-32768,-32768,-32768,  -216,  -212,
--32768,  -164,  -158,-32768,  -249,-32768,  -302,  -269,-32768,-32768,
+-32768,   443,  -226,   475,-32768,-32768,   279,-32768,-32768,-32768,
+   135,  -370,-32768,  -194,-32768,-32768,  -160,-32768,-32768,   129,
+-32768,-32768,   246,-32768,  -145,-32768,-32768,  -259,-32768,-32768,
+-32768,  -261,    -1,   161,-32768,   321,-32768,-32768,   386,  -325,
+-32768,  -301,-32768,  -300,-32768,-32768,-32768,-32768,  -255,  -253,
+-32768,  -213,  -178,-32768,  -297,-32768,  -284,  -283,-32768,-32768,
+-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
 -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,  -327,  -210,  -209,  -257,-32768,  -236,
--32768,  -235,-32768,  -163,  -156,-32768,  -140,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,  -132,-32768,  -130,-32768,
-  -108,   -96,   -90,   -89,-32768,-32768,-32768,-32768,  -326,  -224
+-32768,  -306,  -250,  -239,  -281,-32768,  -276,-32768,  -232,-32768,
+  -212,  -209,-32768,  -173,-32768,-32768,-32768,-32768,-32768,-32768,
+-32768,-32768,-32768,  -114,-32768,   -92,-32768,   -85,   -61,   -32,
+   -29,-32768,-32768,-32768,-32768,  -353,  -265
 };
 
 
-#define	YYLAST		582
-
-
-static const short yytable[] = {   119,
-   121,   124,   125,   339,   127,   319,   129,   266,   146,   147,
-   319,   267,   150,   270,   271,   334,   154,   155,   156,   157,
-   158,   334,   160,   161,   162,   163,   164,   377,   165,   380,
-   334,   289,   126,   339,   370,   170,   340,   179,   180,   181,
-   182,   183,   184,   185,   383,   128,   266,   130,   341,   384,
-   267,   405,   270,   271,     2,     3,   335,   275,   276,   268,
-   279,   279,   335,   402,    10,   269,   340,   383,   339,   342,
-   343,   335,   384,   414,   415,   403,   148,    11,   341,   323,
-   149,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-    24,    25,    26,    27,    28,   339,   370,    31,   268,   342,
-   343,   340,    33,   369,   269,   316,   385,    35,   388,    37,
-   316,   278,   315,   341,   168,   169,   409,   315,   412,   418,
-   116,   117,   118,    41,    42,    43,    44,    45,   340,   385,
-   159,   388,   167,   419,   342,   343,   166,    47,    48,   203,
-   341,   386,   344,   277,   278,   387,   317,   389,   390,   345,
-   318,   317,   314,     2,     3,   318,   275,   276,   120,   117,
-   118,   342,   343,    10,   386,   346,   420,   226,   387,   421,
-   389,   390,   344,   347,   413,   348,    11,   416,   417,   345,
+#define	YYLAST		655
+
+
+static const short yytable[] = {   139,
+   141,   144,   407,   145,   147,   303,   149,   304,   166,   167,
+   307,   371,   170,   371,   371,   326,   174,   175,   176,   177,
+   178,   308,   180,   181,   182,   183,   184,   146,   185,   186,
+   187,   188,   189,   190,   191,   192,   193,   414,   316,   316,
+   197,   198,   199,   200,   303,   148,   304,   305,   203,   307,
+   212,   213,   214,   215,   216,   217,   218,   356,   376,   377,
+   308,   378,   356,   360,   407,   372,   379,   372,   372,   420,
+   151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
+   161,   162,   306,   451,   452,   150,   305,   417,   376,   377,
+   352,   378,   420,   421,   422,   352,   379,   425,   151,   152,
+   153,   154,   155,   156,   157,   158,   159,   160,   161,   442,
+   380,   169,   406,   439,   449,   457,   421,   422,   458,   163,
+   425,   306,   353,   376,   377,   440,   378,   353,   164,   165,
+   381,   379,   195,   382,   137,   138,    15,    16,    17,   423,
+   380,   424,    21,    22,   426,   168,   315,   163,    27,   179,
+   376,   377,   194,   378,   455,   427,   354,   165,   379,   236,
+   381,   354,   423,   382,   424,   137,   138,   426,   446,   383,
+   450,   355,   196,   453,   454,   380,   355,   219,   427,   220,
+     2,     3,   221,   312,   313,   456,   224,   257,   258,   259,
+    10,   225,   260,   137,   138,   381,   201,   202,   382,   383,
+   263,   229,   380,    11,   233,    60,    61,    15,    16,    17,
+    18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+    28,   235,   381,   247,   248,   382,   290,   291,   384,   409,
+   410,   237,    40,   241,   383,   411,   246,   280,   136,   137,
+   138,    46,   412,   137,   138,   262,    48,   242,    50,   243,
+   385,   293,   294,   295,   296,   334,   335,   386,   384,   361,
+   362,   383,    54,    55,    56,    57,    58,   430,   431,     2,
+     3,   251,   312,   313,   437,   438,    60,    61,   253,    10,
+   385,   387,   314,   315,   244,   245,   254,   386,   140,   137,
+   138,   351,    11,   384,   255,   339,    15,    16,    17,    18,
+    19,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+   388,   387,   256,   389,   264,   385,    19,    20,    21,    22,
+   384,    40,   386,   267,   269,   276,   278,   364,   365,   283,
+    46,   284,   142,   137,   138,    48,   143,    50,   297,   298,
+   388,   285,   385,   389,   287,   288,   387,   309,   289,   386,
+   310,    54,    55,    56,    57,    58,    15,    16,    17,    18,
+    19,    20,    21,    22,   292,    60,    61,   323,    27,   166,
+   324,   314,   315,   387,   327,   388,   329,   328,   389,   330,
+   357,    60,    61,     2,     3,   332,   312,   313,   271,   333,
+   272,   336,   274,    10,   275,   337,   344,    50,   433,   338,
+   282,   341,   388,   345,   347,   389,    11,   348,   349,   350,
     15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-    25,    26,    27,    28,   186,   346,    31,   349,   122,   117,
-   118,    33,   123,   347,   243,   348,    35,   344,    37,   350,
-   117,   118,   253,   254,   345,   351,   352,   187,   256,   257,
-   258,   259,    41,    42,    43,    44,    45,   349,   214,   215,
-   346,   209,   188,   210,   344,   191,    47,    48,   347,   350,
-   348,   345,   277,   278,   192,   351,   352,    15,    16,    17,
-   196,   320,   218,    21,    22,   297,   298,   346,   302,    27,
-   324,   325,   349,   393,   394,   347,   200,   348,   211,   212,
-   400,   401,   202,   204,   350,   208,   213,   220,   227,   232,
-   351,   352,     2,     3,   221,   275,   276,   222,   223,   349,
-   327,   328,    10,   225,   234,   230,   235,   239,   237,   241,
-   238,   350,   246,    47,    48,    11,   245,   351,   352,    15,
+    25,    26,    27,    28,   358,    60,    61,   204,   205,   206,
+   207,   208,   209,   210,   211,    40,   359,   363,   366,   367,
+   441,   369,   368,   391,    46,   390,   331,   409,   410,    48,
+   393,    50,   396,   411,   397,   398,   399,   400,   465,   401,
+   412,   137,   138,   402,   467,    54,    55,    56,    57,    58,
+   391,   403,   404,   405,   429,   432,   434,   436,   315,    60,
+    61,     1,     2,     3,     4,   314,   315,     5,     6,     7,
+     8,     9,    10,   447,   448,   459,   461,   462,   460,   470,
+   471,   463,   466,   464,   222,    11,    12,    13,    14,    15,
     16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-    26,    27,    28,   247,   248,    31,   250,   372,   373,   251,
-    33,   272,   146,   374,   252,    35,   255,    37,   273,   286,
-   375,   117,   118,    19,    20,    21,    22,   287,   294,   290,
-   354,    41,    42,    43,    44,    45,   260,   261,   291,   292,
-   293,   396,   295,   300,   296,    47,    48,   299,   301,   304,
-   307,   277,   278,   308,   310,     1,     2,     3,     4,   312,
-   311,     5,     6,     7,     8,     9,    10,   171,   172,   173,
-   174,   175,   176,   177,   178,    47,    48,   313,   321,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-   322,   428,    32,   326,    33,   332,   329,   430,    34,    35,
-    36,    37,   330,   331,    38,    39,    40,   353,   372,   373,
-   354,   356,   359,   361,   374,    41,    42,    43,    44,    45,
-    46,   375,   117,   118,   360,   362,   363,   364,   366,    47,
-    48,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-   140,   141,   142,   131,   132,   133,   134,   135,   136,   137,
-   138,   139,   140,   141,   365,   367,   368,   392,   395,   397,
-   278,   399,    15,    16,    17,   410,   411,   143,    21,    22,
-   422,   424,   423,   433,    27,   425,   144,   145,   426,   143,
-    15,    16,    17,    18,    19,    20,    21,    22,   427,   145,
-   429,   431,    27,    15,    16,    17,    18,    19,    20,    21,
-    22,   434,   189,   190,   285,    27,   398,   305,    37,   407,
-   236,     0,   217,   117,   118,     0,     0,     0,    47,    48,
-     0,    37,     0,     0,     0,   117,   118,     0,     0,     0,
-     0,     0,     0,   406,     0,     0,    47,    48,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,    47,
-    48,   404
+    26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+    36,    37,    38,    39,    40,   468,   223,    41,    42,    43,
+    44,    45,   435,    46,   322,   342,   444,    47,    48,    49,
+    50,   273,     0,    51,    52,    53,     0,   250,     0,     0,
+     0,     0,     0,     0,    54,    55,    56,    57,    58,    59,
+    15,    16,    17,     0,     0,     0,    21,    22,    60,    61,
+     0,     0,    27,    15,    16,    17,    18,    19,    20,    21,
+    22,     0,     0,     0,     0,    27,     0,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,     0,     0,    50,     0,     0,     0,     0,     0,
+     0,     0,     0,     0,     0,     0,     0,     0,     0,    60,
+    61,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     0,     0,    60,    61,   443
 };
 
 static const short yycheck[] = {     1,
-     2,     3,    96,   306,     6,   280,     8,   224,    10,    11,
-   285,   224,    14,   224,   224,    14,    18,    19,    20,    21,
-    22,    14,    24,    25,    26,    27,    28,   354,    30,   357,
-    14,   240,    96,   336,   336,    37,   306,    39,    40,    41,
-    42,    43,    44,    45,   358,    96,   263,    96,   306,   358,
-   263,   379,   263,   263,     4,     5,    55,     7,     8,   224,
-   228,   229,    55,    80,    14,   224,   336,   381,   371,   306,
-   306,    55,   381,   400,   401,    92,    99,    27,   336,   288,
-    96,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-    40,    41,    42,    43,    44,   398,   398,    47,   263,   336,
-   336,   371,    52,   102,   263,   280,   358,    57,   358,    59,
-   285,    94,   280,   371,    53,    54,   391,   285,   102,   102,
-    96,    97,    98,    73,    74,    75,    76,    77,   398,   381,
-    99,   381,    96,   408,   371,   371,   101,    87,    88,   141,
-   398,   358,   306,    93,    94,   358,   280,   358,   358,   306,
-   280,   285,   102,     4,     5,   285,     7,     8,    96,    97,
-    98,   398,   398,    14,   381,   306,    95,   169,   381,    98,
-   381,   381,   336,   306,   399,   306,    27,   402,   403,   336,
+     2,     3,   373,   109,     6,   261,     8,   261,    10,    11,
+   261,    14,    14,    14,    14,   277,    18,    19,    20,    21,
+    22,   261,    24,    25,    26,    27,    28,   109,    30,    31,
+    32,    33,    34,    35,    36,    37,    38,   391,   265,   266,
+    42,    43,    44,    45,   300,   109,   300,   261,    50,   300,
+    52,    53,    54,    55,    56,    57,    58,   317,   343,   343,
+   300,   343,   322,   325,   435,    68,   343,    68,    68,   395,
+    15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+    25,    26,   261,   437,   438,   109,   300,   394,   373,   373,
+   317,   373,   418,   395,   395,   322,   373,   395,    15,    16,
+    17,    18,    19,    20,    21,    22,    23,    24,    25,   416,
+   343,   109,   115,    93,   115,   108,   418,   418,   111,    64,
+   418,   300,   317,   408,   408,   105,   408,   322,    73,    74,
+   343,   408,   114,   343,   110,   111,    31,    32,    33,   395,
+   373,   395,    37,    38,   395,   112,   107,    64,    43,   112,
+   435,   435,   112,   435,   115,   395,   317,    74,   435,   161,
+   373,   322,   418,   373,   418,   110,   111,   418,   428,   343,
+   436,   317,   109,   439,   440,   408,   322,   109,   418,   109,
+     4,     5,   109,     7,     8,   445,   114,   189,   190,   191,
+    14,   114,   194,   110,   111,   408,    66,    67,   408,   373,
+   202,   109,   435,    27,   109,   100,   101,    31,    32,    33,
+    34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+    44,   109,   435,   112,   113,   435,   116,   117,   343,    96,
+    97,   111,    56,   109,   408,   102,   109,   239,   109,   110,
+   111,    65,   109,   110,   111,   113,    70,    66,    72,    68,
+   343,   253,   254,   255,   256,   112,   113,   343,   373,   112,
+   113,   435,    86,    87,    88,    89,    90,   112,   113,     4,
+     5,   112,     7,     8,    94,    95,   100,   101,   116,    14,
+   373,   343,   106,   107,   103,   104,   116,   373,   109,   110,
+   111,   115,    27,   408,   116,   297,    31,    32,    33,    34,
+    35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+   343,   373,   116,   343,   114,   408,    35,    36,    37,    38,
+   435,    56,   408,   112,   109,   111,   109,   329,   330,   113,
+    65,   112,   109,   110,   111,    70,   113,    72,    57,    58,
+   373,   109,   435,   373,   116,   116,   408,   114,   118,   435,
+   116,    86,    87,    88,    89,    90,    31,    32,    33,    34,
+    35,    36,    37,    38,   118,   100,   101,   118,    43,   371,
+   118,   106,   107,   435,   116,   408,   116,   118,   408,   118,
+   115,   100,   101,     4,     5,   112,     7,     8,   228,   113,
+   230,   112,   232,    14,   234,   111,   113,    72,   400,   112,
+   240,   115,   435,    92,   114,   435,    27,   114,   112,   112,
     31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-    41,    42,    43,    44,    96,   336,    47,   306,    96,    97,
-    98,    52,   100,   336,   206,   336,    57,   371,    59,   306,
-    97,    98,   103,   104,   371,   306,   306,    96,   220,   221,
-   222,   223,    73,    74,    75,    76,    77,   336,    99,   100,
-   371,    53,    96,    55,   398,   101,    87,    88,   371,   336,
-   371,   398,    93,    94,   101,   336,   336,    31,    32,    33,
-    96,   102,    99,    37,    38,    99,   100,   398,   260,    43,
-    99,   100,   371,    99,   100,   398,    96,   398,    90,    91,
-    81,    82,    96,    98,   371,    96,    96,   103,   101,    96,
-   371,   371,     4,     5,   103,     7,     8,   103,   103,   398,
-   292,   293,    14,   100,   195,    99,   197,    98,   199,    96,
-   201,   398,   100,    87,    88,    27,   207,   398,   398,    31,
+    41,    42,    43,    44,   112,   100,   101,    78,    79,    80,
+    81,    82,    83,    84,    85,    56,   109,   109,   116,   116,
+   115,   112,   116,   119,    65,   114,   286,    96,    97,    70,
+   115,    72,   114,   102,   117,   116,   116,   116,   460,   112,
+   109,   110,   111,   113,   466,    86,    87,    88,    89,    90,
+   119,   112,   117,   112,   111,   113,   111,   119,   107,   100,
+   101,     3,     4,     5,     6,   106,   107,     9,    10,    11,
+    12,    13,    14,    25,   116,   113,   120,   120,   118,     0,
+     0,   120,   118,   120,    62,    27,    28,    29,    30,    31,
     32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-    42,    43,    44,    99,    96,    47,   103,    83,    84,   103,
-    52,   101,   334,    89,   105,    57,   105,    59,   103,   105,
-    96,    97,    98,    35,    36,    37,    38,   105,   249,   103,
-   106,    73,    74,    75,    76,    77,    48,    49,   105,   103,
-   105,   363,    99,    98,   100,    87,    88,    99,    99,   102,
-   100,    93,    94,    79,   101,     3,     4,     5,     6,    99,
-   101,     9,    10,    11,    12,    13,    14,    65,    66,    67,
-    68,    69,    70,    71,    72,    87,    88,    99,    99,    27,
-    28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-    38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-    96,   423,    50,    96,    52,    99,   103,   429,    56,    57,
-    58,    59,   103,   103,    62,    63,    64,   101,    83,    84,
-   106,   102,   101,   103,    89,    73,    74,    75,    76,    77,
-    78,    96,    97,    98,   104,   103,   103,    99,    99,    87,
-    88,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-    24,    25,    26,    15,    16,    17,    18,    19,    20,    21,
-    22,    23,    24,    25,   100,   104,    99,    98,   100,    98,
-    94,   106,    31,    32,    33,    25,   103,    51,    37,    38,
-   100,   107,   105,     0,    43,   107,    60,    61,   107,    51,
-    31,    32,    33,    34,    35,    36,    37,    38,   107,    61,
-   105,   107,    43,    31,    32,    33,    34,    35,    36,    37,
-    38,     0,    49,    49,   229,    43,   371,   263,    59,   381,
-   198,    -1,   152,    97,    98,    -1,    -1,    -1,    87,    88,
-    -1,    59,    -1,    -1,    -1,    97,    98,    -1,    -1,    -1,
-    -1,    -1,    -1,   102,    -1,    -1,    87,    88,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    87,
-    88,   102
+    42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+    52,    53,    54,    55,    56,   120,    62,    59,    60,    61,
+    62,    63,   408,    65,   266,   300,   418,    69,    70,    71,
+    72,   231,    -1,    75,    76,    77,    -1,   172,    -1,    -1,
+    -1,    -1,    -1,    -1,    86,    87,    88,    89,    90,    91,
+    31,    32,    33,    -1,    -1,    -1,    37,    38,   100,   101,
+    -1,    -1,    43,    31,    32,    33,    34,    35,    36,    37,
+    38,    -1,    -1,    -1,    -1,    43,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    -1,    72,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   100,
+   101,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+    -1,    -1,   100,   101,   115
 };
 
 #line 352 "../bison++/bison.cc"
@@ -1943,15 +2039,15 @@ YYLABEL(yyreduce)
 
   switch (yyn) {
 
-case 59:
-#line 226 "SrvParser.y"
+case 66:
+#line 236 "SrvParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].strval))
 	YYABORT;
 ;
     break;}
-case 60:
-#line 231 "SrvParser.y"
+case 67:
+#line 241 "SrvParser.y"
 {
     //Information about new interface has been read
     //Add it to list of read interfaces
@@ -1959,29 +2055,29 @@ case 60:
     EndIfaceDeclaration();
 ;
     break;}
-case 61:
-#line 239 "SrvParser.y"
+case 68:
+#line 249 "SrvParser.y"
 {
     if (!StartIfaceDeclaration(yyvsp[-1].ival))
 	YYABORT;
 ;
     break;}
-case 62:
-#line 244 "SrvParser.y"
+case 69:
+#line 254 "SrvParser.y"
 {
     EndIfaceDeclaration();
 ;
     break;}
-case 73:
-#line 263 "SrvParser.y"
+case 80:
+#line 273 "SrvParser.y"
 {
     ParserOptStack.append(new TSrvParsGlobalOpt());
     SPtr<TDUID> duid = new TDUID(yyvsp[-1].duidval.duid,yyvsp[-1].duidval.length);
     ClientLst.append(new TSrvCfgOptions(duid));
 ;
     break;}
-case 74:
-#line 269 "SrvParser.y"
+case 81:
+#line 279 "SrvParser.y"
 {
     Log(Debug) << "Exception: DUID-based exception specified." << LogEnd;
     // copy all defined options
@@ -1989,16 +2085,16 @@ case 74:
     ParserOptStack.delLast();
 ;
     break;}
-case 75:
-#line 277 "SrvParser.y"
+case 82:
+#line 287 "SrvParser.y"
 {
     ParserOptStack.append(new TSrvParsGlobalOpt());
     SPtr<TOptVendorData> remoteid = new TOptVendorData(yyvsp[-3].ival, yyvsp[-1].duidval.duid, yyvsp[-1].duidval.length, 0);
     ClientLst.append(new TSrvCfgOptions(remoteid));
 ;
     break;}
-case 76:
-#line 283 "SrvParser.y"
+case 83:
+#line 293 "SrvParser.y"
 {
     Log(Debug) << "Exception: RemoteID-based exception specified." << LogEnd;
     // copy all defined options
@@ -2006,79 +2102,79 @@ case 76:
     ParserOptStack.delLast();
 ;
     break;}
-case 94:
-#line 315 "SrvParser.y"
+case 101:
+#line 325 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Info) << "Exception: Address " << addr->getPlain() << " reserved." << LogEnd;
     ClientLst.getLast()->setAddr(addr);
 ;
     break;}
-case 95:
-#line 324 "SrvParser.y"
+case 102:
+#line 334 "SrvParser.y"
 {
     StartClassDeclaration();
 ;
     break;}
-case 96:
-#line 328 "SrvParser.y"
+case 103:
+#line 338 "SrvParser.y"
 {
     if (!EndClassDeclaration())
 	YYABORT;
 ;
     break;}
-case 99:
-#line 342 "SrvParser.y"
+case 106:
+#line 352 "SrvParser.y"
 {
     StartTAClassDeclaration();
 ;
     break;}
-case 100:
-#line 345 "SrvParser.y"
+case 107:
+#line 355 "SrvParser.y"
 {
     if (!EndTAClassDeclaration())
 	YYABORT;
 ;
     break;}
-case 111:
-#line 368 "SrvParser.y"
+case 118:
+#line 378 "SrvParser.y"
 {
     StartPDDeclaration();
 ;
     break;}
-case 112:
-#line 371 "SrvParser.y"
+case 119:
+#line 381 "SrvParser.y"
 {
     if (!EndPDDeclaration())
 	YYABORT;
 ;
     break;}
-case 123:
-#line 398 "SrvParser.y"
+case 130:
+#line 408 "SrvParser.y"
 {
     SPtr<TIPv6Addr> routerAddr = new TIPv6Addr(yyvsp[-1].addrval);
     SPtr<TOpt> myNextHop = new TOptAddr(OPTION_NEXT_HOP, routerAddr, NULL);
     nextHop = myNextHop; 
 ;
     break;}
-case 124:
-#line 404 "SrvParser.y"
+case 131:
+#line 414 "SrvParser.y"
 {
     SrvCfgIfaceLst.getLast()->addExtraOption(nextHop, false);
     nextHop = 0;
     //should we call YYABORT;?
 ;
     break;}
-case 125:
-#line 410 "SrvParser.y"
+case 132:
+#line 420 "SrvParser.y"
 {
     SPtr<TIPv6Addr> routerAddr = new TIPv6Addr(yyvsp[0].addrval);
     SPtr<TOpt> myNextHop = new TOptAddr(OPTION_NEXT_HOP, routerAddr, NULL);
     SrvCfgIfaceLst.getLast()->addExtraOption(myNextHop, false);
 ;
     break;}
-case 128:
-#line 424 "SrvParser.y"
+case 135:
+#line 434 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-4].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(yyvsp[0].ival, yyvsp[-2].ival, 42, prefix, NULL);
@@ -2088,8 +2184,8 @@ case 128:
         SrvCfgIfaceLst.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 129:
-#line 433 "SrvParser.y"
+case 136:
+#line 443 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-2].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(DHCPV6_INFINITY, yyvsp[0].ival, 42, prefix, NULL);
@@ -2099,8 +2195,8 @@ case 129:
         SrvCfgIfaceLst.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 130:
-#line 442 "SrvParser.y"
+case 137:
+#line 452 "SrvParser.y"
 {
     SPtr<TIPv6Addr> prefix = new TIPv6Addr(yyvsp[-4].addrval);
     SPtr<TOpt> rtPrefix = new TOptRtPrefix(DHCPV6_INFINITY, yyvsp[-2].ival, 42, prefix, NULL);
@@ -2110,55 +2206,55 @@ case 130:
         SrvCfgIfaceLst.getLast()->addExtraOption(rtPrefix, false);
 ;
     break;}
-case 131:
-#line 455 "SrvParser.y"
+case 138:
+#line 465 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_NONE); ;
     break;}
-case 132:
-#line 456 "SrvParser.y"
+case 139:
+#line 466 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_PLAIN); ;
     break;}
-case 133:
-#line 457 "SrvParser.y"
+case 140:
+#line 467 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_MD5); ;
     break;}
-case 134:
-#line 458 "SrvParser.y"
+case 141:
+#line 468 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_SHA1); ;
     break;}
-case 135:
-#line 459 "SrvParser.y"
+case 142:
+#line 469 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_SHA224); ;
     break;}
-case 136:
-#line 460 "SrvParser.y"
+case 143:
+#line 470 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_SHA256); ;
     break;}
-case 137:
-#line 461 "SrvParser.y"
+case 144:
+#line 471 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_SHA384); ;
     break;}
-case 138:
-#line 462 "SrvParser.y"
+case 145:
+#line 472 "SrvParser.y"
 { ParserOptStack.getLast()->addDigest(DIGEST_HMAC_SHA512); ;
     break;}
-case 139:
-#line 466 "SrvParser.y"
+case 146:
+#line 476 "SrvParser.y"
 { ParserOptStack.getLast()->setAuthLifetime(yyvsp[0].ival); ;
     break;}
-case 140:
-#line 470 "SrvParser.y"
+case 147:
+#line 480 "SrvParser.y"
 { ParserOptStack.getLast()->setAuthKeyLen(yyvsp[0].ival); ;
     break;}
-case 141:
-#line 479 "SrvParser.y"
+case 148:
+#line 489 "SrvParser.y"
 {
     Log(Notice)<< "FQDN: The client "<<yyvsp[0].strval<<" has no address nor DUID"<<LogEnd;
     PresentFQDNLst.append(new TFQDN(yyvsp[0].strval,false));
 ;
     break;}
-case 142:
-#line 484 "SrvParser.y"
+case 149:
+#line 494 "SrvParser.y"
 {
     TDUID* duidNew = new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval <<" reserved for DUID " << duidNew->getPlain()<<LogEnd;
@@ -2166,8 +2262,8 @@ case 142:
     PresentFQDNLst.append(new TFQDN(duidNew, yyvsp[-2].strval,false));
 ;
     break;}
-case 143:
-#line 491 "SrvParser.y"
+case 150:
+#line 501 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval <<" reserved for address "<<*addr<<LogEnd;
@@ -2175,15 +2271,15 @@ case 143:
     PresentFQDNLst.append(new TFQDN(new TIPv6Addr(yyvsp[0].addrval), yyvsp[-2].strval,false));
 ;
     break;}
-case 144:
-#line 498 "SrvParser.y"
+case 151:
+#line 508 "SrvParser.y"
 {
 	Log(Debug) << "FQDN:"<<yyvsp[0].strval<<" has no reservations (is available to everyone)."<<LogEnd;
     PresentFQDNLst.append(new TFQDN(yyvsp[0].strval,false));
 ;
     break;}
-case 145:
-#line 503 "SrvParser.y"
+case 152:
+#line 513 "SrvParser.y"
 {
     TDUID* duidNew = new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval << " reserved for DUID "<< duidNew->getPlain() << LogEnd;
@@ -2191,8 +2287,8 @@ case 145:
     PresentFQDNLst.append(new TFQDN( duidNew, yyvsp[-2].strval,false));
 ;
     break;}
-case 146:
-#line 510 "SrvParser.y"
+case 153:
+#line 520 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     Log(Debug)<< "FQDN:" << yyvsp[-2].strval<<" reserved for address "<< addr->getPlain() << LogEnd;
@@ -2200,28 +2296,28 @@ case 146:
     PresentFQDNLst.append(new TFQDN(new TIPv6Addr(yyvsp[0].addrval), yyvsp[-2].strval,false));
 ;
     break;}
-case 147:
-#line 519 "SrvParser.y"
+case 154:
+#line 529 "SrvParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 148:
-#line 520 "SrvParser.y"
+case 155:
+#line 530 "SrvParser.y"
 {yyval.ival=yyvsp[0].ival;;
     break;}
-case 149:
-#line 525 "SrvParser.y"
+case 156:
+#line 535 "SrvParser.y"
 {
     PresentAddrLst.append(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 150:
-#line 529 "SrvParser.y"
+case 157:
+#line 539 "SrvParser.y"
 {
     PresentAddrLst.append(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 151:
-#line 536 "SrvParser.y"
+case 158:
+#line 546 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << yyvsp[0].duidval.length << LogEnd;
@@ -2229,30 +2325,30 @@ case 151:
     SrvCfgIfaceLst.getLast()->addExtraOption(new TOptVendorSpecInfo(yyvsp[-4].ival, yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0), false);
 ;
     break;}
-case 152:
-#line 543 "SrvParser.y"
+case 159:
+#line 553 "SrvParser.y"
 {
     Log(Debug) << "Vendor-spec defined: Enterprise: " << yyvsp[-4].ival << ", optionCode: "
 	       << yyvsp[-2].ival << ", valuelen=" << yyvsp[0].duidval.length << LogEnd;
     SrvCfgIfaceLst.getLast()->addExtraOption(new TOptVendorSpecInfo(yyvsp[-4].ival, yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0), false);
 ;
     break;}
-case 153:
-#line 551 "SrvParser.y"
+case 160:
+#line 561 "SrvParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 154:
-#line 552 "SrvParser.y"
+case 161:
+#line 562 "SrvParser.y"
 { PresentStringLst.append(SPtr<string> (new string(yyvsp[0].strval))); ;
     break;}
-case 155:
-#line 557 "SrvParser.y"
+case 162:
+#line 567 "SrvParser.y"
 {
 	PresentRangeLst.append(new TStationRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
     ;
     break;}
-case 156:
-#line 561 "SrvParser.y"
+case 163:
+#line 571 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
 	SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2262,8 +2358,8 @@ case 156:
 	    PresentRangeLst.append(new TStationRange(addr2,addr1));
     ;
     break;}
-case 157:
-#line 570 "SrvParser.y"
+case 164:
+#line 580 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[-2].addrval));
 	int prefix = yyvsp[0].ival;
@@ -2280,14 +2376,14 @@ case 157:
 	    PresentRangeLst.append(new TStationRange(addr2,addr1));
     ;
     break;}
-case 158:
-#line 586 "SrvParser.y"
+case 165:
+#line 596 "SrvParser.y"
 {
 	PresentRangeLst.append(new TStationRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
     ;
     break;}
-case 159:
-#line 590 "SrvParser.y"
+case 166:
+#line 600 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
 	SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2297,8 +2393,8 @@ case 159:
 	    PresentRangeLst.append(new TStationRange(addr2,addr1));
     ;
     break;}
-case 160:
-#line 602 "SrvParser.y"
+case 167:
+#line 612 "SrvParser.y"
 {
 	SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[-2].addrval));
 	int prefix = yyvsp[0].ival;
@@ -2319,14 +2415,14 @@ case 160:
 	PDLst.append(range);
     ;
     break;}
-case 161:
-#line 625 "SrvParser.y"
+case 168:
+#line 635 "SrvParser.y"
 {
     PresentRangeLst.append(new TStationRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
 ;
     break;}
-case 162:
-#line 629 "SrvParser.y"
+case 169:
+#line 639 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
     SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2336,14 +2432,14 @@ case 162:
 	PresentRangeLst.append(new TStationRange(addr2,addr1));
 ;
     break;}
-case 163:
-#line 638 "SrvParser.y"
+case 170:
+#line 648 "SrvParser.y"
 {
     PresentRangeLst.append(new TStationRange(new TIPv6Addr(yyvsp[0].addrval),new TIPv6Addr(yyvsp[0].addrval)));
 ;
     break;}
-case 164:
-#line 642 "SrvParser.y"
+case 171:
+#line 652 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr1(new TIPv6Addr(yyvsp[-2].addrval));
     SPtr<TIPv6Addr> addr2(new TIPv6Addr(yyvsp[0].addrval));
@@ -2353,15 +2449,15 @@ case 164:
 	PresentRangeLst.append(new TStationRange(addr2,addr1));
 ;
     break;}
-case 165:
-#line 651 "SrvParser.y"
+case 172:
+#line 661 "SrvParser.y"
 {
     PresentRangeLst.append(new TStationRange(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length)));
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 166:
-#line 656 "SrvParser.y"
+case 173:
+#line 666 "SrvParser.y"
 {
     SPtr<TDUID> duid1(new TDUID(yyvsp[-2].duidval.duid,yyvsp[-2].duidval.length));
     SPtr<TDUID> duid2(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length));
@@ -2372,15 +2468,15 @@ case 166:
 	PresentRangeLst.append(new TStationRange(duid2,duid1));
 ;
     break;}
-case 167:
-#line 666 "SrvParser.y"
+case 174:
+#line 676 "SrvParser.y"
 {
     PresentRangeLst.append(new TStationRange(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length)));
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 168:
-#line 671 "SrvParser.y"
+case 175:
+#line 681 "SrvParser.y"
 {
     SPtr<TDUID> duid2(new TDUID(yyvsp[-2].duidval.duid,yyvsp[-2].duidval.length));
     SPtr<TDUID> duid1(new TDUID(yyvsp[0].duidval.duid,yyvsp[0].duidval.length));
@@ -2392,89 +2488,89 @@ case 168:
     delete yyvsp[0].duidval.duid;
 ;
     break;}
-case 169:
-#line 685 "SrvParser.y"
+case 176:
+#line 695 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 170:
-#line 688 "SrvParser.y"
+case 177:
+#line 698 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRejedClnt(&PresentRangeLst);
 ;
     break;}
-case 171:
-#line 695 "SrvParser.y"
+case 178:
+#line 705 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 172:
-#line 698 "SrvParser.y"
+case 179:
+#line 708 "SrvParser.y"
 {
     ParserOptStack.getLast()->setAcceptClnt(&PresentRangeLst);
 ;
     break;}
-case 173:
-#line 705 "SrvParser.y"
+case 180:
+#line 715 "SrvParser.y"
 {
     PresentRangeLst.clear();
 ;
     break;}
-case 174:
-#line 708 "SrvParser.y"
+case 181:
+#line 718 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPool(&PresentRangeLst);
 ;
     break;}
-case 175:
-#line 715 "SrvParser.y"
+case 182:
+#line 725 "SrvParser.y"
 {
 ;
     break;}
-case 176:
-#line 717 "SrvParser.y"
+case 183:
+#line 727 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPool(&PresentRangeLst/*PDList*/);
 ;
     break;}
-case 177:
-#line 723 "SrvParser.y"
+case 184:
+#line 733 "SrvParser.y"
 {
    this->PDPrefix = yyvsp[0].ival;
 ;
     break;}
-case 178:
-#line 730 "SrvParser.y"
+case 185:
+#line 740 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPrefBeg(yyvsp[0].ival);
     ParserOptStack.getLast()->setPrefEnd(yyvsp[0].ival);
 ;
     break;}
-case 179:
-#line 735 "SrvParser.y"
+case 186:
+#line 745 "SrvParser.y"
 {
     ParserOptStack.getLast()->setPrefBeg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setPrefEnd(yyvsp[0].ival);
 ;
     break;}
-case 180:
-#line 743 "SrvParser.y"
+case 187:
+#line 753 "SrvParser.y"
 {
     ParserOptStack.getLast()->setValidBeg(yyvsp[0].ival);
     ParserOptStack.getLast()->setValidEnd(yyvsp[0].ival);
 ;
     break;}
-case 181:
-#line 748 "SrvParser.y"
+case 188:
+#line 758 "SrvParser.y"
 {
     ParserOptStack.getLast()->setValidBeg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setValidEnd(yyvsp[0].ival);
 ;
     break;}
-case 182:
-#line 756 "SrvParser.y"
+case 189:
+#line 766 "SrvParser.y"
 {
     int x=yyvsp[0].ival;
     if ( (x<1) || (x>1000)) {
@@ -2485,48 +2581,48 @@ case 182:
     ParserOptStack.getLast()->setShare(x);
 ;
     break;}
-case 183:
-#line 768 "SrvParser.y"
+case 190:
+#line 778 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT1Beg(yyvsp[0].ival);
     ParserOptStack.getLast()->setT1End(yyvsp[0].ival);
 ;
     break;}
-case 184:
-#line 773 "SrvParser.y"
+case 191:
+#line 783 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT1Beg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setT1End(yyvsp[0].ival);
 ;
     break;}
-case 185:
-#line 781 "SrvParser.y"
+case 192:
+#line 791 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT2Beg(yyvsp[0].ival);
     ParserOptStack.getLast()->setT2End(yyvsp[0].ival);
 ;
     break;}
-case 186:
-#line 786 "SrvParser.y"
+case 193:
+#line 796 "SrvParser.y"
 {
     ParserOptStack.getLast()->setT2Beg(yyvsp[-2].ival);
     ParserOptStack.getLast()->setT2End(yyvsp[0].ival);
 ;
     break;}
-case 187:
-#line 794 "SrvParser.y"
+case 194:
+#line 804 "SrvParser.y"
 {
     ParserOptStack.getLast()->setClntMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 188:
-#line 801 "SrvParser.y"
+case 195:
+#line 811 "SrvParser.y"
 {
     ParserOptStack.getLast()->setClassMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 189:
-#line 808 "SrvParser.y"
+case 196:
+#line 818 "SrvParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'addr-params' defined, but experimental features are disabled. Add 'experimental' "
@@ -2538,24 +2634,24 @@ case 189:
     ParserOptStack.getLast()->setAddrParams(yyvsp[0].ival,bitfield);
 ;
     break;}
-case 190:
-#line 821 "SrvParser.y"
+case 197:
+#line 831 "SrvParser.y"
 {
     SPtr<TOpt> tunnelName = new TOptString(OPTION_AFTR_NAME, yyvsp[0].strval, 0);
     Log(Debug) << "Enabling DS-Lite tunnel option, AFTR name=" << yyvsp[0].strval << LogEnd;
     SrvCfgIfaceLst.getLast()->addExtraOption(tunnelName, false);
 ;
     break;}
-case 191:
-#line 829 "SrvParser.y"
+case 198:
+#line 839 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptGeneric(yyvsp[-2].ival, yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
     SrvCfgIfaceLst.getLast()->addExtraOption(opt, false);
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", length=" << yyvsp[0].duidval.length << LogEnd;
 ;
     break;}
-case 192:
-#line 835 "SrvParser.y"
+case 199:
+#line 845 "SrvParser.y"
 {
     SPtr<TIPv6Addr> addr(new TIPv6Addr(yyvsp[0].addrval));
 
@@ -2564,30 +2660,30 @@ case 192:
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", address=" << addr->getPlain() << LogEnd;
 ;
     break;}
-case 193:
-#line 843 "SrvParser.y"
+case 200:
+#line 853 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 194:
-#line 846 "SrvParser.y"
+case 201:
+#line 856 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(yyvsp[-3].ival, PresentAddrLst, 0);
     SrvCfgIfaceLst.getLast()->addExtraOption(opt, false);
     Log(Debug) << "Extra option defined: code=" << yyvsp[-3].ival << ", address count=" << PresentAddrLst.count() << LogEnd;
 ;
     break;}
-case 195:
-#line 852 "SrvParser.y"
+case 202:
+#line 862 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptString(yyvsp[-2].ival, string(yyvsp[0].strval), 0);
     SrvCfgIfaceLst.getLast()->addExtraOption(opt, false);
     Log(Debug) << "Extra option defined: code=" << yyvsp[-2].ival << ", string=" << yyvsp[0].strval << LogEnd;
 ;
     break;}
-case 196:
-#line 860 "SrvParser.y"
+case 203:
+#line 870 "SrvParser.y"
 {
     if (!ParserOptStack.getLast()->getExperimental()) {
 	Log(Crit) << "Experimental 'remote autoconf neighbors' defined, but "
@@ -2599,8 +2695,8 @@ case 196:
     PresentAddrLst.clear();
 ;
     break;}
-case 197:
-#line 870 "SrvParser.y"
+case 204:
+#line 880 "SrvParser.y"
 {
     SPtr<TOpt> opt = new TOptAddrLst(OPTION_NEIGHBORS, PresentAddrLst, 0);
     SrvCfgIfaceLst.getLast()->addExtraOption(opt, false);
@@ -2608,20 +2704,20 @@ case 197:
 	       << " neighbors defined.)" << LogEnd;
 ;
     break;}
-case 198:
-#line 880 "SrvParser.y"
+case 205:
+#line 890 "SrvParser.y"
 {
     ParserOptStack.getLast()->setIfaceMaxLease(yyvsp[0].ival);
 ;
     break;}
-case 199:
-#line 887 "SrvParser.y"
+case 206:
+#line 897 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnicast(new TIPv6Addr(yyvsp[0].addrval));
 ;
     break;}
-case 200:
-#line 894 "SrvParser.y"
+case 207:
+#line 904 "SrvParser.y"
 {
     if ( (yyvsp[0].ival!=0) && (yyvsp[0].ival!=1)) {
 	Log(Crit) << "RAPID-COMMIT  parameter in line " << lex->lineno() << " must have 0 or 1 value."
@@ -2634,8 +2730,8 @@ case 200:
 	ParserOptStack.getLast()->setRapidCommit(false);
 ;
     break;}
-case 201:
-#line 909 "SrvParser.y"
+case 208:
+#line 919 "SrvParser.y"
 {
     if ((yyvsp[0].ival<0)||(yyvsp[0].ival>255)) {
 	Log(Crit) << "Preference value (" << yyvsp[0].ival << ") in line " << lex->lineno()
@@ -2645,70 +2741,110 @@ case 201:
     ParserOptStack.getLast()->setPreference(yyvsp[0].ival);
 ;
     break;}
-case 202:
-#line 920 "SrvParser.y"
+case 209:
+#line 930 "SrvParser.y"
 {
     logger::setLogLevel(yyvsp[0].ival);
 ;
     break;}
-case 203:
-#line 926 "SrvParser.y"
+case 210:
+#line 936 "SrvParser.y"
 {
     logger::setLogMode(yyvsp[0].strval);
 ;
     break;}
-case 204:
-#line 932 "SrvParser.y"
+case 211:
+#line 942 "SrvParser.y"
 {
     logger::setLogName(yyvsp[0].strval);
 ;
     break;}
-case 205:
-#line 939 "SrvParser.y"
+case 212:
+#line 949 "SrvParser.y"
 {
     logger::setColors(yyvsp[0].ival==1);
 ;
     break;}
-case 206:
-#line 945 "SrvParser.y"
+case 213:
+#line 955 "SrvParser.y"
 {
     ParserOptStack.getLast()->setWorkDir(yyvsp[0].strval);
 ;
     break;}
-case 207:
-#line 952 "SrvParser.y"
+case 214:
+#line 962 "SrvParser.y"
 {
     ParserOptStack.getLast()->setStateless(true);
 ;
     break;}
-case 208:
-#line 959 "SrvParser.y"
+case 215:
+#line 969 "SrvParser.y"
 {
     Log(Info) << "Guess-mode enabled: relay interfaces may be loosely defined (matching interface-id is not mandatory)." << LogEnd;
     ParserOptStack.getLast()->setGuessMode(true);
 ;
     break;}
-case 209:
-#line 966 "SrvParser.y"
+case 216:
+#line 976 "SrvParser.y"
 {
     CfgMgr->setScriptName(yyvsp[0].strval);
 ;
     break;}
-case 210:
-#line 973 "SrvParser.y"
+case 217:
+#line 982 "SrvParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-concurrency must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptConcurrency(yyvsp[0].ival);
+;
+    break;}
+case 218:
+#line 990 "SrvParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-queue-size must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptQueueSize(yyvsp[0].ival);
+;
+    break;}
+case 219:
+#line 998 "SrvParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-timeout must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptTimeout(yyvsp[0].ival);
+;
+    break;}
+case 220:
+#line 1006 "SrvParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "script-batch must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptBatch(yyvsp[0].ival);
+;
+    break;}
+case 221:
+#line 1017 "SrvParser.y"
 {
     ParserOptStack.getLast()->setInactiveMode(true);
 ;
     break;}
-case 211:
-#line 979 "SrvParser.y"
+case 222:
+#line 1023 "SrvParser.y"
 {
     Log(Crit) << "Experimental features are allowed." << LogEnd;
     ParserOptStack.getLast()->setExperimental(true);
 ;
     break;}
-case 212:
-#line 986 "SrvParser.y"
+case 223:
+#line 1030 "SrvParser.y"
 {
     if (!strncasecmp(yyvsp[0].strval,"before",6))
     {
@@ -2728,21 +2864,85 @@ case 212:
     }
 ;
     break;}
-case 213:
-#line 1007 "SrvParser.y"
+case 224:
+#line 1051 "SrvParser.y"
 {
     ParserOptStack.getLast()->setCacheSize(yyvsp[0].ival);
 ;
     break;}
-case 214:
-#line 1018 "SrvParser.y"
+case 225:
+#line 1058 "SrvParser.y"
+{
+    ParserOptStack.getLast()->setLeaseDumpInterval(yyvsp[0].ival);
+;
+    break;}
+case 226:
+#line 1065 "SrvParser.y"
+{
+    ParserOptStack.getLast()->setOfferLifetime(yyvsp[0].ival);
+;
+    break;}
+case 227:
+#line 1072 "SrvParser.y"
+{
+    if (!yyvsp[0].ival) {
+	Log(Crit) << "offer-limit must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setOfferLimit(yyvsp[0].ival);
+;
+    break;}
+case 228:
+#line 1087 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_CLIENT, yyvsp[0].ival, 0); ;
+    break;}
+case 229:
+#line 1088 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_LINK, yyvsp[0].ival, 0); ;
+    break;}
+case 230:
+#line 1089 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_IFACE, yyvsp[0].ival, 0); ;
+    break;}
+case 231:
+#line 1091 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_CLIENT, yyvsp[-1].ival, yyvsp[0].ival); ;
+    break;}
+case 232:
+#line 1092 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_LINK, yyvsp[-1].ival, yyvsp[0].ival); ;
+    break;}
+case 233:
+#line 1093 "SrvParser.y"
+{ ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_IFACE, yyvsp[-1].ival, yyvsp[0].ival); ;
+    break;}
+case 234:
+#line 1098 "SrvParser.y"
+{
+    ParserOptStack.getLast()->setSolicitEarlyDrop(yyvsp[0].ival);
+;
+    break;}
+case 235:
+#line 1110 "SrvParser.y"
+{
+    ParserOptStack.getLast()->setReplicationPort(yyvsp[0].ival);
+;
+    break;}
+case 236:
+#line 1115 "SrvParser.y"
+{
+    ParserOptStack.getLast()->setReplicationPeer(new TIPv6Addr(yyvsp[-1].addrval), yyvsp[0].ival);
+;
+    break;}
+case 237:
+#line 1126 "SrvParser.y"
 {
     ParserOptStack.getLast()->setLeaseQuerySupport(true);
 
 ;
     break;}
-case 215:
-#line 1023 "SrvParser.y"
+case 238:
+#line 1131 "SrvParser.y"
 {
     switch (yyvsp[0].ival) {
     case 0:
@@ -2757,8 +2957,8 @@ case 215:
     }
 ;
     break;}
-case 216:
-#line 1039 "SrvParser.y"
+case 239:
+#line 1147 "SrvParser.y"
 {
     if (yyvsp[0].ival!=0 && yyvsp[0].ival!=1) {
 	Log(Error) << "Invalid bulk-leasequery-accept value: " << (yyvsp[0].ival)
@@ -2768,59 +2968,59 @@ case 216:
     CfgMgr->bulkLQAccept( (bool) yyvsp[0].ival);
 ;
     break;}
-case 217:
-#line 1050 "SrvParser.y"
+case 240:
+#line 1158 "SrvParser.y"
 {
     CfgMgr->bulkLQTcpPort( yyvsp[0].ival );
 ;
     break;}
-case 218:
-#line 1056 "SrvParser.y"
+case 241:
+#line 1164 "SrvParser.y"
 {
     CfgMgr->bulkLQMaxConns( yyvsp[0].ival );
 ;
     break;}
-case 219:
-#line 1062 "SrvParser.y"
+case 242:
+#line 1170 "SrvParser.y"
 {
     CfgMgr->bulkLQTimeout( yyvsp[0].ival );
 ;
     break;}
-case 220:
-#line 1071 "SrvParser.y"
+case 243:
+#line 1179 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRelayName(yyvsp[0].strval);
 ;
     break;}
-case 221:
-#line 1075 "SrvParser.y"
+case 244:
+#line 1183 "SrvParser.y"
 {
     ParserOptStack.getLast()->setRelayID(yyvsp[0].ival);
 ;
     break;}
-case 222:
-#line 1082 "SrvParser.y"
+case 245:
+#line 1190 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].ival, 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 223:
-#line 1087 "SrvParser.y"
+case 246:
+#line 1195 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].duidval.duid, yyvsp[0].duidval.length, 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 224:
-#line 1092 "SrvParser.y"
+case 247:
+#line 1200 "SrvParser.y"
 {
     SPtr<TSrvOptInterfaceID> id = new TSrvOptInterfaceID(yyvsp[0].strval, strlen(yyvsp[0].strval), 0);
     ParserOptStack.getLast()->setRelayInterfaceID(id);
 ;
     break;}
-case 237:
-#line 1115 "SrvParser.y"
+case 260:
+#line 1223 "SrvParser.y"
 {
     SPtr<TSrvCfgClientClass> clntClass;
     bool found = false;
@@ -2848,8 +3048,8 @@ case 237:
 
 ;
     break;}
-case 238:
-#line 1144 "SrvParser.y"
+case 261:
+#line 1252 "SrvParser.y"
 {
     SPtr<TSrvCfgClientClass> clntClass;
     bool found = false;
@@ -2877,74 +3077,74 @@ case 238:
 
 ;
     break;}
-case 239:
-#line 1177 "SrvParser.y"
+case 262:
+#line 1285 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 240:
-#line 1180 "SrvParser.y"
+case 263:
+#line 1288 "SrvParser.y"
 {
     ParserOptStack.getLast()->setDNSServerLst(&PresentAddrLst);
 ;
     break;}
-case 241:
-#line 1189 "SrvParser.y"
+case 264:
+#line 1297 "SrvParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 242:
-#line 1192 "SrvParser.y"
+case 265:
+#line 1300 "SrvParser.y"
 {
     ParserOptStack.getLast()->setDomainLst(&PresentStringLst);
 ;
     break;}
-case 243:
-#line 1202 "SrvParser.y"
+case 266:
+#line 1310 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 244:
-#line 1205 "SrvParser.y"
+case 267:
+#line 1313 "SrvParser.y"
 {
     ParserOptStack.getLast()->setNTPServerLst(&PresentAddrLst);
 ;
     break;}
-case 245:
-#line 1215 "SrvParser.y"
+case 268:
+#line 1323 "SrvParser.y"
 {
     ParserOptStack.getLast()->setTimezone(yyvsp[0].strval);
 ;
     break;}
-case 246:
-#line 1224 "SrvParser.y"
+case 269:
+#line 1332 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 247:
-#line 1227 "SrvParser.y"
+case 270:
+#line 1335 "SrvParser.y"
 {
     ParserOptStack.getLast()->setSIPServerLst(&PresentAddrLst);
 ;
     break;}
-case 248:
-#line 1236 "SrvParser.y"
+case 271:
+#line 1344 "SrvParser.y"
 {
     PresentStringLst.clear();
 ;
     break;}
-case 249:
-#line 1239 "SrvParser.y"
+case 272:
+#line 1347 "SrvParser.y"
 {
     ParserOptStack.getLast()->setSIPDomainLst(&PresentStringLst);
 ;
     break;}
-case 250:
-#line 1250 "SrvParser.y"
+case 273:
+#line 1358 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug)   << "No FQDNMode found, setting default mode 2 (all updates executed by server)." << LogEnd;
@@ -2953,14 +3153,14 @@ case 250:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(0);
 ;
     break;}
-case 251:
-#line 1257 "SrvParser.y"
+case 274:
+#line 1365 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 ;
     break;}
-case 252:
-#line 1261 "SrvParser.y"
+case 275:
+#line 1369 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug)  << "FQDNMode found, setting value"<< yyvsp[0].ival <<LogEnd;
@@ -2969,15 +3169,15 @@ case 252:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(0);
 ;
     break;}
-case 253:
-#line 1268 "SrvParser.y"
+case 276:
+#line 1376 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 
 ;
     break;}
-case 254:
-#line 1273 "SrvParser.y"
+case 277:
+#line 1381 "SrvParser.y"
 {
     PresentFQDNLst.clear();
     Log(Debug) << "FQDNMode found, setting value " << yyvsp[-1].ival <<LogEnd;
@@ -2986,37 +3186,37 @@ case 254:
     ParserOptStack.getLast()->setRevDNSZoneRootLength(yyvsp[0].ival);
 ;
     break;}
-case 255:
-#line 1280 "SrvParser.y"
+case 278:
+#line 1388 "SrvParser.y"
 {
     ParserOptStack.getLast()->setFQDNLst(&PresentFQDNLst);
 
 ;
     break;}
-case 256:
-#line 1288 "SrvParser.y"
+case 279:
+#line 1396 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnknownFQDN(EUnknownFQDNMode(yyvsp[-1].ival), string(yyvsp[0].strval) );
     Log(Debug) << "FQDN: Unknown fqdn names processing set to " << yyvsp[-1].ival << ", domain=" << yyvsp[0].strval << "." << LogEnd;
 ;
     break;}
-case 257:
-#line 1293 "SrvParser.y"
+case 280:
+#line 1401 "SrvParser.y"
 {
     ParserOptStack.getLast()->setUnknownFQDN(EUnknownFQDNMode(yyvsp[0].ival), string("") );
     Log(Debug) << "FQDN: Unknown fqdn names processing set to " << yyvsp[0].ival << ", no domain." << LogEnd;
 ;
     break;}
-case 258:
-#line 1301 "SrvParser.y"
+case 281:
+#line 1409 "SrvParser.y"
 {
     addr = new TIPv6Addr(yyvsp[0].addrval);
     CfgMgr->setDDNSAddress(addr);
     Log(Info) << "FQDN: DDNS updates will be performed to " << addr->getPlain() << "." << LogEnd;
 ;
     break;}
-case 259:
-#line 1309 "SrvParser.y"
+case 282:
+#line 1417 "SrvParser.y"
 {
     if (!strcasecmp(yyvsp[0].strval,"tcp"))
 	CfgMgr->setDDNSProtocol(TCfgMgr::DNSUPDATE_TCP);
@@ -3032,88 +3232,88 @@ case 259:
     Log(Debug) << "DDNS: Setting protocol to " << (yyvsp[0].strval) << LogEnd;
 ;
     break;}
-case 260:
-#line 1326 "SrvParser.y"
+case 283:
+#line 1434 "SrvParser.y"
 {
     Log(Debug) << "DDNS: Setting timeout to " << yyvsp[0].ival << "ms." << LogEnd;
     CfgMgr->setDDNSTimeout(yyvsp[0].ival);
 ;
     break;}
-case 261:
-#line 1335 "SrvParser.y"
+case 284:
+#line 1443 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 262:
-#line 1338 "SrvParser.y"
+case 285:
+#line 1446 "SrvParser.y"
 {
     ParserOptStack.getLast()->setNISServerLst(&PresentAddrLst);
 ;
     break;}
-case 263:
-#line 1347 "SrvParser.y"
+case 286:
+#line 1455 "SrvParser.y"
 {
     PresentAddrLst.clear();
 ;
     break;}
-case 264:
-#line 1350 "SrvParser.y"
+case 287:
+#line 1458 "SrvParser.y"
 {
     ParserOptStack.getLast()->setNISPServerLst(&PresentAddrLst);
 ;
     break;}
-case 265:
-#line 1360 "SrvParser.y"
+case 288:
+#line 1468 "SrvParser.y"
 {
     ParserOptStack.getLast()->setNISDomain(yyvsp[0].strval);
 ;
     break;}
-case 266:
-#line 1370 "SrvParser.y"
+case 289:
+#line 1478 "SrvParser.y"
 {
     ParserOptStack.getLast()->setNISPDomain(yyvsp[0].strval);
 ;
     break;}
-case 267:
-#line 1380 "SrvParser.y"
+case 290:
+#line 1488 "SrvParser.y"
 {
     ParserOptStack.getLast()->setLifetime(yyvsp[0].ival);
 ;
     break;}
-case 268:
-#line 1386 "SrvParser.y"
+case 291:
+#line 1494 "SrvParser.y"
 {
 ;
     break;}
-case 269:
-#line 1388 "SrvParser.y"
+case 292:
+#line 1496 "SrvParser.y"
 {
     // ParserOptStack.getLast()->setVendorSpec(VendorSpec);
     // Log(Debug) << "Vendor-spec parsing finished" << LogEnd;
 ;
     break;}
-case 270:
-#line 1396 "SrvParser.y"
+case 293:
+#line 1504 "SrvParser.y"
 {
     Log(Notice) << "ClientClass found, name: " << string(yyvsp[-1].strval) << LogEnd;
 ;
     break;}
-case 271:
-#line 1399 "SrvParser.y"
+case 294:
+#line 1507 "SrvParser.y"
 {
     SPtr<Node> cond =  NodeClientClassLst.getLast();
     SrvCfgClientClassLst.append( new TSrvCfgClientClass(string(yyvsp[-4].strval),cond));
     NodeClientClassLst.delLast();
 ;
     break;}
-case 272:
-#line 1409 "SrvParser.y"
+case 295:
+#line 1517 "SrvParser.y"
 {
 ;
     break;}
-case 274:
-#line 1415 "SrvParser.y"
+case 297:
+#line 1523 "SrvParser.y"
 {
     SPtr<Node> r =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3122,8 +3322,8 @@ case 274:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_CONTAIN,l,r));
 ;
     break;}
-case 275:
-#line 1423 "SrvParser.y"
+case 298:
+#line 1531 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3133,8 +3333,8 @@ case 275:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_EQUAL,l,r));
 ;
     break;}
-case 276:
-#line 1432 "SrvParser.y"
+case 299:
+#line 1540 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3144,8 +3344,8 @@ case 276:
 
 ;
     break;}
-case 277:
-#line 1441 "SrvParser.y"
+case 300:
+#line 1549 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3154,27 +3354,27 @@ case 277:
     NodeClientClassLst.append(new NodeOperator(NodeOperator::OPERATOR_OR,l,r));
 ;
     break;}
-case 278:
-#line 1452 "SrvParser.y"
+case 301:
+#line 1560 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_SPEC_ENTERPRISE_NUM));
 ;
     break;}
-case 279:
-#line 1456 "SrvParser.y"
+case 302:
+#line 1564 "SrvParser.y"
 {
     NodeClientClassLst.append(new NodeClientSpecific(NodeClientSpecific::CLIENT_VENDOR_SPEC_DATA));
 ;
     break;}
-case 280:
-#line 1460 "SrvParser.y"
+case 303:
+#line 1568 "SrvParser.y"
 {
     // Log(Info) << "Constant expression found:" <<string($1)<<LogEnd;
     NodeClientClassLst.append(new NodeConstant(string(yyvsp[0].strval)));
 ;
     break;}
-case 281:
-#line 1465 "SrvParser.y"
+case 304:
+#line 1573 "SrvParser.y"
 {
     //Log(Info) << "Constant expression found:" <<string($1)<<LogEnd;
     stringstream convert;
@@ -3184,8 +3384,8 @@ case 281:
     NodeClientClassLst.append(new NodeConstant(snum));
 ;
     break;}
-case 282:
-#line 1474 "SrvParser.y"
+case 305:
+#line 1582 "SrvParser.y"
 {
     SPtr<Node> l =  NodeClientClassLst.getLast();
     NodeClientClassLst.delLast();
@@ -3396,7 +3596,7 @@ YYLABEL(yyerrhandle)
 /* END */
 
  #line 1038 "../bison++/bison.cc"
-#line 1480 "SrvParser.y"
+#line 1588 "SrvParser.y"
 
 
 /////////////////////////////////////////////////////////////////////////////
@@ -316,60 +316,73 @@ typedef
 #define	CLNT_MAX_LEASE_	299
 #define	STATELESS_	300
 #define	CACHE_SIZE_	301
-#define	PDCLASS_	302
-#define	PD_LENGTH_	303
-#define	PD_POOL_	304
-#define	SCRIPT_	305
-#define	VENDOR_SPEC_	306
-#define	CLIENT_	307
-#define	DUID_KEYWORD_	308
-#define	REMOTE_ID_	309
-#define	ADDRESS_	310
-#define	GUESS_MODE_	311
-#define	INACTIVE_MODE_	312
-#define	EXPERIMENTAL_	313
-#define	ADDR_PARAMS_	314
-#define	REMOTE_AUTOCONF_NEIGHBORS_	315
-#define	AFTR_	316
-#define	AUTH_METHOD_	317
-#define	AUTH_LIFETIME_	318
-#define	AUTH_KEY_LEN_	319
-#define	DIGEST_NONE_	320
-#define	DIGEST_PLAIN_	321
-#define	DIGEST_HMAC_MD5_	322
-#define	DIGEST_HMAC_SHA1_	323
-#define	DIGEST_HMAC_SHA224_	324
-#define	DIGEST_HMAC_SHA256_	325
-#define	DIGEST_HMAC_SHA384_	326
-#define	DIGEST_HMAC_SHA512_	327
-#define	ACCEPT_LEASEQUERY_	328
-#define	BULKLQ_ACCEPT_	329
-#define	BULKLQ_TCPPORT_	330
-#define	BULKLQ_MAX_CONNS_	331
-#define	BULKLQ_TIMEOUT_	332
-#define	CLIENT_CLASS_	333
-#define	MATCH_IF_	334
-#define	EQ_	335
-#define	AND_	336
-#define	OR_	337
-#define	CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_	338
-#define	CLIENT_VENDOR_SPEC_DATA_	339
-#define	CLIENT_VENDOR_CLASS_EN_	340
-#define	CLIENT_VENDOR_CLASS_DATA_	341
-#define	ALLOW_	342
-#define	DENY_	343
-#define	SUBSTRING_	344
-#define	STRING_KEYWORD_	345
-#define	ADDRESS_LIST_	346
-#define	CONTAIN_	347
-#define	NEXT_HOP_	348
-#define	ROUTE_	349
-#define	INFINITE_	350
-#define	STRING_	351
-#define	HEXNUMBER_	352
-#define	INTNUMBER_	353
-#define	IPV6ADDR_	354
-#define	DUID_	355
+#define	DUMP_INTERVAL_	302
+#define	OFFER_LIFETIME_	303
+#define	OFFER_LIMIT_	304
+#define	CLIENT_RATE_LIMIT_	305
+#define	LINK_RATE_LIMIT_	306
+#define	IFACE_RATE_LIMIT_	307
+#define	SOLICIT_EARLY_DROP_	308
+#define	REPLICATION_PORT_	309
+#define	REPLICATION_PEER_	310
+#define	PDCLASS_	311
+#define	PD_LENGTH_	312
+#define	PD_POOL_	313
+#define	SCRIPT_	314
+#define	SCRIPT_CONCURRENCY_	315
+#define	SCRIPT_QUEUE_SIZE_	316
+#define	SCRIPT_TIMEOUT_	317
+#define	SCRIPT_BATCH_	318
+#define	VENDOR_SPEC_	319
+#define	CLIENT_	320
+#define	DUID_KEYWORD_	321
+#define	REMOTE_ID_	322
+#define	ADDRESS_	323
+#define	GUESS_MODE_	324
+#define	INACTIVE_MODE_	325
+#define	EXPERIMENTAL_	326
+#define	ADDR_PARAMS_	327
+#define	REMOTE_AUTOCONF_NEIGHBORS_	328
+#define	AFTR_	329
+#define	AUTH_METHOD_	330
+#define	AUTH_LIFETIME_	331
+#define	AUTH_KEY_LEN_	332
+#define	DIGEST_NONE_	333
+#define	DIGEST_PLAIN_	334
+#define	DIGEST_HMAC_MD5_	335
+#define	DIGEST_HMAC_SHA1_	336
+#define	DIGEST_HMAC_SHA224_	337
+#define	DIGEST_HMAC_SHA256_	338
+#define	DIGEST_HMAC_SHA384_	339
+#define	DIGEST_HMAC_SHA512_	340
+#define	ACCEPT_LEASEQUERY_	341
+#define	BULKLQ_ACCEPT_	342
+#define	BULKLQ_TCPPORT_	343
+#define	BULKLQ_MAX_CONNS_	344
+#define	BULKLQ_TIMEOUT_	345
+#define	CLIENT_CLASS_	346
+#define	MATCH_IF_	347
+#define	EQ_	348
+#define	AND_	349
+#define	OR_	350
+#define	CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_	351
+#define	CLIENT_VENDOR_SPEC_DATA_	352
+#define	CLIENT_VENDOR_CLASS_EN_	353
+#define	CLIENT_VENDOR_CLASS_DATA_	354
+#define	ALLOW_	355
+#define	DENY_	356
+#define	SUBSTRING_	357
+#define	STRING_KEYWORD_	358
+#define	ADDRESS_LIST_	359
+#define	CONTAIN_	360
+#define	NEXT_HOP_	361
+#define	ROUTE_	362
+#define	INFINITE_	363
+#define	STRING_	364
+#define	HEXNUMBER_	365
+#define	INTNUMBER_	366
+#define	IPV6ADDR_	367
+#define	DUID_	368
 
 
 #line 169 "../bison++/bison.h"
@@ -462,10 +475,23 @@ static const int CLASS_MAX_LEASE_;
 static const int CLNT_MAX_LEASE_;
 static const int STATELESS_;
 static const int CACHE_SIZE_;
+static const int DUMP_INTERVAL_;
+static const int OFFER_LIFETIME_;
+static const int OFFER_LIMIT_;
+static const int CLIENT_RATE_LIMIT_;
+static const int LINK_RATE_LIMIT_;
+static const int IFACE_RATE_LIMIT_;
+static const int SOLICIT_EARLY_DROP_;
+static const int REPLICATION_PORT_;
+static const int REPLICATION_PEER_;
 static const int PDCLASS_;
 static const int PD_LENGTH_;
 static const int PD_POOL_;
 static const int SCRIPT_;
+static const int SCRIPT_CONCURRENCY_;
+static const int SCRIPT_QUEUE_SIZE_;
+static const int SCRIPT_TIMEOUT_;
+static const int SCRIPT_BATCH_;
 static const int VENDOR_SPEC_;
 static const int CLIENT_;
 static const int DUID_KEYWORD_;
@@ -568,60 +594,73 @@ static const int DUID_;
 	,CLNT_MAX_LEASE_=299
 	,STATELESS_=300
 	,CACHE_SIZE_=301
-	,PDCLASS_=302
-	,PD_LENGTH_=303
-	,PD_POOL_=304
-	,SCRIPT_=305
-	,VENDOR_SPEC_=306
-	,CLIENT_=307
-	,DUID_KEYWORD_=308
-	,REMOTE_ID_=309
-	,ADDRESS_=310
-	,GUESS_MODE_=311
-	,INACTIVE_MODE_=312
-	,EXPERIMENTAL_=313
-	,ADDR_PARAMS_=314
-	,REMOTE_AUTOCONF_NEIGHBORS_=315
-	,AFTR_=316
-	,AUTH_METHOD_=317
-	,AUTH_LIFETIME_=318
-	,AUTH_KEY_LEN_=319
-	,DIGEST_NONE_=320
-	,DIGEST_PLAIN_=321
-	,DIGEST_HMAC_MD5_=322
-	,DIGEST_HMAC_SHA1_=323
-	,DIGEST_HMAC_SHA224_=324
-	,DIGEST_HMAC_SHA256_=325
-	,DIGEST_HMAC_SHA384_=326
-	,DIGEST_HMAC_SHA512_=327
-	,ACCEPT_LEASEQUERY_=328
-	,BULKLQ_ACCEPT_=329
-	,BULKLQ_TCPPORT_=330
-	,BULKLQ_MAX_CONNS_=331
-	,BULKLQ_TIMEOUT_=332
-	,CLIENT_CLASS_=333
-	,MATCH_IF_=334
-	,EQ_=335
-	,AND_=336
-	,OR_=337
-	,CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=338
-	,CLIENT_VENDOR_SPEC_DATA_=339
-	,CLIENT_VENDOR_CLASS_EN_=340
-	,CLIENT_VENDOR_CLASS_DATA_=341
-	,ALLOW_=342
-	,DENY_=343
-	,SUBSTRING_=344
-	,STRING_KEYWORD_=345
-	,ADDRESS_LIST_=346
-	,CONTAIN_=347
-	,NEXT_HOP_=348
-	,ROUTE_=349
-	,INFINITE_=350
-	,STRING_=351
-	,HEXNUMBER_=352
-	,INTNUMBER_=353
-	,IPV6ADDR_=354
-	,DUID_=355
+	,DUMP_INTERVAL_=302
+	,OFFER_LIFETIME_=303
+	,OFFER_LIMIT_=304
+	,CLIENT_RATE_LIMIT_=305
+	,LINK_RATE_LIMIT_=306
+	,IFACE_RATE_LIMIT_=307
+	,SOLICIT_EARLY_DROP_=308
+	,REPLICATION_PORT_=309
+	,REPLICATION_PEER_=310
+	,PDCLASS_=311
+	,PD_LENGTH_=312
+	,PD_POOL_=313
+	,SCRIPT_=314
+	,SCRIPT_CONCURRENCY_=315
+	,SCRIPT_QUEUE_SIZE_=316
+	,SCRIPT_TIMEOUT_=317
+	,SCRIPT_BATCH_=318
+	,VENDOR_SPEC_=319
+	,CLIENT_=320
+	,DUID_KEYWORD_=321
+	,REMOTE_ID_=322
+	,ADDRESS_=323
+	,GUESS_MODE_=324
+	,INACTIVE_MODE_=325
+	,EXPERIMENTAL_=326
+	,ADDR_PARAMS_=327
+	,REMOTE_AUTOCONF_NEIGHBORS_=328
+	,AFTR_=329
+	,AUTH_METHOD_=330
+	,AUTH_LIFETIME_=331
+	,AUTH_KEY_LEN_=332
+	,DIGEST_NONE_=333
+	,DIGEST_PLAIN_=334
+	,DIGEST_HMAC_MD5_=335
+	,DIGEST_HMAC_SHA1_=336
+	,DIGEST_HMAC_SHA224_=337
+	,DIGEST_HMAC_SHA256_=338
+	,DIGEST_HMAC_SHA384_=339
+	,DIGEST_HMAC_SHA512_=340
+	,ACCEPT_LEASEQUERY_=341
+	,BULKLQ_ACCEPT_=342
+	,BULKLQ_TCPPORT_=343
+	,BULKLQ_MAX_CONNS_=344
+	,BULKLQ_TIMEOUT_=345
+	,CLIENT_CLASS_=346
+	,MATCH_IF_=347
+	,EQ_=348
+	,AND_=349
+	,OR_=350
+	,CLIENT_VENDOR_SPEC_ENTERPRISE_NUM_=351
+	,CLIENT_VENDOR_SPEC_DATA_=352
+	,CLIENT_VENDOR_CLASS_EN_=353
+	,CLIENT_VENDOR_CLASS_DATA_=354
+	,ALLOW_=355
+	,DENY_=356
+	,SUBSTRING_=357
+	,STRING_KEYWORD_=358
+	,ADDRESS_LIST_=359
+	,CONTAIN_=360
+	,NEXT_HOP_=361
+	,ROUTE_=362
+	,INFINITE_=363
+	,STRING_=364
+	,HEXNUMBER_=365
+	,INTNUMBER_=366
+	,IPV6ADDR_=367
+	,DUID_=368
 
 
 #line 215 "../bison++/bison.h"
@@ -108,9 +108,12 @@ virtual ~SrvParser();
 %token UNICAST_,PREFERENCE_,RAPID_COMMIT_
 %token IFACE_MAX_LEASE_, CLASS_MAX_LEASE_, CLNT_MAX_LEASE_
 %token STATELESS_
-%token CACHE_SIZE_
+%token CACHE_SIZE_, DUMP_INTERVAL_, OFFER_LIFETIME_, OFFER_LIMIT_
+%token CLIENT_RATE_LIMIT_, LINK_RATE_LIMIT_, IFACE_RATE_LIMIT_, SOLICIT_EARLY_DROP_
+%token REPLICATION_PORT_, REPLICATION_PEER_
 %token PDCLASS_, PD_LENGTH_, PD_POOL_
 %token SCRIPT_
+%token SCRIPT_CONCURRENCY_, SCRIPT_QUEUE_SIZE_, SCRIPT_TIMEOUT_, SCRIPT_BATCH_
 %token VENDOR_SPEC_
 %token CLIENT_, DUID_KEYWORD_, REMOTE_ID_, ADDRESS_, GUESS_MODE_
 %token INACTIVE_MODE_
@@ -169,6 +172,12 @@ GlobalOption
 | WorkDirOption
 | StatelessOption
 | CacheSizeOption
+| DumpIntervalOption
+| OfferLifetimeOption
+| OfferLimitOption
+| RateLimitOption
+| SolicitEarlyDrop
+| ReplicationOption
 | AuthMethod
 | AuthLifetime
 | AuthKeyGenNonceLen
@@ -180,6 +189,7 @@ GlobalOption
 | GuessMode
 | ClientClass
 | ScriptName
+| ScriptOption
 ;
 
 
@@ -967,6 +977,40 @@ ScriptName
     CfgMgr->setScriptName($2);
 };
 
+ScriptOption
+: SCRIPT_CONCURRENCY_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-concurrency must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptConcurrency($2);
+}
+| SCRIPT_QUEUE_SIZE_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-queue-size must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptQueueSize($2);
+}
+| SCRIPT_TIMEOUT_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-timeout must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptTimeout($2);
+}
+| SCRIPT_BATCH_ Number
+{
+    if (!$2) {
+	Log(Crit) << "script-batch must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    CfgMgr->setScriptBatch($2);
+};
+
 
 InactiveMode
 : INACTIVE_MODE_
@@ -1009,6 +1053,70 @@ CacheSizeOption
 }
 ;
 
+DumpIntervalOption
+: DUMP_INTERVAL_ Number
+{
+    ParserOptStack.getLast()->setLeaseDumpInterval($2);
+}
+;
+
+OfferLifetimeOption
+: OFFER_LIFETIME_ Number
+{
+    ParserOptStack.getLast()->setOfferLifetime($2);
+}
+;
+
+OfferLimitOption
+: OFFER_LIMIT_ Number
+{
+    if (!$2) {
+	Log(Crit) << "offer-limit must be at least 1." << LogEnd;
+	YYABORT;
+    }
+    ParserOptStack.getLast()->setOfferLimit($2);
+}
+;
+
+////////////////////////////////////////////////////////////////////////
+/// ADMISSION CONTROL //////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////
+
+RateLimitOption
+/* client-rate-limit 2 (messages per second, burst equal to rate) */
+: CLIENT_RATE_LIMIT_ Number        { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_CLIENT, $2, 0); }
+| LINK_RATE_LIMIT_ Number          { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_LINK, $2, 0); }
+| IFACE_RATE_LIMIT_ Number         { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_IFACE, $2, 0); }
+/* client-rate-limit 2 10 (messages per second, burst) */
+| CLIENT_RATE_LIMIT_ Number Number { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_CLIENT, $2, $3); }
+| LINK_RATE_LIMIT_ Number Number   { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_LINK, $2, $3); }
+| IFACE_RATE_LIMIT_ Number Number  { ParserOptStack.getLast()->setRateLimit(SRV_RATE_LIMIT_IFACE, $2, $3); }
+;
+
+SolicitEarlyDrop
+: SOLICIT_EARLY_DROP_ Number
+{
+    ParserOptStack.getLast()->setSolicitEarlyDrop($2);
+}
+;
+
+////////////////////////////////////////////////////////////////////////
+/// LEASE REPLICATION //////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////
+
+ReplicationOption
+/* replication-port 5470 (listen for replication stream from peer) */
+: REPLICATION_PORT_ Number
+{
+    ParserOptStack.getLast()->setReplicationPort($2);
+}
+/* replication-peer 2001:db8::2 5470 (send our leases to peer) */
+| REPLICATION_PEER_ IPV6ADDR_ Number
+{
+    ParserOptStack.getLast()->setReplicationPeer(new TIPv6Addr($2), $3);
+}
+;
+
 ////////////////////////////////////////////////////////////////////////
 /// LEASE-QUERY (regular and bulk) /////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////
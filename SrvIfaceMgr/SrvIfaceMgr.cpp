@@ -18,6 +18,9 @@
 #include "Msg.h"
 #include "SrvMsg.h"
 #include "Logger.h"
+#include "StatsMgr.h"
+#include "SrvReplMgr.h"
+#include "DNSUpdate.h"
 #include "SrvMsgSolicit.h"
 #include "SrvMsgRequest.h"
 #include "SrvMsgConfirm.h"
@@ -46,12 +49,16 @@ TSrvIfaceMgr * TSrvIfaceMgr::Instance = 0;
  * constructor.
  */
 TSrvIfaceMgr::TSrvIfaceMgr(const std::string& xmlFile)
-    : TIfaceMgr(xmlFile, false) {
+    : TIfaceMgr(xmlFile, false), RecvQueueSize(0), Worker(0), Workers(1), WorkerSkipped(0) {
 
     struct iface * ptr;
     struct iface * ifaceList;
 
     this->XmlFile = xmlFile;
+    for (int i=0; i<SRV_RECV_PRIO_MAX; i++) {
+        RecvDropped[i] = 0;
+        RecvStale[i] = 0;
+    }
 
     // get interface list
     ifaceList = if_list_get(); // external (C coded) function
@@ -84,6 +91,7 @@ TSrvIfaceMgr::TSrvIfaceMgr(const std::string& xmlFile)
     }
     if_list_release(ifaceList); // allocated in pure C, and so release it there
 
+    trackIfaceEvents();
 }
 
 TSrvIfaceMgr::~TSrvIfaceMgr() {
@@ -133,7 +141,10 @@ bool TSrvIfaceMgr::send(int iface, char *msg, int size,
     }
 
     // send it!
-    return (sock->send(msg,size,addr,port));
+    if (sock->send(msg,size,addr,port) < 0)
+        return false;
+    ptrIface->countTx(msg[0]);
+    return true;
 }
 
 /**
@@ -142,22 +153,276 @@ bool TSrvIfaceMgr::send(int iface, char *msg, int size,
  * @param timeout - how long can we wait for packets?
  * returns SPtr to message object
  */
+/**
+ * @brief returns next message to be processed
+ *
+ * All packets waiting on sockets are read into receive queue first. Then the
+ * most important one is decoded and returned: RENEW, REBIND, CONFIRM, RELEASE
+ * and DECLINE (keeping existing clients alive) go before REQUEST, which goes
+ * before SOLICIT and INFORMATION-REQUEST. Packets that waited in the queue for
+ * too long are dropped (client has retransmitted them already). Several
+ * packets are decoded at once, so their digests can be checked together.
+ *
+ * @param timeout max. time to wait (used only if there is nothing queued)
+ *
+ * @return decoded message (or 0 if nothing valid was received)
+ */
 SPtr<TSrvMsg> TSrvIfaceMgr::select(unsigned long timeout) {
+    if (Decoded.empty()) {
+        receive(RecvQueueSize ? 0 : timeout);
+        decodeBatch();
+    }
+
+    if (Decoded.empty())
+        return 0;
+    SPtr<TSrvMsg> msg = Decoded.front();
+    Decoded.pop_front();
+    return msg;
+}
+
+/**
+ * @brief decodes several packets from receive queue
+ *
+ * Authentication Information of all of them is calculated in one pass (see
+ * TMsg::calculateAuthInfo()), then they are validated one by one, in order.
+ */
+void TSrvIfaceMgr::decodeBatch() {
+    TRecvPacket pkts[SERVER_DEFAULT_DECODE_BATCH];
+    SPtr<TSrvMsg> msgs[SERVER_DEFAULT_DECODE_BATCH];
+    TMsg * batch[SERVER_DEFAULT_DECODE_BATCH];
+    char * bufs[SERVER_DEFAULT_DECODE_BATCH];
+    int sizes[SERVER_DEFAULT_DECODE_BATCH];
+    int count = 0;
+
+    while (count < SERVER_DEFAULT_DECODE_BATCH && dequeue(pkts[count])) {
+        TRecvPacket & pkt = pkts[count];
+        bufs[count] = pkt.Data.empty() ? 0 : &pkt.Data[0];
+        sizes[count] = pkt.Data.size();
+        msgs[count] = decodePacket(pkt.SockID, pkt.Peer, bufs[count], sizes[count]);
+        if (!msgs[count])
+            continue;
+        batch[count] = &(*msgs[count]);
+        count++;
+    }
+    if (!count)
+        return;
+
+    TMsg::calculateAuthInfo(batch, bufs, sizes, count);
+
+    for (int i=0; i<count; i++) {
+        if (!msgs[i]->validateReplayDetection() ||
+            !msgs[i]->validateAuthInfo(bufs[i], sizes[i])) {
+            Log(Error) << "Auth: Authorization failed, message dropped." << LogEnd;
+            StatsMgr().AuthFailures++;
+            continue;
+        }
+        Decoded.push_back(msgs[i]);
+    }
+}
+
+/**
+ * @brief determines message priority, based on message type only
+ *
+ * Relayed messages are classified by the type of the innermost message.
+ *
+ * @param buf message (as received)
+ * @param bufsize message length
+ *
+ * @return priority
+ */
+ESrvRecvPrio TSrvIfaceMgr::classifyMsg(const char * buf, int bufsize) {
+    for (int hop=0; bufsize>0 && buf[0]==RELAY_FORW_MSG; hop++) {
+        if (hop == HOP_COUNT_LIMIT || bufsize < 34)
+            return SRV_RECV_PRIO_LOW;
+        buf += 34;
+        bufsize -= 34;
+
+        // find RELAY_MSG option
+        bool found = false;
+        while (bufsize >= 4 && !found) {
+            unsigned short code = readUint16(buf);
+            unsigned short len  = readUint16(buf + sizeof(uint16_t));
+            buf += 2*sizeof(uint16_t);
+            bufsize -= 2*sizeof(uint16_t);
+            if (len > bufsize)
+                return SRV_RECV_PRIO_LOW;
+            if (code == OPTION_RELAY_MSG) {
+                bufsize = len;
+                found = true;
+            } else {
+                buf += len;
+                bufsize -= len;
+            }
+        }
+        if (!found)
+            return SRV_RECV_PRIO_LOW;
+    }
+
+    if (bufsize <= 0)
+        return SRV_RECV_PRIO_LOW;
 
+    switch (buf[0]) {
+    case RENEW_MSG:
+    case REBIND_MSG:
+    case CONFIRM_MSG:
+    case RELEASE_MSG:
+    case DECLINE_MSG:
+        return SRV_RECV_PRIO_HIGH;
+    case REQUEST_MSG:
+    case LEASEQUERY_MSG:
+        return SRV_RECV_PRIO_NORMAL;
+    default:
+        return SRV_RECV_PRIO_LOW;
+    }
+}
+
+/// reads all packets waiting on sockets into receive queue
+void TSrvIfaceMgr::receive(unsigned long timeout) {
     // static buffer speeds things up
     const int maxBufsize = 4096;
-    int bufsize=maxBufsize;
     static char buf[maxBufsize];
 
-    SPtr<TIPv6Addr> peer (new TIPv6Addr());
-    int sockid;
+    for (int i=0; i<SERVER_DEFAULT_RECV_QUEUE_SIZE; i++) {
+        int bufsize = maxBufsize;
+        SPtr<TIPv6Addr> peer (new TIPv6Addr());
+        int sockid = TIfaceMgr::select(i ? 0 : timeout, buf, bufsize, peer);
+        if (sockid <= 0)
+            break;
+        if (Workers > 1 && steer_key(buf, bufsize) % Workers != (unsigned int)Worker) {
+            // every worker receives multicast, the same client is picked as kernel does for unicast
+            SPtr<TIfaceIface> iface = getIfaceBySocket(sockid);
+            SPtr<TIfaceSocket> sock = iface ? iface->getSocketByFD(sockid) : 0;
+            if (sock && sock->multicast()) {
+                WorkerSkipped++;
+                continue;
+            }
+        }
+        enqueue(sockid, peer, buf, bufsize);
+    }
+}
+
+int TSrvIfaceMgr::selectAddFDs(fd_set * rd, fd_set * wr) {
+    int maxFD = SrvReplMgr().addFDs(rd, wr);
+    int dnsFD = DNSUpdate::addFDs(rd, wr);
+    return dnsFD > maxFD ? dnsFD : maxFD;
+}
+
+int TSrvIfaceMgr::selectProcessFDs(fd_set * rd, fd_set * wr) {
+    return SrvReplMgr().processFDs(rd, wr) + DNSUpdate::processFDs(rd, wr);
+}
+
+/// expires DNS updates the DNS server did not answer in time
+void TSrvIfaceMgr::doDuties() {
+    DNSUpdate::doDuties();
+}
+
+/// @return seconds until the next DNS update in progress times out
+unsigned int TSrvIfaceMgr::getTimeout() {
+    return DNSUpdate::getTimeout();
+}
+
+/// waits for DNS updates in progress to finish (used on shutdown)
+void TSrvIfaceMgr::flushDNSUpdates() {
+    DNSUpdate::flush();
+}
+
+void TSrvIfaceMgr::enqueue(int sockid, SPtr<TIPv6Addr> peer, char * buf, int bufsize) {
+    int prio = classifyMsg(buf, bufsize);
+
+    if (RecvQueueSize >= SERVER_DEFAULT_RECV_QUEUE_SIZE) {
+        // make room by dropping the oldest of the least important packets
+        int victim = SRV_RECV_PRIO_MAX - 1;
+        while (victim > prio && RecvQueue[victim].empty())
+            victim--;
+        if (RecvQueue[victim].empty()) {
+            Log(Debug) << "Receive queue full, dropping received packet." << LogEnd;
+            RecvDropped[prio]++;
+            return;
+        }
+        Log(Debug) << "Receive queue full, dropping queued packet." << LogEnd;
+        RecvQueue[victim].pop_front();
+        RecvQueueSize--;
+        RecvDropped[victim]++;
+    }
+
+    TRecvPacket pkt;
+    pkt.SockID = sockid;
+    pkt.Peer = peer;
+    pkt.Received = now_ms();
+    RecvQueue[prio].push_back(pkt);
+    RecvQueue[prio].back().Data.assign(buf, buf + bufsize);
+    RecvQueueSize++;
+}
+
+/// takes the oldest not stale packet of the highest priority from receive queue
+bool TSrvIfaceMgr::dequeue(TRecvPacket & pkt) {
+    unsigned long long now = now_ms();
+    for (int prio=0; prio<SRV_RECV_PRIO_MAX; prio++) {
+        while (!RecvQueue[prio].empty()) {
+            unsigned long long age = now - RecvQueue[prio].front().Received;
+            if (age <= SERVER_DEFAULT_RECV_QUEUE_MAX_AGE)
+                pkt = RecvQueue[prio].front();
+            RecvQueue[prio].pop_front();
+            RecvQueueSize--;
+            if (age <= SERVER_DEFAULT_RECV_QUEUE_MAX_AGE)
+                return true;
+            Log(Debug) << "Received packet waited for " << age
+                       << "ms in receive queue, dropped." << LogEnd;
+            RecvStale[prio]++;
+        }
+    }
+    return false;
+}
+
+void TSrvIfaceMgr::printStats(std::ostream & out) {
+    static const char * prioName[SRV_RECV_PRIO_MAX] = { "high", "normal", "low" };
+
+    TIfaceMgr::printStats(out);
+    TStatsMgr::printType(out, "dibbler_recv_queue_length", "gauge",
+                         "Received packets waiting to be processed.");
+    for (int i=0; i<SRV_RECV_PRIO_MAX; i++)
+        out << "dibbler_recv_queue_length{prio=\"" << prioName[i] << "\"} " << RecvQueue[i].size() << endl;
+    TStatsMgr::printType(out, "dibbler_recv_queue_dropped_total", "counter",
+                         "Received packets dropped from receive queue (full or stale).");
+    for (int i=0; i<SRV_RECV_PRIO_MAX; i++) {
+        out << "dibbler_recv_queue_dropped_total{prio=\"" << prioName[i] << "\",reason=\"full\"} "
+            << RecvDropped[i] << endl;
+        out << "dibbler_recv_queue_dropped_total{prio=\"" << prioName[i] << "\",reason=\"stale\"} "
+            << RecvStale[i] << endl;
+    }
+    if (Workers > 1) {
+        TStatsMgr::printType(out, "dibbler_worker_skipped_total", "counter",
+                             "Multicast packets left for other workers.");
+        out << "dibbler_worker_skipped_total " << WorkerSkipped << endl;
+    }
+}
+
+/**
+ * sets worker index (called in every worker process, after it was started)
+ *
+ * @param index index of this worker
+ * @param count number of workers
+ */
+void TSrvIfaceMgr::setWorker(int index, int count) {
+    Worker = index;
+    Workers = count;
+
+    // notification socket was opened before fork, each worker needs its own
+    if (index && EventsFD >= 0) {
+        iface_events_close(EventsFD);
+        EventsFD = -1;
+        trackIfaceEvents();
+    }
+}
+
+/// decodes received packet (dropping invalid or unexpected ones)
+SPtr<TSrvMsg> TSrvIfaceMgr::decodePacket(int sockid, SPtr<TIPv6Addr> peer, char * buf, int bufsize) {
     int msgtype;
 
-    // read data
-    sockid = TIfaceMgr::select(timeout,buf,bufsize,peer);
     if (sockid>0) {
         if (bufsize<4) {
             Log(Warning) << "Received message is too short (" << bufsize << ") bytes." << LogEnd;
+            StatsMgr().DecodeErrors++;
             return 0; //NULL
         }
 
@@ -186,22 +451,14 @@ SPtr<TSrvMsg> TSrvIfaceMgr::select(unsigned long timeout) {
         case INFORMATION_REQUEST_MSG:
         case LEASEQUERY_MSG:
         {
-            ptr = this->decodeMsg(ptrIface, peer, buf, bufsize);
-            if (!ptr->validateReplayDetection() ||
-                !ptr->validateAuthInfo(buf, bufsize)) {
-                Log(Error) << "Auth: Authorization failed, message dropped." << LogEnd;
-                return 0;
-            }
-            return ptr;
+            // replay detection and authentication are checked in decodeBatch()
+            return this->decodeMsg(ptrIface, peer, buf, bufsize);
         }
         case RELAY_FORW_MSG:
         {
             ptr = this->decodeRelayForw(ptrIface, peer, buf, bufsize);
-            if (!ptr)
-                return 0;
-            if (!ptr->validateReplayDetection() ||
-                !ptr->validateAuthInfo(buf, bufsize)) {
-                Log(Error) << "Auth: validation failed, message dropped." << LogEnd;
+            if (!ptr) {
+                StatsMgr().DecodeErrors++;
                 return 0;
             }
         }
@@ -215,6 +472,7 @@ SPtr<TSrvMsg> TSrvIfaceMgr::select(unsigned long timeout) {
             return 0; //NULL;
         default:
             Log(Warning) << "Message type " << msgtype << " not supported. Ignoring." << LogEnd;
+            StatsMgr().DecodeErrors++;
             return 0; //NULL
         }
     } else {
@@ -480,34 +738,6 @@ SPtr<TSrvMsg> TSrvIfaceMgr::decodeMsg(SPtr<TSrvIfaceIface> ptrIface,
     }
 }
 
-/**
- * Compares current flags of interfaces with old flags. If change is detected,
- * stored flags of the interface are updated
- */
-void TSrvIfaceMgr::redetectIfaces() {
-    struct iface  * ptr;
-    struct iface  * ifaceList;
-    SPtr<TIfaceIface> iface;
-    ifaceList = if_list_get(); // external (C coded) function
-    ptr = ifaceList;
-
-    if  (!ifaceList) {
-        Log(Error) << "Unable to read interface info. Inactive mode failed." << LogEnd;
-        return;
-    }
-    while (ptr!=NULL) {
-        iface = getIfaceByID(ptr->id);
-        if (iface && (ptr->flags!=iface->getFlags())) {
-            Log(Notice) << "Flags on interface " << iface->getFullName() << " has changed (old=" << hex <<iface->getFlags()
-                        << ", new=" << ptr->flags << ")." << dec << LogEnd;
-            iface->updateState(ptr);
-        }
-        ptr = ptr->next;
-    }
-
-    if_list_release(ifaceList); // allocated in pure C, and so release it there
-}
-
 void TSrvIfaceMgr::instanceCreate( const std::string xmlDumpFile )
 {
     if (Instance) {
@@ -12,6 +12,8 @@
 #ifndef SRVIFACEMGR_H
 #define SRVIFACEMGR_H
 
+#include <deque>
+#include <vector>
 #include "SmartPtr.h"
 #include "IfaceMgr.h"
 #include "SrvIfaceIface.h"
@@ -19,6 +21,14 @@
 
 #define SrvIfaceMgr() (TSrvIfaceMgr::instance())
 
+/// order in which received messages are processed
+typedef enum {
+    SRV_RECV_PRIO_HIGH,   // RENEW, REBIND, CONFIRM, RELEASE, DECLINE
+    SRV_RECV_PRIO_NORMAL, // REQUEST, LEASEQUERY
+    SRV_RECV_PRIO_LOW,    // SOLICIT, INFORMATION-REQUEST (and anything else)
+    SRV_RECV_PRIO_MAX
+} ESrvRecvPrio;
+
 class TSrvIfaceMgr :public TIfaceMgr {
  public:
    static void instanceCreate(const std::string xmlDumpFile);
@@ -44,14 +54,52 @@ class TSrvIfaceMgr :public TIfaceMgr {
    
    // ---receives messages---
    SPtr<TSrvMsg> select(unsigned long timeout);
-   
-   void redetectIfaces();
-   
+   static ESrvRecvPrio classifyMsg(const char * buf, int bufsize);
+
+   void printStats(std::ostream & out);
+
+   // server runs in several worker processes
+   void setWorker(int index, int count);
+
+   // DNS updates in progress (TCP updates do not wait for the answer)
+   void doDuties();
+   unsigned int getTimeout();
+   void flushDNSUpdates();
+
+protected:
+   // lease replication and DNS update connections are handled in the same select() loop
+   int selectAddFDs(fd_set * rd, fd_set * wr);
+   int selectProcessFDs(fd_set * rd, fd_set * wr);
+
 private:
    TSrvIfaceMgr(const std::string& xmlFile);
    static TSrvIfaceMgr * Instance;
-   
+
+   /// packet read from socket, but not decoded yet
+   struct TRecvPacket {
+       int SockID;
+       SPtr<TIPv6Addr> Peer;
+       std::vector<char> Data;
+       unsigned long long Received; // ms timestamp
+   };
+
+   void receive(unsigned long timeout);
+   void enqueue(int sockid, SPtr<TIPv6Addr> peer, char * buf, int bufsize);
+   bool dequeue(TRecvPacket & pkt);
+   void decodeBatch();
+   SPtr<TSrvMsg> decodePacket(int sockid, SPtr<TIPv6Addr> peer, char * buf, int bufsize);
+
    std::string XmlFile;
+
+   std::deque<TRecvPacket> RecvQueue[SRV_RECV_PRIO_MAX];
+   unsigned int RecvQueueSize;
+   unsigned long RecvDropped[SRV_RECV_PRIO_MAX]; // dropped, because queue was full
+   unsigned long RecvStale[SRV_RECV_PRIO_MAX];   // dropped, because waited too long
+   std::deque< SPtr<TSrvMsg> > Decoded;          // decoded and validated, not returned yet
+
+   int Worker;                  // index of this worker process
+   int Workers;                 // number of workers (1 = no workers)
+   unsigned long WorkerSkipped; // multicast packets left for other workers
 };
 
 #endif 
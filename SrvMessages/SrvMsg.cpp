@@ -271,13 +271,24 @@ int TSrvMsg::getRelayCount() {
     return this->Relays;
 }
 
+SPtr<TIPv6Addr> TSrvMsg::getLinkAddr(int relay) {
+    if (relay < 0 || relay >= Relays)
+	return 0;
+    return LinkAddrTbl[relay];
+}
+
+SPtr<TSrvOptInterfaceID> TSrvMsg::getInterfaceID(int relay) {
+    if (relay < 0 || relay >= Relays)
+	return 0;
+    return InterfaceIDTbl[relay];
+}
+
 void TSrvMsg::send()
 {
     static char buf[2048];
     int offset = 0;
     int port;
 
-    SPtr<TOptGeneric> gen;
     SPtr<TSrvIfaceIface> ptrIface;
     SPtr<TSrvIfaceIface> under;
     ptrIface = (Ptr*) SrvIfaceMgr().getIfaceByID(this->Iface);
@@ -298,23 +309,9 @@ void TSrvMsg::send()
 	    return;
 	}
 
-	// calculate lengths of all relays
-	len[Relays-1]=this->getSize();
-	for (int i=this->Relays-1; i>0; i--) {
-	    len[i-1]= len[i] + 38; // 34 bytes (relay header) + 4 bytes (relay-msg option header)
-	    if (this->InterfaceIDTbl[i] && (SrvCfgMgr().getInterfaceIDOrder()!=SRV_IFACE_ID_ORDER_NONE)) {
-		len[i-1]+=this->InterfaceIDTbl[i]->getSize();
-
-		EchoListTbl[i].first();
-		while (gen = EchoListTbl[i].get()) {
-		    len[i-1] += gen->getSize();
-		}
-
-	    }
-	}
-
-	// recursive storeSelf
-	offset += storeSelfRelay(buf, 0, SrvCfgMgr().getInterfaceIDOrder() );
+	// recursive storeSelf (relay-msg lengths are filled in on the way back)
+	int msgLen = 0;
+	offset += storeSelfRelay(buf, 0, SrvCfgMgr().getInterfaceIDOrder(), msgLen);
 
 	// check if there are underlaying interfaces
 	for (int i=0; i < this->Relays; i++) {
@@ -326,7 +323,7 @@ void TSrvMsg::send()
 	    }
 	    ptrIface = under;
 	}
-	Log(Debug) << "Sending " << this->getSize() << "(packet)+" << offset << "(relay headers) data on the "
+	Log(Debug) << "Sending " << msgLen << "(packet)+" << (offset - msgLen) << "(relay headers) data on the "
 		   << ptrIface->getFullName() << " interface." << LogEnd;
     } else {
 	offset += this->storeSelf(buf+offset);
@@ -366,14 +363,16 @@ void TSrvMsg::copyRelayInfo(SPtr<TSrvMsg> q) {
  * @param buf buffer for data to be stored
  * @param relayDepth number or current relay level
  * @param order order of the interface-id option (before, after or omit)
+ * @param msgLen length of the message itself (without relay headers) will be stored here
  * 
  * @return - number of bytes used
  */
-int TSrvMsg::storeSelfRelay(char * buf, int relayDepth, ESrvIfaceIdOrder order)
+int TSrvMsg::storeSelfRelay(char * buf, int relayDepth, ESrvIfaceIdOrder order, int & msgLen)
 {
     int offset = 0;
     if (relayDepth == this->Relays) {
-	return storeSelf(buf);
+	msgLen = storeSelf(buf);
+	return msgLen;
     }
     buf[offset++] = RELAY_REPL_MSG;
     buf[offset++] = HopTbl[relayDepth];
@@ -384,32 +383,30 @@ int TSrvMsg::storeSelfRelay(char * buf, int relayDepth, ESrvIfaceIdOrder order)
     if (order == SRV_IFACE_ID_ORDER_BEFORE)
     {
 	if (InterfaceIDTbl[relayDepth]) {
-	    InterfaceIDTbl[relayDepth]->storeSelf(buf+offset);
-	    offset += InterfaceIDTbl[relayDepth]->getSize();
+	    offset = InterfaceIDTbl[relayDepth]->storeSelf(buf+offset) - buf;
 	}
     }
 
     writeUint16((buf+offset), OPTION_RELAY_MSG);
     offset += sizeof(uint16_t);
-    writeUint16((buf+offset), len[relayDepth]);
+    int len = storeSelfRelay(buf+offset+sizeof(uint16_t), relayDepth+1, order, msgLen);
+    writeUint16((buf+offset), len);
     offset += sizeof(uint16_t);
-
-    offset += storeSelfRelay(buf+offset, relayDepth+1, order);
+    offset += len;
 
     if (order == SRV_IFACE_ID_ORDER_AFTER)
     {
 	if (InterfaceIDTbl[relayDepth]) {
-	    InterfaceIDTbl[relayDepth]->storeSelf(buf+offset);
-	    offset += InterfaceIDTbl[relayDepth]->getSize();
+	    offset = InterfaceIDTbl[relayDepth]->storeSelf(buf+offset) - buf;
 	}
     }
 
     SPtr<TOptGeneric> gen;
     EchoListTbl[relayDepth].first();
     while (gen = EchoListTbl[relayDepth].get()) {
-	Log(Debug) << "Echoing back option " << gen->getOptType() << ", length " << gen->getSize() << LogEnd;
-	gen->storeSelf(buf+offset);
-	offset += gen->getSize();
+	char * end = gen->storeSelf(buf+offset);
+	Log(Debug) << "Echoing back option " << gen->getOptType() << ", length " << (end - buf - offset) << LogEnd;
+	offset = end - buf;
     }
     
     return offset;
@@ -518,119 +515,26 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
 
     SPtr<TSrvCfgOptions> ex = ptrIface->getClientException(duid, getRemoteID(), false/* false = verbose */);
 
-    // --- option: DNS resolvers ---
-    if ( reqOpts->isOption(OPTION_DNS_SERVERS) && ptrIface->supportDNSServer() ) {
-	SPtr<TOpt> optDNS;
-	if (ex && ex->supportDNSServer())
-	    optDNS = new TOptAddrLst(OPTION_DNS_SERVERS, *ex->getDNSServerLst(), this);
-	else
-	    optDNS = new TOptAddrLst(OPTION_DNS_SERVERS, *ptrIface->getDNSServerLst(), this);
-	Options.push_back(optDNS);
-	newOptionAssigned = true;
-    };
-
-    // --- option: DOMAIN LIST ---
-    if ( reqOpts->isOption(OPTION_DOMAIN_LIST) && ptrIface->supportDomain() ) {
-	SPtr<TOpt> optDomain;
-	if (ex && ex->supportDomain())
-	    optDomain = new TOptDomainLst(OPTION_DOMAIN_LIST, *ex->getDomainLst(),this);
-	else
-	    optDomain = new TOptDomainLst(OPTION_DOMAIN_LIST, *ptrIface->getDomainLst(),this);
-	Options.push_back((Ptr*)optDomain);
-	newOptionAssigned = true;
-    };
-    
-    // --- option: NTP servers ---
-    if ( reqOpts->isOption(OPTION_SNTP_SERVERS) && ptrIface->supportNTPServer() ) {
-	SPtr<TOpt> optNTP;
-	if (ex && ex->supportNTPServer())
-	    optNTP = new TOptAddrLst(OPTION_SNTP_SERVERS, *ex->getNTPServerLst(),this);
-	else
-	    optNTP = new TOptAddrLst(OPTION_SNTP_SERVERS, *ptrIface->getNTPServerLst(),this);
-	Options.push_back((Ptr*)optNTP);
-	newOptionAssigned = true;
-    };
-    
-    // --- option: TIMEZONE --- 
-    if ( reqOpts->isOption(OPTION_NEW_TZDB_TIMEZONE) && ptrIface->supportTimezone() ) {
-	SPtr<TSrvOptTimeZone> optTimezone;
-	if (ex && ex->supportTimezone())
-	    optTimezone = new TSrvOptTimeZone(ex->getTimezone(),this);
-	else
-	    optTimezone = new TSrvOptTimeZone(ptrIface->getTimezone(),this);
-	Options.push_back((Ptr*)optTimezone);
-	newOptionAssigned = true;
-    };
-
-    // --- option: SIP SERVERS ---
-    if ( reqOpts->isOption(OPTION_SIP_SERVER_A) && ptrIface->supportSIPServer() ) {
-	SPtr<TOpt> optSIPServer;
-	if (ex && ex->supportSIPServer())
-	    optSIPServer = new TOptAddrLst(OPTION_SIP_SERVER_A, *ex->getSIPServerLst(),this);
-	else
-	    optSIPServer = new TOptAddrLst(OPTION_SIP_SERVER_A, *ptrIface->getSIPServerLst(),this);
-	Options.push_back(optSIPServer);
-	newOptionAssigned = true;
-    };
-
-    // --- option: SIP DOMAINS ---
-    if ( reqOpts->isOption(OPTION_SIP_SERVER_D) && ptrIface->supportSIPDomain() ) {
-	SPtr<TOpt> optSIPDomain;
-	if (ex && ex->supportSIPDomain())
-	    optSIPDomain= new TOptDomainLst(OPTION_SIP_SERVER_D, *ex->getSIPDomainLst(),this);
-	else
-	    optSIPDomain= new TOptDomainLst(OPTION_SIP_SERVER_D, *ptrIface->getSIPDomainLst(),this);
-	Options.push_back(optSIPDomain);
-	newOptionAssigned = true;
-    };
+    // --- options: DNS, domains, NTP, timezone, SIP, NIS, NIS+ ---
+    // these are pre-encoded at config load, so only references are appended
+    static const int ConfiguredOpts[] = { OPTION_DNS_SERVERS, OPTION_DOMAIN_LIST,
+                                          OPTION_SNTP_SERVERS, OPTION_NEW_TZDB_TIMEZONE,
+                                          OPTION_SIP_SERVER_A, OPTION_SIP_SERVER_D,
+                                          OPTION_NIS_SERVERS, OPTION_NIS_DOMAIN_NAME,
+                                          OPTION_NISP_SERVERS, OPTION_NISP_DOMAIN_NAME };
+    for (unsigned int i = 0; i < sizeof(ConfiguredOpts)/sizeof(ConfiguredOpts[0]); ++i) {
+	if (!reqOpts->isOption(ConfiguredOpts[i]))
+	    continue;
+	SPtr<TOpt> opt = getConfiguredOption(ptrIface, ex, ConfiguredOpts[i]);
+	if (opt) {
+	    Options.push_back(opt);
+	    newOptionAssigned = true;
+	}
+    }
 
     // --- option: FQDN ---
     // see prepareFQDN() method
 
-    // --- option: NIS SERVERS ---
-    if ( reqOpts->isOption(OPTION_NIS_SERVERS) && ptrIface->supportNISServer() ) {
-	SPtr<TOpt> opt;
-	if (ex && ex->supportNISServer())
-	    opt = new TOptAddrLst(OPTION_NIS_SERVERS, *ex->getNISServerLst(),this);
-	else
-	    opt = new TOptAddrLst(OPTION_NIS_SERVERS, *ptrIface->getNISServerLst(),this);
-	Options.push_back(opt);
-	newOptionAssigned = true;
-    };
-
-    // --- option: NIS DOMAIN ---
-    if ( reqOpts->isOption(OPTION_NIS_DOMAIN_NAME) && ptrIface->supportNISDomain() ) {
-	SPtr<TOpt> opt;
-	if (ex && ex->supportNISDomain())
-	    opt = new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, ex->getNISDomain(),this);
-	else
-	    opt = new TOptDomainLst(OPTION_NIS_DOMAIN_NAME, ptrIface->getNISDomain(),this);
-	Options.push_back(opt);
-	newOptionAssigned = true;
-    };
-
-    // --- option: NISP SERVERS ---
-    if ( reqOpts->isOption(OPTION_NISP_SERVERS) && ptrIface->supportNISPServer() ) {
-	SPtr<TOpt> opt;
-	if (ex && ex->supportNISPServer())
-	    opt = new TOptAddrLst(OPTION_NISP_SERVERS, *ex->getNISPServerLst(), this);
-	else
-	    opt = new TOptAddrLst(OPTION_NISP_SERVERS, *ptrIface->getNISPServerLst(), this);
-	Options.push_back((Ptr*) opt);
-	newOptionAssigned = true;
-    };
-
-    // --- option: NISP DOMAIN ---
-    if ( reqOpts->isOption(OPTION_NISP_DOMAIN_NAME) && ptrIface->supportNISPDomain() ) {
-	SPtr<TOpt> opt;
-	if (ex && ex->supportNISPDomain())
-	    opt = new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, ex->getNISPDomain(), this);
-	else
-	    opt = new TOptDomainLst(OPTION_NISP_DOMAIN_NAME, ptrIface->getNISPDomain(), this);
-	Options.push_back((Ptr*)opt);
-	newOptionAssigned = true;
-    };
-
     // --- option: VENDOR SPEC ---
     if ( reqOpts->isOption(OPTION_VENDOR_OPTS)) {
 	if (appendVendorSpec(duid, iface, 0, reqOpts))
@@ -639,14 +543,10 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
 
     // --- option: INFORMATION_REFRESH_TIME ---
     // this option should be checked last 
-    if ( newOptionAssigned && ptrIface->supportLifetime() ) {
-	SPtr<TSrvOptLifetime> optLifetime;
-	if (ex && ex->supportLifetime())
-	    optLifetime = new TSrvOptLifetime(ex->getLifetime(), this);
-	else
-	    optLifetime = new TSrvOptLifetime(ptrIface->getLifetime(), this);
-	Options.push_back( (Ptr*)optLifetime);
-	newOptionAssigned = true;
+    if ( newOptionAssigned ) {
+	SPtr<TOpt> optLifetime = getConfiguredOption(ptrIface, ex, OPTION_INFORMATION_REFRESH_TIME);
+	if (optLifetime)
+	    Options.push_back(optLifetime);
     }
 
     // --- option: forced options first ---
@@ -696,6 +596,22 @@ bool TSrvMsg::appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr,
     return newOptionAssigned;
 }
 
+/**
+ * returns pre-encoded option configured for this client (or 0, if the
+ * interface does not support it). Per-client exception takes precedence
+ * over interface configuration
+ */
+SPtr<TOpt> TSrvMsg::getConfiguredOption(SPtr<TSrvCfgIface> iface, SPtr<TSrvCfgOptions> ex, int type)
+{
+    SPtr<TOpt> opt = iface->getEncodedOption(type);
+    if (opt && ex) {
+	SPtr<TOpt> exOpt = ex->getEncodedOption(type);
+	if (exOpt)
+	    opt = exOpt;
+    }
+    return opt;
+}
+
 /**
  * this function prints all options specified in the ORO option
  */
@@ -826,28 +742,16 @@ SPtr<TSrvOptFQDN> TSrvMsg::prepareFQDN(SPtr<TSrvOptFQDN> requestFQDN, SPtr<TDUID
 	
 	if (FQDNMode==1){
 	    /* add PTR only */
-	    DnsUpdateResult result = DNSUPDATE_SKIP;
-	    DNSUpdate *act = new DNSUpdate(DNSAddr->getPlain(), zoneroot, fqdnName, IPv6Addr->getPlain(), 
-					   DNSUPDATE_PTR, proto2);
-	    result = act->run(timeout);
-	    act->showResult(result);
-	    delete act;
+	    DNSUpdate::start(new DNSUpdate(DNSAddr->getPlain(), zoneroot, fqdnName, IPv6Addr->getPlain(), 
+					   DNSUPDATE_PTR, proto2), timeout);
 	} // fqdnMode == 1
 	else if (FQDNMode==2){
-	    DnsUpdateResult result = DNSUPDATE_SKIP;
-	    DNSUpdate *act = new DNSUpdate(DNSAddr->getPlain(), zoneroot, fqdnName, IPv6Addr->getPlain(), 
-					   DNSUPDATE_PTR, proto2);
-	    result = act->run(timeout);
-	    act->showResult(result);
-	    delete act;
+	    DNSUpdate::start(new DNSUpdate(DNSAddr->getPlain(), zoneroot, fqdnName, IPv6Addr->getPlain(), 
+					   DNSUPDATE_PTR, proto2), timeout);
       	    
-	    DnsUpdateResult result2 = DNSUPDATE_SKIP;
-	    DNSUpdate *act2 = new DNSUpdate(DNSAddr->getPlain(), "", fqdnName, 
+	    DNSUpdate::start(new DNSUpdate(DNSAddr->getPlain(), "", fqdnName, 
                                             IPv6Addr->getPlain(),
-					    DNSUPDATE_AAAA, proto2);
-	    result2 = act2->run(timeout);
-	    act2->showResult(result2);
-	    delete act2;
+					    DNSUPDATE_AAAA, proto2), timeout);
 	} // fqdnMode == 2
 	
 	// regardless of the result, store the info
@@ -875,7 +779,6 @@ void TSrvMsg::fqdnRelease(SPtr<TSrvCfgIface> ptrIface, SPtr<TAddrIA> ptrIA, SPtr
     string fqdnName = fqdn->getName();
     int FQDNMode = ptrIface->getFQDNMode();
     fqdn->setUsed(false);
-    int result;
 
     SPtr<TIPv6Addr> dns = ptrIA->getFQDNDnsServer();
     if (!dns) {
@@ -910,11 +813,8 @@ void TSrvMsg::fqdnRelease(SPtr<TSrvCfgIface> ptrIface, SPtr<TAddrIA> ptrIA, SPtr
 	/* PTR cleanup */
 	Log(Notice) << "FQDN: Attempting to clean up PTR record in DNS Server " << * dns << ", IP = " << *clntAddr 
 		    << " and FQDN=" << fqdn->getName() << LogEnd;
-	DNSUpdate *act = new DNSUpdate(dns->getPlain(), zoneroot, fqdnName, clntAddr->getPlain(), 
-                                       DNSUPDATE_PTR_CLEANUP, proto2);
-	result = act->run(timeout);
-	act->showResult(result);
-	delete act;
+	DNSUpdate::start(new DNSUpdate(dns->getPlain(), zoneroot, fqdnName, clntAddr->getPlain(), 
+                                       DNSUPDATE_PTR_CLEANUP, proto2), timeout);
 	
     } // fqdn mode 1 (PTR only)
     else if (FQDNMode == DNSUPDATE_MODE_BOTH){
@@ -922,20 +822,14 @@ void TSrvMsg::fqdnRelease(SPtr<TSrvCfgIface> ptrIface, SPtr<TAddrIA> ptrIA, SPtr
 	Log(Notice) << "FQDN: Attempting to clean up AAAA and PTR record in DNS Server " << * dns << ", IP = " 
 		    << *clntAddr << " and FQDN=" << fqdn->getName() << LogEnd;
 	
-	DNSUpdate *act = new DNSUpdate(dns->getPlain(), "", fqdnName, clntAddr->getPlain(), 
-                                       DNSUPDATE_AAAA_CLEANUP, proto2);
-	result = act->run(timeout);
-	act->showResult(result);
-	delete act;
+	DNSUpdate::start(new DNSUpdate(dns->getPlain(), "", fqdnName, clntAddr->getPlain(), 
+                                       DNSUPDATE_AAAA_CLEANUP, proto2), timeout);
 	
 	/* PTR cleanup */
 	Log(Notice) << "FQDN: Attempting to clean up PTR record in DNS Server " << * dns << ", IP = " << *clntAddr 
 		    << " and FQDN=" << fqdn->getName() << LogEnd;
-	DNSUpdate *act2 = new DNSUpdate(dns->getPlain(), zoneroot, fqdnName, clntAddr->getPlain(), 
-                                        DNSUPDATE_PTR_CLEANUP, proto2);
-	result = act2->run(timeout);
-	act2->showResult(result);
-	delete act2;
+	DNSUpdate::start(new DNSUpdate(dns->getPlain(), zoneroot, fqdnName, clntAddr->getPlain(), 
+                                        DNSUPDATE_PTR_CLEANUP, proto2), timeout);
     } // fqdn mode 2 (AAAA and PTR)
 #endif
 }
@@ -1004,21 +898,17 @@ bool TSrvMsg::validateReplayDetection() {
         return true;
     }
 
-    SPtr<TAddrClient> client = SrvAddrMgr().getClient(SPI);
-    if (!client) {
-        Log(Debug) << "Auth: Unable to find client with SPI=" << SPI << "." << LogEnd;
+    // last received value is kept together with the key, no need to look for client
+    switch (AuthKeys->checkReplay(SPI, this->ReplayDetection)) {
+    case KEY_REPLAY_UNKNOWN:
+        Log(Debug) << "Auth: Unable to find key with SPI=" << SPI << "." << LogEnd;
         return true;
-    }
-
-    if (!client->getReplayDetectionRcvd() && !this->ReplayDetection)
-        return true;
-
-    if (client->getReplayDetectionRcvd() < this->ReplayDetection) {
-        client->setReplayDetectionRcvd(this->ReplayDetection);
-        return true;
-    } else {
+    case KEY_REPLAY_DETECTED:
         Log(Warning) << "Auth: Replayed message detected, message dropped." << LogEnd;
         return false;
+    case KEY_REPLAY_OK:
+    default:
+        return true;
     }
 #else
     return true;
@@ -41,6 +41,7 @@ public:
     bool appendMandatoryOptions(SPtr<TSrvOptOptionRequest> oro, bool includeClientID = true);
     bool appendRequestedOptions(SPtr<TDUID> duid, SPtr<TIPv6Addr> addr, 
 				int iface, SPtr<TSrvOptOptionRequest> reqOpt);
+    SPtr<TOpt> getConfiguredOption(SPtr<TSrvCfgIface> iface, SPtr<TSrvCfgOptions> ex, int type);
     std::string showRequestedOptions(SPtr<TSrvOptOptionRequest> oro);
     bool appendVendorSpec(SPtr<TDUID> duid, int iface, int vendor, SPtr<TSrvOptOptionRequest> reqOpt);
     void appendStatusCode();
@@ -53,6 +54,8 @@ public:
 		      List(TOptGeneric) echoList);
 
     int getRelayCount();
+    SPtr<TIPv6Addr> getLinkAddr(int relay);
+    SPtr<TSrvOptInterfaceID> getInterfaceID(int relay);
 
     bool validateReplayDetection();
 
@@ -76,7 +79,7 @@ protected:
     SPtr<TSrvOptFQDN> prepareFQDN(SPtr<TSrvOptFQDN> requestFQDN, SPtr<TDUID> clntDuid, 
 				  SPtr<TIPv6Addr> clntAddr, std::string hint, bool doRealUpdate);
     void fqdnRelease(SPtr<TSrvCfgIface> ptrIface, SPtr<TAddrIA> ia, SPtr<TFQDN> fqdn);
-    int storeSelfRelay(char * buf, int relayLevel, ESrvIfaceIdOrder order);
+    int storeSelfRelay(char * buf, int relayLevel, ESrvIfaceIdOrder order, int & msgLen);
 
 
     // relay
@@ -84,7 +87,6 @@ protected:
     SPtr<TIPv6Addr> PeerAddrTbl[HOP_COUNT_LIMIT];
     SPtr<TSrvOptInterfaceID> InterfaceIDTbl[HOP_COUNT_LIMIT];
     List(TOptGeneric) EchoListTbl[HOP_COUNT_LIMIT];  // list of options to be echoed back
-    int len[HOP_COUNT_LIMIT];
     int HopTbl[HOP_COUNT_LIMIT];
 
     unsigned long FirstTimeStamp; // timestamp of first message transmission
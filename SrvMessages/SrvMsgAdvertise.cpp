@@ -120,6 +120,8 @@ bool TSrvMsgAdvertise::handleSolicitOptions(SPtr<TSrvMsgSolicit> solicit) {
 	    SPtr<TSrvOptFQDN> optFQDN;
 
 	    SPtr<TIPv6Addr> clntAssignedAddr = SrvAddrMgr().getFirstAddr(ClientDUID);
+	    if (!clntAssignedAddr)
+		clntAssignedAddr = getOfferedAddr();
 	    if (clntAssignedAddr)
 		optFQDN = this->prepareFQDN(requestFQDN, ClientDUID, clntAssignedAddr, hint, false);
 	    else
@@ -181,35 +183,30 @@ bool TSrvMsgAdvertise::handleSolicitOptions(SPtr<TSrvMsgSolicit> solicit) {
 
     appendStatusCode();
 
-    // this is ADVERTISE only, so we need to release assigned addresses
-    this->firstOption();
-    while ( opt = this->getOption()) {
-	switch (opt->getOptType()) {
-	case OPTION_IA_NA: {
-	    SPtr<TSrvOptIA_NA> ptrOptIA_NA;
-	    ptrOptIA_NA = (Ptr*) opt;
-	    ptrOptIA_NA->releaseAllAddrs(false);
-	    break;
-	}
-	case OPTION_IA_TA: {
-	    SPtr<TSrvOptTA> ta;
-	    ta = (Ptr*) opt;
-	    ta->releaseAllAddrs(false);
-	    break;
-	}
-	default:
-	    break;
-	}
-    }
+    // addresses in this ADVERTISE are only offered (see TSrvAddrMgr::addOffer()),
+    // so there is nothing to release here
 
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     MRT = 0;
     send();
     return true;
 }
 
+/// returns first address offered in IA_NA options of this ADVERTISE (or 0)
+SPtr<TIPv6Addr> TSrvMsgAdvertise::getOfferedAddr() {
+    SPtr<TOpt> opt;
+    firstOption();
+    while (opt = getOption()) {
+	if (opt->getOptType() != OPTION_IA_NA)
+	    continue;
+	SPtr<TOptIAAddress> addr = (Ptr*) opt->getOption(OPTION_IAADDR);
+	if (addr)
+	    return addr->getAddr();
+    }
+    return 0;
+}
+
 bool TSrvMsgAdvertise::check() {
     // this should never happen
     return true;
@@ -41,6 +41,8 @@ class TSrvMsgAdvertise : public TSrvMsg
     unsigned long getTimeout();
     std::string getName() const;
     ~TSrvMsgAdvertise();
+ private:
+    SPtr<TIPv6Addr> getOfferedAddr();
 };
 
 #endif /* SRVMSGADVERTISE_H */
@@ -93,8 +93,6 @@ bool TSrvMsgLeaseQueryReply::answer(SPtr<TSrvMsgLeaseQuery> queryMsg) {
     ptrSrvID = new TSrvOptServerIdentifier(SrvCfgMgr().getDUID(), this);
     Options.push_back((Ptr*)ptrSrvID);
 
-    // allocate buffer
-    pkt = new char[getSize()];
     this->send();
 
     return true;
@@ -53,7 +53,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgConfirm> confirm)
     // appendStatusCode();
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     this->MRT = 31;
     IsDone = false;
     this->send();
@@ -273,7 +272,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgDecline> decline)
 
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     this->MRT = 31;
     this->send();
@@ -343,7 +341,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRebind> rebind)
     appendRequestedOptions(ClientDUID, rebind->getAddr(),rebind->getIface(), ORO);
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     this->MRT = 0;
     this->send();
@@ -528,7 +525,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRelease> release)
 
     NotifyScripts = notifyParams;
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     this->MRT=46;
     this->send();
@@ -598,7 +594,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRenew> renew)
     appendRequestedOptions(ClientDUID,renew->getAddr(),renew->getIface(), ORO);
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     this->MRT = 0;
     this->send();
@@ -700,7 +695,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgRequest> request)
     appendRequestedOptions(ClientDUID, clntAddr, clntIface, ORO);
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     this->MRT = 330;
     this->send();
@@ -780,7 +774,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgSolicit> solicit)
     appendRequestedOptions(ClientDUID, clntAddr, clntIface, ORO);
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     SPtr<TIPv6Addr> ptrAddr;
     this->MRT = 330;
@@ -836,7 +829,6 @@ TSrvMsgReply::TSrvMsgReply(SPtr<TSrvMsgInfRequest> infRequest)
 
     appendAuthenticationOption(ClientDUID);
 
-    pkt = new char[this->getSize()];
     IsDone = false;
     MRT = 330; /// @todo:
     send();
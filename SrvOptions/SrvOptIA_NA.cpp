@@ -24,13 +24,37 @@
 #include "Logger.h"
 #include "AddrClient.h"
 #include "DHCPConst.h"
+#include "DHCPDefaults.h"
 #include "Msg.h"
 #include "SrvAddrMgr.h"
+#include "SrvReplMgr.h"
+#include "SrvLeaseStore.h"
 #include "SrvCfgMgr.h"
 #include "SrvTransMgr.h"
 
 using namespace std;
 
+/// checks if all addresses in class are assigned or offered to clients
+static bool classFull(int iface, SPtr<TSrvCfgAddrClass> ptrClass) {
+    return ptrClass->getAssignedCount()
+	+ SrvAddrMgr().getOfferedCount(iface, TAddrIA::TYPE_IA, ptrClass->getID())
+	>= ptrClass->getClassMaxLease();
+}
+
+/*
+ * picks random free address from class. If pool is shared with replication
+ * peer, only addresses owned by this server are tried at first, peer-owned
+ * ones are used when our part of the pool is exhausted.
+ */
+static SPtr<TIPv6Addr> getRandomFreeAddr(SPtr<TSrvCfgAddrClass> ptrClass) {
+    SPtr<TIPv6Addr> addr;
+    unsigned int tries = 0;
+    do {
+	addr = ptrClass->getRandomAddr();
+    } while (!SrvAddrMgr().addrIsFree(addr, ++tries > SERVER_DEFAULT_REPL_OWNER_TRIES));
+    return addr;
+}
+
 TSrvOptIA_NA::TSrvOptIA_NA( long IAID, long T1, long T2, TMsg* parent)
     :TOptIA_NA(IAID,T1,T2, parent) {
 
@@ -112,6 +136,9 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt,
     /// @todo: SOLICIT without RAPID COMMIT should set this to true
     bool quiet = false;
 
+    // ADVERTISE only offers addresses, they are assigned when REQUEST arrives
+    bool offer = (msgType == SOLICIT_MSG);
+
     // --- check if client already has binding
     if (renew(queryOpt, false)) {
       Log(Info) << "Previous binding for client " << ClntDuid->getPlain() << ", IA(iaid="
@@ -119,6 +146,8 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt,
       return;
     }
 
+    // address offered earlier is either offered again (SOLICIT) or assigned (REQUEST)
+    SPtr<TIPv6Addr> offered = SrvAddrMgr().takeOffer(ClntDuid, IAID, TAddrIA::TYPE_IA);
 
     // --- Is this IA without IAADDR options? ---
     if (!queryOpt->countAddrs()) {
@@ -128,13 +157,16 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt,
 
       // is there any specific address reserved for this client? (exception mechanism)
       SPtr<TIPv6Addr> hint = getExceptionAddr();
-      if (!hint) {
+      if (offered && !hint) {
+	  Log(Debug) << "Address " << offered->getPlain() << " was offered to this client, trying to assign." << LogEnd;
+	  hint = offered;
+      } else if (!hint) {
 	  hint = new TIPv6Addr();
       } else {
 	  Log(Notice) << "Reserved address " << hint->getPlain() << " for this client found, trying to assign." << LogEnd;
       }
       SPtr<TSrvOptStatusCode> ptrStatus;
-      if (this->assignAddr(hint, DHCPV6_INFINITY, DHCPV6_INFINITY, quiet))
+      if (this->assignAddr(hint, DHCPV6_INFINITY, DHCPV6_INFINITY, quiet, offer))
       {
 	  // include status code
 	  ptrStatus = new TSrvOptStatusCode(STATUSCODE_SUCCESS,
@@ -206,11 +238,10 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt,
 
 	    if (willAssign) {
 		// we've got free addrs left, assign one of them
-		// always register this address as used by this client
-		// (if this is solicit, this addr will be released later)
+		// (if this is solicit, this addr will be only offered)
 		unsigned long pref  = optAddr->getPref();
 		unsigned long valid = optAddr->getValid();
-		this->assignAddr(hint, pref, valid, quiet);
+		this->assignAddr(hint, pref, valid, quiet, offer);
 		willAssign--;
 		addrsAssigned++;
 
@@ -253,8 +284,6 @@ TSrvOptIA_NA::TSrvOptIA_NA(SPtr<TSrvOptIA_NA> queryOpt,
 
     }
     SubOptions.append((Ptr*)ptrStatus);
-
-    // if this is a ADVERTISE message, release those addresses in TSrvMsgAdvertise::answer() method
 }
 
 void TSrvOptIA_NA::releaseAllAddrs(bool quiet) {
@@ -272,9 +301,21 @@ void TSrvOptIA_NA::releaseAllAddrs(bool quiet) {
     }
 }
 
+/**
+ * finds an address for this IA and registers it as used by the client (or
+ * only remembers it as offered, if this is ADVERTISE).
+ *
+ * @param hint address proposed by client
+ * @param pref preferred lifetime proposed by client
+ * @param valid valid lifetime proposed by client
+ * @param quiet should logging be limited?
+ * @param offer true if address should be only offered (ADVERTISE)
+ *
+ * @return IAADDR option with found address (or 0)
+ */
 SPtr<TSrvOptIAAddress> TSrvOptIA_NA::assignAddr(SPtr<TIPv6Addr> hint, unsigned long pref,
 						    unsigned long valid,
-						    bool quiet) {
+						    bool quiet, bool offer) {
     // Assign one address
     SPtr<TIPv6Addr> addr;
     SPtr<TSrvOptIAAddress> optAddr;
@@ -303,6 +344,13 @@ SPtr<TSrvOptIAAddress> TSrvOptIA_NA::assignAddr(SPtr<TIPv6Addr> hint, unsigned l
     this->T1= ptrClass->getT1(this->T1);
     this->T2= ptrClass->getT2(this->T2);
 
+    if (offer) {
+	// don't touch lease database, just hold this address until REQUEST arrives
+	SrvAddrMgr().addOffer(this->ClntDuid, this->IAID, TAddrIA::TYPE_IA, addr,
+			      this->Iface, ptrClass->getID());
+	return optAddr;
+    }
+
     // register this address as used by this client
     SrvAddrMgr().addClntAddr(this->ClntDuid, this->ClntAddr, this->Iface, this->IAID,
 			       this->T1, this->T2, addr, pref, valid, quiet);
@@ -433,6 +481,8 @@ bool TSrvOptIA_NA::renew(SPtr<TSrvOptIA_NA> queryOpt, bool complainIfMissing)
 				       this->Parent);
         SubOptions.append( (Ptr*)optAddr );
     }
+    SrvReplMgr().renewLease(TAddrIA::TYPE_IA, ClntDuid, IAID);
+    SrvLeaseStore().renewLease(TAddrIA::TYPE_IA, ClntDuid, IAID);
 
     // finally send greetings and happy OK status code
     SPtr<TSrvOptStatusCode> ptrStatus;
@@ -479,6 +529,8 @@ void TSrvOptIA_NA::rebind(SPtr<TSrvOptIA_NA> queryOpt,
 				       ptrAddr->getValid(),this->Parent);
         SubOptions.append( (Ptr*)optAddr );
     }
+    SrvReplMgr().renewLease(TAddrIA::TYPE_IA, ClntDuid, IAID);
+    SrvLeaseStore().renewLease(TAddrIA::TYPE_IA, ClntDuid, IAID);
 
     // finally send greetings and happy OK status code
     SPtr<TSrvOptStatusCode> ptrStatus;
@@ -562,6 +614,12 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getFreeAddr(SPtr<TIPv6Addr> hint) {
         return 0; // NULL
     }
 
+    // pool is shared with replication peer, which may have assigned addresses we don't know yet
+    if (!SrvReplMgr().ready()) {
+	Log(Info) << "Replication: Peer's leases not received yet, no address assigned." << LogEnd;
+	return 0;
+    }
+
     SPtr<TSrvMsg> requestMsg = SrvTransMgr().getCurrentRequest();
 
     // check if this address is ok
@@ -609,7 +667,7 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getFreeAddr(SPtr<TIPv6Addr> hint) {
 		// medium case: addess belongs to supported class, but is used
 		// however the class pool is still free
 
-		if (ptrClass->getAssignedCount()>=ptrClass->getClassMaxLease()) {
+		if (classFull(this->Iface, ptrClass)) {
 		Log(Debug) << "Requested address (" << *hint
 			   << ") belongs to supported class, which has reached its limit ("
 			   << ptrClass->getAssignedCount() << " assigned, "
@@ -617,10 +675,7 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getFreeAddr(SPtr<TIPv6Addr> hint) {
 		} else {
 		    Log(Debug) << "Requested address (" << *hint
 			       << ") belongs to supported class, but is used." << LogEnd;
-		    do {
-			addr = ptrClass->getRandomAddr();
-		    } while (!SrvAddrMgr().addrIsFree(addr));
-		    return addr;
+		    return getRandomFreeAddr(ptrClass);
 		}
 	}// If the Class are valid and support the Client (based on duid, addr, clientclass)
     } //  if ( !invalidAddr )
@@ -648,14 +703,14 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getFreeAddr(SPtr<TIPv6Addr> hint) {
 
     if (!ptrClass || 
 	!ptrClass->clntSupported(ClntDuid, ClntAddr, requestMsg ) ||  
-	(ptrClass->getAssignedCount()>=ptrClass->getClassMaxLease()) ) {
+	classFull(this->Iface, ptrClass) ) {
 	// random class in invalid, let's try to find another one
 
 	ptrIface->firstAddrClass();
 	while (ptrClass = ptrIface->getAddrClass()) {
 	    if (!ptrClass->clntSupported(ClntDuid, ClntAddr, requestMsg))
 		continue;
-	    if (ptrClass->getAssignedCount()>=ptrClass->getClassMaxLease())
+	    if (classFull(this->Iface, ptrClass))
 		continue;
 	    break;
 	}
@@ -666,8 +721,5 @@ SPtr<TIPv6Addr> TSrvOptIA_NA::getFreeAddr(SPtr<TIPv6Addr> hint) {
 	return 0;
     }
 
-    do {
-	addr = ptrClass->getRandomAddr();
-    } while (!SrvAddrMgr().addrIsFree(hint));
-    return addr;
+    return getRandomFreeAddr(ptrClass);
 }
@@ -52,7 +52,7 @@ class TSrvOptIA_NA : public TOptIA_NA
     int                   Iface;
     
     SPtr<TSrvOptIAAddress> assignAddr(SPtr<TIPv6Addr> hint, unsigned long pref,
-					  unsigned long valid, bool quiet);
+					  unsigned long valid, bool quiet, bool offer);
     SPtr<TIPv6Addr> getFreeAddr(SPtr<TIPv6Addr> hint);
     SPtr<TIPv6Addr> getExceptionAddr();
 };
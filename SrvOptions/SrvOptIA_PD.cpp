@@ -24,8 +24,11 @@
 #include "Logger.h"
 #include "AddrClient.h"
 #include "DHCPConst.h"
+#include "DHCPDefaults.h"
 #include "Msg.h"
 #include "SrvCfgMgr.h"
+#include "SrvReplMgr.h"
+#include "SrvLeaseStore.h"
 #include "SrvTransMgr.h"
 
 using namespace std;
@@ -157,9 +160,14 @@ int TSrvOptIA_PD::assignPrefix(SPtr<TIPv6Addr> hint, bool fake) {
     List(TIPv6Addr) prefixLst;
     SPtr<TIPv6Addr> cached;
 
+    // prefix offered in ADVERTISE is offered again (SOLICIT) or assigned (REQUEST)
+    SPtr<TIPv6Addr> offered = SrvAddrMgr().takeOffer(ClntDuid, IAID, TAddrIA::TYPE_PD);
+
     if (hint->getPlain()==string("::") ) {
         cached = SrvAddrMgr().getCachedEntry(ClntDuid, TAddrIA::TYPE_PD);
-        if (cached)
+        if (offered)
+            hint = offered;
+        else if (cached)
             hint = cached;
     }
 
@@ -174,7 +182,11 @@ int TSrvOptIA_PD::assignPrefix(SPtr<TIPv6Addr> hint, bool fake) {
       optPrefix = new TSrvOptIAPrefix(prefix, (char)this->PDLength, this->Prefered, this->Valid, this->Parent);
       SubOptions.append((Ptr*)optPrefix);
 
-      if (!fake) {
+      if (fake) {
+            ptrPD = SrvCfgMgr().getClassByPrefix(this->Iface, prefix);
+            SrvAddrMgr().addOffer(this->ClntDuid, this->IAID, TAddrIA::TYPE_PD, prefix,
+                                  this->Iface, ptrPD ? ptrPD->getID() : 0);
+      } else {
             // every prefix has to be remembered in AddrMgr, e.g. when there are 2 pools defined,
             // prefixLst contains entries from each pool, so 2 prefixes has to be remembered
             SrvAddrMgr().addPrefix(this->ClntDuid, this->ClntAddr, this->Iface, this->IAID, this->T1, this->T2,
@@ -346,6 +358,8 @@ void TSrvOptIA_PD::renew(SPtr<TSrvOptIA_PD> queryOpt, SPtr<TSrvCfgIface> iface)
                                         prefix->getValid(), this->Parent);
         SubOptions.append( (Ptr*)optPrefix );
     }
+    SrvReplMgr().renewLease(TAddrIA::TYPE_PD, ClntDuid, IAID);
+    SrvLeaseStore().renewLease(TAddrIA::TYPE_PD, ClntDuid, IAID);
 
     // finally send greetings and happy OK status code
     SPtr<TSrvOptStatusCode> ptrStatus;
@@ -418,6 +432,11 @@ List(TIPv6Addr) TSrvOptIA_PD::getFreePrefixes(SPtr<TIPv6Addr> hint) {
       return lst; // empty list
     }
 
+    // pool is shared with replication peer, which may have assigned prefixes we don't know yet
+    if (!SrvReplMgr().ready()) {
+      Log(Info) << "PD: Replication: Peer's leases not received yet, no prefix assigned." << LogEnd;
+      return lst; // empty list
+    }
 
     // check if this prefix is ok
 
@@ -466,10 +485,12 @@ List(TIPv6Addr) TSrvOptIA_PD::getFreePrefixes(SPtr<TIPv6Addr> hint) {
                   }
 
                   // case 3: hint is used, but we can assign another prefix from the same pool
+                  // (peer-owned ones only when ours are exhausted, if pool is shared with peer)
                   if (ptrPD) {
+                        unsigned int tries = 0;
                         do {
                           prefix=ptrPD->getRandomPrefix();
-                        } while (!SrvAddrMgr().prefixIsFree(prefix));
+                        } while (!SrvAddrMgr().prefixIsFree(prefix, ++tries > SERVER_DEFAULT_REPL_OWNER_TRIES));
                         lst.append(prefix);
 
                         this->PDLength = ptrPD->getPD_Length();
@@ -500,13 +521,15 @@ List(TIPv6Addr) TSrvOptIA_PD::getFreePrefixes(SPtr<TIPv6Addr> hint) {
     }
 
 
+    unsigned int tries = 0;
     while (true) {
         List(TIPv6Addr) lst;
         lst = ptrPD->getRandomList();
         lst.first();
         bool allFree = true;
+        bool peerOwned = ++tries > SERVER_DEFAULT_REPL_OWNER_TRIES;
         while (prefix = lst.get()) {
-            if (!SrvAddrMgr().prefixIsFree(prefix)) {
+            if (!SrvAddrMgr().prefixIsFree(prefix, peerOwned)) {
                 allFree = false;
             }
         }
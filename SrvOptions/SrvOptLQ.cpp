@@ -118,10 +118,10 @@ int TSrvOptLQClientData::getSize()
 
 char* TSrvOptLQClientData::storeSelf(char* buf)
 {
-    buf = writeUint16(buf, OptType);
-    buf = writeUint16(buf, getSize()-4);
+    char* start = buf;
+    buf = storeHeader(buf);
     buf = storeSubOpt(buf);
-    return buf;
+    return storeLength(start, buf);
 }
 
 bool TSrvOptLQClientData::doDuties()
@@ -154,8 +154,6 @@ void TSrvOptTA::solicitRequest(SPtr<TSrvOptTA> queryOpt, bool solicit) {
 	return;
     }
     SubOptions.append((Ptr*) optAddr);
-
-    // those addresses will be released in the TSrvMsgAdvertise::answer() method
 }
 
 void TSrvOptTA::request(SPtr<TSrvOptTA> queryOpt) {
@@ -186,8 +184,9 @@ void TSrvOptTA::releaseAllAddrs(bool quiet) {
 }
 
 /**
- * this method finds a temp. address for this client, marks it as used and then
- * creates IAAADDR option containing this option.
+ * this method finds a temp. address for this client, marks it as used (or as
+ * offered, if this is ADVERTISE) and then creates IAAADDR option containing this option.
+ * Address offered in ADVERTISE is used again, if it is still available.
  *
  *
  * @return
@@ -210,6 +209,9 @@ SPtr<TSrvOptIAAddress> TSrvOptTA::assignAddr() {
     {
     	if (!ta->clntSupported(ClntDuid, ClntAddr, requestMsg ))
     		continue;
+    	if (ta->getAssignedCount() + SrvAddrMgr().getOfferedCount(Iface, TAddrIA::TYPE_TA, ta->getID())
+    	    >= ta->getClassMaxLease())
+    		continue;
     	break;
     }
 
@@ -221,8 +223,16 @@ SPtr<TSrvOptIAAddress> TSrvOptTA::assignAddr() {
     SPtr<TIPv6Addr> addr;
     int safety=0;
 
+    SPtr<TIPv6Addr> offered = SrvAddrMgr().takeOffer(ClntDuid, IAID, TAddrIA::TYPE_TA);
+    if (offered && !ta->addrInPool(offered))
+	offered = 0;
+
     while (safety<MAX_TA_RANDOM_TRIES) {
-	addr = ta->getRandomAddr();
+	if (offered) {
+	    addr = offered;
+	    offered = 0;
+	} else
+	    addr = ta->getRandomAddr();
 	if (SrvAddrMgr().taAddrIsFree(addr)) {
 	    if ((this->OrgMessage == REQUEST_MSG)) {
 		Log(Debug) << "Temporary address " << addr->getPlain() << " granted." << LogEnd;
@@ -231,6 +241,8 @@ SPtr<TSrvOptIAAddress> TSrvOptTA::assignAddr() {
 		SrvCfgMgr().addTAAddr(this->Iface);
 	    } else {
 		Log(Debug) << "Temporary address " << addr->getPlain() << " generated (not granted)." << LogEnd;
+		SrvAddrMgr().addOffer(this->ClntDuid, this->IAID, TAddrIA::TYPE_TA, addr,
+				      this->Iface, ta->getID());
 	    }
 	    return new TSrvOptIAAddress(addr, ta->getPref(), ta->getValid(), this->Parent);
 
@@ -18,6 +18,7 @@
 #include "Iface.h"
 #include "DHCPConst.h"
 #include "Logger.h"
+#include "StatsMgr.h"
 #include "AddrClient.h"
 #include "AddrIA.h"
 #include "SrvMsgAdvertise.h"
@@ -31,8 +32,15 @@
 #include "SrvMsgRelease.h"
 #include "SrvMsgLeaseQuery.h"
 #include "SrvMsgLeaseQueryReply.h"
+#include "SrvReplMgr.h"
+#include "SrvLeaseStore.h"
 #include "SrvOptIA_NA.h"
+#include "OptIA_PD.h"
+#include "OptIAAddress.h"
+#include "OptIAPrefix.h"
 #include "SrvOptStatusCode.h"
+#include "OptDUID.h"
+#include "OptInteger.h"
 #include "NodeClientSpecific.h"
 
 using namespace std;
@@ -40,7 +48,7 @@ using namespace std;
 TSrvTransMgr * TSrvTransMgr::Instance = 0;
 
 TSrvTransMgr::TSrvTransMgr(const std::string xmlFile)
-: XmlFile(xmlFile), IsDone(false)
+: XmlFile(xmlFile), IsDone(false), LastPurge(0), Admitted(0), EarlyDropped(0)
 {
     // TransMgr is certainly not done yet. We're just getting started
 
@@ -55,6 +63,13 @@ TSrvTransMgr::TSrvTransMgr(const std::string xmlFile)
     }
 
     SrvAddrMgr().setCacheSize(SrvCfgMgr().getCacheSize());
+
+    for (int i=0; i<SRV_RATE_LIMIT_MAX; i++) {
+        TSrvRateLimit limit = SrvCfgMgr().getRateLimit((ESrvRateLimit)i);
+        Buckets[i].setLimit(limit.Rate, limit.Burst);
+        Dropped[i] = 0;
+    }
+    SolicitEarlyDrop = SrvCfgMgr().solicitEarlyDrop();
 }
 
 /*
@@ -78,7 +93,7 @@ bool TSrvTransMgr::openSocket(SPtr<TSrvCfgIface> confIface) {
         /* unicast */
         Log(Notice) << "Creating unicast (" << *unicast << ") socket on " << confIface->getName()
                     << "/" << confIface->getID() << " interface." << LogEnd;
-        if (!iface->addSocket( unicast, DHCPSERVER_PORT, true, false)) {
+        if (!bindSocket((Ptr*)iface, unicast)) {
             Log(Crit) << "Proper socket creation failed." << LogEnd;
             return false;
         }
@@ -101,7 +116,7 @@ bool TSrvTransMgr::openSocket(SPtr<TSrvCfgIface> confIface) {
         return true;
     }
 
-    if (!iface->addSocket(ipAddr, DHCPSERVER_PORT, true, false)) {
+    if (!bindSocket((Ptr*)iface, ipAddr)) {
         Log(Crit) << "Proper socket creation failed." << LogEnd;
         return false;
     }
@@ -120,7 +135,7 @@ bool TSrvTransMgr::openSocket(SPtr<TSrvCfgIface> confIface) {
     } else {
         Log(Notice) << "Creating link-local (" << llAddr->getPlain() << ") socket on " << iface->getFullName()
                     << " interface." << LogEnd;
-        if (!iface->addSocket(llAddr, DHCPSERVER_PORT, true, false)) {
+        if (!bindSocket((Ptr*)iface, llAddr)) {
             Log(Crit) << "Failed to create link-local socket on " << iface->getFullName() << " interface." << LogEnd;
             return false;
         }
@@ -130,6 +145,29 @@ bool TSrvTransMgr::openSocket(SPtr<TSrvCfgIface> confIface) {
     return true;
 }
 
+/**
+ * binds server socket. When server runs in several workers, every worker binds
+ * the same address (SO_REUSEPORT) and kernel picks worker by client's DUID.
+ *
+ * @param iface interface
+ * @param addr address to bind
+ *
+ * @return true if socket was created
+ */
+bool TSrvTransMgr::bindSocket(SPtr<TIfaceIface> iface, SPtr<TIPv6Addr> addr) {
+    int workers = SrvCfgMgr().getWorkers();
+    if (!iface->addSocket(addr, DHCPSERVER_PORT, true, workers > 1 ? LOWLEVEL_REUSE_PORT : 0))
+        return false;
+    if (workers < 2)
+        return true;
+
+    SPtr<TIfaceSocket> sock = iface->getSocketByAddr(addr);
+    if (sock && !sock->multicast() && sock_steer(sock->getFD(), workers) < 0)
+        Log(Warning) << "Unable to steer packets sent to " << addr->getPlain()
+                     << " by client, clients will be spread between workers randomly." << LogEnd;
+    return true;
+}
+
 /**
  * Computes number of seconds when next event is expected or a job is
  * supposted to be proceeded.
@@ -148,12 +186,243 @@ long TSrvTransMgr::getTimeout()
         if (ptrMsg->getTimeout() < min)
             min = ptrMsg->getTimeout();
     }
-    if (SrvCfgMgr().inactiveIfacesCnt() && ifaceRecheckPeriod<min)
+    // with notifications enabled, select() will wake up on interface change
+    if (SrvCfgMgr().inactiveIfacesCnt() && !SrvIfaceMgr().ifaceEventsActive()
+        && ifaceRecheckPeriod<min)
         min = ifaceRecheckPeriod;
+    if (SrvCfgMgr().getDumpTimeout() < min)
+        min = SrvCfgMgr().getDumpTimeout();
+    if (SrvAddrMgr().getDumpTimeout() < min)
+        min = SrvAddrMgr().getDumpTimeout();
+    if (SrvAddrMgr().getCacheDumpTimeout() < min)
+        min = SrvAddrMgr().getCacheDumpTimeout();
+    if (SrvAddrMgr().getOfferTimeout() < min)
+        min = SrvAddrMgr().getOfferTimeout();
     addrTimeout = SrvAddrMgr().getValidTimeout();
     return min<addrTimeout?min:addrTimeout;
 }
 
+/**
+ * @brief admission control: decides if received message should be processed
+ *
+ * Each message needs a token from its client's bucket. SOLICIT and
+ * INFORMATION-REQUEST (i.e. new exchanges) also need a token from the bucket of
+ * the relay link they came from and from the bucket of the interface, so a storm of
+ * new clients can't starve RENEWs and REQUESTs of already served ones.
+ * Tokens are taken only when all buckets admit the message, so a client
+ * is not charged for messages dropped because of its link or interface.
+ * Retransmitted SOLICITs are dropped early, as soon as link or interface bucket
+ * is half empty. Retransmissions that can be answered from the reply buffer are
+ * always admitted. Only valid messages this server is going to process are
+ * charged, i.e. this is called after ownsMsg() and check().
+ *
+ * @param msg received message
+ *
+ * @return true if message should be processed, false if it should be dropped
+ */
+bool TSrvTransMgr::admitMsg(SPtr<TSrvMsg> msg)
+{
+    if (!Buckets[SRV_RATE_LIMIT_CLIENT].enabled() && !Buckets[SRV_RATE_LIMIT_LINK].enabled() &&
+        !Buckets[SRV_RATE_LIMIT_IFACE].enabled()) {
+        Admitted++;
+        return true;
+    }
+
+    unsigned long long now = now_ms();
+    purgeBuckets(now);
+
+    if (replyBuffered(msg)) {
+        Admitted++;
+        return true;
+    }
+
+    string client;
+    SPtr<TOptDUID> clientID = (Ptr*) msg->getOption(OPTION_CLIENTID);
+    if (clientID && clientID->getDUID())
+        client = clientID->getDUID()->getPlain();
+    if (!client.empty() && !Buckets[SRV_RATE_LIMIT_CLIENT].check(client, now, false)) {
+        Log(Debug) << "Admission: " << msg->getName() << " dropped, client "
+                   << client << " exceeded its rate limit." << LogEnd;
+        Dropped[SRV_RATE_LIMIT_CLIENT]++;
+        return false;
+    }
+
+    string link, iface;
+    if (msg->getType() == SOLICIT_MSG || msg->getType() == INFORMATION_REQUEST_MSG) {
+        bool retransmission = false;
+        if (SolicitEarlyDrop && msg->getType() == SOLICIT_MSG) {
+            SPtr<TOptInteger> elapsed = (Ptr*) msg->getOption(OPTION_ELAPSED_TIME);
+            retransmission = elapsed && elapsed->getValue();
+        }
+
+        // relay link the client is connected to (the innermost relay)
+        int relay = msg->getRelayCount() - 1;
+        if (relay >= 0) {
+            link = msg->getLinkAddr(relay)->getPlain();
+            SPtr<TSrvOptInterfaceID> ifaceID = msg->getInterfaceID(relay);
+            if (ifaceID)
+                link += "/" + ifaceID->getPlain();
+            if (!Buckets[SRV_RATE_LIMIT_LINK].check(link, now, retransmission)) {
+                Log(Debug) << "Admission: " << msg->getName() << " dropped, relay link " << link
+                           << " exceeded its rate limit." << LogEnd;
+                if (retransmission)
+                    EarlyDropped++;
+                else
+                    Dropped[SRV_RATE_LIMIT_LINK]++;
+                return false;
+            }
+        }
+
+        ostringstream ifaceName;
+        ifaceName << msg->getIface();
+        iface = ifaceName.str();
+        if (!Buckets[SRV_RATE_LIMIT_IFACE].check(iface, now, retransmission)) {
+            Log(Debug) << "Admission: " << msg->getName() << " dropped, interface " << iface
+                       << " exceeded its rate limit." << LogEnd;
+            if (retransmission)
+                EarlyDropped++;
+            else
+                Dropped[SRV_RATE_LIMIT_IFACE]++;
+            return false;
+        }
+    }
+
+    // all buckets admit this message, charge them
+    if (!client.empty())
+        Buckets[SRV_RATE_LIMIT_CLIENT].take(client);
+    if (!link.empty())
+        Buckets[SRV_RATE_LIMIT_LINK].take(link);
+    if (!iface.empty())
+        Buckets[SRV_RATE_LIMIT_IFACE].take(iface);
+
+    Admitted++;
+    return true;
+}
+
+/**
+ * @brief load sharing: checks if this server or its replication peer should answer
+ *
+ * Clients that don't address a particular server (SOLICIT, REBIND, CONFIRM,
+ * INFORMATION-REQUEST) are split between servers by DUID, as long as the
+ * replication peer is up. Right after start, they are not answered until
+ * peer's leases are received.
+ *
+ * @param msg received message
+ *
+ * @return true if message should be processed here
+ */
+bool TSrvTransMgr::ownsMsg(SPtr<TSrvMsg> msg)
+{
+    if (!SrvReplMgr().isActive())
+        return true;
+
+    SPtr<TOptDUID> clientID = (Ptr*) msg->getOption(OPTION_CLIENTID);
+    if (SrvReplMgr().ownsClient(msg->getType(), clientID ? clientID->getDUID() : 0))
+        return true;
+
+    if (!SrvReplMgr().ready())
+        Log(Debug) << "Replication: " << msg->getName() << " ignored, peer's leases not received yet." << LogEnd;
+    else
+        Log(Debug) << "Replication: " << msg->getName() << " ignored, client is served by peer." << LogEnd;
+    return false;
+}
+
+/**
+ * takes over leases, which client got from other worker (e.g. before the
+ * number of workers was changed)
+ *
+ * @param msg received message
+ */
+void TSrvTransMgr::importLeases(SPtr<TSrvMsg> msg)
+{
+    SPtr<TOptDUID> clientID = (Ptr*) msg->getOption(OPTION_CLIENTID);
+    if (!clientID)
+        return;
+
+    SPtr<TOpt> opt, subopt;
+    msg->firstOption();
+    while (opt = msg->getOption()) {
+        if (opt->getOptType() == OPTION_IA_NA) {
+            SPtr<TOptIA_NA> ia = (Ptr*) opt;
+            ia->firstOption();
+            while (subopt = ia->getOption()) {
+                if (subopt->getOptType() != OPTION_IAADDR)
+                    continue;
+                SPtr<TOptIAAddress> addr = (Ptr*) subopt;
+                SrvLeaseStore().importLease(TAddrIA::TYPE_IA, clientID->getDUID(), ia->getIAID(),
+                                            addr->getAddr());
+            }
+        }
+        if (opt->getOptType() == OPTION_IA_PD) {
+            SPtr<TOptIA_PD> pd = (Ptr*) opt;
+            pd->firstOption();
+            while (subopt = pd->getOption()) {
+                if (subopt->getOptType() != OPTION_IAPREFIX)
+                    continue;
+                SPtr<TOptIAPrefix> prefix = (Ptr*) subopt;
+                SrvLeaseStore().importLease(TAddrIA::TYPE_PD, clientID->getDUID(), pd->getIAID(),
+                                            prefix->getPrefix());
+            }
+        }
+    }
+}
+
+/**
+ * checks if reply to this message is still in the reply buffer. Transaction-id
+ * is chosen by client, so client's DUID must match as well.
+ *
+ * @param msg received message
+ *
+ * @return true if buffered reply will be retransmitted
+ */
+bool TSrvTransMgr::replyBuffered(SPtr<TSrvMsg> msg)
+{
+    SPtr<TOptDUID> clientID = (Ptr*) msg->getOption(OPTION_CLIENTID);
+    if (!clientID || !clientID->getDUID())
+        return false;
+
+    SPtr<TSrvMsg> answ;
+    MsgLst.first();
+    while (answ = MsgLst.get()) {
+        if (answ->getTransID() != msg->getTransID())
+            continue;
+        SPtr<TOptDUID> answClientID = (Ptr*) answ->getOption(OPTION_CLIENTID);
+        if (answClientID && answClientID->getDUID() &&
+            *answClientID->getDUID() == *clientID->getDUID())
+            return true;
+    }
+    return false;
+}
+
+/// forgets buckets that are full again (they are equal to newly created ones)
+void TSrvTransMgr::purgeBuckets(unsigned long long now)
+{
+    if (now - LastPurge < SERVER_DEFAULT_ADMISSION_PURGE*1000)
+        return;
+    LastPurge = now;
+
+    for (int i=0; i<SRV_RATE_LIMIT_MAX; i++)
+        Buckets[i].purge(now);
+}
+
+void TSrvTransMgr::printStats(std::ostream & out)
+{
+    TStatsMgr::printType(out, "dibbler_admitted_messages_total", "counter",
+                         "Received messages that passed admission control.");
+    out << "dibbler_admitted_messages_total " << Admitted << endl;
+    TStatsMgr::printType(out, "dibbler_dropped_messages_total", "counter",
+                         "Received messages dropped by admission control.");
+    out << "dibbler_dropped_messages_total{reason=\"client\"} " << Dropped[SRV_RATE_LIMIT_CLIENT] << endl;
+    out << "dibbler_dropped_messages_total{reason=\"link\"} " << Dropped[SRV_RATE_LIMIT_LINK] << endl;
+    out << "dibbler_dropped_messages_total{reason=\"iface\"} " << Dropped[SRV_RATE_LIMIT_IFACE] << endl;
+    out << "dibbler_dropped_messages_total{reason=\"retransmission\"} " << EarlyDropped << endl;
+    TStatsMgr::printType(out, "dibbler_admission_buckets", "gauge",
+                         "Clients, relay links and interfaces tracked by admission control.");
+    out << "dibbler_admission_buckets{type=\"client\"} " << Buckets[SRV_RATE_LIMIT_CLIENT].size() << endl;
+    out << "dibbler_admission_buckets{type=\"link\"} " << Buckets[SRV_RATE_LIMIT_LINK].size() << endl;
+    out << "dibbler_admission_buckets{type=\"iface\"} " << Buckets[SRV_RATE_LIMIT_IFACE].size() << endl;
+}
+
 void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
 {
     requestMsg = msg;
@@ -161,11 +430,18 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
     if (!msg->check()) {
         // proper warnings will be printed in the check() method, if necessary.
         // Log(Warning) << "Invalid message received." << LogEnd;
+        StatsMgr().DecodeErrors++;
         return;
     }
 
+    if (!admitMsg(msg))
+        return;
+
     // Ask NodeClietSpecific to analyse the message
     NodeClientSpecific::analyseMessage(msg);
+
+    if (SrvLeaseStore().isActive())
+        importLeases(msg);
     //SrvCfgMgr().InClientClass(msg);
 
     /// @todo (or at least disable by default) answer buffering mechanism
@@ -178,6 +454,7 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
         if (answ->getTransID()==msg->getTransID()) {
             Log(Cont) << " Old reply with transID=" << hex << msg->getTransID()
                       << dec << " found. Sending old reply." << LogEnd;
+            StatsMgr().ReplyCacheHits++;
             answ->send();
             return;
         }
@@ -324,9 +601,11 @@ void TSrvTransMgr::relayMsg(SPtr<TSrvMsg> msg)
         SrvIfaceMgr().notifyScripts(SrvCfgMgr().getScriptName(), q, a);
     }
 
-    // save DB state regardless of action taken
-    SrvAddrMgr().dump();
-    SrvCfgMgr().dump();
+    // save DB state regardless of action taken (within dump-interval)
+    SrvAddrMgr().scheduleDump();
+
+    // counters might have changed, config dump will be written later
+    SrvCfgMgr().scheduleDump();
 }
 
 void TSrvTransMgr::doDuties()
@@ -372,6 +651,10 @@ void TSrvTransMgr::doDuties()
             openSocket(x);
     }
 
+    SrvAddrMgr().expireOffers();
+    SrvCfgMgr().dumpIfDue();
+    SrvAddrMgr().dumpIfDue();
+    SrvAddrMgr().cacheDumpIfDue();
 }
 
 
@@ -471,13 +754,15 @@ void TSrvTransMgr::removeExpired(std::vector<TSrvAddrMgr::TExpiredInfo>& addrLst
         SrvIfaceMgr().notifyScript(SrvCfgMgr().getScriptName(), "expire", params);
     }
 
-    SrvAddrMgr().dump();
+    SrvAddrMgr().scheduleDump();
 }
 
 
 void TSrvTransMgr::shutdown()
 {
     SrvAddrMgr().dump();
+    SrvAddrMgr().cacheDump();
+    SrvCfgMgr().dump();
     IsDone = true;
 }
 
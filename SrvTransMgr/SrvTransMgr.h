@@ -22,6 +22,7 @@
 #include "SrvIfaceMgr.h"
 #include "SrvCfgIface.h"
 #include "SrvAddrMgr.h"
+#include "TokenBucket.h"
 
 #define SrvTransMgr() (TSrvTransMgr::instance())
 
@@ -36,6 +37,8 @@ class TSrvTransMgr
     SPtr<TSrvMsg> getCurrentRequest();
 
     long getTimeout();
+    bool admitMsg(SPtr<TSrvMsg> msg);
+    bool ownsMsg(SPtr<TSrvMsg> msg);
     void relayMsg(SPtr<TSrvMsg> msg);
     void doDuties();
     void dump();
@@ -53,6 +56,8 @@ class TSrvTransMgr
     char * getCtrlAddr();
     int    getCtrlIface();
 
+    void printStats(std::ostream & out);
+
   private:
     TSrvTransMgr(std::string xmlFile);
     ~TSrvTransMgr();
@@ -66,6 +71,21 @@ class TSrvTransMgr
 
     SPtr<TSrvMsg> requestMsg; /// @todo: Remove this field and do the REQUEST handling properly
 
+    // --- admission control ---
+    bool replyBuffered(SPtr<TSrvMsg> msg);
+    void purgeBuckets(unsigned long long now);
+
+    // --- workers ---
+    bool bindSocket(SPtr<TIfaceIface> iface, SPtr<TIPv6Addr> addr);
+    void importLeases(SPtr<TSrvMsg> msg);
+
+    TTokenBuckets Buckets[SRV_RATE_LIMIT_MAX];
+    bool SolicitEarlyDrop;
+    unsigned long long LastPurge;
+    unsigned long Admitted;
+    unsigned long Dropped[SRV_RATE_LIMIT_MAX];
+    unsigned long EarlyDropped;
+
     static TSrvTransMgr * Instance;
 };
 
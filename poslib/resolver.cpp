@@ -317,3 +317,303 @@ bool pos_cliresolver::waitanswer(DnsMessage*& ans, stl_slist(WaitAnswerData)& wa
 //  return false;
 }
 
+/* persistent TCP connections */
+
+pos_tcppool::connection::connection() {
+  sockid = -1;
+  connecting = false;
+}
+
+pos_tcppool::answer::answer(u_int16 _id, DnsMessage *_a, const stl_string& _error) {
+  id = _id;
+  a = _a;
+  error = _error;
+}
+
+pos_tcppool::pos_tcppool() :
+  pos_resolver() {
+  lastid = 0;
+}
+
+pos_tcppool::~pos_tcppool() {
+  std::map<stl_string, connection>::iterator it;
+  for (it = conns.begin(); it != conns.end(); it++)
+    closeconn(it->second);
+  stl_list(answer)::iterator ans;
+  for (ans = answers.begin(); ans != answers.end(); ans++)
+    if (ans->a) delete ans->a;
+}
+
+void pos_tcppool::openconn(connection& conn, _addr *server) {
+  conn.sockid = tcpopen_nb(server);
+  conn.connecting = true;
+  conn.out.erase();
+  conn.in.erase();
+}
+
+void pos_tcppool::closeconn(connection& conn) {
+  if (conn.sockid != -1) tcpclose(conn.sockid);
+  conn.sockid = -1;
+  conn.connecting = false;
+  conn.out.erase();
+  conn.in.erase();
+}
+
+void pos_tcppool::flushconn(connection& conn) {
+  while (!conn.connecting && !conn.out.empty()) {
+    int ret = tcpsend(conn.sockid, conn.out.c_str(), conn.out.size());
+    if (ret <= 0) return; /* socket buffer is full, wait until writable */
+    conn.out.erase(0, ret);
+  }
+}
+
+void pos_tcppool::readconn(const stl_string& key, connection& conn) {
+  char buff[4096];
+  int ret;
+  while ((ret = tcpread_nb(conn.sockid, buff, sizeof(buff))) > 0)
+    conn.in.append(buff, ret);
+  if (ret == 0) throw PException("Connection closed by server");
+
+  while (conn.in.size() >= 2) {
+    int len = (unsigned char)conn.in[0] * 256 + (unsigned char)conn.in[1];
+    if ((int)conn.in.size() < len + 2) break;
+    DnsMessage *a = new DnsMessage();
+    try {
+      a->read_from_data((unsigned char*)conn.in.data() + 2, len);
+    } catch (PException p) {
+      delete a;
+      throw p;
+    }
+    conn.in.erase(0, len + 2);
+
+    /* answers to queries that timed out in the meantime are dropped */
+    std::map<u_int16, query>::iterator it = queries.find(a->ID);
+    if (it == queries.end() || it->second.server != key) {
+      delete a;
+      continue;
+    }
+    queries.erase(it);
+    finish(a->ID, a, "");
+  }
+}
+
+void pos_tcppool::connfailed(const stl_string& key, const char *error, bool retry) {
+  connection& conn = conns[key];
+  closeconn(conn);
+
+  std::map<u_int16, query>::iterator it = queries.begin();
+  while (it != queries.end()) {
+    std::map<u_int16, query>::iterator cur = it++;
+    query& q = cur->second;
+    if (q.server != key) continue;
+    if (retry && !q.resent) {
+      /* probably a connection the server closed in the meantime, send
+         the query once more over a new one */
+      try {
+        if (conn.sockid == -1) openconn(conn, &q.addr);
+        q.resent = true;
+        conn.out.append(q.data);
+        continue;
+      } catch (PException p) {
+        finish(cur->first, NULL, p.message);
+        queries.erase(cur);
+        continue;
+      }
+    }
+    finish(cur->first, NULL, error);
+    queries.erase(cur);
+  }
+}
+
+void pos_tcppool::finish(u_int16 id, DnsMessage *a, const stl_string& error) {
+  answers.push_back(answer(id, a, error));
+}
+
+void pos_tcppool::expire() {
+  postime_t now = getcurtime();
+  std::map<u_int16, query>::iterator it = queries.begin();
+  while (it != queries.end()) {
+    std::map<u_int16, query>::iterator cur = it++;
+    if (cur->second.end > now) continue;
+    connection& conn = conns[cur->second.server];
+    if (conn.connecting) {
+      /* no point in waiting for the other queries on this connection */
+      connfailed(cur->second.server, "Could not connect TCP socket (timeout)", false);
+      it = queries.begin();
+      continue;
+    }
+    finish(cur->first, NULL, "Timeout");
+    queries.erase(cur);
+  }
+}
+
+u_int16 pos_tcppool::pooledsend(DnsMessage *q, _addr *server) {
+  if (queries.size() >= 65535) throw PException("Too many outstanding queries");
+  do {
+    lastid++;
+  } while (lastid == 0 || queries.find(lastid) != queries.end());
+  q->ID = lastid;
+
+  message_buff buff = q->compile(TCP_MSG_SIZE);
+  if (buff.len > 65535) throw PException("Message too large for TCP");
+  unsigned char len[2];
+  len[0] = buff.len / 256;
+  len[1] = buff.len;
+
+  stl_string key = addr_to_string(server);
+  connection& conn = conns[key];
+  if (conn.sockid != -1 && !conn.connecting && conn.out.empty() &&
+      !tcpisopen(conn.sockid)) {
+    /* closed by the server in the meantime */
+    connfailed(key, "Connection closed by server", true);
+  }
+  if (conn.sockid == -1) openconn(conn, server);
+
+  query& pending = queries[q->ID];
+  pending.server = key;
+  memcpy(&pending.addr, server, sizeof(_addr));
+  pending.data.assign((char*)len, 2);
+  pending.data.append((char*)buff.msg, buff.len);
+  pending.end = getcurtime() + tcp_timeout;
+  pending.resent = false;
+
+  conn.out.append(pending.data);
+  try {
+    flushconn(conn);
+  } catch (PException p) {
+    connfailed(key, p.message, true);
+  }
+  return q->ID;
+}
+
+int pos_tcppool::pooledfds(fd_set *rfds, fd_set *wfds) {
+  int max = -1;
+  std::map<stl_string, connection>::iterator it;
+  for (it = conns.begin(); it != conns.end(); it++) {
+    connection& conn = it->second;
+    if (conn.sockid == -1) continue;
+    if (!conn.connecting) FD_SET(conn.sockid, rfds);
+    if (conn.connecting || !conn.out.empty()) FD_SET(conn.sockid, wfds);
+    if (conn.sockid > max) max = conn.sockid;
+  }
+  return max;
+}
+
+int pos_tcppool::pooledprocess(fd_set *rfds, fd_set *wfds) {
+  /* connfailed() may reopen connections, so only look at the sockets
+     that were there when select() was called */
+  std::map<stl_string, int> ready;
+  std::map<stl_string, connection>::iterator it;
+  int handled = 0;
+  for (it = conns.begin(); it != conns.end(); it++) {
+    int sockid = it->second.sockid;
+    if (sockid == -1) continue;
+    if (FD_ISSET(sockid, rfds)) handled++;
+    if (FD_ISSET(sockid, wfds)) handled++;
+    if (FD_ISSET(sockid, rfds) || FD_ISSET(sockid, wfds))
+      ready[it->first] = sockid;
+  }
+
+  std::map<stl_string, int>::iterator r;
+  for (r = ready.begin(); r != ready.end(); r++) {
+    connection& conn = conns[r->first];
+    if (conn.sockid != r->second) continue;
+    if (conn.connecting) {
+      if (!FD_ISSET(conn.sockid, wfds)) continue;
+      if (!tcpconnected(conn.sockid)) {
+        connfailed(r->first, "Could not connect TCP socket", false);
+        continue;
+      }
+      conn.connecting = false;
+    }
+    try {
+      flushconn(conn);
+      if (FD_ISSET(conn.sockid, rfds)) readconn(r->first, conn);
+    } catch (PException p) {
+      connfailed(r->first, p.message, true);
+    }
+  }
+
+  /* queries sent again over a new connection */
+  for (it = conns.begin(); it != conns.end(); it++) {
+    try {
+      if (it->second.sockid != -1) flushconn(it->second);
+    } catch (PException p) {
+      connfailed(it->first, p.message, false);
+    }
+  }
+
+  expire();
+  return handled;
+}
+
+bool pos_tcppool::pooledanswer(u_int16& id, DnsMessage*& a, stl_string& error) {
+  if (answers.empty()) return false;
+  id = answers.front().id;
+  a = answers.front().a;
+  error = answers.front().error;
+  answers.pop_front();
+  return true;
+}
+
+int pos_tcppool::pooledtimeout() {
+  if (!answers.empty()) return 0;
+  if (queries.empty()) return -1;
+  postime_t now = getcurtime();
+  postime_t first = queries.begin()->second.end;
+  std::map<u_int16, query>::iterator it;
+  for (it = queries.begin(); it != queries.end(); it++)
+    if (it->second.end < first) first = it->second.end;
+  int ms = first.after(now);
+  return ms < 0 ? 0 : ms;
+}
+
+int pos_tcppool::pooledpending() {
+  return queries.size() + answers.size();
+}
+
+void pos_tcppool::pooledquery(DnsMessage *q, DnsMessage*& a, _addr *server) {
+  u_int16 id = pooledsend(q, server);
+  a = NULL;
+  while (1) {
+    stl_list(answer)::iterator it;
+    for (it = answers.begin(); it != answers.end(); it++) {
+      if (it->id != id) continue;
+      a = it->a;
+      stl_string error = it->error;
+      answers.erase(it);
+      if (!a) throw PException(error.c_str());
+      return;
+    }
+
+    fd_set rfds, wfds;
+    FD_ZERO(&rfds);
+    FD_ZERO(&wfds);
+    int max = pooledfds(&rfds, &wfds);
+    int ms = pooledtimeout();
+    if (ms < 0) ms = 0;
+    struct timeval tv;
+    tv.tv_sec = ms / 1000;
+    tv.tv_usec = (ms % 1000) * 1000;
+    if (select(max + 1, &rfds, &wfds, NULL, &tv) < 0) {
+      FD_ZERO(&rfds);
+      FD_ZERO(&wfds);
+    }
+    pooledprocess(&rfds, &wfds);
+  }
+}
+
+void pos_tcppool::disconnect(_addr *server) {
+  stl_string key = addr_to_string(server);
+  if (conns.find(key) == conns.end()) return;
+  connfailed(key, "Connection closed", false);
+  conns.erase(key);
+}
+
+void pos_tcppool::disconnectall() {
+  while (!conns.empty()) {
+    stl_string key = conns.begin()->first;
+    connfailed(key, "Connection closed", false);
+    conns.erase(key);
+  }
+}
@@ -22,9 +22,11 @@
 #define __POSLIB_RESOLVER_H
 
 #include "sysstl.h"
+#include <map>
 
 #include "socket.h"
 #include "dnsmessage.h"
+#include "postime.h"
 
 /*! \file poslib/resolver.h
  * \brief Posadis resolver functionality
@@ -332,4 +334,152 @@ class pos_cliresolver : public pos_resolver {
 #endif
 };
 
+/*!
+ * \brief pool of persistent TCP connections to DNS servers
+ *
+ * Unlike pos_cliresolver, which opens a new TCP connection for every query,
+ * this class keeps one connection per server open between queries.
+ *
+ * Queries are sent without waiting for the answers to earlier ones, so
+ * several of them can be outstanding on a connection at once. Every query
+ * gets an ID that is unique among the outstanding ones, and answers are
+ * matched to queries by that ID, in whatever order the server sends them.
+ *
+ * All sockets are non-blocking. A caller with its own event loop adds the
+ * pool's sockets with pooledfds(), hands the result of select() to
+ * pooledprocess() and collects finished queries with pooledanswer(). The
+ * loop should not sleep longer than pooledtimeout(). pooledquery() wraps
+ * this into a blocking call.
+ *
+ * If a connection is closed or fails while queries are outstanding on it,
+ * they are sent again, once, over a new connection. A query for which no
+ * answer arrives within #tcp_timeout milliseconds fails with "Timeout".
+ */
+class pos_tcppool : public pos_resolver {
+  public:
+  pos_tcppool();
+
+  /*!
+   * \brief destructor
+   *
+   * Closes all connections. Outstanding queries are dropped.
+   */
+  virtual ~pos_tcppool();
+
+  /*!
+   * \brief sends a query and waits for its answer
+   *
+   * Other queries in the pool progress while this function waits, but only
+   * the answer to this one is taken from the pool.
+   * \param q The DNS query message. Its ID is overwritten.
+   * \param a Variable to put the answer in
+   * \param server The server to query
+   */
+  void pooledquery(DnsMessage *q, DnsMessage*& a, _addr *server);
+
+  /*!
+   * \brief sends a query without waiting for its answer
+   *
+   * Opens a connection to the server if there is none yet (or the old one
+   * was closed by the server). The connection attempt itself does not
+   * block, so a failure to connect is usually reported by pooledanswer().
+   * \param q The DNS query message. Its ID is set to a non-zero value not
+   *          used by any other outstanding query.
+   * \param server The server to query
+   * \return The ID of the query
+   */
+  u_int16 pooledsend(DnsMessage *q, _addr *server);
+
+  /*!
+   * \brief adds the pool's sockets to the sets for select()
+   *
+   * \return The highest socket added, or -1 if there is none.
+   */
+  int pooledfds(fd_set *rfds, fd_set *wfds);
+
+  /*!
+   * \brief handles the sockets select() reported ready
+   *
+   * Finishes connections, sends queued data, reads answers and expires
+   * queries that ran out of time.
+   * \return The number of ready descriptors handled, each set counted
+   *         separately, as select() does.
+   */
+  int pooledprocess(fd_set *rfds, fd_set *wfds);
+
+  /*!
+   * \brief returns a finished query, if there is one
+   *
+   * \param id Variable to put the ID of the query in
+   * \param a Variable to put the answer in. NULL if the query failed; the
+   *          caller has to delete it otherwise.
+   * \param error Variable to put the reason of the failure in
+   * \return false if no query has finished
+   */
+  bool pooledanswer(u_int16& id, DnsMessage*& a, stl_string& error);
+
+  /*!
+   * \brief milliseconds until the next outstanding query times out
+   *
+   * \return The number of milliseconds (0 if pooledanswer() has something to
+   *         return), or -1 if no query is outstanding.
+   */
+  int pooledtimeout();
+
+  /*!
+   * \brief number of queries sent but not yet collected by pooledanswer()
+   */
+  int pooledpending();
+
+  /*!
+   * \brief closes the connection to the given server (if there is one)
+   *
+   * Queries outstanding on it fail.
+   */
+  void disconnect(_addr *server);
+
+  /*!
+   * \brief closes all connections
+   *
+   * Outstanding queries fail.
+   */
+  void disconnectall();
+
+ private:
+  class connection {
+   public:
+    connection();
+    int sockid;
+    bool connecting;
+    stl_string out; /* data not sent yet */
+    stl_string in;  /* data received, but not a complete message yet */
+  };
+  class query {
+   public:
+    stl_string server; /* key in conns */
+    _addr addr;
+    stl_string data;   /* message with its length prefix, kept for resending */
+    postime_t end;
+    bool resent;
+  };
+  class answer {
+   public:
+    answer(u_int16 _id, DnsMessage *_a, const stl_string& _error);
+    u_int16 id;
+    DnsMessage *a;
+    stl_string error;
+  };
+  void openconn(connection& conn, _addr *server);
+  void closeconn(connection& conn);
+  void flushconn(connection& conn);
+  void readconn(const stl_string& key, connection& conn);
+  void connfailed(const stl_string& key, const char *error, bool retry);
+  void finish(u_int16 id, DnsMessage *a, const stl_string& error);
+  void expire();
+  std::map<stl_string, connection> conns;
+  std::map<u_int16, query> queries;
+  stl_list(answer) answers;
+  u_int16 lastid;
+};
+
 #endif /* __POSLIB_RESOLVER_H */
@@ -170,6 +170,32 @@ int tcpopen_from(_addr *to, _addr *source) {
     return sockid;
 }
 
+int tcpopen_nb(_addr *addr) {
+    int sockid;
+    if ((sockid = socket(struct_pf(addr), SOCK_STREAM, IPPROTO_TCP)) < 0)
+	throw PException("Could not create TCP socket");
+    setnonblock(sockid);
+    if (connect(sockid, (sockaddr *)addr, struct_len(addr)) < 0) {
+#ifdef _WIN32
+	if (WSAGetLastError() != WSAEWOULDBLOCK) {
+#else
+	if (errno != EINPROGRESS) {
+#endif
+	    closesocket(sockid);
+	    std::string txt = addr_to_string(addr, false);
+	    throw PException(true, "Could not connect TCP socket to dst addr=%s", txt.c_str());
+	}
+    }
+    return sockid;
+}
+
+bool tcpconnected(int sockid) {
+  int err = 0;
+  socklen_t len = sizeof(err);
+  if (getsockopt(sockid, SOL_SOCKET, SO_ERROR, (char*)&err, &len) < 0) return false;
+  return err == 0;
+}
+
 void tcpclose(int socket) {
     closesocket(socket);
 }
@@ -184,7 +210,11 @@ int tcpaccept(int socket, _addr *askaddr) {
 }
 
 int tcpsend(int socket, const char *buff, int bufflen) {
+#ifdef MSG_NOSIGNAL
+  int ret = send(socket, buff, bufflen, MSG_NOSIGNAL);
+#else
   int ret = send(socket, buff, bufflen, 0);
+#endif
   if (ret < 0 && errno != EAGAIN) throw PException("Could not send TCP message");
   return ret;
 }
@@ -252,6 +282,15 @@ void tcpreadall(int sockid, const char *buff, int len, int maxtime) {
   }
 }
 
+int tcpread_nb(int socket, char *buff, int bufflen) {
+  int ret = recv(socket, buff, bufflen, 0);
+  if (ret < 0) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) return -1;
+    throw PException(true, "Could not read TCP message");
+  }
+  return ret;
+}
+
 bool tcpisopen(int sockid) {
   smallset_t set;
   set.init(1);
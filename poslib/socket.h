@@ -71,6 +71,12 @@ int tcpcreateserver(_addr *a);
 int tcpopen(_addr *a);
 /** Opens a TCP client coonection to the specified server from the specificed source address. */
 int tcpopen_from(_addr *to, _addr *source);
+/** Starts connecting to the specified server without waiting for the
+    connection to complete. The socket becomes writable once it does; use
+    tcpconnected() to see whether it succeeded. */
+int tcpopen_nb(_addr *a);
+/** Checks whether a connect started by tcpopen_nb() succeeded. */
+bool tcpconnected(int sockid);
 /** Closes a TCP client/server connection. */
 void tcpclose(int sockid);
 /** Accepts a client connection on a TCP server connection. */
@@ -82,6 +88,9 @@ int tcpsend(int sockid, const char *buff, int len);
 void tcpsendall(int sockid, const char *buff, int len, int maxtime);
 /** Reads data from the TCP connection. Doesn't guarantee all data is read, but returns immediately. */
 int tcpread(int sockid, const char *buff, int len);
+/** Reads data from a non-blocking TCP connection. Returns 0 if the connection
+    was closed and -1 if there is no data available right now. */
+int tcpread_nb(int sockid, char *buff, int len);
 /** Reads \p len bytes through the TCP connection. Take at most \p maxtime milliseconds. */
 void tcpreadall(int sockid, const char *buff, int len, int maxtime);
 
@@ -1,31 +1,250 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * Digest and HMAC test: checks results against RFC2202/RFC4231 test vectors
+ * (one-shot, with prepared key and with every multi-buffer implementation this
+ * CPU supports). It is run by "make check". When started with a number
+ * (e.g. ./Digests 200000), it also measures how many messages per second can
+ * be authenticated.
+ *
+ * released under GNU GPL v2 only licence
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "sha256.h"
+#include "hmac.h"
+#include "sha-mb.h"
+
+static void toHex(const char* digest, int len, char* out) {
+    for (int x=0; x<len; x++)
+        sprintf(out + 2*x, "%02x", (unsigned char)digest[x]);
+    out[2*len] = 0;
+}
 
-void printHash(char* digest) {
-    int x=0;
-    for (x=0;x<32;x++) {
-        printf("%02x", digest[x]);
+static int check(const char* name, const char* digest, int len, const char* expected) {
+    char hex[2*64+1];
+    toHex(digest, len, hex);
+    if (strcmp(hex, expected)) {
+        printf("FAIL %s: got %s, expected %s\n", name, hex, expected);
+        return 1;
     }
-    printf("\n");
+    printf("ok   %s\n", name);
+    return 0;
 }
 
-int main() {
-    
-    char * buf1 = "The quick brown fox jumps over the lazy dog";
+struct HmacVector {
+    int type;
+    int digestLen;
+    int keyCase;
+    const char* expected;
+};
+
+// keys and data from RFC2202 (test cases 1, 2 and 6) and RFC4231 (1, 2 and 6)
+static const HmacVector Vectors[] = {
+    {  5, 16, 0, "5ccec34ea9656392457fa1ac27f08fbc" },
+    {  5, 16, 1, "750c783e6ab0b503eaa86e310a5db738" },
+    {  5, 16, 2, "bfecaf4efff90a3a668f3922fec3762d" },
+    {  1, 20, 0, "b617318655057264e28bc0b6fb378c8ef146be00" },
+    {  1, 20, 1, "effcdf6ae5eb2fa2d27416d5f184df9c259a7c79" },
+    {  1, 20, 2, "90d0dace1c1bdc957339307803160335bde6df2b" },
+    {224, 28, 0, "896fb1128abbdf196832107cd49df33f47b4b1169912ba4f53684b22" },
+    {224, 28, 1, "a30e01098bc6dbbf45690f3a7e9e6d0f8bbea2a39e6148008fd05e44" },
+    {224, 28, 2, "95e9a0db962095adaebe9b2d6f0dbce2d499f112f2d2b7273fa6870e" },
+    {256, 32, 0, "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+    {256, 32, 1, "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+    {256, 32, 2, "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+    {384, 48, 0, "afd03944d84895626b0825f4ab46907f15f9dadbe4101ec682aa034c7cebc59c"
+                 "faea9ea9076ede7f4af152e8b2fa9cb6" },
+    {384, 48, 1, "af45d2e376484031617f78d2b58a6b1b9c7ef464f5a01b47e42ec3736322445e"
+                 "8e2240ca5e69e2c78b3239ecfab21649" },
+    {384, 48, 2, "4ece084485813e9088d2c63a041bc5b44f9ef1012a2b588f3cd11f05033ac4c6"
+                 "0c2ef6ab4030fe8296248df163f44952" },
+    {512, 64, 0, "87aa7cdea5ef619d4ff0b4241a1d6cb02379f4e2ce4ec2787ad0b30545e17cde"
+                 "daa833b7d6b8a702038b274eaea3f4e4be9d914eeb61f1702e696c203a126854" },
+    {512, 64, 1, "164b7a7bfcf819e2e395fbe73b56e0a387bd64222e831fd610270cd7ea250554"
+                 "9758bf75c05a994a6d034f65f8f0e6fdcaeab1a34d4a6b4b636e070a38bce737" },
+    {512, 64, 2, "80b24263c7c1a3ebb71493c1dd7be8b49b46d1f41b4aeec1121b013783f8f352"
+                 "6b56d037e05f2598bd0fd2215d6a1e5295e64f73f63f0aec8b915a985d786598" }
+};
+
+static int testHmac() {
+    char key[3][131];
+    size_t keyLen[3] = { 20, 4, 131 };
+    const char* data[3] = { "Hi There", "what do ya want for nothing?",
+                            "Test Using Larger Than Block-Size Key - Hash Key First" };
+    memset(key[0], 0x0b, 20);
+    memcpy(key[1], "Jefe", 4);
+    memset(key[2], 0xaa, 131);
+
+    int failed = 0;
+    for (unsigned i=0; i<sizeof(Vectors)/sizeof(Vectors[0]); i++) {
+        const HmacVector& v = Vectors[i];
+        char name[64];
+        char digest[64];
+
+        sprintf(name, "hmac-%s%d case %d", v.type==5 ? "md" : "sha", v.type, v.keyCase);
+        memset(digest, 0, sizeof(digest));
+        if (v.type == 5)
+            hmac_md5(data[v.keyCase], strlen(data[v.keyCase]), key[v.keyCase], keyLen[v.keyCase], digest);
+        else
+            hmac_sha(data[v.keyCase], strlen(data[v.keyCase]), key[v.keyCase], keyLen[v.keyCase], digest, v.type);
+        failed += check(name, digest, v.digestLen, v.expected);
+
+        // prepared key must give the same result, also when used several times
+        struct hmac_key hk;
+        hmac_key_init(&hk, key[v.keyCase], keyLen[v.keyCase], v.type);
+        strcat(name, " (prepared key)");
+        for (int j=0; j<2; j++) {
+            memset(digest, 0, sizeof(digest));
+            hmac_key_digest(&hk, data[v.keyCase], strlen(data[v.keyCase]), digest);
+            failed += check(name, digest, v.digestLen, v.expected);
+        }
+    }
+    return failed;
+}
+
+static int testSha256() {
+    const char* buf = "The quick brown fox jumps over the lazy dog";
     char digest[32];
+    sha256_buffer(buf, strlen(buf), (void*)digest);
+    return check("sha256", digest, 32,
+                 "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592");
+}
 
-    int len = strlen(buf1);
-    void * result = sha256_buffer(buf1, len, (void*)digest);
+static const char* Impls[] = { "avx2", "sse4.1", "generic" };
 
-    printf("str=[%s] len=%d result=%p digest=%p\n", buf1, strlen(buf1), result, digest);
-    printHash(digest);
+/// multi-buffer HMAC must give the same results as one message at a time
+static int testMultiBuffer() {
+    // lengths around block and padding boundaries
+    static const size_t lens[] = { 0, 1, 55, 56, 63, 64, 65, 119, 120, 128, 300, 1000, 37 };
+    static const int types[] = { 1, 224, 256, 5, 512 };
+    const int count = sizeof(lens)/sizeof(lens[0]);
+    char msg[count][1000];
+    char key[count][20];
+    struct hmac_key hk[count];
+    const struct hmac_key* hkp[count];
+    const char* buf[count];
+    size_t len[count];
+    char* res[count];
+    char digest[count][64];
+    char expected[count][64];
+    int failed = 0;
 
-    printf("\n");
+    for (int i=0; i<count; i++) {
+        for (size_t j=0; j<sizeof(msg[i]); j++)
+            msg[i][j] = (char)(i*31 + j*7);
+        for (size_t j=0; j<sizeof(key[i]); j++)
+            key[i][j] = (char)(i + j);
+        buf[i] = msg[i];
+        len[i] = lens[i];
+        res[i] = digest[i];
+        hkp[i] = &hk[i];
+    }
+
+    for (unsigned impl=0; impl<sizeof(Impls)/sizeof(Impls[0]); impl++) {
+        if (sha_mb_use(Impls[impl])) {
+            printf("skip multi-buffer %s (not supported by this CPU)\n", Impls[impl]);
+            continue;
+        }
+        for (unsigned t=0; t<=sizeof(types)/sizeof(types[0]); t++) {
+            // last round mixes all types in one batch
+            memset(expected, 0, sizeof(expected));
+            for (int i=0; i<count; i++) {
+                int type = t < sizeof(types)/sizeof(types[0]) ? types[t] : types[i % 5];
+                hmac_key_init(&hk[i], key[i], sizeof(key[i]), type);
+                hmac_key_digest(&hk[i], msg[i], lens[i], expected[i]);
+            }
+            // whole batch, then batches of every size
+            for (int n=count; n>0; n--) {
+                memset(digest, 0, sizeof(digest));
+                hmac_key_digest_mb(hkp, buf, len, res, n);
+                for (int i=0; i<n; i++) {
+                    if (memcmp(digest[i], expected[i], 64)) {
+                        printf("FAIL multi-buffer %s: type %d, batch of %d, message %d\n",
+                               Impls[impl], hk[i].type, n, i);
+                        failed++;
+                    }
+                }
+            }
+        }
+        printf("ok   multi-buffer %s\n", Impls[impl]);
+    }
 
-    char * buf2="The quick brown fox jumps over the lazy dogThe quick brown fox jumps over the lazy dog";
-    len = strlen(buf2);
-    result = sha256_buffer(buf2, len, (void*)digest);
+    // back to the best one
+    for (unsigned impl=0; impl<sizeof(Impls)/sizeof(Impls[0]); impl++) {
+        if (!sha_mb_use(Impls[impl]))
+            break;
+    }
+    return failed;
+}
+
+/// authenticates typical DHCPv6 messages (key is AUTHKEYLEN bytes, as in dibbler)
+static void benchmark(int type, int msgLen, int count) {
+    char key[20];
+    char msg[SHA_MB_LANES][1024];
+    char digest[SHA_MB_LANES][64];
+    for (int i=0; i<(int)sizeof(key); i++)
+        key[i] = (char)i;
+    for (int l=0; l<SHA_MB_LANES; l++)
+        for (int i=0; i<msgLen; i++)
+            msg[l][i] = (char)(i*7 + l);
+
+    clock_t start = clock();
+    for (int i=0; i<count; i++) {
+        msg[0][0] = (char)i;
+        hmac_sha(msg[0], msgLen, key, sizeof(key), digest[0], type);
+    }
+    double oneShot = (double)(clock()-start)/CLOCKS_PER_SEC;
+
+    struct hmac_key hk;
+    hmac_key_init(&hk, key, sizeof(key), type);
+    start = clock();
+    for (int i=0; i<count; i++) {
+        msg[0][0] = (char)i;
+        hmac_key_digest(&hk, msg[0], msgLen, digest[0]);
+    }
+    double prepared = (double)(clock()-start)/CLOCKS_PER_SEC;
+
+    // batches of received messages, as the server authenticates them
+    const struct hmac_key* hkp[SHA_MB_LANES];
+    const char* buf[SHA_MB_LANES];
+    size_t len[SHA_MB_LANES];
+    char* res[SHA_MB_LANES];
+    for (int l=0; l<SHA_MB_LANES; l++) {
+        hkp[l] = &hk;
+        buf[l] = msg[l];
+        len[l] = msgLen;
+        res[l] = digest[l];
+    }
+    start = clock();
+    for (int i=0; i<count; i+=SHA_MB_LANES) {
+        msg[0][0] = (char)i;
+        hmac_key_digest_mb(hkp, buf, len, res, SHA_MB_LANES);
+    }
+    double batch = (double)(clock()-start)/CLOCKS_PER_SEC;
+
+    printf("hmac-sha%-3d %4d bytes: %9.0f msgs/s (key hashed each time), %9.0f msgs/s (prepared key), "
+           "%9.0f msgs/s (%s, %d at once)\n",
+           type, msgLen, oneShot > 0 ? count/oneShot : 0.0, prepared > 0 ? count/prepared : 0.0,
+           batch > 0 ? count/batch : 0.0, sha_mb_impl(), SHA_MB_LANES);
+}
+
+int main(int argc, char* argv[]) {
+    int failed = testSha256() + testHmac() + testMultiBuffer();
+    printf("%d test(s) failed.\n", failed);
+    if (failed || argc < 2)
+        return failed ? 1 : 0;
+
+    int count = atoi(argv[1]);
+    int sizes[] = { 100, 300, 1000 };
+    printf("\n");
+    for (int i=0; i<3; i++) {
+        benchmark(1, sizes[i], count);
+        benchmark(256, sizes[i], count);
+    }
 
-    printf("str=[%s] len=%d result=%p digest=%p\n", buf2, strlen(buf2), result, digest);
-    printHash(digest);
+    return 0;
 }
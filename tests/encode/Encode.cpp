@@ -0,0 +1,139 @@
+/*
+ * Dibbler - a portable DHCPv6
+ *
+ * author: Tomasz Mrugalski <thomson@klub.com.pl>
+ *
+ * released under GNU GPL v2 only licence
+ *
+ */
+
+/* Encode test: stores typical REPLY messages and checks that the stored
+   length matches getSize(). It is run by "make check". When started with a
+   number (e.g. ./Encode 100000), it also stores each message that many times
+   and reports the time per message. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include "Msg.h"
+#include "OptDUID.h"
+#include "OptIA_NA.h"
+#include "OptIA_PD.h"
+#include "OptIAAddress.h"
+#include "OptIAPrefix.h"
+#include "OptStatusCode.h"
+#include "OptAddrLst.h"
+#include "OptDomainLst.h"
+#include "DHCPConst.h"
+
+using namespace std;
+
+class TTestMsg : public TMsg {
+public:
+    TTestMsg() : TMsg(1, new TIPv6Addr("fe80::1", true), REPLY_MSG, 0x123456) { }
+    void addOption(SPtr<TOpt> opt) { Options.push_back(opt); }
+    std::string getName() const { return "REPLY"; }
+};
+
+class TTestIA_NA : public TOptIA_NA {
+public:
+    TTestIA_NA(long iaid, TMsg* parent) : TOptIA_NA(iaid, 1800, 2880, parent) { }
+    bool doDuties() { return true; }
+};
+
+class TTestIA_PD : public TOptIA_PD {
+public:
+    TTestIA_PD(long iaid, TMsg* parent) : TOptIA_PD(iaid, 1800, 2880, parent) { }
+    bool doDuties() { return true; }
+};
+
+class TTestIAPrefix : public TOptIAPrefix {
+public:
+    TTestIAPrefix(SPtr<TIPv6Addr> prefix, TMsg* parent) : TOptIAPrefix(prefix, 56, 3600, 7200, parent) { }
+    bool doDuties() { return true; }
+};
+
+/* REPLY with CLIENTID, SERVERID, ias x IA_NA(IAADDR(STATUS_CODE)), pds x IA_PD(IAPREFIX)
+   and DNS servers/domains */
+SPtr<TTestMsg> buildReply(int ias, int pds)
+{
+    SPtr<TTestMsg> msg = new TTestMsg();
+    TMsg* parent = &*msg;
+
+    msg->addOption(new TOptDUID(OPTION_CLIENTID, new TDUID("00:01:00:01:12:34:56:78:00:11:22:33:44:55"), parent));
+    msg->addOption(new TOptDUID(OPTION_SERVERID, new TDUID("00:01:00:01:87:65:43:21:00:aa:bb:cc:dd:ee"), parent));
+
+    for (int i=0; i<ias; i++) {
+        SPtr<TOpt> ia = new TTestIA_NA(i+1, parent);
+        SPtr<TOpt> addr = new TOptIAAddress(new TIPv6Addr("2001:db8::1234", true), 3600, 7200, parent);
+        addr->addOption(new TOptStatusCode(STATUSCODE_SUCCESS, "Address granted.", parent));
+        ia->addOption(addr);
+        ia->addOption(new TOptStatusCode(STATUSCODE_SUCCESS, "All addresses were assigned.", parent));
+        msg->addOption(ia);
+    }
+
+    for (int i=0; i<pds; i++) {
+        SPtr<TOpt> pd = new TTestIA_PD(i+100, parent);
+        pd->addOption(new TTestIAPrefix(new TIPv6Addr("2001:db8:1200::", true), parent));
+        msg->addOption(pd);
+    }
+
+    List(TIPv6Addr) dns;
+    dns.append(new TIPv6Addr("2001:db8::53", true));
+    dns.append(new TIPv6Addr("2001:db8::54", true));
+    msg->addOption(new TOptAddrLst(OPTION_DNS_SERVERS, dns, parent));
+    msg->addOption(new TOptDomainLst(OPTION_DOMAIN_LIST, string("example.com"), parent));
+    return msg;
+}
+
+double usec()
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec*1000000.0 + tv.tv_usec;
+}
+
+int check(const char* name, int ias, int pds)
+{
+    SPtr<TTestMsg> msg = buildReply(ias, pds);
+    char buf[4096];
+
+    int len = msg->storeSelf(buf);
+    if (len != msg->getSize()) {
+        printf("%-24s FAILED: stored %d bytes, getSize() returned %d\n", name, len, msg->getSize());
+        return 1;
+    }
+    return 0;
+}
+
+void bench(const char* name, int ias, int pds, int iterations)
+{
+    SPtr<TTestMsg> msg = buildReply(ias, pds);
+    char buf[4096];
+
+    double start = usec();
+    for (int i=0; i<iterations; i++)
+        msg->storeSelf(buf);
+    double elapsed = usec() - start;
+
+    printf("%-24s %5d bytes, %8.3f usec/msg\n", name, msg->getSize(), elapsed/iterations);
+}
+
+static const char* names[] = { "REPLY (1 IA)", "REPLY (1 IA, 1 PD)", "REPLY (4 IA, 4 PD)", "REPLY (16 IA)" };
+static const int shapes[][2] = { {1, 0}, {1, 1}, {4, 4}, {16, 0} };
+
+int main(int argc, char *argv[])
+{
+    int failed = 0;
+    for (int i=0; i<4; i++)
+        failed += check(names[i], shapes[i][0], shapes[i][1]);
+    printf("%d test(s) failed.\n", failed);
+    if (failed || argc < 2)
+        return failed ? 1 : 0;
+
+    int iterations = atoi(argv[1]);
+    for (int i=0; i<4; i++)
+        bench(names[i], shapes[i][0], shapes[i][1], iterations);
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+#!/bin/sh
+#
+# Lease replication test: two servers, each in its own network namespace,
+# connected with a veth pair. Both start with a few leases in their databases
+# (one address assigned by both of them to different clients). After they
+# exchange leases, both must know all of them and keep the older lease of the
+# conflicting address.
+#
+# Needs root (network and mount namespaces), it is skipped otherwise.
+#
+
+SERVER=${top_builddir:-../..}/dibbler-server
+PORT=5470
+NSA=dibbler-repl-a-$$
+NSB=dibbler-repl-b-$$
+
+skip() {
+    echo "SKIP: $*"
+    exit 77
+}
+
+[ "`id -u`" = 0 ] || skip "must be run as root"
+[ -x "$SERVER" ] || skip "$SERVER not built"
+SERVER=`cd \`dirname $SERVER\` && pwd`/dibbler-server
+which ip >/dev/null 2>&1 && which unshare >/dev/null 2>&1 || skip "ip or unshare not available"
+
+TMP=`mktemp -d /tmp/dibbler-repl.XXXXXX` || exit 1
+
+cleanup() {
+    for ns in $NSA $NSB; do
+        ip netns pids $ns 2>/dev/null | xargs -r kill 2>/dev/null
+        ip netns del $ns 2>/dev/null
+    done
+    rm -rf $TMP
+}
+trap cleanup EXIT
+
+ip netns add $NSA 2>/dev/null && ip netns add $NSB || skip "unable to create network namespaces"
+# server refuses to start on interfaces with tentative link-local address
+for ns in $NSA $NSB; do
+    ip netns exec $ns sysctl -q -w net.ipv6.conf.default.accept_dad=0
+done
+ip link add eth0 netns $NSA type veth peer name eth0 netns $NSB || skip "unable to create veth pair"
+for ns in $NSA $NSB; do
+    ip -n $ns link set lo up
+    ip -n $ns link set eth0 up
+done
+ip -n $NSA addr add fd00:5::1/64 dev eth0 nodad
+ip -n $NSB addr add fd00:5::2/64 dev eth0 nodad
+
+# config and lease database of one server
+# $1 - name, $2 - namespace, $3 - peer address, $4... - leases (duid-suffix address age ...)
+setup() {
+    mkdir -p $TMP/$1/etc $TMP/$1/var $TMP/$1/log
+    cat > $TMP/$1/etc/server.conf <<EOF
+log-level 8
+log-mode short
+replication-port $PORT
+replication-peer $3 $PORT
+iface "eth0" {
+ T1 1000
+ T2 2000
+ prefered-lifetime 3000
+ valid-lifetime 4000
+ class {
+   pool 2001:db8::/120
+ }
+}
+EOF
+    ifindex=`ip -n $2 -o link show eth0 | cut -d: -f1`
+    now=`date +%s`
+    name=$1
+    shift 3
+    [ $# = 0 ] && return
+    {
+        echo "<AddrMgr>"
+        echo "  <timestamp>$now</timestamp>"
+        while [ $# -gt 0 ]; do
+            echo "  <AddrClient>"
+            echo "    <duid length=\"10\">00:03:00:01:02:00:00:00:00:$1</duid>"
+            echo "    <AddrIA unicast=\"fe80::1\" T1=\"1000\" T2=\"2000\" IAID=\"1\" state=\"NOTCONFIGURED\" iface=\"$ifindex\">"
+            echo "      <duid length=\"10\">00:03:00:01:02:00:00:00:00:$1</duid>"
+            echo "      <AddrAddr timestamp=\"`expr $now - $3`\" pref=\"3000\" valid=\"4000\" prefix=\"128\">$2</AddrAddr>"
+            echo "    </AddrIA>"
+            echo "  </AddrClient>"
+            shift 3
+        done
+        echo "</AddrMgr>"
+    } > $TMP/$name.xml
+    $SERVER convert $TMP/$name.xml $TMP/$name/var/server-AddrMgr.db >/dev/null || exit 1
+}
+
+run() {
+    mkdir -p /etc/dibbler /var/lib/dibbler /var/log/dibbler
+    ip netns exec $1 unshare -m sh -c "mount --bind $TMP/$2/etc /etc/dibbler && \
+        mount --bind $TMP/$2/var /var/lib/dibbler && mount --bind $TMP/$2/log /var/log/dibbler && \
+        exec $SERVER run" > $TMP/$2.log 2>&1
+}
+
+result=0
+fail() {
+    echo "FAIL: $*"
+    result=1
+}
+
+# anyone could connect, if peer's address was not known
+setup c $NSA fd00:5::2
+sed -i '/replication-peer/d' $TMP/c/etc/server.conf
+run $NSA c
+grep -q "replication-port requires replication-peer" $TMP/c.log || fail "server without peer accepts leases"
+
+# server (a) has 2001:db8::20 assigned for a longer time than server (b)
+setup a $NSA fd00:5::2 01 2001:db8::10 100  02 2001:db8::20 1000
+setup b $NSB fd00:5::1 03 2001:db8::30 100  04 2001:db8::20 100
+
+run $NSA a &
+run $NSB b &
+
+i=0
+while [ $i -lt 30 ]; do
+    grep -q "Peer's leases received" $TMP/a.log && grep -q "Peer's leases received" $TMP/b.log && break
+    sleep 1
+    i=`expr $i + 1`
+done
+sleep 1
+
+# servers write their databases when stopped
+for ns in $NSA $NSB; do
+    ip netns pids $ns | xargs -r kill
+done
+sleep 3
+
+for s in a b; do
+    grep -q "Peer's leases received" $TMP/$s.log || fail "server $s did not receive peer's leases"
+    $SERVER convert $TMP/$s/var/server-AddrMgr.db $TMP/$s-out.xml >/dev/null || fail "server $s database not written"
+    for lease in 01:2001:db8::10 03:2001:db8::30 02:2001:db8::20; do
+        duid=`echo $lease | cut -d: -f1`
+        addr=`echo $lease | cut -d: -f2-`
+        grep -A3 "00:00:00:$duid</duid>" $TMP/$s-out.xml | grep -q ">$addr<" \
+            || fail "server $s does not have $addr of client $duid"
+    done
+    grep -q "00:00:00:04</duid>" $TMP/$s-out.xml && fail "server $s kept newer lease of 2001:db8::20"
+done
+
+if [ $result != 0 ]; then
+    for s in c a b; do
+        echo "--- server $s ---"
+        cat $TMP/$s.log
+    done
+fi
+exit $result